@@ -2202,6 +2202,8 @@ ags_gsequencer_application_context_set_tempo(AgsSoundProvider *sound_provider,
   AGS_GSEQUENCER_APPLICATION_CONTEXT(application_context)->tempo = tempo;
   
   g_rec_mutex_unlock(application_context_mutex);
+
+  ags_program_global_increment_modified_stamp();
 }
 
 GList*
@@ -3470,6 +3472,7 @@ ags_gsequencer_application_context_setup(AgsApplicationContext *application_cont
   AgsThread *export_thread;
   AgsThread *sequencer_thread;
   AgsDestroyWorker *destroy_worker;
+  AgsEpochReclaimer *epoch_reclaimer;
   AgsTaskLauncher *task_launcher;
 
   AgsLog *log;
@@ -3992,11 +3995,39 @@ ags_gsequencer_application_context_setup(AgsApplicationContext *application_cont
       }else if(!g_ascii_strncasecmp(backend,
 				    "alsa",
 				    5)){
+	str = ags_config_get_value(config,
+				   soundcard_group,
+				   "alsa-access-mode");
+
 	if(is_output){
 	  soundcard = (GObject *) ags_alsa_devout_new();
+
+	  if(str != NULL &&
+	     !g_ascii_strncasecmp(str,
+				  "mmap",
+				  5)){
+	    ags_alsa_devout_set_flags(AGS_ALSA_DEVOUT(soundcard),
+				      AGS_ALSA_DEVOUT_MMAP);
+	  }else{
+	    ags_alsa_devout_unset_flags(AGS_ALSA_DEVOUT(soundcard),
+					AGS_ALSA_DEVOUT_MMAP);
+	  }
 	}else{
 	  soundcard = (GObject *) ags_alsa_devin_new();
+
+	  if(str != NULL &&
+	     !g_ascii_strncasecmp(str,
+				  "mmap",
+				  5)){
+	    ags_alsa_devin_set_flags(AGS_ALSA_DEVIN(soundcard),
+				     AGS_ALSA_DEVIN_MMAP);
+	  }else{
+	    ags_alsa_devin_unset_flags(AGS_ALSA_DEVIN(soundcard),
+				       AGS_ALSA_DEVIN_MMAP);
+	  }
 	}
+
+	g_free(str);
       }else if(!g_ascii_strncasecmp(backend,
 				    "wasapi",
 				    7)){
@@ -4073,6 +4104,22 @@ ags_gsequencer_application_context_setup(AgsApplicationContext *application_cont
 	}else{
 	  soundcard = (GObject *) ags_oss_devin_new();
 	}
+      }else if(!g_ascii_strncasecmp(backend,
+				    "offline",
+				    8)){
+	if(!is_output){
+	  g_warning(i18n("offline soundcard backend doesn't support capture"));
+
+	  g_free(backend);
+	  g_free(soundcard_group);    
+	  soundcard_group = g_strdup_printf("%s-%d",
+					    AGS_CONFIG_SOUNDCARD,
+					    i);
+    
+	  continue;
+	}
+	
+	soundcard = (GObject *) ags_offline_devout_new();
       }else{
 	g_warning(i18n("unknown soundcard backend - %s"), backend);
 
@@ -4528,7 +4575,8 @@ ags_gsequencer_application_context_setup(AgsApplicationContext *application_cont
        AGS_IS_WASAPI_DEVOUT(list->data) ||
        AGS_IS_JACK_DEVOUT(list->data) ||
        AGS_IS_PULSE_DEVOUT(list->data) ||
-       AGS_IS_CORE_AUDIO_DEVOUT(list->data)){
+       AGS_IS_CORE_AUDIO_DEVOUT(list->data) ||
+       AGS_IS_OFFLINE_DEVOUT(list->data)){
       export_thread = (AgsThread *) ags_export_thread_new(list->data,
 							  NULL);
       ags_thread_add_child_extended(main_loop,
@@ -4748,6 +4796,15 @@ ags_gsequencer_application_context_setup(AgsApplicationContext *application_cont
   gsequencer_application_context->worker = g_list_prepend(gsequencer_application_context->worker,
 							  destroy_worker);
   ags_thread_start((AgsThread *) destroy_worker);
+
+  /* AgsEpochReclaimer */
+  epoch_reclaimer = ags_epoch_reclaimer_get_instance();
+  ags_thread_add_child_extended(main_loop,
+				(AgsThread *) epoch_reclaimer,
+				TRUE, TRUE);
+  gsequencer_application_context->worker = g_list_prepend(gsequencer_application_context->worker,
+							  epoch_reclaimer);
+  ags_thread_start((AgsThread *) epoch_reclaimer);
   
   /* AgsThreadPool */
   gsequencer_application_context->thread_pool = NULL;
@@ -186,6 +186,11 @@ ags_performance_preferences_init(AgsPerformancePreferences *performance_preferen
 			   FALSE);
 #endif
 
+  /* work-stealing */
+  performance_preferences->work_stealing = (GtkCheckButton *) gtk_check_button_new_with_label(i18n("Work-stealing - audio"));
+  gtk_box_append(GTK_BOX(performance_preferences),
+		 GTK_WIDGET(performance_preferences->work_stealing));
+
   /* thread-pool - max unused threads */
   hbox = (GtkBox *) gtk_box_new(GTK_ORIENTATION_HORIZONTAL,
 				AGS_UI_PROVIDER_DEFAULT_SPACING);
@@ -277,6 +282,9 @@ ags_performance_preferences_connect(AgsConnectable *connectable)
   
   g_signal_connect_after(G_OBJECT(performance_preferences->super_threaded_channel), "toggled",
 			 G_CALLBACK(ags_performance_preferences_super_threaded_channel_callback), performance_preferences);
+
+  g_signal_connect_after(G_OBJECT(performance_preferences->work_stealing), "toggled",
+			 G_CALLBACK(ags_performance_preferences_work_stealing_callback), performance_preferences);
 }
 
 void
@@ -297,6 +305,12 @@ ags_performance_preferences_disconnect(AgsConnectable *connectable)
 		      G_CALLBACK(ags_performance_preferences_super_threaded_channel_callback),
 		      performance_preferences,
 		      NULL);
+
+  g_object_disconnect(G_OBJECT(performance_preferences->work_stealing),
+		      "any_signal::toggled",
+		      G_CALLBACK(ags_performance_preferences_work_stealing_callback),
+		      performance_preferences,
+		      NULL);
 }
 
 void
@@ -330,8 +344,13 @@ ags_performance_preferences_apply(AgsApplicable *applicable)
   g_free(str);
 
   /* restore thread config */
-  if(gtk_check_button_get_active(performance_preferences->super_threaded_audio) ||
-     gtk_check_button_get_active(performance_preferences->super_threaded_channel)){
+  if(gtk_check_button_get_active(performance_preferences->work_stealing)){
+    ags_config_set_value(config,
+			 AGS_CONFIG_THREAD,
+			 "model",
+			 "work-stealing");
+  }else if(gtk_check_button_get_active(performance_preferences->super_threaded_audio) ||
+	   gtk_check_button_get_active(performance_preferences->super_threaded_channel)){
     ags_config_set_value(config,
 			 AGS_CONFIG_THREAD,
 			 "model",
@@ -448,6 +467,19 @@ ags_performance_preferences_reset(AgsApplicable *applicable)
 			      !g_strcmp0("true",
 					 str));
   
+  /* thread model */
+  str = ags_config_get_value(config,
+			     AGS_CONFIG_THREAD,
+			     "model");
+
+  gtk_check_button_set_active(performance_preferences->work_stealing,
+			      (str != NULL &&
+			       !g_ascii_strncasecmp(str,
+						    "work-stealing",
+						    14)) ? TRUE: FALSE);
+
+  g_free(str);
+  
   /*  */
   str = ags_config_get_value(config,
 			     AGS_CONFIG_THREAD,
@@ -54,6 +54,8 @@ struct _AgsPerformancePreferences
   GtkCheckButton *super_threaded_audio;
   GtkCheckButton *super_threaded_channel;
 
+  GtkCheckButton *work_stealing;
+
   GtkSpinButton *thread_pool_max_unused_threads;
   
   GtkComboBoxText *max_precision;
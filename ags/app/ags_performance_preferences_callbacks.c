@@ -36,3 +36,24 @@ ags_performance_preferences_super_threaded_channel_callback(GtkWidget *button,
   }
 }
 
+void
+ags_performance_preferences_work_stealing_callback(GtkWidget *button,
+						   AgsPerformancePreferences *performance_preferences)
+{
+  gboolean is_active;
+
+  /* work-stealing runs the audio threads, super threaded scope doesn't apply */
+  is_active = gtk_check_button_get_active((GtkCheckButton *) button);
+  
+  gtk_widget_set_sensitive((GtkWidget *) performance_preferences->super_threaded_channel,
+			   !is_active);
+
+  if(is_active){
+    gtk_widget_set_sensitive((GtkWidget *) performance_preferences->super_threaded_audio,
+			     FALSE);
+  }else{
+    gtk_widget_set_sensitive((GtkWidget *) performance_preferences->super_threaded_audio,
+			     !gtk_check_button_get_active(performance_preferences->super_threaded_channel));
+  }
+}
+
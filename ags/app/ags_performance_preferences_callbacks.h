@@ -35,6 +35,8 @@ G_BEGIN_DECLS
 
 void ags_performance_preferences_super_threaded_channel_callback(GtkWidget *button,
 								 AgsPerformancePreferences *performance_preferences);
+void ags_performance_preferences_work_stealing_callback(GtkWidget *button,
+							AgsPerformancePreferences *performance_preferences);
 
 G_END_DECLS
 
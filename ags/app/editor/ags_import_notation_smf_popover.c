@@ -1215,23 +1215,25 @@ ags_import_notation_smf_popover_parse(AgsImportNotationSMFPopover *import_notati
 		      }
 		    }
 		    
-		    /* set x[1] and x_256th[1] */
+		    /* set x1 and x1 as 256th, the setters invalidate the notation's index */
 		    if(list != NULL){
 		      note = list->data;
 
-		      if(note->x[0] == x){
-			note->x[1] = x + 1;
+		      if(ags_note_get_x0(note) == x){
+			ags_note_set_x1(note,
+					x + 1);
 		      }else{
-			note->x[1] = x;
+			ags_note_set_x1(note,
+					x);
 		      }
 
-		      if(note->x_256th[0] == x_256th){
-			note->x_256th[1] = x_256th + 1;
+		      if(ags_note_get_x0_256th(note) == x_256th){
+			ags_note_set_x1_256th(note,
+					      x_256th + 1);
 		      }else{
-			note->x_256th[1] = x_256th;
+			ags_note_set_x1_256th(note,
+					      x_256th);
 		      }
-		
-		      note->y = y;
 		    }	    
 
 		    g_list_free_full(start_notation,
@@ -664,15 +664,14 @@ ags_time_stretch_buffer_popover_apply(AgsApplicable *applicable)
 	  g_rec_mutex_lock(orig_wave_mutex);
 
 	  /* remove original */
-	  AGS_WAVE(orig_wave->data)->buffer = g_list_remove(AGS_WAVE(orig_wave->data)->buffer,
-							    orig_buffer);
-	  g_object_unref(orig_buffer);
+	  ags_wave_remove_buffer(orig_wave->data,
+				 orig_buffer,
+				 FALSE);
 
 	  /* add new */
-	  AGS_WAVE(orig_wave->data)->buffer = g_list_insert_sorted(AGS_WAVE(orig_wave->data)->buffer,
-								   new_buffer->data,
-								   (GCompareFunc) ags_buffer_sort_func);
-	  g_object_ref(new_buffer->data);
+	  ags_wave_add_buffer(orig_wave->data,
+			      new_buffer->data,
+			      FALSE);
 
 	  g_rec_mutex_unlock(orig_wave_mutex);
 
@@ -2673,6 +2673,273 @@ ags_wave_edit_draw_buffer(AgsWaveEdit *wave_edit,
   //			   (bpm / (60.0 * (x / samplerate))) * AGS_WAVE_EDIT_X_RESOLUTION, 0.0);
 }
 
+/**
+ * ags_wave_edit_draw_peak:
+ * @wave_edit: the #AgsWaveEdit
+ * @wave: the #AgsWave
+ * @cr: the #cairo_t surface
+ * @bpm: the BPM
+ * @opacity: the opacity
+ *
+ * Draw the finished #AgsWavePeak-struct of @wave, a column per pixel. It
+ * is rebuilt by ags_wave_queue_refresh_peak() meanwhile.
+ *
+ * Since: 9.1.0
+ */
+void
+ags_wave_edit_draw_peak(AgsWaveEdit *wave_edit,
+			AgsWave *wave,
+			cairo_t *cr,
+			gdouble bpm,
+			gdouble opacity)
+{
+  AgsCompositeEditor *composite_editor;
+  AgsCompositeToolbar *composite_toolbar;
+
+  AgsWavePeak *peak;
+
+  GtkStyleContext *style_context;
+  GtkSettings *settings;
+
+  AgsApplicationContext *application_context;
+
+  GtkAllocation allocation;
+
+  GdkRGBA fg_color;
+  GdkRGBA selected_bg_color;
+
+  GList *start_selection, *selection;
+
+  gdouble gui_scale_factor;
+  double zoom_factor;
+  gdouble delay_factor;
+  gdouble frames_per_pixel;
+  gdouble height;
+  guint samplerate;
+  guint x_cut;
+  gint px0, px1;
+  gint px;
+  gboolean dark_theme;
+  gboolean fg_success;
+
+  GRecMutex *wave_mutex;
+
+  if(!AGS_IS_WAVE_EDIT(wave_edit) ||
+     !AGS_IS_WAVE(wave)){
+    return;
+  }
+
+  application_context = ags_application_context_get_instance();
+
+  /* scale factor */
+  gui_scale_factor = ags_ui_provider_get_gui_scale_factor(AGS_UI_PROVIDER(application_context));
+
+  composite_editor = (AgsCompositeEditor *) ags_ui_provider_get_composite_editor(AGS_UI_PROVIDER(application_context));
+
+  composite_toolbar = (AgsCompositeToolbar *) composite_editor->toolbar;
+
+  zoom_factor = exp2(6.0 - (double) gtk_combo_box_get_active((GtkComboBox *) composite_toolbar->zoom));
+
+  /* colors */
+  style_context = gtk_widget_get_style_context((GtkWidget *) wave_edit);
+
+  settings = gtk_settings_get_default();
+  
+  dark_theme = TRUE;
+  
+  g_object_get(settings,
+	       "gtk-application-prefer-dark-theme", &dark_theme,
+	       NULL);
+
+  fg_success = gtk_style_context_lookup_color(style_context,
+					      "theme_fg_color",
+					      &fg_color);
+
+  if(!fg_success){
+    if(!dark_theme){
+      gdk_rgba_parse(&fg_color,
+		     "#101010");
+    }else{
+      gdk_rgba_parse(&fg_color,
+		     "#eeeeec");
+    }
+  }
+  
+  gdk_rgba_parse(&selected_bg_color,
+		 "#3584e4");
+
+  gtk_widget_get_allocation(GTK_WIDGET(wave_edit->drawing_area),
+			    &allocation);
+
+  height = (gdouble) allocation.height;
+  
+  delay_factor = AGS_SOUNDCARD_DEFAULT_DELAY_FACTOR;
+
+  x_cut = (guint) gtk_adjustment_get_value(gtk_scrollbar_get_adjustment(wave_edit->hscrollbar));
+
+  /* get wave mutex */
+  wave_mutex = AGS_WAVE_GET_OBJ_MUTEX(wave);
+
+  g_rec_mutex_lock(wave_mutex);
+
+  samplerate = wave->samplerate;
+
+  start_selection = g_list_copy_deep(wave->selection,
+				     (GCopyFunc) g_object_ref,
+				     NULL);
+
+  g_rec_mutex_unlock(wave_mutex);
+
+  /* the peak is not modified after published */
+  peak = ags_wave_get_peak(wave);
+  
+  if(peak == NULL ||
+     samplerate == 0){
+    if(peak != NULL){
+      ags_wave_peak_unref(peak);
+    }
+    
+    g_list_free_full(start_selection,
+		     (GDestroyNotify) g_object_unref);
+
+    return;
+  }
+  
+  /* inverse of the buffer's x position */
+  frames_per_pixel = ((double) samplerate * delay_factor * zoom_factor) / ((bpm / 60.0) * (gui_scale_factor * 64.0));
+
+  px0 = (gint) floor((double) peak->x_offset / frames_per_pixel - (double) x_cut);
+  px1 = (gint) ceil((double) (peak->x_offset + peak->frame_count) / frames_per_pixel - (double) x_cut);
+
+  if(px0 < 0){
+    px0 = 0;
+  }
+
+  if(px1 > allocation.width){
+    px1 = allocation.width;
+  }
+
+  /* min and max */
+  cairo_set_line_width(cr, 1.0);
+
+  cairo_set_source_rgba(cr,
+			fg_color.red,
+			fg_color.green,
+			fg_color.blue,
+			0.5 * opacity * fg_color.alpha);
+
+  for(px = px0; px < px1; px++){
+    guint64 x0, x1;
+    gdouble min, max;
+
+    x0 = (guint64) (((double) px + (double) x_cut) * frames_per_pixel);
+    x1 = (guint64) (((double) px + 1.0 + (double) x_cut) * frames_per_pixel);
+
+    if(ags_wave_peak_get_range(peak,
+			       x0, x1 - x0,
+			       &min, &max, NULL)){
+      cairo_move_to(cr,
+		    (double) px + 0.5, ((min + 1.0) * height) / 2.0);
+      cairo_line_to(cr,
+		    (double) px + 0.5, ((max + 1.0) * height) / 2.0);
+    }
+  }
+
+  cairo_stroke(cr);
+
+  /* RMS */
+  cairo_set_source_rgba(cr,
+			fg_color.red,
+			fg_color.green,
+			fg_color.blue,
+			opacity * fg_color.alpha);
+
+  for(px = px0; px < px1; px++){
+    guint64 x0, x1;
+    gdouble rms;
+
+    x0 = (guint64) (((double) px + (double) x_cut) * frames_per_pixel);
+    x1 = (guint64) (((double) px + 1.0 + (double) x_cut) * frames_per_pixel);
+
+    if(ags_wave_peak_get_range(peak,
+			       x0, x1 - x0,
+			       NULL, NULL, &rms)){
+      cairo_move_to(cr,
+		    (double) px + 0.5, ((1.0 - rms) * height) / 2.0);
+      cairo_line_to(cr,
+		    (double) px + 0.5, ((1.0 + rms) * height) / 2.0);
+    }
+  }
+
+  cairo_stroke(cr);
+
+  /* selected buffers */
+  cairo_set_source_rgba(cr,
+			selected_bg_color.red,
+			selected_bg_color.green,
+			selected_bg_color.blue,
+			opacity * selected_bg_color.alpha);
+
+  cairo_set_line_width(cr, 1.0 + (double) wave_edit->selected_buffer_border);
+
+  selection = start_selection;
+  
+  while(selection != NULL){
+    guint64 x;
+    guint buffer_size;
+    gint buffer_px0, buffer_px1;
+
+    x = ags_buffer_get_x(selection->data);
+    buffer_size = ags_buffer_get_buffer_size(selection->data);
+
+    buffer_px0 = (gint) floor((double) x / frames_per_pixel - (double) x_cut);
+    buffer_px1 = (gint) ceil((double) (x + buffer_size) / frames_per_pixel - (double) x_cut);
+
+    if(buffer_px0 < px0){
+      buffer_px0 = px0;
+    }
+
+    if(buffer_px1 > px1){
+      buffer_px1 = px1;
+    }
+
+    for(px = buffer_px0; px < buffer_px1; px++){
+      guint64 x0, x1;
+      gdouble min, max;
+
+      x0 = (guint64) (((double) px + (double) x_cut) * frames_per_pixel);
+      x1 = (guint64) (((double) px + 1.0 + (double) x_cut) * frames_per_pixel);
+
+      if(x0 < x){
+	x0 = x;
+      }
+
+      if(x1 > x + buffer_size){
+	x1 = x + buffer_size;
+      }
+
+      if(x0 < x1 &&
+	 ags_wave_peak_get_range(peak,
+				 x0, x1 - x0,
+				 &min, &max, NULL)){
+	cairo_move_to(cr,
+		      (double) px + 0.5, ((min + 1.0) * height) / 2.0);
+	cairo_line_to(cr,
+		      (double) px + 0.5, ((max + 1.0) * height) / 2.0);
+      }
+    }
+    
+    selection = selection->next;
+  }
+
+  cairo_stroke(cr);
+  
+  ags_wave_peak_unref(peak);
+
+  g_list_free_full(start_selection,
+		   (GDestroyNotify) g_object_unref);
+}
+
 void
 ags_wave_edit_draw_wave(AgsWaveEdit *wave_edit, cairo_t *cr)
 {
@@ -2694,6 +2961,7 @@ ags_wave_edit_draw_wave(AgsWaveEdit *wave_edit, cairo_t *cr)
   gdouble gui_scale_factor;
   double zoom, zoom_factor;
   gdouble delay_factor;
+  gdouble frames_per_pixel;
   gdouble opacity;
   guint line;
   guint samplerate;
@@ -2783,6 +3051,26 @@ ags_wave_edit_draw_wave(AgsWaveEdit *wave_edit, cairo_t *cr)
       break;
     }
 
+    /* zoomed out - draw peaks */
+    frames_per_pixel = ((double) samplerate * delay_factor * zoom_factor) / ((bpm / 60.0) * (gui_scale_factor * 64.0));
+
+    if(frames_per_pixel >= (gdouble) AGS_WAVE_PEAK_DEFAULT_BIN_LENGTH){
+      /* rebuilt by a worker thread, redrawn by the next update UI */
+      if(ags_wave_queue_refresh_peak(wave)){
+	wave_edit->flags |= AGS_WAVE_EDIT_PEAK_REFRESH_PENDING;
+      }
+      
+      ags_wave_edit_draw_peak(wave_edit,
+			      wave,
+			      cr,
+			      bpm,
+			      opacity);
+
+      list_wave = list_wave->next;
+
+      continue;
+    }
+    
     start_list_buffer = NULL;
     g_object_get(wave,
 		 "buffer", &start_list_buffer,
@@ -77,6 +77,7 @@ typedef enum{
   AGS_WAVE_EDIT_SHOW_HSCROLLBAR             = 1 <<  3,
   AGS_WAVE_EDIT_BLOCK_RESET_VSCROLLBAR      = 1 <<  4,
   AGS_WAVE_EDIT_BLOCK_RESET_HSCROLLBAR      = 1 <<  5,
+  AGS_WAVE_EDIT_PEAK_REFRESH_PENDING        = 1 <<  6,
 }AgsWaveEditFlags;
 
 typedef enum{
@@ -174,6 +175,11 @@ void ags_wave_edit_draw_buffer(AgsWaveEdit *wave_edit,
 			       cairo_t *cr,
 			       gdouble bpm,
 			       gdouble opacity);
+void ags_wave_edit_draw_peak(AgsWaveEdit *wave_edit,
+			     AgsWave *wave,
+			     cairo_t *cr,
+			     gdouble bpm,
+			     gdouble opacity);
 void ags_wave_edit_draw_wave(AgsWaveEdit *wave_edit, cairo_t *cr);
 
 void ags_wave_edit_draw(AgsWaveEdit *wave_edit, cairo_t *cr);
@@ -47,6 +47,13 @@ ags_wave_edit_update_ui_callback(GObject *ui_provider,
   double width;
   double x;
 
+  /* a peak was rebuilt meanwhile */
+  if((AGS_WAVE_EDIT_PEAK_REFRESH_PENDING & (wave_edit->flags)) != 0){
+    wave_edit->flags &= (~AGS_WAVE_EDIT_PEAK_REFRESH_PENDING);
+
+    gtk_widget_queue_draw((GtkWidget *) wave_edit->drawing_area);
+  }
+  
   if((AGS_WAVE_EDIT_AUTO_SCROLL & (wave_edit->flags)) == 0){
     return;
   }
@@ -772,10 +772,8 @@ ags_track_mapper_apply(AgsApplicable *applicable)
 
   /* apply notation */
   imported_notation = track_mapper->notation;
-  g_list_free_full(machine->audio->notation,
-		   g_object_unref);
-  
-  machine->audio->notation = NULL;
+  ags_audio_set_notation(machine->audio,
+			 NULL);
   
   while(imported_notation != NULL){
     ags_audio_add_notation(machine->audio,
@@ -875,6 +875,10 @@ ags_audiorec_open_filename(AgsAudiorec *audiorec,
 				      filename,
 				      TRUE);
 
+  /* long clips are streamed from disk, the filename is persisted by the machine */
+  ags_wave_loader_set_stream_threshold(wave_loader,
+				       AGS_AUDIOREC_DEFAULT_STREAM_THRESHOLD);
+
   ags_wave_loader_start(wave_loader);
 }
 
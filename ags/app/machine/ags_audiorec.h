@@ -47,6 +47,8 @@ G_BEGIN_DECLS
 #define AGS_AUDIOREC_DEFAULT_SEGMENT_WIDTH (7)
 #define AGS_AUDIOREC_DEFAULT_SEGMENT_HEIGHT (16)
 
+#define AGS_AUDIOREC_DEFAULT_STREAM_THRESHOLD (300 * AGS_SOUNDCARD_DEFAULT_SAMPLERATE)
+
 typedef struct _AgsAudiorec AgsAudiorec;
 typedef struct _AgsAudiorecInputLine AgsAudiorecInputLine;
 typedef struct _AgsAudiorecClass AgsAudiorecClass;
@@ -19,6 +19,9 @@
 
 #include <ags/audio/ags_acceleration.h>
 
+#include <ags/audio/ags_port.h>
+#include <ags/audio/ags_automation.h>
+
 #include <stdlib.h>
 
 #include <ags/i18n.h>
@@ -35,6 +38,8 @@ void ags_acceleration_get_property(GObject *gobject,
 				   GParamSpec *param_spec);
 void ags_acceleration_finalize(GObject *gobject);
 
+void ags_acceleration_increment_automation_revision(AgsAcceleration *acceleration);
+
 /**
  * SECTION:ags_acceleration
  * @short_description: Acceleration class
@@ -194,6 +199,8 @@ ags_acceleration_init(AgsAcceleration *acceleration)
   acceleration->y = 0.0;
 
   acceleration->acceleration_name = NULL;
+
+  acceleration->automation = NULL;
 }
 
 
@@ -220,6 +227,8 @@ ags_acceleration_set_property(GObject *gobject,
       acceleration->x = g_value_get_uint(value);
 
       g_rec_mutex_unlock(acceleration_mutex);
+
+      ags_acceleration_increment_automation_revision(acceleration);
     }
     break;
   case PROP_Y:
@@ -229,6 +238,8 @@ ags_acceleration_set_property(GObject *gobject,
       acceleration->y = g_value_get_double(value);
 
       g_rec_mutex_unlock(acceleration_mutex);
+
+      ags_acceleration_increment_automation_revision(acceleration);
     }
     break;
   case PROP_ACCELERATION_NAME:
@@ -324,6 +335,48 @@ ags_acceleration_finalize(GObject *gobject)
   G_OBJECT_CLASS(ags_acceleration_parent_class)->finalize(gobject);
 }
 
+void
+ags_acceleration_increment_automation_revision(AgsAcceleration *acceleration)
+{
+  GObject *automation;
+  GObject *port;
+
+  GRecMutex *acceleration_mutex;
+  GRecMutex *automation_mutex;
+
+  /* the caller must not hold the acceleration mutex, the automation mutex is taken after it is released */
+  acceleration_mutex = AGS_ACCELERATION_GET_OBJ_MUTEX(acceleration);
+
+  g_rec_mutex_lock(acceleration_mutex);
+
+  automation = acceleration->automation;
+
+  if(automation != NULL){
+    g_object_ref(automation);
+  }
+  
+  g_rec_mutex_unlock(acceleration_mutex);
+
+  if(automation == NULL){
+    return;
+  }
+
+  /* invalidate cursors of the owning automation's port */
+  automation_mutex = AGS_AUTOMATION_GET_OBJ_MUTEX(automation);
+
+  g_rec_mutex_lock(automation_mutex);
+
+  port = AGS_AUTOMATION(automation)->port;
+
+  if(port != NULL){
+    ags_port_increment_automation_revision((AgsPort *) port);
+  }
+  
+  g_rec_mutex_unlock(automation_mutex);
+
+  g_object_unref(automation);
+}
+
 /**
  * ags_acceleration_get_obj_mutex:
  * @acceleration: the #AgsAcceleration
@@ -72,6 +72,8 @@ struct _AgsAcceleration
   gdouble y;
 
   gchar *acceleration_name;
+
+  GObject *automation;
 };
 
 struct _AgsAccelerationClass
@@ -23,6 +23,7 @@
 #include <ags/audio/ags_notation.h>
 #include <ags/audio/ags_automation.h>
 #include <ags/audio/ags_wave.h>
+#include <ags/audio/ags_wave_stream.h>
 #include <ags/audio/ags_midi.h>
 #include <ags/audio/ags_pattern.h>
 #include <ags/audio/ags_synth_generator.h>
@@ -291,6 +292,9 @@ void ags_audio_recursive_set_property_down_input(AgsChannel *channel,
 void ags_audio_real_recursive_run_stage(AgsAudio *audio,
 					gint sound_scope, guint stage);
 
+gboolean ags_audio_automation_timestamp_index_filter(GObject *data,
+						     gpointer filter_data);
+
 enum{
   SET_AUDIO_CHANNELS,
   SET_PADS,
@@ -1882,14 +1886,25 @@ ags_audio_init(AgsAudio *audio)
   /* notation */
   audio->notation = NULL;
 
+  audio->notation_revision = 0;
+  audio->notation_index = ags_timestamp_index_alloc();
+
   /* automation */
   audio->automation_port = NULL;
   
   audio->automation = NULL;
+
+  audio->automation_revision = 0;
+  audio->automation_index = ags_timestamp_index_alloc();
   
   /* wave */
   audio->wave = NULL;
 
+  audio->wave_revision = 0;
+  audio->wave_index = ags_timestamp_index_alloc();
+
+  audio->wave_stream = NULL;
+
   audio->output_audio_file = NULL;
   audio->input_audio_file = NULL;
 
@@ -1910,11 +1925,17 @@ ags_audio_init(AgsAudio *audio)
 
   audio->play = NULL;
 
+  ags_recall_snapshot_slot_init(&(audio->play_snapshot),
+				&(audio->play_mutex));
+
   /* recall context */
   g_rec_mutex_init(&(audio->recall_mutex));
 
   audio->recall = NULL;
 
+  ags_recall_snapshot_slot_init(&(audio->recall_snapshot),
+				&(audio->recall_mutex));
+
   /* data */
   audio->machine_widget = NULL;
 }
@@ -3427,6 +3448,7 @@ ags_audio_dispose(GObject *gobject)
       start_list = audio->notation;
 
     audio->notation = NULL;
+    audio->notation_revision += 1;
 
     while(list != NULL){
       list_next = list->next;
@@ -3446,6 +3468,7 @@ ags_audio_dispose(GObject *gobject)
       start_list = audio->automation;
 
     audio->automation = NULL;
+    audio->automation_revision += 1;
 
     while(list != NULL){
       list_next = list->next;
@@ -3465,6 +3488,26 @@ ags_audio_dispose(GObject *gobject)
       start_list = audio->wave;
 
     audio->wave = NULL;
+    audio->wave_revision += 1;
+
+    while(list != NULL){
+      list_next = list->next;
+      
+      g_object_run_dispose(list->data);
+
+      list = list_next;
+    }
+  
+    g_list_free_full(start_list,
+		     g_object_unref);
+  }
+
+  /* wave stream */
+  if(audio->wave_stream != NULL){
+    list =
+      start_list = audio->wave_stream;
+
+    audio->wave_stream = NULL;
 
     while(list != NULL){
       list_next = list->next;
@@ -3610,6 +3653,9 @@ ags_audio_dispose(GObject *gobject)
 
     audio->play = NULL;
 
+    ags_recall_snapshot_slot_publish(&(audio->play_snapshot),
+				     NULL);
+
     g_rec_mutex_unlock(play_mutex);
 
     while(list != NULL){
@@ -3635,6 +3681,9 @@ ags_audio_dispose(GObject *gobject)
       start_list = audio->recall;
 
     audio->recall = NULL;
+
+    ags_recall_snapshot_slot_publish(&(audio->recall_snapshot),
+				     NULL);
   
     while(list != NULL){
       list_next = list->next;
@@ -3817,6 +3866,7 @@ ags_audio_finalize(GObject *gobject)
       start_list = audio->notation;
 
     audio->notation = NULL;
+    audio->notation_revision += 1;
 
     while(list != NULL){
       list_next = list->next;
@@ -3836,6 +3886,7 @@ ags_audio_finalize(GObject *gobject)
       start_list = audio->automation;
 
     audio->automation = NULL;
+    audio->automation_revision += 1;
 
     while(list != NULL){
       list_next = list->next;
@@ -3855,6 +3906,26 @@ ags_audio_finalize(GObject *gobject)
       start_list = audio->wave;
 
     audio->wave = NULL;
+    audio->wave_revision += 1;
+
+    while(list != NULL){
+      list_next = list->next;
+      
+      g_object_run_dispose(list->data);
+
+      list = list_next;
+    }
+  
+    g_list_free_full(start_list,
+		     g_object_unref);
+  }
+
+  /* wave stream */
+  if(audio->wave_stream != NULL){
+    list =
+      start_list = audio->wave_stream;
+
+    audio->wave_stream = NULL;
 
     while(list != NULL){
       list_next = list->next;
@@ -4000,6 +4071,9 @@ ags_audio_finalize(GObject *gobject)
 
     audio->play = NULL;
 
+    ags_recall_snapshot_slot_publish(&(audio->play_snapshot),
+				     NULL);
+
     g_rec_mutex_unlock(play_mutex);
 
     while(list != NULL){
@@ -4025,6 +4099,9 @@ ags_audio_finalize(GObject *gobject)
       start_list = audio->recall;
 
     audio->recall = NULL;
+
+    ags_recall_snapshot_slot_publish(&(audio->recall_snapshot),
+				     NULL);
   
     while(list != NULL){
       list_next = list->next;
@@ -4039,6 +4116,15 @@ ags_audio_finalize(GObject *gobject)
 
     g_rec_mutex_unlock(recall_mutex);
   }
+
+  /* snapshot */
+  ags_recall_snapshot_slot_clear(&(audio->play_snapshot));
+  ags_recall_snapshot_slot_clear(&(audio->recall_snapshot));
+
+  /* timestamp index */
+  ags_timestamp_index_free(audio->notation_index);
+  ags_timestamp_index_free(audio->automation_index);
+  ags_timestamp_index_free(audio->wave_index);
   
   /* call parent */
   G_OBJECT_CLASS(ags_audio_parent_class)->finalize(gobject);
@@ -6735,6 +6821,7 @@ ags_audio_set_audio_channels_shrink_automation(AgsAudio *audio,
 
   if(audio_channels == 0){
     audio->automation = NULL;
+    audio->automation_revision += 1;
   }
 
   g_rec_mutex_unlock(audio_mutex);
@@ -7706,10 +7793,9 @@ ags_audio_set_pads_remove_notes(AgsAudio *audio,
 
     while(note != NULL){
       if(AGS_NOTE(note->data)->y >= pads){
-	AGS_NOTATION(notation->data)->note = g_list_remove(AGS_NOTATION(notation->data)->note,
-							   note->data);
-	  
-	g_object_unref(note->data);
+	ags_notation_remove_note(notation->data,
+				 note->data,
+				 FALSE);
       }
 
       note = note->next;
@@ -7799,6 +7885,7 @@ ags_audio_set_pads_shrink_wave(AgsAudio *audio,
   g_list_free(list_start);
     
   audio->wave = NULL;
+  audio->wave_revision += 1;
 
   g_rec_mutex_unlock(audio_mutex);
 }
@@ -11073,6 +11160,7 @@ ags_audio_set_notation(AgsAudio *audio, GList *notation)
 
   start_notation = audio->notation;
   audio->notation = notation;
+  audio->notation_revision += 1;
   
   g_rec_mutex_unlock(audio_mutex);
   
@@ -11092,7 +11180,7 @@ ags_audio_set_notation(AgsAudio *audio, GList *notation)
 void
 ags_audio_add_notation(AgsAudio *audio, GObject *notation)
 {
-  GList *matching_notation;
+  GObject *matching_notation;
   
   gboolean success;
   
@@ -11111,8 +11199,9 @@ ags_audio_add_notation(AgsAudio *audio, GObject *notation)
   
   g_rec_mutex_lock(audio_mutex);
 
-  matching_notation = ags_notation_find_near_timestamp(audio->notation, AGS_NOTATION(notation)->audio_channel,
-						       AGS_NOTATION(notation)->timestamp);
+  matching_notation = ags_audio_find_notation_near_timestamp(audio,
+							     AGS_NOTATION(notation)->audio_channel,
+							     AGS_NOTATION(notation)->timestamp);
   
   if(g_list_find(audio->notation,
 		 notation) == NULL &&
@@ -11122,10 +11211,15 @@ ags_audio_add_notation(AgsAudio *audio, GObject *notation)
     g_object_ref(notation);
     audio->notation = ags_notation_add(audio->notation,
 				       (AgsNotation *) notation);
+    audio->notation_revision += 1;
   }
   
   g_rec_mutex_unlock(audio_mutex);
 
+  if(matching_notation != NULL){
+    g_object_unref(matching_notation);
+  }
+
   if(success){
     g_object_set(notation,
 		 "audio", audio,
@@ -11168,6 +11262,7 @@ ags_audio_remove_notation(AgsAudio *audio, GObject *notation)
     
     audio->notation = g_list_remove(audio->notation,
 				    notation);
+    audio->notation_revision += 1;
   }
   
   g_rec_mutex_unlock(audio_mutex);
@@ -11181,6 +11276,64 @@ ags_audio_remove_notation(AgsAudio *audio, GObject *notation)
   }
 }
 
+/**
+ * ags_audio_find_notation_near_timestamp:
+ * @audio: the #AgsAudio
+ * @audio_channel: the matching audio channel
+ * @timestamp: the matching timestamp
+ *
+ * Find the notation of @audio_channel near @timestamp. Does the same as
+ * ags_notation_find_near_timestamp() on the notation of @audio, but does
+ * a binary search of the timestamp index, that is rebuilt only as the
+ * notation list was modified.
+ *
+ * Returns: (transfer full): the matching #AgsNotation or %NULL
+ *
+ * Since: 9.1.0
+ */
+GObject*
+ags_audio_find_notation_near_timestamp(AgsAudio *audio,
+				       guint audio_channel,
+				       AgsTimestamp *timestamp)
+{
+  GObject *notation;
+  
+  GRecMutex *audio_mutex;
+
+  if(!AGS_IS_AUDIO(audio)){
+    return(NULL);
+  }
+
+  /* get audio mutex */
+  audio_mutex = AGS_AUDIO_GET_OBJ_MUTEX(audio);
+
+  /* find */
+  g_rec_mutex_lock(audio_mutex);
+
+  if(!ags_timestamp_index_is_valid(audio->notation_index,
+				   audio->notation_revision)){
+    ags_timestamp_index_rebuild(audio->notation_index,
+				audio->notation,
+				"audio-channel",
+				audio->notation_revision);
+  }
+  
+  notation = ags_timestamp_index_find_near(audio->notation_index,
+					   audio_channel,
+					   timestamp,
+					   (guint64) AGS_NOTATION_DEFAULT_OFFSET,
+					   (guint64) AGS_NOTATION_DEFAULT_DURATION,
+					   NULL, NULL);
+
+  if(notation != NULL){
+    g_object_ref(notation);
+  }
+  
+  g_rec_mutex_unlock(audio_mutex);
+
+  return(notation);
+}
+
 /**
  * ags_audio_get_automation_port:
  * @audio: the #AgsAudio
@@ -11395,6 +11548,7 @@ ags_audio_remove_all_empty_automation(AgsAudio *audio,
   g_rec_mutex_lock(audio_mutex);
 
   audio->automation = ags_automation_remove_all_empty(audio->automation);
+  audio->automation_revision += 1;
 
   g_rec_mutex_unlock(audio_mutex);
 
@@ -11534,6 +11688,7 @@ ags_audio_set_automation(AgsAudio *audio, GList *automation)
 
   start_automation = audio->automation;
   audio->automation = automation;
+  audio->automation_revision += 1;
   
   g_rec_mutex_unlock(audio_mutex);
 
@@ -11557,7 +11712,7 @@ ags_audio_add_automation(AgsAudio *audio, GObject *automation)
 
   GType channel_type, cmp_channel_type;
 
-  GList *list;
+  GObject *matching_automation;
   
   gchar *control_name, *cmp_control_name;
   
@@ -11589,9 +11744,10 @@ ags_audio_add_automation(AgsAudio *audio, GObject *automation)
   
   g_rec_mutex_lock(audio_mutex);
 
-  list = ags_automation_find_near_timestamp_extended(audio->automation, line,
-						     channel_type, control_name,
-						     timestamp);
+  matching_automation = ags_audio_find_automation_near_timestamp_extended(audio,
+									  line,
+									  channel_type, control_name,
+									  timestamp);
 
   cmp_timestamp = NULL;
 
@@ -11599,16 +11755,18 @@ ags_audio_add_automation(AgsAudio *audio, GObject *automation)
   cmp_channel_type = G_TYPE_NONE;
   cmp_control_name = NULL;
   
-  if(list != NULL){
-    cmp_timestamp = ags_automation_get_timestamp((AgsAutomation *) list->data);
+  if(matching_automation != NULL){
+    cmp_timestamp = ags_automation_get_timestamp((AgsAutomation *) matching_automation);
     
-    cmp_line = ags_automation_get_line((AgsAutomation *) list->data);
-    cmp_channel_type = ags_automation_get_channel_type((AgsAutomation *) list->data);
-    cmp_control_name = ags_automation_get_control_name((AgsAutomation *) list->data);
+    cmp_line = ags_automation_get_line((AgsAutomation *) matching_automation);
+    cmp_channel_type = ags_automation_get_channel_type((AgsAutomation *) matching_automation);
+    cmp_control_name = ags_automation_get_control_name((AgsAutomation *) matching_automation);
+
+    g_object_unref(matching_automation);
   }
   
   if(g_list_find(audio->automation, automation) == NULL &&
-     (list == NULL ||
+     (matching_automation == NULL ||
       ags_timestamp_get_ags_offset(timestamp) != ags_timestamp_get_ags_offset(cmp_timestamp) ||
       line != cmp_line ||
       channel_type != cmp_channel_type ||
@@ -11619,6 +11777,7 @@ ags_audio_add_automation(AgsAudio *audio, GObject *automation)
     g_object_ref(automation);
     audio->automation = ags_automation_add(audio->automation,
 					   (AgsAutomation *) automation);
+    audio->automation_revision += 1;
   }
   
   g_rec_mutex_unlock(audio_mutex);
@@ -11764,6 +11923,7 @@ ags_audio_remove_automation(AgsAudio *audio, GObject *automation)
     
     audio->automation = g_list_remove(audio->automation,
 				      automation);
+    audio->automation_revision += 1;
   }
   
   g_rec_mutex_unlock(audio_mutex);
@@ -11777,6 +11937,88 @@ ags_audio_remove_automation(AgsAudio *audio, GObject *automation)
   }
 }
 
+gboolean
+ags_audio_automation_timestamp_index_filter(GObject *data,
+					    gpointer filter_data)
+{
+  gpointer *criteria;
+
+  criteria = (gpointer *) filter_data;
+
+  if(!g_strcmp0(criteria[1], AGS_AUTOMATION(data)->control_name) &&
+     ags_automation_get_channel_type((AgsAutomation *) data) == (GType) GPOINTER_TO_SIZE(criteria[0])){
+    return(TRUE);
+  }
+
+  return(FALSE);
+}
+
+/**
+ * ags_audio_find_automation_near_timestamp_extended:
+ * @audio: the #AgsAudio
+ * @line: the matching line
+ * @channel_type: the matching channel type
+ * @control_name: the matching control name
+ * @timestamp: the matching timestamp
+ *
+ * Find the automation of @line, @channel_type and @control_name near
+ * @timestamp. Does the same as ags_automation_find_near_timestamp_extended()
+ * on the automation of @audio, but does a binary search of the timestamp
+ * index, that is rebuilt only as the automation list was modified.
+ *
+ * Returns: (transfer full): the matching #AgsAutomation or %NULL
+ *
+ * Since: 9.1.0
+ */
+GObject*
+ags_audio_find_automation_near_timestamp_extended(AgsAudio *audio,
+						  guint line,
+						  GType channel_type, gchar *control_name,
+						  AgsTimestamp *timestamp)
+{
+  GObject *automation;
+
+  gpointer criteria[2];
+  
+  GRecMutex *audio_mutex;
+
+  if(!AGS_IS_AUDIO(audio)){
+    return(NULL);
+  }
+
+  /* get audio mutex */
+  audio_mutex = AGS_AUDIO_GET_OBJ_MUTEX(audio);
+
+  criteria[0] = GSIZE_TO_POINTER(channel_type);
+  criteria[1] = control_name;
+  
+  /* find */
+  g_rec_mutex_lock(audio_mutex);
+
+  if(!ags_timestamp_index_is_valid(audio->automation_index,
+				   audio->automation_revision)){
+    ags_timestamp_index_rebuild(audio->automation_index,
+				audio->automation,
+				"line",
+				audio->automation_revision);
+  }
+  
+  automation = ags_timestamp_index_find_near(audio->automation_index,
+					     line,
+					     timestamp,
+					     (guint64) AGS_AUTOMATION_DEFAULT_OFFSET,
+					     (guint64) AGS_AUTOMATION_DEFAULT_DURATION,
+					     ags_audio_automation_timestamp_index_filter, criteria);
+
+  if(automation != NULL){
+    g_object_ref(automation);
+  }
+  
+  g_rec_mutex_unlock(audio_mutex);
+
+  return(automation);
+}
+
 /**
  * ags_audio_get_wave:
  * @audio: the #AgsAudio
@@ -11830,6 +12072,7 @@ ags_audio_set_wave(AgsAudio *audio, GList *wave)
 
   start_wave = audio->wave;
   audio->wave = wave;
+  audio->wave_revision += 1;
   
   g_rec_mutex_unlock(audio_mutex);
 
@@ -11849,7 +12092,7 @@ ags_audio_set_wave(AgsAudio *audio, GList *wave)
 void
 ags_audio_add_wave(AgsAudio *audio, GObject *wave)
 {
-  GList *matching_wave;
+  GObject *matching_wave;
   
   gboolean success;
   
@@ -11868,8 +12111,9 @@ ags_audio_add_wave(AgsAudio *audio, GObject *wave)
   
   g_rec_mutex_lock(audio_mutex);
   
-  matching_wave = ags_wave_find_near_timestamp(audio->wave, AGS_WAVE(wave)->line,
-					       AGS_WAVE(wave)->timestamp);
+  matching_wave = ags_audio_find_wave_near_timestamp(audio,
+						     AGS_WAVE(wave)->line,
+						     AGS_WAVE(wave)->timestamp);
 
   if(g_list_find(audio->wave,
 		 wave) == NULL &&
@@ -11879,10 +12123,15 @@ ags_audio_add_wave(AgsAudio *audio, GObject *wave)
     g_object_ref(wave);
     audio->wave = ags_wave_add(audio->wave,
 			       (AgsWave *) wave);
+    audio->wave_revision += 1;
   }
   
   g_rec_mutex_unlock(audio_mutex);
 
+  if(matching_wave != NULL){
+    g_object_unref(matching_wave);
+  }
+
   if(success){
     g_object_set(wave,
 		 "audio", audio,
@@ -11925,6 +12174,7 @@ ags_audio_remove_wave(AgsAudio *audio, GObject *wave)
     
     audio->wave = g_list_remove(audio->wave,
 				wave);
+    audio->wave_revision += 1;
   }
   
   g_rec_mutex_unlock(audio_mutex);
@@ -11938,6 +12188,178 @@ ags_audio_remove_wave(AgsAudio *audio, GObject *wave)
   }
 }
 
+/**
+ * ags_audio_find_wave_near_timestamp:
+ * @audio: the #AgsAudio
+ * @line: the matching line
+ * @timestamp: the matching timestamp
+ *
+ * Find the wave of @line near @timestamp. Does the same as
+ * ags_wave_find_near_timestamp() on the wave of @audio, but does a binary
+ * search of the timestamp index, that is rebuilt only as the wave list was
+ * modified.
+ *
+ * Returns: (transfer full): the matching #AgsWave or %NULL
+ *
+ * Since: 9.1.0
+ */
+GObject*
+ags_audio_find_wave_near_timestamp(AgsAudio *audio,
+				   guint line,
+				   AgsTimestamp *timestamp)
+{
+  GObject *wave;
+  
+  GRecMutex *audio_mutex;
+
+  if(!AGS_IS_AUDIO(audio)){
+    return(NULL);
+  }
+
+  /* get audio mutex */
+  audio_mutex = AGS_AUDIO_GET_OBJ_MUTEX(audio);
+
+  /* find */
+  g_rec_mutex_lock(audio_mutex);
+
+  if(!ags_timestamp_index_is_valid(audio->wave_index,
+				   audio->wave_revision)){
+    ags_timestamp_index_rebuild(audio->wave_index,
+				audio->wave,
+				"line",
+				audio->wave_revision);
+  }
+  
+  wave = ags_timestamp_index_find_near(audio->wave_index,
+				       line,
+				       timestamp,
+				       (guint64) AGS_WAVE_DEFAULT_OFFSET,
+				       (guint64) AGS_WAVE_DEFAULT_DURATION,
+				       NULL, NULL);
+
+  if(wave != NULL){
+    g_object_ref(wave);
+  }
+  
+  g_rec_mutex_unlock(audio_mutex);
+
+  return(wave);
+}
+
+/**
+ * ags_audio_get_wave_stream:
+ * @audio: the #AgsAudio
+ * 
+ * Get wave stream.
+ * 
+ * Returns: (element-type AgsAudio.WaveStream) (transfer full): the #GList-struct containing #AgsWaveStream
+ * 
+ * Since: 9.1.0
+ */
+GList*
+ags_audio_get_wave_stream(AgsAudio *audio)
+{
+  GList *wave_stream;
+
+  GRecMutex *audio_mutex;
+
+  if(!AGS_IS_AUDIO(audio)){
+    return(NULL);
+  }
+
+  /* get audio mutex */
+  audio_mutex = AGS_AUDIO_GET_OBJ_MUTEX(audio);
+
+  g_rec_mutex_lock(audio_mutex);
+
+  wave_stream = g_list_copy_deep(audio->wave_stream,
+				 (GCopyFunc) g_object_ref,
+				 NULL);
+  
+  g_rec_mutex_unlock(audio_mutex);
+
+  return(wave_stream);
+}
+
+/**
+ * ags_audio_add_wave_stream:
+ * @audio: the #AgsAudio
+ * @wave_stream: the #AgsWaveStream
+ *
+ * Adds a wave stream.
+ *
+ * Since: 9.1.0
+ */
+void
+ags_audio_add_wave_stream(AgsAudio *audio, GObject *wave_stream)
+{
+  GRecMutex *audio_mutex;
+
+  if(!AGS_IS_AUDIO(audio) ||
+     !AGS_IS_WAVE_STREAM(wave_stream)){
+    return;
+  }
+
+  /* get audio mutex */
+  audio_mutex = AGS_AUDIO_GET_OBJ_MUTEX(audio);
+
+  /* add wave stream */
+  g_rec_mutex_lock(audio_mutex);
+
+  if(g_list_find(audio->wave_stream,
+		 wave_stream) == NULL){
+    g_object_ref(wave_stream);
+    audio->wave_stream = g_list_prepend(audio->wave_stream,
+					wave_stream);
+  }
+  
+  g_rec_mutex_unlock(audio_mutex);
+}
+
+/**
+ * ags_audio_remove_wave_stream:
+ * @audio: the #AgsAudio
+ * @wave_stream: the #AgsWaveStream
+ *
+ * Removes a wave stream.
+ *
+ * Since: 9.1.0
+ */
+void
+ags_audio_remove_wave_stream(AgsAudio *audio, GObject *wave_stream)
+{
+  gboolean success;
+  
+  GRecMutex *audio_mutex;
+
+  if(!AGS_IS_AUDIO(audio) ||
+     !AGS_IS_WAVE_STREAM(wave_stream)){
+    return;
+  }
+
+  /* get audio mutex */
+  audio_mutex = AGS_AUDIO_GET_OBJ_MUTEX(audio);
+
+  /* remove wave stream */
+  success = FALSE;
+  
+  g_rec_mutex_lock(audio_mutex);
+
+  if(g_list_find(audio->wave_stream,
+		 wave_stream) != NULL){
+    success = TRUE;
+    
+    audio->wave_stream = g_list_remove(audio->wave_stream,
+				       wave_stream);
+  }
+  
+  g_rec_mutex_unlock(audio_mutex);
+
+  if(success){
+    g_object_unref(wave_stream);
+  }
+}
+
 /**
  * ags_audio_get_output_audio_file:
  * @audio: the #AgsAudio
@@ -12805,21 +13227,24 @@ ags_audio_set_play(AgsAudio *audio, GList *play)
 {
   GList *start_play;
   
-  GRecMutex *audio_mutex;
+  GRecMutex *play_mutex;
 
   if(!AGS_IS_AUDIO(audio)){
     return;
   }
 
-  /* get audio mutex */
-  audio_mutex = AGS_AUDIO_GET_OBJ_MUTEX(audio);
+  /* get play mutex */
+  play_mutex = AGS_AUDIO_GET_PLAY_MUTEX(audio);
     
-  g_rec_mutex_lock(audio_mutex);
+  g_rec_mutex_lock(play_mutex);
 
   start_play = audio->play;
   audio->play = play;
+
+  ags_recall_snapshot_slot_publish(&(audio->play_snapshot),
+				   play);
   
-  g_rec_mutex_unlock(audio_mutex);
+  g_rec_mutex_unlock(play_mutex);
 
   g_list_free_full(start_play,
 		   (GDestroyNotify) g_object_unref);
@@ -12865,21 +13290,24 @@ ags_audio_set_recall(AgsAudio *audio, GList *recall)
 {
   GList *start_recall;
   
-  GRecMutex *audio_mutex;
+  GRecMutex *recall_mutex;
 
   if(!AGS_IS_AUDIO(audio)){
     return;
   }
 
-  /* get audio mutex */
-  audio_mutex = AGS_AUDIO_GET_OBJ_MUTEX(audio);
+  /* get recall mutex */
+  recall_mutex = AGS_AUDIO_GET_RECALL_MUTEX(audio);
     
-  g_rec_mutex_lock(audio_mutex);
+  g_rec_mutex_lock(recall_mutex);
 
   start_recall = audio->recall;
   audio->recall = recall;
+
+  ags_recall_snapshot_slot_publish(&(audio->recall_snapshot),
+				   recall);
   
-  g_rec_mutex_unlock(audio_mutex);
+  g_rec_mutex_unlock(recall_mutex);
 
   g_list_free_full(start_recall,
 		   (GDestroyNotify) g_object_unref);
@@ -12924,6 +13352,9 @@ ags_audio_add_recall(AgsAudio *audio, GObject *recall,
     
       audio->play = g_list_prepend(audio->play,
 				   recall);
+
+      ags_recall_snapshot_slot_publish(&(audio->play_snapshot),
+				       audio->play);
     }
 
     g_rec_mutex_unlock(play_mutex);
@@ -12943,6 +13374,9 @@ ags_audio_add_recall(AgsAudio *audio, GObject *recall,
     
       audio->recall = g_list_prepend(audio->recall,
 				     recall);
+
+      ags_recall_snapshot_slot_publish(&(audio->recall_snapshot),
+				       audio->recall);
     }
 
     g_rec_mutex_unlock(recall_mutex);
@@ -13000,6 +13434,9 @@ ags_audio_insert_recall(AgsAudio *audio, GObject *recall,
       audio->play = g_list_insert(audio->play,
 				  recall,
 				  position);
+
+      ags_recall_snapshot_slot_publish(&(audio->play_snapshot),
+				       audio->play);
     }
 
     g_rec_mutex_unlock(play_mutex);
@@ -13020,6 +13457,9 @@ ags_audio_insert_recall(AgsAudio *audio, GObject *recall,
       audio->recall = g_list_insert(audio->recall,
 				    recall,
 				    position);
+
+      ags_recall_snapshot_slot_publish(&(audio->recall_snapshot),
+				       audio->recall);
     }
 
     g_rec_mutex_unlock(recall_mutex);
@@ -13070,6 +13510,9 @@ ags_audio_remove_recall(AgsAudio *audio, GObject *recall,
     if(g_list_find(audio->play, recall) != NULL){
       audio->play = g_list_remove(audio->play,
 				  recall);
+
+      ags_recall_snapshot_slot_publish(&(audio->play_snapshot),
+				       audio->play);
     }
 
     g_rec_mutex_unlock(play_mutex);
@@ -13085,6 +13528,9 @@ ags_audio_remove_recall(AgsAudio *audio, GObject *recall,
     if(g_list_find(audio->recall, recall) != NULL){
       audio->recall = g_list_remove(audio->recall,
 				    recall);
+
+      ags_recall_snapshot_slot_publish(&(audio->recall_snapshot),
+				       audio->recall);
     }
 
     g_rec_mutex_unlock(recall_mutex);
@@ -13703,10 +14149,12 @@ ags_audio_real_play_recall(AgsAudio *audio,
 {
   AgsRecall *recall;
   AgsRecyclingContext *parent_recycling_context, *recycling_context;
-
-  GList *list_start, *list;
+  AgsRecallSnapshot *snapshot;
+  AgsRecallSnapshotSlot *snapshot_slot;
 
   guint sound_scope;
+  guint i;
+  gint position;
   AgsSoundStagingFlags current_staging_flags;
   static const AgsSoundStagingFlags staging_mask = (AGS_SOUND_STAGING_RUN_INIT_PRE |
 						    AGS_SOUND_STAGING_RUN_INIT_INTER |
@@ -13745,13 +14193,10 @@ ags_audio_real_play_recall(AgsAudio *audio,
 
   sound_scope = recall_id->sound_scope;
 
-  g_rec_mutex_unlock(recall_id_mutex);
-
-  recycling_context = NULL;
+  /* the recall id holds the reference while playing */
+  recycling_context = recall_id->recycling_context;
 
-  g_object_get(recall_id,
-	       "recycling-context", &recycling_context,
-	       NULL);
+  g_rec_mutex_unlock(recall_id_mutex);
 
   /* get audio mutex */
   audio_mutex = AGS_AUDIO_GET_OBJ_MUTEX(audio);
@@ -13772,64 +14217,51 @@ ags_audio_real_play_recall(AgsAudio *audio,
   }
 #endif
   
-  /* get recycling context mutex */
-  recycling_context_mutex = AGS_RECYCLING_CONTEXT_GET_OBJ_MUTEX(recycling_context);
-
   /* get parent recycling context */
   parent_recycling_context = NULL;
-  
-  g_object_get(recycling_context,
-	       "parent", &parent_recycling_context,
-	       NULL);
-
-  /* get the appropriate lists */
-  if(parent_recycling_context == NULL){
-    GRecMutex *play_mutex;
 
-    /* get play mutex */
-    play_mutex = AGS_AUDIO_GET_PLAY_MUTEX(audio);
+  if(recycling_context != NULL){
+    /* get recycling context mutex */
+    recycling_context_mutex = AGS_RECYCLING_CONTEXT_GET_OBJ_MUTEX(recycling_context);
 
-    /* copy play context */
-    g_rec_mutex_lock(play_mutex);
+    g_rec_mutex_lock(recycling_context_mutex);
 
-    list_start = g_list_copy_deep(audio->play,
-				  (GCopyFunc) g_object_ref,
-				  NULL);
-
-    g_rec_mutex_unlock(play_mutex);
+    parent_recycling_context = recycling_context->parent;
+    
+    g_rec_mutex_unlock(recycling_context_mutex);
+  }
 
-    /* reverse play context */
-    list =
-      list_start = g_list_reverse(list_start);
+  /* get the appropriate snapshot */
+  if(parent_recycling_context == NULL){
+    snapshot_slot = &(audio->play_snapshot);
   }else{
-    GRecMutex *recall_mutex;
+    snapshot_slot = &(audio->recall_snapshot);
+  }
 
-    /* get recall mutex */
-    recall_mutex = AGS_AUDIO_GET_RECALL_MUTEX(audio);
+  snapshot = ags_recall_snapshot_slot_acquire(snapshot_slot);
 
-    /* copy recall context */
-    g_rec_mutex_lock(recall_mutex);
-
-    list_start = g_list_copy_deep(audio->recall,
-				  (GCopyFunc) g_object_ref,
-				  NULL);
-    
-    g_rec_mutex_unlock(recall_mutex);
+  if(snapshot == NULL){
+    ags_recall_snapshot_slot_release(snapshot_slot,
+				     snapshot);
 
-    /* reverse recall context */
-    list =
-      list_start = g_list_reverse(list_start);
+    return;
   }
 
   /* automate, midi 1 and 2 control change */
   staging_flags = staging_flags & staging_mask;
-  
-  while(list != NULL){
-    recall = AGS_RECALL(list->data);
+
+  if((AGS_SOUND_STAGING_AUTOMATE & (staging_flags)) != 0 ||
+     (AGS_SOUND_STAGING_MIDI1_CONTROL_CHANGE & (staging_flags)) != 0 ||
+     (AGS_SOUND_STAGING_MIDI2_CONTROL_CHANGE & (staging_flags)) != 0){
+    for(i = 0; i < snapshot->length; i++){
+      recall = snapshot->recall[i];
+
+      if(!AGS_IS_RECALL_AUDIO(recall)){
+	continue;
+      }
       
-    /* play stages */
-    if((AGS_SOUND_STAGING_AUTOMATE & (staging_flags)) != 0){
-      if(AGS_IS_RECALL_AUDIO(recall)){
+      /* play stages */
+      if((AGS_SOUND_STAGING_AUTOMATE & (staging_flags)) != 0){
 	ags_recall_set_staging_flags(recall,
 				     AGS_SOUND_STAGING_AUTOMATE);
 	
@@ -13837,10 +14269,8 @@ ags_audio_real_play_recall(AgsAudio *audio,
 	ags_recall_unset_staging_flags(recall,
 				       AGS_SOUND_STAGING_AUTOMATE);
       }
-    }
 
-    if((AGS_SOUND_STAGING_MIDI1_CONTROL_CHANGE & (staging_flags)) != 0){
-      if(AGS_IS_RECALL_AUDIO(recall)){
+      if((AGS_SOUND_STAGING_MIDI1_CONTROL_CHANGE & (staging_flags)) != 0){
 	ags_recall_set_staging_flags(recall,
 				     AGS_SOUND_STAGING_MIDI1_CONTROL_CHANGE);
 	
@@ -13848,10 +14278,8 @@ ags_audio_real_play_recall(AgsAudio *audio,
 	ags_recall_unset_staging_flags(recall,
 				       AGS_SOUND_STAGING_MIDI1_CONTROL_CHANGE);
       }
-    }
 
-    if((AGS_SOUND_STAGING_MIDI2_CONTROL_CHANGE & (staging_flags)) != 0){
-      if(AGS_IS_RECALL_AUDIO(recall)){
+      if((AGS_SOUND_STAGING_MIDI2_CONTROL_CHANGE & (staging_flags)) != 0){
 	ags_recall_set_staging_flags(recall,
 				     AGS_SOUND_STAGING_MIDI2_CONTROL_CHANGE);
 	
@@ -13860,8 +14288,6 @@ ags_audio_real_play_recall(AgsAudio *audio,
 				       AGS_SOUND_STAGING_MIDI2_CONTROL_CHANGE);
       }
     }
-      
-    list = list->next;
   }
 
   staging_flags = staging_flags & (~AGS_SOUND_STAGING_AUTOMATE);
@@ -13869,29 +14295,21 @@ ags_audio_real_play_recall(AgsAudio *audio,
   staging_flags = staging_flags & (~AGS_SOUND_STAGING_MIDI2_CONTROL_CHANGE);
   
   /* play */
-  list = list_start;
+  position = 0;
 
-  while((list = ags_recall_find_recycling_context(list,
-						  (GObject *) recycling_context)) != NULL){
-    recall = AGS_RECALL(list->data);
+  while((position = ags_recall_snapshot_find_recycling_context(snapshot, (guint) position,
+							       (GObject *) recycling_context)) != -1){
+    recall = snapshot->recall[position];
     
     /* play stages */
     ags_recall_set_staging_flags(recall,
 				 staging_flags);
 
-    list = list->next;
+    position++;
   }
   
-  g_list_free_full(list_start,
-		   g_object_unref);
-
-  if(parent_recycling_context != NULL){
-    g_object_unref(parent_recycling_context);
-  }
-  
-  if(recycling_context != NULL){
-    g_object_unref(recycling_context);
-  }
+  ags_recall_snapshot_slot_release(snapshot_slot,
+				   snapshot);
 
   //NOTE:JK: won't uncomment because of parallelism per audio channel and scope
   //  ags_audio_set_staging_flags(audio, sound_scope,
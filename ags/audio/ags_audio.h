@@ -28,6 +28,8 @@
 #include <ags/audio/ags_sound_enums.h>
 #include <ags/audio/ags_channel.h>
 #include <ags/audio/ags_recall_id.h>
+#include <ags/audio/ags_recall_snapshot.h>
+#include <ags/audio/ags_timestamp_index.h>
 
 G_BEGIN_DECLS
 
@@ -171,11 +173,18 @@ struct _AgsAudio
   GList *cursor;
   
   GList *notation;
+  guint notation_revision;
+  AgsTimestampIndex *notation_index;
 
   gchar **automation_port;
   GList *automation;
+  guint automation_revision;
+  AgsTimestampIndex *automation_index;
   
   GList *wave;
+  guint wave_revision;
+  AgsTimestampIndex *wave_index;
+  GList *wave_stream;
   GObject *output_audio_file;
   GObject *input_audio_file;  
 
@@ -194,10 +203,12 @@ struct _AgsAudio
   GRecMutex play_mutex;
 
   GList *play;
+  AgsRecallSnapshotSlot play_snapshot;
 
   GRecMutex recall_mutex;
 
   GList *recall;
+  AgsRecallSnapshotSlot recall_snapshot;
   
   gpointer machine_widget;
   gpointer file_data;
@@ -436,6 +447,10 @@ void ags_audio_set_notation(AgsAudio *audio, GList *notation);
 void ags_audio_add_notation(AgsAudio *audio, GObject *notation);
 void ags_audio_remove_notation(AgsAudio *audio, GObject *notation);
 
+GObject* ags_audio_find_notation_near_timestamp(AgsAudio *audio,
+						guint audio_channel,
+						AgsTimestamp *timestamp);
+
 gchar** ags_audio_get_automation_port(AgsAudio *audio);
 void ags_audio_set_automation_port(AgsAudio *audio,
 				   gchar **automation_port);
@@ -453,12 +468,26 @@ void ags_audio_set_automation(AgsAudio *audio, GList *automation);
 void ags_audio_add_automation(AgsAudio *audio, GObject *automation);
 void ags_audio_remove_automation(AgsAudio *audio, GObject *automation);
 
+GObject* ags_audio_find_automation_near_timestamp_extended(AgsAudio *audio,
+							   guint line,
+							   GType channel_type, gchar *control_name,
+							   AgsTimestamp *timestamp);
+
 GList* ags_audio_get_wave(AgsAudio *audio);
 void ags_audio_set_wave(AgsAudio *audio, GList *wave);
 
 void ags_audio_add_wave(AgsAudio *audio, GObject *wave);
 void ags_audio_remove_wave(AgsAudio *audio, GObject *wave);
 
+GObject* ags_audio_find_wave_near_timestamp(AgsAudio *audio,
+					    guint line,
+					    AgsTimestamp *timestamp);
+
+GList* ags_audio_get_wave_stream(AgsAudio *audio);
+
+void ags_audio_add_wave_stream(AgsAudio *audio, GObject *wave_stream);
+void ags_audio_remove_wave_stream(AgsAudio *audio, GObject *wave_stream);
+
 GObject* ags_audio_get_output_audio_file(AgsAudio *audio);
 void ags_audio_set_output_audio_file(AgsAudio *audio,
 				     GObject *output_audio_file);
@@ -35,6 +35,8 @@
 #include <ags/audio/ags_sound_provider.h>
 #include <ags/audio/ags_generic_recall_channel_run.h>
 
+#include <ags/audio/ags_offline_devout.h>
+
 #include <ags/audio/alsa/ags_alsa_devout.h>
 #include <ags/audio/alsa/ags_alsa_devin.h>
 #include <ags/audio/alsa/ags_alsa_midiin.h>
@@ -1797,6 +1799,8 @@ ags_audio_application_context_set_tempo(AgsSoundProvider *sound_provider,
   AGS_AUDIO_APPLICATION_CONTEXT(application_context)->tempo = tempo;
 
   g_rec_mutex_unlock(application_context_mutex);
+
+  ags_program_global_increment_modified_stamp();
 }
 
 void
@@ -1946,6 +1950,7 @@ ags_audio_application_context_setup(AgsApplicationContext *application_context)
   AgsThread *export_thread;
   AgsThread *sequencer_thread;
   AgsDestroyWorker *destroy_worker;
+  AgsEpochReclaimer *epoch_reclaimer;
   AgsTaskLauncher *task_launcher;
 
   AgsLog *log;
@@ -2305,11 +2310,39 @@ ags_audio_application_context_setup(AgsApplicationContext *application_context)
       }else if(!g_ascii_strncasecmp(backend,
 				    "alsa",
 				    5)){
+	str = ags_config_get_value(config,
+				   soundcard_group,
+				   "alsa-access-mode");
+
 	if(is_output){
 	  soundcard = (GObject *) ags_alsa_devout_new();
+
+	  if(str != NULL &&
+	     !g_ascii_strncasecmp(str,
+				  "mmap",
+				  5)){
+	    ags_alsa_devout_set_flags(AGS_ALSA_DEVOUT(soundcard),
+				      AGS_ALSA_DEVOUT_MMAP);
+	  }else{
+	    ags_alsa_devout_unset_flags(AGS_ALSA_DEVOUT(soundcard),
+					AGS_ALSA_DEVOUT_MMAP);
+	  }
 	}else{
 	  soundcard = (GObject *) ags_alsa_devin_new();
+
+	  if(str != NULL &&
+	     !g_ascii_strncasecmp(str,
+				  "mmap",
+				  5)){
+	    ags_alsa_devin_set_flags(AGS_ALSA_DEVIN(soundcard),
+				     AGS_ALSA_DEVIN_MMAP);
+	  }else{
+	    ags_alsa_devin_unset_flags(AGS_ALSA_DEVIN(soundcard),
+				       AGS_ALSA_DEVIN_MMAP);
+	  }
 	}
+
+	g_free(str);
       }else if(!g_ascii_strncasecmp(backend,
 				    "wasapi",
 				    7)){
@@ -2386,6 +2419,22 @@ ags_audio_application_context_setup(AgsApplicationContext *application_context)
 	}else{
 	  soundcard = (GObject *) ags_oss_devin_new();
 	}
+      }else if(!g_ascii_strncasecmp(backend,
+				    "offline",
+				    8)){
+	if(!is_output){
+	  g_warning(i18n("offline soundcard backend doesn't support capture"));
+
+	  g_free(backend);
+	  g_free(soundcard_group);    
+	  soundcard_group = g_strdup_printf("%s-%d",
+					    AGS_CONFIG_SOUNDCARD,
+					    i);
+    
+	  continue;
+	}
+	
+	soundcard = (GObject *) ags_offline_devout_new();
       }else{
 	g_warning(i18n("unknown soundcard backend - %s"), backend);
 
@@ -2839,7 +2888,8 @@ ags_audio_application_context_setup(AgsApplicationContext *application_context)
        AGS_IS_WASAPI_DEVOUT(list->data) ||
        AGS_IS_JACK_DEVOUT(list->data) ||
        AGS_IS_PULSE_DEVOUT(list->data) ||
-       AGS_IS_CORE_AUDIO_DEVOUT(list->data)){
+       AGS_IS_CORE_AUDIO_DEVOUT(list->data) ||
+       AGS_IS_OFFLINE_DEVOUT(list->data)){
       export_thread = (AgsThread *) ags_export_thread_new(list->data,
 							  NULL);
       ags_thread_add_child_extended(main_loop,
@@ -3059,6 +3109,15 @@ ags_audio_application_context_setup(AgsApplicationContext *application_context)
   audio_application_context->worker = g_list_prepend(audio_application_context->worker,
 						     destroy_worker);
   ags_thread_start((AgsThread *) destroy_worker);
+
+  /* AgsEpochReclaimer */
+  epoch_reclaimer = ags_epoch_reclaimer_get_instance();
+  ags_thread_add_child_extended(main_loop,
+				(AgsThread *) epoch_reclaimer,
+				TRUE, TRUE);
+  audio_application_context->worker = g_list_prepend(audio_application_context->worker,
+						     epoch_reclaimer);
+  ags_thread_start((AgsThread *) epoch_reclaimer);
   
   /* AgsThreadPool */
   audio_application_context->thread_pool = NULL;
@@ -0,0 +1,701 @@
+/* GSequencer - Advanced GTK Sequencer
+ * Copyright (C) 2005-2026 Joël Krähemann
+ *
+ * This file is part of GSequencer.
+ *
+ * GSequencer is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GSequencer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GSequencer.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <ags/audio/ags_audio_buffer_kernel.h>
+
+#include <string.h>
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define AGS_AUDIO_BUFFER_KERNEL_X86 1
+#include <immintrin.h>
+#endif
+
+#if defined(__aarch64__) && defined(__ARM_NEON)
+#define AGS_AUDIO_BUFFER_KERNEL_AARCH64 1
+#include <arm_neon.h>
+#endif
+
+void ags_audio_buffer_kernel_scalar_clear_float(gfloat *destination, guint count);
+void ags_audio_buffer_kernel_scalar_clear_double(gdouble *destination, guint count);
+void ags_audio_buffer_kernel_scalar_copy_float_to_float(gfloat *destination, gfloat *source, guint count);
+void ags_audio_buffer_kernel_scalar_copy_float_to_double(gdouble *destination, gfloat *source, guint count);
+void ags_audio_buffer_kernel_scalar_copy_double_to_float(gfloat *destination, gdouble *source, guint count);
+void ags_audio_buffer_kernel_scalar_copy_double_to_double(gdouble *destination, gdouble *source, guint count);
+
+#if defined(AGS_AUDIO_BUFFER_KERNEL_X86)
+void ags_audio_buffer_kernel_sse2_clear_float(gfloat *destination, guint count);
+void ags_audio_buffer_kernel_sse2_clear_double(gdouble *destination, guint count);
+void ags_audio_buffer_kernel_sse2_copy_float_to_float(gfloat *destination, gfloat *source, guint count);
+void ags_audio_buffer_kernel_sse2_copy_float_to_double(gdouble *destination, gfloat *source, guint count);
+void ags_audio_buffer_kernel_sse2_copy_double_to_float(gfloat *destination, gdouble *source, guint count);
+void ags_audio_buffer_kernel_sse2_copy_double_to_double(gdouble *destination, gdouble *source, guint count);
+
+void ags_audio_buffer_kernel_avx2_clear_float(gfloat *destination, guint count);
+void ags_audio_buffer_kernel_avx2_clear_double(gdouble *destination, guint count);
+void ags_audio_buffer_kernel_avx2_copy_float_to_float(gfloat *destination, gfloat *source, guint count);
+void ags_audio_buffer_kernel_avx2_copy_float_to_double(gdouble *destination, gfloat *source, guint count);
+void ags_audio_buffer_kernel_avx2_copy_double_to_float(gfloat *destination, gdouble *source, guint count);
+void ags_audio_buffer_kernel_avx2_copy_double_to_double(gdouble *destination, gdouble *source, guint count);
+
+void ags_audio_buffer_kernel_avx512_clear_float(gfloat *destination, guint count);
+void ags_audio_buffer_kernel_avx512_clear_double(gdouble *destination, guint count);
+void ags_audio_buffer_kernel_avx512_copy_float_to_float(gfloat *destination, gfloat *source, guint count);
+void ags_audio_buffer_kernel_avx512_copy_float_to_double(gdouble *destination, gfloat *source, guint count);
+void ags_audio_buffer_kernel_avx512_copy_double_to_float(gfloat *destination, gdouble *source, guint count);
+void ags_audio_buffer_kernel_avx512_copy_double_to_double(gdouble *destination, gdouble *source, guint count);
+#endif
+
+#if defined(AGS_AUDIO_BUFFER_KERNEL_AARCH64)
+void ags_audio_buffer_kernel_neon_clear_float(gfloat *destination, guint count);
+void ags_audio_buffer_kernel_neon_clear_double(gdouble *destination, guint count);
+void ags_audio_buffer_kernel_neon_copy_float_to_float(gfloat *destination, gfloat *source, guint count);
+void ags_audio_buffer_kernel_neon_copy_float_to_double(gdouble *destination, gfloat *source, guint count);
+void ags_audio_buffer_kernel_neon_copy_double_to_float(gfloat *destination, gdouble *source, guint count);
+void ags_audio_buffer_kernel_neon_copy_double_to_double(gdouble *destination, gdouble *source, guint count);
+#endif
+
+/**
+ * SECTION:ags_audio_buffer_kernel
+ * @short_description: CPU dispatched audio buffer kernels
+ * @title: AgsAudioBufferKernel
+ * @section_id:
+ * @include: ags/audio/ags_audio_buffer_kernel.h
+ *
+ * The #AgsAudioBufferKernel-struct provides SIMD implementations of the hot
+ * #AgsAudioBufferUtil routines operating on contiguous float and double
+ * buffers. The instruction set is chosen once by
+ * ags_audio_buffer_kernel_get_default() querying the CPU at runtime, so
+ * the library itself is still built for the baseline instruction set.
+ */
+
+static AgsAudioBufferKernel ags_audio_buffer_kernel[AGS_AUDIO_BUFFER_KERNEL_ISA_COUNT] = {
+  {
+    AGS_AUDIO_BUFFER_KERNEL_SCALAR,
+    "scalar",
+    ags_audio_buffer_kernel_scalar_clear_float,
+    ags_audio_buffer_kernel_scalar_clear_double,
+    ags_audio_buffer_kernel_scalar_copy_float_to_float,
+    ags_audio_buffer_kernel_scalar_copy_float_to_double,
+    ags_audio_buffer_kernel_scalar_copy_double_to_float,
+    ags_audio_buffer_kernel_scalar_copy_double_to_double,
+  },
+#if defined(AGS_AUDIO_BUFFER_KERNEL_X86)
+  {
+    AGS_AUDIO_BUFFER_KERNEL_SSE2,
+    "sse2",
+    ags_audio_buffer_kernel_sse2_clear_float,
+    ags_audio_buffer_kernel_sse2_clear_double,
+    ags_audio_buffer_kernel_sse2_copy_float_to_float,
+    ags_audio_buffer_kernel_sse2_copy_float_to_double,
+    ags_audio_buffer_kernel_sse2_copy_double_to_float,
+    ags_audio_buffer_kernel_sse2_copy_double_to_double,
+  },
+  {
+    AGS_AUDIO_BUFFER_KERNEL_AVX2,
+    "avx2",
+    ags_audio_buffer_kernel_avx2_clear_float,
+    ags_audio_buffer_kernel_avx2_clear_double,
+    ags_audio_buffer_kernel_avx2_copy_float_to_float,
+    ags_audio_buffer_kernel_avx2_copy_float_to_double,
+    ags_audio_buffer_kernel_avx2_copy_double_to_float,
+    ags_audio_buffer_kernel_avx2_copy_double_to_double,
+  },
+  {
+    AGS_AUDIO_BUFFER_KERNEL_AVX512,
+    "avx512",
+    ags_audio_buffer_kernel_avx512_clear_float,
+    ags_audio_buffer_kernel_avx512_clear_double,
+    ags_audio_buffer_kernel_avx512_copy_float_to_float,
+    ags_audio_buffer_kernel_avx512_copy_float_to_double,
+    ags_audio_buffer_kernel_avx512_copy_double_to_float,
+    ags_audio_buffer_kernel_avx512_copy_double_to_double,
+  },
+#else
+  { AGS_AUDIO_BUFFER_KERNEL_SSE2, "sse2", NULL, NULL, NULL, NULL, NULL, NULL, },
+  { AGS_AUDIO_BUFFER_KERNEL_AVX2, "avx2", NULL, NULL, NULL, NULL, NULL, NULL, },
+  { AGS_AUDIO_BUFFER_KERNEL_AVX512, "avx512", NULL, NULL, NULL, NULL, NULL, NULL, },
+#endif
+#if defined(AGS_AUDIO_BUFFER_KERNEL_AARCH64)
+  {
+    AGS_AUDIO_BUFFER_KERNEL_NEON,
+    "neon",
+    ags_audio_buffer_kernel_neon_clear_float,
+    ags_audio_buffer_kernel_neon_clear_double,
+    ags_audio_buffer_kernel_neon_copy_float_to_float,
+    ags_audio_buffer_kernel_neon_copy_float_to_double,
+    ags_audio_buffer_kernel_neon_copy_double_to_float,
+    ags_audio_buffer_kernel_neon_copy_double_to_double,
+  },
+#else
+  { AGS_AUDIO_BUFFER_KERNEL_NEON, "neon", NULL, NULL, NULL, NULL, NULL, NULL, },
+#endif
+};
+
+static AgsAudioBufferKernel *ags_audio_buffer_kernel_default = NULL;
+
+GType
+ags_audio_buffer_kernel_isa_get_type()
+{
+  static gsize g_enum_type_id__static;
+
+  if(g_once_init_enter(&g_enum_type_id__static)){
+    static const GEnumValue values[] = {
+      { AGS_AUDIO_BUFFER_KERNEL_SCALAR, "AGS_AUDIO_BUFFER_KERNEL_SCALAR", "scalar" },
+      { AGS_AUDIO_BUFFER_KERNEL_SSE2, "AGS_AUDIO_BUFFER_KERNEL_SSE2", "sse2" },
+      { AGS_AUDIO_BUFFER_KERNEL_AVX2, "AGS_AUDIO_BUFFER_KERNEL_AVX2", "avx2" },
+      { AGS_AUDIO_BUFFER_KERNEL_AVX512, "AGS_AUDIO_BUFFER_KERNEL_AVX512", "avx512" },
+      { AGS_AUDIO_BUFFER_KERNEL_NEON, "AGS_AUDIO_BUFFER_KERNEL_NEON", "neon" },
+      { 0, NULL, NULL }
+    };
+
+    GType g_enum_type_id = g_enum_register_static(g_intern_static_string("AgsAudioBufferKernelIsa"), values);
+
+    g_once_init_leave(&g_enum_type_id__static, g_enum_type_id);
+  }
+  
+  return(g_enum_type_id__static);
+}
+
+void
+ags_audio_buffer_kernel_scalar_clear_float(gfloat *destination, guint count)
+{
+  guint i;
+
+  for(i = 0; i < count; i++){
+    destination[i] = 0.0;
+  }
+}
+
+void
+ags_audio_buffer_kernel_scalar_clear_double(gdouble *destination, guint count)
+{
+  guint i;
+
+  for(i = 0; i < count; i++){
+    destination[i] = 0.0;
+  }
+}
+
+void
+ags_audio_buffer_kernel_scalar_copy_float_to_float(gfloat *destination, gfloat *source, guint count)
+{
+  guint i;
+
+  for(i = 0; i < count; i++){
+    destination[i] = destination[i] + source[i];
+  }
+}
+
+void
+ags_audio_buffer_kernel_scalar_copy_float_to_double(gdouble *destination, gfloat *source, guint count)
+{
+  guint i;
+
+  for(i = 0; i < count; i++){
+    destination[i] = destination[i] + (gdouble) source[i];
+  }
+}
+
+void
+ags_audio_buffer_kernel_scalar_copy_double_to_float(gfloat *destination, gdouble *source, guint count)
+{
+  guint i;
+
+  for(i = 0; i < count; i++){
+    destination[i] = (gfloat) ((gdouble) destination[i] + source[i]);
+  }
+}
+
+void
+ags_audio_buffer_kernel_scalar_copy_double_to_double(gdouble *destination, gdouble *source, guint count)
+{
+  guint i;
+
+  for(i = 0; i < count; i++){
+    destination[i] = destination[i] + source[i];
+  }
+}
+
+#if defined(AGS_AUDIO_BUFFER_KERNEL_X86)
+__attribute__((target("sse2"))) void
+ags_audio_buffer_kernel_sse2_clear_float(gfloat *destination, guint count)
+{
+  __m128 v_zero;
+  
+  guint i;
+
+  v_zero = _mm_setzero_ps();
+  
+  for(i = 0; i + 4 <= count; i += 4){
+    _mm_storeu_ps(destination + i, v_zero);
+  }
+
+  ags_audio_buffer_kernel_scalar_clear_float(destination + i, count - i);
+}
+
+__attribute__((target("sse2"))) void
+ags_audio_buffer_kernel_sse2_clear_double(gdouble *destination, guint count)
+{
+  __m128d v_zero;
+  
+  guint i;
+
+  v_zero = _mm_setzero_pd();
+  
+  for(i = 0; i + 2 <= count; i += 2){
+    _mm_storeu_pd(destination + i, v_zero);
+  }
+
+  ags_audio_buffer_kernel_scalar_clear_double(destination + i, count - i);
+}
+
+__attribute__((target("sse2"))) void
+ags_audio_buffer_kernel_sse2_copy_float_to_float(gfloat *destination, gfloat *source, guint count)
+{
+  guint i;
+
+  for(i = 0; i + 4 <= count; i += 4){
+    _mm_storeu_ps(destination + i,
+		  _mm_add_ps(_mm_loadu_ps(destination + i), _mm_loadu_ps(source + i)));
+  }
+
+  ags_audio_buffer_kernel_scalar_copy_float_to_float(destination + i, source + i, count - i);
+}
+
+__attribute__((target("sse2"))) void
+ags_audio_buffer_kernel_sse2_copy_float_to_double(gdouble *destination, gfloat *source, guint count)
+{
+  __m128 v_source;
+  
+  guint i;
+
+  for(i = 0; i + 4 <= count; i += 4){
+    v_source = _mm_loadu_ps(source + i);
+    
+    _mm_storeu_pd(destination + i,
+		  _mm_add_pd(_mm_loadu_pd(destination + i), _mm_cvtps_pd(v_source)));
+    _mm_storeu_pd(destination + i + 2,
+		  _mm_add_pd(_mm_loadu_pd(destination + i + 2), _mm_cvtps_pd(_mm_movehl_ps(v_source, v_source))));
+  }
+
+  ags_audio_buffer_kernel_scalar_copy_float_to_double(destination + i, source + i, count - i);
+}
+
+__attribute__((target("sse2"))) void
+ags_audio_buffer_kernel_sse2_copy_double_to_float(gfloat *destination, gdouble *source, guint count)
+{
+  __m128 v_destination;
+  __m128 v_low, v_high;
+  
+  guint i;
+
+  for(i = 0; i + 4 <= count; i += 4){
+    v_destination = _mm_loadu_ps(destination + i);
+
+    v_low = _mm_cvtpd_ps(_mm_add_pd(_mm_cvtps_pd(v_destination), _mm_loadu_pd(source + i)));
+    v_high = _mm_cvtpd_ps(_mm_add_pd(_mm_cvtps_pd(_mm_movehl_ps(v_destination, v_destination)), _mm_loadu_pd(source + i + 2)));
+    
+    _mm_storeu_ps(destination + i,
+		  _mm_movelh_ps(v_low, v_high));
+  }
+
+  ags_audio_buffer_kernel_scalar_copy_double_to_float(destination + i, source + i, count - i);
+}
+
+__attribute__((target("sse2"))) void
+ags_audio_buffer_kernel_sse2_copy_double_to_double(gdouble *destination, gdouble *source, guint count)
+{
+  guint i;
+
+  for(i = 0; i + 2 <= count; i += 2){
+    _mm_storeu_pd(destination + i,
+		  _mm_add_pd(_mm_loadu_pd(destination + i), _mm_loadu_pd(source + i)));
+  }
+
+  ags_audio_buffer_kernel_scalar_copy_double_to_double(destination + i, source + i, count - i);
+}
+
+__attribute__((target("avx2"))) void
+ags_audio_buffer_kernel_avx2_clear_float(gfloat *destination, guint count)
+{
+  __m256 v_zero;
+  
+  guint i;
+
+  v_zero = _mm256_setzero_ps();
+  
+  for(i = 0; i + 8 <= count; i += 8){
+    _mm256_storeu_ps(destination + i, v_zero);
+  }
+
+  ags_audio_buffer_kernel_scalar_clear_float(destination + i, count - i);
+}
+
+__attribute__((target("avx2"))) void
+ags_audio_buffer_kernel_avx2_clear_double(gdouble *destination, guint count)
+{
+  __m256d v_zero;
+  
+  guint i;
+
+  v_zero = _mm256_setzero_pd();
+  
+  for(i = 0; i + 4 <= count; i += 4){
+    _mm256_storeu_pd(destination + i, v_zero);
+  }
+
+  ags_audio_buffer_kernel_scalar_clear_double(destination + i, count - i);
+}
+
+__attribute__((target("avx2"))) void
+ags_audio_buffer_kernel_avx2_copy_float_to_float(gfloat *destination, gfloat *source, guint count)
+{
+  guint i;
+
+  for(i = 0; i + 8 <= count; i += 8){
+    _mm256_storeu_ps(destination + i,
+		     _mm256_add_ps(_mm256_loadu_ps(destination + i), _mm256_loadu_ps(source + i)));
+  }
+
+  ags_audio_buffer_kernel_scalar_copy_float_to_float(destination + i, source + i, count - i);
+}
+
+__attribute__((target("avx2"))) void
+ags_audio_buffer_kernel_avx2_copy_float_to_double(gdouble *destination, gfloat *source, guint count)
+{
+  guint i;
+
+  for(i = 0; i + 4 <= count; i += 4){
+    _mm256_storeu_pd(destination + i,
+		     _mm256_add_pd(_mm256_loadu_pd(destination + i), _mm256_cvtps_pd(_mm_loadu_ps(source + i))));
+  }
+
+  ags_audio_buffer_kernel_scalar_copy_float_to_double(destination + i, source + i, count - i);
+}
+
+__attribute__((target("avx2"))) void
+ags_audio_buffer_kernel_avx2_copy_double_to_float(gfloat *destination, gdouble *source, guint count)
+{
+  guint i;
+
+  for(i = 0; i + 4 <= count; i += 4){
+    _mm_storeu_ps(destination + i,
+		  _mm256_cvtpd_ps(_mm256_add_pd(_mm256_cvtps_pd(_mm_loadu_ps(destination + i)), _mm256_loadu_pd(source + i))));
+  }
+
+  ags_audio_buffer_kernel_scalar_copy_double_to_float(destination + i, source + i, count - i);
+}
+
+__attribute__((target("avx2"))) void
+ags_audio_buffer_kernel_avx2_copy_double_to_double(gdouble *destination, gdouble *source, guint count)
+{
+  guint i;
+
+  for(i = 0; i + 4 <= count; i += 4){
+    _mm256_storeu_pd(destination + i,
+		     _mm256_add_pd(_mm256_loadu_pd(destination + i), _mm256_loadu_pd(source + i)));
+  }
+
+  ags_audio_buffer_kernel_scalar_copy_double_to_double(destination + i, source + i, count - i);
+}
+
+__attribute__((target("avx512f"))) void
+ags_audio_buffer_kernel_avx512_clear_float(gfloat *destination, guint count)
+{
+  __m512 v_zero;
+  
+  guint i;
+
+  v_zero = _mm512_setzero_ps();
+  
+  for(i = 0; i + 16 <= count; i += 16){
+    _mm512_storeu_ps(destination + i, v_zero);
+  }
+
+  ags_audio_buffer_kernel_scalar_clear_float(destination + i, count - i);
+}
+
+__attribute__((target("avx512f"))) void
+ags_audio_buffer_kernel_avx512_clear_double(gdouble *destination, guint count)
+{
+  __m512d v_zero;
+  
+  guint i;
+
+  v_zero = _mm512_setzero_pd();
+  
+  for(i = 0; i + 8 <= count; i += 8){
+    _mm512_storeu_pd(destination + i, v_zero);
+  }
+
+  ags_audio_buffer_kernel_scalar_clear_double(destination + i, count - i);
+}
+
+__attribute__((target("avx512f"))) void
+ags_audio_buffer_kernel_avx512_copy_float_to_float(gfloat *destination, gfloat *source, guint count)
+{
+  guint i;
+
+  for(i = 0; i + 16 <= count; i += 16){
+    _mm512_storeu_ps(destination + i,
+		     _mm512_add_ps(_mm512_loadu_ps(destination + i), _mm512_loadu_ps(source + i)));
+  }
+
+  ags_audio_buffer_kernel_scalar_copy_float_to_float(destination + i, source + i, count - i);
+}
+
+__attribute__((target("avx512f"))) void
+ags_audio_buffer_kernel_avx512_copy_float_to_double(gdouble *destination, gfloat *source, guint count)
+{
+  guint i;
+
+  for(i = 0; i + 8 <= count; i += 8){
+    _mm512_storeu_pd(destination + i,
+		     _mm512_add_pd(_mm512_loadu_pd(destination + i), _mm512_cvtps_pd(_mm256_loadu_ps(source + i))));
+  }
+
+  ags_audio_buffer_kernel_scalar_copy_float_to_double(destination + i, source + i, count - i);
+}
+
+__attribute__((target("avx512f"))) void
+ags_audio_buffer_kernel_avx512_copy_double_to_float(gfloat *destination, gdouble *source, guint count)
+{
+  guint i;
+
+  for(i = 0; i + 8 <= count; i += 8){
+    _mm256_storeu_ps(destination + i,
+		     _mm512_cvtpd_ps(_mm512_add_pd(_mm512_cvtps_pd(_mm256_loadu_ps(destination + i)), _mm512_loadu_pd(source + i))));
+  }
+
+  ags_audio_buffer_kernel_scalar_copy_double_to_float(destination + i, source + i, count - i);
+}
+
+__attribute__((target("avx512f"))) void
+ags_audio_buffer_kernel_avx512_copy_double_to_double(gdouble *destination, gdouble *source, guint count)
+{
+  guint i;
+
+  for(i = 0; i + 8 <= count; i += 8){
+    _mm512_storeu_pd(destination + i,
+		     _mm512_add_pd(_mm512_loadu_pd(destination + i), _mm512_loadu_pd(source + i)));
+  }
+
+  ags_audio_buffer_kernel_scalar_copy_double_to_double(destination + i, source + i, count - i);
+}
+#endif
+
+#if defined(AGS_AUDIO_BUFFER_KERNEL_AARCH64)
+void
+ags_audio_buffer_kernel_neon_clear_float(gfloat *destination, guint count)
+{
+  float32x4_t v_zero;
+  
+  guint i;
+
+  v_zero = vdupq_n_f32(0.0f);
+  
+  for(i = 0; i + 4 <= count; i += 4){
+    vst1q_f32(destination + i, v_zero);
+  }
+
+  ags_audio_buffer_kernel_scalar_clear_float(destination + i, count - i);
+}
+
+void
+ags_audio_buffer_kernel_neon_clear_double(gdouble *destination, guint count)
+{
+  float64x2_t v_zero;
+  
+  guint i;
+
+  v_zero = vdupq_n_f64(0.0);
+  
+  for(i = 0; i + 2 <= count; i += 2){
+    vst1q_f64(destination + i, v_zero);
+  }
+
+  ags_audio_buffer_kernel_scalar_clear_double(destination + i, count - i);
+}
+
+void
+ags_audio_buffer_kernel_neon_copy_float_to_float(gfloat *destination, gfloat *source, guint count)
+{
+  guint i;
+
+  for(i = 0; i + 4 <= count; i += 4){
+    vst1q_f32(destination + i,
+	      vaddq_f32(vld1q_f32(destination + i), vld1q_f32(source + i)));
+  }
+
+  ags_audio_buffer_kernel_scalar_copy_float_to_float(destination + i, source + i, count - i);
+}
+
+void
+ags_audio_buffer_kernel_neon_copy_float_to_double(gdouble *destination, gfloat *source, guint count)
+{
+  guint i;
+
+  for(i = 0; i + 2 <= count; i += 2){
+    vst1q_f64(destination + i,
+	      vaddq_f64(vld1q_f64(destination + i), vcvt_f64_f32(vld1_f32(source + i))));
+  }
+
+  ags_audio_buffer_kernel_scalar_copy_float_to_double(destination + i, source + i, count - i);
+}
+
+void
+ags_audio_buffer_kernel_neon_copy_double_to_float(gfloat *destination, gdouble *source, guint count)
+{
+  guint i;
+
+  for(i = 0; i + 2 <= count; i += 2){
+    vst1_f32(destination + i,
+	     vcvt_f32_f64(vaddq_f64(vcvt_f64_f32(vld1_f32(destination + i)), vld1q_f64(source + i))));
+  }
+
+  ags_audio_buffer_kernel_scalar_copy_double_to_float(destination + i, source + i, count - i);
+}
+
+void
+ags_audio_buffer_kernel_neon_copy_double_to_double(gdouble *destination, gdouble *source, guint count)
+{
+  guint i;
+
+  for(i = 0; i + 2 <= count; i += 2){
+    vst1q_f64(destination + i,
+	      vaddq_f64(vld1q_f64(destination + i), vld1q_f64(source + i)));
+  }
+
+  ags_audio_buffer_kernel_scalar_copy_double_to_double(destination + i, source + i, count - i);
+}
+#endif
+
+/**
+ * ags_audio_buffer_kernel_isa_is_supported:
+ * @isa: the #AgsAudioBufferKernelIsa
+ *
+ * Check if @isa was built and is supported by the running CPU.
+ *
+ * Returns: %TRUE if supported, otherwise %FALSE
+ *
+ * Since: 9.1.0
+ */
+gboolean
+ags_audio_buffer_kernel_isa_is_supported(AgsAudioBufferKernelIsa isa)
+{
+  switch(isa){
+  case AGS_AUDIO_BUFFER_KERNEL_SCALAR:
+    {
+      return(TRUE);
+    }
+#if defined(AGS_AUDIO_BUFFER_KERNEL_X86)
+  case AGS_AUDIO_BUFFER_KERNEL_SSE2:
+    {
+      __builtin_cpu_init();
+      
+      return((__builtin_cpu_supports("sse2")) ? TRUE: FALSE);
+    }
+  case AGS_AUDIO_BUFFER_KERNEL_AVX2:
+    {
+      __builtin_cpu_init();
+      
+      return((__builtin_cpu_supports("avx2")) ? TRUE: FALSE);
+    }
+  case AGS_AUDIO_BUFFER_KERNEL_AVX512:
+    {
+      __builtin_cpu_init();
+      
+      return((__builtin_cpu_supports("avx512f")) ? TRUE: FALSE);
+    }
+#endif
+#if defined(AGS_AUDIO_BUFFER_KERNEL_AARCH64)
+  case AGS_AUDIO_BUFFER_KERNEL_NEON:
+    {
+      return(TRUE);
+    }
+#endif
+  default:
+    break;
+  }
+
+  return(FALSE);
+}
+
+/**
+ * ags_audio_buffer_kernel_get:
+ * @isa: the #AgsAudioBufferKernelIsa
+ *
+ * Get kernels of @isa.
+ *
+ * Returns: (transfer none): the #AgsAudioBufferKernel-struct or %NULL if @isa isn't supported
+ *
+ * Since: 9.1.0
+ */
+AgsAudioBufferKernel*
+ags_audio_buffer_kernel_get(AgsAudioBufferKernelIsa isa)
+{
+  if(isa >= AGS_AUDIO_BUFFER_KERNEL_ISA_COUNT ||
+     !ags_audio_buffer_kernel_isa_is_supported(isa)){
+    return(NULL);
+  }
+
+  return(&(ags_audio_buffer_kernel[isa]));
+}
+
+/**
+ * ags_audio_buffer_kernel_get_default:
+ *
+ * Get the best kernels supported by the running CPU. The CPU is queried
+ * once, later calls return the same #AgsAudioBufferKernel-struct.
+ *
+ * Returns: (transfer none): the #AgsAudioBufferKernel-struct
+ *
+ * Since: 9.1.0
+ */
+AgsAudioBufferKernel*
+ags_audio_buffer_kernel_get_default()
+{
+  static gsize default_initialized = 0;
+
+  if(g_once_init_enter(&default_initialized)){
+    AgsAudioBufferKernelIsa isa[] = {
+      AGS_AUDIO_BUFFER_KERNEL_AVX512,
+      AGS_AUDIO_BUFFER_KERNEL_AVX2,
+      AGS_AUDIO_BUFFER_KERNEL_NEON,
+      AGS_AUDIO_BUFFER_KERNEL_SSE2,
+    };
+
+    guint i;
+
+    ags_audio_buffer_kernel_default = &(ags_audio_buffer_kernel[AGS_AUDIO_BUFFER_KERNEL_SCALAR]);
+    
+    for(i = 0; i < G_N_ELEMENTS(isa); i++){
+      if(ags_audio_buffer_kernel_isa_is_supported(isa[i])){
+	ags_audio_buffer_kernel_default = &(ags_audio_buffer_kernel[isa[i]]);
+
+	break;
+      }
+    }
+    
+    g_once_init_leave(&default_initialized, 1);
+  }
+
+  return(ags_audio_buffer_kernel_default);
+}
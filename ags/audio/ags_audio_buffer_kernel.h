@@ -0,0 +1,92 @@
+/* GSequencer - Advanced GTK Sequencer
+ * Copyright (C) 2005-2026 Joël Krähemann
+ *
+ * This file is part of GSequencer.
+ *
+ * GSequencer is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GSequencer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GSequencer.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef __AGS_AUDIO_BUFFER_KERNEL_H__
+#define __AGS_AUDIO_BUFFER_KERNEL_H__
+
+#include <glib.h>
+#include <glib-object.h>
+
+G_BEGIN_DECLS
+
+#define AGS_TYPE_AUDIO_BUFFER_KERNEL_ISA   (ags_audio_buffer_kernel_isa_get_type())
+#define AGS_AUDIO_BUFFER_KERNEL(ptr) ((AgsAudioBufferKernel *)(ptr))
+
+#define AGS_AUDIO_BUFFER_KERNEL_ISA_COUNT (5)
+
+typedef struct _AgsAudioBufferKernel AgsAudioBufferKernel;
+
+/**
+ * AgsAudioBufferKernelIsa:
+ * @AGS_AUDIO_BUFFER_KERNEL_SCALAR: portable scalar kernels
+ * @AGS_AUDIO_BUFFER_KERNEL_SSE2: x86 SSE2 kernels
+ * @AGS_AUDIO_BUFFER_KERNEL_AVX2: x86 AVX2 kernels
+ * @AGS_AUDIO_BUFFER_KERNEL_AVX512: x86 AVX-512F kernels
+ * @AGS_AUDIO_BUFFER_KERNEL_NEON: AArch64 NEON kernels
+ *
+ * Enum values to select the instruction set of #AgsAudioBufferKernel.
+ */
+typedef enum{
+  AGS_AUDIO_BUFFER_KERNEL_SCALAR,
+  AGS_AUDIO_BUFFER_KERNEL_SSE2,
+  AGS_AUDIO_BUFFER_KERNEL_AVX2,
+  AGS_AUDIO_BUFFER_KERNEL_AVX512,
+  AGS_AUDIO_BUFFER_KERNEL_NEON,
+}AgsAudioBufferKernelIsa;
+
+/**
+ * AgsAudioBufferKernel:
+ * @isa: the #AgsAudioBufferKernelIsa
+ * @name: the name of @isa
+ * @clear_float: clear contiguous float buffer
+ * @clear_double: clear contiguous double buffer
+ * @copy_float_to_float: add contiguous float source to float destination
+ * @copy_float_to_double: add contiguous float source to double destination
+ * @copy_double_to_float: add contiguous double source to float destination
+ * @copy_double_to_double: add contiguous double source to double destination
+ *
+ * The #AgsAudioBufferKernel-struct is a table of hot buffer routines for
+ * one instruction set. All kernels give bit exact results of the scalar
+ * kernels, float to float stays in float lanes.
+ */
+struct _AgsAudioBufferKernel
+{
+  AgsAudioBufferKernelIsa isa;
+  const gchar *name;
+
+  void (*clear_float)(gfloat *destination, guint count);
+  void (*clear_double)(gdouble *destination, guint count);
+
+  void (*copy_float_to_float)(gfloat *destination, gfloat *source, guint count);
+  void (*copy_float_to_double)(gdouble *destination, gfloat *source, guint count);
+  void (*copy_double_to_float)(gfloat *destination, gdouble *source, guint count);
+  void (*copy_double_to_double)(gdouble *destination, gdouble *source, guint count);
+};
+
+GType ags_audio_buffer_kernel_isa_get_type(void);
+
+gboolean ags_audio_buffer_kernel_isa_is_supported(AgsAudioBufferKernelIsa isa);
+
+AgsAudioBufferKernel* ags_audio_buffer_kernel_get(AgsAudioBufferKernelIsa isa);
+AgsAudioBufferKernel* ags_audio_buffer_kernel_get_default();
+
+G_END_DECLS
+
+#endif /*__AGS_AUDIO_BUFFER_KERNEL_H__*/
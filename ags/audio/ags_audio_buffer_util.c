@@ -23,6 +23,8 @@
 
 #include <ags/audio/ags_audio_signal.h>
 #include <ags/audio/ags_vector_256_manager.h>
+#include <ags/audio/ags_scratch_arena.h>
+#include <ags/audio/ags_audio_buffer_kernel.h>
 
 #include <samplerate.h>
 
@@ -1197,6 +1199,13 @@ ags_audio_buffer_util_clear_float(AgsAudioBufferUtil *audio_buffer_util,
     return;
   }
   
+  /* contiguous buffers are dispatched to the CPU specific kernels */
+  if(channels == 1){
+    ags_audio_buffer_kernel_get_default()->clear_float(buffer, count);
+
+    return;
+  }
+
   i = 0;
   
   /* unrolled function */
@@ -1303,6 +1312,13 @@ ags_audio_buffer_util_clear_double(AgsAudioBufferUtil *audio_buffer_util,
     return;
   }
 
+  /* contiguous buffers are dispatched to the CPU specific kernels */
+  if(channels == 1){
+    ags_audio_buffer_kernel_get_default()->clear_double(buffer, count);
+
+    return;
+  }
+
   i = 0;
   
   /* unrolled function */
@@ -2817,17 +2833,17 @@ ags_audio_buffer_util_copy_s8_to_s8(AgsAudioBufferUtil *audio_buffer_util,
     limit = count - (count % 8);
   
 #if defined(AGS_VECTOR_256_FUNCTIONS)
-    AgsVector256Manager *vector_256_manager = ags_vector_256_manager_get_instance();
+    AgsScratchArena *scratch_arena = ags_scratch_arena_get_thread_default();
   
     while(i + 256 <= limit){
       AgsVectorArr *source_arr, *destination_arr;
 
       guint j;
     
-      while(!ags_vector_256_manager_try_acquire_dual(vector_256_manager,
-						     AGS_VECTOR_256_SIGNED_8_BIT, AGS_VECTOR_256_SIGNED_8_BIT,
-						     &source_arr, &destination_arr)){
-	g_thread_yield();
+      if(!ags_scratch_arena_acquire_dual(scratch_arena,
+					 AGS_VECTOR_256_SIGNED_8_BIT, AGS_VECTOR_256_SIGNED_8_BIT,
+					 &source_arr, &destination_arr)){
+	break;
       }
 
       ags_audio_buffer_util_fill_v8s8(NULL,
@@ -2849,10 +2865,10 @@ ags_audio_buffer_util_copy_s8_to_s8(AgsAudioBufferUtil *audio_buffer_util,
 					destination_arr->vector.vec_s8->mem_s8, 1,
 					256);
 
-      ags_vector_256_manager_release(vector_256_manager,
-				     source_arr);
-      ags_vector_256_manager_release(vector_256_manager,
-				     destination_arr);
+      ags_scratch_arena_release(scratch_arena,
+				source_arr);
+      ags_scratch_arena_release(scratch_arena,
+				destination_arr);
 
       destination += (256 * destination_stride);
       source += (256 * source_stride);
@@ -3104,17 +3120,17 @@ ags_audio_buffer_util_copy_s8_to_s16(AgsAudioBufferUtil *audio_buffer_util,
     limit = count - (count % 8);
   
 #if defined(AGS_VECTOR_256_FUNCTIONS)
-    AgsVector256Manager *vector_256_manager = ags_vector_256_manager_get_instance();
+    AgsScratchArena *scratch_arena = ags_scratch_arena_get_thread_default();
   
     while(i + 256 <= limit){
       AgsVectorArr *source_arr, *destination_arr;
 
       guint j;
     
-      while(!ags_vector_256_manager_try_acquire_dual(vector_256_manager,
-						     AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE,
-						     &source_arr, &destination_arr)){
-	g_thread_yield();
+      if(!ags_scratch_arena_acquire_dual(scratch_arena,
+					 AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE,
+					 &source_arr, &destination_arr)){
+	break;
       }
 
       ags_audio_buffer_util_fill_v8double_from_s8(NULL,
@@ -3138,10 +3154,10 @@ ags_audio_buffer_util_copy_s8_to_s16(AgsAudioBufferUtil *audio_buffer_util,
 						  destination_arr->vector.vec_double->mem_double, 1,
 						  256);
       
-      ags_vector_256_manager_release(vector_256_manager,
-				     source_arr);
-      ags_vector_256_manager_release(vector_256_manager,
-				     destination_arr);
+      ags_scratch_arena_release(scratch_arena,
+				source_arr);
+      ags_scratch_arena_release(scratch_arena,
+				destination_arr);
 
       destination += (256 * destination_stride);
       source += (256 * source_stride);
@@ -3404,17 +3420,17 @@ ags_audio_buffer_util_copy_s8_to_s24(AgsAudioBufferUtil *audio_buffer_util,
     limit = count - (count % 8);
   
 #if defined(AGS_VECTOR_256_FUNCTIONS)
-    AgsVector256Manager *vector_256_manager = ags_vector_256_manager_get_instance();
+    AgsScratchArena *scratch_arena = ags_scratch_arena_get_thread_default();
   
     while(i + 256 <= limit){
       AgsVectorArr *source_arr, *destination_arr;
 
       guint j;
     
-      while(!ags_vector_256_manager_try_acquire_dual(vector_256_manager,
-						     AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE,
-						     &source_arr, &destination_arr)){
-	g_thread_yield();
+      if(!ags_scratch_arena_acquire_dual(scratch_arena,
+					 AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE,
+					 &source_arr, &destination_arr)){
+	break;
       }
 
       ags_audio_buffer_util_fill_v8double_from_s8(NULL,
@@ -3438,10 +3454,10 @@ ags_audio_buffer_util_copy_s8_to_s24(AgsAudioBufferUtil *audio_buffer_util,
 						  destination_arr->vector.vec_double->mem_double, 1,
 						  256);
       
-      ags_vector_256_manager_release(vector_256_manager,
-				     source_arr);
-      ags_vector_256_manager_release(vector_256_manager,
-				     destination_arr);
+      ags_scratch_arena_release(scratch_arena,
+				source_arr);
+      ags_scratch_arena_release(scratch_arena,
+				destination_arr);
 
       destination += (256 * destination_stride);
       source += (256 * source_stride);
@@ -3704,17 +3720,17 @@ ags_audio_buffer_util_copy_s8_to_s32(AgsAudioBufferUtil *audio_buffer_util,
     limit = count - (count % 8);
   
 #if defined(AGS_VECTOR_256_FUNCTIONS)
-    AgsVector256Manager *vector_256_manager = ags_vector_256_manager_get_instance();
+    AgsScratchArena *scratch_arena = ags_scratch_arena_get_thread_default();
   
     while(i + 256 <= limit){
       AgsVectorArr *source_arr, *destination_arr;
 
       guint j;
     
-      while(!ags_vector_256_manager_try_acquire_dual(vector_256_manager,
-						     AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE,
-						     &source_arr, &destination_arr)){
-	g_thread_yield();
+      if(!ags_scratch_arena_acquire_dual(scratch_arena,
+					 AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE,
+					 &source_arr, &destination_arr)){
+	break;
       }
 
       ags_audio_buffer_util_fill_v8double_from_s8(NULL,
@@ -3738,10 +3754,10 @@ ags_audio_buffer_util_copy_s8_to_s32(AgsAudioBufferUtil *audio_buffer_util,
 						  destination_arr->vector.vec_double->mem_double, 1,
 						  256);
       
-      ags_vector_256_manager_release(vector_256_manager,
-				     source_arr);
-      ags_vector_256_manager_release(vector_256_manager,
-				     destination_arr);
+      ags_scratch_arena_release(scratch_arena,
+				source_arr);
+      ags_scratch_arena_release(scratch_arena,
+				destination_arr);
 
       destination += (256 * destination_stride);
       source += (256 * source_stride);
@@ -4004,17 +4020,17 @@ ags_audio_buffer_util_copy_s8_to_s64(AgsAudioBufferUtil *audio_buffer_util,
     limit = count - (count % 8);
   
 #if defined(AGS_VECTOR_256_FUNCTIONS)
-    AgsVector256Manager *vector_256_manager = ags_vector_256_manager_get_instance();
+    AgsScratchArena *scratch_arena = ags_scratch_arena_get_thread_default();
   
     while(i + 256 <= limit){
       AgsVectorArr *source_arr, *destination_arr;
 
       guint j;
     
-      while(!ags_vector_256_manager_try_acquire_dual(vector_256_manager,
-						     AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE,
-						     &source_arr, &destination_arr)){
-	g_thread_yield();
+      if(!ags_scratch_arena_acquire_dual(scratch_arena,
+					 AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE,
+					 &source_arr, &destination_arr)){
+	break;
       }
 
       ags_audio_buffer_util_fill_v8double_from_s8(NULL,
@@ -4038,10 +4054,10 @@ ags_audio_buffer_util_copy_s8_to_s64(AgsAudioBufferUtil *audio_buffer_util,
 						  destination_arr->vector.vec_double->mem_double, 1,
 						  256);
       
-      ags_vector_256_manager_release(vector_256_manager,
-				     source_arr);
-      ags_vector_256_manager_release(vector_256_manager,
-				     destination_arr);
+      ags_scratch_arena_release(scratch_arena,
+				source_arr);
+      ags_scratch_arena_release(scratch_arena,
+				destination_arr);
 
       destination += (256 * destination_stride);
       source += (256 * source_stride);
@@ -4305,17 +4321,17 @@ ags_audio_buffer_util_copy_s8_to_float(AgsAudioBufferUtil *audio_buffer_util,
     limit = count - (count % 8);
   
 #if defined(AGS_VECTOR_256_FUNCTIONS)
-    AgsVector256Manager *vector_256_manager = ags_vector_256_manager_get_instance();
+    AgsScratchArena *scratch_arena = ags_scratch_arena_get_thread_default();
   
     while(i + 256 <= limit){
       AgsVectorArr *source_arr, *destination_arr;
 
       guint j;
     
-      while(!ags_vector_256_manager_try_acquire_dual(vector_256_manager,
-						     AGS_VECTOR_256_FLOAT, AGS_VECTOR_256_FLOAT,
-						     &source_arr, &destination_arr)){
-	g_thread_yield();
+      if(!ags_scratch_arena_acquire_dual(scratch_arena,
+					 AGS_VECTOR_256_FLOAT, AGS_VECTOR_256_FLOAT,
+					 &source_arr, &destination_arr)){
+	break;
       }
 
       ags_audio_buffer_util_fill_v8float_from_s8(NULL,
@@ -4339,10 +4355,10 @@ ags_audio_buffer_util_copy_s8_to_float(AgsAudioBufferUtil *audio_buffer_util,
 					  destination_arr->vector.vec_float->mem_float, 1,
 					  256);
       
-      ags_vector_256_manager_release(vector_256_manager,
-				     source_arr);
-      ags_vector_256_manager_release(vector_256_manager,
-				     destination_arr);
+      ags_scratch_arena_release(scratch_arena,
+				source_arr);
+      ags_scratch_arena_release(scratch_arena,
+				destination_arr);
 
       destination += (256 * destination_stride);
       source += (256 * source_stride);
@@ -4604,17 +4620,17 @@ ags_audio_buffer_util_copy_s8_to_double(AgsAudioBufferUtil *audio_buffer_util,
     limit = count - (count % 8);
   
 #if defined(AGS_VECTOR_256_FUNCTIONS)
-    AgsVector256Manager *vector_256_manager = ags_vector_256_manager_get_instance();
+    AgsScratchArena *scratch_arena = ags_scratch_arena_get_thread_default();
   
     while(i + 256 <= limit){
       AgsVectorArr *source_arr, *destination_arr;
 
       guint j;
     
-      while(!ags_vector_256_manager_try_acquire_dual(vector_256_manager,
-						     AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE,
-						     &source_arr, &destination_arr)){
-	g_thread_yield();
+      if(!ags_scratch_arena_acquire_dual(scratch_arena,
+					 AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE,
+					 &source_arr, &destination_arr)){
+	break;
       }
 
       ags_audio_buffer_util_fill_v8double_from_s8(NULL,
@@ -4638,10 +4654,10 @@ ags_audio_buffer_util_copy_s8_to_double(AgsAudioBufferUtil *audio_buffer_util,
 					  destination_arr->vector.vec_double->mem_double, 1,
 					  256);
       
-      ags_vector_256_manager_release(vector_256_manager,
-				     source_arr);
-      ags_vector_256_manager_release(vector_256_manager,
-				     destination_arr);
+      ags_scratch_arena_release(scratch_arena,
+				source_arr);
+      ags_scratch_arena_release(scratch_arena,
+				destination_arr);
 
       destination += (256 * destination_stride);
       source += (256 * source_stride);
@@ -4902,17 +4918,17 @@ ags_audio_buffer_util_copy_s16_to_s8(AgsAudioBufferUtil *audio_buffer_util,
     limit = count - (count % 8);
   
 #if defined(AGS_VECTOR_256_FUNCTIONS)
-    AgsVector256Manager *vector_256_manager = ags_vector_256_manager_get_instance();
+    AgsScratchArena *scratch_arena = ags_scratch_arena_get_thread_default();
   
     while(i + 256 <= limit){
       AgsVectorArr *source_arr, *destination_arr;
 
       guint j;
     
-      while(!ags_vector_256_manager_try_acquire_dual(vector_256_manager,
-						     AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE,
-						     &source_arr, &destination_arr)){
-	g_thread_yield();
+      if(!ags_scratch_arena_acquire_dual(scratch_arena,
+					 AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE,
+					 &source_arr, &destination_arr)){
+	break;
       }
 
       ags_audio_buffer_util_fill_v8double_from_s16(NULL,
@@ -4936,10 +4952,10 @@ ags_audio_buffer_util_copy_s16_to_s8(AgsAudioBufferUtil *audio_buffer_util,
 						 destination_arr->vector.vec_double->mem_double, 1,
 						 256);
       
-      ags_vector_256_manager_release(vector_256_manager,
-				     source_arr);
-      ags_vector_256_manager_release(vector_256_manager,
-				     destination_arr);
+      ags_scratch_arena_release(scratch_arena,
+				source_arr);
+      ags_scratch_arena_release(scratch_arena,
+				destination_arr);
 
       destination += (256 * destination_stride);
       source += (256 * source_stride);
@@ -5200,17 +5216,17 @@ ags_audio_buffer_util_copy_s16_to_s16(AgsAudioBufferUtil *audio_buffer_util,
     limit = count - (count % 8);
   
 #if defined(AGS_VECTOR_256_FUNCTIONS)
-    AgsVector256Manager *vector_256_manager = ags_vector_256_manager_get_instance();
+    AgsScratchArena *scratch_arena = ags_scratch_arena_get_thread_default();
   
     while(i + 256 <= limit){
       AgsVectorArr *source_arr, *destination_arr;
 
       guint j;
     
-      while(!ags_vector_256_manager_try_acquire_dual(vector_256_manager,
-						     AGS_VECTOR_256_SIGNED_16_BIT, AGS_VECTOR_256_SIGNED_16_BIT,
-						     &source_arr, &destination_arr)){
-	g_thread_yield();
+      if(!ags_scratch_arena_acquire_dual(scratch_arena,
+					 AGS_VECTOR_256_SIGNED_16_BIT, AGS_VECTOR_256_SIGNED_16_BIT,
+					 &source_arr, &destination_arr)){
+	break;
       }
 
       ags_audio_buffer_util_fill_v8s16(NULL,
@@ -5232,10 +5248,10 @@ ags_audio_buffer_util_copy_s16_to_s16(AgsAudioBufferUtil *audio_buffer_util,
 					destination_arr->vector.vec_s16->mem_s16, 1,
 					256);
 
-      ags_vector_256_manager_release(vector_256_manager,
-				     source_arr);
-      ags_vector_256_manager_release(vector_256_manager,
-				     destination_arr);
+      ags_scratch_arena_release(scratch_arena,
+				source_arr);
+      ags_scratch_arena_release(scratch_arena,
+				destination_arr);
 
       destination += (256 * destination_stride);
       source += (256 * source_stride);
@@ -5486,17 +5502,17 @@ ags_audio_buffer_util_copy_s16_to_s24(AgsAudioBufferUtil *audio_buffer_util,
     limit = count - (count % 8);
   
 #if defined(AGS_VECTOR_256_FUNCTIONS)
-    AgsVector256Manager *vector_256_manager = ags_vector_256_manager_get_instance();
+    AgsScratchArena *scratch_arena = ags_scratch_arena_get_thread_default();
   
     while(i + 256 <= limit){
       AgsVectorArr *source_arr, *destination_arr;
 
       guint j;
     
-      while(!ags_vector_256_manager_try_acquire_dual(vector_256_manager,
-						     AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE,
-						     &source_arr, &destination_arr)){
-	g_thread_yield();
+      if(!ags_scratch_arena_acquire_dual(scratch_arena,
+					 AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE,
+					 &source_arr, &destination_arr)){
+	break;
       }
 
       ags_audio_buffer_util_fill_v8double_from_s16(NULL,
@@ -5520,10 +5536,10 @@ ags_audio_buffer_util_copy_s16_to_s24(AgsAudioBufferUtil *audio_buffer_util,
 						  destination_arr->vector.vec_double->mem_double, 1,
 						  256);
       
-      ags_vector_256_manager_release(vector_256_manager,
-				     source_arr);
-      ags_vector_256_manager_release(vector_256_manager,
-				     destination_arr);
+      ags_scratch_arena_release(scratch_arena,
+				source_arr);
+      ags_scratch_arena_release(scratch_arena,
+				destination_arr);
 
       destination += (256 * destination_stride);
       source += (256 * source_stride);
@@ -5741,17 +5757,17 @@ ags_audio_buffer_util_copy_s16_to_s32(AgsAudioBufferUtil *audio_buffer_util,
     limit = count - (count % 8);
   
 #if defined(AGS_VECTOR_256_FUNCTIONS)
-    AgsVector256Manager *vector_256_manager = ags_vector_256_manager_get_instance();
+    AgsScratchArena *scratch_arena = ags_scratch_arena_get_thread_default();
   
     while(i + 256 <= limit){
       AgsVectorArr *source_arr, *destination_arr;
 
       guint j;
     
-      while(!ags_vector_256_manager_try_acquire_dual(vector_256_manager,
-						     AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE,
-						     &source_arr, &destination_arr)){
-	g_thread_yield();
+      if(!ags_scratch_arena_acquire_dual(scratch_arena,
+					 AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE,
+					 &source_arr, &destination_arr)){
+	break;
       }
 
       ags_audio_buffer_util_fill_v8double_from_s16(NULL,
@@ -5775,10 +5791,10 @@ ags_audio_buffer_util_copy_s16_to_s32(AgsAudioBufferUtil *audio_buffer_util,
 						  destination_arr->vector.vec_double->mem_double, 1,
 						  256);
       
-      ags_vector_256_manager_release(vector_256_manager,
-				     source_arr);
-      ags_vector_256_manager_release(vector_256_manager,
-				     destination_arr);
+      ags_scratch_arena_release(scratch_arena,
+				source_arr);
+      ags_scratch_arena_release(scratch_arena,
+				destination_arr);
 
       destination += (256 * destination_stride);
       source += (256 * source_stride);
@@ -5996,17 +6012,17 @@ ags_audio_buffer_util_copy_s16_to_s64(AgsAudioBufferUtil *audio_buffer_util,
     limit = count - (count % 8);
   
 #if defined(AGS_VECTOR_256_FUNCTIONS)
-    AgsVector256Manager *vector_256_manager = ags_vector_256_manager_get_instance();
+    AgsScratchArena *scratch_arena = ags_scratch_arena_get_thread_default();
   
     while(i + 256 <= limit){
       AgsVectorArr *source_arr, *destination_arr;
 
       guint j;
     
-      while(!ags_vector_256_manager_try_acquire_dual(vector_256_manager,
-						     AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE,
-						     &source_arr, &destination_arr)){
-	g_thread_yield();
+      if(!ags_scratch_arena_acquire_dual(scratch_arena,
+					 AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE,
+					 &source_arr, &destination_arr)){
+	break;
       }
 
       ags_audio_buffer_util_fill_v8double_from_s16(NULL,
@@ -6030,10 +6046,10 @@ ags_audio_buffer_util_copy_s16_to_s64(AgsAudioBufferUtil *audio_buffer_util,
 						  destination_arr->vector.vec_double->mem_double, 1,
 						  256);
       
-      ags_vector_256_manager_release(vector_256_manager,
-				     source_arr);
-      ags_vector_256_manager_release(vector_256_manager,
-				     destination_arr);
+      ags_scratch_arena_release(scratch_arena,
+				source_arr);
+      ags_scratch_arena_release(scratch_arena,
+				destination_arr);
 
       destination += (256 * destination_stride);
       source += (256 * source_stride);
@@ -6252,17 +6268,17 @@ ags_audio_buffer_util_copy_s16_to_float(AgsAudioBufferUtil *audio_buffer_util,
     limit = count - (count % 8);
   
 #if defined(AGS_VECTOR_256_FUNCTIONS)
-    AgsVector256Manager *vector_256_manager = ags_vector_256_manager_get_instance();
+    AgsScratchArena *scratch_arena = ags_scratch_arena_get_thread_default();
   
     while(i + 256 <= limit){
       AgsVectorArr *source_arr, *destination_arr;
 
       guint j;
     
-      while(!ags_vector_256_manager_try_acquire_dual(vector_256_manager,
-						     AGS_VECTOR_256_FLOAT, AGS_VECTOR_256_FLOAT,
-						     &source_arr, &destination_arr)){
-	g_thread_yield();
+      if(!ags_scratch_arena_acquire_dual(scratch_arena,
+					 AGS_VECTOR_256_FLOAT, AGS_VECTOR_256_FLOAT,
+					 &source_arr, &destination_arr)){
+	break;
       }
 
       ags_audio_buffer_util_fill_v8float_from_s16(NULL,
@@ -6286,10 +6302,10 @@ ags_audio_buffer_util_copy_s16_to_float(AgsAudioBufferUtil *audio_buffer_util,
 					  destination_arr->vector.vec_float->mem_float, 1,
 					  256);
       
-      ags_vector_256_manager_release(vector_256_manager,
-				     source_arr);
-      ags_vector_256_manager_release(vector_256_manager,
-				     destination_arr);
+      ags_scratch_arena_release(scratch_arena,
+				source_arr);
+      ags_scratch_arena_release(scratch_arena,
+				destination_arr);
 
       destination += (256 * destination_stride);
       source += (256 * source_stride);
@@ -6508,17 +6524,17 @@ ags_audio_buffer_util_copy_s16_to_double(AgsAudioBufferUtil *audio_buffer_util,
     limit = count - (count % 8);
   
 #if defined(AGS_VECTOR_256_FUNCTIONS)
-    AgsVector256Manager *vector_256_manager = ags_vector_256_manager_get_instance();
+    AgsScratchArena *scratch_arena = ags_scratch_arena_get_thread_default();
   
     while(i + 256 <= limit){
       AgsVectorArr *source_arr, *destination_arr;
 
       guint j;
     
-      while(!ags_vector_256_manager_try_acquire_dual(vector_256_manager,
-						     AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE,
-						     &source_arr, &destination_arr)){
-	g_thread_yield();
+      if(!ags_scratch_arena_acquire_dual(scratch_arena,
+					 AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE,
+					 &source_arr, &destination_arr)){
+	break;
       }
 
       ags_audio_buffer_util_fill_v8double_from_s16(NULL,
@@ -6542,10 +6558,10 @@ ags_audio_buffer_util_copy_s16_to_double(AgsAudioBufferUtil *audio_buffer_util,
 					  destination_arr->vector.vec_double->mem_double, 1,
 					  256);
       
-      ags_vector_256_manager_release(vector_256_manager,
-				     source_arr);
-      ags_vector_256_manager_release(vector_256_manager,
-				     destination_arr);
+      ags_scratch_arena_release(scratch_arena,
+				source_arr);
+      ags_scratch_arena_release(scratch_arena,
+				destination_arr);
 
       destination += (256 * destination_stride);
       source += (256 * source_stride);
@@ -6763,17 +6779,17 @@ ags_audio_buffer_util_copy_s24_to_s8(AgsAudioBufferUtil *audio_buffer_util,
     limit = count - (count % 8);
   
 #if defined(AGS_VECTOR_256_FUNCTIONS)
-    AgsVector256Manager *vector_256_manager = ags_vector_256_manager_get_instance();
+    AgsScratchArena *scratch_arena = ags_scratch_arena_get_thread_default();
   
     while(i + 256 <= limit){
       AgsVectorArr *source_arr, *destination_arr;
 
       guint j;
     
-      while(!ags_vector_256_manager_try_acquire_dual(vector_256_manager,
-						     AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE,
-						     &source_arr, &destination_arr)){
-	g_thread_yield();
+      if(!ags_scratch_arena_acquire_dual(scratch_arena,
+					 AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE,
+					 &source_arr, &destination_arr)){
+	break;
       }
 
       ags_audio_buffer_util_fill_v8double_from_s32(NULL,
@@ -6797,10 +6813,10 @@ ags_audio_buffer_util_copy_s24_to_s8(AgsAudioBufferUtil *audio_buffer_util,
 						 destination_arr->vector.vec_double->mem_double, 1,
 						 256);
       
-      ags_vector_256_manager_release(vector_256_manager,
-				     source_arr);
-      ags_vector_256_manager_release(vector_256_manager,
-				     destination_arr);
+      ags_scratch_arena_release(scratch_arena,
+				source_arr);
+      ags_scratch_arena_release(scratch_arena,
+				destination_arr);
 
       destination += (256 * destination_stride);
       source += (256 * source_stride);
@@ -7018,17 +7034,17 @@ ags_audio_buffer_util_copy_s24_to_s16(AgsAudioBufferUtil *audio_buffer_util,
     limit = count - (count % 8);
   
 #if defined(AGS_VECTOR_256_FUNCTIONS)
-    AgsVector256Manager *vector_256_manager = ags_vector_256_manager_get_instance();
+    AgsScratchArena *scratch_arena = ags_scratch_arena_get_thread_default();
   
     while(i + 256 <= limit){
       AgsVectorArr *source_arr, *destination_arr;
 
       guint j;
     
-      while(!ags_vector_256_manager_try_acquire_dual(vector_256_manager,
-						     AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE,
-						     &source_arr, &destination_arr)){
-	g_thread_yield();
+      if(!ags_scratch_arena_acquire_dual(scratch_arena,
+					 AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE,
+					 &source_arr, &destination_arr)){
+	break;
       }
 
       ags_audio_buffer_util_fill_v8double_from_s32(NULL,
@@ -7052,10 +7068,10 @@ ags_audio_buffer_util_copy_s24_to_s16(AgsAudioBufferUtil *audio_buffer_util,
 						  destination_arr->vector.vec_double->mem_double, 1,
 						  256);
       
-      ags_vector_256_manager_release(vector_256_manager,
-				     source_arr);
-      ags_vector_256_manager_release(vector_256_manager,
-				     destination_arr);
+      ags_scratch_arena_release(scratch_arena,
+				source_arr);
+      ags_scratch_arena_release(scratch_arena,
+				destination_arr);
 
       destination += (256 * destination_stride);
       source += (256 * source_stride);
@@ -7271,17 +7287,17 @@ ags_audio_buffer_util_copy_s24_to_s24(AgsAudioBufferUtil *audio_buffer_util,
     limit = count - (count % 8);
   
 #if defined(AGS_VECTOR_256_FUNCTIONS)
-    AgsVector256Manager *vector_256_manager = ags_vector_256_manager_get_instance();
+    AgsScratchArena *scratch_arena = ags_scratch_arena_get_thread_default();
   
     while(i + 256 <= limit){
       AgsVectorArr *source_arr, *destination_arr;
 
       guint j;
     
-      while(!ags_vector_256_manager_try_acquire_dual(vector_256_manager,
-						     AGS_VECTOR_256_SIGNED_32_BIT, AGS_VECTOR_256_SIGNED_32_BIT,
-						     &source_arr, &destination_arr)){
-	g_thread_yield();
+      if(!ags_scratch_arena_acquire_dual(scratch_arena,
+					 AGS_VECTOR_256_SIGNED_32_BIT, AGS_VECTOR_256_SIGNED_32_BIT,
+					 &source_arr, &destination_arr)){
+	break;
       }
 
       ags_audio_buffer_util_fill_v8s32(NULL,
@@ -7303,10 +7319,10 @@ ags_audio_buffer_util_copy_s24_to_s24(AgsAudioBufferUtil *audio_buffer_util,
 					destination_arr->vector.vec_s32->mem_s32, 1,
 					256);
 
-      ags_vector_256_manager_release(vector_256_manager,
-				     source_arr);
-      ags_vector_256_manager_release(vector_256_manager,
-				     destination_arr);
+      ags_scratch_arena_release(scratch_arena,
+				source_arr);
+      ags_scratch_arena_release(scratch_arena,
+				destination_arr);
 
       destination += (256 * destination_stride);
       source += (256 * source_stride);
@@ -7516,17 +7532,17 @@ ags_audio_buffer_util_copy_s24_to_s32(AgsAudioBufferUtil *audio_buffer_util,
     limit = count - (count % 8);
   
 #if defined(AGS_VECTOR_256_FUNCTIONS)
-    AgsVector256Manager *vector_256_manager = ags_vector_256_manager_get_instance();
+    AgsScratchArena *scratch_arena = ags_scratch_arena_get_thread_default();
   
     while(i + 256 <= limit){
       AgsVectorArr *source_arr, *destination_arr;
 
       guint j;
     
-      while(!ags_vector_256_manager_try_acquire_dual(vector_256_manager,
-						     AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE,
-						     &source_arr, &destination_arr)){
-	g_thread_yield();
+      if(!ags_scratch_arena_acquire_dual(scratch_arena,
+					 AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE,
+					 &source_arr, &destination_arr)){
+	break;
       }
 
       ags_audio_buffer_util_fill_v8double_from_s32(NULL,
@@ -7550,10 +7566,10 @@ ags_audio_buffer_util_copy_s24_to_s32(AgsAudioBufferUtil *audio_buffer_util,
 						  destination_arr->vector.vec_double->mem_double, 1,
 						  256);
       
-      ags_vector_256_manager_release(vector_256_manager,
-				     source_arr);
-      ags_vector_256_manager_release(vector_256_manager,
-				     destination_arr);
+      ags_scratch_arena_release(scratch_arena,
+				source_arr);
+      ags_scratch_arena_release(scratch_arena,
+				destination_arr);
 
       destination += (256 * destination_stride);
       source += (256 * source_stride);
@@ -7771,17 +7787,17 @@ ags_audio_buffer_util_copy_s24_to_s64(AgsAudioBufferUtil *audio_buffer_util,
     limit = count - (count % 8);
   
 #if defined(AGS_VECTOR_256_FUNCTIONS)
-    AgsVector256Manager *vector_256_manager = ags_vector_256_manager_get_instance();
+    AgsScratchArena *scratch_arena = ags_scratch_arena_get_thread_default();
   
     while(i + 256 <= limit){
       AgsVectorArr *source_arr, *destination_arr;
 
       guint j;
     
-      while(!ags_vector_256_manager_try_acquire_dual(vector_256_manager,
-						     AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE,
-						     &source_arr, &destination_arr)){
-	g_thread_yield();
+      if(!ags_scratch_arena_acquire_dual(scratch_arena,
+					 AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE,
+					 &source_arr, &destination_arr)){
+	break;
       }
 
       ags_audio_buffer_util_fill_v8double_from_s32(NULL,
@@ -7805,10 +7821,10 @@ ags_audio_buffer_util_copy_s24_to_s64(AgsAudioBufferUtil *audio_buffer_util,
 						  destination_arr->vector.vec_double->mem_double, 1,
 						  256);
       
-      ags_vector_256_manager_release(vector_256_manager,
-				     source_arr);
-      ags_vector_256_manager_release(vector_256_manager,
-				     destination_arr);
+      ags_scratch_arena_release(scratch_arena,
+				source_arr);
+      ags_scratch_arena_release(scratch_arena,
+				destination_arr);
 
       destination += (256 * destination_stride);
       source += (256 * source_stride);
@@ -8027,17 +8043,17 @@ ags_audio_buffer_util_copy_s24_to_float(AgsAudioBufferUtil *audio_buffer_util,
     limit = count - (count % 8);
   
 #if defined(AGS_VECTOR_256_FUNCTIONS)
-    AgsVector256Manager *vector_256_manager = ags_vector_256_manager_get_instance();
+    AgsScratchArena *scratch_arena = ags_scratch_arena_get_thread_default();
   
     while(i + 256 <= limit){
       AgsVectorArr *source_arr, *destination_arr;
 
       guint j;
     
-      while(!ags_vector_256_manager_try_acquire_dual(vector_256_manager,
-						     AGS_VECTOR_256_FLOAT, AGS_VECTOR_256_FLOAT,
-						     &source_arr, &destination_arr)){
-	g_thread_yield();
+      if(!ags_scratch_arena_acquire_dual(scratch_arena,
+					 AGS_VECTOR_256_FLOAT, AGS_VECTOR_256_FLOAT,
+					 &source_arr, &destination_arr)){
+	break;
       }
 
       ags_audio_buffer_util_fill_v8float_from_s32(NULL,
@@ -8061,10 +8077,10 @@ ags_audio_buffer_util_copy_s24_to_float(AgsAudioBufferUtil *audio_buffer_util,
 					  destination_arr->vector.vec_float->mem_float, 1,
 					  256);
       
-      ags_vector_256_manager_release(vector_256_manager,
-				     source_arr);
-      ags_vector_256_manager_release(vector_256_manager,
-				     destination_arr);
+      ags_scratch_arena_release(scratch_arena,
+				source_arr);
+      ags_scratch_arena_release(scratch_arena,
+				destination_arr);
 
       destination += (256 * destination_stride);
       source += (256 * source_stride);
@@ -8283,17 +8299,17 @@ ags_audio_buffer_util_copy_s24_to_double(AgsAudioBufferUtil *audio_buffer_util,
     limit = count - (count % 8);
   
 #if defined(AGS_VECTOR_256_FUNCTIONS)
-    AgsVector256Manager *vector_256_manager = ags_vector_256_manager_get_instance();
+    AgsScratchArena *scratch_arena = ags_scratch_arena_get_thread_default();
   
     while(i + 256 <= limit){
       AgsVectorArr *source_arr, *destination_arr;
 
       guint j;
     
-      while(!ags_vector_256_manager_try_acquire_dual(vector_256_manager,
-						     AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE,
-						     &source_arr, &destination_arr)){
-	g_thread_yield();
+      if(!ags_scratch_arena_acquire_dual(scratch_arena,
+					 AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE,
+					 &source_arr, &destination_arr)){
+	break;
       }
 
       ags_audio_buffer_util_fill_v8double_from_s32(NULL,
@@ -8317,10 +8333,10 @@ ags_audio_buffer_util_copy_s24_to_double(AgsAudioBufferUtil *audio_buffer_util,
 					  destination_arr->vector.vec_double->mem_double, 1,
 					  256);
       
-      ags_vector_256_manager_release(vector_256_manager,
-				     source_arr);
-      ags_vector_256_manager_release(vector_256_manager,
-				     destination_arr);
+      ags_scratch_arena_release(scratch_arena,
+				source_arr);
+      ags_scratch_arena_release(scratch_arena,
+				destination_arr);
 
       destination += (256 * destination_stride);
       source += (256 * source_stride);
@@ -8538,17 +8554,17 @@ ags_audio_buffer_util_copy_s32_to_s8(AgsAudioBufferUtil *audio_buffer_util,
     limit = count - (count % 8);
   
 #if defined(AGS_VECTOR_256_FUNCTIONS)
-    AgsVector256Manager *vector_256_manager = ags_vector_256_manager_get_instance();
+    AgsScratchArena *scratch_arena = ags_scratch_arena_get_thread_default();
   
     while(i + 256 <= limit){
       AgsVectorArr *source_arr, *destination_arr;
 
       guint j;
     
-      while(!ags_vector_256_manager_try_acquire_dual(vector_256_manager,
-						     AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE,
-						     &source_arr, &destination_arr)){
-	g_thread_yield();
+      if(!ags_scratch_arena_acquire_dual(scratch_arena,
+					 AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE,
+					 &source_arr, &destination_arr)){
+	break;
       }
 
       ags_audio_buffer_util_fill_v8double_from_s32(NULL,
@@ -8572,10 +8588,10 @@ ags_audio_buffer_util_copy_s32_to_s8(AgsAudioBufferUtil *audio_buffer_util,
 						 destination_arr->vector.vec_double->mem_double, 1,
 						 256);
       
-      ags_vector_256_manager_release(vector_256_manager,
-				     source_arr);
-      ags_vector_256_manager_release(vector_256_manager,
-				     destination_arr);
+      ags_scratch_arena_release(scratch_arena,
+				source_arr);
+      ags_scratch_arena_release(scratch_arena,
+				destination_arr);
 
       destination += (256 * destination_stride);
       source += (256 * source_stride);
@@ -8793,17 +8809,17 @@ ags_audio_buffer_util_copy_s32_to_s16(AgsAudioBufferUtil *audio_buffer_util,
     limit = count - (count % 8);
   
 #if defined(AGS_VECTOR_256_FUNCTIONS)
-    AgsVector256Manager *vector_256_manager = ags_vector_256_manager_get_instance();
+    AgsScratchArena *scratch_arena = ags_scratch_arena_get_thread_default();
   
     while(i + 256 <= limit){
       AgsVectorArr *source_arr, *destination_arr;
 
       guint j;
     
-      while(!ags_vector_256_manager_try_acquire_dual(vector_256_manager,
-						     AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE,
-						     &source_arr, &destination_arr)){
-	g_thread_yield();
+      if(!ags_scratch_arena_acquire_dual(scratch_arena,
+					 AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE,
+					 &source_arr, &destination_arr)){
+	break;
       }
 
       ags_audio_buffer_util_fill_v8double_from_s32(NULL,
@@ -8827,10 +8843,10 @@ ags_audio_buffer_util_copy_s32_to_s16(AgsAudioBufferUtil *audio_buffer_util,
 						  destination_arr->vector.vec_double->mem_double, 1,
 						  256);
       
-      ags_vector_256_manager_release(vector_256_manager,
-				     source_arr);
-      ags_vector_256_manager_release(vector_256_manager,
-				     destination_arr);
+      ags_scratch_arena_release(scratch_arena,
+				source_arr);
+      ags_scratch_arena_release(scratch_arena,
+				destination_arr);
 
       destination += (256 * destination_stride);
       source += (256 * source_stride);
@@ -9048,17 +9064,17 @@ ags_audio_buffer_util_copy_s32_to_s24(AgsAudioBufferUtil *audio_buffer_util,
     limit = count - (count % 8);
   
 #if defined(AGS_VECTOR_256_FUNCTIONS)
-    AgsVector256Manager *vector_256_manager = ags_vector_256_manager_get_instance();
+    AgsScratchArena *scratch_arena = ags_scratch_arena_get_thread_default();
   
     while(i + 256 <= limit){
       AgsVectorArr *source_arr, *destination_arr;
 
       guint j;
     
-      while(!ags_vector_256_manager_try_acquire_dual(vector_256_manager,
-						     AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE,
-						     &source_arr, &destination_arr)){
-	g_thread_yield();
+      if(!ags_scratch_arena_acquire_dual(scratch_arena,
+					 AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE,
+					 &source_arr, &destination_arr)){
+	break;
       }
 
       ags_audio_buffer_util_fill_v8double_from_s32(NULL,
@@ -9082,10 +9098,10 @@ ags_audio_buffer_util_copy_s32_to_s24(AgsAudioBufferUtil *audio_buffer_util,
 						  destination_arr->vector.vec_double->mem_double, 1,
 						  256);
       
-      ags_vector_256_manager_release(vector_256_manager,
-				     source_arr);
-      ags_vector_256_manager_release(vector_256_manager,
-				     destination_arr);
+      ags_scratch_arena_release(scratch_arena,
+				source_arr);
+      ags_scratch_arena_release(scratch_arena,
+				destination_arr);
 
       destination += (256 * destination_stride);
       source += (256 * source_stride);
@@ -9301,17 +9317,17 @@ ags_audio_buffer_util_copy_s32_to_s32(AgsAudioBufferUtil *audio_buffer_util,
     limit = count - (count % 8);
   
 #if defined(AGS_VECTOR_256_FUNCTIONS)
-    AgsVector256Manager *vector_256_manager = ags_vector_256_manager_get_instance();
+    AgsScratchArena *scratch_arena = ags_scratch_arena_get_thread_default();
   
     while(i + 256 <= limit){
       AgsVectorArr *source_arr, *destination_arr;
 
       guint j;
     
-      while(!ags_vector_256_manager_try_acquire_dual(vector_256_manager,
-						     AGS_VECTOR_256_SIGNED_32_BIT, AGS_VECTOR_256_SIGNED_32_BIT,
-						     &source_arr, &destination_arr)){
-	g_thread_yield();
+      if(!ags_scratch_arena_acquire_dual(scratch_arena,
+					 AGS_VECTOR_256_SIGNED_32_BIT, AGS_VECTOR_256_SIGNED_32_BIT,
+					 &source_arr, &destination_arr)){
+	break;
       }
 
       ags_audio_buffer_util_fill_v8s32(NULL,
@@ -9333,10 +9349,10 @@ ags_audio_buffer_util_copy_s32_to_s32(AgsAudioBufferUtil *audio_buffer_util,
 					destination_arr->vector.vec_s32->mem_s32, 1,
 					256);
 
-      ags_vector_256_manager_release(vector_256_manager,
-				     source_arr);
-      ags_vector_256_manager_release(vector_256_manager,
-				     destination_arr);
+      ags_scratch_arena_release(scratch_arena,
+				source_arr);
+      ags_scratch_arena_release(scratch_arena,
+				destination_arr);
 
       destination += (256 * destination_stride);
       source += (256 * source_stride);
@@ -9543,17 +9559,17 @@ ags_audio_buffer_util_copy_s32_to_s64(AgsAudioBufferUtil *audio_buffer_util,
     limit = count - (count % 8);
   
 #if defined(AGS_VECTOR_256_FUNCTIONS)
-    AgsVector256Manager *vector_256_manager = ags_vector_256_manager_get_instance();
+    AgsScratchArena *scratch_arena = ags_scratch_arena_get_thread_default();
   
     while(i + 256 <= limit){
       AgsVectorArr *source_arr, *destination_arr;
 
       guint j;
     
-      while(!ags_vector_256_manager_try_acquire_dual(vector_256_manager,
-						     AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE,
-						     &source_arr, &destination_arr)){
-	g_thread_yield();
+      if(!ags_scratch_arena_acquire_dual(scratch_arena,
+					 AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE,
+					 &source_arr, &destination_arr)){
+	break;
       }
 
       ags_audio_buffer_util_fill_v8double_from_s32(NULL,
@@ -9577,10 +9593,10 @@ ags_audio_buffer_util_copy_s32_to_s64(AgsAudioBufferUtil *audio_buffer_util,
 						  destination_arr->vector.vec_double->mem_double, 1,
 						  256);
       
-      ags_vector_256_manager_release(vector_256_manager,
-				     source_arr);
-      ags_vector_256_manager_release(vector_256_manager,
-				     destination_arr);
+      ags_scratch_arena_release(scratch_arena,
+				source_arr);
+      ags_scratch_arena_release(scratch_arena,
+				destination_arr);
 
       destination += (256 * destination_stride);
       source += (256 * source_stride);
@@ -9799,17 +9815,17 @@ ags_audio_buffer_util_copy_s32_to_float(AgsAudioBufferUtil *audio_buffer_util,
     limit = count - (count % 8);
   
 #if defined(AGS_VECTOR_256_FUNCTIONS)
-    AgsVector256Manager *vector_256_manager = ags_vector_256_manager_get_instance();
+    AgsScratchArena *scratch_arena = ags_scratch_arena_get_thread_default();
   
     while(i + 256 <= limit){
       AgsVectorArr *source_arr, *destination_arr;
 
       guint j;
     
-      while(!ags_vector_256_manager_try_acquire_dual(vector_256_manager,
-						     AGS_VECTOR_256_FLOAT, AGS_VECTOR_256_FLOAT,
-						     &source_arr, &destination_arr)){
-	g_thread_yield();
+      if(!ags_scratch_arena_acquire_dual(scratch_arena,
+					 AGS_VECTOR_256_FLOAT, AGS_VECTOR_256_FLOAT,
+					 &source_arr, &destination_arr)){
+	break;
       }
 
       ags_audio_buffer_util_fill_v8float_from_s32(NULL,
@@ -9833,10 +9849,10 @@ ags_audio_buffer_util_copy_s32_to_float(AgsAudioBufferUtil *audio_buffer_util,
 					  destination_arr->vector.vec_float->mem_float, 1,
 					  256);
       
-      ags_vector_256_manager_release(vector_256_manager,
-				     source_arr);
-      ags_vector_256_manager_release(vector_256_manager,
-				     destination_arr);
+      ags_scratch_arena_release(scratch_arena,
+				source_arr);
+      ags_scratch_arena_release(scratch_arena,
+				destination_arr);
 
       destination += (256 * destination_stride);
       source += (256 * source_stride);
@@ -10055,17 +10071,17 @@ ags_audio_buffer_util_copy_s32_to_double(AgsAudioBufferUtil *audio_buffer_util,
     limit = count - (count % 8);
   
 #if defined(AGS_VECTOR_256_FUNCTIONS)
-    AgsVector256Manager *vector_256_manager = ags_vector_256_manager_get_instance();
+    AgsScratchArena *scratch_arena = ags_scratch_arena_get_thread_default();
   
     while(i + 256 <= limit){
       AgsVectorArr *source_arr, *destination_arr;
 
       guint j;
     
-      while(!ags_vector_256_manager_try_acquire_dual(vector_256_manager,
-						     AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE,
-						     &source_arr, &destination_arr)){
-	g_thread_yield();
+      if(!ags_scratch_arena_acquire_dual(scratch_arena,
+					 AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE,
+					 &source_arr, &destination_arr)){
+	break;
       }
 
       ags_audio_buffer_util_fill_v8double_from_s32(NULL,
@@ -10089,10 +10105,10 @@ ags_audio_buffer_util_copy_s32_to_double(AgsAudioBufferUtil *audio_buffer_util,
 					  destination_arr->vector.vec_double->mem_double, 1,
 					  256);
       
-      ags_vector_256_manager_release(vector_256_manager,
-				     source_arr);
-      ags_vector_256_manager_release(vector_256_manager,
-				     destination_arr);
+      ags_scratch_arena_release(scratch_arena,
+				source_arr);
+      ags_scratch_arena_release(scratch_arena,
+				destination_arr);
 
       destination += (256 * destination_stride);
       source += (256 * source_stride);
@@ -10310,17 +10326,17 @@ ags_audio_buffer_util_copy_s64_to_s8(AgsAudioBufferUtil *audio_buffer_util,
     limit = count - (count % 8);
   
 #if defined(AGS_VECTOR_256_FUNCTIONS)
-    AgsVector256Manager *vector_256_manager = ags_vector_256_manager_get_instance();
+    AgsScratchArena *scratch_arena = ags_scratch_arena_get_thread_default();
   
     while(i + 256 <= limit){
       AgsVectorArr *source_arr, *destination_arr;
 
       guint j;
     
-      while(!ags_vector_256_manager_try_acquire_dual(vector_256_manager,
-						     AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE,
-						     &source_arr, &destination_arr)){
-	g_thread_yield();
+      if(!ags_scratch_arena_acquire_dual(scratch_arena,
+					 AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE,
+					 &source_arr, &destination_arr)){
+	break;
       }
 
       ags_audio_buffer_util_fill_v8double_from_s64(NULL,
@@ -10344,10 +10360,10 @@ ags_audio_buffer_util_copy_s64_to_s8(AgsAudioBufferUtil *audio_buffer_util,
 						 destination_arr->vector.vec_double->mem_double, 1,
 						 256);
       
-      ags_vector_256_manager_release(vector_256_manager,
-				     source_arr);
-      ags_vector_256_manager_release(vector_256_manager,
-				     destination_arr);
+      ags_scratch_arena_release(scratch_arena,
+				source_arr);
+      ags_scratch_arena_release(scratch_arena,
+				destination_arr);
 
       destination += (256 * destination_stride);
       source += (256 * source_stride);
@@ -10565,17 +10581,17 @@ ags_audio_buffer_util_copy_s64_to_s16(AgsAudioBufferUtil *audio_buffer_util,
     limit = count - (count % 8);
   
 #if defined(AGS_VECTOR_256_FUNCTIONS)
-    AgsVector256Manager *vector_256_manager = ags_vector_256_manager_get_instance();
+    AgsScratchArena *scratch_arena = ags_scratch_arena_get_thread_default();
   
     while(i + 256 <= limit){
       AgsVectorArr *source_arr, *destination_arr;
 
       guint j;
     
-      while(!ags_vector_256_manager_try_acquire_dual(vector_256_manager,
-						     AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE,
-						     &source_arr, &destination_arr)){
-	g_thread_yield();
+      if(!ags_scratch_arena_acquire_dual(scratch_arena,
+					 AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE,
+					 &source_arr, &destination_arr)){
+	break;
       }
 
       ags_audio_buffer_util_fill_v8double_from_s64(NULL,
@@ -10599,10 +10615,10 @@ ags_audio_buffer_util_copy_s64_to_s16(AgsAudioBufferUtil *audio_buffer_util,
 						  destination_arr->vector.vec_double->mem_double, 1,
 						  256);
       
-      ags_vector_256_manager_release(vector_256_manager,
-				     source_arr);
-      ags_vector_256_manager_release(vector_256_manager,
-				     destination_arr);
+      ags_scratch_arena_release(scratch_arena,
+				source_arr);
+      ags_scratch_arena_release(scratch_arena,
+				destination_arr);
 
       destination += (256 * destination_stride);
       source += (256 * source_stride);
@@ -10820,17 +10836,17 @@ ags_audio_buffer_util_copy_s64_to_s24(AgsAudioBufferUtil *audio_buffer_util,
     limit = count - (count % 8);
   
 #if defined(AGS_VECTOR_256_FUNCTIONS)
-    AgsVector256Manager *vector_256_manager = ags_vector_256_manager_get_instance();
+    AgsScratchArena *scratch_arena = ags_scratch_arena_get_thread_default();
   
     while(i + 256 <= limit){
       AgsVectorArr *source_arr, *destination_arr;
 
       guint j;
     
-      while(!ags_vector_256_manager_try_acquire_dual(vector_256_manager,
-						     AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE,
-						     &source_arr, &destination_arr)){
-	g_thread_yield();
+      if(!ags_scratch_arena_acquire_dual(scratch_arena,
+					 AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE,
+					 &source_arr, &destination_arr)){
+	break;
       }
 
       ags_audio_buffer_util_fill_v8double_from_s64(NULL,
@@ -10854,10 +10870,10 @@ ags_audio_buffer_util_copy_s64_to_s24(AgsAudioBufferUtil *audio_buffer_util,
 						  destination_arr->vector.vec_double->mem_double, 1,
 						  256);
       
-      ags_vector_256_manager_release(vector_256_manager,
-				     source_arr);
-      ags_vector_256_manager_release(vector_256_manager,
-				     destination_arr);
+      ags_scratch_arena_release(scratch_arena,
+				source_arr);
+      ags_scratch_arena_release(scratch_arena,
+				destination_arr);
 
       destination += (256 * destination_stride);
       source += (256 * source_stride);
@@ -11075,17 +11091,17 @@ ags_audio_buffer_util_copy_s64_to_s32(AgsAudioBufferUtil *audio_buffer_util,
     limit = count - (count % 8);
   
 #if defined(AGS_VECTOR_256_FUNCTIONS)
-    AgsVector256Manager *vector_256_manager = ags_vector_256_manager_get_instance();
+    AgsScratchArena *scratch_arena = ags_scratch_arena_get_thread_default();
   
     while(i + 256 <= limit){
       AgsVectorArr *source_arr, *destination_arr;
 
       guint j;
     
-      while(!ags_vector_256_manager_try_acquire_dual(vector_256_manager,
-						     AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE,
-						     &source_arr, &destination_arr)){
-	g_thread_yield();
+      if(!ags_scratch_arena_acquire_dual(scratch_arena,
+					 AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE,
+					 &source_arr, &destination_arr)){
+	break;
       }
 
       ags_audio_buffer_util_fill_v8double_from_s64(NULL,
@@ -11109,10 +11125,10 @@ ags_audio_buffer_util_copy_s64_to_s32(AgsAudioBufferUtil *audio_buffer_util,
 						  destination_arr->vector.vec_double->mem_double, 1,
 						  256);
       
-      ags_vector_256_manager_release(vector_256_manager,
-				     source_arr);
-      ags_vector_256_manager_release(vector_256_manager,
-				     destination_arr);
+      ags_scratch_arena_release(scratch_arena,
+				source_arr);
+      ags_scratch_arena_release(scratch_arena,
+				destination_arr);
 
       destination += (256 * destination_stride);
       source += (256 * source_stride);
@@ -11360,17 +11376,17 @@ ags_audio_buffer_util_copy_s64_to_s64(AgsAudioBufferUtil *audio_buffer_util,
     limit = count - (count % 8);
   
 #if defined(AGS_VECTOR_256_FUNCTIONS)
-    AgsVector256Manager *vector_256_manager = ags_vector_256_manager_get_instance();
+    AgsScratchArena *scratch_arena = ags_scratch_arena_get_thread_default();
   
     while(i + 256 <= limit){
       AgsVectorArr *source_arr, *destination_arr;
 
       guint j;
     
-      while(!ags_vector_256_manager_try_acquire_dual(vector_256_manager,
-						     AGS_VECTOR_256_SIGNED_64_BIT, AGS_VECTOR_256_SIGNED_64_BIT,
-						     &source_arr, &destination_arr)){
-	g_thread_yield();
+      if(!ags_scratch_arena_acquire_dual(scratch_arena,
+					 AGS_VECTOR_256_SIGNED_64_BIT, AGS_VECTOR_256_SIGNED_64_BIT,
+					 &source_arr, &destination_arr)){
+	break;
       }
 
       ags_audio_buffer_util_fill_v8s64(NULL,
@@ -11392,10 +11408,10 @@ ags_audio_buffer_util_copy_s64_to_s64(AgsAudioBufferUtil *audio_buffer_util,
 					destination_arr->vector.vec_s64->mem_s64, 1,
 					256);
 
-      ags_vector_256_manager_release(vector_256_manager,
-				     source_arr);
-      ags_vector_256_manager_release(vector_256_manager,
-				     destination_arr);
+      ags_scratch_arena_release(scratch_arena,
+				source_arr);
+      ags_scratch_arena_release(scratch_arena,
+				destination_arr);
 
       destination += (256 * destination_stride);
       source += (256 * source_stride);
@@ -11574,17 +11590,17 @@ ags_audio_buffer_util_copy_s64_to_float(AgsAudioBufferUtil *audio_buffer_util,
     limit = count - (count % 8);
   
 #if defined(AGS_VECTOR_256_FUNCTIONS)
-    AgsVector256Manager *vector_256_manager = ags_vector_256_manager_get_instance();
+    AgsScratchArena *scratch_arena = ags_scratch_arena_get_thread_default();
   
     while(i + 256 <= limit){
       AgsVectorArr *source_arr, *destination_arr;
 
       guint j;
     
-      while(!ags_vector_256_manager_try_acquire_dual(vector_256_manager,
-						     AGS_VECTOR_256_FLOAT, AGS_VECTOR_256_FLOAT,
-						     &source_arr, &destination_arr)){
-	g_thread_yield();
+      if(!ags_scratch_arena_acquire_dual(scratch_arena,
+					 AGS_VECTOR_256_FLOAT, AGS_VECTOR_256_FLOAT,
+					 &source_arr, &destination_arr)){
+	break;
       }
 
       ags_audio_buffer_util_fill_v8float_from_s64(NULL,
@@ -11608,10 +11624,10 @@ ags_audio_buffer_util_copy_s64_to_float(AgsAudioBufferUtil *audio_buffer_util,
 					  destination_arr->vector.vec_float->mem_float, 1,
 					  256);
       
-      ags_vector_256_manager_release(vector_256_manager,
-				     source_arr);
-      ags_vector_256_manager_release(vector_256_manager,
-				     destination_arr);
+      ags_scratch_arena_release(scratch_arena,
+				source_arr);
+      ags_scratch_arena_release(scratch_arena,
+				destination_arr);
 
       destination += (256 * destination_stride);
       source += (256 * source_stride);
@@ -11830,17 +11846,17 @@ ags_audio_buffer_util_copy_s64_to_double(AgsAudioBufferUtil *audio_buffer_util,
     limit = count - (count % 8);
   
 #if defined(AGS_VECTOR_256_FUNCTIONS)
-    AgsVector256Manager *vector_256_manager = ags_vector_256_manager_get_instance();
+    AgsScratchArena *scratch_arena = ags_scratch_arena_get_thread_default();
   
     while(i + 256 <= limit){
       AgsVectorArr *source_arr, *destination_arr;
 
       guint j;
     
-      while(!ags_vector_256_manager_try_acquire_dual(vector_256_manager,
-						     AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE,
-						     &source_arr, &destination_arr)){
-	g_thread_yield();
+      if(!ags_scratch_arena_acquire_dual(scratch_arena,
+					 AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE,
+					 &source_arr, &destination_arr)){
+	break;
       }
 
       ags_audio_buffer_util_fill_v8double_from_s64(NULL,
@@ -11864,10 +11880,10 @@ ags_audio_buffer_util_copy_s64_to_double(AgsAudioBufferUtil *audio_buffer_util,
 					  destination_arr->vector.vec_double->mem_double, 1,
 					  256);
       
-      ags_vector_256_manager_release(vector_256_manager,
-				     source_arr);
-      ags_vector_256_manager_release(vector_256_manager,
-				     destination_arr);
+      ags_scratch_arena_release(scratch_arena,
+				source_arr);
+      ags_scratch_arena_release(scratch_arena,
+				destination_arr);
 
       destination += (256 * destination_stride);
       source += (256 * source_stride);
@@ -12085,17 +12101,17 @@ ags_audio_buffer_util_copy_float_to_s8(AgsAudioBufferUtil *audio_buffer_util,
     limit = count - (count % 8);
   
 #if defined(AGS_VECTOR_256_FUNCTIONS)
-    AgsVector256Manager *vector_256_manager = ags_vector_256_manager_get_instance();
+    AgsScratchArena *scratch_arena = ags_scratch_arena_get_thread_default();
   
     while(i + 256 <= limit){
       AgsVectorArr *source_arr, *destination_arr;
 
       guint j;
     
-      while(!ags_vector_256_manager_try_acquire_dual(vector_256_manager,
-						     AGS_VECTOR_256_FLOAT, AGS_VECTOR_256_FLOAT,
-						     &source_arr, &destination_arr)){
-	g_thread_yield();
+      if(!ags_scratch_arena_acquire_dual(scratch_arena,
+					 AGS_VECTOR_256_FLOAT, AGS_VECTOR_256_FLOAT,
+					 &source_arr, &destination_arr)){
+	break;
       }
 
       ags_audio_buffer_util_fill_v8float(NULL,
@@ -12119,10 +12135,10 @@ ags_audio_buffer_util_copy_float_to_s8(AgsAudioBufferUtil *audio_buffer_util,
 						destination_arr->vector.vec_float->mem_float, 1,
 						256);
       
-      ags_vector_256_manager_release(vector_256_manager,
-				     source_arr);
-      ags_vector_256_manager_release(vector_256_manager,
-				     destination_arr);
+      ags_scratch_arena_release(scratch_arena,
+				source_arr);
+      ags_scratch_arena_release(scratch_arena,
+				destination_arr);
 
       destination += (256 * destination_stride);
       source += (256 * source_stride);
@@ -12340,17 +12356,17 @@ ags_audio_buffer_util_copy_float_to_s16(AgsAudioBufferUtil *audio_buffer_util,
     limit = count - (count % 8);
   
 #if defined(AGS_VECTOR_256_FUNCTIONS)
-    AgsVector256Manager *vector_256_manager = ags_vector_256_manager_get_instance();
+    AgsScratchArena *scratch_arena = ags_scratch_arena_get_thread_default();
   
     while(i + 256 <= limit){
       AgsVectorArr *source_arr, *destination_arr;
 
       guint j;
     
-      while(!ags_vector_256_manager_try_acquire_dual(vector_256_manager,
-						     AGS_VECTOR_256_FLOAT, AGS_VECTOR_256_FLOAT,
-						     &source_arr, &destination_arr)){
-	g_thread_yield();
+      if(!ags_scratch_arena_acquire_dual(scratch_arena,
+					 AGS_VECTOR_256_FLOAT, AGS_VECTOR_256_FLOAT,
+					 &source_arr, &destination_arr)){
+	break;
       }
 
       ags_audio_buffer_util_fill_v8float(NULL,
@@ -12374,10 +12390,10 @@ ags_audio_buffer_util_copy_float_to_s16(AgsAudioBufferUtil *audio_buffer_util,
 						 destination_arr->vector.vec_float->mem_float, 1,
 						 256);
       
-      ags_vector_256_manager_release(vector_256_manager,
-				     source_arr);
-      ags_vector_256_manager_release(vector_256_manager,
-				     destination_arr);
+      ags_scratch_arena_release(scratch_arena,
+				source_arr);
+      ags_scratch_arena_release(scratch_arena,
+				destination_arr);
 
       destination += (256 * destination_stride);
       source += (256 * source_stride);
@@ -12595,17 +12611,17 @@ ags_audio_buffer_util_copy_float_to_s24(AgsAudioBufferUtil *audio_buffer_util,
     limit = count - (count % 8);
   
 #if defined(AGS_VECTOR_256_FUNCTIONS)
-    AgsVector256Manager *vector_256_manager = ags_vector_256_manager_get_instance();
+    AgsScratchArena *scratch_arena = ags_scratch_arena_get_thread_default();
   
     while(i + 256 <= limit){
       AgsVectorArr *source_arr, *destination_arr;
 
       guint j;
     
-      while(!ags_vector_256_manager_try_acquire_dual(vector_256_manager,
-						     AGS_VECTOR_256_FLOAT, AGS_VECTOR_256_FLOAT,
-						     &source_arr, &destination_arr)){
-	g_thread_yield();
+      if(!ags_scratch_arena_acquire_dual(scratch_arena,
+					 AGS_VECTOR_256_FLOAT, AGS_VECTOR_256_FLOAT,
+					 &source_arr, &destination_arr)){
+	break;
       }
 
       ags_audio_buffer_util_fill_v8float(NULL,
@@ -12629,10 +12645,10 @@ ags_audio_buffer_util_copy_float_to_s24(AgsAudioBufferUtil *audio_buffer_util,
 						 destination_arr->vector.vec_float->mem_float, 1,
 						 256);
       
-      ags_vector_256_manager_release(vector_256_manager,
-				     source_arr);
-      ags_vector_256_manager_release(vector_256_manager,
-				     destination_arr);
+      ags_scratch_arena_release(scratch_arena,
+				source_arr);
+      ags_scratch_arena_release(scratch_arena,
+				destination_arr);
 
       destination += (256 * destination_stride);
       source += (256 * source_stride);
@@ -12850,17 +12866,17 @@ ags_audio_buffer_util_copy_float_to_s32(AgsAudioBufferUtil *audio_buffer_util,
     limit = count - (count % 8);
   
 #if defined(AGS_VECTOR_256_FUNCTIONS)
-    AgsVector256Manager *vector_256_manager = ags_vector_256_manager_get_instance();
+    AgsScratchArena *scratch_arena = ags_scratch_arena_get_thread_default();
   
     while(i + 256 <= limit){
       AgsVectorArr *source_arr, *destination_arr;
 
       guint j;
     
-      while(!ags_vector_256_manager_try_acquire_dual(vector_256_manager,
-						     AGS_VECTOR_256_FLOAT, AGS_VECTOR_256_FLOAT,
-						     &source_arr, &destination_arr)){
-	g_thread_yield();
+      if(!ags_scratch_arena_acquire_dual(scratch_arena,
+					 AGS_VECTOR_256_FLOAT, AGS_VECTOR_256_FLOAT,
+					 &source_arr, &destination_arr)){
+	break;
       }
 
       ags_audio_buffer_util_fill_v8float(NULL,
@@ -12884,10 +12900,10 @@ ags_audio_buffer_util_copy_float_to_s32(AgsAudioBufferUtil *audio_buffer_util,
 						 destination_arr->vector.vec_float->mem_float, 1,
 						 256);
       
-      ags_vector_256_manager_release(vector_256_manager,
-				     source_arr);
-      ags_vector_256_manager_release(vector_256_manager,
-				     destination_arr);
+      ags_scratch_arena_release(scratch_arena,
+				source_arr);
+      ags_scratch_arena_release(scratch_arena,
+				destination_arr);
 
       destination += (256 * destination_stride);
       source += (256 * source_stride);
@@ -13105,17 +13121,17 @@ ags_audio_buffer_util_copy_float_to_s64(AgsAudioBufferUtil *audio_buffer_util,
     limit = count - (count % 8);
   
 #if defined(AGS_VECTOR_256_FUNCTIONS)
-    AgsVector256Manager *vector_256_manager = ags_vector_256_manager_get_instance();
+    AgsScratchArena *scratch_arena = ags_scratch_arena_get_thread_default();
   
     while(i + 256 <= limit){
       AgsVectorArr *source_arr, *destination_arr;
 
       guint j;
     
-      while(!ags_vector_256_manager_try_acquire_dual(vector_256_manager,
-						     AGS_VECTOR_256_FLOAT, AGS_VECTOR_256_FLOAT,
-						     &source_arr, &destination_arr)){
-	g_thread_yield();
+      if(!ags_scratch_arena_acquire_dual(scratch_arena,
+					 AGS_VECTOR_256_FLOAT, AGS_VECTOR_256_FLOAT,
+					 &source_arr, &destination_arr)){
+	break;
       }
 
       ags_audio_buffer_util_fill_v8float(NULL,
@@ -13139,10 +13155,10 @@ ags_audio_buffer_util_copy_float_to_s64(AgsAudioBufferUtil *audio_buffer_util,
 						 destination_arr->vector.vec_float->mem_float, 1,
 						 256);
       
-      ags_vector_256_manager_release(vector_256_manager,
-				     source_arr);
-      ags_vector_256_manager_release(vector_256_manager,
-				     destination_arr);
+      ags_scratch_arena_release(scratch_arena,
+				source_arr);
+      ags_scratch_arena_release(scratch_arena,
+				destination_arr);
 
       destination += (256 * destination_stride);
       source += (256 * source_stride);
@@ -13350,6 +13366,15 @@ ags_audio_buffer_util_copy_float_to_float(AgsAudioBufferUtil *audio_buffer_util,
     return;
   }
 
+  /* contiguous buffers are dispatched to the CPU specific kernels */
+  if(destination_stride == 1 &&
+     source_stride == 1){
+    ags_audio_buffer_kernel_get_default()->copy_float_to_float(destination, source,
+							       count);
+
+    return;
+  }
+
   i = 0;
   
 #if defined(AGS_VECTORIZED_BUILTIN_FUNCTIONS)
@@ -13358,17 +13383,17 @@ ags_audio_buffer_util_copy_float_to_float(AgsAudioBufferUtil *audio_buffer_util,
     limit = count - (count % 8);
   
 #if defined(AGS_VECTOR_256_FUNCTIONS)
-    AgsVector256Manager *vector_256_manager = ags_vector_256_manager_get_instance();
+    AgsScratchArena *scratch_arena = ags_scratch_arena_get_thread_default();
   
     while(i + 256 <= limit){
       AgsVectorArr *source_arr, *destination_arr;
 
       guint j;
     
-      while(!ags_vector_256_manager_try_acquire_dual(vector_256_manager,
-						     AGS_VECTOR_256_FLOAT, AGS_VECTOR_256_FLOAT,
-						     &source_arr, &destination_arr)){
-	g_thread_yield();
+      if(!ags_scratch_arena_acquire_dual(scratch_arena,
+					 AGS_VECTOR_256_FLOAT, AGS_VECTOR_256_FLOAT,
+					 &source_arr, &destination_arr)){
+	break;
       }
 
       ags_audio_buffer_util_fill_v8float(NULL,
@@ -13390,10 +13415,10 @@ ags_audio_buffer_util_copy_float_to_float(AgsAudioBufferUtil *audio_buffer_util,
 					  destination_arr->vector.vec_float->mem_float, 1,
 					  256);
 
-      ags_vector_256_manager_release(vector_256_manager,
-				     source_arr);
-      ags_vector_256_manager_release(vector_256_manager,
-				     destination_arr);
+      ags_scratch_arena_release(scratch_arena,
+				source_arr);
+      ags_scratch_arena_release(scratch_arena,
+				destination_arr);
 
       destination += (256 * destination_stride);
       source += (256 * source_stride);
@@ -13590,6 +13615,15 @@ ags_audio_buffer_util_copy_float_to_double(AgsAudioBufferUtil *audio_buffer_util
     return;
   }
 
+  /* contiguous buffers are dispatched to the CPU specific kernels */
+  if(destination_stride == 1 &&
+     source_stride == 1){
+    ags_audio_buffer_kernel_get_default()->copy_float_to_double(destination, source,
+								count);
+
+    return;
+  }
+
   i = 0;
   
 #if defined(AGS_VECTORIZED_BUILTIN_FUNCTIONS)
@@ -13598,17 +13632,17 @@ ags_audio_buffer_util_copy_float_to_double(AgsAudioBufferUtil *audio_buffer_util
     limit = count - (count % 8);
   
 #if defined(AGS_VECTOR_256_FUNCTIONS)
-    AgsVector256Manager *vector_256_manager = ags_vector_256_manager_get_instance();
+    AgsScratchArena *scratch_arena = ags_scratch_arena_get_thread_default();
   
     while(i + 256 <= limit){
       AgsVectorArr *source_arr, *destination_arr;
 
       guint j;
     
-      while(!ags_vector_256_manager_try_acquire_dual(vector_256_manager,
-						     AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE,
-						     &source_arr, &destination_arr)){
-	g_thread_yield();
+      if(!ags_scratch_arena_acquire_dual(scratch_arena,
+					 AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE,
+					 &source_arr, &destination_arr)){
+	break;
       }
 
       ags_audio_buffer_util_fill_v8double_from_float(NULL,
@@ -13630,10 +13664,10 @@ ags_audio_buffer_util_copy_float_to_double(AgsAudioBufferUtil *audio_buffer_util
 					   destination_arr->vector.vec_double->mem_double, 1,
 					   256);
 
-      ags_vector_256_manager_release(vector_256_manager,
-				     source_arr);
-      ags_vector_256_manager_release(vector_256_manager,
-				     destination_arr);
+      ags_scratch_arena_release(scratch_arena,
+				source_arr);
+      ags_scratch_arena_release(scratch_arena,
+				destination_arr);
 
       destination += (256 * destination_stride);
       source += (256 * source_stride);
@@ -13840,17 +13874,17 @@ ags_audio_buffer_util_copy_double_to_s8(AgsAudioBufferUtil *audio_buffer_util,
     limit = count - (count % 8);
   
 #if defined(AGS_VECTOR_256_FUNCTIONS)
-    AgsVector256Manager *vector_256_manager = ags_vector_256_manager_get_instance();
+    AgsScratchArena *scratch_arena = ags_scratch_arena_get_thread_default();
   
     while(i + 256 <= limit){
       AgsVectorArr *source_arr, *destination_arr;
 
       guint j;
     
-      while(!ags_vector_256_manager_try_acquire_dual(vector_256_manager,
-						     AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE,
-						     &source_arr, &destination_arr)){
-	g_thread_yield();
+      if(!ags_scratch_arena_acquire_dual(scratch_arena,
+					 AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE,
+					 &source_arr, &destination_arr)){
+	break;
       }
 
       ags_audio_buffer_util_fill_v8double(NULL,
@@ -13874,10 +13908,10 @@ ags_audio_buffer_util_copy_double_to_s8(AgsAudioBufferUtil *audio_buffer_util,
 						 destination_arr->vector.vec_double->mem_double, 1,
 						 256);
       
-      ags_vector_256_manager_release(vector_256_manager,
-				     source_arr);
-      ags_vector_256_manager_release(vector_256_manager,
-				     destination_arr);
+      ags_scratch_arena_release(scratch_arena,
+				source_arr);
+      ags_scratch_arena_release(scratch_arena,
+				destination_arr);
 
       destination += (256 * destination_stride);
       source += (256 * source_stride);
@@ -14095,17 +14129,17 @@ ags_audio_buffer_util_copy_double_to_s16(AgsAudioBufferUtil *audio_buffer_util,
     limit = count - (count % 8);
   
 #if defined(AGS_VECTOR_256_FUNCTIONS)
-    AgsVector256Manager *vector_256_manager = ags_vector_256_manager_get_instance();
+    AgsScratchArena *scratch_arena = ags_scratch_arena_get_thread_default();
   
     while(i + 256 <= limit){
       AgsVectorArr *source_arr, *destination_arr;
 
       guint j;
     
-      while(!ags_vector_256_manager_try_acquire_dual(vector_256_manager,
-						     AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE,
-						     &source_arr, &destination_arr)){
-	g_thread_yield();
+      if(!ags_scratch_arena_acquire_dual(scratch_arena,
+					 AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE,
+					 &source_arr, &destination_arr)){
+	break;
       }
 
       ags_audio_buffer_util_fill_v8double(NULL,
@@ -14129,10 +14163,10 @@ ags_audio_buffer_util_copy_double_to_s16(AgsAudioBufferUtil *audio_buffer_util,
 						 destination_arr->vector.vec_double->mem_double, 1,
 						 256);
       
-      ags_vector_256_manager_release(vector_256_manager,
-				     source_arr);
-      ags_vector_256_manager_release(vector_256_manager,
-				     destination_arr);
+      ags_scratch_arena_release(scratch_arena,
+				source_arr);
+      ags_scratch_arena_release(scratch_arena,
+				destination_arr);
 
       destination += (256 * destination_stride);
       source += (256 * source_stride);
@@ -14350,17 +14384,17 @@ ags_audio_buffer_util_copy_double_to_s24(AgsAudioBufferUtil *audio_buffer_util,
     limit = count - (count % 8);
   
 #if defined(AGS_VECTOR_256_FUNCTIONS)
-    AgsVector256Manager *vector_256_manager = ags_vector_256_manager_get_instance();
+    AgsScratchArena *scratch_arena = ags_scratch_arena_get_thread_default();
   
     while(i + 256 <= limit){
       AgsVectorArr *source_arr, *destination_arr;
 
       guint j;
     
-      while(!ags_vector_256_manager_try_acquire_dual(vector_256_manager,
-						     AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE,
-						     &source_arr, &destination_arr)){
-	g_thread_yield();
+      if(!ags_scratch_arena_acquire_dual(scratch_arena,
+					 AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE,
+					 &source_arr, &destination_arr)){
+	break;
       }
 
       ags_audio_buffer_util_fill_v8double(NULL,
@@ -14384,10 +14418,10 @@ ags_audio_buffer_util_copy_double_to_s24(AgsAudioBufferUtil *audio_buffer_util,
 						  destination_arr->vector.vec_double->mem_double, 1,
 						  256);
       
-      ags_vector_256_manager_release(vector_256_manager,
-				     source_arr);
-      ags_vector_256_manager_release(vector_256_manager,
-				     destination_arr);
+      ags_scratch_arena_release(scratch_arena,
+				source_arr);
+      ags_scratch_arena_release(scratch_arena,
+				destination_arr);
 
       destination += (256 * destination_stride);
       source += (256 * source_stride);
@@ -14605,17 +14639,17 @@ ags_audio_buffer_util_copy_double_to_s32(AgsAudioBufferUtil *audio_buffer_util,
     limit = count - (count % 8);
   
 #if defined(AGS_VECTOR_256_FUNCTIONS)
-    AgsVector256Manager *vector_256_manager = ags_vector_256_manager_get_instance();
+    AgsScratchArena *scratch_arena = ags_scratch_arena_get_thread_default();
   
     while(i + 256 <= limit){
       AgsVectorArr *source_arr, *destination_arr;
 
       guint j;
     
-      while(!ags_vector_256_manager_try_acquire_dual(vector_256_manager,
-						     AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE,
-						     &source_arr, &destination_arr)){
-	g_thread_yield();
+      if(!ags_scratch_arena_acquire_dual(scratch_arena,
+					 AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE,
+					 &source_arr, &destination_arr)){
+	break;
       }
 
       ags_audio_buffer_util_fill_v8double(NULL,
@@ -14639,10 +14673,10 @@ ags_audio_buffer_util_copy_double_to_s32(AgsAudioBufferUtil *audio_buffer_util,
 						  destination_arr->vector.vec_double->mem_double, 1,
 						  256);
       
-      ags_vector_256_manager_release(vector_256_manager,
-				     source_arr);
-      ags_vector_256_manager_release(vector_256_manager,
-				     destination_arr);
+      ags_scratch_arena_release(scratch_arena,
+				source_arr);
+      ags_scratch_arena_release(scratch_arena,
+				destination_arr);
 
       destination += (256 * destination_stride);
       source += (256 * source_stride);
@@ -14860,17 +14894,17 @@ ags_audio_buffer_util_copy_double_to_s64(AgsAudioBufferUtil *audio_buffer_util,
     limit = count - (count % 8);
   
 #if defined(AGS_VECTOR_256_FUNCTIONS)
-    AgsVector256Manager *vector_256_manager = ags_vector_256_manager_get_instance();
+    AgsScratchArena *scratch_arena = ags_scratch_arena_get_thread_default();
   
     while(i + 256 <= limit){
       AgsVectorArr *source_arr, *destination_arr;
 
       guint j;
     
-      while(!ags_vector_256_manager_try_acquire_dual(vector_256_manager,
-						     AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE,
-						     &source_arr, &destination_arr)){
-	g_thread_yield();
+      if(!ags_scratch_arena_acquire_dual(scratch_arena,
+					 AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE,
+					 &source_arr, &destination_arr)){
+	break;
       }
 
       ags_audio_buffer_util_fill_v8double(NULL,
@@ -14894,10 +14928,10 @@ ags_audio_buffer_util_copy_double_to_s64(AgsAudioBufferUtil *audio_buffer_util,
 						  destination_arr->vector.vec_double->mem_double, 1,
 						  256);
       
-      ags_vector_256_manager_release(vector_256_manager,
-				     source_arr);
-      ags_vector_256_manager_release(vector_256_manager,
-				     destination_arr);
+      ags_scratch_arena_release(scratch_arena,
+				source_arr);
+      ags_scratch_arena_release(scratch_arena,
+				destination_arr);
 
       destination += (256 * destination_stride);
       source += (256 * source_stride);
@@ -15105,6 +15139,15 @@ ags_audio_buffer_util_copy_double_to_float(AgsAudioBufferUtil *audio_buffer_util
     return;
   }
 
+  /* contiguous buffers are dispatched to the CPU specific kernels */
+  if(destination_stride == 1 &&
+     source_stride == 1){
+    ags_audio_buffer_kernel_get_default()->copy_double_to_float(destination, source,
+								count);
+
+    return;
+  }
+
   i = 0;
   
 #if defined(AGS_VECTORIZED_BUILTIN_FUNCTIONS)
@@ -15113,17 +15156,17 @@ ags_audio_buffer_util_copy_double_to_float(AgsAudioBufferUtil *audio_buffer_util
     limit = count - (count % 8);
   
 #if defined(AGS_VECTOR_256_FUNCTIONS)
-    AgsVector256Manager *vector_256_manager = ags_vector_256_manager_get_instance();
+    AgsScratchArena *scratch_arena = ags_scratch_arena_get_thread_default();
   
     while(i + 256 <= limit){
       AgsVectorArr *source_arr, *destination_arr;
 
       guint j;
     
-      while(!ags_vector_256_manager_try_acquire_dual(vector_256_manager,
-						     AGS_VECTOR_256_FLOAT, AGS_VECTOR_256_FLOAT,
-						     &source_arr, &destination_arr)){
-	g_thread_yield();
+      if(!ags_scratch_arena_acquire_dual(scratch_arena,
+					 AGS_VECTOR_256_FLOAT, AGS_VECTOR_256_FLOAT,
+					 &source_arr, &destination_arr)){
+	break;
       }
 
       ags_audio_buffer_util_fill_v8float_from_double(NULL,
@@ -15145,10 +15188,10 @@ ags_audio_buffer_util_copy_double_to_float(AgsAudioBufferUtil *audio_buffer_util
 					  destination_arr->vector.vec_float->mem_float, 1,
 					  256);
 
-      ags_vector_256_manager_release(vector_256_manager,
-				     source_arr);
-      ags_vector_256_manager_release(vector_256_manager,
-				     destination_arr);
+      ags_scratch_arena_release(scratch_arena,
+				source_arr);
+      ags_scratch_arena_release(scratch_arena,
+				destination_arr);
 
       destination += (256 * destination_stride);
       source += (256 * source_stride);
@@ -15348,6 +15391,15 @@ ags_audio_buffer_util_copy_double_to_double(AgsAudioBufferUtil *audio_buffer_uti
     return;
   }
 
+  /* contiguous buffers are dispatched to the CPU specific kernels */
+  if(destination_stride == 1 &&
+     source_stride == 1){
+    ags_audio_buffer_kernel_get_default()->copy_double_to_double(destination, source,
+								 count);
+
+    return;
+  }
+
   i = 0;
   
 #if defined(AGS_VECTORIZED_BUILTIN_FUNCTIONS)
@@ -15356,17 +15408,17 @@ ags_audio_buffer_util_copy_double_to_double(AgsAudioBufferUtil *audio_buffer_uti
     limit = count - (count % 8);
   
 #if defined(AGS_VECTOR_256_FUNCTIONS)
-    AgsVector256Manager *vector_256_manager = ags_vector_256_manager_get_instance();
+    AgsScratchArena *scratch_arena = ags_scratch_arena_get_thread_default();
   
     while(i + 256 <= limit){
       AgsVectorArr *source_arr, *destination_arr;
 
       guint j;
     
-      while(!ags_vector_256_manager_try_acquire_dual(vector_256_manager,
-						     AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE,
-						     &source_arr, &destination_arr)){
-	g_thread_yield();
+      if(!ags_scratch_arena_acquire_dual(scratch_arena,
+					 AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE,
+					 &source_arr, &destination_arr)){
+	break;
       }
 
       ags_audio_buffer_util_fill_v8double(NULL,
@@ -15388,10 +15440,10 @@ ags_audio_buffer_util_copy_double_to_double(AgsAudioBufferUtil *audio_buffer_uti
 					   destination_arr->vector.vec_double->mem_double, 1,
 					   256);
 
-      ags_vector_256_manager_release(vector_256_manager,
-				     source_arr);
-      ags_vector_256_manager_release(vector_256_manager,
-				     destination_arr);
+      ags_scratch_arena_release(scratch_arena,
+				source_arr);
+      ags_scratch_arena_release(scratch_arena,
+				destination_arr);
 
       destination += (256 * destination_stride);
       source += (256 * source_stride);
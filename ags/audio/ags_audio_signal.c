@@ -72,6 +72,34 @@ void ags_audio_signal_real_add_note(AgsAudioSignal *audio_signal,
 void ags_audio_signal_real_remove_note(AgsAudioSignal *audio_signal,
 				       GObject *note);
 
+gpointer ags_audio_signal_stream_block_take(AgsAudioSignal *audio_signal,
+					    guint buffer_size,
+					    AgsSoundcardFormat format,
+					    gsize slot_size);
+gboolean ags_audio_signal_stream_block_give(AgsAudioSignal *audio_signal,
+					    gpointer ptr);
+
+GList* ags_audio_signal_stream_node_alloc(AgsAudioSignal *audio_signal);
+void ags_audio_signal_stream_node_free(AgsAudioSignal *audio_signal,
+				       GList *node);
+
+void* ags_audio_signal_stream_buffer_alloc(AgsAudioSignal *audio_signal,
+					   guint buffer_size,
+					   AgsSoundcardFormat format,
+					   gboolean use_slice);
+void ags_audio_signal_stream_buffer_free(AgsAudioSignal *audio_signal,
+					 guint buffer_size,
+					 AgsSoundcardFormat format,
+					 gboolean use_slice,
+					 void *buffer);
+
+void ags_audio_signal_stream_retired_free(GList *stream);
+void ags_audio_signal_stream_list_free(AgsAudioSignal *audio_signal,
+				       GList *stream,
+				       guint buffer_size,
+				       AgsSoundcardFormat format,
+				       gboolean use_slice);
+
 /**
  * SECTION:ags_audio_signal
  * @short_description: Contains the audio data and its alignment
@@ -95,6 +123,11 @@ void ags_audio_signal_real_remove_note(AgsAudioSignal *audio_signal,
  * residing in #AgsAudio.
  *
  * As you might see multiple key presses may apply to one #AgsAudioSignal.
+ *
+ * If you set %AGS_AUDIO_SIGNAL_STREAM_BLOCK flag, the buffers and the #GList nodes
+ * of the stream are taken of contiguous #AgsAudioSignalStreamBlock, rather than
+ * being allocated one by one. Set it before the stream is allocated and don't unset
+ * it afterwards. The recycling templates and the key-on audio signals do so.
  */
 
 enum{
@@ -195,6 +228,7 @@ ags_audio_signal_flags_get_type()
       { AGS_AUDIO_SIGNAL_RECYCLED, "AGS_AUDIO_SIGNAL_RECYCLED", "audio-signal-recycled" },
       { AGS_AUDIO_SIGNAL_STREAM, "AGS_AUDIO_SIGNAL_STREAM", "audio-signal-stream" },
       { AGS_AUDIO_SIGNAL_SLICE_ALLOC, "AGS_AUDIO_SIGNAL_SLICE_ALLOC", "audio-signal-slice-alloc" },
+      { AGS_AUDIO_SIGNAL_STREAM_BLOCK, "AGS_AUDIO_SIGNAL_STREAM_BLOCK", "audio-signal-stream-block" },
       { 0, NULL, NULL }
     };
 
@@ -955,6 +989,9 @@ ags_audio_signal_init(AgsAudioSignal *audio_signal)
   audio_signal->stream_current = NULL;
   audio_signal->stream_end = NULL;
 
+  audio_signal->stream_block = NULL;
+  g_mutex_init(&(audio_signal->stream_block_mutex));
+  
   audio_signal->stream_mode = AGS_AUDIO_SIGNAL_STREAM_CONTINUES_FEED;
 
   audio_signal->audio_buffer_util = ags_audio_buffer_util_alloc();
@@ -1769,24 +1806,16 @@ ags_audio_signal_finalize(GObject *gobject)
   }
 
   /* audio data */
-  if((AGS_AUDIO_SIGNAL_SLICE_ALLOC & (audio_signal->flags)) == 0){
-    g_list_free_full(audio_signal->stream,
-		     (GDestroyNotify) ags_stream_free);
-  }else{
-    GList *stream;
+  ags_audio_signal_stream_list_free(audio_signal,
+				    audio_signal->stream,
+				    audio_signal->buffer_size,
+				    audio_signal->format,
+				    ((AGS_AUDIO_SIGNAL_SLICE_ALLOC & (audio_signal->flags)) != 0) ? TRUE: FALSE);
 
-    stream = audio_signal->stream;
+  g_list_free_full(audio_signal->stream_block,
+		   (GDestroyNotify) ags_audio_signal_stream_block_free);
 
-    while(stream != NULL){
-      ags_stream_slice_free(audio_signal->buffer_size,
-			    audio_signal->format,
-			    stream->data);
-      
-      stream = stream->next;
-    }
-    
-    g_list_free(audio_signal->stream);    
-  }
+  g_mutex_clear(&(audio_signal->stream_block_mutex));
   
   /* call parent */
   G_OBJECT_CLASS(ags_audio_signal_parent_class)->finalize(gobject);
@@ -2477,6 +2506,393 @@ ags_stream_slice_free(guint buffer_size,
 		buffer);
 }
 
+/**
+ * ags_audio_signal_stream_block_alloc:
+ * @buffer_size: the buffer size of a slot, 0 for list node blocks
+ * @format: the format of a slot, 0 for list node blocks
+ * @slot_size: the size of a slot in bytes
+ * @capacity: the number of slots
+ *
+ * Allocate #AgsAudioSignalStreamBlock with @capacity zeroed slots.
+ *
+ * Returns: (transfer full): the newly allocated #AgsAudioSignalStreamBlock
+ *
+ * Since: 9.1.0
+ */
+AgsAudioSignalStreamBlock*
+ags_audio_signal_stream_block_alloc(guint buffer_size,
+				    AgsSoundcardFormat format,
+				    gsize slot_size,
+				    guint capacity)
+{
+  AgsAudioSignalStreamBlock *stream_block;
+
+  guint i;
+  
+  if(slot_size == 0 ||
+     capacity == 0){
+    return(NULL);
+  }
+  
+  stream_block = (AgsAudioSignalStreamBlock *) g_malloc(sizeof(AgsAudioSignalStreamBlock));
+
+  stream_block->buffer_size = buffer_size;
+  stream_block->format = format;
+
+  stream_block->slot_size = slot_size;
+
+  stream_block->capacity = capacity;
+
+  /* lowest slot on top of stack */
+  stream_block->free_count = capacity;
+  stream_block->free_slot = (guint *) g_malloc(capacity * sizeof(guint));
+
+  for(i = 0; i < capacity; i++){
+    stream_block->free_slot[i] = capacity - i - 1;
+  }
+  
+  stream_block->data = (guint8 *) g_malloc0(capacity * slot_size);
+
+  return(stream_block);
+}
+
+/**
+ * ags_audio_signal_stream_block_free:
+ * @stream_block: the #AgsAudioSignalStreamBlock
+ *
+ * Free @stream_block and all its slots.
+ *
+ * Since: 9.1.0
+ */
+void
+ags_audio_signal_stream_block_free(AgsAudioSignalStreamBlock *stream_block)
+{
+  if(stream_block == NULL){
+    return;
+  }
+
+  g_free(stream_block->free_slot);
+  g_free(stream_block->data);
+  
+  g_free(stream_block);
+}
+
+/**
+ * ags_audio_signal_stream_block_contains:
+ * @stream_block: the #AgsAudioSignalStreamBlock
+ * @ptr: the slot
+ *
+ * Check if @ptr is a slot of @stream_block.
+ *
+ * Returns: %TRUE if @ptr is within @stream_block, otherwise %FALSE
+ *
+ * Since: 9.1.0
+ */
+gboolean
+ags_audio_signal_stream_block_contains(AgsAudioSignalStreamBlock *stream_block,
+				       gpointer ptr)
+{
+  if(stream_block == NULL ||
+     ptr == NULL){
+    return(FALSE);
+  }
+
+  if((guint8 *) ptr >= stream_block->data &&
+     (guint8 *) ptr < stream_block->data + (stream_block->capacity * stream_block->slot_size)){
+    return(TRUE);
+  }
+
+  return(FALSE);
+}
+
+gpointer
+ags_audio_signal_stream_block_take(AgsAudioSignal *audio_signal,
+				   guint buffer_size,
+				   AgsSoundcardFormat format,
+				   gsize slot_size)
+{
+  AgsAudioSignalStreamBlock *stream_block;
+  
+  GList *list;
+
+  gpointer ptr;
+  
+  guint capacity;
+  guint slot;
+
+  g_mutex_lock(&(audio_signal->stream_block_mutex));
+  
+  /* find block of matching geometry with free slot */
+  stream_block = NULL;
+  
+  list = audio_signal->stream_block;
+
+  capacity = 0;
+  
+  while(list != NULL){
+    AgsAudioSignalStreamBlock *current;
+
+    current = list->data;
+    
+    if(current->buffer_size == buffer_size &&
+       current->format == format &&
+       current->slot_size == slot_size){
+      if(current->free_count > 0){
+	stream_block = current;
+
+	break;
+      }
+
+      capacity += current->capacity;
+    }
+    
+    list = list->next;
+  }
+
+  /* grow by doubling */
+  if(stream_block == NULL){
+    if(capacity < AGS_AUDIO_SIGNAL_STREAM_BLOCK_DEFAULT_CAPACITY){
+      capacity = AGS_AUDIO_SIGNAL_STREAM_BLOCK_DEFAULT_CAPACITY;
+    }
+    
+    stream_block = ags_audio_signal_stream_block_alloc(buffer_size,
+						       format,
+						       slot_size,
+						       capacity);
+
+    audio_signal->stream_block = g_list_prepend(audio_signal->stream_block,
+						stream_block);
+  }
+
+  stream_block->free_count -= 1;
+  slot = stream_block->free_slot[stream_block->free_count];
+
+  ptr = stream_block->data + (slot * slot_size);
+
+  g_mutex_unlock(&(audio_signal->stream_block_mutex));
+
+  memset(ptr, 0, slot_size);
+
+  return(ptr);
+}
+
+gboolean
+ags_audio_signal_stream_block_give(AgsAudioSignal *audio_signal,
+				   gpointer ptr)
+{
+  GList *list;
+
+  g_mutex_lock(&(audio_signal->stream_block_mutex));
+
+  list = audio_signal->stream_block;
+  
+  while(list != NULL){
+    AgsAudioSignalStreamBlock *stream_block;
+
+    stream_block = list->data;
+    
+    if(ags_audio_signal_stream_block_contains(stream_block,
+					      ptr)){
+      stream_block->free_slot[stream_block->free_count] = (guint) (((guint8 *) ptr - stream_block->data) / stream_block->slot_size);
+      stream_block->free_count += 1;
+
+      /* release empty block, but keep one of each geometry */
+      if(stream_block->free_count == stream_block->capacity){
+	GList *other;
+
+	other = audio_signal->stream_block;
+
+	while(other != NULL){
+	  AgsAudioSignalStreamBlock *current;
+
+	  current = other->data;
+	  
+	  if(current != stream_block &&
+	     current->buffer_size == stream_block->buffer_size &&
+	     current->format == stream_block->format &&
+	     current->slot_size == stream_block->slot_size){
+	    audio_signal->stream_block = g_list_delete_link(audio_signal->stream_block,
+							    list);
+
+	    ags_audio_signal_stream_block_free(stream_block);
+
+	    break;
+	  }
+	  
+	  other = other->next;
+	}
+      }
+
+      g_mutex_unlock(&(audio_signal->stream_block_mutex));
+      
+      return(TRUE);
+    }
+    
+    list = list->next;
+  }
+
+  g_mutex_unlock(&(audio_signal->stream_block_mutex));
+
+  return(FALSE);
+}
+
+GList*
+ags_audio_signal_stream_node_alloc(AgsAudioSignal *audio_signal)
+{
+  if((AGS_AUDIO_SIGNAL_STREAM_BLOCK & (audio_signal->flags)) == 0){
+    return(g_list_alloc());
+  }
+
+  return((GList *) ags_audio_signal_stream_block_take(audio_signal,
+						      0,
+						      0,
+						      sizeof(GList)));
+}
+
+void
+ags_audio_signal_stream_node_free(AgsAudioSignal *audio_signal,
+				  GList *node)
+{
+  if(!ags_audio_signal_stream_block_give(audio_signal,
+					 node)){
+    g_list_free_1(node);
+  }
+}
+
+void*
+ags_audio_signal_stream_buffer_alloc(AgsAudioSignal *audio_signal,
+				     guint buffer_size,
+				     AgsSoundcardFormat format,
+				     gboolean use_slice)
+{
+  guint word_size;
+  
+  if((AGS_AUDIO_SIGNAL_STREAM_BLOCK & (audio_signal->flags)) == 0){
+    if(!use_slice){
+      return(ags_stream_alloc(buffer_size,
+			      format));
+    }else{
+      return(ags_stream_slice_alloc(buffer_size,
+				    format));
+    }
+  }
+
+  switch(format){
+  case AGS_SOUNDCARD_SIGNED_8_BIT:
+    {
+      word_size = sizeof(gint8);
+    }
+    break;
+  case AGS_SOUNDCARD_SIGNED_16_BIT:
+    {
+      word_size = sizeof(gint16);
+    }
+    break;
+  case AGS_SOUNDCARD_SIGNED_24_BIT:
+    {
+      //NOTE:JK: The 24-bit linear samples use 32-bit physical space
+      word_size = sizeof(gint32);
+    }
+    break;
+  case AGS_SOUNDCARD_SIGNED_32_BIT:
+    {
+      word_size = sizeof(gint32);
+    }
+    break;
+  case AGS_SOUNDCARD_SIGNED_64_BIT:
+    {
+      word_size = sizeof(gint64);
+    }
+    break;
+  case AGS_SOUNDCARD_FLOAT:
+    {
+      word_size = sizeof(gfloat);
+    }
+    break;
+  case AGS_SOUNDCARD_DOUBLE:
+    {
+      word_size = sizeof(gdouble);
+    }
+    break;
+  case AGS_SOUNDCARD_COMPLEX:
+    {
+      word_size = sizeof(AgsComplex);
+    }
+    break;
+  default:
+    g_critical("ags_audio_signal_stream_buffer_alloc(): unsupported word size");
+    return(NULL);
+  }
+
+  if(buffer_size == 0){
+    return(NULL);
+  }
+  
+  return(ags_audio_signal_stream_block_take(audio_signal,
+					    buffer_size,
+					    format,
+					    buffer_size * word_size));
+}
+
+void
+ags_audio_signal_stream_buffer_free(AgsAudioSignal *audio_signal,
+				    guint buffer_size,
+				    AgsSoundcardFormat format,
+				    gboolean use_slice,
+				    void *buffer)
+{
+  if(buffer == NULL){
+    return;
+  }
+  
+  if(ags_audio_signal_stream_block_give(audio_signal,
+					buffer)){
+    return;
+  }
+
+  if(!use_slice){
+    ags_stream_free(buffer);
+  }else{
+    ags_stream_slice_free(buffer_size,
+			  format,
+			  buffer);
+  }
+}
+
+void
+ags_audio_signal_stream_retired_free(GList *stream)
+{
+  g_list_free_full(stream,
+		   (GDestroyNotify) ags_stream_free);
+}
+
+void
+ags_audio_signal_stream_list_free(AgsAudioSignal *audio_signal,
+				  GList *stream,
+				  guint buffer_size,
+				  AgsSoundcardFormat format,
+				  gboolean use_slice)
+{
+  GList *stream_next;
+
+  /* give back in reverse order, so lowest slot is on top of stack */
+  stream = g_list_last(stream);
+  
+  while(stream != NULL){
+    stream_next = stream->prev;
+
+    ags_audio_signal_stream_buffer_free(audio_signal,
+					buffer_size,
+					format,
+					use_slice,
+					stream->data);
+    ags_audio_signal_stream_node_free(audio_signal,
+				      stream);
+    
+    stream = stream_next;
+  }
+}
+
 /**
  * ags_audio_signal_get_recycling:
  * @audio_signal: the #AgsAudioSignal
@@ -3015,6 +3431,7 @@ ags_audio_signal_set_buffer_size(AgsAudioSignal *audio_signal, guint buffer_size
   guint old_buffer_size;
   guint word_size;
   guint copy_mode;
+  gboolean use_slice;
   
   GRecMutex *audio_signal_mutex;
   GRecMutex *stream_mutex;
@@ -3161,19 +3578,18 @@ ags_audio_signal_set_buffer_size(AgsAudioSignal *audio_signal, guint buffer_size
   offset = 0;
   
   while(stream != NULL && offset < stream_length * buffer_size){
-    if(ags_audio_signal_test_flags(audio_signal, AGS_AUDIO_SIGNAL_SLICE_ALLOC)){
-      ags_stream_slice_free(old_buffer_size,
-			    format,
-			    stream->data);
-      
-      stream->data = ags_stream_slice_alloc(buffer_size,
-					    format);
-    }else{
-      ags_stream_free(stream->data);
+    use_slice = ags_audio_signal_test_flags(audio_signal, AGS_AUDIO_SIGNAL_SLICE_ALLOC);
+    
+    ags_audio_signal_stream_buffer_free(audio_signal,
+					old_buffer_size,
+					format,
+					use_slice,
+					stream->data);
       
-      stream->data = ags_stream_alloc(buffer_size,
-				      format);
-    }
+    stream->data = ags_audio_signal_stream_buffer_alloc(audio_signal,
+							buffer_size,
+							format,
+							use_slice);
     
     switch(format){
     case AGS_SOUNDCARD_SIGNED_8_BIT:
@@ -3295,6 +3711,7 @@ ags_audio_signal_set_format(AgsAudioSignal *audio_signal, AgsSoundcardFormat for
   guint buffer_size;
   guint old_format;
   guint copy_mode;
+  gboolean use_slice;
 
   GRecMutex *audio_signal_mutex;
   GRecMutex *stream_mutex;
@@ -3371,27 +3788,24 @@ ags_audio_signal_set_format(AgsAudioSignal *audio_signal, AgsSoundcardFormat for
 							      ags_audio_buffer_util_format_from_soundcard(audio_signal->audio_buffer_util,
 													  old_format));
 
+  use_slice = ags_audio_signal_test_flags(audio_signal, AGS_AUDIO_SIGNAL_SLICE_ALLOC);
+  
   while(stream != NULL){
-    if(ags_audio_signal_test_flags(audio_signal, AGS_AUDIO_SIGNAL_SLICE_ALLOC)){
-      data = ags_stream_slice_alloc(buffer_size,
-				    format);
-    }else{
-      data = ags_stream_alloc(buffer_size,
-			      format);
-    }
+    data = ags_audio_signal_stream_buffer_alloc(audio_signal,
+						buffer_size,
+						format,
+						use_slice);
     
     ags_audio_buffer_util_copy_buffer_to_buffer(audio_signal->audio_buffer_util,
 						data, 1, 0,
 						stream->data, 1, 0,
 						buffer_size, copy_mode);
 
-    if(ags_audio_signal_test_flags(audio_signal, AGS_AUDIO_SIGNAL_SLICE_ALLOC)){
-      ags_stream_slice_free(buffer_size,
-			    old_format,
-			    stream->data);
-    }else{
-      ags_stream_free(stream->data);
-    }
+    ags_audio_signal_stream_buffer_free(audio_signal,
+					buffer_size,
+					old_format,
+					use_slice,
+					stream->data);
     
     stream->data = data;
 
@@ -3587,20 +4001,18 @@ ags_audio_signal_add_stream(AgsAudioSignal *audio_signal)
   g_rec_mutex_unlock(audio_signal_mutex);
 
   /* allocate stream and buffer */
-  g_rec_mutex_lock(stream_mutex);
-
-  stream = g_list_alloc();
+  stream = ags_audio_signal_stream_node_alloc(audio_signal);
 
-  if(!use_slice){
-    buffer = ags_stream_alloc(buffer_size,
-			      format);
-  }else{
-    buffer = ags_stream_slice_alloc(buffer_size,
-				    format);
-  }
+  buffer = ags_audio_signal_stream_buffer_alloc(audio_signal,
+						buffer_size,
+						format,
+						use_slice);
   
   stream->data = buffer;
 
+  /* append */
+  g_rec_mutex_lock(stream_mutex);
+
   if(audio_signal->stream_end != NULL){
     end_old = audio_signal->stream_end;
 
@@ -3632,6 +4044,8 @@ ags_audio_signal_add_stream(AgsAudioSignal *audio_signal)
 void
 ags_audio_signal_stream_resize(AgsAudioSignal *audio_signal, guint length)
 {
+  AgsEpochReclaimer *epoch_reclaimer;
+
   gboolean use_slice;
   guint buffer_size;
   AgsSoundcardFormat format;
@@ -3665,39 +4079,49 @@ ags_audio_signal_stream_resize(AgsAudioSignal *audio_signal, guint length)
 
   /* resize stream */
   if(old_length < length){
-    GList *stream, *end_old;
+    GList *stream, *stream_last, *end_old;
 
     void *buffer;
 
     stream = NULL;
+    stream_last = NULL;
 
+    /* allocate outside of stream mutex */
     for(i = old_length; i < length; i++){
-      if(!use_slice){
-	buffer = ags_stream_alloc(buffer_size,
-				  format);
+      GList *current;
+      
+      buffer = ags_audio_signal_stream_buffer_alloc(audio_signal,
+						    buffer_size,
+						    format,
+						    use_slice);
+
+      current = ags_audio_signal_stream_node_alloc(audio_signal);
+
+      current->data = buffer;
+      current->prev = stream_last;
+      current->next = NULL;
+
+      if(stream_last != NULL){
+	stream_last->next = current;
       }else{
-	buffer = ags_stream_slice_alloc(buffer_size,
-					format);
+	stream = current;
       }
-	
-      stream = g_list_prepend(stream,
-			      buffer);
-    }
 
-    stream = g_list_reverse(stream);
+      stream_last = current;
+    }
 
     /* concat */
     g_rec_mutex_lock(stream_mutex);
     
     if(audio_signal->stream_end != NULL){
       end_old = audio_signal->stream_end;
-      audio_signal->stream_end = g_list_last(stream);
+      audio_signal->stream_end = stream_last;
 
       stream->prev = end_old;
       end_old->next = stream;
     }else{
       audio_signal->stream = stream;
-      audio_signal->stream_end = g_list_last(stream);
+      audio_signal->stream_end = stream_last;
       audio_signal->stream_current = stream;
     }
 
@@ -3731,11 +4155,25 @@ ags_audio_signal_stream_resize(AgsAudioSignal *audio_signal, guint length)
       audio_signal->stream_end = NULL;
     }
 
-    g_rec_mutex_unlock(stream_mutex);
-    
     stream->prev = NULL;
-    g_list_free_full(stream,
-		     ags_stream_free);
+
+    /* free the heap allocated buffers off the audio thread */
+    epoch_reclaimer = ags_epoch_reclaimer_get_instance();
+    
+    if(!use_slice &&
+       !ags_audio_signal_test_flags(audio_signal, AGS_AUDIO_SIGNAL_STREAM_BLOCK) &&
+       ags_worker_thread_test_status_flags((AgsWorkerThread *) epoch_reclaimer, AGS_WORKER_THREAD_STATUS_RUNNING)){
+      ags_epoch_reclaimer_retire(epoch_reclaimer,
+				 stream, (AgsDestroyFunc) ags_audio_signal_stream_retired_free);
+    }else{
+      ags_audio_signal_stream_list_free(audio_signal,
+					stream,
+					buffer_size,
+					format,
+					use_slice);
+    }
+    
+    g_rec_mutex_unlock(stream_mutex);
   }
 }
 
@@ -4405,6 +4843,9 @@ void
 ags_audio_signal_set_stream(AgsAudioSignal *audio_signal, GList *stream)
 {
   GList *start_stream;
+
+  guint buffer_size;
+  AgsSoundcardFormat format;
   
   GRecMutex *stream_mutex;
 
@@ -4412,6 +4853,14 @@ ags_audio_signal_set_stream(AgsAudioSignal *audio_signal, GList *stream)
     return;
   }
 
+  buffer_size = AGS_SOUNDCARD_DEFAULT_BUFFER_SIZE;
+  format = AGS_SOUNDCARD_DEFAULT_FORMAT;
+    
+  g_object_get(audio_signal,
+	       "buffer-size", &buffer_size,
+	       "format", &format,
+	       NULL);
+
   /* get stream mutex */
   stream_mutex = AGS_AUDIO_SIGNAL_GET_STREAM_MUTEX(audio_signal);
     
@@ -4420,24 +4869,14 @@ ags_audio_signal_set_stream(AgsAudioSignal *audio_signal, GList *stream)
   start_stream = audio_signal->stream;
   audio_signal->stream = stream;
   
-  g_rec_mutex_unlock(stream_mutex);
+  ags_audio_signal_stream_list_free(audio_signal,
+				    start_stream,
+				    buffer_size,
+				    format,
+				    ags_audio_signal_test_flags(audio_signal,
+								AGS_AUDIO_SIGNAL_SLICE_ALLOC));
 
-  if(!ags_audio_signal_test_flags(audio_signal,
-				  AGS_AUDIO_SIGNAL_SLICE_ALLOC)){
-    g_list_free_full(start_stream,
-		     (GDestroyNotify) ags_stream_free);
-  }else{
-    guint buffer_size;
-
-    buffer_size = AGS_SOUNDCARD_DEFAULT_BUFFER_SIZE;
-    
-    g_object_get(audio_signal,
-		 "buffer-size", &buffer_size,
-		 NULL);
-    
-    g_list_free_full(start_stream,
-		     (GDestroyNotify) ags_stream_slice_free);
-  }
+  g_rec_mutex_unlock(stream_mutex);
 }
 
 /**
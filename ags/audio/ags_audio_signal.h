@@ -41,8 +41,11 @@ G_BEGIN_DECLS
 #define AGS_AUDIO_SIGNAL_GET_STREAM_MUTEX(obj) (&(((AgsAudioSignal *) obj)->stream_mutex))
 #define AGS_AUDIO_SIGNAL_GET_BACKLOG_MUTEX(obj) (&(((AgsAudioSignal *) obj)->backlog_mutex))
 
+#define AGS_AUDIO_SIGNAL_STREAM_BLOCK_DEFAULT_CAPACITY (16)
+
 typedef struct _AgsAudioSignal AgsAudioSignal;
 typedef struct _AgsAudioSignalClass AgsAudioSignalClass;
+typedef struct _AgsAudioSignalStreamBlock AgsAudioSignalStreamBlock;
 
 /**
  * AgsAudioSignalFlags:
@@ -53,6 +56,7 @@ typedef struct _AgsAudioSignalClass AgsAudioSignalClass;
  * @AGS_AUDIO_SIGNAL_RECYCLED: the audio signal is recycled
  * @AGS_AUDIO_SIGNAL_STREAM: the audio signal needs stream
  * @AGS_AUDIO_SIGNAL_SLICE_ALLOC: the audio signal allocates from slice
+ * @AGS_AUDIO_SIGNAL_STREAM_BLOCK: the audio signal allocates stream from contiguous blocks
  * 
  * Enum values to control the behavior or indicate internal state of #AgsAudioSignal by
  * enable/disable as flags.
@@ -65,6 +69,7 @@ typedef enum{
   AGS_AUDIO_SIGNAL_RECYCLED                     = 1 <<  4,
   AGS_AUDIO_SIGNAL_STREAM                       = 1 <<  5,
   AGS_AUDIO_SIGNAL_SLICE_ALLOC                  = 1 <<  6,            
+  AGS_AUDIO_SIGNAL_STREAM_BLOCK                 = 1 <<  7,
 }AgsAudioSignalFlags;
 
 /**
@@ -80,6 +85,35 @@ typedef enum{
   AGS_AUDIO_SIGNAL_STREAM_DUAL_BUFFERED,
 }AgsAudioSignalStreamMode;
 
+/**
+ * AgsAudioSignalStreamBlock:
+ * @buffer_size: the buffer size of a slot, 0 for list node blocks
+ * @format: the format of a slot, 0 for list node blocks
+ * @slot_size: the size of a slot in bytes
+ * @capacity: the number of slots
+ * @free_count: the number of free slots
+ * @free_slot: (array length=capacity): the stack of free slot indices
+ * @data: the contiguous memory of all slots
+ *
+ * A contiguous block either of stream buffers or of the #GList nodes linking
+ * them. Slots are handed out in ascending order, so adjacent buffers of the
+ * stream are adjacent in memory.
+ */
+struct _AgsAudioSignalStreamBlock
+{
+  guint buffer_size;
+  AgsSoundcardFormat format;
+
+  gsize slot_size;
+  
+  guint capacity;
+
+  guint free_count;
+  guint *free_slot;
+  
+  guint8 *data;
+};
+
 struct _AgsAudioSignal
 {
   GObject gobject;
@@ -135,6 +169,9 @@ struct _AgsAudioSignal
   GList *stream_current;
   GList *stream_end;
 
+  GList *stream_block;
+  GMutex stream_block_mutex;
+  
   AgsAudioSignalStreamMode stream_mode;
 
   AgsAudioBufferUtil *audio_buffer_util;
@@ -182,6 +219,15 @@ void ags_stream_slice_free(guint buffer_size,
 			   AgsSoundcardFormat format,
 			   void *buffer);
 
+AgsAudioSignalStreamBlock* ags_audio_signal_stream_block_alloc(guint buffer_size,
+							       AgsSoundcardFormat format,
+							       gsize slot_size,
+							       guint capacity);
+void ags_audio_signal_stream_block_free(AgsAudioSignalStreamBlock *stream_block);
+
+gboolean ags_audio_signal_stream_block_contains(AgsAudioSignalStreamBlock *stream_block,
+						gpointer ptr);
+
 /* parent */
 GObject* ags_audio_signal_get_recycling(AgsAudioSignal *audio_signal);
 void ags_audio_signal_set_recycling(AgsAudioSignal *audio_signal, GObject *recycling);
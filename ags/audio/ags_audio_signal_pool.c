@@ -0,0 +1,952 @@
+/* GSequencer - Advanced GTK Sequencer
+ * Copyright (C) 2005-2026 Joël Krähemann
+ *
+ * This file is part of GSequencer.
+ *
+ * GSequencer is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GSequencer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GSequencer.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <ags/audio/ags_audio_signal_pool.h>
+
+#include <ags/audio/ags_sound_enums.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <ags/i18n.h>
+
+void ags_audio_signal_pool_class_init(AgsAudioSignalPoolClass *audio_signal_pool);
+void ags_audio_signal_pool_init(AgsAudioSignalPool *audio_signal_pool);
+void ags_audio_signal_pool_set_property(GObject *gobject,
+					guint prop_id,
+					const GValue *value,
+					GParamSpec *param_spec);
+void ags_audio_signal_pool_get_property(GObject *gobject,
+					guint prop_id,
+					GValue *value,
+					GParamSpec *param_spec);
+void ags_audio_signal_pool_dispose(GObject *gobject);
+void ags_audio_signal_pool_finalize(GObject *gobject);
+
+gboolean ags_audio_signal_pool_steal_oldest(AgsAudioSignalPool *audio_signal_pool);
+void ags_audio_signal_pool_retired_note_free(GList *note);
+
+/**
+ * SECTION:ags_audio_signal_pool
+ * @short_description: preallocated voices
+ * @title: AgsAudioSignalPool
+ * @section_id:
+ * @include: ags/audio/ags_audio_signal_pool.h
+ *
+ * #AgsAudioSignalPool keeps preallocated #AgsAudioSignal voices of a
+ * #AgsRecycling. Acquiring and releasing a voice doesn't lock nor allocate,
+ * the voice state is changed by atomic compare and exchange.
+ *
+ * The pooled audio signals have the %AGS_AUDIO_SIGNAL_RECYCLED flag set and
+ * are released as they are removed of their #AgsRecycling.
+ */
+
+enum{
+  PROP_0,
+  PROP_OUTPUT_SOUNDCARD,
+  PROP_MAX_POLYPHONY,
+  PROP_STEAL_POLICY,
+};
+
+static gpointer ags_audio_signal_pool_parent_class = NULL;
+
+GType
+ags_audio_signal_pool_get_type()
+{
+  static gsize g_define_type_id__static = 0;
+
+  if(g_once_init_enter(&g_define_type_id__static)){
+    GType ags_type_audio_signal_pool = 0;
+
+    static const GTypeInfo ags_audio_signal_pool_info = {
+      sizeof (AgsAudioSignalPoolClass),
+      NULL, /* base_init */
+      NULL, /* base_finalize */
+      (GClassInitFunc) ags_audio_signal_pool_class_init,
+      NULL, /* class_finalize */
+      NULL, /* class_data */
+      sizeof (AgsAudioSignalPool),
+      0,    /* n_preallocs */
+      (GInstanceInitFunc) ags_audio_signal_pool_init,
+    };
+
+    ags_type_audio_signal_pool = g_type_register_static(G_TYPE_OBJECT,
+							"AgsAudioSignalPool",
+							&ags_audio_signal_pool_info,
+							0);
+
+    g_once_init_leave(&g_define_type_id__static, ags_type_audio_signal_pool);
+  }
+
+  return(g_define_type_id__static);
+}
+
+GType
+ags_audio_signal_pool_steal_policy_get_type()
+{
+  static gsize g_enum_type_id__static;
+
+  if(g_once_init_enter(&g_enum_type_id__static)){
+    static const GEnumValue values[] = {
+      { AGS_AUDIO_SIGNAL_POOL_STEAL_NONE, "AGS_AUDIO_SIGNAL_POOL_STEAL_NONE", "audio-signal-pool-steal-none" },
+      { AGS_AUDIO_SIGNAL_POOL_STEAL_OLDEST, "AGS_AUDIO_SIGNAL_POOL_STEAL_OLDEST", "audio-signal-pool-steal-oldest" },
+      { 0, NULL, NULL }
+    };
+
+    GType g_enum_type_id = g_enum_register_static(g_intern_static_string("AgsAudioSignalPoolStealPolicy"), values);
+
+    g_once_init_leave(&g_enum_type_id__static, g_enum_type_id);
+  }
+  
+  return(g_enum_type_id__static);
+}
+
+void
+ags_audio_signal_pool_class_init(AgsAudioSignalPoolClass *audio_signal_pool)
+{
+  GObjectClass *gobject;
+
+  GParamSpec *param_spec;
+
+  ags_audio_signal_pool_parent_class = g_type_class_peek_parent(audio_signal_pool);
+
+  /* GObjectClass */
+  gobject = (GObjectClass *) audio_signal_pool;
+
+  gobject->set_property = ags_audio_signal_pool_set_property;
+  gobject->get_property = ags_audio_signal_pool_get_property;
+
+  gobject->dispose = ags_audio_signal_pool_dispose;
+  gobject->finalize = ags_audio_signal_pool_finalize;
+
+  /* properties */
+  /**
+   * AgsAudioSignalPool:output-soundcard:
+   *
+   * The output soundcard the preallocated voices are created with.
+   * 
+   * Since: 9.1.0
+   */
+  param_spec = g_param_spec_object("output-soundcard",
+				   i18n_pspec("assigned output soundcard"),
+				   i18n_pspec("The output soundcard it is assigned with"),
+				   G_TYPE_OBJECT,
+				   G_PARAM_READABLE | G_PARAM_WRITABLE);
+  g_object_class_install_property(gobject,
+				  PROP_OUTPUT_SOUNDCARD,
+				  param_spec);
+
+  /**
+   * AgsAudioSignalPool:max-polyphony:
+   *
+   * The maximum count of voices playing at the same time, 0 means unlimited.
+   * 
+   * Since: 9.1.0
+   */
+  param_spec = g_param_spec_uint("max-polyphony",
+				 i18n_pspec("max polyphony"),
+				 i18n_pspec("The maximum count of voices playing"),
+				 0,
+				 G_MAXUINT32,
+				 AGS_AUDIO_SIGNAL_POOL_DEFAULT_MAX_POLYPHONY,
+				 G_PARAM_READABLE | G_PARAM_WRITABLE);
+  g_object_class_install_property(gobject,
+				  PROP_MAX_POLYPHONY,
+				  param_spec);
+
+  /**
+   * AgsAudioSignalPool:steal-policy:
+   *
+   * The steal policy applied as max polyphony is reached.
+   * 
+   * Since: 9.1.0
+   */
+  param_spec = g_param_spec_enum("steal-policy",
+				 i18n_pspec("steal policy"),
+				 i18n_pspec("The steal policy applied as max polyphony is reached"),
+				 AGS_TYPE_AUDIO_SIGNAL_POOL_STEAL_POLICY,
+				 AGS_AUDIO_SIGNAL_POOL_STEAL_OLDEST,
+				 G_PARAM_READABLE | G_PARAM_WRITABLE);
+  g_object_class_install_property(gobject,
+				  PROP_STEAL_POLICY,
+				  param_spec);
+}
+
+void
+ags_audio_signal_pool_init(AgsAudioSignalPool *audio_signal_pool)
+{
+  audio_signal_pool->flags = 0;
+
+  /* audio signal pool mutex */
+  g_rec_mutex_init(&(audio_signal_pool->obj_mutex));
+
+  audio_signal_pool->output_soundcard = NULL;
+
+  audio_signal_pool->max_polyphony = AGS_AUDIO_SIGNAL_POOL_DEFAULT_MAX_POLYPHONY;
+  audio_signal_pool->steal_policy = AGS_AUDIO_SIGNAL_POOL_STEAL_OLDEST;
+
+  /* voices */
+  audio_signal_pool->stream_length = AGS_AUDIO_SIGNAL_POOL_DEFAULT_STREAM_LENGTH;
+
+  audio_signal_pool->voice_count = 0;
+  audio_signal_pool->voice = NULL;
+
+  audio_signal_pool->playing_count = 0;
+  audio_signal_pool->serial = 0;
+
+  /* statistics */
+  audio_signal_pool->hit_count = 0;
+  audio_signal_pool->miss_count = 0;
+  audio_signal_pool->steal_count = 0;
+  audio_signal_pool->drop_count = 0;
+}
+
+void
+ags_audio_signal_pool_set_property(GObject *gobject,
+				   guint prop_id,
+				   const GValue *value,
+				   GParamSpec *param_spec)
+{
+  AgsAudioSignalPool *audio_signal_pool;
+
+  GRecMutex *audio_signal_pool_mutex;
+
+  audio_signal_pool = AGS_AUDIO_SIGNAL_POOL(gobject);
+
+  /* get audio signal pool mutex */
+  audio_signal_pool_mutex = AGS_AUDIO_SIGNAL_POOL_GET_OBJ_MUTEX(audio_signal_pool);
+
+  switch(prop_id){
+  case PROP_OUTPUT_SOUNDCARD:
+  {
+    GObject *output_soundcard;
+
+    output_soundcard = g_value_get_object(value);
+
+    g_rec_mutex_lock(audio_signal_pool_mutex);
+
+    if(audio_signal_pool->output_soundcard == output_soundcard){
+      g_rec_mutex_unlock(audio_signal_pool_mutex);
+
+      return;
+    }
+
+    if(audio_signal_pool->output_soundcard != NULL){
+      g_object_unref(audio_signal_pool->output_soundcard);
+    }
+
+    if(output_soundcard != NULL){
+      g_object_ref(output_soundcard);
+    }
+
+    audio_signal_pool->output_soundcard = output_soundcard;
+
+    g_rec_mutex_unlock(audio_signal_pool_mutex);
+  }
+  break;
+  case PROP_MAX_POLYPHONY:
+  {
+    ags_audio_signal_pool_set_max_polyphony(audio_signal_pool,
+					    g_value_get_uint(value));
+  }
+  break;
+  case PROP_STEAL_POLICY:
+  {
+    ags_audio_signal_pool_set_steal_policy(audio_signal_pool,
+					   g_value_get_enum(value));
+  }
+  break;
+  default:
+    G_OBJECT_WARN_INVALID_PROPERTY_ID(gobject, prop_id, param_spec);
+    break;
+  }
+}
+
+void
+ags_audio_signal_pool_get_property(GObject *gobject,
+				   guint prop_id,
+				   GValue *value,
+				   GParamSpec *param_spec)
+{
+  AgsAudioSignalPool *audio_signal_pool;
+
+  GRecMutex *audio_signal_pool_mutex;
+
+  audio_signal_pool = AGS_AUDIO_SIGNAL_POOL(gobject);
+
+  /* get audio signal pool mutex */
+  audio_signal_pool_mutex = AGS_AUDIO_SIGNAL_POOL_GET_OBJ_MUTEX(audio_signal_pool);
+
+  switch(prop_id){
+  case PROP_OUTPUT_SOUNDCARD:
+  {
+    g_rec_mutex_lock(audio_signal_pool_mutex);
+
+    g_value_set_object(value, audio_signal_pool->output_soundcard);
+
+    g_rec_mutex_unlock(audio_signal_pool_mutex);
+  }
+  break;
+  case PROP_MAX_POLYPHONY:
+  {
+    g_value_set_uint(value, ags_audio_signal_pool_get_max_polyphony(audio_signal_pool));
+  }
+  break;
+  case PROP_STEAL_POLICY:
+  {
+    g_value_set_enum(value, ags_audio_signal_pool_get_steal_policy(audio_signal_pool));
+  }
+  break;
+  default:
+    G_OBJECT_WARN_INVALID_PROPERTY_ID(gobject, prop_id, param_spec);
+    break;
+  }
+}
+
+void
+ags_audio_signal_pool_dispose(GObject *gobject)
+{
+  AgsAudioSignalPool *audio_signal_pool;
+
+  audio_signal_pool = AGS_AUDIO_SIGNAL_POOL(gobject);
+
+  /* output soundcard */
+  if(audio_signal_pool->output_soundcard != NULL){
+    g_object_unref(audio_signal_pool->output_soundcard);
+
+    audio_signal_pool->output_soundcard = NULL;
+  }
+
+  /* call parent */
+  G_OBJECT_CLASS(ags_audio_signal_pool_parent_class)->dispose(gobject);
+}
+
+void
+ags_audio_signal_pool_finalize(GObject *gobject)
+{
+  AgsAudioSignalPool *audio_signal_pool;
+
+  guint i;
+  
+  audio_signal_pool = AGS_AUDIO_SIGNAL_POOL(gobject);
+
+  /* output soundcard */
+  if(audio_signal_pool->output_soundcard != NULL){
+    g_object_unref(audio_signal_pool->output_soundcard);
+  }
+
+  /* voices */
+  for(i = 0; i < audio_signal_pool->voice_count; i++){
+    g_object_unref(audio_signal_pool->voice[i].audio_signal);
+  }
+
+  g_free(audio_signal_pool->voice);
+
+  /* call parent */
+  G_OBJECT_CLASS(ags_audio_signal_pool_parent_class)->finalize(gobject);
+}
+
+/**
+ * ags_audio_signal_pool_get_obj_mutex:
+ * @audio_signal_pool: the #AgsAudioSignalPool
+ * 
+ * Get object mutex.
+ * 
+ * Returns: the #GRecMutex to lock @audio_signal_pool
+ * 
+ * Since: 9.1.0
+ */
+GRecMutex*
+ags_audio_signal_pool_get_obj_mutex(AgsAudioSignalPool *audio_signal_pool)
+{
+  if(!AGS_IS_AUDIO_SIGNAL_POOL(audio_signal_pool)){
+    return(NULL);
+  }
+
+  return(AGS_AUDIO_SIGNAL_POOL_GET_OBJ_MUTEX(audio_signal_pool));
+}
+
+/**
+ * ags_audio_signal_pool_get_max_polyphony:
+ * @audio_signal_pool: the #AgsAudioSignalPool
+ * 
+ * Get max polyphony of @audio_signal_pool.
+ * 
+ * Returns: the max polyphony, 0 means unlimited
+ * 
+ * Since: 9.1.0
+ */
+guint
+ags_audio_signal_pool_get_max_polyphony(AgsAudioSignalPool *audio_signal_pool)
+{
+  if(!AGS_IS_AUDIO_SIGNAL_POOL(audio_signal_pool)){
+    return(0);
+  }
+
+  return(ags_atomic_uint_get(&(audio_signal_pool->max_polyphony)));
+}
+
+/**
+ * ags_audio_signal_pool_set_max_polyphony:
+ * @audio_signal_pool: the #AgsAudioSignalPool
+ * @max_polyphony: the max polyphony, 0 means unlimited
+ * 
+ * Set max polyphony of @audio_signal_pool.
+ * 
+ * Since: 9.1.0
+ */
+void
+ags_audio_signal_pool_set_max_polyphony(AgsAudioSignalPool *audio_signal_pool,
+					guint max_polyphony)
+{
+  if(!AGS_IS_AUDIO_SIGNAL_POOL(audio_signal_pool)){
+    return;
+  }
+
+  ags_atomic_uint_set(&(audio_signal_pool->max_polyphony),
+		      max_polyphony);
+}
+
+/**
+ * ags_audio_signal_pool_get_steal_policy:
+ * @audio_signal_pool: the #AgsAudioSignalPool
+ * 
+ * Get steal policy of @audio_signal_pool.
+ * 
+ * Returns: the #AgsAudioSignalPoolStealPolicy
+ * 
+ * Since: 9.1.0
+ */
+AgsAudioSignalPoolStealPolicy
+ags_audio_signal_pool_get_steal_policy(AgsAudioSignalPool *audio_signal_pool)
+{
+  if(!AGS_IS_AUDIO_SIGNAL_POOL(audio_signal_pool)){
+    return(AGS_AUDIO_SIGNAL_POOL_STEAL_NONE);
+  }
+
+  return((AgsAudioSignalPoolStealPolicy) ags_atomic_uint_get(&(audio_signal_pool->steal_policy)));
+}
+
+/**
+ * ags_audio_signal_pool_set_steal_policy:
+ * @audio_signal_pool: the #AgsAudioSignalPool
+ * @steal_policy: the #AgsAudioSignalPoolStealPolicy
+ * 
+ * Set steal policy of @audio_signal_pool.
+ * 
+ * Since: 9.1.0
+ */
+void
+ags_audio_signal_pool_set_steal_policy(AgsAudioSignalPool *audio_signal_pool,
+				       AgsAudioSignalPoolStealPolicy steal_policy)
+{
+  if(!AGS_IS_AUDIO_SIGNAL_POOL(audio_signal_pool)){
+    return;
+  }
+
+  ags_atomic_uint_set(&(audio_signal_pool->steal_policy),
+		      steal_policy);
+}
+
+/**
+ * ags_audio_signal_pool_prealloc:
+ * @audio_signal_pool: the #AgsAudioSignalPool
+ * @voice_count: the count of voices to allocate
+ * @stream_length: the stream length of each voice
+ * 
+ * Preallocate @voice_count voices of @audio_signal_pool. The voices
+ * are allocated only once, call this before the pool is used by the
+ * audio thread.
+ * 
+ * Since: 9.1.0
+ */
+void
+ags_audio_signal_pool_prealloc(AgsAudioSignalPool *audio_signal_pool,
+			       guint voice_count,
+			       guint stream_length)
+{
+  AgsAudioSignalPoolVoice *voice;
+
+  GObject *output_soundcard;
+
+  guint i;
+  
+  GRecMutex *audio_signal_pool_mutex;
+
+  if(!AGS_IS_AUDIO_SIGNAL_POOL(audio_signal_pool) ||
+     voice_count == 0){
+    return;
+  }
+
+  /* get audio signal pool mutex */
+  audio_signal_pool_mutex = AGS_AUDIO_SIGNAL_POOL_GET_OBJ_MUTEX(audio_signal_pool);
+
+  g_rec_mutex_lock(audio_signal_pool_mutex);
+
+  if(audio_signal_pool->voice != NULL){
+    g_rec_mutex_unlock(audio_signal_pool_mutex);
+
+    return;
+  }
+
+  output_soundcard = audio_signal_pool->output_soundcard;
+
+  voice = (AgsAudioSignalPoolVoice *) g_new0(AgsAudioSignalPoolVoice,
+					     voice_count);
+
+  for(i = 0; i < voice_count; i++){
+    AgsAudioSignal *audio_signal;
+    
+    audio_signal = ags_audio_signal_new(output_soundcard,
+					NULL,
+					NULL);
+    ags_audio_signal_set_flags(audio_signal, (AGS_AUDIO_SIGNAL_STREAM |
+					      AGS_AUDIO_SIGNAL_SLICE_ALLOC |
+					      AGS_AUDIO_SIGNAL_STREAM_BLOCK |
+					      AGS_AUDIO_SIGNAL_RECYCLED));
+
+    ags_audio_signal_set_key_format(audio_signal,
+				    AGS_SOUND_KEY_FORMAT_256TH);
+    ags_audio_signal_set_stream_mode(audio_signal,
+				     AGS_AUDIO_SIGNAL_STREAM_CONTINUES_FEED);
+
+    ags_audio_signal_stream_resize(audio_signal,
+				   stream_length);
+
+    audio_signal->stream_current = audio_signal->stream;
+
+    ags_connectable_connect(AGS_CONNECTABLE(audio_signal));
+    
+    voice[i].audio_signal = audio_signal;
+    
+    voice[i].state = AGS_AUDIO_SIGNAL_POOL_VOICE_FREE;
+    voice[i].serial = 0;
+  }
+
+  audio_signal_pool->stream_length = stream_length;
+
+  audio_signal_pool->voice_count = voice_count;
+
+  /* publish */
+  ags_atomic_pointer_set(&(audio_signal_pool->voice),
+			 voice);
+  
+  g_rec_mutex_unlock(audio_signal_pool_mutex);
+}
+
+/**
+ * ags_audio_signal_pool_contains:
+ * @audio_signal_pool: the #AgsAudioSignalPool
+ * @audio_signal: the #AgsAudioSignal
+ * 
+ * Check if @audio_signal is a voice of @audio_signal_pool.
+ * 
+ * Returns: %TRUE if @audio_signal is owned by @audio_signal_pool, otherwise %FALSE
+ * 
+ * Since: 9.1.0
+ */
+gboolean
+ags_audio_signal_pool_contains(AgsAudioSignalPool *audio_signal_pool,
+			       AgsAudioSignal *audio_signal)
+{
+  AgsAudioSignalPoolVoice *voice;
+
+  guint i;
+  
+  if(!AGS_IS_AUDIO_SIGNAL_POOL(audio_signal_pool) ||
+     audio_signal == NULL){
+    return(FALSE);
+  }
+
+  voice = ags_atomic_pointer_get(&(audio_signal_pool->voice));
+
+  if(voice == NULL){
+    return(FALSE);
+  }
+  
+  for(i = 0; i < audio_signal_pool->voice_count; i++){
+    if(voice[i].audio_signal == audio_signal){
+      return(TRUE);
+    }
+  }
+
+  return(FALSE);
+}
+
+gboolean
+ags_audio_signal_pool_steal_oldest(AgsAudioSignalPool *audio_signal_pool)
+{
+  AgsAudioSignalPoolVoice *voice;
+
+  guint current_serial;
+  guint oldest_age;
+  gint oldest;
+  guint i, j;
+
+  GRecMutex *stream_mutex;
+  
+  voice = ags_atomic_pointer_get(&(audio_signal_pool->voice));
+
+  if(voice == NULL){
+    return(FALSE);
+  }
+
+  /* retry if another thread changed the oldest voice concurrently */
+  for(j = 0; j < audio_signal_pool->voice_count; j++){
+    current_serial = ags_atomic_uint_get(&(audio_signal_pool->serial));
+
+    oldest = -1;
+    oldest_age = 0;
+    
+    for(i = 0; i < audio_signal_pool->voice_count; i++){
+      guint age;
+      
+      if(ags_atomic_int_get(&(voice[i].state)) != AGS_AUDIO_SIGNAL_POOL_VOICE_ACQUIRED){
+	continue;
+      }
+
+      /* wrap around safe */
+      age = current_serial - ags_atomic_uint_get(&(voice[i].serial));
+
+      if(oldest == -1 ||
+	 age > oldest_age){
+	oldest = i;
+	oldest_age = age;
+      }
+    }
+
+    if(oldest == -1){
+      return(FALSE);
+    }
+
+    if(ags_atomic_int_compare_and_exchange(&(voice[oldest].state),
+					   AGS_AUDIO_SIGNAL_POOL_VOICE_ACQUIRED,
+					   AGS_AUDIO_SIGNAL_POOL_VOICE_STOLEN)){
+      ags_atomic_uint_decrement(&(audio_signal_pool->playing_count));
+      
+      /* cut the voice, it is removed of its recycling as done */
+      stream_mutex = AGS_AUDIO_SIGNAL_GET_STREAM_MUTEX(voice[oldest].audio_signal);
+      
+      g_rec_mutex_lock(stream_mutex);
+
+      voice[oldest].audio_signal->stream_current = NULL;
+      
+      g_rec_mutex_unlock(stream_mutex);
+      
+      return(TRUE);
+    }
+  }
+
+  return(FALSE);
+}
+
+/**
+ * ags_audio_signal_pool_acquire:
+ * @audio_signal_pool: the #AgsAudioSignalPool
+ * @dropped: (out): return location of %TRUE if the voice was dropped due to max polyphony
+ * 
+ * Acquire a voice of @audio_signal_pool. If max polyphony is reached the
+ * steal policy is applied, with %AGS_AUDIO_SIGNAL_POOL_STEAL_NONE no voice
+ * is returned and @dropped is set to %TRUE.
+ *
+ * If there is no free voice available %NULL is returned and @dropped is
+ * set to %FALSE, then the caller is expected to allocate a new #AgsAudioSignal.
+ * 
+ * Returns: (transfer none): the #AgsAudioSignal or %NULL
+ * 
+ * Since: 9.1.0
+ */
+AgsAudioSignal*
+ags_audio_signal_pool_acquire(AgsAudioSignalPool *audio_signal_pool,
+			      gboolean *dropped)
+{
+  AgsAudioSignalPoolVoice *voice;
+
+  guint max_polyphony;
+  guint i;
+
+  if(dropped != NULL){
+    dropped[0] = FALSE;
+  }
+  
+  if(!AGS_IS_AUDIO_SIGNAL_POOL(audio_signal_pool)){
+    return(NULL);
+  }
+
+  voice = ags_atomic_pointer_get(&(audio_signal_pool->voice));
+  
+  /* max polyphony */
+  max_polyphony = ags_atomic_uint_get(&(audio_signal_pool->max_polyphony));
+
+  if(max_polyphony != 0 &&
+     ags_atomic_uint_get(&(audio_signal_pool->playing_count)) >= max_polyphony){
+    if(ags_audio_signal_pool_get_steal_policy(audio_signal_pool) == AGS_AUDIO_SIGNAL_POOL_STEAL_OLDEST &&
+       ags_audio_signal_pool_steal_oldest(audio_signal_pool)){
+      ags_atomic_uint_increment(&(audio_signal_pool->steal_count));
+    }else{
+      ags_atomic_uint_increment(&(audio_signal_pool->drop_count));
+
+      if(dropped != NULL){
+	dropped[0] = TRUE;
+      }
+      
+      return(NULL);
+    }
+  }
+
+  /* find free voice */
+  if(voice != NULL){
+    for(i = 0; i < audio_signal_pool->voice_count; i++){
+      if(ags_atomic_int_compare_and_exchange(&(voice[i].state),
+					     AGS_AUDIO_SIGNAL_POOL_VOICE_FREE,
+					     AGS_AUDIO_SIGNAL_POOL_VOICE_ACQUIRED)){
+	ags_atomic_uint_set(&(voice[i].serial),
+			    ags_atomic_uint_increment(&(audio_signal_pool->serial)) + 1);
+	
+	ags_atomic_uint_increment(&(audio_signal_pool->playing_count));
+	ags_atomic_uint_increment(&(audio_signal_pool->hit_count));
+
+	return(voice[i].audio_signal);
+      }
+    }
+  }
+  
+  ags_atomic_uint_increment(&(audio_signal_pool->miss_count));
+  
+  return(NULL);
+}
+
+/**
+ * ags_audio_signal_pool_release:
+ * @audio_signal_pool: the #AgsAudioSignalPool
+ * @audio_signal: the #AgsAudioSignal
+ * 
+ * Release @audio_signal to @audio_signal_pool. The notes and the recall id
+ * are unset and the stream is cleared, so the voice can be acquired again.
+ * The references held by the voice are dropped by #AgsEpochReclaimer, the
+ * stream only shrinks to its preallocated length. Safe to call from the
+ * audio thread.
+ * 
+ * Since: 9.1.0
+ */
+void
+ags_audio_signal_pool_release(AgsAudioSignalPool *audio_signal_pool,
+			      AgsAudioSignal *audio_signal)
+{
+  AgsAudioSignalPoolVoice *voice;
+  AgsEpochReclaimer *epoch_reclaimer;
+
+  GObject *recall_id;
+  
+  GList *note;
+
+  gint state;
+  guint length;
+  guint i;
+  
+  GRecMutex *audio_signal_mutex;
+  GRecMutex *stream_mutex;
+
+  if(!AGS_IS_AUDIO_SIGNAL_POOL(audio_signal_pool) ||
+     !AGS_IS_AUDIO_SIGNAL(audio_signal)){
+    return;
+  }
+
+  voice = ags_atomic_pointer_get(&(audio_signal_pool->voice));
+
+  if(voice == NULL){
+    return;
+  }
+  
+  for(i = 0; i < audio_signal_pool->voice_count; i++){
+    if(voice[i].audio_signal == audio_signal){
+      break;
+    }
+  }
+
+  if(i == audio_signal_pool->voice_count){
+    return;
+  }
+
+  /* claim - a concurrent steal might move acquired to stolen meanwhile */
+  do{
+    state = ags_atomic_int_get(&(voice[i].state));
+
+    if(state == AGS_AUDIO_SIGNAL_POOL_VOICE_FREE){
+      return;
+    }
+  }while(state == AGS_AUDIO_SIGNAL_POOL_VOICE_ACQUIRED &&
+	 !ags_atomic_int_compare_and_exchange(&(voice[i].state),
+					      AGS_AUDIO_SIGNAL_POOL_VOICE_ACQUIRED,
+					      AGS_AUDIO_SIGNAL_POOL_VOICE_STOLEN));
+
+  if(state == AGS_AUDIO_SIGNAL_POOL_VOICE_ACQUIRED){
+    ags_atomic_uint_decrement(&(audio_signal_pool->playing_count));
+  }
+  
+  /* reset - drop references off the audio thread */
+  audio_signal_mutex = AGS_AUDIO_SIGNAL_GET_OBJ_MUTEX(audio_signal);
+
+  g_rec_mutex_lock(audio_signal_mutex);
+
+  note = audio_signal->note;
+  audio_signal->note = NULL;
+
+  recall_id = audio_signal->recall_id;
+  audio_signal->recall_id = NULL;
+
+  length = audio_signal->length;
+  
+  g_rec_mutex_unlock(audio_signal_mutex);
+
+  epoch_reclaimer = ags_epoch_reclaimer_get_instance();
+
+  if(ags_worker_thread_test_status_flags((AgsWorkerThread *) epoch_reclaimer, AGS_WORKER_THREAD_STATUS_RUNNING)){
+    if(note != NULL){
+      ags_epoch_reclaimer_retire(epoch_reclaimer,
+				 note, (AgsDestroyFunc) ags_audio_signal_pool_retired_note_free);
+    }
+
+    if(recall_id != NULL){
+      ags_epoch_reclaimer_retire(epoch_reclaimer,
+				 recall_id, (AgsDestroyFunc) g_object_unref);
+    }
+  }else{
+    ags_audio_signal_pool_retired_note_free(note);
+
+    if(recall_id != NULL){
+      g_object_unref(recall_id);
+    }
+  }
+
+  /* shrinking gives the buffers back to the voice's stream blocks, never grow */
+  if(length > audio_signal_pool->stream_length){
+    ags_audio_signal_stream_resize(audio_signal,
+				   audio_signal_pool->stream_length);
+  }
+
+  ags_audio_signal_clear(audio_signal);
+
+  stream_mutex = AGS_AUDIO_SIGNAL_GET_STREAM_MUTEX(audio_signal);
+
+  g_rec_mutex_lock(stream_mutex);
+
+  audio_signal->stream_current = audio_signal->stream;
+
+  g_rec_mutex_unlock(stream_mutex);
+
+  /* free */
+  ags_atomic_int_set(&(voice[i].state),
+		     AGS_AUDIO_SIGNAL_POOL_VOICE_FREE);
+}
+
+void
+ags_audio_signal_pool_retired_note_free(GList *note)
+{
+  g_list_free_full(note,
+		   (GDestroyNotify) g_object_unref);
+}
+
+/**
+ * ags_audio_signal_pool_get_statistics:
+ * @audio_signal_pool: the #AgsAudioSignalPool
+ * @hit_count: (out): return location of the count of voices acquired from pool
+ * @miss_count: (out): return location of the count of acquire without free voice
+ * @steal_count: (out): return location of the count of stolen voices
+ * @drop_count: (out): return location of the count of dropped voices
+ * 
+ * Get statistics of @audio_signal_pool.
+ * 
+ * Since: 9.1.0
+ */
+void
+ags_audio_signal_pool_get_statistics(AgsAudioSignalPool *audio_signal_pool,
+				     guint *hit_count,
+				     guint *miss_count,
+				     guint *steal_count,
+				     guint *drop_count)
+{
+  if(!AGS_IS_AUDIO_SIGNAL_POOL(audio_signal_pool)){
+    return;
+  }
+
+  if(hit_count != NULL){
+    hit_count[0] = ags_atomic_uint_get(&(audio_signal_pool->hit_count));
+  }
+
+  if(miss_count != NULL){
+    miss_count[0] = ags_atomic_uint_get(&(audio_signal_pool->miss_count));
+  }
+
+  if(steal_count != NULL){
+    steal_count[0] = ags_atomic_uint_get(&(audio_signal_pool->steal_count));
+  }
+
+  if(drop_count != NULL){
+    drop_count[0] = ags_atomic_uint_get(&(audio_signal_pool->drop_count));
+  }
+}
+
+/**
+ * ags_audio_signal_pool_reset_statistics:
+ * @audio_signal_pool: the #AgsAudioSignalPool
+ * 
+ * Reset statistics of @audio_signal_pool.
+ * 
+ * Since: 9.1.0
+ */
+void
+ags_audio_signal_pool_reset_statistics(AgsAudioSignalPool *audio_signal_pool)
+{
+  if(!AGS_IS_AUDIO_SIGNAL_POOL(audio_signal_pool)){
+    return;
+  }
+
+  ags_atomic_uint_set(&(audio_signal_pool->hit_count),
+		      0);
+  ags_atomic_uint_set(&(audio_signal_pool->miss_count),
+		      0);
+  ags_atomic_uint_set(&(audio_signal_pool->steal_count),
+		      0);
+  ags_atomic_uint_set(&(audio_signal_pool->drop_count),
+		      0);
+}
+
+/**
+ * ags_audio_signal_pool_new:
+ * @output_soundcard: the #GObject implementing #AgsSoundcard
+ *
+ * Create a new instance of #AgsAudioSignalPool.
+ *
+ * Returns: the new #AgsAudioSignalPool
+ *
+ * Since: 9.1.0
+ */
+AgsAudioSignalPool*
+ags_audio_signal_pool_new(GObject *output_soundcard)
+{
+  AgsAudioSignalPool *audio_signal_pool;
+
+  audio_signal_pool = (AgsAudioSignalPool *) g_object_new(AGS_TYPE_AUDIO_SIGNAL_POOL,
+							  "output-soundcard", output_soundcard,
+							  NULL);
+
+  return(audio_signal_pool);
+}
@@ -0,0 +1,166 @@
+/* GSequencer - Advanced GTK Sequencer
+ * Copyright (C) 2005-2026 Joël Krähemann
+ *
+ * This file is part of GSequencer.
+ *
+ * GSequencer is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GSequencer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GSequencer.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef __AGS_AUDIO_SIGNAL_POOL_H__
+#define __AGS_AUDIO_SIGNAL_POOL_H__
+
+#include <glib.h>
+#include <glib-object.h>
+
+#include <ags/libags.h>
+
+#include <ags/audio/ags_audio_signal.h>
+
+G_BEGIN_DECLS
+
+#define AGS_TYPE_AUDIO_SIGNAL_POOL                (ags_audio_signal_pool_get_type())
+#define AGS_TYPE_AUDIO_SIGNAL_POOL_STEAL_POLICY   (ags_audio_signal_pool_steal_policy_get_type())
+#define AGS_AUDIO_SIGNAL_POOL(obj)                (G_TYPE_CHECK_INSTANCE_CAST((obj), AGS_TYPE_AUDIO_SIGNAL_POOL, AgsAudioSignalPool))
+#define AGS_AUDIO_SIGNAL_POOL_CLASS(class)        (G_TYPE_CHECK_CLASS_CAST((class), AGS_TYPE_AUDIO_SIGNAL_POOL, AgsAudioSignalPoolClass))
+#define AGS_IS_AUDIO_SIGNAL_POOL(obj)             (G_TYPE_CHECK_INSTANCE_TYPE ((obj), AGS_TYPE_AUDIO_SIGNAL_POOL))
+#define AGS_IS_AUDIO_SIGNAL_POOL_CLASS(class)     (G_TYPE_CHECK_CLASS_TYPE ((class), AGS_TYPE_AUDIO_SIGNAL_POOL))
+#define AGS_AUDIO_SIGNAL_POOL_GET_CLASS(obj)      (G_TYPE_INSTANCE_GET_CLASS ((obj), AGS_TYPE_AUDIO_SIGNAL_POOL, AgsAudioSignalPoolClass))
+
+#define AGS_AUDIO_SIGNAL_POOL_GET_OBJ_MUTEX(obj) (&(((AgsAudioSignalPool *) obj)->obj_mutex))
+
+#define AGS_AUDIO_SIGNAL_POOL_VOICE(ptr) ((AgsAudioSignalPoolVoice *)(ptr))
+
+#define AGS_AUDIO_SIGNAL_POOL_DEFAULT_MAX_POLYPHONY (32)
+#define AGS_AUDIO_SIGNAL_POOL_DEFAULT_STREAM_LENGTH (2)
+
+typedef struct _AgsAudioSignalPool AgsAudioSignalPool;
+typedef struct _AgsAudioSignalPoolClass AgsAudioSignalPoolClass;
+typedef struct _AgsAudioSignalPoolVoice AgsAudioSignalPoolVoice;
+
+/**
+ * AgsAudioSignalPoolStealPolicy:
+ * @AGS_AUDIO_SIGNAL_POOL_STEAL_NONE: don't steal, a voice exceeding max polyphony is dropped
+ * @AGS_AUDIO_SIGNAL_POOL_STEAL_OLDEST: steal the longest playing voice
+ * 
+ * Enum values to control what #AgsAudioSignalPool does as max polyphony is reached.
+ */
+typedef enum{
+  AGS_AUDIO_SIGNAL_POOL_STEAL_NONE,
+  AGS_AUDIO_SIGNAL_POOL_STEAL_OLDEST,
+}AgsAudioSignalPoolStealPolicy;
+
+/**
+ * AgsAudioSignalPoolVoiceState:
+ * @AGS_AUDIO_SIGNAL_POOL_VOICE_FREE: the voice is available
+ * @AGS_AUDIO_SIGNAL_POOL_VOICE_ACQUIRED: the voice is playing
+ * @AGS_AUDIO_SIGNAL_POOL_VOICE_STOLEN: the voice was stolen and is waiting to be released
+ * 
+ * Enum values indicating the state of #AgsAudioSignalPoolVoice.
+ */
+typedef enum{
+  AGS_AUDIO_SIGNAL_POOL_VOICE_FREE,
+  AGS_AUDIO_SIGNAL_POOL_VOICE_ACQUIRED,
+  AGS_AUDIO_SIGNAL_POOL_VOICE_STOLEN,
+}AgsAudioSignalPoolVoiceState;
+
+/**
+ * AgsAudioSignalPoolVoice:
+ * @audio_signal: the preallocated #AgsAudioSignal
+ * @state: the #AgsAudioSignalPoolVoiceState
+ * @serial: the acquire serial, used to find the oldest voice
+ * 
+ * A voice of #AgsAudioSignalPool.
+ */
+struct _AgsAudioSignalPoolVoice
+{
+  AgsAudioSignal *audio_signal;
+
+  volatile gint state;
+  volatile guint serial;
+};
+
+struct _AgsAudioSignalPool
+{
+  GObject gobject;
+
+  guint flags;
+  
+  GRecMutex obj_mutex;
+
+  GObject *output_soundcard;
+
+  volatile guint max_polyphony;
+  volatile guint steal_policy;
+
+  guint stream_length;
+
+  guint voice_count;
+  AgsAudioSignalPoolVoice *voice;
+
+  volatile guint playing_count;
+  volatile guint serial;
+
+  volatile guint hit_count;
+  volatile guint miss_count;
+  volatile guint steal_count;
+  volatile guint drop_count;
+};
+
+struct _AgsAudioSignalPoolClass
+{
+  GObjectClass gobject;
+};
+
+GType ags_audio_signal_pool_get_type();
+GType ags_audio_signal_pool_steal_policy_get_type();
+
+GRecMutex* ags_audio_signal_pool_get_obj_mutex(AgsAudioSignalPool *audio_signal_pool);
+
+/* presets */
+guint ags_audio_signal_pool_get_max_polyphony(AgsAudioSignalPool *audio_signal_pool);
+void ags_audio_signal_pool_set_max_polyphony(AgsAudioSignalPool *audio_signal_pool,
+					     guint max_polyphony);
+
+AgsAudioSignalPoolStealPolicy ags_audio_signal_pool_get_steal_policy(AgsAudioSignalPool *audio_signal_pool);
+void ags_audio_signal_pool_set_steal_policy(AgsAudioSignalPool *audio_signal_pool,
+					    AgsAudioSignalPoolStealPolicy steal_policy);
+
+/* voices */
+void ags_audio_signal_pool_prealloc(AgsAudioSignalPool *audio_signal_pool,
+				    guint voice_count,
+				    guint stream_length);
+
+gboolean ags_audio_signal_pool_contains(AgsAudioSignalPool *audio_signal_pool,
+				       AgsAudioSignal *audio_signal);
+
+AgsAudioSignal* ags_audio_signal_pool_acquire(AgsAudioSignalPool *audio_signal_pool,
+					      gboolean *dropped);
+void ags_audio_signal_pool_release(AgsAudioSignalPool *audio_signal_pool,
+				   AgsAudioSignal *audio_signal);
+
+/* statistics */
+void ags_audio_signal_pool_get_statistics(AgsAudioSignalPool *audio_signal_pool,
+					  guint *hit_count,
+					  guint *miss_count,
+					  guint *steal_count,
+					  guint *drop_count);
+void ags_audio_signal_pool_reset_statistics(AgsAudioSignalPool *audio_signal_pool);
+
+/* instantiate */
+AgsAudioSignalPool* ags_audio_signal_pool_new(GObject *output_soundcard);
+
+G_END_DECLS
+
+#endif /*__AGS_AUDIO_SIGNAL_POOL_H__*/
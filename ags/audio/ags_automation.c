@@ -47,6 +47,13 @@ void ags_automation_get_property(GObject *gobject,
 				 GParamSpec *param_spec);
 void ags_automation_dispose(GObject *gobject);
 void ags_automation_finalize(GObject *gobject);
+
+void ags_automation_increment_port_revision(AgsAutomation *automation);
+
+void ags_automation_attach_acceleration(AgsAutomation *automation,
+					AgsAcceleration *acceleration);
+void ags_automation_detach_acceleration(AgsAutomation *automation,
+					AgsAcceleration *acceleration);
   
 void ags_automation_insert_from_clipboard_version_0_4_3(AgsAutomation *automation,
 							xmlNode *root_node, char *version,
@@ -869,6 +876,9 @@ ags_automation_dispose(GObject *gobject)
   list = automation->acceleration;
 
   while(list != NULL){
+    ags_automation_detach_acceleration(automation,
+				       list->data);
+    
     g_object_run_dispose(G_OBJECT(list->data));
 
     list = list->next;
@@ -891,6 +901,8 @@ ags_automation_finalize(GObject *gobject)
 {
   AgsAutomation *automation;
 
+  GList *list;
+  
   automation = AGS_AUTOMATION(gobject);
   
   /* audio */
@@ -919,6 +931,15 @@ ags_automation_finalize(GObject *gobject)
   }
   
   /* acceleration */
+  list = automation->acceleration;
+
+  while(list != NULL){
+    ags_automation_detach_acceleration(automation,
+				       list->data);
+
+    list = list->next;
+  }
+
   g_list_free_full(automation->acceleration,
 		   g_object_unref);
 
@@ -991,6 +1012,8 @@ ags_automation_set_flags(AgsAutomation *automation, AgsAutomationFlags flags)
   automation->flags |= flags;
   
   g_rec_mutex_unlock(automation_mutex);
+
+  ags_automation_increment_port_revision(automation);
 }
 
 /**
@@ -1020,6 +1043,8 @@ ags_automation_unset_flags(AgsAutomation *automation, AgsAutomationFlags flags)
   automation->flags &= (~flags);
   
   g_rec_mutex_unlock(automation_mutex);
+
+  ags_automation_increment_port_revision(automation);
 }
 
 /**
@@ -1042,6 +1067,61 @@ ags_automation_get_obj_mutex(AgsAutomation *automation)
   return(AGS_AUTOMATION_GET_OBJ_MUTEX(automation));
 }
 
+void
+ags_automation_increment_port_revision(AgsAutomation *automation)
+{
+  GObject *port;
+  
+  GRecMutex *automation_mutex;
+
+  /* get automation mutex */
+  automation_mutex = AGS_AUTOMATION_GET_OBJ_MUTEX(automation);
+
+  g_rec_mutex_lock(automation_mutex);
+
+  port = automation->port;
+
+  if(port != NULL){
+    ags_port_increment_automation_revision((AgsPort *) port);
+  }
+  
+  g_rec_mutex_unlock(automation_mutex);
+}
+
+void
+ags_automation_attach_acceleration(AgsAutomation *automation,
+				   AgsAcceleration *acceleration)
+{
+  GRecMutex *acceleration_mutex;
+
+  /* the caller holds the automation mutex */
+  acceleration_mutex = AGS_ACCELERATION_GET_OBJ_MUTEX(acceleration);
+
+  g_rec_mutex_lock(acceleration_mutex);
+
+  acceleration->automation = (GObject *) automation;
+  
+  g_rec_mutex_unlock(acceleration_mutex);
+}
+
+void
+ags_automation_detach_acceleration(AgsAutomation *automation,
+				   AgsAcceleration *acceleration)
+{
+  GRecMutex *acceleration_mutex;
+
+  /* the caller holds the automation mutex */
+  acceleration_mutex = AGS_ACCELERATION_GET_OBJ_MUTEX(acceleration);
+
+  g_rec_mutex_lock(acceleration_mutex);
+
+  if(acceleration->automation == (GObject *) automation){
+    acceleration->automation = NULL;
+  }
+  
+  g_rec_mutex_unlock(acceleration_mutex);
+}
+
 /**
  * ags_automation_find_port:
  * @automation: (element-type AgsAudio.Automation) (transfer none): the #GList-struct containing #AgsAutomation
@@ -2397,6 +2477,7 @@ void
 ags_automation_set_acceleration(AgsAutomation *automation, GList *acceleration)
 {
   GList *start_acceleration;
+  GList *list;
   
   GRecMutex *automation_mutex;
 
@@ -2411,9 +2492,29 @@ ags_automation_set_acceleration(AgsAutomation *automation, GList *acceleration)
 
   start_acceleration = automation->acceleration;
   automation->acceleration = acceleration;
+
+  list = start_acceleration;
+
+  while(list != NULL){
+    ags_automation_detach_acceleration(automation,
+				       list->data);
+
+    list = list->next;
+  }
+
+  list = acceleration;
+
+  while(list != NULL){
+    ags_automation_attach_acceleration(automation,
+				       list->data);
+
+    list = list->next;
+  }
   
   g_rec_mutex_unlock(automation_mutex);
 
+  ags_automation_increment_port_revision(automation);
+
   g_list_free_full(start_acceleration,
 		   (GDestroyNotify) g_object_unref);
 }
@@ -2451,6 +2552,8 @@ ags_automation_add_acceleration(AgsAutomation *automation,
   if(use_selection_list){
     if((current = ags_automation_find_point(automation, acceleration->x, acceleration->y, TRUE)) != NULL){
       g_warning("inconsistent data");
+
+      g_rec_mutex_unlock(automation_mutex);
       
       return;
     }
@@ -2469,6 +2572,10 @@ ags_automation_add_acceleration(AgsAutomation *automation,
       current->x = acceleration->x;
       current->y = acceleration->y;
 
+      ags_automation_increment_port_revision(automation);
+
+      g_rec_mutex_unlock(automation_mutex);
+      
       return;
     }
     
@@ -2478,6 +2585,10 @@ ags_automation_add_acceleration(AgsAutomation *automation,
       automation->acceleration = g_list_insert_sorted(automation->acceleration,
 						      acceleration,
 						      (GCompareFunc) ags_acceleration_sort_func);
+      ags_automation_attach_acceleration(automation,
+					 acceleration);
+
+      ags_automation_increment_port_revision(automation);
     }
   }
 
@@ -2517,7 +2628,11 @@ ags_automation_remove_acceleration(AgsAutomation *automation,
 		   acceleration) != NULL){
       automation->acceleration = g_list_remove(automation->acceleration,
 					       acceleration);
+      ags_automation_detach_acceleration(automation,
+					 acceleration);
       g_object_unref(acceleration);
+
+      ags_automation_increment_port_revision(automation);
     }
   }else{
     if(g_list_find(automation->selection,
@@ -2611,7 +2726,11 @@ ags_automation_remove_acceleration_at_position(AgsAutomation *automation,
     
     automation->acceleration = g_list_remove(automation->acceleration,
 					     acceleration);
+    ags_automation_detach_acceleration(automation,
+				       acceleration);
     g_object_unref(acceleration);
+
+    ags_automation_increment_port_revision(automation);
   
     g_rec_mutex_unlock(automation_mutex);
   }
@@ -3374,6 +3493,8 @@ ags_automation_cut_selection(AgsAutomation *automation)
   while(selection != NULL){
     automation->acceleration = g_list_remove(automation->acceleration,
 					     selection->data);
+    ags_automation_detach_acceleration(automation,
+				       selection->data);
     g_object_unref(selection->data);
 
     selection = selection->next;
@@ -3381,6 +3502,8 @@ ags_automation_cut_selection(AgsAutomation *automation)
 
   g_rec_mutex_unlock(automation_mutex);
 
+  ags_automation_increment_port_revision(automation);
+
   g_list_free(start_selection);
 
   /* free selection */
@@ -0,0 +1,491 @@
+/* GSequencer - Advanced GTK Sequencer
+ * Copyright (C) 2005-2026 Joël Krähemann
+ *
+ * This file is part of GSequencer.
+ *
+ * GSequencer is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GSequencer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GSequencer.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <ags/audio/ags_automation_cursor.h>
+
+#include <ags/audio/ags_automation.h>
+#include <ags/audio/ags_acceleration.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * SECTION:ags_automation_cursor
+ * @short_description: Block wise automation evaluation
+ * @title: AgsAutomationCursor
+ * @section_id:
+ * @include: ags/audio/ags_automation_cursor.h
+ *
+ * #AgsAutomationCursor evaluates the automation of an #AgsPort once per
+ * block. The points of all #AgsAutomation of the port are collected into a
+ * sorted array as the automation revision changes. Consecutive blocks
+ * advance the cursor incrementally, seeking backwards e.g. as looping does
+ * a binary search.
+ *
+ * As the block contains a slope or a point, a value per frame is computed
+ * to avoid zipper noise. Blocks of constant value cost a comparison.
+ */
+
+gint ags_automation_cursor_point_sort_func(gconstpointer a,
+					   gconstpointer b);
+
+static inline gdouble ags_automation_cursor_eval(AgsAutomationCursor *cursor,
+						 guint position,
+						 gdouble x);
+
+GType
+ags_automation_cursor_get_type(void)
+{
+  static gsize g_define_type_id__static = 0;
+
+  if(g_once_init_enter(&g_define_type_id__static)){
+    GType ags_type_automation_cursor = 0;
+
+    ags_type_automation_cursor =
+      g_boxed_type_register_static("AgsAutomationCursor",
+				   (GBoxedCopyFunc) ags_automation_cursor_copy,
+				   (GBoxedFreeFunc) ags_automation_cursor_free);
+
+    g_once_init_leave(&g_define_type_id__static, ags_type_automation_cursor);
+  }
+
+  return(g_define_type_id__static);
+}
+
+gint
+ags_automation_cursor_point_sort_func(gconstpointer a,
+				      gconstpointer b)
+{
+  gdouble a_x, b_x;
+
+  a_x = AGS_AUTOMATION_CURSOR_POINT(a)->x;
+  b_x = AGS_AUTOMATION_CURSOR_POINT(b)->x;
+
+  if(a_x < b_x){
+    return(-1);
+  }else if(a_x > b_x){
+    return(1);
+  }
+
+  return(0);
+}
+
+static inline gdouble
+ags_automation_cursor_eval(AgsAutomationCursor *cursor,
+			   guint position,
+			   gdouble x)
+{
+  AgsAutomationCursorPoint *prev, *next;
+
+  /* before first point holds the first value */
+  if(position == 0){
+    return(cursor->point[0].y);
+  }
+
+  prev = &(cursor->point[position - 1]);
+
+  if(position >= cursor->point_count ||
+     !cursor->interpolate){
+    return(prev->y);
+  }
+
+  next = &(cursor->point[position]);
+
+  if(next->x <= prev->x){
+    return(next->y);
+  }
+  
+  return(prev->y + (next->y - prev->y) * ((x - prev->x) / (next->x - prev->x)));
+}
+
+/**
+ * ags_automation_cursor_alloc:
+ *
+ * Allocate #AgsAutomationCursor-struct.
+ *
+ * Returns: a new #AgsAutomationCursor-struct
+ *
+ * Since: 9.1.0
+ */
+AgsAutomationCursor*
+ags_automation_cursor_alloc()
+{
+  AgsAutomationCursor *ptr;
+
+  ptr = (AgsAutomationCursor *) g_new(AgsAutomationCursor,
+				      1);
+
+  ptr->revision = 0;
+  ptr->interpolate = TRUE;
+
+  ptr->point_count = 0;
+  ptr->point = NULL;
+
+  ptr->position = 0;
+  ptr->current_x = 0.0;
+
+  ptr->has_value = FALSE;
+  ptr->value = 0.0;
+
+  ptr->has_ramp = FALSE;
+
+  ptr->ramp_length = 0;
+  ptr->allocated_ramp_length = 0;
+  ptr->ramp = NULL;
+
+  ptr->has_written = FALSE;
+  ptr->written_value = 0.0;
+
+  return(ptr);
+}
+
+/**
+ * ags_automation_cursor_copy:
+ * @ptr: the original #AgsAutomationCursor-struct
+ *
+ * Create a copy of @ptr.
+ *
+ * Returns: a pointer of the new #AgsAutomationCursor-struct
+ *
+ * Since: 9.1.0
+ */
+gpointer
+ags_automation_cursor_copy(AgsAutomationCursor *ptr)
+{
+  AgsAutomationCursor *new_ptr;
+
+  g_return_val_if_fail(ptr != NULL, NULL);
+
+  new_ptr = (AgsAutomationCursor *) g_new(AgsAutomationCursor,
+					  1);
+
+  memcpy(new_ptr, ptr, sizeof(AgsAutomationCursor));
+
+  new_ptr->point = NULL;
+  new_ptr->ramp = NULL;
+
+  if(ptr->point_count > 0){
+    new_ptr->point = (AgsAutomationCursorPoint *) g_memdup(ptr->point,
+							    ptr->point_count * sizeof(AgsAutomationCursorPoint));
+  }
+
+  if(ptr->allocated_ramp_length > 0){
+    new_ptr->ramp = (gfloat *) g_memdup(ptr->ramp,
+					 ptr->allocated_ramp_length * sizeof(gfloat));
+  }
+
+  return(new_ptr);
+}
+
+/**
+ * ags_automation_cursor_free:
+ * @ptr: the #AgsAutomationCursor-struct
+ *
+ * Free the memory of @ptr.
+ *
+ * Since: 9.1.0
+ */
+void
+ags_automation_cursor_free(AgsAutomationCursor *ptr)
+{
+  g_return_if_fail(ptr != NULL);
+
+  g_free(ptr->point);
+  g_free(ptr->ramp);
+
+  g_free(ptr);
+}
+
+/**
+ * ags_automation_cursor_update:
+ * @cursor: the #AgsAutomationCursor-struct
+ * @automation: (element-type AgsAudio.Automation) (transfer none): the #GList-struct containing #AgsAutomation
+ * @revision: the revision of @automation
+ * @interpolate: if %TRUE interpolate linear, else step
+ *
+ * Collect the points of @automation, bypassed automation is omitted.
+ * The position is reset, so the next fill seeks, and the next value is
+ * written regardless of the value written last.
+ *
+ * Since: 9.1.0
+ */
+void
+ags_automation_cursor_update(AgsAutomationCursor *cursor,
+			     GList *automation,
+			     guint revision,
+			     gboolean interpolate)
+{
+  GArray *point;
+
+  g_return_if_fail(cursor != NULL);
+
+  point = g_array_new(FALSE, FALSE,
+		      sizeof(AgsAutomationCursorPoint));
+
+  while(automation != NULL){
+    GList *start_acceleration, *acceleration;
+    
+    if(ags_automation_test_flags(automation->data, AGS_AUTOMATION_BYPASS)){
+      automation = automation->next;
+      
+      continue;
+    }
+
+    acceleration =
+      start_acceleration = ags_automation_get_acceleration(automation->data);
+
+    while(acceleration != NULL){
+      AgsAutomationCursorPoint current;
+
+      guint x;
+      gdouble y;
+      
+      g_object_get(acceleration->data,
+		   "x", &x,
+		   "y", &y,
+		   NULL);
+
+      current.x = (gdouble) x;
+      current.y = y;
+      
+      g_array_append_val(point,
+			 current);
+      
+      acceleration = acceleration->next;
+    }
+
+    g_list_free_full(start_acceleration,
+		     (GDestroyNotify) g_object_unref);
+    
+    automation = automation->next;
+  }
+
+  g_array_sort(point,
+	       ags_automation_cursor_point_sort_func);
+
+  g_free(cursor->point);
+
+  cursor->revision = revision;
+  cursor->interpolate = interpolate;
+  
+  cursor->point_count = point->len;
+  cursor->point = (AgsAutomationCursorPoint *) g_array_free(point,
+							    (point->len == 0) ? TRUE: FALSE);
+
+  cursor->position = 0;
+  cursor->current_x = 0.0;
+
+  cursor->has_value = FALSE;
+  cursor->has_ramp = FALSE;
+
+  cursor->has_written = FALSE;
+}
+
+/**
+ * ags_automation_cursor_seek:
+ * @cursor: the #AgsAutomationCursor-struct
+ * @x: the x-offset
+ *
+ * Seek @cursor to @x. Seeking forward advances the position over the
+ * passed points, seeking backward does a binary search.
+ *
+ * Since: 9.1.0
+ */
+void
+ags_automation_cursor_seek(AgsAutomationCursor *cursor,
+			   gdouble x)
+{
+  guint position;
+  
+  g_return_if_fail(cursor != NULL);
+
+  position = cursor->position;
+
+  if(x < cursor->current_x){
+    guint lower, upper, middle;
+
+    /* first point with x-offset greater than x */
+    lower = 0;
+    upper = cursor->point_count;
+
+    while(lower < upper){
+      middle = lower + (upper - lower) / 2;
+
+      if(cursor->point[middle].x <= x){
+	lower = middle + 1;
+      }else{
+	upper = middle;
+      }
+    }
+
+    position = lower;
+  }else{
+    while(position < cursor->point_count &&
+	  cursor->point[position].x <= x){
+      position++;
+    }
+  }
+
+  cursor->position = position;
+  cursor->current_x = x;
+}
+
+/**
+ * ags_automation_cursor_fill:
+ * @cursor: the #AgsAutomationCursor-struct
+ * @x: the x-offset of the block
+ * @x_end: the x-end-offset of the block
+ * @buffer_length: the number of frames of the block
+ *
+ * Evaluate @cursor for the block starting at @x. As a point lies within
+ * the block or the block lies on a slope, the ramp containing a value per
+ * frame is filled, too.
+ *
+ * Returns: %TRUE if there is a value, otherwise %FALSE
+ *
+ * Since: 9.1.0
+ */
+gboolean
+ags_automation_cursor_fill(AgsAutomationCursor *cursor,
+			   gdouble x, gdouble x_end,
+			   guint buffer_length)
+{
+  guint position;
+  guint i;
+  gdouble delta;
+  
+  g_return_val_if_fail(cursor != NULL, FALSE);
+
+  cursor->has_value = FALSE;
+  cursor->has_ramp = FALSE;
+
+  if(cursor->point_count == 0){
+    return(FALSE);
+  }
+
+  ags_automation_cursor_seek(cursor,
+			     x);
+
+  position = cursor->position;
+
+  /* nothing until the first point */
+  if(position == 0 &&
+     cursor->point[0].x >= x_end){
+    return(FALSE);
+  }
+
+  cursor->has_value = TRUE;
+  cursor->value = ags_automation_cursor_eval(cursor,
+					     position,
+					     x);
+
+  /* constant block */
+  if(buffer_length == 0 ||
+     position >= cursor->point_count ||
+     (cursor->point[position].x >= x_end &&
+      (!cursor->interpolate ||
+       position == 0 ||
+       cursor->point[position - 1].y == cursor->point[position].y))){
+    return(TRUE);
+  }
+
+  /* ramp */
+  if(cursor->allocated_ramp_length < buffer_length){
+    cursor->ramp = (gfloat *) g_realloc(cursor->ramp,
+					buffer_length * sizeof(gfloat));
+    
+    cursor->allocated_ramp_length = buffer_length;
+  }
+
+  cursor->ramp_length = buffer_length;
+
+  delta = (x_end - x) / (gdouble) buffer_length;
+  
+  for(i = 0; i < buffer_length; i++){
+    gdouble current_x;
+
+    current_x = x + (gdouble) i * delta;
+    
+    while(position < cursor->point_count &&
+	  cursor->point[position].x <= current_x){
+      position++;
+    }
+
+    cursor->ramp[i] = (gfloat) ags_automation_cursor_eval(cursor,
+							  position,
+							  current_x);
+  }
+
+  cursor->value = cursor->ramp[0];
+  cursor->has_ramp = TRUE;
+
+  return(TRUE);
+}
+
+/**
+ * ags_automation_cursor_get_value:
+ * @cursor: the #AgsAutomationCursor-struct
+ *
+ * Get the value at the start of the block filled last.
+ *
+ * Returns: the value
+ *
+ * Since: 9.1.0
+ */
+gdouble
+ags_automation_cursor_get_value(AgsAutomationCursor *cursor)
+{
+  g_return_val_if_fail(cursor != NULL, 0.0);
+
+  return(cursor->value);
+}
+
+/**
+ * ags_automation_cursor_get_ramp:
+ * @cursor: the #AgsAutomationCursor-struct
+ * @ramp_length: (out) (optional): return location of the ramp length
+ *
+ * Get the values per frame of the block filled last. The ramp is valid
+ * until the next call to ags_automation_cursor_fill().
+ *
+ * Returns: (transfer none): the ramp or %NULL if the block is constant
+ *
+ * Since: 9.1.0
+ */
+gfloat*
+ags_automation_cursor_get_ramp(AgsAutomationCursor *cursor,
+			       guint *ramp_length)
+{
+  g_return_val_if_fail(cursor != NULL, NULL);
+
+  if(!cursor->has_ramp){
+    if(ramp_length != NULL){
+      ramp_length[0] = 0;
+    }
+
+    return(NULL);
+  }
+
+  if(ramp_length != NULL){
+    ramp_length[0] = cursor->ramp_length;
+  }
+
+  return(cursor->ramp);
+}
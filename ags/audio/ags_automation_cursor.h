@@ -0,0 +1,122 @@
+/* GSequencer - Advanced GTK Sequencer
+ * Copyright (C) 2005-2026 Joël Krähemann
+ *
+ * This file is part of GSequencer.
+ *
+ * GSequencer is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GSequencer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GSequencer.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef __AGS_AUTOMATION_CURSOR_H__
+#define __AGS_AUTOMATION_CURSOR_H__
+
+#include <glib.h>
+#include <glib-object.h>
+
+G_BEGIN_DECLS
+
+#define AGS_TYPE_AUTOMATION_CURSOR         (ags_automation_cursor_get_type())
+#define AGS_AUTOMATION_CURSOR(ptr) ((AgsAutomationCursor *)(ptr))
+#define AGS_AUTOMATION_CURSOR_POINT(ptr) ((AgsAutomationCursorPoint *)(ptr))
+
+#define AGS_AUTOMATION_CURSOR_DEFAULT_SUB_BLOCK_SIZE (16)
+
+typedef struct _AgsAutomationCursor AgsAutomationCursor;
+typedef struct _AgsAutomationCursorPoint AgsAutomationCursorPoint;
+
+/**
+ * AgsAutomationCursorPoint:
+ * @x: the x-offset
+ * @y: the value
+ *
+ * A point of the automation curve evaluated by #AgsAutomationCursor.
+ */
+struct _AgsAutomationCursorPoint
+{
+  gdouble x;
+  gdouble y;
+};
+
+/**
+ * AgsAutomationCursor:
+ * @revision: the automation revision @point was collected of
+ * @interpolate: if %TRUE interpolate linear between points, else step
+ * @point_count: the number of points
+ * @point: (array length=point_count): the points sorted by x-offset
+ * @position: the index of the first point after the current x-offset
+ * @current_x: the current x-offset
+ * @has_value: if %TRUE @value is valid
+ * @value: the value at @current_x
+ * @has_ramp: if %TRUE @ramp is valid
+ * @ramp_length: the length of @ramp
+ * @allocated_ramp_length: the allocated length of @ramp
+ * @ramp: (array length=ramp_length): the value per frame of the current block
+ * @has_written: if %TRUE @written_value is valid
+ * @written_value: the value written to the port last
+ *
+ * The #AgsAutomationCursor-struct evaluates the automation of a port block
+ * wise. It remembers its position, so consecutive blocks advance over the
+ * points incrementally instead of searching the #AgsAcceleration list of
+ * every #AgsAutomation.
+ */
+struct _AgsAutomationCursor
+{
+  guint revision;
+  gboolean interpolate;
+
+  guint point_count;
+  AgsAutomationCursorPoint *point;
+
+  guint position;
+  gdouble current_x;
+
+  gboolean has_value;
+  gdouble value;
+
+  gboolean has_ramp;
+
+  guint ramp_length;
+  guint allocated_ramp_length;
+  gfloat *ramp;
+
+  gboolean has_written;
+  gdouble written_value;
+};
+
+GType ags_automation_cursor_get_type(void);
+
+AgsAutomationCursor* ags_automation_cursor_alloc();
+
+gpointer ags_automation_cursor_copy(AgsAutomationCursor *ptr);
+void ags_automation_cursor_free(AgsAutomationCursor *ptr);
+
+void ags_automation_cursor_update(AgsAutomationCursor *cursor,
+				  GList *automation,
+				  guint revision,
+				  gboolean interpolate);
+
+void ags_automation_cursor_seek(AgsAutomationCursor *cursor,
+				gdouble x);
+
+gboolean ags_automation_cursor_fill(AgsAutomationCursor *cursor,
+				    gdouble x, gdouble x_end,
+				    guint buffer_length);
+
+gdouble ags_automation_cursor_get_value(AgsAutomationCursor *cursor);
+gfloat* ags_automation_cursor_get_ramp(AgsAutomationCursor *cursor,
+				       guint *ramp_length);
+
+G_END_DECLS
+
+#endif /*__AGS_AUTOMATION_CURSOR_H__*/
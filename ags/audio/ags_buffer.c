@@ -281,6 +281,8 @@ ags_buffer_init(AgsBuffer *buffer)
 
   buffer->data = ags_stream_alloc(buffer->buffer_size,
 				  buffer->format);
+
+  buffer->storage = NULL;
 }
 
 void
@@ -360,6 +362,12 @@ ags_buffer_set_property(GObject *gobject,
     {
       g_rec_mutex_lock(buffer_mutex);
 
+      if(buffer->storage != NULL){
+	ags_wave_storage_unref(buffer->storage);
+
+	buffer->storage = NULL;
+      }
+      
       buffer->data = g_value_get_pointer(value);
 
       g_rec_mutex_unlock(buffer_mutex);
@@ -470,7 +478,9 @@ ags_buffer_finalize(GObject *gobject)
 
   buffer = AGS_BUFFER(gobject);
 
-  if(buffer->data != NULL){
+  if(buffer->storage != NULL){
+    ags_wave_storage_unref(buffer->storage);
+  }else if(buffer->data != NULL){
     g_free(buffer->data);
   }
   
@@ -827,13 +837,20 @@ ags_buffer_set_buffer_size(AgsBuffer *buffer,
 
   old_buffer_size = buffer->buffer_size;
   
-  buffer->buffer_size = buffer_size;
-
   if(old_buffer_size == buffer_size){
     g_rec_mutex_unlock(buffer_mutex);    
 
     return;
   }
+
+  /* the data of a storage can't be resized */
+  if(buffer->storage != NULL){
+    ags_buffer_set_storage(buffer,
+			   NULL,
+			   NULL);
+  }
+
+  buffer->buffer_size = buffer_size;
   
   switch(buffer->format){
   case AGS_SOUNDCARD_SIGNED_8_BIT:
@@ -947,6 +964,12 @@ ags_buffer_set_format(AgsBuffer *buffer,
 
     return;
   }
+
+  if(buffer->storage != NULL){
+    ags_buffer_set_storage(buffer,
+			   NULL,
+			   NULL);
+  }
   
   data = ags_stream_alloc(buffer->buffer_size,
 			  format);
@@ -1007,6 +1030,119 @@ ags_buffer_get_data(AgsBuffer *buffer)
   return(data);
 }
 
+/**
+ * ags_buffer_get_storage:
+ * @buffer: the #AgsBuffer
+ *
+ * Gets the #AgsWaveStorage-struct @buffer's data is located in.
+ * 
+ * Returns: (transfer none): the #AgsWaveStorage-struct or %NULL
+ * 
+ * Since: 9.1.0
+ */
+AgsWaveStorage*
+ags_buffer_get_storage(AgsBuffer *buffer)
+{
+  AgsWaveStorage *storage;
+  
+  GRecMutex *buffer_mutex;
+
+  if(!AGS_IS_BUFFER(buffer)){
+    return(NULL);
+  }
+      
+  /* get buffer mutex */
+  buffer_mutex = AGS_BUFFER_GET_OBJ_MUTEX(buffer);
+
+  /* get storage */
+  g_rec_mutex_lock(buffer_mutex);
+
+  storage = buffer->storage;
+  
+  g_rec_mutex_unlock(buffer_mutex);
+
+  return(storage);
+}
+
+/**
+ * ags_buffer_set_storage:
+ * @buffer: the #AgsBuffer
+ * @storage: (nullable): the #AgsWaveStorage-struct
+ * @data: the data of @buffer within @storage
+ *
+ * Move the data of @buffer to @data located in @storage, @buffer refers
+ * @storage as long it is attached. Passing %NULL as @storage copies the
+ * data out of the storage to newly allocated memory.
+ * 
+ * Since: 9.1.0
+ */
+void
+ags_buffer_set_storage(AgsBuffer *buffer,
+		       AgsWaveStorage *storage,
+		       gpointer data)
+{
+  gpointer old_data;
+  
+  guint word_size;
+  
+  GRecMutex *buffer_mutex;
+
+  if(!AGS_IS_BUFFER(buffer)){
+    return;
+  }
+      
+  /* get buffer mutex */
+  buffer_mutex = AGS_BUFFER_GET_OBJ_MUTEX(buffer);
+
+  /* set storage */
+  g_rec_mutex_lock(buffer_mutex);
+
+  if(buffer->storage == storage &&
+     (storage == NULL || buffer->data == data)){
+    g_rec_mutex_unlock(buffer_mutex);
+
+    return;
+  }
+
+  word_size = ags_wave_storage_get_word_size(buffer->format);
+
+  old_data = buffer->data;
+
+  if(storage != NULL){
+    if(data == NULL ||
+       storage->format != buffer->format ||
+       storage->buffer_size != buffer->buffer_size){
+      g_rec_mutex_unlock(buffer_mutex);
+      
+      g_warning("ags_buffer_set_storage(): data mismatch");
+      
+      return;
+    }
+    
+    ags_wave_storage_ref(storage);
+  }else{
+    data = ags_stream_alloc(buffer->buffer_size,
+			    buffer->format);
+  }
+
+  if(old_data != NULL &&
+     data != NULL){
+    memcpy(data, old_data, buffer->buffer_size * word_size);
+  }
+
+  /* release former data */
+  if(buffer->storage != NULL){
+    ags_wave_storage_unref(buffer->storage);
+  }else{
+    g_free(old_data);
+  }
+  
+  buffer->storage = storage;
+  buffer->data = data;
+  
+  g_rec_mutex_unlock(buffer_mutex);
+}
+
 /**
  * ags_buffer_find_range_x:
  * @buffer: (element-type AgsAudio.Buffer) (transfer none): the #GList-struct containing #AgsBuffer
@@ -28,6 +28,7 @@
 #include <ags/libags.h>
 
 #include <ags/audio/ags_audio_buffer_util.h>
+#include <ags/audio/ags_wave_storage.h>
 
 G_BEGIN_DECLS
 
@@ -76,6 +77,8 @@ struct _AgsBuffer
   void *data;
 
   AgsAudioBufferUtil *audio_buffer_util;
+
+  AgsWaveStorage *storage;
 };
 
 struct _AgsBufferClass
@@ -118,6 +121,11 @@ void ags_buffer_set_format(AgsBuffer *buffer,
 
 gpointer ags_buffer_get_data(AgsBuffer *buffer);
 
+AgsWaveStorage* ags_buffer_get_storage(AgsBuffer *buffer);
+void ags_buffer_set_storage(AgsBuffer *buffer,
+			    AgsWaveStorage *storage,
+			    gpointer data);
+
 /* find */
 GList* ags_buffer_find_range_x(GList *buffer,
 			       guint64 start_x, guint64 end_x);
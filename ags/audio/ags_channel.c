@@ -1313,11 +1313,17 @@ ags_channel_init(AgsChannel *channel)
 
   channel->play = NULL;
 
+  ags_recall_snapshot_slot_init(&(channel->play_snapshot),
+				&(channel->play_mutex));
+
   /* recall */
   g_rec_mutex_init(&(channel->recall_mutex));
 
   channel->recall = NULL;
 
+  ags_recall_snapshot_slot_init(&(channel->recall_snapshot),
+				&(channel->recall_mutex));
+
   /* data */
   channel->line_widget = NULL;
   channel->file_data = NULL;
@@ -2135,6 +2141,9 @@ ags_channel_dispose(GObject *gobject)
 
     channel->play = NULL;
 
+    ags_recall_snapshot_slot_publish(&(channel->play_snapshot),
+				     NULL);
+
     g_rec_mutex_unlock(play_mutex);
 
     while(list != NULL){
@@ -2160,6 +2169,9 @@ ags_channel_dispose(GObject *gobject)
       start_list = channel->recall;
 
     channel->recall = NULL;
+
+    ags_recall_snapshot_slot_publish(&(channel->recall_snapshot),
+				     NULL);
   
     while(list != NULL){
       list_next = list->next;
@@ -2373,6 +2385,9 @@ ags_channel_finalize(GObject *gobject)
 
     channel->play = NULL;
 
+    ags_recall_snapshot_slot_publish(&(channel->play_snapshot),
+				     NULL);
+
     g_rec_mutex_unlock(play_mutex);
 
     while(list != NULL){
@@ -2398,6 +2413,9 @@ ags_channel_finalize(GObject *gobject)
       start_list = channel->recall;
 
     channel->recall = NULL;
+
+    ags_recall_snapshot_slot_publish(&(channel->recall_snapshot),
+				     NULL);
   
     while(list != NULL){
       list_next = list->next;
@@ -2431,6 +2449,10 @@ ags_channel_finalize(GObject *gobject)
     g_list_free_full(start_list,
 		     g_object_unref);
   }
+
+  /* snapshot */
+  ags_recall_snapshot_slot_clear(&(channel->play_snapshot));
+  ags_recall_snapshot_slot_clear(&(channel->recall_snapshot));
   
   /* call parent class */
   G_OBJECT_CLASS(ags_channel_parent_class)->finalize(gobject);
@@ -9003,21 +9025,24 @@ ags_channel_set_play(AgsChannel *channel, GList *play)
 {
   GList *start_play;
   
-  GRecMutex *channel_mutex;
+  GRecMutex *play_mutex;
 
   if(!AGS_IS_CHANNEL(channel)){
     return;
   }
 
-  /* get channel mutex */
-  channel_mutex = AGS_CHANNEL_GET_OBJ_MUTEX(channel);
+  /* get play mutex */
+  play_mutex = AGS_CHANNEL_GET_PLAY_MUTEX(channel);
     
-  g_rec_mutex_lock(channel_mutex);
+  g_rec_mutex_lock(play_mutex);
 
   start_play = channel->play;
   channel->play = play;
+
+  ags_recall_snapshot_slot_publish(&(channel->play_snapshot),
+				   play);
   
-  g_rec_mutex_unlock(channel_mutex);
+  g_rec_mutex_unlock(play_mutex);
 
   g_list_free_full(start_play,
 		   (GDestroyNotify) g_object_unref);
@@ -9063,21 +9088,24 @@ ags_channel_set_recall(AgsChannel *channel, GList *recall)
 {
   GList *start_recall;
   
-  GRecMutex *channel_mutex;
+  GRecMutex *recall_mutex;
 
   if(!AGS_IS_CHANNEL(channel)){
     return;
   }
 
-  /* get channel mutex */
-  channel_mutex = AGS_CHANNEL_GET_OBJ_MUTEX(channel);
+  /* get recall mutex */
+  recall_mutex = AGS_CHANNEL_GET_RECALL_MUTEX(channel);
     
-  g_rec_mutex_lock(channel_mutex);
+  g_rec_mutex_lock(recall_mutex);
 
   start_recall = channel->recall;
   channel->recall = recall;
+
+  ags_recall_snapshot_slot_publish(&(channel->recall_snapshot),
+				   recall);
   
-  g_rec_mutex_unlock(channel_mutex);
+  g_rec_mutex_unlock(recall_mutex);
 
   g_list_free_full(start_recall,
 		   (GDestroyNotify) g_object_unref);
@@ -9155,6 +9183,9 @@ ags_channel_add_recall(AgsChannel *channel, GObject *recall,
     
       channel->play = g_list_prepend(channel->play,
 				     recall);
+
+      ags_recall_snapshot_slot_publish(&(channel->play_snapshot),
+				       channel->play);
     }
 
     g_rec_mutex_unlock(play_mutex);
@@ -9172,6 +9203,9 @@ ags_channel_add_recall(AgsChannel *channel, GObject *recall,
     
       channel->recall = g_list_prepend(channel->recall,
 				       recall);
+
+      ags_recall_snapshot_slot_publish(&(channel->recall_snapshot),
+				       channel->recall);
     }
 
     g_rec_mutex_unlock(recall_mutex);
@@ -9262,6 +9296,9 @@ ags_channel_insert_recall(AgsChannel *channel, GObject *recall,
       channel->play = g_list_insert(channel->play,
 				    recall,
 				    position);
+
+      ags_recall_snapshot_slot_publish(&(channel->play_snapshot),
+				       channel->play);
     }
 
     g_rec_mutex_unlock(play_mutex);
@@ -9280,6 +9317,9 @@ ags_channel_insert_recall(AgsChannel *channel, GObject *recall,
       channel->recall = g_list_insert(channel->recall,
 				      recall,
 				      position);
+
+      ags_recall_snapshot_slot_publish(&(channel->recall_snapshot),
+				       channel->recall);
     }
 
     g_rec_mutex_unlock(recall_mutex);
@@ -9332,6 +9372,9 @@ ags_channel_remove_recall(AgsChannel *channel, GObject *recall,
 
       channel->play = g_list_remove(channel->play,
 				    recall);
+
+      ags_recall_snapshot_slot_publish(&(channel->play_snapshot),
+				       channel->play);
     }
 
     g_rec_mutex_unlock(play_mutex);
@@ -9349,6 +9392,9 @@ ags_channel_remove_recall(AgsChannel *channel, GObject *recall,
       
       channel->recall = g_list_remove(channel->recall,
 				      recall);
+
+      ags_recall_snapshot_slot_publish(&(channel->recall_snapshot),
+				       channel->recall);
     }
 
     g_rec_mutex_unlock(recall_mutex);
@@ -9977,10 +10023,12 @@ ags_channel_real_play_recall(AgsChannel *channel,
 {
   AgsRecall *recall;
   AgsRecyclingContext *parent_recycling_context, *recycling_context;
+  AgsRecallSnapshot *snapshot;
+  AgsRecallSnapshotSlot *snapshot_slot;
   
-  GList *list_start, *list;
-
   guint sound_scope;
+  guint i;
+  gint position;
   AgsSoundStagingFlags current_staging_flags;
   static const guint staging_mask = (AGS_SOUND_STAGING_RUN_INIT_PRE |
 				     AGS_SOUND_STAGING_RUN_INIT_INTER |
@@ -10023,13 +10071,10 @@ ags_channel_real_play_recall(AgsChannel *channel,
 
   sound_scope = recall_id->sound_scope;
 
-  g_rec_mutex_unlock(recall_id_mutex);
-
-  recycling_context = NULL;
+  /* the recall id holds the reference while playing */
+  recycling_context = recall_id->recycling_context;
 
-  g_object_get(recall_id,
-	       "recycling-context", &recycling_context,
-	       NULL);
+  g_rec_mutex_unlock(recall_id_mutex);
   
   /* get channel mutex */
   channel_mutex = AGS_CHANNEL_GET_OBJ_MUTEX(channel);
@@ -10050,64 +10095,51 @@ ags_channel_real_play_recall(AgsChannel *channel,
   }
 #endif
   
-  /* get recycling context mutex */
-  recycling_context_mutex = AGS_RECYCLING_CONTEXT_GET_OBJ_MUTEX(recycling_context);
-
   /* get parent recycling context */
   parent_recycling_context = NULL;
-  
-  g_object_get(recycling_context,
-	       "parent", &parent_recycling_context,
-	       NULL);
 
-  /* get the appropriate lists */
-  if(parent_recycling_context == NULL){
-    GRecMutex *play_mutex;
-
-    /* get play mutex */
-    play_mutex = AGS_CHANNEL_GET_PLAY_MUTEX(channel);
-
-    /* copy play context */
-    g_rec_mutex_lock(play_mutex);
+  if(recycling_context != NULL){
+    /* get recycling context mutex */
+    recycling_context_mutex = AGS_RECYCLING_CONTEXT_GET_OBJ_MUTEX(recycling_context);
 
-    list_start = g_list_copy_deep(channel->play,
-				  (GCopyFunc) g_object_ref,
-				  NULL);
+    g_rec_mutex_lock(recycling_context_mutex);
 
-    g_rec_mutex_unlock(play_mutex);
+    parent_recycling_context = recycling_context->parent;
+    
+    g_rec_mutex_unlock(recycling_context_mutex);
+  }
 
-    /* reverse play context */
-    list =
-      list_start = g_list_reverse(list_start);
+  /* get the appropriate snapshot */
+  if(parent_recycling_context == NULL){
+    snapshot_slot = &(channel->play_snapshot);
   }else{
-    GRecMutex *recall_mutex;
+    snapshot_slot = &(channel->recall_snapshot);
+  }
 
-    /* get recall mutex */
-    recall_mutex = AGS_CHANNEL_GET_RECALL_MUTEX(channel);
+  snapshot = ags_recall_snapshot_slot_acquire(snapshot_slot);
 
-    /* copy recall context */
-    g_rec_mutex_lock(recall_mutex);
+  if(snapshot == NULL){
+    ags_recall_snapshot_slot_release(snapshot_slot,
+				     snapshot);
 
-    list_start = g_list_copy_deep(channel->recall,
-				  (GCopyFunc) g_object_ref,
-				  NULL);
-    
-    g_rec_mutex_unlock(recall_mutex);
-
-    /* reverse recall context */
-    list =
-      list_start = g_list_reverse(list_start);
+    return;
   }
   
   /* automate, midi 1 and 2 control change */
   staging_flags = staging_flags & staging_mask;
 
-  while(list != NULL){
-    recall = AGS_RECALL(list->data);
+  if((AGS_SOUND_STAGING_AUTOMATE & (staging_flags)) != 0 ||
+     (AGS_SOUND_STAGING_MIDI1_CONTROL_CHANGE & (staging_flags)) != 0 ||
+     (AGS_SOUND_STAGING_MIDI2_CONTROL_CHANGE & (staging_flags)) != 0){
+    for(i = 0; i < snapshot->length; i++){
+      recall = snapshot->recall[i];
+
+      if(!AGS_IS_RECALL_CHANNEL(recall)){
+	continue;
+      }
     
-    /* play stages */
-    if((AGS_SOUND_STAGING_AUTOMATE & (staging_flags)) != 0){
-      if(AGS_IS_RECALL_CHANNEL(recall)){
+      /* play stages */
+      if((AGS_SOUND_STAGING_AUTOMATE & (staging_flags)) != 0){
 	ags_recall_set_staging_flags(recall,
 				     AGS_SOUND_STAGING_AUTOMATE);
 
@@ -10115,10 +10147,8 @@ ags_channel_real_play_recall(AgsChannel *channel,
 	ags_recall_unset_staging_flags(recall,
 				       AGS_SOUND_STAGING_AUTOMATE);
       }
-    }
     
-    if((AGS_SOUND_STAGING_MIDI1_CONTROL_CHANGE & (staging_flags)) != 0){
-      if(AGS_IS_RECALL_CHANNEL(recall)){
+      if((AGS_SOUND_STAGING_MIDI1_CONTROL_CHANGE & (staging_flags)) != 0){
 	ags_recall_set_staging_flags(recall,
 				     AGS_SOUND_STAGING_MIDI1_CONTROL_CHANGE);
 
@@ -10126,10 +10156,8 @@ ags_channel_real_play_recall(AgsChannel *channel,
 	ags_recall_unset_staging_flags(recall,
 				       AGS_SOUND_STAGING_MIDI1_CONTROL_CHANGE);
       }
-    }
     
-    if((AGS_SOUND_STAGING_MIDI2_CONTROL_CHANGE & (staging_flags)) != 0){
-      if(AGS_IS_RECALL_CHANNEL(recall)){
+      if((AGS_SOUND_STAGING_MIDI2_CONTROL_CHANGE & (staging_flags)) != 0){
 	ags_recall_set_staging_flags(recall,
 				     AGS_SOUND_STAGING_MIDI2_CONTROL_CHANGE);
 
@@ -10138,8 +10166,6 @@ ags_channel_real_play_recall(AgsChannel *channel,
 				       AGS_SOUND_STAGING_MIDI2_CONTROL_CHANGE);
       }
     }
-      
-    list = list->next;
   }
 
   staging_flags = staging_flags & (~AGS_SOUND_STAGING_AUTOMATE);
@@ -10148,30 +10174,22 @@ ags_channel_real_play_recall(AgsChannel *channel,
   
   /* play */
   if(AGS_IS_RECYCLING_CONTEXT(recycling_context)){
-    list = list_start;
+    position = 0;
   
-    while((list = ags_recall_find_recycling_context(list,
-						    (GObject *) recycling_context)) != NULL){
-      recall = AGS_RECALL(list->data);
+    while((position = ags_recall_snapshot_find_recycling_context(snapshot, (guint) position,
+								 (GObject *) recycling_context)) != -1){
+      recall = snapshot->recall[position];
     
       /* play stages */
       ags_recall_set_staging_flags(recall,
 				   staging_flags);
 
-      list = list->next;
+      position++;
     }
   }
   
-  g_list_free_full(list_start,
-		   g_object_unref);
-
-  if(parent_recycling_context != NULL){
-    g_object_unref(parent_recycling_context);
-  }
-  
-  if(recycling_context != NULL){
-    g_object_unref(recycling_context);
-  }
+  ags_recall_snapshot_slot_release(snapshot_slot,
+				   snapshot);
   
   //FIXME:JK: uncomment
   //  ags_channel_set_staging_flags(channel, sound_scope,
@@ -28,6 +28,7 @@
 #include <ags/audio/ags_sound_enums.h>
 #include <ags/audio/ags_recall_id.h>
 #include <ags/audio/ags_recall.h>
+#include <ags/audio/ags_recall_snapshot.h>
 #include <ags/audio/ags_recycling.h>
 #include <ags/audio/ags_notation.h>
 
@@ -149,10 +150,12 @@ struct _AgsChannel
   GRecMutex play_mutex;
 
   GList *play;
+  AgsRecallSnapshotSlot play_snapshot;
 
   GRecMutex recall_mutex;
 
   GList *recall;
+  AgsRecallSnapshotSlot recall_snapshot;
 
   gpointer line_widget;
   gpointer file_data;
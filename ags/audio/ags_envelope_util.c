@@ -21,6 +21,7 @@
 
 #include <ags/audio/ags_audio_buffer_util.h>
 #include <ags/audio/ags_vector_256_manager.h>
+#include <ags/audio/ags_scratch_arena.h>
 
 #if defined(AGS_OSX_ACCELERATE_BUILTIN_FUNCTIONS)
 #include <Accelerate/Accelerate.h>
@@ -705,17 +706,17 @@ ags_envelope_util_compute_s8(AgsEnvelopeUtil *envelope_util)
   i_stop = envelope_util->buffer_length - (envelope_util->buffer_length % 8);
 
 #if defined(AGS_VECTOR_256_FUNCTIONS)
-  AgsVector256Manager *vector_256_manager = ags_vector_256_manager_get_instance();
+  AgsScratchArena *scratch_arena = ags_scratch_arena_get_thread_default();
   
   while(i + 256 <= i_stop){
     AgsVectorArr *buffer_arr, *sine_arr, *volume_arr;
 
     guint j;
     
-    while(!ags_vector_256_manager_try_acquire_triple(vector_256_manager,
-						     AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE,
-						     &buffer_arr, &sine_arr, &volume_arr)){
-      g_thread_yield();
+    if(!ags_scratch_arena_acquire_triple(scratch_arena,
+					 AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE,
+					 &buffer_arr, &sine_arr, &volume_arr)){
+      break;
     }
 
     ags_audio_buffer_util_fill_v8double_from_s8(NULL,
@@ -760,12 +761,12 @@ ags_envelope_util_compute_s8(AgsEnvelopeUtil *envelope_util)
 					       buffer_arr->vector.vec_double->mem_double, 1,
 					       256);
 
-    ags_vector_256_manager_release(vector_256_manager,
-				   buffer_arr);
-    ags_vector_256_manager_release(vector_256_manager,
-				   sine_arr);
-    ags_vector_256_manager_release(vector_256_manager,
-				   volume_arr);
+    ags_scratch_arena_release(scratch_arena,
+			      buffer_arr);
+    ags_scratch_arena_release(scratch_arena,
+			      sine_arr);
+    ags_scratch_arena_release(scratch_arena,
+			      volume_arr);
 
     destination += (256 * destination_stride);
     source += (256 * source_stride);
@@ -983,17 +984,17 @@ ags_envelope_util_compute_s16(AgsEnvelopeUtil *envelope_util)
   i_stop = envelope_util->buffer_length - (envelope_util->buffer_length % 8);
 
 #if defined(AGS_VECTOR_256_FUNCTIONS)
-  AgsVector256Manager *vector_256_manager = ags_vector_256_manager_get_instance();
+  AgsScratchArena *scratch_arena = ags_scratch_arena_get_thread_default();
   
   while(i + 256 <= i_stop){
     AgsVectorArr *buffer_arr, *sine_arr, *volume_arr;
 
     guint j;
     
-    while(!ags_vector_256_manager_try_acquire_triple(vector_256_manager,
-						     AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE,
-						     &buffer_arr, &sine_arr, &volume_arr)){
-      g_thread_yield();
+    if(!ags_scratch_arena_acquire_triple(scratch_arena,
+					 AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE,
+					 &buffer_arr, &sine_arr, &volume_arr)){
+      break;
     }
 
     ags_audio_buffer_util_fill_v8double_from_s16(NULL,
@@ -1038,12 +1039,12 @@ ags_envelope_util_compute_s16(AgsEnvelopeUtil *envelope_util)
 						buffer_arr->vector.vec_double->mem_double, 1,
 						256);
 
-    ags_vector_256_manager_release(vector_256_manager,
-				   buffer_arr);
-    ags_vector_256_manager_release(vector_256_manager,
-				   sine_arr);
-    ags_vector_256_manager_release(vector_256_manager,
-				   volume_arr);
+    ags_scratch_arena_release(scratch_arena,
+			      buffer_arr);
+    ags_scratch_arena_release(scratch_arena,
+			      sine_arr);
+    ags_scratch_arena_release(scratch_arena,
+			      volume_arr);
 
     destination += (256 * destination_stride);
     source += (256 * source_stride);
@@ -1261,17 +1262,17 @@ ags_envelope_util_compute_s24(AgsEnvelopeUtil *envelope_util)
   i_stop = envelope_util->buffer_length - (envelope_util->buffer_length % 8);
 
 #if defined(AGS_VECTOR_256_FUNCTIONS)
-  AgsVector256Manager *vector_256_manager = ags_vector_256_manager_get_instance();
+  AgsScratchArena *scratch_arena = ags_scratch_arena_get_thread_default();
   
   while(i + 256 <= i_stop){
     AgsVectorArr *buffer_arr, *sine_arr, *volume_arr;
 
     guint j;
     
-    while(!ags_vector_256_manager_try_acquire_triple(vector_256_manager,
-						     AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE,
-						     &buffer_arr, &sine_arr, &volume_arr)){
-      g_thread_yield();
+    if(!ags_scratch_arena_acquire_triple(scratch_arena,
+					 AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE,
+					 &buffer_arr, &sine_arr, &volume_arr)){
+      break;
     }
 
     ags_audio_buffer_util_fill_v8double_from_s32(NULL,
@@ -1316,12 +1317,12 @@ ags_envelope_util_compute_s24(AgsEnvelopeUtil *envelope_util)
 						buffer_arr->vector.vec_double->mem_double, 1,
 						256);
 
-    ags_vector_256_manager_release(vector_256_manager,
-				   buffer_arr);
-    ags_vector_256_manager_release(vector_256_manager,
-				   sine_arr);
-    ags_vector_256_manager_release(vector_256_manager,
-				   volume_arr);
+    ags_scratch_arena_release(scratch_arena,
+			      buffer_arr);
+    ags_scratch_arena_release(scratch_arena,
+			      sine_arr);
+    ags_scratch_arena_release(scratch_arena,
+			      volume_arr);
 
     destination += (256 * destination_stride);
     source += (256 * source_stride);
@@ -1539,17 +1540,17 @@ ags_envelope_util_compute_s32(AgsEnvelopeUtil *envelope_util)
   i_stop = envelope_util->buffer_length - (envelope_util->buffer_length % 8);
 
 #if defined(AGS_VECTOR_256_FUNCTIONS)
-  AgsVector256Manager *vector_256_manager = ags_vector_256_manager_get_instance();
+  AgsScratchArena *scratch_arena = ags_scratch_arena_get_thread_default();
   
   while(i + 256 <= i_stop){
     AgsVectorArr *buffer_arr, *sine_arr, *volume_arr;
 
     guint j;
     
-    while(!ags_vector_256_manager_try_acquire_triple(vector_256_manager,
-						     AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE,
-						     &buffer_arr, &sine_arr, &volume_arr)){
-      g_thread_yield();
+    if(!ags_scratch_arena_acquire_triple(scratch_arena,
+					 AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE,
+					 &buffer_arr, &sine_arr, &volume_arr)){
+      break;
     }
 
     ags_audio_buffer_util_fill_v8double_from_s32(NULL,
@@ -1594,12 +1595,12 @@ ags_envelope_util_compute_s32(AgsEnvelopeUtil *envelope_util)
 						buffer_arr->vector.vec_double->mem_double, 1,
 						256);
 
-    ags_vector_256_manager_release(vector_256_manager,
-				   buffer_arr);
-    ags_vector_256_manager_release(vector_256_manager,
-				   sine_arr);
-    ags_vector_256_manager_release(vector_256_manager,
-				   volume_arr);
+    ags_scratch_arena_release(scratch_arena,
+			      buffer_arr);
+    ags_scratch_arena_release(scratch_arena,
+			      sine_arr);
+    ags_scratch_arena_release(scratch_arena,
+			      volume_arr);
 
     destination += (256 * destination_stride);
     source += (256 * source_stride);
@@ -1817,17 +1818,17 @@ ags_envelope_util_compute_s64(AgsEnvelopeUtil *envelope_util)
   i_stop = envelope_util->buffer_length - (envelope_util->buffer_length % 8);
 
 #if defined(AGS_VECTOR_256_FUNCTIONS)
-  AgsVector256Manager *vector_256_manager = ags_vector_256_manager_get_instance();
+  AgsScratchArena *scratch_arena = ags_scratch_arena_get_thread_default();
   
   while(i + 256 <= i_stop){
     AgsVectorArr *buffer_arr, *sine_arr, *volume_arr;
 
     guint j;
     
-    while(!ags_vector_256_manager_try_acquire_triple(vector_256_manager,
-						     AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE,
-						     &buffer_arr, &sine_arr, &volume_arr)){
-      g_thread_yield();
+    if(!ags_scratch_arena_acquire_triple(scratch_arena,
+					 AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE,
+					 &buffer_arr, &sine_arr, &volume_arr)){
+      break;
     }
 
     ags_audio_buffer_util_fill_v8double_from_s64(NULL,
@@ -1872,12 +1873,12 @@ ags_envelope_util_compute_s64(AgsEnvelopeUtil *envelope_util)
 						buffer_arr->vector.vec_double->mem_double, 1,
 						256);
 
-    ags_vector_256_manager_release(vector_256_manager,
-				   buffer_arr);
-    ags_vector_256_manager_release(vector_256_manager,
-				   sine_arr);
-    ags_vector_256_manager_release(vector_256_manager,
-				   volume_arr);
+    ags_scratch_arena_release(scratch_arena,
+			      buffer_arr);
+    ags_scratch_arena_release(scratch_arena,
+			      sine_arr);
+    ags_scratch_arena_release(scratch_arena,
+			      volume_arr);
 
     destination += (256 * destination_stride);
     source += (256 * source_stride);
@@ -2100,17 +2101,17 @@ ags_envelope_util_compute_float(AgsEnvelopeUtil *envelope_util)
     ags_v8double v_sine;
 
 #if defined(AGS_VECTOR_256_FUNCTIONS)
-    AgsVector256Manager *vector_256_manager = ags_vector_256_manager_get_instance();
+    AgsScratchArena *scratch_arena = ags_scratch_arena_get_thread_default();
   
     while(i + 256 <= i_stop){
       AgsVectorArr *buffer_arr, *sine_arr, *volume_arr;
 
       guint j;
     
-      while(!ags_vector_256_manager_try_acquire_triple(vector_256_manager,
-						       AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE,
-						       &buffer_arr, &sine_arr, &volume_arr)){
-	g_thread_yield();
+      if(!ags_scratch_arena_acquire_triple(scratch_arena,
+					   AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE,
+					   &buffer_arr, &sine_arr, &volume_arr)){
+	break;
       }
 
       ags_audio_buffer_util_fill_v8double_from_float(NULL,
@@ -2155,12 +2156,12 @@ ags_envelope_util_compute_float(AgsEnvelopeUtil *envelope_util)
 						    buffer_arr->vector.vec_double->mem_double, 1,
 						    256);
 
-      ags_vector_256_manager_release(vector_256_manager,
-				     buffer_arr);
-      ags_vector_256_manager_release(vector_256_manager,
-				     sine_arr);
-      ags_vector_256_manager_release(vector_256_manager,
-				     volume_arr);
+      ags_scratch_arena_release(scratch_arena,
+				buffer_arr);
+      ags_scratch_arena_release(scratch_arena,
+				sine_arr);
+      ags_scratch_arena_release(scratch_arena,
+				volume_arr);
 
       destination += (256 * destination_stride);
       source += (256 * source_stride);
@@ -2373,17 +2374,17 @@ ags_envelope_util_compute_double(AgsEnvelopeUtil *envelope_util)
   i_stop = envelope_util->buffer_length - (envelope_util->buffer_length % 8);
 
 #if defined(AGS_VECTOR_256_FUNCTIONS)
-  AgsVector256Manager *vector_256_manager = ags_vector_256_manager_get_instance();
+  AgsScratchArena *scratch_arena = ags_scratch_arena_get_thread_default();
   
   while(i + 256 <= i_stop){
     AgsVectorArr *buffer_arr, *sine_arr, *volume_arr;
 
     guint j;
     
-    while(!ags_vector_256_manager_try_acquire_triple(vector_256_manager,
-						     AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE,
-						     &buffer_arr, &sine_arr, &volume_arr)){
-      g_thread_yield();
+    if(!ags_scratch_arena_acquire_triple(scratch_arena,
+					 AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE,
+					 &buffer_arr, &sine_arr, &volume_arr)){
+      break;
     }
 
     ags_audio_buffer_util_fill_v8double(NULL,
@@ -2428,12 +2429,12 @@ ags_envelope_util_compute_double(AgsEnvelopeUtil *envelope_util)
 					 buffer_arr->vector.vec_double->mem_double, 1,
 					 256);
     
-    ags_vector_256_manager_release(vector_256_manager,
-				   buffer_arr);
-    ags_vector_256_manager_release(vector_256_manager,
-				   sine_arr);
-    ags_vector_256_manager_release(vector_256_manager,
-				   volume_arr);
+    ags_scratch_arena_release(scratch_arena,
+			      buffer_arr);
+    ags_scratch_arena_release(scratch_arena,
+			      sine_arr);
+    ags_scratch_arena_release(scratch_arena,
+			      volume_arr);
 
     destination += (256 * destination_stride);
     source += (256 * source_stride);
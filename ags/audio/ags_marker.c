@@ -19,6 +19,8 @@
 
 #include <ags/audio/ags_marker.h>
 
+#include <ags/audio/ags_program.h>
+
 #include <stdlib.h>
 
 #include <ags/i18n.h>
@@ -240,6 +242,8 @@ ags_marker_set_property(GObject *gobject,
       marker->x = g_value_get_uint(value);
 
       g_rec_mutex_unlock(marker_mutex);
+
+      ags_program_global_increment_modified_stamp();
     }
     break;
   case PROP_Y:
@@ -249,6 +253,8 @@ ags_marker_set_property(GObject *gobject,
       marker->y = g_value_get_double(value);
 
       g_rec_mutex_unlock(marker_mutex);
+
+      ags_program_global_increment_modified_stamp();
     }
     break;
   case PROP_MARKER_NAME:
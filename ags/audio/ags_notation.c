@@ -45,6 +45,12 @@ void ags_notation_get_property(GObject *gobject,
 void ags_notation_dispose(GObject *gobject);
 void ags_notation_finalize(GObject *gobject);
 
+void ags_notation_validate_note_index(AgsNotation *notation);
+void ags_notation_attach_note(AgsNotation *notation,
+			      AgsNote *note);
+void ags_notation_detach_note(AgsNotation *notation,
+			      AgsNote *note);
+
 void ags_notation_insert_native_piano_from_clipboard_version_0_3_12(AgsNotation *notation,
 								    xmlNode *root_node, char *version,
 								    char *base_frequency,
@@ -82,6 +88,9 @@ void ags_notation_insert_native_piano_from_clipboard(AgsNotation *notation,
  * to remove it again.
  *
  * In order to copy or cut notes you select them first by calling ags_notation_add_region_to_selection().
+ *
+ * Point, region and offset lookups of the note list are answered by an
+ * #AgsNoteIndex, rebuilt lazily after the note list was modified.
  */
 
 enum{
@@ -254,6 +263,9 @@ ags_notation_init(AgsNotation *notation)
 
   notation->note = NULL;
   notation->selection = NULL;
+
+  notation->note_revision = 1;
+  notation->note_index = ags_note_index_alloc();
 }
 
 void
@@ -454,6 +466,9 @@ ags_notation_dispose(GObject *gobject)
   list = notation->note;
 
   while(list != NULL){
+    ags_notation_detach_note(notation,
+			     list->data);
+    
     g_object_run_dispose(G_OBJECT(list->data));
     
     list = list->next;
@@ -466,6 +481,8 @@ ags_notation_dispose(GObject *gobject)
 
   notation->note = NULL;
   notation->selection = NULL;
+
+  ags_atomic_uint_increment(&(notation->note_revision));
     
   /* call parent */
   G_OBJECT_CLASS(ags_notation_parent_class)->dispose(gobject);
@@ -494,6 +511,9 @@ ags_notation_finalize(GObject *gobject)
 
   g_list_free_full(notation->selection,
 		   g_object_unref);
+
+  /* note index */
+  ags_note_index_free(notation->note_index);
   
   /* call parent */
   G_OBJECT_CLASS(ags_notation_parent_class)->finalize(gobject);
@@ -519,6 +539,57 @@ ags_notation_get_obj_mutex(AgsNotation *notation)
   return(AGS_NOTATION_GET_OBJ_MUTEX(notation));
 }
 
+void
+ags_notation_validate_note_index(AgsNotation *notation)
+{
+  /* the caller holds the notation mutex */
+  guint note_revision;
+  
+  /* the caller holds the notation mutex */
+  note_revision = ags_atomic_uint_get(&(notation->note_revision));
+  
+  if(!ags_note_index_is_valid(notation->note_index,
+			      note_revision)){
+    ags_note_index_rebuild(notation->note_index,
+			   notation->note,
+			   note_revision);
+  }
+}
+
+void
+ags_notation_attach_note(AgsNotation *notation,
+			 AgsNote *note)
+{
+  GRecMutex *note_mutex;
+
+  /* the caller holds the notation mutex */
+  note_mutex = AGS_NOTE_GET_OBJ_MUTEX(note);
+
+  g_rec_mutex_lock(note_mutex);
+
+  note->notation = (GObject *) notation;
+  
+  g_rec_mutex_unlock(note_mutex);
+}
+
+void
+ags_notation_detach_note(AgsNotation *notation,
+			 AgsNote *note)
+{
+  GRecMutex *note_mutex;
+
+  /* the caller holds the notation mutex */
+  note_mutex = AGS_NOTE_GET_OBJ_MUTEX(note);
+
+  g_rec_mutex_lock(note_mutex);
+
+  if(note->notation == (GObject *) notation){
+    note->notation = NULL;
+  }
+  
+  g_rec_mutex_unlock(note_mutex);
+}
+
 /**
  * ags_notation_test_flags:
  * @notation: the #AgsNotation
@@ -1220,6 +1291,7 @@ void
 ags_notation_set_note(AgsNotation *notation, GList *note)
 {
   GList *start_note;
+  GList *list;
   
   GRecMutex *notation_mutex;
 
@@ -1233,7 +1305,20 @@ ags_notation_set_note(AgsNotation *notation, GList *note)
   g_rec_mutex_lock(notation_mutex);
 
   start_note = notation->note;
+
+  for(list = start_note; list != NULL; list = list->next){
+    ags_notation_detach_note(notation,
+			     list->data);
+  }
+  
   notation->note = note;
+
+  for(list = note; list != NULL; list = list->next){
+    ags_notation_attach_note(notation,
+			     list->data);
+  }
+
+  ags_atomic_uint_increment(&(notation->note_revision));
   
   g_rec_mutex_unlock(notation_mutex);
 
@@ -1369,10 +1454,171 @@ ags_notation_add_note(AgsNotation *notation,
       notation->note = g_list_insert_sorted(notation->note,
 					    note,
 					    (GCompareFunc) ags_note_sort_func);
+
+      ags_notation_attach_note(notation,
+			       note);
+
+      ags_atomic_uint_increment(&(notation->note_revision));
+    }
+  }
+  
+  g_rec_mutex_unlock(notation_mutex);
+}
+
+/**
+ * ags_notation_add_note_all:
+ * @notation: the #AgsNotation
+ * @note: (element-type AgsAudio.Note) (transfer none): the #GList-struct containing #AgsNote
+ * @use_selection_list: if %TRUE add to selection, else to default notation
+ *
+ * Adds all @note to @notation. The notes are sorted once and merged, so it
+ * costs O(n + m log m) rather than inserting every note sorted.
+ *
+ * Since: 9.1.0
+ */
+void
+ags_notation_add_note_all(AgsNotation *notation,
+			  GList *note,
+			  gboolean use_selection_list)
+{
+  AgsTimestamp *timestamp;
+
+  GHashTable *present;
+  
+  GList *start_list, *list;
+  GList *start_merged;
+  GList *current;
+  
+  guint64 timestamp_x;
+  guint x0;
+  
+  GRecMutex *notation_mutex;
+
+  if(!AGS_IS_NOTATION(notation) ||
+     note == NULL){
+    return;
+  }
+
+  /* get notation mutex */
+  notation_mutex = AGS_NOTATION_GET_OBJ_MUTEX(notation);
+
+  g_object_get(notation,
+	       "timestamp", &timestamp,
+	       NULL);
+
+  timestamp_x = ags_timestamp_get_ags_offset(timestamp);
+  g_object_unref(timestamp);
+
+  /* filter */
+  start_list = NULL;
+  
+  while(note != NULL){
+    if(!AGS_IS_NOTE(note->data)){
+      note = note->next;
+
+      continue;
+    }
+    
+    g_object_get(note->data,
+		 "x0", &x0,
+		 NULL);
+  
+    if(x0 < timestamp_x ||
+       x0 >= timestamp_x + AGS_NOTATION_DEFAULT_OFFSET){
+      g_critical("timestamp not matching note:x0");
+
+      note = note->next;
+      
+      continue;
+    }
+
+    start_list = g_list_prepend(start_list,
+				note->data);
+    
+    note = note->next;
+  }
+
+  /* sort once */
+  start_list = g_list_sort(start_list,
+			   (GCompareFunc) ags_note_sort_func);
+
+  present = g_hash_table_new(g_direct_hash,
+			     g_direct_equal);
+  
+  g_rec_mutex_lock(notation_mutex);
+
+  if(use_selection_list){
+    current = notation->selection;
+  }else{
+    current = notation->note;
+  }
+
+  for(list = current; list != NULL; list = list->next){
+    g_hash_table_add(present,
+		     list->data);
+  }
+
+  /* merge */
+  start_merged = NULL;
+
+  list = start_list;
+  
+  while(current != NULL || list != NULL){
+    if(list != NULL &&
+       g_hash_table_contains(present,
+			     list->data)){
+      list = list->next;
+
+      continue;
+    }
+    
+    if(list == NULL ||
+       (current != NULL &&
+	ags_note_sort_func(current->data, list->data) <= 0)){
+      start_merged = g_list_prepend(start_merged,
+				    current->data);
+
+      current = current->next;
+    }else{
+      g_object_ref(list->data);
+      
+      if(use_selection_list){
+	ags_note_set_flags(list->data,
+			   AGS_NOTE_IS_SELECTED);
+      }else{
+	ags_notation_attach_note(notation,
+				 list->data);
+      }
+
+      g_hash_table_add(present,
+		       list->data);
+      
+      start_merged = g_list_prepend(start_merged,
+				    list->data);
+
+      list = list->next;
     }
   }
+
+  start_merged = g_list_reverse(start_merged);
+  
+  if(use_selection_list){
+    g_list_free(notation->selection);
+
+    notation->selection = start_merged;
+  }else{
+    g_list_free(notation->note);
+
+    notation->note = start_merged;
+    
+    ags_atomic_uint_increment(&(notation->note_revision));
+  }
   
   g_rec_mutex_unlock(notation_mutex);
+
+  g_hash_table_destroy(present);
+  
+  g_list_free(start_list);
 }
 
 /**
@@ -1408,7 +1654,13 @@ ags_notation_remove_note(AgsNotation *notation,
 		   note) != NULL){
       notation->note = g_list_remove(notation->note,
 				     note);
+
+      ags_notation_detach_note(notation,
+			       note);
+      
       g_object_unref(note);
+
+      ags_atomic_uint_increment(&(notation->note_revision));
     }
   }else{
     if(g_list_find(notation->selection,
@@ -1439,10 +1691,9 @@ ags_notation_remove_note_at_position(AgsNotation *notation,
 				     guint x, guint y)
 {
   AgsNote *note;
+  AgsNoteIndex *note_index;
   
-  GList *start_list, *list;
-
-  guint current_x0, current_y;
+  guint i;
   gboolean retval;
 
   GRecMutex *notation_mutex;
@@ -1457,52 +1708,38 @@ ags_notation_remove_note_at_position(AgsNotation *notation,
   /* find note */
   g_rec_mutex_lock(notation_mutex);
 
-  list =
-    start_list = g_list_copy_deep(notation->note,
-				  (GCopyFunc) g_object_ref,
-				  NULL);
-  
-  g_rec_mutex_unlock(notation_mutex);
+  ags_notation_validate_note_index(notation);
 
+  note_index = notation->note_index;
+  
   note = NULL;
 
   retval = FALSE;
-  
-  while(list != NULL){
-    g_object_get(list->data,
-		 "x0", &current_x0,
-		 "y", &current_y,
-		 NULL);
 
-    if(current_x0 == x &&
-       current_y == y){
-      note = list->data;
+  for(i = ags_note_index_lower_bound(note_index, x); i < note_index->length && note_index->entry[i].x0 == x; i++){
+    if(note_index->entry[i].y == y){
+      note = note_index->entry[i].note;
       
       retval = TRUE;
       
       break;
     }
-
-    if(current_x0 > x){
-      break;
-    }
-    
-    list = list->next;
   }
 
   /* delete link and unref */
   if(retval){
-    g_rec_mutex_lock(notation_mutex);
-    
     notation->note = g_list_remove(notation->note,
 				   note);
+
+    ags_notation_detach_note(notation,
+			     note);
+    
     g_object_unref(note);
 
-    g_rec_mutex_unlock(notation_mutex);
+    ags_atomic_uint_increment(&(notation->note_revision));
   }
 
-  g_list_free_full(start_list,
-		   g_object_unref);
+  g_rec_mutex_unlock(notation_mutex);
 
   return(retval);
 }
@@ -1642,11 +1879,18 @@ ags_notation_find_point(AgsNotation *notation,
   /* find note */
   g_rec_mutex_lock(notation_mutex);
 
-  if(use_selection_list){
-    note = notation->selection;
-  }else{
-    note = notation->note;
+  if(!use_selection_list){
+    ags_notation_validate_note_index(notation);
+
+    retval = ags_note_index_find_point(notation->note_index,
+				       x, y);
+    
+    g_rec_mutex_unlock(notation_mutex);
+
+    return(retval);
   }
+  
+  note = notation->selection;
 
   retval = NULL;
   
@@ -1712,13 +1956,31 @@ ags_notation_find_exact_note_256th_point(AgsNotation *notation,
   /* find note */
   g_rec_mutex_lock(notation_mutex);
 
-  if(use_selection_list){
-    note = notation->selection;
-  }else{
-    note = notation->note;
+  retval = NULL;
+
+  if(!use_selection_list){
+    AgsNoteIndex *note_index;
+
+    guint i;
+
+    ags_notation_validate_note_index(notation);
+
+    note_index = notation->note_index;
+
+    for(i = ags_note_index_lower_bound_256th(note_index, x_256th); i < note_index->length && note_index->entry[i].x0_256th == x_256th; i++){
+      if(note_index->entry[i].y == y){
+	retval = note_index->entry[i].note;
+
+	break;
+      }
+    }
+    
+    g_rec_mutex_unlock(notation_mutex);
+
+    return(retval);
   }
 
-  retval = NULL;
+  note = notation->selection;
   
   while(note != NULL){
     current_x0_256th = 0;
@@ -1804,11 +2066,35 @@ ags_notation_find_region(AgsNotation *notation,
   /* find note */
   g_rec_mutex_lock(notation_mutex);
 
-  if(use_selection_list){
-    note = notation->selection;
-  }else{
-    note = notation->note;
+  region = NULL;
+
+  if(!use_selection_list){
+    AgsNoteIndex *note_index;
+
+    guint i;
+
+    ags_notation_validate_note_index(notation);
+
+    note_index = notation->note_index;
+
+    /* the index is sorted, so prepend and reverse once */
+    for(i = ags_note_index_lower_bound(note_index, x0); i < note_index->length && note_index->entry[i].x0 <= x1; i++){
+      current_y = note_index->entry[i].y;
+      
+      if((y0 < y1 && current_y >= y0 && current_y < y1) ||
+	 (y0 > y1 && current_y < y0 && current_y >= y1) ||
+	 (y0 == y1 && current_y == y0)){
+	region = g_list_prepend(region,
+				note_index->entry[i].note);
+      }
+    }
+    
+    g_rec_mutex_unlock(notation_mutex);
+
+    return(g_list_reverse(region));
   }
+  
+  note = notation->selection;
 
   while(note != NULL){
     g_object_get(note->data,
@@ -1822,8 +2108,6 @@ ags_notation_find_region(AgsNotation *notation,
     note = note->next;
   }
 
-  region = NULL;
-
   while(note != NULL){
     g_object_get(note->data,
 		 "x0", &current_x0,
@@ -1894,12 +2178,29 @@ ags_notation_find_offset(AgsNotation *notation,
   /* find note */
   g_rec_mutex_lock(notation_mutex);
 
-  if(use_selection_list){
-    note = notation->selection;
-  }else{
-    note = notation->note;
+  if(!use_selection_list){
+    AgsNoteIndex *note_index;
+
+    guint i;
+
+    ags_notation_validate_note_index(notation);
+
+    note_index = notation->note_index;
+
+    retval = NULL;
+    
+    for(i = ags_note_index_lower_bound(note_index, x); i < note_index->length && note_index->entry[i].x0 == x; i++){
+      retval = g_list_prepend(retval,
+			      g_object_ref(note_index->entry[i].note));
+    }
+    
+    g_rec_mutex_unlock(notation_mutex);
+
+    return(g_list_reverse(retval));
   }
   
+  note = notation->selection;
+  
   current_start = note;
   current_end = g_list_last(note);
   
@@ -2093,11 +2394,26 @@ ags_notation_find_note_256th_range(AgsNotation *notation,
   /* find note */
   g_rec_mutex_lock(notation_mutex);
 
-  if(use_selection_list){
-    start_note = notation->selection;
-  }else{
-    start_note = notation->note;
+  if(!use_selection_list){
+    AgsNoteIndex *note_index;
+
+    guint i;
+
+    ags_notation_validate_note_index(notation);
+
+    note_index = notation->note_index;
+
+    for(i = ags_note_index_lower_bound_256th(note_index, x_256th_lower); i < note_index->length && note_index->entry[i].x0_256th <= x_256th_upper; i++){
+      retval = g_list_prepend(retval,
+			      g_object_ref(note_index->entry[i].note));
+    }
+
+    retval = g_list_reverse(retval);
+    
+    goto ags_notation_find_note_256th_range_END;
   }
+  
+  start_note = notation->selection;
 
   first_match = NULL;
 
@@ -2496,18 +2812,10 @@ ags_notation_add_region_to_selection(AgsNotation *notation,
 
     g_rec_mutex_unlock(notation_mutex);
   }else{
-    list = region;
-    
-    while(list != NULL){
-      if(!ags_notation_is_note_selected(notation, list->data)){
-	/* add */
-	ags_notation_add_note(notation,
-			      list->data,
+    /* add, already selected notes are skipped */
+    ags_notation_add_note_all(notation,
+			      region,
 			      TRUE);
-      }
-      
-      list = list->next;
-    }
     
     g_list_free(region);
   }
@@ -2598,16 +2906,17 @@ ags_notation_add_all_to_selection(AgsNotation *notation)
   /* select all */
   g_rec_mutex_lock(notation_mutex);
 
-  list = notation->note;
-
-  while(list != NULL){
-    ags_notation_add_note(notation,
-			  list->data, TRUE);
-    
-    list = list->next;
-  }
+  list = g_list_copy_deep(notation->note,
+			  (GCopyFunc) g_object_ref,
+			  NULL);
 
   g_rec_mutex_unlock(notation_mutex);
+
+  ags_notation_add_note_all(notation,
+			    list, TRUE);
+
+  g_list_free_full(list,
+		   g_object_unref);
 }
 
 /**
@@ -2781,11 +3090,17 @@ ags_notation_cut_selection(AgsNotation *notation)
   while(selection != NULL){
     notation->note = g_list_remove(notation->note,
 				   selection->data);
+
+    ags_notation_detach_note(notation,
+			     selection->data);
+    
     g_object_unref(selection->data);
 
     selection = selection->next;
   }
 
+  ags_atomic_uint_increment(&(notation->note_revision));
+
   g_rec_mutex_unlock(notation_mutex);
 
   /* free selection */
@@ -2811,6 +3126,8 @@ ags_notation_insert_native_piano_from_clipboard_version_0_3_12(AgsNotation *nota
 
   xmlNode *node;
 
+  GList *start_note, *current;
+
   char *x0, *x1, *y;
   char *x0_256th, *x1_256th;
   gchar *offset;
@@ -2825,6 +3142,8 @@ ags_notation_insert_native_piano_from_clipboard_version_0_3_12(AgsNotation *nota
 
   node = root_node->children;
 
+  start_note = NULL;
+
   /* retrieve x values for resetting */
   base_x_difference = 0;
   subtract_x = FALSE;
@@ -3118,16 +3437,44 @@ ags_notation_insert_native_piano_from_clipboard_version_0_3_12(AgsNotation *nota
 #ifdef AGS_DEBUG
 	  g_message("adding note at: [%u,%u|%u]\n", x0_val, x1_val, y_val);
 #endif
-	    
-	  ags_notation_add_note(notation,
-				note,
-				FALSE);
+
+	  /* add all at once */
+	  start_note = g_list_prepend(start_note,
+				      note);
 	}
       }
     }
     
     node = node->next;
   }
+
+  start_note = g_list_sort(start_note,
+			   (GCompareFunc) ags_note_sort_func);
+
+  /* duplicates within the pasted notes */
+  if(no_duplicates){
+    current = start_note;
+
+    while(current != NULL &&
+	  current->next != NULL){
+      if(AGS_NOTE(current->data)->x_256th[0] == AGS_NOTE(current->next->data)->x_256th[0] &&
+	 AGS_NOTE(current->data)->y == AGS_NOTE(current->next->data)->y){
+	g_object_unref(current->next->data);
+
+	start_note = g_list_delete_link(start_note,
+					current->next);
+      }else{
+	current = current->next;
+      }
+    }
+  }
+
+  ags_notation_add_note_all(notation,
+			    start_note,
+			    FALSE);
+
+  g_list_free_full(start_note,
+		   (GDestroyNotify) g_object_unref);
 }
 
 /**
@@ -3833,6 +4180,8 @@ ags_notation_from_raw_midi(guchar *raw_midi,
   AgsNote* midi_note[128];
   AgsMidiParser *midi_parser;
 
+  GList *start_note;
+
   AgsMidiUtil midi_util;
   
   xmlDoc *midi_doc;
@@ -3856,6 +4205,8 @@ ags_notation_from_raw_midi(guchar *raw_midi,
   notation = ags_notation_new(NULL,
 			      0);
 
+  start_note = NULL;
+
   for(i = 0; i < 128; i++){
     midi_note[i] = NULL;
   }
@@ -3976,10 +4327,10 @@ ags_notation_from_raw_midi(guchar *raw_midi,
 			   NULL);
 
 	      midi_note[note_y] = note;
-	      
-	      ags_notation_add_note(notation,
-				    note,
-				    FALSE);
+
+	      /* add all at once */
+	      start_note = g_list_prepend(start_note,
+					  note);
 	    }
 	  }else if(!xmlStrncmp(event,
 			       "note-off",
@@ -4028,6 +4379,13 @@ ags_notation_from_raw_midi(guchar *raw_midi,
     }
   }
 
+  ags_notation_add_note_all(notation,
+			    start_note,
+			    FALSE);
+
+  g_list_free_full(start_note,
+		   (GDestroyNotify) g_object_unref);
+
   return(notation);
 }
 
@@ -28,6 +28,7 @@
 #include <ags/libags.h>
 
 #include <ags/audio/ags_note.h>
+#include <ags/audio/ags_note_index.h>
 
 G_BEGIN_DECLS
 
@@ -96,6 +97,9 @@ struct _AgsNotation
 
   GList *note;
   GList *selection;
+
+  volatile guint note_revision;
+  AgsNoteIndex *note_index;
 };
 
 struct _AgsNotationClass
@@ -146,6 +150,9 @@ void ags_notation_set_note(AgsNotation *notation,
 void ags_notation_add_note(AgsNotation *notation,
 			   AgsNote *note,
 			   gboolean use_selection_list);
+void ags_notation_add_note_all(AgsNotation *notation,
+			       GList *note,
+			       gboolean use_selection_list);
 void ags_notation_remove_note(AgsNotation *notation,
 			      AgsNote *note,
 			      gboolean use_selection_list);
@@ -18,6 +18,7 @@
  */
 
 #include <ags/audio/ags_note.h>
+#include <ags/audio/ags_notation.h>
 
 #include <ags/audio/midi/ags_midi_smf_util.h>
 
@@ -39,6 +40,8 @@ void ags_note_get_property(GObject *gobject,
 			   GParamSpec *param_spec);
 void ags_note_finalize(GObject *gobject);
 
+void ags_note_increment_notation_revision(AgsNote *note);
+
 /**
  * SECTION:ags_note
  * @short_description: Note class
@@ -511,6 +514,8 @@ ags_note_init(AgsNote *note)
 
   note->x_256th[0] = 0;
   note->x_256th[1] = 16;
+
+  note->notation = NULL;
 }
 
 void
@@ -537,6 +542,8 @@ ags_note_set_property(GObject *gobject,
 
     note->x_256th[0] = 16 * note->x[0];
 
+    ags_note_increment_notation_revision(note);
+
     g_rec_mutex_unlock(note_mutex);
   }
   break;
@@ -548,6 +555,8 @@ ags_note_set_property(GObject *gobject,
 
     note->x_256th[1] = 16 * note->x[1];
 
+    ags_note_increment_notation_revision(note);
+
     g_rec_mutex_unlock(note_mutex);
   }
   break;
@@ -557,6 +566,8 @@ ags_note_set_property(GObject *gobject,
 
     note->y = g_value_get_uint(value);
 
+    ags_note_increment_notation_revision(note);
+
     g_rec_mutex_unlock(note_mutex);
   }
   break;
@@ -722,6 +733,8 @@ ags_note_set_property(GObject *gobject,
 
     note->x_256th[0] = g_value_get_uint(value);
 
+    ags_note_increment_notation_revision(note);
+
     g_rec_mutex_unlock(note_mutex);
   }
   break;
@@ -731,6 +744,8 @@ ags_note_set_property(GObject *gobject,
 
     note->x_256th[1] = g_value_get_uint(value);
 
+    ags_note_increment_notation_revision(note);
+
     g_rec_mutex_unlock(note_mutex);
   }
   break;
@@ -940,6 +955,15 @@ ags_note_finalize(GObject *gobject)
   G_OBJECT_CLASS(ags_note_parent_class)->finalize(gobject);
 }
 
+void
+ags_note_increment_notation_revision(AgsNote *note)
+{
+  /* the caller holds the note mutex, only the owning notation's index is invalidated */
+  if(note->notation != NULL){
+    ags_atomic_uint_increment(&(AGS_NOTATION(note->notation)->note_revision));
+  }
+}
+
 /**
  * ags_note_get_obj_mutex:
  * @note: the #AgsNote
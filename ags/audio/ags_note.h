@@ -106,6 +106,8 @@ struct _AgsNote
   gboolean feed_x_256th;
   
   guint x_256th[2];
+
+  GObject *notation;
 };
 
 struct _AgsNoteClass
@@ -0,0 +1,445 @@
+/* GSequencer - Advanced GTK Sequencer
+ * Copyright (C) 2005-2026 Joël Krähemann
+ *
+ * This file is part of GSequencer.
+ *
+ * GSequencer is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GSequencer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GSequencer.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <ags/audio/ags_note_index.h>
+
+#include <ags/libags.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * SECTION:ags_note_index
+ * @short_description: Interval index of notes
+ * @title: AgsNoteIndex
+ * @section_id:
+ * @include: ags/audio/ags_note_index.h
+ *
+ * #AgsNoteIndex caches the geometry of the notes of an #AgsNotation in a
+ * sorted array. Offset and region lookups do a binary search and point
+ * lookups descend the implicit interval tree, so they cost O(log n + k)
+ * instead of a linear walk doing g_object_get() per note.
+ *
+ * The index is rebuilt lazily as the revision of the notation changed. It
+ * is incremented as the note list is modified or one of its notes changes
+ * x0, x1 or y.
+ */
+
+gint ags_note_index_entry_sort_func(const void *a,
+				    const void *b);
+
+guint ags_note_index_augment(AgsNoteIndex *note_index,
+			     guint lower, guint upper);
+AgsNote* ags_note_index_find_point_recursive(AgsNoteIndex *note_index,
+					     guint lower, guint upper,
+					     guint x, guint y);
+
+GType
+ags_note_index_get_type(void)
+{
+  static gsize g_define_type_id__static = 0;
+
+  if(g_once_init_enter(&g_define_type_id__static)){
+    GType ags_type_note_index = 0;
+
+    ags_type_note_index =
+      g_boxed_type_register_static("AgsNoteIndex",
+				   (GBoxedCopyFunc) ags_note_index_copy,
+				   (GBoxedFreeFunc) ags_note_index_free);
+
+    g_once_init_leave(&g_define_type_id__static, ags_type_note_index);
+  }
+
+  return(g_define_type_id__static);
+}
+
+gint
+ags_note_index_entry_sort_func(const void *a,
+			       const void *b)
+{
+  const AgsNoteIndexEntry *a_entry, *b_entry;
+
+  a_entry = (const AgsNoteIndexEntry *) a;
+  b_entry = (const AgsNoteIndexEntry *) b;
+
+  if(a_entry->x0_256th != b_entry->x0_256th){
+    return((a_entry->x0_256th < b_entry->x0_256th) ? -1: 1);
+  }
+
+  if(a_entry->y != b_entry->y){
+    return((a_entry->y < b_entry->y) ? -1: 1);
+  }
+
+  return(0);
+}
+
+guint
+ags_note_index_augment(AgsNoteIndex *note_index,
+		       guint lower, guint upper)
+{
+  AgsNoteIndexEntry *entry;
+
+  guint middle;
+  guint max_x1, current_max_x1;
+
+  if(lower >= upper){
+    return(0);
+  }
+
+  middle = lower + (upper - lower) / 2;
+
+  entry = &(note_index->entry[middle]);
+  
+  max_x1 = entry->x1;
+
+  current_max_x1 = ags_note_index_augment(note_index,
+					  lower, middle);
+
+  if(current_max_x1 > max_x1){
+    max_x1 = current_max_x1;
+  }
+
+  current_max_x1 = ags_note_index_augment(note_index,
+					  middle + 1, upper);
+
+  if(current_max_x1 > max_x1){
+    max_x1 = current_max_x1;
+  }
+
+  entry->max_x1 = max_x1;
+  
+  return(max_x1);
+}
+
+AgsNote*
+ags_note_index_find_point_recursive(AgsNoteIndex *note_index,
+				    guint lower, guint upper,
+				    guint x, guint y)
+{
+  AgsNoteIndexEntry *entry;
+  AgsNote *note;
+
+  guint middle;
+
+  if(lower >= upper){
+    return(NULL);
+  }
+
+  middle = lower + (upper - lower) / 2;
+
+  entry = &(note_index->entry[middle]);
+
+  /* no note of this subtree ends after x */
+  if(entry->max_x1 <= x){
+    return(NULL);
+  }
+
+  note = ags_note_index_find_point_recursive(note_index,
+					     lower, middle,
+					     x, y);
+
+  if(note != NULL){
+    return(note);
+  }
+
+  /* this entry and the right subtree start after x */
+  if(entry->x0 > x){
+    return(NULL);
+  }
+
+  if(x < entry->x1 &&
+     entry->y == y){
+    return(entry->note);
+  }
+  
+  return(ags_note_index_find_point_recursive(note_index,
+					     middle + 1, upper,
+					     x, y));
+}
+
+/**
+ * ags_note_index_alloc:
+ *
+ * Allocate #AgsNoteIndex-struct.
+ *
+ * Returns: a new #AgsNoteIndex-struct
+ *
+ * Since: 9.1.0
+ */
+AgsNoteIndex*
+ags_note_index_alloc()
+{
+  AgsNoteIndex *ptr;
+
+  ptr = (AgsNoteIndex *) g_new(AgsNoteIndex,
+			       1);
+
+  ptr->revision = 0;
+
+  ptr->length = 0;
+  ptr->allocated_length = 0;
+  ptr->entry = NULL;
+
+  return(ptr);
+}
+
+/**
+ * ags_note_index_copy:
+ * @ptr: the original #AgsNoteIndex-struct
+ *
+ * Create a copy of @ptr.
+ *
+ * Returns: a pointer of the new #AgsNoteIndex-struct
+ *
+ * Since: 9.1.0
+ */
+gpointer
+ags_note_index_copy(AgsNoteIndex *ptr)
+{
+  AgsNoteIndex *new_ptr;
+
+  g_return_val_if_fail(ptr != NULL, NULL);
+
+  new_ptr = (AgsNoteIndex *) g_new(AgsNoteIndex,
+				   1);
+
+  memcpy(new_ptr, ptr, sizeof(AgsNoteIndex));
+
+  new_ptr->allocated_length = ptr->length;
+  new_ptr->entry = NULL;
+
+  if(ptr->length > 0){
+    new_ptr->entry = (AgsNoteIndexEntry *) g_memdup(ptr->entry,
+						     ptr->length * sizeof(AgsNoteIndexEntry));
+  }
+
+  return(new_ptr);
+}
+
+/**
+ * ags_note_index_free:
+ * @ptr: the #AgsNoteIndex-struct
+ *
+ * Free the memory of @ptr.
+ *
+ * Since: 9.1.0
+ */
+void
+ags_note_index_free(AgsNoteIndex *ptr)
+{
+  g_return_if_fail(ptr != NULL);
+
+  g_free(ptr->entry);
+
+  g_free(ptr);
+}
+
+/**
+ * ags_note_index_is_valid:
+ * @note_index: the #AgsNoteIndex-struct
+ * @revision: the revision of the note list
+ *
+ * Check if @note_index is up to date.
+ *
+ * Returns: %TRUE if valid, otherwise %FALSE
+ *
+ * Since: 9.1.0
+ */
+gboolean
+ags_note_index_is_valid(AgsNoteIndex *note_index,
+			guint revision)
+{
+  g_return_val_if_fail(note_index != NULL, FALSE);
+
+  return((note_index->revision == revision) ? TRUE: FALSE);
+}
+
+/**
+ * ags_note_index_rebuild:
+ * @note_index: the #AgsNoteIndex-struct
+ * @note: (element-type AgsAudio.Note) (transfer none): the #GList-struct containing #AgsNote
+ * @revision: the revision of @note
+ *
+ * Rebuild @note_index of @note. As @note is usually sorted already it
+ * costs O(n), otherwise the entries are sorted once.
+ *
+ * Since: 9.1.0
+ */
+void
+ags_note_index_rebuild(AgsNoteIndex *note_index,
+		       GList *note,
+		       guint revision)
+{
+  guint length;
+  guint i;
+  gboolean is_sorted;
+
+  g_return_if_fail(note_index != NULL);
+
+  /* the caller read the revision first, so a concurrent change invalidates again */
+  note_index->revision = revision;
+
+  length = g_list_length(note);
+
+  if(note_index->allocated_length < length){
+    note_index->entry = (AgsNoteIndexEntry *) g_realloc(note_index->entry,
+							length * sizeof(AgsNoteIndexEntry));
+
+    note_index->allocated_length = length;
+  }
+
+  note_index->length = length;
+
+  is_sorted = TRUE;
+  
+  for(i = 0; note != NULL; i++){
+    AgsNote *current;
+    AgsNoteIndexEntry *entry;
+
+    GRecMutex *note_mutex;
+
+    current = note->data;
+    
+    note_mutex = AGS_NOTE_GET_OBJ_MUTEX(current);
+
+    entry = &(note_index->entry[i]);
+
+    entry->note = current;
+
+    g_rec_mutex_lock(note_mutex);
+
+    entry->x0 = current->x[0];
+    entry->x1 = current->x[1];
+    entry->x0_256th = current->x_256th[0];
+    entry->y = current->y;
+
+    g_rec_mutex_unlock(note_mutex);
+
+    if(i > 0 &&
+       ags_note_index_entry_sort_func(&(note_index->entry[i - 1]), entry) > 0){
+      is_sorted = FALSE;
+    }
+    
+    note = note->next;
+  }
+
+  if(!is_sorted){
+    qsort(note_index->entry,
+	  length, sizeof(AgsNoteIndexEntry),
+	  ags_note_index_entry_sort_func);
+  }
+  
+  ags_note_index_augment(note_index,
+			 0, length);
+}
+
+/**
+ * ags_note_index_lower_bound:
+ * @note_index: the #AgsNoteIndex-struct
+ * @x0: the x0 offset
+ *
+ * Find the position of the first entry with x0 greater than or equal @x0.
+ *
+ * Returns: the position or the length of @note_index if none
+ *
+ * Since: 9.1.0
+ */
+guint
+ags_note_index_lower_bound(AgsNoteIndex *note_index,
+			   guint x0)
+{
+  guint lower, upper, middle;
+
+  g_return_val_if_fail(note_index != NULL, 0);
+
+  lower = 0;
+  upper = note_index->length;
+
+  while(lower < upper){
+    middle = lower + (upper - lower) / 2;
+
+    if(note_index->entry[middle].x0 < x0){
+      lower = middle + 1;
+    }else{
+      upper = middle;
+    }
+  }
+  
+  return(lower);
+}
+
+/**
+ * ags_note_index_lower_bound_256th:
+ * @note_index: the #AgsNoteIndex-struct
+ * @x0_256th: the x0 offset as 256th
+ *
+ * Find the position of the first entry with x0 256th greater than or equal
+ * @x0_256th.
+ *
+ * Returns: the position or the length of @note_index if none
+ *
+ * Since: 9.1.0
+ */
+guint
+ags_note_index_lower_bound_256th(AgsNoteIndex *note_index,
+				 guint x0_256th)
+{
+  guint lower, upper, middle;
+
+  g_return_val_if_fail(note_index != NULL, 0);
+
+  lower = 0;
+  upper = note_index->length;
+
+  while(lower < upper){
+    middle = lower + (upper - lower) / 2;
+
+    if(note_index->entry[middle].x0_256th < x0_256th){
+      lower = middle + 1;
+    }else{
+      upper = middle;
+    }
+  }
+  
+  return(lower);
+}
+
+/**
+ * ags_note_index_find_point:
+ * @note_index: the #AgsNoteIndex-struct
+ * @x: the offset
+ * @y: the tone
+ *
+ * Find the first note of tone @y sounding at offset @x.
+ *
+ * Returns: (transfer none): the matching #AgsNote or %NULL
+ *
+ * Since: 9.1.0
+ */
+AgsNote*
+ags_note_index_find_point(AgsNoteIndex *note_index,
+			  guint x, guint y)
+{
+  g_return_val_if_fail(note_index != NULL, NULL);
+
+  return(ags_note_index_find_point_recursive(note_index,
+					     0, note_index->length,
+					     x, y));
+}
@@ -0,0 +1,104 @@
+/* GSequencer - Advanced GTK Sequencer
+ * Copyright (C) 2005-2026 Joël Krähemann
+ *
+ * This file is part of GSequencer.
+ *
+ * GSequencer is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GSequencer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GSequencer.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef __AGS_NOTE_INDEX_H__
+#define __AGS_NOTE_INDEX_H__
+
+#include <glib.h>
+#include <glib-object.h>
+
+#include <ags/audio/ags_note.h>
+
+G_BEGIN_DECLS
+
+#define AGS_TYPE_NOTE_INDEX         (ags_note_index_get_type())
+#define AGS_NOTE_INDEX(ptr) ((AgsNoteIndex *)(ptr))
+#define AGS_NOTE_INDEX_ENTRY(ptr) ((AgsNoteIndexEntry *)(ptr))
+
+typedef struct _AgsNoteIndex AgsNoteIndex;
+typedef struct _AgsNoteIndexEntry AgsNoteIndexEntry;
+
+/**
+ * AgsNoteIndexEntry:
+ * @note: the #AgsNote
+ * @x0: the note's x0
+ * @x1: the note's x1
+ * @x0_256th: the note's x0 as 256th
+ * @y: the note's y
+ * @max_x1: the greatest x1 of the entries within the subtree of this entry
+ *
+ * An entry of #AgsNoteIndex caching the geometry of one #AgsNote.
+ */
+struct _AgsNoteIndexEntry
+{
+  AgsNote *note;
+
+  guint x0;
+  guint x1;
+  guint x0_256th;
+  guint y;
+
+  guint max_x1;
+};
+
+/**
+ * AgsNoteIndex:
+ * @revision: the revision of the indexed notation
+ * @length: the number of entries
+ * @allocated_length: the allocated number of entries
+ * @entry: (array length=length): the entries sorted by x0 and y
+ *
+ * The #AgsNoteIndex-struct is a sorted array of #AgsNoteIndexEntry-struct
+ * forming an implicit interval tree. The middle entry of every range is the
+ * root of its subtree and carries the greatest x1 of the range.
+ */
+struct _AgsNoteIndex
+{
+  guint revision;
+  
+  guint length;
+  guint allocated_length;
+  AgsNoteIndexEntry *entry;
+};
+
+GType ags_note_index_get_type(void);
+
+AgsNoteIndex* ags_note_index_alloc();
+
+gpointer ags_note_index_copy(AgsNoteIndex *ptr);
+void ags_note_index_free(AgsNoteIndex *ptr);
+
+gboolean ags_note_index_is_valid(AgsNoteIndex *note_index,
+				 guint revision);
+void ags_note_index_rebuild(AgsNoteIndex *note_index,
+			    GList *note,
+			    guint revision);
+
+guint ags_note_index_lower_bound(AgsNoteIndex *note_index,
+				 guint x0);
+guint ags_note_index_lower_bound_256th(AgsNoteIndex *note_index,
+				       guint x0_256th);
+
+AgsNote* ags_note_index_find_point(AgsNoteIndex *note_index,
+				   guint x, guint y);
+
+G_END_DECLS
+
+#endif /*__AGS_NOTE_INDEX_H__*/
@@ -0,0 +1,2199 @@
+/* GSequencer - Advanced GTK Sequencer
+ * Copyright (C) 2005-2026 Joël Krähemann
+ *
+ * This file is part of GSequencer.
+ *
+ * GSequencer is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GSequencer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GSequencer.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <ags/audio/ags_offline_devout.h>
+
+#include <ags/audio/ags_sound_provider.h>
+#include <ags/audio/ags_soundcard_util.h>
+#include <ags/audio/ags_audio_buffer_util.h>
+
+#include <ags/audio/task/ags_tic_device.h>
+#include <ags/audio/task/ags_clear_buffer.h>
+#include <ags/audio/task/ags_switch_buffer_flag.h>
+
+#include <ags/ags_api_config.h>
+
+
+#include <errno.h>
+
+#define _GNU_SOURCE
+#include <signal.h>
+
+#include <string.h>
+#include <math.h>
+
+#include <time.h>
+#include <signal.h>
+#include <strings.h>
+#include <unistd.h>
+
+#include <ags/i18n.h>
+
+void ags_offline_devout_class_init(AgsOfflineDevoutClass *offline_devout);
+void ags_offline_devout_connectable_interface_init(AgsConnectableInterface *connectable);
+void ags_offline_devout_soundcard_interface_init(AgsSoundcardInterface *soundcard);
+void ags_offline_devout_init(AgsOfflineDevout *offline_devout);
+void ags_offline_devout_set_property(GObject *gobject,
+				     guint prop_id,
+				     const GValue *value,
+				     GParamSpec *param_spec);
+void ags_offline_devout_get_property(GObject *gobject,
+				     guint prop_id,
+				     GValue *value,
+				     GParamSpec *param_spec);
+void ags_offline_devout_dispose(GObject *gobject);
+void ags_offline_devout_finalize(GObject *gobject);
+
+AgsUUID* ags_offline_devout_get_uuid(AgsConnectable *connectable);
+gboolean ags_offline_devout_has_resource(AgsConnectable *connectable);
+gboolean ags_offline_devout_is_ready(AgsConnectable *connectable);
+void ags_offline_devout_add_to_registry(AgsConnectable *connectable);
+void ags_offline_devout_remove_from_registry(AgsConnectable *connectable);
+gboolean ags_offline_devout_is_connected(AgsConnectable *connectable);
+void ags_offline_devout_connect(AgsConnectable *connectable);
+void ags_offline_devout_disconnect(AgsConnectable *connectable);
+
+void ags_offline_devout_set_device(AgsSoundcard *soundcard,
+				   gchar *device);
+gchar* ags_offline_devout_get_device(AgsSoundcard *soundcard);
+
+void ags_offline_devout_set_presets(AgsSoundcard *soundcard,
+				    guint channels,
+				    guint rate,
+				    guint buffer_size,
+				    AgsSoundcardFormat format);
+void ags_offline_devout_get_presets(AgsSoundcard *soundcard,
+				    guint *channels,
+				    guint *rate,
+				    guint *buffer_size,
+				    AgsSoundcardFormat *format);
+
+void ags_offline_devout_list_cards(AgsSoundcard *soundcard,
+				   GList **card_id, GList **card_name);
+void ags_offline_devout_pcm_info(AgsSoundcard *soundcard, gchar *card_id,
+				 guint *channels_min, guint *channels_max,
+				 guint *rate_min, guint *rate_max,
+				 guint *buffer_size_min, guint *buffer_size_max,
+				 GError **error);
+guint ags_offline_devout_get_capability(AgsSoundcard *soundcard);
+
+gboolean ags_offline_devout_is_available(AgsSoundcard *soundcard);
+
+gboolean ags_offline_devout_is_starting(AgsSoundcard *soundcard);
+gboolean ags_offline_devout_is_playing(AgsSoundcard *soundcard);
+
+gchar* ags_offline_devout_get_uptime(AgsSoundcard *soundcard);
+
+void ags_offline_devout_device_play_init(AgsSoundcard *soundcard,
+					 GError **error);
+
+
+void ags_offline_devout_device_play(AgsSoundcard *soundcard,
+				    GError **error);
+void ags_offline_devout_device_free(AgsSoundcard *soundcard);
+
+void ags_offline_devout_tic(AgsSoundcard *soundcard);
+void ags_offline_devout_offset_changed(AgsSoundcard *soundcard,
+				       guint64 note_offset);
+
+void ags_offline_devout_set_bpm(AgsSoundcard *soundcard,
+				gdouble bpm);
+gdouble ags_offline_devout_get_bpm(AgsSoundcard *soundcard);
+
+void ags_offline_devout_set_start_note_offset(AgsSoundcard *soundcard,
+					      guint64 start_note_offset);
+guint64 ags_offline_devout_get_start_note_offset(AgsSoundcard *soundcard);
+
+GObject* ags_offline_devout_get_frame_clock(AgsSoundcard *soundcard);
+
+void* ags_offline_devout_get_buffer(AgsSoundcard *soundcard);
+void* ags_offline_devout_get_next_buffer(AgsSoundcard *soundcard);
+void* ags_offline_devout_get_prev_buffer(AgsSoundcard *soundcard);
+
+void ags_offline_devout_lock_buffer(AgsSoundcard *soundcard,
+				    void *buffer);
+void ags_offline_devout_unlock_buffer(AgsSoundcard *soundcard,
+				      void *buffer);
+
+guint ags_offline_devout_get_sub_block_count(AgsSoundcard *soundcard);
+
+gboolean ags_offline_devout_trylock_sub_block(AgsSoundcard *soundcard,
+					      void *buffer, guint sub_block);
+void ags_offline_devout_unlock_sub_block(AgsSoundcard *soundcard,
+					 void *buffer, guint sub_block);
+
+/**
+ * SECTION:ags_offline_devout
+ * @short_description: Offline output
+ * @title: AgsOfflineDevout
+ * @section_id:
+ * @include: ags/audio/ags_offline_devout.h
+ *
+ * #AgsOfflineDevout is a virtual soundcard without any device. It paces
+ * playback to wall clock unless %AGS_OFFLINE_DEVOUT_FREE_RUN is set, then
+ * every call to ags_soundcard_play() returns immediately and the audio tree
+ * is rendered as fast as possible, as needed by exporting to file.
+ */
+
+enum{
+  PROP_0,
+  PROP_DEVICE,
+  PROP_DSP_CHANNELS,
+  PROP_PCM_CHANNELS,
+  PROP_FORMAT,
+  PROP_BUFFER_SIZE,
+  PROP_SAMPLERATE,
+  PROP_BPM,
+  PROP_BUFFER,
+};
+
+static gpointer ags_offline_devout_parent_class = NULL;
+
+GType
+ags_offline_devout_get_type (void)
+{
+  static gsize g_define_type_id__static = 0;
+
+  if(g_once_init_enter(&g_define_type_id__static)){
+    GType ags_type_offline_devout = 0;
+
+    static const GTypeInfo ags_offline_devout_info = {
+      sizeof(AgsOfflineDevoutClass),
+      NULL, /* base_init */
+      NULL, /* base_finalize */
+      (GClassInitFunc) ags_offline_devout_class_init,
+      NULL, /* class_finalize */
+      NULL, /* class_data */
+      sizeof(AgsOfflineDevout),
+      0,    /* n_preallocs */
+      (GInstanceInitFunc) ags_offline_devout_init,
+    };
+
+    static const GInterfaceInfo ags_connectable_interface_info = {
+      (GInterfaceInitFunc) ags_offline_devout_connectable_interface_init,
+      NULL, /* interface_finalize */
+      NULL, /* interface_data */
+    };
+
+    static const GInterfaceInfo ags_soundcard_interface_info = {
+      (GInterfaceInitFunc) ags_offline_devout_soundcard_interface_init,
+      NULL, /* interface_finalize */
+      NULL, /* interface_data */
+    };
+
+    ags_type_offline_devout = g_type_register_static(G_TYPE_OBJECT,
+						     "AgsOfflineDevout",
+						     &ags_offline_devout_info,
+						     0);
+
+    g_type_add_interface_static(ags_type_offline_devout,
+				AGS_TYPE_CONNECTABLE,
+				&ags_connectable_interface_info);
+
+    g_type_add_interface_static(ags_type_offline_devout,
+				AGS_TYPE_SOUNDCARD,
+				&ags_soundcard_interface_info);
+
+    g_once_init_leave(&g_define_type_id__static, ags_type_offline_devout);
+  }
+
+  return(g_define_type_id__static);
+}
+
+GType
+ags_offline_devout_flags_get_type()
+{
+  static gsize g_flags_type_id__static;
+
+  if(g_once_init_enter(&g_flags_type_id__static)){
+    static const GFlagsValue values[] = {
+      { AGS_OFFLINE_DEVOUT_INITIALIZED, "AGS_OFFLINE_DEVOUT_INITIALIZED", "offline-devout-initialized" },
+      { AGS_OFFLINE_DEVOUT_START_PLAY, "AGS_OFFLINE_DEVOUT_START_PLAY", "offline-devout-start-play" },
+      { AGS_OFFLINE_DEVOUT_PLAY, "AGS_OFFLINE_DEVOUT_PLAY", "offline-devout-play" },
+      { AGS_OFFLINE_DEVOUT_SHUTDOWN, "AGS_OFFLINE_DEVOUT_SHUTDOWN", "offline-devout-shutdown" },
+      { AGS_OFFLINE_DEVOUT_NONBLOCKING, "AGS_OFFLINE_DEVOUT_NONBLOCKING", "offline-devout-nonblocking" },
+      { AGS_OFFLINE_DEVOUT_ATTACK_FIRST, "AGS_OFFLINE_DEVOUT_ATTACK_FIRST", "offline-devout-attack-first" },
+      { AGS_OFFLINE_DEVOUT_FREE_RUN, "AGS_OFFLINE_DEVOUT_FREE_RUN", "offline-devout-free-run" },
+      { 0, NULL, NULL }
+    };
+
+    GType g_flags_type_id = g_flags_register_static(g_intern_static_string("AgsOfflineDevoutFlags"), values);
+
+    g_once_init_leave(&g_flags_type_id__static, g_flags_type_id);
+  }
+  
+  return(g_flags_type_id__static);
+}
+
+void
+ags_offline_devout_class_init(AgsOfflineDevoutClass *offline_devout)
+{
+  GObjectClass *gobject;
+
+  GParamSpec *param_spec;
+
+  ags_offline_devout_parent_class = g_type_class_peek_parent(offline_devout);
+
+  /* GObjectClass */
+  gobject = (GObjectClass *) offline_devout;
+
+  gobject->set_property = ags_offline_devout_set_property;
+  gobject->get_property = ags_offline_devout_get_property;
+
+  gobject->dispose = ags_offline_devout_dispose;
+  gobject->finalize = ags_offline_devout_finalize;
+
+  /* properties */
+  /**
+   * AgsOfflineDevout:device:
+   *
+   * The offline soundcard indentifier
+   * 
+   * Since: 9.1.0
+   */
+  param_spec = g_param_spec_string("device",
+				   i18n_pspec("the device identifier"),
+				   i18n_pspec("The device to perform output to"),
+				   AGS_OFFLINE_DEVOUT_DEFAULT_DEVICE,
+				   G_PARAM_READABLE | G_PARAM_WRITABLE);
+  g_object_class_install_property(gobject,
+				  PROP_DEVICE,
+				  param_spec);
+  
+  /**
+   * AgsOfflineDevout:dsp-channels:
+   *
+   * The dsp channel count
+   * 
+   * Since: 9.1.0
+   */
+  param_spec = g_param_spec_uint("dsp-channels",
+				 i18n_pspec("count of DSP channels"),
+				 i18n_pspec("The count of DSP channels to use"),
+				 AGS_SOUNDCARD_MIN_DSP_CHANNELS,
+				 AGS_SOUNDCARD_MAX_DSP_CHANNELS,
+				 AGS_SOUNDCARD_DEFAULT_DSP_CHANNELS,
+				 G_PARAM_READABLE | G_PARAM_WRITABLE);
+  g_object_class_install_property(gobject,
+				  PROP_DSP_CHANNELS,
+				  param_spec);
+
+  /**
+   * AgsOfflineDevout:pcm-channels:
+   *
+   * The pcm channel count
+   * 
+   * Since: 9.1.0
+   */
+  param_spec = g_param_spec_uint("pcm-channels",
+				 i18n_pspec("count of PCM channels"),
+				 i18n_pspec("The count of PCM channels to use"),
+				 AGS_SOUNDCARD_MIN_PCM_CHANNELS,
+				 AGS_SOUNDCARD_MAX_PCM_CHANNELS,
+				 AGS_SOUNDCARD_DEFAULT_PCM_CHANNELS,
+				 G_PARAM_READABLE | G_PARAM_WRITABLE);
+  g_object_class_install_property(gobject,
+				  PROP_PCM_CHANNELS,
+				  param_spec);
+
+  /**
+   * AgsOfflineDevout:format:
+   *
+   * The precision of the buffer
+   * 
+   * Since: 9.1.0
+   */
+  param_spec = g_param_spec_uint("format",
+				 i18n_pspec("precision of buffer"),
+				 i18n_pspec("The precision to use for a frame"),
+				 0,
+				 G_MAXUINT32,
+				 AGS_SOUNDCARD_DEFAULT_FORMAT,
+				 G_PARAM_READABLE | G_PARAM_WRITABLE);
+  g_object_class_install_property(gobject,
+				  PROP_FORMAT,
+				  param_spec);
+
+  /**
+   * AgsOfflineDevout:buffer-size:
+   *
+   * The buffer size
+   * 
+   * Since: 9.1.0
+   */
+  param_spec = g_param_spec_uint("buffer-size",
+				 i18n_pspec("frame count of a buffer"),
+				 i18n_pspec("The count of frames a buffer contains"),
+				 AGS_SOUNDCARD_MIN_BUFFER_SIZE,
+				 AGS_SOUNDCARD_MAX_BUFFER_SIZE,
+				 AGS_SOUNDCARD_DEFAULT_BUFFER_SIZE,
+				 G_PARAM_READABLE | G_PARAM_WRITABLE);
+  g_object_class_install_property(gobject,
+				  PROP_BUFFER_SIZE,
+				  param_spec);
+
+  /**
+   * AgsOfflineDevout:samplerate:
+   *
+   * The samplerate
+   * 
+   * Since: 9.1.0
+   */
+  param_spec = g_param_spec_uint("samplerate",
+				 i18n_pspec("frames per second"),
+				 i18n_pspec("The frames count played during a second"),
+				 (guint) AGS_SOUNDCARD_MIN_SAMPLERATE,
+				 (guint) AGS_SOUNDCARD_MAX_SAMPLERATE,
+				 (guint) AGS_SOUNDCARD_DEFAULT_SAMPLERATE,
+				 G_PARAM_READABLE | G_PARAM_WRITABLE);
+  g_object_class_install_property(gobject,
+				  PROP_SAMPLERATE,
+				  param_spec);
+
+  /**
+   * AgsOfflineDevout:bpm:
+   *
+   * Beats per minute
+   * 
+   * Since: 9.1.0
+   */
+  param_spec = g_param_spec_double("bpm",
+				   i18n_pspec("beats per minute"),
+				   i18n_pspec("Beats per minute to use"),
+				   1.0,
+				   240.0,
+				   AGS_SOUNDCARD_DEFAULT_BPM,
+				   G_PARAM_READABLE | G_PARAM_WRITABLE);
+  g_object_class_install_property(gobject,
+				  PROP_BPM,
+				  param_spec);
+
+  /**
+   * AgsOfflineDevout:buffer:
+   *
+   * The buffer
+   * 
+   * Since: 9.1.0
+   */
+  param_spec = g_param_spec_pointer("buffer",
+				    i18n_pspec("the buffer"),
+				    i18n_pspec("The buffer to play"),
+				    G_PARAM_READABLE);
+  g_object_class_install_property(gobject,
+				  PROP_BUFFER,
+				  param_spec);
+  
+  /* AgsOfflineDevoutClass */
+}
+
+void
+ags_offline_devout_connectable_interface_init(AgsConnectableInterface *connectable)
+{
+  connectable->get_uuid = ags_offline_devout_get_uuid;
+  connectable->has_resource = ags_offline_devout_has_resource;
+
+  connectable->is_ready = ags_offline_devout_is_ready;
+  connectable->add_to_registry = ags_offline_devout_add_to_registry;
+  connectable->remove_from_registry = ags_offline_devout_remove_from_registry;
+
+  connectable->list_resource = NULL;
+  connectable->xml_compose = NULL;
+  connectable->xml_parse = NULL;
+
+  connectable->is_connected = ags_offline_devout_is_connected;  
+  connectable->connect = ags_offline_devout_connect;
+  connectable->disconnect = ags_offline_devout_disconnect;
+
+  connectable->connect_connection = NULL;
+  connectable->disconnect_connection = NULL;
+}
+
+void
+ags_offline_devout_soundcard_interface_init(AgsSoundcardInterface *soundcard)
+{
+  soundcard->set_device = ags_offline_devout_set_device;
+  soundcard->get_device = ags_offline_devout_get_device;
+  
+  soundcard->set_presets = ags_offline_devout_set_presets;
+  soundcard->get_presets = ags_offline_devout_get_presets;
+
+  soundcard->list_cards = ags_offline_devout_list_cards;
+  soundcard->pcm_info = ags_offline_devout_pcm_info;
+  soundcard->get_capability = ags_offline_devout_get_capability;
+  
+  soundcard->is_available = ags_offline_devout_is_available;
+
+  soundcard->is_starting =  ags_offline_devout_is_starting;
+  soundcard->is_playing = ags_offline_devout_is_playing;
+  soundcard->is_recording = NULL;
+
+  soundcard->get_uptime = ags_offline_devout_get_uptime;
+  
+  soundcard->play_init = ags_offline_devout_device_play_init;
+  soundcard->play = ags_offline_devout_device_play;
+  
+  soundcard->record_init = NULL;
+  soundcard->record = NULL;
+  
+  soundcard->stop = ags_offline_devout_device_free;
+
+  soundcard->tic = ags_offline_devout_tic;
+  soundcard->offset_changed = ags_offline_devout_offset_changed;
+    
+  soundcard->set_bpm = ags_offline_devout_set_bpm;
+  soundcard->get_bpm = ags_offline_devout_get_bpm;
+
+  soundcard->set_start_note_offset = ags_offline_devout_set_start_note_offset;
+  soundcard->get_start_note_offset = ags_offline_devout_get_start_note_offset;
+
+  soundcard->get_frame_clock = ags_offline_devout_get_frame_clock;
+
+  soundcard->get_buffer = ags_offline_devout_get_buffer;
+  soundcard->get_next_buffer = ags_offline_devout_get_next_buffer;
+  soundcard->get_prev_buffer = ags_offline_devout_get_prev_buffer;
+
+  soundcard->lock_buffer = ags_offline_devout_lock_buffer;
+  soundcard->unlock_buffer = ags_offline_devout_unlock_buffer;
+
+  soundcard->get_sub_block_count = ags_offline_devout_get_sub_block_count;
+
+  soundcard->trylock_sub_block = ags_offline_devout_trylock_sub_block;
+  soundcard->unlock_sub_block = ags_offline_devout_unlock_sub_block;
+}
+
+void
+ags_offline_devout_init(AgsOfflineDevout *offline_devout)
+{  
+  AgsConfig *config;
+  
+  gchar *str;
+  gchar *segmentation;
+
+  gdouble absolute_delay;
+  guint i;
+  guint denominator, numerator;
+
+  /* config */
+  config = ags_config_get_instance();
+
+  /* flags */
+  offline_devout->flags = 0;
+  offline_devout->connectable_flags = 0;
+  
+  /* insert offline_devout mutex */
+  g_rec_mutex_init(&(offline_devout->obj_mutex));
+
+  /* uuid */
+  offline_devout->uuid = ags_uuid_alloc();
+  ags_uuid_generate(offline_devout->uuid);
+
+  /* presets */
+  offline_devout->dsp_channels = ags_soundcard_helper_config_get_dsp_channels(config);
+  offline_devout->pcm_channels = ags_soundcard_helper_config_get_pcm_channels(config);
+
+  offline_devout->samplerate = ags_soundcard_helper_config_get_samplerate(config);
+  offline_devout->buffer_size = ags_soundcard_helper_config_get_buffer_size(config);
+  offline_devout->format = ags_soundcard_helper_config_get_format(config);
+
+  /* bpm */
+  offline_devout->bpm = AGS_SOUNDCARD_DEFAULT_BPM;
+
+  /* start note offset */
+  offline_devout->start_note_offset = 0;
+  
+  /* frame clock */
+  offline_devout->frame_clock = ags_frame_clock_new();
+
+  /* device */
+  offline_devout->device = g_strdup(AGS_OFFLINE_DEVOUT_DEFAULT_DEVICE);
+
+  /* app buffer mutex */
+  offline_devout->app_buffer_mode = AGS_OFFLINE_DEVOUT_APP_BUFFER_0;
+
+  offline_devout->app_buffer_mutex = (GRecMutex **) g_malloc(AGS_OFFLINE_DEVOUT_DEFAULT_APP_BUFFER_SIZE * sizeof(GRecMutex *));
+
+  for(i = 0; i < AGS_OFFLINE_DEVOUT_DEFAULT_APP_BUFFER_SIZE; i++){
+    offline_devout->app_buffer_mutex[i] = (GRecMutex *) g_malloc(sizeof(GRecMutex));
+
+    g_rec_mutex_init(offline_devout->app_buffer_mutex[i]);
+  }
+
+  /* sub-block */
+  offline_devout->sub_block_count = AGS_SOUNDCARD_DEFAULT_SUB_BLOCK_COUNT;
+  offline_devout->sub_block_mutex = (GRecMutex **) g_malloc(AGS_OFFLINE_DEVOUT_DEFAULT_APP_BUFFER_SIZE * offline_devout->sub_block_count * offline_devout->pcm_channels * sizeof(GRecMutex *));
+
+  for(i = 0; i < AGS_OFFLINE_DEVOUT_DEFAULT_APP_BUFFER_SIZE * offline_devout->sub_block_count * offline_devout->pcm_channels; i++){
+    offline_devout->sub_block_mutex[i] = (GRecMutex *) g_malloc(sizeof(GRecMutex));
+
+    g_rec_mutex_init(offline_devout->sub_block_mutex[i]);
+  }
+
+  /* app buffer */
+  offline_devout->app_buffer = (void **) g_malloc(AGS_OFFLINE_DEVOUT_DEFAULT_APP_BUFFER_SIZE * sizeof(void *));
+  
+  for(i = 0; i < AGS_OFFLINE_DEVOUT_DEFAULT_APP_BUFFER_SIZE; i++){
+    offline_devout->app_buffer[i] = NULL;
+  }
+
+  ags_atomic_int_set(&(offline_devout->available),
+		     FALSE);
+
+  ags_offline_devout_realloc_buffer(offline_devout);
+
+  /* pacing */
+  offline_devout->poll_timeout = -1;
+}
+
+void
+ags_offline_devout_set_property(GObject *gobject,
+				guint prop_id,
+				const GValue *value,
+				GParamSpec *param_spec)
+{
+  AgsOfflineDevout *offline_devout;
+
+  GRecMutex *offline_devout_mutex;
+
+  offline_devout = AGS_OFFLINE_DEVOUT(gobject);
+
+  /* get offline devout mutex */
+  offline_devout_mutex = AGS_OFFLINE_DEVOUT_GET_OBJ_MUTEX(offline_devout);
+  
+  switch(prop_id){
+  case PROP_DEVICE:
+  {
+    char *device;
+
+    device = (char *) g_value_get_string(value);
+
+    g_rec_mutex_lock(offline_devout_mutex);
+
+    g_free(offline_devout->device);
+    
+    offline_devout->device = g_strdup(device);
+
+    g_rec_mutex_unlock(offline_devout_mutex);
+  }
+  break;
+  case PROP_DSP_CHANNELS:
+  {
+    guint dsp_channels;
+
+    dsp_channels = g_value_get_uint(value);
+
+    g_rec_mutex_lock(offline_devout_mutex);
+
+    if(dsp_channels == offline_devout->dsp_channels){
+      g_rec_mutex_unlock(offline_devout_mutex);
+	
+      return;
+    }
+
+    offline_devout->dsp_channels = dsp_channels;
+
+    g_rec_mutex_unlock(offline_devout_mutex);
+  }
+  break;
+  case PROP_PCM_CHANNELS:
+  {
+    guint pcm_channels, old_pcm_channels;
+    guint i;
+  
+    pcm_channels = g_value_get_uint(value);
+
+    g_rec_mutex_lock(offline_devout_mutex);
+
+    if(pcm_channels == offline_devout->pcm_channels){
+      g_rec_mutex_unlock(offline_devout_mutex);
+	
+      return;
+    }
+
+    old_pcm_channels = offline_devout->pcm_channels;
+
+    /* destroy if less pcm-channels */
+    for(i = AGS_OFFLINE_DEVOUT_DEFAULT_APP_BUFFER_SIZE * offline_devout->sub_block_count * pcm_channels; i < AGS_OFFLINE_DEVOUT_DEFAULT_APP_BUFFER_SIZE * offline_devout->sub_block_count * old_pcm_channels; i++){
+      g_rec_mutex_clear(offline_devout->sub_block_mutex[i]);
+
+      g_free(offline_devout->sub_block_mutex[i]);
+    }
+
+    offline_devout->sub_block_mutex = (GRecMutex **) g_realloc(offline_devout->sub_block_mutex,
+							       AGS_OFFLINE_DEVOUT_DEFAULT_APP_BUFFER_SIZE * offline_devout->sub_block_count * pcm_channels * sizeof(GRecMutex *));
+
+    /* create if more pcm-channels */
+    for(i = AGS_OFFLINE_DEVOUT_DEFAULT_APP_BUFFER_SIZE * offline_devout->sub_block_count * old_pcm_channels; i < AGS_OFFLINE_DEVOUT_DEFAULT_APP_BUFFER_SIZE * offline_devout->sub_block_count * pcm_channels; i++){
+      offline_devout->sub_block_mutex[i] = (GRecMutex *) g_malloc(sizeof(GRecMutex));
+
+      g_rec_mutex_init(offline_devout->sub_block_mutex[i]);
+    }
+      
+    offline_devout->pcm_channels = pcm_channels;
+
+    g_rec_mutex_unlock(offline_devout_mutex);
+      
+    ags_offline_devout_realloc_buffer(offline_devout);
+  }
+  break;
+  case PROP_FORMAT:
+  {
+    guint format;
+
+    format = g_value_get_uint(value);
+
+    g_rec_mutex_lock(offline_devout_mutex);
+
+    if(format == offline_devout->format){
+      g_rec_mutex_unlock(offline_devout_mutex);
+	
+      return;
+    }
+
+    offline_devout->format = format;
+
+    g_rec_mutex_unlock(offline_devout_mutex);
+
+    ags_offline_devout_realloc_buffer(offline_devout);
+  }
+  break;
+  case PROP_BUFFER_SIZE:
+  {
+    guint buffer_size;
+
+    buffer_size = g_value_get_uint(value);
+
+    g_rec_mutex_lock(offline_devout_mutex);
+
+    if(buffer_size == offline_devout->buffer_size){
+      g_rec_mutex_unlock(offline_devout_mutex);
+
+      return;
+    }
+
+    offline_devout->buffer_size = buffer_size;
+
+    ags_frame_clock_set_buffer_size(offline_devout->frame_clock,
+				    buffer_size);
+
+    g_rec_mutex_unlock(offline_devout_mutex);
+
+    ags_offline_devout_realloc_buffer(offline_devout);
+  }
+  break;
+  case PROP_SAMPLERATE:
+  {
+    guint samplerate;
+
+    samplerate = g_value_get_uint(value);
+
+    g_rec_mutex_lock(offline_devout_mutex);
+
+    if(samplerate == offline_devout->samplerate){
+      g_rec_mutex_unlock(offline_devout_mutex);
+
+      return;
+    }
+
+    offline_devout->samplerate = samplerate;
+
+    ags_frame_clock_set_samplerate(offline_devout->frame_clock,
+				   samplerate);
+
+    g_rec_mutex_unlock(offline_devout_mutex);
+  }
+  break;
+  case PROP_BPM:
+  {
+    gdouble bpm;
+      
+    bpm = g_value_get_double(value);
+
+    g_rec_mutex_lock(offline_devout_mutex);
+
+    if(bpm == offline_devout->bpm){
+      g_rec_mutex_unlock(offline_devout_mutex);
+
+      return;
+    }
+
+    offline_devout->bpm = bpm;
+
+    ags_frame_clock_set_bpm(offline_devout->frame_clock,
+			    bpm);
+
+    g_rec_mutex_unlock(offline_devout_mutex);
+  }
+  break;
+  default:
+    G_OBJECT_WARN_INVALID_PROPERTY_ID(gobject, prop_id, param_spec);
+    break;
+  }
+}
+
+void
+ags_offline_devout_get_property(GObject *gobject,
+				guint prop_id,
+				GValue *value,
+				GParamSpec *param_spec)
+{
+  AgsOfflineDevout *offline_devout;
+
+  GRecMutex *offline_devout_mutex;
+
+  offline_devout = AGS_OFFLINE_DEVOUT(gobject);
+
+  /* get offline devout mutex */
+  offline_devout_mutex = AGS_OFFLINE_DEVOUT_GET_OBJ_MUTEX(offline_devout);
+  
+  switch(prop_id){
+  case PROP_DEVICE:
+  {
+    g_rec_mutex_lock(offline_devout_mutex);
+
+    g_value_set_string(value, offline_devout->device);
+
+    g_rec_mutex_unlock(offline_devout_mutex);
+  }
+  break;
+  case PROP_DSP_CHANNELS:
+  {
+    g_rec_mutex_lock(offline_devout_mutex);
+
+    g_value_set_uint(value, offline_devout->dsp_channels);
+
+    g_rec_mutex_unlock(offline_devout_mutex);
+  }
+  break;
+  case PROP_PCM_CHANNELS:
+  {
+    g_rec_mutex_lock(offline_devout_mutex);
+
+    g_value_set_uint(value, offline_devout->pcm_channels);
+
+    g_rec_mutex_unlock(offline_devout_mutex);
+  }
+  break;
+  case PROP_FORMAT:
+  {
+    g_rec_mutex_lock(offline_devout_mutex);
+
+    g_value_set_uint(value, offline_devout->format);
+
+    g_rec_mutex_unlock(offline_devout_mutex);
+  }
+  break;
+  case PROP_BUFFER_SIZE:
+  {
+    g_rec_mutex_lock(offline_devout_mutex);
+
+    g_value_set_uint(value, offline_devout->buffer_size);
+
+    g_rec_mutex_unlock(offline_devout_mutex);
+  }
+  break;
+  case PROP_SAMPLERATE:
+  {
+    g_rec_mutex_lock(offline_devout_mutex);
+
+    g_value_set_uint(value, offline_devout->samplerate);
+
+    g_rec_mutex_unlock(offline_devout_mutex);
+  }
+  break;
+  case PROP_BPM:
+  {
+    g_rec_mutex_lock(offline_devout_mutex);
+
+    g_value_set_double(value, offline_devout->bpm);
+
+    g_rec_mutex_unlock(offline_devout_mutex);
+  }
+  break;
+  case PROP_BUFFER:
+  {
+    g_rec_mutex_lock(offline_devout_mutex);
+
+    g_value_set_pointer(value, offline_devout->app_buffer);
+
+    g_rec_mutex_unlock(offline_devout_mutex);
+  }
+  break;
+  default:
+    G_OBJECT_WARN_INVALID_PROPERTY_ID(gobject, prop_id, param_spec);
+    break;
+  }
+}
+
+void
+ags_offline_devout_dispose(GObject *gobject)
+{
+  AgsOfflineDevout *offline_devout;
+
+  offline_devout = AGS_OFFLINE_DEVOUT(gobject);
+
+  /* call parent */
+  G_OBJECT_CLASS(ags_offline_devout_parent_class)->dispose(gobject);
+}
+
+void
+ags_offline_devout_finalize(GObject *gobject)
+{
+  AgsOfflineDevout *offline_devout;
+
+  guint i;
+  
+  offline_devout = AGS_OFFLINE_DEVOUT(gobject);
+
+  ags_uuid_free(offline_devout->uuid);  
+
+  /* frame clock */
+  if(offline_devout->frame_clock != NULL){
+    g_object_unref(offline_devout->frame_clock);
+  }
+
+  /* app buffer */
+  for(i = 0; i < AGS_OFFLINE_DEVOUT_DEFAULT_APP_BUFFER_SIZE; i++){
+    g_free(offline_devout->app_buffer[i]);
+  }
+
+  g_free(offline_devout->app_buffer);
+
+  /* app buffer mutex */
+  for(i = 0; i < AGS_OFFLINE_DEVOUT_DEFAULT_APP_BUFFER_SIZE; i++){
+    g_rec_mutex_clear(offline_devout->app_buffer_mutex[i]);
+    
+    g_free(offline_devout->app_buffer_mutex[i]);
+  }
+
+  g_free(offline_devout->app_buffer_mutex);
+
+  /* sub-block mutex */  
+  for(i = 0; i < AGS_OFFLINE_DEVOUT_DEFAULT_APP_BUFFER_SIZE * offline_devout->sub_block_count * offline_devout->pcm_channels; i++){
+    g_rec_mutex_clear(offline_devout->sub_block_mutex[i]);
+    
+    g_free(offline_devout->sub_block_mutex[i]);
+  }
+
+  g_free(offline_devout->sub_block_mutex);
+  
+  g_free(offline_devout->device);
+  
+  /* call parent */
+  G_OBJECT_CLASS(ags_offline_devout_parent_class)->finalize(gobject);
+}
+
+AgsUUID*
+ags_offline_devout_get_uuid(AgsConnectable *connectable)
+{
+  AgsOfflineDevout *offline_devout;
+  
+  AgsUUID *ptr;
+
+  GRecMutex *offline_devout_mutex;
+
+  offline_devout = AGS_OFFLINE_DEVOUT(connectable);
+
+  /* get offline devout mutex */
+  offline_devout_mutex = AGS_OFFLINE_DEVOUT_GET_OBJ_MUTEX(offline_devout);
+
+  /* get UUID */
+  g_rec_mutex_lock(offline_devout_mutex);
+
+  ptr = offline_devout->uuid;
+
+  g_rec_mutex_unlock(offline_devout_mutex);
+  
+  return(ptr);
+}
+
+gboolean
+ags_offline_devout_has_resource(AgsConnectable *connectable)
+{
+  return(FALSE);
+}
+
+gboolean
+ags_offline_devout_is_ready(AgsConnectable *connectable)
+{
+  AgsOfflineDevout *offline_devout;
+  
+  gboolean is_ready;
+
+  GRecMutex *offline_devout_mutex;
+
+  offline_devout = AGS_OFFLINE_DEVOUT(connectable);
+
+  /* get offline devout mutex */
+  offline_devout_mutex = AGS_OFFLINE_DEVOUT_GET_OBJ_MUTEX(offline_devout);
+
+  /* check is ready */
+  g_rec_mutex_lock(offline_devout_mutex);
+
+  is_ready = ((AGS_CONNECTABLE_ADDED_TO_REGISTRY & (offline_devout->connectable_flags)) != 0) ? TRUE: FALSE;
+
+  g_rec_mutex_unlock(offline_devout_mutex);
+  
+  return(is_ready);
+}
+
+void
+ags_offline_devout_add_to_registry(AgsConnectable *connectable)
+{
+  AgsOfflineDevout *offline_devout;
+
+  GRecMutex *offline_devout_mutex;
+
+  if(ags_connectable_is_ready(connectable)){
+    return;
+  }
+  
+  offline_devout = AGS_OFFLINE_DEVOUT(connectable);
+
+  /* get offline devout mutex */
+  offline_devout_mutex = AGS_OFFLINE_DEVOUT_GET_OBJ_MUTEX(offline_devout);
+
+  g_rec_mutex_lock(offline_devout_mutex);
+
+  offline_devout->connectable_flags |= AGS_CONNECTABLE_ADDED_TO_REGISTRY;
+  
+  g_rec_mutex_unlock(offline_devout_mutex);
+}
+
+void
+ags_offline_devout_remove_from_registry(AgsConnectable *connectable)
+{
+  AgsOfflineDevout *offline_devout;
+
+  GRecMutex *offline_devout_mutex;
+
+  if(!ags_connectable_is_ready(connectable)){
+    return;
+  }
+
+  offline_devout = AGS_OFFLINE_DEVOUT(connectable);
+
+  /* get offline devout mutex */
+  offline_devout_mutex = AGS_OFFLINE_DEVOUT_GET_OBJ_MUTEX(offline_devout);
+
+  g_rec_mutex_lock(offline_devout_mutex);
+
+  offline_devout->connectable_flags &= (~AGS_CONNECTABLE_ADDED_TO_REGISTRY);
+  
+  g_rec_mutex_unlock(offline_devout_mutex);
+}
+
+gboolean
+ags_offline_devout_is_connected(AgsConnectable *connectable)
+{
+  AgsOfflineDevout *offline_devout;
+  
+  gboolean is_connected;
+
+  GRecMutex *offline_devout_mutex;
+
+  offline_devout = AGS_OFFLINE_DEVOUT(connectable);
+
+  /* get offline devout mutex */
+  offline_devout_mutex = AGS_OFFLINE_DEVOUT_GET_OBJ_MUTEX(offline_devout);
+
+  /* check is connected */
+  g_rec_mutex_lock(offline_devout_mutex);
+
+  is_connected = ((AGS_CONNECTABLE_CONNECTED & (offline_devout->connectable_flags)) != 0) ? TRUE: FALSE;
+
+  g_rec_mutex_unlock(offline_devout_mutex);
+  
+  return(is_connected);
+}
+
+void
+ags_offline_devout_connect(AgsConnectable *connectable)
+{
+  AgsOfflineDevout *offline_devout;  
+
+  GRecMutex *offline_devout_mutex;
+
+  if(ags_connectable_is_connected(connectable)){
+    return;
+  }
+
+  offline_devout = AGS_OFFLINE_DEVOUT(connectable);
+
+  /* get offline devout mutex */
+  offline_devout_mutex = AGS_OFFLINE_DEVOUT_GET_OBJ_MUTEX(offline_devout);
+
+  g_rec_mutex_lock(offline_devout_mutex);
+
+  offline_devout->connectable_flags |= AGS_CONNECTABLE_CONNECTED;
+  
+  g_rec_mutex_unlock(offline_devout_mutex);
+}
+
+void
+ags_offline_devout_disconnect(AgsConnectable *connectable)
+{
+
+  AgsOfflineDevout *offline_devout;
+
+  GRecMutex *offline_devout_mutex;
+
+  if(!ags_connectable_is_connected(connectable)){
+    return;
+  }
+
+  offline_devout = AGS_OFFLINE_DEVOUT(connectable);
+
+  /* get offline devout mutex */
+  offline_devout_mutex = AGS_OFFLINE_DEVOUT_GET_OBJ_MUTEX(offline_devout);
+
+  g_rec_mutex_lock(offline_devout_mutex);
+
+  offline_devout->connectable_flags &= (~AGS_CONNECTABLE_CONNECTED);
+  
+  g_rec_mutex_unlock(offline_devout_mutex);
+}
+
+/**
+ * ags_offline_devout_test_flags:
+ * @offline_devout: the #AgsOfflineDevout
+ * @flags: the flags
+ *
+ * Test @flags to be set on @offline_devout.
+ * 
+ * Returns: %TRUE if flags are set, else %FALSE
+ *
+ * Since: 9.1.0
+ */
+gboolean
+ags_offline_devout_test_flags(AgsOfflineDevout *offline_devout, AgsOfflineDevoutFlags flags)
+{
+  gboolean retval;  
+  
+  GRecMutex *offline_devout_mutex;
+
+  if(!AGS_IS_OFFLINE_DEVOUT(offline_devout)){
+    return(FALSE);
+  }
+
+  /* get offline devout mutex */
+  offline_devout_mutex = AGS_OFFLINE_DEVOUT_GET_OBJ_MUTEX(offline_devout);
+
+  /* test */
+  g_rec_mutex_lock(offline_devout_mutex);
+
+  retval = (flags & (offline_devout->flags)) ? TRUE: FALSE;
+  
+  g_rec_mutex_unlock(offline_devout_mutex);
+
+  return(retval);
+}
+
+/**
+ * ags_offline_devout_set_flags:
+ * @offline_devout: the #AgsOfflineDevout
+ * @flags: see #AgsOfflineDevoutFlags-enum
+ *
+ * Enable a feature of @offline_devout.
+ *
+ * Since: 9.1.0
+ */
+void
+ags_offline_devout_set_flags(AgsOfflineDevout *offline_devout, AgsOfflineDevoutFlags flags)
+{
+  GRecMutex *offline_devout_mutex;
+
+  if(!AGS_IS_OFFLINE_DEVOUT(offline_devout)){
+    return;
+  }
+
+  /* get offline devout mutex */
+  offline_devout_mutex = AGS_OFFLINE_DEVOUT_GET_OBJ_MUTEX(offline_devout);
+
+  /* set flags */
+  g_rec_mutex_lock(offline_devout_mutex);
+
+  offline_devout->flags |= flags;
+  
+  g_rec_mutex_unlock(offline_devout_mutex);
+}
+    
+/**
+ * ags_offline_devout_unset_flags:
+ * @offline_devout: the #AgsOfflineDevout
+ * @flags: see #AgsOfflineDevoutFlags-enum
+ *
+ * Disable a feature of @offline_devout.
+ *
+ * Since: 9.1.0
+ */
+void
+ags_offline_devout_unset_flags(AgsOfflineDevout *offline_devout, AgsOfflineDevoutFlags flags)
+{  
+  GRecMutex *offline_devout_mutex;
+
+  if(!AGS_IS_OFFLINE_DEVOUT(offline_devout)){
+    return;
+  }
+
+  /* get offline devout mutex */
+  offline_devout_mutex = AGS_OFFLINE_DEVOUT_GET_OBJ_MUTEX(offline_devout);
+
+  /* unset flags */
+  g_rec_mutex_lock(offline_devout_mutex);
+
+  offline_devout->flags &= (~flags);
+  
+  g_rec_mutex_unlock(offline_devout_mutex);
+}
+
+void
+ags_offline_devout_set_device(AgsSoundcard *soundcard,
+			      gchar *device)
+{
+  AgsOfflineDevout *offline_devout;
+
+  GRecMutex *offline_devout_mutex;
+  
+  offline_devout = AGS_OFFLINE_DEVOUT(soundcard);
+
+  /* get offline devout mutex */
+  offline_devout_mutex = AGS_OFFLINE_DEVOUT_GET_OBJ_MUTEX(offline_devout);
+
+  /* set device */
+  g_rec_mutex_lock(offline_devout_mutex);
+
+  g_free(offline_devout->device);
+  
+  offline_devout->device = g_strdup(device);
+
+  g_rec_mutex_unlock(offline_devout_mutex);
+}
+
+gchar*
+ags_offline_devout_get_device(AgsSoundcard *soundcard)
+{
+  AgsOfflineDevout *offline_devout;
+
+  gchar *device;
+
+  GRecMutex *offline_devout_mutex;
+  
+  offline_devout = AGS_OFFLINE_DEVOUT(soundcard);
+  
+  /* get offline devout mutex */
+  offline_devout_mutex = AGS_OFFLINE_DEVOUT_GET_OBJ_MUTEX(offline_devout);
+
+  device = NULL;
+  
+  g_rec_mutex_lock(offline_devout_mutex);
+
+  device = g_strdup(offline_devout->device);
+
+  g_rec_mutex_unlock(offline_devout_mutex);
+
+  return(device);
+}
+
+void
+ags_offline_devout_set_presets(AgsSoundcard *soundcard,
+			       guint channels,
+			       guint samplerate,
+			       guint buffer_size,
+			       AgsSoundcardFormat format)
+{
+  AgsOfflineDevout *offline_devout;
+
+  offline_devout = AGS_OFFLINE_DEVOUT(soundcard);
+
+  g_object_set(offline_devout,
+	       "pcm-channels", channels,
+	       "samplerate", samplerate,
+	       "buffer-size", buffer_size,
+	       "format", format,
+	       NULL);
+}
+
+void
+ags_offline_devout_get_presets(AgsSoundcard *soundcard,
+			       guint *channels,
+			       guint *samplerate,
+			       guint *buffer_size,
+			       AgsSoundcardFormat *format)
+{
+  AgsOfflineDevout *offline_devout;
+
+  GRecMutex *offline_devout_mutex;
+
+  offline_devout = AGS_OFFLINE_DEVOUT(soundcard);
+
+  /* get offline devout mutex */
+  offline_devout_mutex = AGS_OFFLINE_DEVOUT_GET_OBJ_MUTEX(offline_devout);
+
+  /* get presets */
+  g_rec_mutex_lock(offline_devout_mutex);
+
+  if(channels != NULL){
+    *channels = offline_devout->pcm_channels;
+  }
+
+  if(samplerate != NULL){
+    *samplerate = offline_devout->samplerate;
+  }
+
+  if(buffer_size != NULL){
+    *buffer_size = offline_devout->buffer_size;
+  }
+
+  if(format != NULL){
+    *format = offline_devout->format;
+  }
+
+  g_rec_mutex_unlock(offline_devout_mutex);
+}
+
+void
+ags_offline_devout_list_cards(AgsSoundcard *soundcard,
+			      GList **card_id, GList **card_name)
+{
+  if(card_id != NULL){
+    *card_id = NULL;
+  }
+
+  if(card_name != NULL){
+    *card_name = NULL;
+  }
+
+  /* the one and only virtual device */
+  if(card_id != NULL){
+    *card_id = g_list_prepend(*card_id,
+			      g_strdup(AGS_OFFLINE_DEVOUT_DEFAULT_DEVICE));
+  }
+
+  if(card_name != NULL){
+    *card_name = g_list_prepend(*card_name,
+				g_strdup("offline"));
+  }
+}
+
+void
+ags_offline_devout_pcm_info(AgsSoundcard *soundcard,
+			    char *card_id,
+			    guint *channels_min, guint *channels_max,
+			    guint *rate_min, guint *rate_max,
+			    guint *buffer_size_min, guint *buffer_size_max,
+			    GError **error)
+{
+  if(channels_min != NULL){
+    *channels_min = AGS_SOUNDCARD_MIN_PCM_CHANNELS;
+  }
+
+  if(channels_max != NULL){
+    *channels_max = AGS_SOUNDCARD_MAX_PCM_CHANNELS;
+  }
+
+  if(rate_min != NULL){
+    *rate_min = (guint) AGS_SOUNDCARD_MIN_SAMPLERATE;
+  }
+
+  if(rate_max != NULL){
+    *rate_max = (guint) AGS_SOUNDCARD_MAX_SAMPLERATE;
+  }
+
+  if(buffer_size_min != NULL){
+    *buffer_size_min = AGS_SOUNDCARD_MIN_BUFFER_SIZE;
+  }
+
+  if(buffer_size_max != NULL){
+    *buffer_size_max = AGS_SOUNDCARD_MAX_BUFFER_SIZE;
+  }
+}
+
+guint
+ags_offline_devout_get_capability(AgsSoundcard *soundcard)
+{
+  return(AGS_SOUNDCARD_CAPABILITY_PLAYBACK);
+}
+
+gboolean
+ags_offline_devout_is_available(AgsSoundcard *soundcard)
+{
+  AgsOfflineDevout *offline_devout;
+  
+  gint64 poll_timeout;
+  gboolean is_available;
+
+  GRecMutex *offline_devout_mutex;
+  
+  offline_devout = AGS_OFFLINE_DEVOUT(soundcard);
+  
+  /* get offline devout mutex */
+  offline_devout_mutex = AGS_OFFLINE_DEVOUT_GET_OBJ_MUTEX(offline_devout);  
+
+  /* check available */
+  g_rec_mutex_lock(offline_devout_mutex);
+
+  if((AGS_OFFLINE_DEVOUT_FREE_RUN & (offline_devout->flags)) != 0){
+    g_rec_mutex_unlock(offline_devout_mutex);
+
+    return(TRUE);
+  }
+  
+  poll_timeout = offline_devout->poll_timeout;
+  
+  g_rec_mutex_unlock(offline_devout_mutex);
+
+  is_available = (poll_timeout < 0 ||
+		  g_get_monotonic_time() >= poll_timeout) ? TRUE: FALSE;
+  
+  return(is_available);
+}
+
+gboolean
+ags_offline_devout_is_starting(AgsSoundcard *soundcard)
+{
+  AgsOfflineDevout *offline_devout;
+
+  gboolean is_starting;
+  
+  GRecMutex *offline_devout_mutex;
+  
+  offline_devout = AGS_OFFLINE_DEVOUT(soundcard);
+
+  /* get offline devout mutex */
+  offline_devout_mutex = AGS_OFFLINE_DEVOUT_GET_OBJ_MUTEX(offline_devout);
+
+  /* check is starting */
+  g_rec_mutex_lock(offline_devout_mutex);
+
+  is_starting = ((AGS_OFFLINE_DEVOUT_START_PLAY & (offline_devout->flags)) != 0) ? TRUE: FALSE;
+
+  g_rec_mutex_unlock(offline_devout_mutex);
+  
+  return(is_starting);
+}
+
+gboolean
+ags_offline_devout_is_playing(AgsSoundcard *soundcard)
+{
+  AgsOfflineDevout *offline_devout;
+
+  gboolean is_playing;
+  
+  GRecMutex *offline_devout_mutex;
+
+  offline_devout = AGS_OFFLINE_DEVOUT(soundcard);
+  
+  /* get offline devout mutex */
+  offline_devout_mutex = AGS_OFFLINE_DEVOUT_GET_OBJ_MUTEX(offline_devout);
+
+  /* check is starting */
+  g_rec_mutex_lock(offline_devout_mutex);
+
+  is_playing = ((AGS_OFFLINE_DEVOUT_PLAY & (offline_devout->flags)) != 0) ? TRUE: FALSE;
+
+  g_rec_mutex_unlock(offline_devout_mutex);
+
+  return(is_playing);
+}
+
+gchar*
+ags_offline_devout_get_uptime(AgsSoundcard *soundcard)
+{
+  AgsOfflineDevout *offline_devout;
+
+  gchar *uptime;
+
+  GRecMutex *offline_devout_mutex;
+  
+  offline_devout = AGS_OFFLINE_DEVOUT(soundcard);
+  
+  /* get offline devout mutex */
+  offline_devout_mutex = AGS_OFFLINE_DEVOUT_GET_OBJ_MUTEX(offline_devout);
+
+  /* get time string */
+  g_rec_mutex_lock(offline_devout_mutex);
+  
+  uptime = ags_frame_clock_to_time_string(offline_devout->frame_clock);
+
+  g_rec_mutex_unlock(offline_devout_mutex);
+  
+  return(uptime);
+}
+
+void
+ags_offline_devout_device_play_init(AgsSoundcard *soundcard,
+				    GError **error)
+{
+  AgsOfflineDevout *offline_devout;
+
+  guint word_size;
+  guint i;
+
+  GRecMutex *offline_devout_mutex;
+
+  if(ags_soundcard_is_playing(soundcard)){
+    return;
+  }
+
+  offline_devout = AGS_OFFLINE_DEVOUT(soundcard);
+
+  /* get offline devout mutex */
+  offline_devout_mutex = AGS_OFFLINE_DEVOUT_GET_OBJ_MUTEX(offline_devout);
+
+  /* retrieve word size */
+  g_rec_mutex_lock(offline_devout_mutex);
+
+  switch(offline_devout->format){
+  case AGS_SOUNDCARD_SIGNED_8_BIT:
+  {
+    word_size = sizeof(gint8);
+  }
+  break;
+  case AGS_SOUNDCARD_SIGNED_16_BIT:
+  {
+    word_size = sizeof(gint16);
+  }
+  break;
+  case AGS_SOUNDCARD_SIGNED_24_BIT:
+  {
+    word_size = sizeof(gint32);
+  }
+  break;
+  case AGS_SOUNDCARD_SIGNED_32_BIT:
+  {
+    word_size = sizeof(gint32);
+  }
+  break;
+  case AGS_SOUNDCARD_SIGNED_64_BIT:
+  {
+    word_size = sizeof(gint64);
+  }
+  break;
+  case AGS_SOUNDCARD_FLOAT:
+  {
+    word_size = sizeof(gfloat);
+  }
+  break;
+  case AGS_SOUNDCARD_DOUBLE:
+  {
+    word_size = sizeof(gdouble);
+  }
+  break;
+  default:
+    g_rec_mutex_unlock(offline_devout_mutex);
+
+    g_warning("ags_offline_devout_device_play_init(): unsupported word size");
+
+    return;
+  }
+
+  /* prepare for playback */
+  offline_devout->flags |= (AGS_OFFLINE_DEVOUT_START_PLAY |
+			    AGS_OFFLINE_DEVOUT_PLAY |
+			    AGS_OFFLINE_DEVOUT_NONBLOCKING);
+
+  for(i = 0; i < AGS_OFFLINE_DEVOUT_DEFAULT_APP_BUFFER_SIZE; i++){
+    memset(offline_devout->app_buffer[i], 0, offline_devout->pcm_channels * offline_devout->buffer_size * word_size);
+  }
+
+  offline_devout->flags |= AGS_OFFLINE_DEVOUT_INITIALIZED;
+
+  ags_frame_clock_set_start_note_offset(offline_devout->frame_clock,
+					offline_devout->start_note_offset);
+
+  ags_frame_clock_start(offline_devout->frame_clock);
+
+  offline_devout->app_buffer_mode = AGS_OFFLINE_DEVOUT_APP_BUFFER_0;
+
+  offline_devout->poll_timeout = -1;
+  
+  g_rec_mutex_unlock(offline_devout_mutex);
+}
+
+void
+ags_offline_devout_device_play(AgsSoundcard *soundcard,
+			       GError **error)
+{
+  AgsOfflineDevout *offline_devout;
+
+  AgsTicDevice *tic_device;
+  AgsClearBuffer *clear_buffer;
+  AgsSwitchBufferFlag *switch_buffer_flag;
+  
+  AgsTaskLauncher *task_launcher;
+
+  AgsApplicationContext *application_context;
+  
+  GList *task;
+
+  gint64 poll_timeout;
+  gint64 current_time;
+  gboolean initial_run;
+  gboolean free_run;
+  
+  GRecMutex *offline_devout_mutex;
+  
+  offline_devout = AGS_OFFLINE_DEVOUT(soundcard);
+
+  application_context = ags_application_context_get_instance();
+
+  /* get offline devout mutex */
+  offline_devout_mutex = AGS_OFFLINE_DEVOUT_GET_OBJ_MUTEX(offline_devout);
+
+  /* lock */
+  g_rec_mutex_lock(offline_devout_mutex);
+  
+  initial_run = ((AGS_OFFLINE_DEVOUT_START_PLAY & (offline_devout->flags)) != 0) ? TRUE: FALSE;
+  free_run = ((AGS_OFFLINE_DEVOUT_FREE_RUN & (offline_devout->flags)) != 0) ? TRUE: FALSE;
+  
+  /* do playback */
+  offline_devout->flags &= (~AGS_OFFLINE_DEVOUT_START_PLAY);
+
+  if((AGS_OFFLINE_DEVOUT_INITIALIZED & (offline_devout->flags)) == 0){
+    g_rec_mutex_unlock(offline_devout_mutex);
+    
+    return;
+  }
+
+  poll_timeout = offline_devout->poll_timeout;
+
+  g_rec_mutex_unlock(offline_devout_mutex);
+
+  /* wait until the period elapsed, unless free running */
+  current_time = g_get_monotonic_time();
+  
+  if(!free_run &&
+     poll_timeout >= 0 &&
+     current_time < poll_timeout){
+    g_usleep(poll_timeout - current_time);
+
+    current_time = poll_timeout;
+  }
+  
+  g_rec_mutex_lock(offline_devout_mutex);
+
+  if(free_run){
+    offline_devout->poll_timeout = -1;
+  }else{
+    offline_devout->poll_timeout = current_time + (G_USEC_PER_SEC * (1.0 / (gdouble) offline_devout->samplerate * (gdouble) offline_devout->buffer_size));
+  }
+  
+  g_rec_mutex_unlock(offline_devout_mutex);
+
+  /* update soundcard */
+  task_launcher = ags_concurrency_provider_get_task_launcher(AGS_CONCURRENCY_PROVIDER(application_context));
+
+  task = NULL;
+  
+  /* tic soundcard */
+  if(!initial_run){
+    tic_device = ags_tic_device_new((GObject *) offline_devout);
+    task = g_list_append(task,
+			 tic_device);
+  }
+  
+  /* reset - clear buffer */
+  clear_buffer = ags_clear_buffer_new((GObject *) offline_devout);
+  task = g_list_append(task,
+		       clear_buffer);
+
+  /* reset - switch buffer flags */
+  switch_buffer_flag = ags_switch_buffer_flag_new((GObject *) offline_devout);
+  task = g_list_append(task,
+		       switch_buffer_flag);
+
+  /* append tasks */
+  ags_task_launcher_add_task_all(task_launcher,
+				 task);
+  
+  /* unref */
+  g_list_free_full(task,
+		   g_object_unref);
+
+  g_object_unref(task_launcher);
+}
+
+void
+ags_offline_devout_device_free(AgsSoundcard *soundcard)
+{
+  AgsOfflineDevout *offline_devout;
+
+  GRecMutex *offline_devout_mutex;
+  
+  offline_devout = AGS_OFFLINE_DEVOUT(soundcard);
+
+  /* get offline devout mutex */
+  offline_devout_mutex = AGS_OFFLINE_DEVOUT_GET_OBJ_MUTEX(offline_devout);
+
+  /*  */
+  g_rec_mutex_lock(offline_devout_mutex);
+
+  if((AGS_OFFLINE_DEVOUT_INITIALIZED & (offline_devout->flags)) == 0){
+    g_rec_mutex_unlock(offline_devout_mutex);
+    
+    return;
+  }
+
+  /* reset flags */
+  offline_devout->flags &= (~(AGS_OFFLINE_DEVOUT_PLAY |
+			      AGS_OFFLINE_DEVOUT_INITIALIZED));
+
+  offline_devout->app_buffer_mode = AGS_OFFLINE_DEVOUT_APP_BUFFER_0;
+
+  offline_devout->poll_timeout = -1;
+
+  ags_frame_clock_stop(offline_devout->frame_clock);
+
+  ags_atomic_int_set(&(offline_devout->available), FALSE);
+
+  g_rec_mutex_unlock(offline_devout_mutex);
+}
+
+void
+ags_offline_devout_tic(AgsSoundcard *soundcard)
+{
+  AgsOfflineDevout *offline_devout;
+
+  GRecMutex *offline_devout_mutex;
+  
+  offline_devout = AGS_OFFLINE_DEVOUT(soundcard);
+  
+  /* get offline devout mutex */
+  offline_devout_mutex = AGS_OFFLINE_DEVOUT_GET_OBJ_MUTEX(offline_devout);
+
+  /* frame clock */
+  g_rec_mutex_lock(offline_devout_mutex);
+  
+  ags_frame_clock_increment_counter(offline_devout->frame_clock);
+
+  /* 16th pulse */
+  if(ags_frame_clock_get_has_16th_pulse(offline_devout->frame_clock)){
+    ags_soundcard_offset_changed(soundcard,
+				 offline_devout->frame_clock->note_offset);
+  }
+  
+  g_rec_mutex_unlock(offline_devout_mutex);
+}
+
+void
+ags_offline_devout_offset_changed(AgsSoundcard *soundcard,
+				  guint64 note_offset)
+{
+  //empty
+}
+
+void
+ags_offline_devout_set_bpm(AgsSoundcard *soundcard,
+			   gdouble bpm)
+{
+  AgsOfflineDevout *offline_devout;
+
+  GRecMutex *offline_devout_mutex;
+  
+  offline_devout = AGS_OFFLINE_DEVOUT(soundcard);
+
+  /* get offline devout mutex */
+  offline_devout_mutex = AGS_OFFLINE_DEVOUT_GET_OBJ_MUTEX(offline_devout);
+
+  /* set bpm */
+  g_rec_mutex_lock(offline_devout_mutex);
+
+  offline_devout->bpm = bpm;
+
+  ags_frame_clock_set_bpm(offline_devout->frame_clock,
+			  bpm);
+
+  g_rec_mutex_unlock(offline_devout_mutex);
+}
+
+gdouble
+ags_offline_devout_get_bpm(AgsSoundcard *soundcard)
+{
+  AgsOfflineDevout *offline_devout;
+
+  gdouble bpm;
+  
+  GRecMutex *offline_devout_mutex;
+  
+  offline_devout = AGS_OFFLINE_DEVOUT(soundcard);
+
+  /* get offline devout mutex */
+  offline_devout_mutex = AGS_OFFLINE_DEVOUT_GET_OBJ_MUTEX(offline_devout);
+
+  /* get bpm */
+  g_rec_mutex_lock(offline_devout_mutex);
+
+  bpm = offline_devout->bpm;
+  
+  g_rec_mutex_unlock(offline_devout_mutex);
+
+  return(bpm);
+}
+
+void
+ags_offline_devout_set_start_note_offset(AgsSoundcard *soundcard,
+					 guint64 start_note_offset)
+{
+  AgsOfflineDevout *offline_devout;
+
+  GRecMutex *offline_devout_mutex;  
+
+  offline_devout = AGS_OFFLINE_DEVOUT(soundcard);
+
+  /* get offline devout mutex */
+  offline_devout_mutex = AGS_OFFLINE_DEVOUT_GET_OBJ_MUTEX(offline_devout);
+
+  /* set note offset */
+  g_rec_mutex_lock(offline_devout_mutex);
+
+  offline_devout->start_note_offset = start_note_offset;
+
+  g_rec_mutex_unlock(offline_devout_mutex);
+}
+
+guint64
+ags_offline_devout_get_start_note_offset(AgsSoundcard *soundcard)
+{
+  AgsOfflineDevout *offline_devout;
+
+  guint64 start_note_offset;
+  
+  GRecMutex *offline_devout_mutex;  
+
+  offline_devout = AGS_OFFLINE_DEVOUT(soundcard);
+
+  /* get offline devout mutex */
+  offline_devout_mutex = AGS_OFFLINE_DEVOUT_GET_OBJ_MUTEX(offline_devout);
+
+  /* set note offset */
+  g_rec_mutex_lock(offline_devout_mutex);
+
+  start_note_offset = offline_devout->start_note_offset;
+
+  g_rec_mutex_unlock(offline_devout_mutex);
+
+  return(start_note_offset);
+}
+
+GObject*
+ags_offline_devout_get_frame_clock(AgsSoundcard *soundcard)
+{
+  AgsOfflineDevout *offline_devout;
+
+  GObject *frame_clock;
+  
+  GRecMutex *offline_devout_mutex;
+  
+  offline_devout = AGS_OFFLINE_DEVOUT(soundcard);
+
+  /* get core audio devout mutex */
+  offline_devout_mutex = AGS_OFFLINE_DEVOUT_GET_OBJ_MUTEX(offline_devout);
+
+  /* get frame clock */
+  g_rec_mutex_lock(offline_devout_mutex);
+
+  frame_clock = (GObject *) offline_devout->frame_clock;
+  
+  g_rec_mutex_unlock(offline_devout_mutex);
+
+  return(frame_clock);
+}
+
+void*
+ags_offline_devout_get_buffer(AgsSoundcard *soundcard)
+{
+  AgsOfflineDevout *offline_devout;
+
+  void *buffer;
+  
+  offline_devout = AGS_OFFLINE_DEVOUT(soundcard);
+
+  buffer = offline_devout->app_buffer[offline_devout->app_buffer_mode];
+
+  return(buffer);
+}
+
+void*
+ags_offline_devout_get_next_buffer(AgsSoundcard *soundcard)
+{
+  AgsOfflineDevout *offline_devout;
+
+  void *buffer;
+  
+  offline_devout = AGS_OFFLINE_DEVOUT(soundcard);
+
+  if(offline_devout->app_buffer_mode == AGS_OFFLINE_DEVOUT_APP_BUFFER_3){
+    buffer = offline_devout->app_buffer[AGS_OFFLINE_DEVOUT_APP_BUFFER_0];
+  }else{
+    buffer = offline_devout->app_buffer[offline_devout->app_buffer_mode + 1];
+  }
+
+  return(buffer);
+}
+
+void*
+ags_offline_devout_get_prev_buffer(AgsSoundcard *soundcard)
+{
+  AgsOfflineDevout *offline_devout;
+
+  void *buffer;
+  
+  offline_devout = AGS_OFFLINE_DEVOUT(soundcard);
+
+  if(offline_devout->app_buffer_mode == AGS_OFFLINE_DEVOUT_APP_BUFFER_0){
+    buffer = offline_devout->app_buffer[AGS_OFFLINE_DEVOUT_APP_BUFFER_3];
+  }else{
+    buffer = offline_devout->app_buffer[offline_devout->app_buffer_mode - 1];
+  }
+
+  return(buffer);
+}
+
+void
+ags_offline_devout_lock_buffer(AgsSoundcard *soundcard,
+			       void *buffer)
+{
+  AgsOfflineDevout *offline_devout;
+
+  GRecMutex *buffer_mutex;
+  
+  offline_devout = AGS_OFFLINE_DEVOUT(soundcard);
+
+  buffer_mutex = NULL;
+
+  if(offline_devout->app_buffer != NULL){
+    if(buffer == offline_devout->app_buffer[0]){
+      buffer_mutex = offline_devout->app_buffer_mutex[0];
+    }else if(buffer == offline_devout->app_buffer[1]){
+      buffer_mutex = offline_devout->app_buffer_mutex[1];
+    }else if(buffer == offline_devout->app_buffer[2]){
+      buffer_mutex = offline_devout->app_buffer_mutex[2];
+    }else if(buffer == offline_devout->app_buffer[3]){
+      buffer_mutex = offline_devout->app_buffer_mutex[3];
+    }
+  }
+  
+  if(buffer_mutex != NULL){
+    g_rec_mutex_lock(buffer_mutex);
+  }
+}
+
+void
+ags_offline_devout_unlock_buffer(AgsSoundcard *soundcard,
+				 void *buffer)
+{
+  AgsOfflineDevout *offline_devout;
+
+  GRecMutex *buffer_mutex;
+  
+  offline_devout = AGS_OFFLINE_DEVOUT(soundcard);
+
+  buffer_mutex = NULL;
+
+  if(offline_devout->app_buffer != NULL){
+    if(buffer == offline_devout->app_buffer[0]){
+      buffer_mutex = offline_devout->app_buffer_mutex[0];
+    }else if(buffer == offline_devout->app_buffer[1]){
+      buffer_mutex = offline_devout->app_buffer_mutex[1];
+    }else if(buffer == offline_devout->app_buffer[2]){
+      buffer_mutex = offline_devout->app_buffer_mutex[2];
+    }else if(buffer == offline_devout->app_buffer[3]){
+      buffer_mutex = offline_devout->app_buffer_mutex[3];
+    }
+  }
+
+  if(buffer_mutex != NULL){
+    g_rec_mutex_unlock(buffer_mutex);
+  }
+}
+
+guint
+ags_offline_devout_get_sub_block_count(AgsSoundcard *soundcard)
+{
+  AgsOfflineDevout *offline_devout;
+
+  guint sub_block_count;
+  
+  GRecMutex *offline_devout_mutex;  
+
+  offline_devout = AGS_OFFLINE_DEVOUT(soundcard);
+
+  /* get offline devout mutex */
+  offline_devout_mutex = AGS_OFFLINE_DEVOUT_GET_OBJ_MUTEX(offline_devout);
+
+  /* get loop offset */
+  g_rec_mutex_lock(offline_devout_mutex);
+
+  sub_block_count = offline_devout->sub_block_count;
+  
+  g_rec_mutex_unlock(offline_devout_mutex);
+
+  return(sub_block_count);
+}
+
+gboolean
+ags_offline_devout_trylock_sub_block(AgsSoundcard *soundcard,
+				     void *buffer, guint sub_block)
+{
+  AgsOfflineDevout *offline_devout;
+
+  guint pcm_channels;
+  guint sub_block_count;
+  gboolean success;
+  
+  GRecMutex *offline_devout_mutex;  
+  GRecMutex *sub_block_mutex;
+
+  offline_devout = AGS_OFFLINE_DEVOUT(soundcard);
+
+  /* get offline devout mutex */
+  offline_devout_mutex = AGS_OFFLINE_DEVOUT_GET_OBJ_MUTEX(offline_devout);
+
+  /* get loop offset */
+  g_rec_mutex_lock(offline_devout_mutex);
+
+  pcm_channels = offline_devout->pcm_channels;
+  sub_block_count = offline_devout->sub_block_count;
+  
+  g_rec_mutex_unlock(offline_devout_mutex);
+  
+  sub_block_mutex = NULL;
+
+  success = FALSE;
+  
+  if(offline_devout->app_buffer != NULL){
+    if(buffer == offline_devout->app_buffer[0]){
+      sub_block_mutex = offline_devout->sub_block_mutex[sub_block];
+    }else if(buffer == offline_devout->app_buffer[1]){
+      sub_block_mutex = offline_devout->sub_block_mutex[pcm_channels * sub_block_count + sub_block];
+    }else if(buffer == offline_devout->app_buffer[2]){
+      sub_block_mutex = offline_devout->sub_block_mutex[2 * pcm_channels * sub_block_count + sub_block];
+    }else if(buffer == offline_devout->app_buffer[3]){
+      sub_block_mutex = offline_devout->sub_block_mutex[3 * pcm_channels * sub_block_count + sub_block];
+    }
+  }
+
+  if(sub_block_mutex != NULL){
+    if(g_rec_mutex_trylock(sub_block_mutex)){
+      success = TRUE;
+    }
+  }
+
+  return(success);
+}
+
+void
+ags_offline_devout_unlock_sub_block(AgsSoundcard *soundcard,
+				    void *buffer, guint sub_block)
+{
+  AgsOfflineDevout *offline_devout;
+
+  guint pcm_channels;
+  guint sub_block_count;
+  
+  GRecMutex *offline_devout_mutex;  
+  GRecMutex *sub_block_mutex;
+
+  offline_devout = AGS_OFFLINE_DEVOUT(soundcard);
+
+  /* get offline devout mutex */
+  offline_devout_mutex = AGS_OFFLINE_DEVOUT_GET_OBJ_MUTEX(offline_devout);
+
+  /* get loop offset */
+  g_rec_mutex_lock(offline_devout_mutex);
+
+  pcm_channels = offline_devout->pcm_channels;
+  sub_block_count = offline_devout->sub_block_count;
+  
+  g_rec_mutex_unlock(offline_devout_mutex);
+  
+  sub_block_mutex = NULL;
+  
+  if(offline_devout->app_buffer != NULL){
+    if(buffer == offline_devout->app_buffer[0]){
+      sub_block_mutex = offline_devout->sub_block_mutex[sub_block];
+    }else if(buffer == offline_devout->app_buffer[1]){
+      sub_block_mutex = offline_devout->sub_block_mutex[pcm_channels * sub_block_count + sub_block];
+    }else if(buffer == offline_devout->app_buffer[2]){
+      sub_block_mutex = offline_devout->sub_block_mutex[2 * pcm_channels * sub_block_count + sub_block];
+    }else if(buffer == offline_devout->app_buffer[3]){
+      sub_block_mutex = offline_devout->sub_block_mutex[3 * pcm_channels * sub_block_count + sub_block];
+    }
+  }
+
+  if(sub_block_mutex != NULL){
+    g_rec_mutex_unlock(sub_block_mutex);
+  }
+}
+
+/**
+ * ags_offline_devout_switch_buffer_flag:
+ * @offline_devout: the #AgsOfflineDevout
+ *
+ * The buffer flag indicates the currently played buffer.
+ *
+ * Since: 9.1.0
+ */
+void
+ags_offline_devout_switch_buffer_flag(AgsOfflineDevout *offline_devout)
+{
+  GRecMutex *offline_devout_mutex;
+  
+  if(!AGS_IS_OFFLINE_DEVOUT(offline_devout)){
+    return;
+  }
+
+  /* get offline devout mutex */
+  offline_devout_mutex = AGS_OFFLINE_DEVOUT_GET_OBJ_MUTEX(offline_devout);
+
+  /* switch buffer flag */
+  g_rec_mutex_lock(offline_devout_mutex);
+
+  if(offline_devout->app_buffer_mode < AGS_OFFLINE_DEVOUT_APP_BUFFER_3){
+    offline_devout->app_buffer_mode += 1;
+  }else{
+    offline_devout->app_buffer_mode = AGS_OFFLINE_DEVOUT_APP_BUFFER_0;
+  }
+
+  g_rec_mutex_unlock(offline_devout_mutex);
+}
+
+/**
+ * ags_offline_devout_realloc_buffer:
+ * @offline_devout: the #AgsOfflineDevout
+ *
+ * Reallocate the internal audio buffer.
+ *
+ * Since: 9.1.0
+ */
+void
+ags_offline_devout_realloc_buffer(AgsOfflineDevout *offline_devout)
+{
+  guint pcm_channels;
+  guint buffer_size;
+  guint word_size;
+  AgsSoundcardFormat format;
+  
+  GRecMutex *offline_devout_mutex;  
+
+  if(!AGS_IS_OFFLINE_DEVOUT(offline_devout)){
+    return;
+  }
+
+  /* get offline devout mutex */
+  offline_devout_mutex = AGS_OFFLINE_DEVOUT_GET_OBJ_MUTEX(offline_devout);
+
+  /* get word size */  
+  g_rec_mutex_lock(offline_devout_mutex);
+
+  pcm_channels = offline_devout->pcm_channels;
+  buffer_size = offline_devout->buffer_size;
+
+  format = offline_devout->format;
+  
+  g_rec_mutex_unlock(offline_devout_mutex);
+  
+  switch(format){
+  case AGS_SOUNDCARD_SIGNED_8_BIT:
+  {
+    word_size = sizeof(gint8);
+  }
+  break;
+  case AGS_SOUNDCARD_SIGNED_16_BIT:
+  {
+    word_size = sizeof(gint16);
+  }
+  break;
+  case AGS_SOUNDCARD_SIGNED_24_BIT:
+  {
+    word_size = sizeof(gint32);
+  }
+  break;
+  case AGS_SOUNDCARD_SIGNED_32_BIT:
+  {
+    word_size = sizeof(gint32);
+  }
+  break;
+  case AGS_SOUNDCARD_SIGNED_64_BIT:
+  {
+    word_size = sizeof(gint64);
+  }
+  break;
+  case AGS_SOUNDCARD_FLOAT:
+  {
+    word_size = sizeof(gfloat);
+  }
+  break;
+  case AGS_SOUNDCARD_DOUBLE:
+  {
+    word_size = sizeof(gdouble);
+  }
+  break;
+  default:
+    g_warning("ags_offline_devout_realloc_buffer(): unsupported word size");
+    
+    return;
+  }  
+
+  //NOTE:JK: there is no lock applicable to buffer
+
+  if(offline_devout->app_buffer[0] != NULL){
+    g_free(offline_devout->app_buffer[0]);
+  }
+  
+  offline_devout->app_buffer[0] = (void *) g_malloc(pcm_channels * buffer_size * word_size);
+  
+  if(offline_devout->app_buffer[1] != NULL){
+    g_free(offline_devout->app_buffer[1]);
+  }
+
+  offline_devout->app_buffer[1] = (void *) g_malloc(pcm_channels * buffer_size * word_size);
+  
+  if(offline_devout->app_buffer[2] != NULL){
+    g_free(offline_devout->app_buffer[2]);
+  }
+
+  offline_devout->app_buffer[2] = (void *) g_malloc(pcm_channels * buffer_size * word_size);
+  
+  if(offline_devout->app_buffer[3] != NULL){
+    g_free(offline_devout->app_buffer[3]);
+  }
+  
+  offline_devout->app_buffer[3] = (void *) g_malloc(pcm_channels * buffer_size * word_size);
+}
+
+/**
+ * ags_offline_devout_new:
+ *
+ * Creates a new instance of #AgsOfflineDevout.
+ *
+ * Returns: the new #AgsOfflineDevout
+ *
+ * Since: 9.1.0
+ */
+AgsOfflineDevout*
+ags_offline_devout_new()
+{
+  AgsOfflineDevout *offline_devout;
+
+  offline_devout = (AgsOfflineDevout *) g_object_new(AGS_TYPE_OFFLINE_DEVOUT,
+						     NULL);
+  
+  return(offline_devout);
+}
@@ -0,0 +1,150 @@
+/* GSequencer - Advanced GTK Sequencer
+ * Copyright (C) 2005-2026 Joël Krähemann
+ *
+ * This file is part of GSequencer.
+ *
+ * GSequencer is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GSequencer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GSequencer.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __AGS_OFFLINE_DEVOUT_H__
+#define __AGS_OFFLINE_DEVOUT_H__
+
+#include <glib.h>
+#include <glib-object.h>
+
+#include <ags/libags.h>
+
+G_BEGIN_DECLS
+
+#define AGS_TYPE_OFFLINE_DEVOUT                (ags_offline_devout_get_type())
+#define AGS_OFFLINE_DEVOUT(obj)                (G_TYPE_CHECK_INSTANCE_CAST((obj), AGS_TYPE_OFFLINE_DEVOUT, AgsOfflineDevout))
+#define AGS_OFFLINE_DEVOUT_CLASS(class)        (G_TYPE_CHECK_CLASS_CAST(class, AGS_TYPE_OFFLINE_DEVOUT, AgsOfflineDevout))
+#define AGS_IS_OFFLINE_DEVOUT(obj)             (G_TYPE_CHECK_INSTANCE_TYPE ((obj), AGS_TYPE_OFFLINE_DEVOUT))
+#define AGS_IS_OFFLINE_DEVOUT_CLASS(class)     (G_TYPE_CHECK_CLASS_TYPE ((class), AGS_TYPE_OFFLINE_DEVOUT))
+#define AGS_OFFLINE_DEVOUT_GET_CLASS(obj)      (G_TYPE_INSTANCE_GET_CLASS(obj, AGS_TYPE_OFFLINE_DEVOUT, AgsOfflineDevoutClass))
+
+#define AGS_OFFLINE_DEVOUT_GET_OBJ_MUTEX(obj) (&(((AgsOfflineDevout *) obj)->obj_mutex))
+
+#define AGS_OFFLINE_DEVOUT_DEFAULT_DEVICE "offline"
+
+#define AGS_OFFLINE_DEVOUT_DEFAULT_APP_BUFFER_SIZE (4)
+
+typedef struct _AgsOfflineDevout AgsOfflineDevout;
+typedef struct _AgsOfflineDevoutClass AgsOfflineDevoutClass;
+
+/**
+ * AgsOfflineDevoutFlags:
+ * @AGS_OFFLINE_DEVOUT_INITIALIZED: the soundcard was initialized
+ * @AGS_OFFLINE_DEVOUT_START_PLAY: playback starting
+ * @AGS_OFFLINE_DEVOUT_PLAY: devout is running
+ * @AGS_OFFLINE_DEVOUT_SHUTDOWN: stop playback
+ * @AGS_OFFLINE_DEVOUT_NONBLOCKING: do non-blocking calls
+ * @AGS_OFFLINE_DEVOUT_ATTACK_FIRST: use first attack, instead of second one
+ * @AGS_OFFLINE_DEVOUT_FREE_RUN: don't pace playback to wall clock, render as fast as possible
+ * 
+ * Enum values to control the behavior or indicate internal state of #AgsOfflineDevout by
+ * enable/disable as flags.
+ */
+typedef enum
+{
+  AGS_OFFLINE_DEVOUT_INITIALIZED        = 1,
+
+  AGS_OFFLINE_DEVOUT_PLAY               = 1 <<  1,
+  AGS_OFFLINE_DEVOUT_START_PLAY         = 1 <<  2,
+  AGS_OFFLINE_DEVOUT_SHUTDOWN           = 1 <<  3,
+
+  AGS_OFFLINE_DEVOUT_NONBLOCKING        = 1 <<  4,
+  
+  AGS_OFFLINE_DEVOUT_ATTACK_FIRST       = 1 <<  5,
+
+  AGS_OFFLINE_DEVOUT_FREE_RUN           = 1 <<  6,
+}AgsOfflineDevoutFlags;
+
+/**
+ * AgsOfflineDevoutAppBufferMode:
+ * @AGS_OFFLINE_DEVOUT_APP_BUFFER_0: ring-buffer 0
+ * @AGS_OFFLINE_DEVOUT_APP_BUFFER_1: ring-buffer 1
+ * @AGS_OFFLINE_DEVOUT_APP_BUFFER_2: ring-buffer 2
+ * @AGS_OFFLINE_DEVOUT_APP_BUFFER_3: ring-buffer 3
+ * 
+ * Enum values to indicate internal state of #AgsOfflineDevout application buffer by
+ * setting mode.
+ */
+typedef enum{
+  AGS_OFFLINE_DEVOUT_APP_BUFFER_0,
+  AGS_OFFLINE_DEVOUT_APP_BUFFER_1,
+  AGS_OFFLINE_DEVOUT_APP_BUFFER_2,
+  AGS_OFFLINE_DEVOUT_APP_BUFFER_3,
+}AgsOfflineDevoutAppBufferMode;
+
+struct _AgsOfflineDevout
+{
+  GObject gobject;
+
+  AgsOfflineDevoutFlags flags;
+  AgsConnectableFlags connectable_flags;
+  
+  GRecMutex obj_mutex;
+
+  AgsUUID *uuid;
+
+  guint dsp_channels;
+  guint pcm_channels;
+  AgsSoundcardFormat format;
+  guint buffer_size;
+  guint samplerate;
+  
+  gdouble bpm; // beats per minute
+
+  guint64 start_note_offset;
+  
+  AgsFrameClock *frame_clock;
+
+  AgsOfflineDevoutAppBufferMode app_buffer_mode;
+  
+  GRecMutex **app_buffer_mutex;
+
+  guint sub_block_count;
+  GRecMutex **sub_block_mutex;
+
+  void **app_buffer;
+
+  _Atomic gboolean available;
+  
+  char *device;
+
+  gint64 poll_timeout;
+};
+
+struct _AgsOfflineDevoutClass
+{
+  GObjectClass gobject;
+};
+
+GType ags_offline_devout_get_type();
+GType ags_offline_devout_flags_get_type();
+
+gboolean ags_offline_devout_test_flags(AgsOfflineDevout *offline_devout, AgsOfflineDevoutFlags flags);
+void ags_offline_devout_set_flags(AgsOfflineDevout *offline_devout, AgsOfflineDevoutFlags flags);
+void ags_offline_devout_unset_flags(AgsOfflineDevout *offline_devout, AgsOfflineDevoutFlags flags);
+
+void ags_offline_devout_switch_buffer_flag(AgsOfflineDevout *offline_devout);
+
+void ags_offline_devout_realloc_buffer(AgsOfflineDevout *offline_devout);
+
+AgsOfflineDevout* ags_offline_devout_new();
+
+G_END_DECLS
+
+#endif /*__AGS_OFFLINE_DEVOUT_H__*/
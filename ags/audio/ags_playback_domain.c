@@ -174,6 +174,7 @@ ags_playback_domain_init(AgsPlaybackDomain *playback_domain)
   gchar *thread_model, *super_threaded_scope;
 
   gboolean super_threaded_audio;
+  gboolean work_stealing;
   guint i;
 
   playback_domain->flags = 0;
@@ -187,6 +188,7 @@ ags_playback_domain_init(AgsPlaybackDomain *playback_domain)
 
   /* thread model */
   super_threaded_audio = FALSE;
+  work_stealing = FALSE;
 
   thread_model = ags_config_get_value(config,
 				      AGS_CONFIG_THREAD,
@@ -194,8 +196,15 @@ ags_playback_domain_init(AgsPlaybackDomain *playback_domain)
 
   if(thread_model != NULL &&
      !g_ascii_strncasecmp(thread_model,
-			  "super-threaded",
-			  15)){
+			  "work-stealing",
+			  14)){
+    /* the audio threads hold the tree dispatcher, but are run by the scheduler */
+    super_threaded_audio = TRUE;
+    work_stealing = TRUE;
+  }else if(thread_model != NULL &&
+	   !g_ascii_strncasecmp(thread_model,
+				"super-threaded",
+				15)){
     super_threaded_scope = ags_config_get_value(config,
 						AGS_CONFIG_THREAD,
 						"super-threaded-scope");
@@ -219,6 +228,10 @@ ags_playback_domain_init(AgsPlaybackDomain *playback_domain)
     playback_domain->flags |= AGS_PLAYBACK_DOMAIN_SUPER_THREADED_AUDIO;
   }
 
+  if(work_stealing){
+    playback_domain->flags |= AGS_PLAYBACK_DOMAIN_WORK_STEALING;
+  }
+
   /* domain */
   playback_domain->audio = NULL;
 
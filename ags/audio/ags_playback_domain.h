@@ -45,6 +45,7 @@ typedef struct _AgsPlaybackDomainClass AgsPlaybackDomainClass;
  * AgsPlaybackDomainFlags:
  * @AGS_PLAYBACK_DOMAIN_SINGLE_THREADED: single threaded
  * @AGS_PLAYBACK_DOMAIN_SUPER_THREADED_AUDIO: super threaded audio
+ * @AGS_PLAYBACK_DOMAIN_WORK_STEALING: the audio threads are run by the work-stealing scheduler of #AgsAudioLoop
  * 
  * Enum values to control the behavior or indicate internal state of #AgsPlaybackDomain by
  * enable/disable as flags.
@@ -52,6 +53,7 @@ typedef struct _AgsPlaybackDomainClass AgsPlaybackDomainClass;
 typedef enum{
   AGS_PLAYBACK_DOMAIN_SINGLE_THREADED            = 1,
   AGS_PLAYBACK_DOMAIN_SUPER_THREADED_AUDIO       = 1 <<  1,
+  AGS_PLAYBACK_DOMAIN_WORK_STEALING              = 1 <<  2,
 }AgsPlaybackDomainFlags;
 
 struct _AgsPlaybackDomain
@@ -25,6 +25,7 @@
 
 #include <stdlib.h>
 #include <string.h>
+#include <math.h>
 
 #include <ags/i18n.h>
 
@@ -522,6 +523,9 @@ ags_port_init(AgsPort *port)
   
   port->automation = NULL;
 
+  port->automation_revision = 1;
+  port->automation_cursor = ags_automation_cursor_alloc();
+
   port->port_value.ags_port_double = 0.0;
 }
 
@@ -736,6 +740,8 @@ ags_port_set_property(GObject *gobject,
 	g_object_ref(automation);
 	port->automation = ags_automation_add(port->automation,
 					      automation);      
+
+	ags_port_increment_automation_revision(port);
       }
       
       g_rec_mutex_unlock(port_mutex);
@@ -903,6 +909,8 @@ ags_port_dispose(GObject *gobject)
 		     g_object_unref);
 
     port->automation = NULL;
+
+    ags_port_increment_automation_revision(port);
   }
   
   /* call parent */
@@ -933,6 +941,10 @@ ags_port_finalize(GObject *gobject)
     g_list_free_full(port->automation,
 		     g_object_unref);
   }
+
+  if(port->automation_cursor != NULL){
+    ags_automation_cursor_free(port->automation_cursor);
+  }
   
   /* call parent */
   G_OBJECT_CLASS(ags_port_parent_class)->finalize(gobject);
@@ -1967,6 +1979,8 @@ ags_port_add_automation(AgsPort *port, GObject *automation)
     g_object_set(automation,
 		 "port", port,
 		 NULL);
+
+    ags_port_increment_automation_revision(port);
   }
   
   g_rec_mutex_unlock(port_mutex);
@@ -2007,11 +2021,233 @@ ags_port_remove_automation(AgsPort *port, GObject *automation)
 		 NULL);
 
     g_object_unref(automation);
+
+    ags_port_increment_automation_revision(port);
   }
   
   g_rec_mutex_unlock(port_mutex);
 }
 
+/**
+ * ags_port_get_automation_revision:
+ * @port: the #AgsPort
+ *
+ * Get the automation revision, it is incremented as any #AgsAutomation
+ * of @port is modified.
+ *
+ * Returns: the revision
+ *
+ * Since: 9.1.0
+ */
+guint
+ags_port_get_automation_revision(AgsPort *port)
+{
+  if(!AGS_IS_PORT(port)){
+    return(0);
+  }
+
+  return(ags_atomic_uint_get(&(port->automation_revision)));
+}
+
+/**
+ * ags_port_increment_automation_revision:
+ * @port: the #AgsPort
+ *
+ * Increment the automation revision, so the automation cursor collects the
+ * points again.
+ *
+ * Since: 9.1.0
+ */
+void
+ags_port_increment_automation_revision(AgsPort *port)
+{
+  if(!AGS_IS_PORT(port)){
+    return;
+  }
+
+  ags_atomic_uint_increment(&(port->automation_revision));
+}
+
+/**
+ * ags_port_automate:
+ * @port: the #AgsPort
+ * @x: the x-offset of the block
+ * @x_end: the x-end-offset of the block
+ * @buffer_length: the number of frames of the block
+ *
+ * Evaluate the automation of @port for the block starting at @x and write
+ * the value at the block's start. Unchanged values of constant blocks are
+ * not written again. A ramp per frame is available by
+ * ags_port_get_automation_ramp() until the next block.
+ *
+ * Returns: %TRUE if the value was written, otherwise %FALSE
+ *
+ * Since: 9.1.0
+ */
+gboolean
+ags_port_automate(AgsPort *port,
+		  gdouble x, gdouble x_end,
+		  guint buffer_length)
+{
+  AgsAutomationCursor *automation_cursor;
+
+  GValue value = {0,};
+
+  GType port_value_type;
+
+  guint revision;
+  gdouble current;
+  gboolean port_value_is_pointer;
+  gboolean success;
+  
+  GRecMutex *port_mutex;
+
+  if(!AGS_IS_PORT(port)){
+    return(FALSE);
+  }
+
+  /* get port mutex */
+  port_mutex = AGS_PORT_GET_OBJ_MUTEX(port);
+
+  revision = ags_atomic_uint_get(&(port->automation_revision));
+  
+  g_rec_mutex_lock(port_mutex);
+
+  automation_cursor = port->automation_cursor;
+
+  port_value_is_pointer = port->port_value_is_pointer;
+  port_value_type = port->port_value_type;
+  
+  if(automation_cursor->revision != revision){
+    ags_automation_cursor_update(automation_cursor,
+				 port->automation,
+				 revision,
+				 ((port_value_type == G_TYPE_FLOAT || port_value_type == G_TYPE_DOUBLE) ? TRUE: FALSE));
+  }
+
+  current = 0.0;
+  
+  success = FALSE;
+  
+  if(!port_value_is_pointer &&
+     ags_automation_cursor_fill(automation_cursor,
+				x, x_end,
+				buffer_length)){
+    current = automation_cursor->value;
+
+    /* the ramp is consumed in place of the port value, so convert it the same way */
+    if(automation_cursor->has_ramp &&
+       (AGS_PORT_CONVERT_ALWAYS & (port->flags)) != 0 &&
+       port->conversion != NULL){
+      guint i;
+      
+      for(i = 0; i < automation_cursor->ramp_length; i++){
+	automation_cursor->ramp[i] = (gfloat) ags_conversion_convert(port->conversion,
+								     (gdouble) automation_cursor->ramp[i],
+								     FALSE);
+      }
+    }
+
+    if(automation_cursor->has_ramp ||
+       !automation_cursor->has_written ||
+       automation_cursor->written_value != current){
+      automation_cursor->has_written = TRUE;
+      automation_cursor->written_value = current;
+
+      success = TRUE;
+    }
+  }
+
+  g_rec_mutex_unlock(port_mutex);
+
+  if(!success){
+    return(FALSE);
+  }
+
+  /* write */
+  if(port_value_type == G_TYPE_BOOLEAN){
+    g_value_init(&value,
+		 G_TYPE_BOOLEAN);
+    g_value_set_boolean(&value,
+			((current != 0.0) ? TRUE: FALSE));
+  }else if(port_value_type == G_TYPE_INT64){
+    g_value_init(&value,
+		 G_TYPE_INT64);
+    g_value_set_int64(&value,
+		      (gint64) floor(current));
+  }else if(port_value_type == G_TYPE_UINT64){
+    g_value_init(&value,
+		 G_TYPE_UINT64);
+    g_value_set_uint64(&value,
+		       (guint64) floor(current));
+  }else if(port_value_type == G_TYPE_FLOAT){
+    g_value_init(&value,
+		 G_TYPE_FLOAT);
+    g_value_set_float(&value,
+		      (gfloat) current);
+  }else if(port_value_type == G_TYPE_DOUBLE){
+    g_value_init(&value,
+		 G_TYPE_DOUBLE);
+    g_value_set_double(&value,
+		       current);
+  }else{
+    return(FALSE);
+  }
+
+  ags_port_safe_write(port,
+		      &value);
+
+  g_value_unset(&value);
+
+  return(TRUE);
+}
+
+/**
+ * ags_port_get_automation_ramp:
+ * @port: the #AgsPort
+ * @ramp_length: (out) (optional): return location of the ramp length
+ *
+ * Get the automation value per frame of the current block computed by
+ * ags_port_automate(), converted like the port value. Fx consume it in
+ * place of the port value to avoid zipper noise.
+ *
+ * The returned buffer is the internal buffer of the port's #AgsAutomationCursor,
+ * it is overwritten by the next call to ags_port_automate(). Use it only on the
+ * thread calling ags_port_automate() and before the next block, copy it otherwise.
+ *
+ * Returns: (transfer none): the cursor's internal ramp or %NULL if the block is constant
+ *
+ * Since: 9.1.0
+ */
+gfloat*
+ags_port_get_automation_ramp(AgsPort *port,
+			     guint *ramp_length)
+{
+  gfloat *ramp;
+
+  GRecMutex *port_mutex;
+
+  if(!AGS_IS_PORT(port)){
+    if(ramp_length != NULL){
+      ramp_length[0] = 0;
+    }
+    
+    return(NULL);
+  }
+
+  /* get port mutex */
+  port_mutex = AGS_PORT_GET_OBJ_MUTEX(port);
+
+  g_rec_mutex_lock(port_mutex);
+
+  ramp = ags_automation_cursor_get_ramp(port->automation_cursor,
+					ramp_length);
+
+  g_rec_mutex_unlock(port_mutex);
+
+  return(ramp);
+}
+
 /**
  * ags_port_new:
  *
@@ -27,6 +27,8 @@
 
 #include <ags/libags.h>
 
+#include <ags/audio/ags_automation_cursor.h>
+
 G_BEGIN_DECLS
 
 #define AGS_TYPE_PORT                (ags_port_get_type())
@@ -94,6 +96,9 @@ struct _AgsPort
   AgsConversion *conversion;
 
   GList *automation;
+
+  volatile guint automation_revision;
+  AgsAutomationCursor *automation_cursor;
   
   union _AgsPortValue{
     gboolean ags_port_boolean;
@@ -157,6 +162,15 @@ void ags_port_add_automation(AgsPort *port,
 void ags_port_remove_automation(AgsPort *port,
 				GObject *automation);
 
+guint ags_port_get_automation_revision(AgsPort *port);
+void ags_port_increment_automation_revision(AgsPort *port);
+
+gboolean ags_port_automate(AgsPort *port,
+			   gdouble x, gdouble x_end,
+			   guint buffer_length);
+gfloat* ags_port_get_automation_ramp(AgsPort *port,
+				     guint *ramp_length);
+
 AgsPort* ags_port_new();
 
 G_END_DECLS
@@ -82,6 +82,8 @@ enum{
 
 static gpointer ags_program_parent_class = NULL;
 
+static volatile guint ags_program_global_modified_stamp = 0;
+
 GType
 ags_program_get_type()
 {
@@ -469,6 +471,41 @@ ags_program_finalize(GObject *gobject)
   G_OBJECT_CLASS(ags_program_parent_class)->finalize(gobject);
 }
 
+/**
+ * ags_program_global_get_modified_stamp:
+ * 
+ * Get the global modified stamp. It is incremented every time the
+ * #AgsMarker list of any #AgsProgram or a marker's position or value
+ * is modified.
+ *
+ * Returns: the modified stamp
+ * 
+ * Since: 9.1.0
+ */
+guint
+ags_program_global_get_modified_stamp()
+{
+  guint modified_stamp;
+
+  modified_stamp = ags_atomic_uint_get(&ags_program_global_modified_stamp);
+  
+  return(modified_stamp);
+}
+
+/**
+ * ags_program_global_increment_modified_stamp:
+ * 
+ * Increment the global modified stamp, invalidating compiled
+ * representations of #AgsProgram like #AgsTempoMap.
+ * 
+ * Since: 9.1.0
+ */
+void
+ags_program_global_increment_modified_stamp()
+{
+  ags_atomic_uint_increment(&ags_program_global_modified_stamp);
+}
+
 /**
  * ags_program_get_obj_mutex:
  * @program: the #AgsProgram
@@ -1273,6 +1310,8 @@ ags_program_set_marker(AgsProgram *program, GList *marker)
   
   g_rec_mutex_unlock(program_mutex);
 
+  ags_program_global_increment_modified_stamp();
+
   g_list_free_full(start_marker,
 		   (GDestroyNotify) g_object_unref);
 }
@@ -1505,6 +1544,10 @@ ags_program_add_marker(AgsProgram *program,
   }
   
   g_rec_mutex_unlock(program_mutex);
+
+  if(!use_selection_list){
+    ags_program_global_increment_modified_stamp();
+  }
 }
 
 /**
@@ -1552,6 +1595,10 @@ ags_program_remove_marker(AgsProgram *program,
   }
 
   g_rec_mutex_unlock(program_mutex);
+
+  if(!use_selection_list){
+    ags_program_global_increment_modified_stamp();
+  }
 }
 
 /**
@@ -1628,6 +1675,8 @@ ags_program_remove_marker_at_position(AgsProgram *program,
     g_object_unref(marker);
   
     g_rec_mutex_unlock(program_mutex);
+
+    ags_program_global_increment_modified_stamp();
   }
 
   g_list_free_full(start_list,
@@ -2487,6 +2536,8 @@ ags_program_cut_selection(AgsProgram *program)
 
   g_rec_mutex_unlock(program_mutex);
 
+  ags_program_global_increment_modified_stamp();
+
   /* free selection */
   ags_program_free_selection(program);
 
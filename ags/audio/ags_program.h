@@ -100,6 +100,9 @@ struct _AgsProgramClass
 GType ags_program_get_type(void);
 GType ags_program_flags_get_type(void);
 
+guint ags_program_global_get_modified_stamp();
+void ags_program_global_increment_modified_stamp();
+
 GRecMutex* ags_program_get_obj_mutex(AgsProgram *program);
 
 gboolean ags_program_test_flags(AgsProgram *program, AgsProgramFlags flags);
@@ -40,6 +40,7 @@
 #include <ags/audio/ags_recall_channel_run.h>
 #include <ags/audio/ags_recall_recycling.h>
 #include <ags/audio/ags_recall_audio_signal.h>
+#include <ags/audio/ags_recall_profiler.h>
 
 #include <ags/audio/task/ags_reset_recall_staging.h>
 
@@ -108,6 +109,8 @@ void ags_recall_real_midi2_control_change(AgsRecall *recall);
 
 void ags_recall_real_jack_metadata(AgsRecall *recall);
 
+void ags_recall_real_update_rt_view(AgsRecall *recall);
+
 AgsRecall* ags_recall_real_duplicate(AgsRecall *reall,
 				     AgsRecallID *recall_id,
 				     guint *n_params, gchar **parameter_name, GValue *value);
@@ -770,6 +773,8 @@ ags_recall_class_init(AgsRecallClass *recall)
 
   recall->midi2_control_change = ags_recall_real_midi2_control_change;
 
+  recall->update_rt_view = ags_recall_real_update_rt_view;
+
   /* signals */
   /**
    * AgsRecall::resolve-dependency:
@@ -1281,6 +1286,12 @@ ags_recall_init(AgsRecall *recall)
 
   recall->jack_metadata_to_value = NULL;
   recall->jack_metadata_to_port_specifier = NULL;
+
+  /* rt view */
+  memset(&(recall->rt_view), 0, sizeof(AgsRecallRtView));
+
+  /* profiler */
+  recall->profiler_entry = NULL;
 }
 
 void
@@ -1713,6 +1724,8 @@ ags_recall_set_property(GObject *gobject,
     G_OBJECT_WARN_INVALID_PROPERTY_ID(gobject, prop_id, param_spec);
     break;
   }
+
+  ags_recall_update_rt_view(recall);
 }
 
 void
@@ -2017,6 +2030,9 @@ ags_recall_dispose(GObject *gobject)
 
   ags_reset_recall_staging_remove(ags_reset_recall_staging_get_instance(),
 				  recall);  
+
+  /* rt view */
+  memset(&(recall->rt_view), 0, sizeof(AgsRecallRtView));
   
   /* recall container */
   if(recall->recall_container != NULL){
@@ -3598,8 +3614,10 @@ ags_recall_set_staging_flags(AgsRecall *recall, AgsSoundStagingFlags staging_fla
 
   GList *list_start, *list, *next;
   
+  gint64 start_time;
   gboolean omit_event;
   gboolean children_lock_free;  
+  gboolean do_profile;
 
   GRecMutex *recall_mutex;
 
@@ -3614,6 +3632,11 @@ ags_recall_set_staging_flags(AgsRecall *recall, AgsSoundStagingFlags staging_fla
 
   omit_event = ags_recall_global_get_omit_event();
 
+  /* time run stages of either path, the audio tree dispatcher stages through here, too */
+  do_profile = AGS_RECALL_PROFILER_IS_ENABLED();
+
+  start_time = 0;
+  
   /* get staging flags */
   g_rec_mutex_lock(recall_mutex);
 
@@ -3639,6 +3662,8 @@ ags_recall_set_staging_flags(AgsRecall *recall, AgsSoundStagingFlags staging_fla
      (AGS_SOUND_STATE_IS_TERMINATING & (recall_state_flags)) == 0){
     if((AGS_SOUND_STAGING_CHECK_RT_DATA & (staging_flags)) != 0 &&
        (AGS_SOUND_STAGING_CHECK_RT_DATA & (recall_staging_flags)) == 0){    
+      ags_recall_update_rt_view(recall);
+      
       if(omit_event){
 	AGS_RECALL_GET_CLASS(recall)->check_rt_data(recall);
       }else{
@@ -3648,6 +3673,8 @@ ags_recall_set_staging_flags(AgsRecall *recall, AgsSoundStagingFlags staging_fla
 
     if((AGS_SOUND_STAGING_RUN_INIT_PRE & (staging_flags)) != 0 &&
        (AGS_SOUND_STAGING_RUN_INIT_PRE & (recall_staging_flags)) == 0){
+      ags_recall_update_rt_view(recall);
+      
       if(omit_event){
 	AGS_RECALL_GET_CLASS(recall)->run_init_pre(recall);
       }else{
@@ -3693,29 +3720,59 @@ ags_recall_set_staging_flags(AgsRecall *recall, AgsSoundStagingFlags staging_fla
 
     if((AGS_SOUND_STAGING_RUN_PRE & (staging_flags)) != 0 &&
        (AGS_SOUND_STAGING_RUN_PRE & (recall_staging_flags)) == 0){
+      if(do_profile){
+	start_time = ags_recall_profiler_get_time();
+      }
+      
       if(omit_event){
 	AGS_RECALL_GET_CLASS(recall)->run_pre(recall);
       }else{
 	ags_recall_run_pre(recall);
       }
+
+      if(do_profile){
+	ags_recall_profiler_add(ags_recall_profiler_get_instance(),
+				recall,
+				ags_recall_profiler_get_time() - start_time);
+      }
     }
 
     if((AGS_SOUND_STAGING_RUN_INTER & (staging_flags)) != 0 &&
        (AGS_SOUND_STAGING_RUN_INTER & (recall_staging_flags)) == 0){
+      if(do_profile){
+	start_time = ags_recall_profiler_get_time();
+      }
+      
       if(omit_event){
 	AGS_RECALL_GET_CLASS(recall)->run_inter(recall);
       }else{
 	ags_recall_run_inter(recall);
       }
+
+      if(do_profile){
+	ags_recall_profiler_add(ags_recall_profiler_get_instance(),
+				recall,
+				ags_recall_profiler_get_time() - start_time);
+      }
     }
 
     if((AGS_SOUND_STAGING_RUN_POST & (staging_flags)) != 0 &&
        (AGS_SOUND_STAGING_RUN_POST & (recall_staging_flags)) == 0){
+      if(do_profile){
+	start_time = ags_recall_profiler_get_time();
+      }
+      
       if(omit_event){
 	AGS_RECALL_GET_CLASS(recall)->run_post(recall);
       }else{
 	ags_recall_run_post(recall);
       }
+
+      if(do_profile){
+	ags_recall_profiler_add(ags_recall_profiler_get_instance(),
+				recall,
+				ags_recall_profiler_get_time() - start_time);
+      }
     }
 
     if((AGS_SOUND_STAGING_DO_FEEDBACK & (staging_flags)) != 0 &&
@@ -4412,6 +4469,8 @@ ags_recall_set_recall_id(AgsRecall *recall,
   g_object_ref(recall_id);
   
   g_rec_mutex_unlock(recall_mutex);
+
+  ags_recall_update_rt_view(recall);
 }
 
 /**
@@ -4941,6 +5000,8 @@ ags_recall_remove_child(AgsRecall *recall, AgsRecall *child)
   /* unref recall */
   child->parent = NULL;
 
+  ags_recall_update_rt_view(child);
+
   g_object_unref(recall);
 }
 
@@ -5287,6 +5348,8 @@ ags_recall_set_samplerate(AgsRecall *recall, guint samplerate)
   recall->samplerate = samplerate;
   
   g_rec_mutex_unlock(recall_mutex);
+
+  ags_recall_update_rt_view(recall);
 }
 
 /**
@@ -5342,6 +5405,8 @@ ags_recall_set_buffer_size(AgsRecall *recall, guint buffer_size)
   recall->buffer_size = buffer_size;
   
   g_rec_mutex_unlock(recall_mutex);
+
+  ags_recall_update_rt_view(recall);
 }
 
 /**
@@ -5397,6 +5462,114 @@ ags_recall_set_format(AgsRecall *recall, AgsSoundcardFormat format)
   recall->format = format;
   
   g_rec_mutex_unlock(recall_mutex);
+
+  ags_recall_update_rt_view(recall);
+}
+
+void
+ags_recall_real_update_rt_view(AgsRecall *recall)
+{
+  AgsRecallRtView *rt_view;
+  AgsRecyclingContext *recycling_context, *parent_recycling_context;
+
+  GRecMutex *recall_mutex;
+  GRecMutex *recall_id_mutex;
+  GRecMutex *recycling_context_mutex;
+
+  /* get recall mutex */
+  recall_mutex = AGS_RECALL_GET_OBJ_MUTEX(recall);
+
+  rt_view = AGS_RECALL_RT_VIEW(recall);
+  
+  /* update */
+  g_rec_mutex_lock(recall_mutex);
+
+  rt_view->recall_id = recall->recall_id;
+
+  rt_view->parent = recall->parent;
+
+  rt_view->output_soundcard = recall->output_soundcard;
+  rt_view->output_soundcard_channel = recall->output_soundcard_channel;
+
+  rt_view->input_soundcard = recall->input_soundcard;
+  rt_view->input_soundcard_channel = recall->input_soundcard_channel;
+
+  rt_view->samplerate = recall->samplerate;
+  rt_view->buffer_size = recall->buffer_size;
+  rt_view->format = recall->format;
+
+  rt_view->pad = recall->pad;
+  rt_view->audio_channel = recall->audio_channel;
+  rt_view->line = recall->line;
+
+  /* recycling context */
+  recycling_context = NULL;
+  parent_recycling_context = NULL;
+  
+  if(recall->recall_id != NULL){
+    recall_id_mutex = AGS_RECALL_ID_GET_OBJ_MUTEX(recall->recall_id);
+
+    g_rec_mutex_lock(recall_id_mutex);
+
+    recycling_context = recall->recall_id->recycling_context;
+
+    g_rec_mutex_unlock(recall_id_mutex);
+  }
+
+  if(recycling_context != NULL){
+    recycling_context_mutex = AGS_RECYCLING_CONTEXT_GET_OBJ_MUTEX(recycling_context);
+
+    g_rec_mutex_lock(recycling_context_mutex);
+
+    parent_recycling_context = recycling_context->parent;
+
+    g_rec_mutex_unlock(recycling_context_mutex);
+  }
+
+  rt_view->recycling_context = recycling_context;
+  rt_view->parent_recycling_context = parent_recycling_context;
+  
+  g_rec_mutex_unlock(recall_mutex);
+}
+
+/**
+ * ags_recall_get_rt_view:
+ * @recall: the #AgsRecall
+ *
+ * Get the rt view of @recall. The returned struct is owned by @recall and
+ * its fields are meant to be read by the staging functions without taking
+ * a reference or locking the recall.
+ * 
+ * Returns: (transfer none): the #AgsRecallRtView-struct
+ * 
+ * Since: 9.1.0
+ */
+AgsRecallRtView*
+ags_recall_get_rt_view(AgsRecall *recall)
+{
+  if(!AGS_IS_RECALL(recall)){
+    return(NULL);
+  }
+
+  return(AGS_RECALL_RT_VIEW(recall));
+}
+
+/**
+ * ags_recall_update_rt_view:
+ * @recall: the #AgsRecall
+ *
+ * Update the rt view of @recall from its properties.
+ * 
+ * Since: 9.1.0
+ */
+void
+ags_recall_update_rt_view(AgsRecall *recall)
+{
+  g_return_if_fail(AGS_IS_RECALL(recall));
+
+  if(AGS_RECALL_GET_CLASS(recall)->update_rt_view != NULL){
+    AGS_RECALL_GET_CLASS(recall)->update_rt_view(recall);
+  }
 }
 
 /**
@@ -5844,8 +6017,10 @@ ags_recall_run_pre(AgsRecall *recall)
   g_return_if_fail(!ags_recall_test_state_flags(recall, AGS_SOUND_STATE_IS_TERMINATING));
 
   g_object_ref(G_OBJECT(recall));
+
   g_signal_emit(G_OBJECT(recall),
 		recall_signals[PLAY_RUN_PRE], 0);
+  
   g_object_unref(G_OBJECT(recall));
 }
 
@@ -5888,8 +6063,10 @@ ags_recall_run_inter(AgsRecall *recall)
   g_return_if_fail(!ags_recall_test_state_flags(recall, AGS_SOUND_STATE_IS_TERMINATING));
 
   g_object_ref(G_OBJECT(recall));
+
   g_signal_emit(G_OBJECT(recall),
 		recall_signals[PLAY_RUN_INTER], 0);
+  
   g_object_unref(G_OBJECT(recall));
 }
 
@@ -5934,8 +6111,10 @@ ags_recall_run_post(AgsRecall *recall)
   g_return_if_fail(!ags_recall_test_state_flags(recall, AGS_SOUND_STATE_IS_TERMINATING));
 
   g_object_ref(G_OBJECT(recall));
+
   g_signal_emit(G_OBJECT(recall),
 		recall_signals[PLAY_RUN_POST], 0);
+  
   g_object_unref(G_OBJECT(recall));
 }
 
@@ -9414,11 +9593,20 @@ ags_recall_child_done(AgsRecall *child,
 
   //NOTE:JK: only unref
   if(TRUE){
+    AgsEpochReclaimer *epoch_reclaimer;
     AgsDestroyWorker *destroy_worker;
-    
-    destroy_worker = ags_destroy_worker_get_instance();
-    ags_destroy_worker_add(destroy_worker,
-			   child, (AgsDestroyFunc) g_object_unref); // ags_destroy_util_dispose_and_unref
+
+    epoch_reclaimer = ags_epoch_reclaimer_get_instance();
+
+    /* other threads might still iterate the removed child */
+    if(ags_worker_thread_test_status_flags((AgsWorkerThread *) epoch_reclaimer, AGS_WORKER_THREAD_STATUS_RUNNING)){
+      ags_epoch_reclaimer_retire(epoch_reclaimer,
+				 child, (AgsDestroyFunc) g_object_unref);
+    }else{
+      destroy_worker = ags_destroy_worker_get_instance();
+      ags_destroy_worker_add(destroy_worker,
+			     child, (AgsDestroyFunc) g_object_unref); // ags_destroy_util_dispose_and_unref
+    }
   }else{
     //    g_object_run_dispose((GObject *) child);
     g_object_unref((GObject *) child);
@@ -48,6 +48,8 @@ G_BEGIN_DECLS
 
 #define AGS_RECALL_GET_OBJ_MUTEX(obj) (&(((AgsRecall *) obj)->obj_mutex))
 
+#define AGS_RECALL_RT_VIEW(obj) (&(((AgsRecall *) obj)->rt_view))
+
 #define AGS_RECALL_MIDI1_CONTROL_CHANGE(midi1_opcode, midi1_cc) ((midi1_opcode << 8) | (midi1_cc))
 #define AGS_RECALL_MIDI2_CONTROL_CHANGE(midi2_opcode, midi1_opcode, midi2_per_note_controller, midi2_cc) ((AgsUmpWord)((midi2_opcode << 24) | (midi1_opcode << 16) | (midi2_per_note_controller << 8) | (midi2_cc)))
 
@@ -140,6 +142,7 @@ G_BEGIN_DECLS
 typedef struct _AgsRecall AgsRecall;
 typedef struct _AgsRecallClass AgsRecallClass;
 typedef struct _AgsRecallHandler AgsRecallHandler;
+typedef struct _AgsRecallRtView AgsRecallRtView;
 
 /**
  * AgsRecallFlags:
@@ -364,6 +367,67 @@ typedef enum{
   AGS_RECALL_MIDI2_EFFECTS_5                           = AGS_RECALL_MIDI2_CONTROL_CHANGE(0x40, 0xb0, 0x0, 95),
 }AgsRecallMidi2ControlChange;
 
+/**
+ * AgsRecallRtView:
+ * @recall_id: the #AgsRecallID
+ * @recycling_context: the #AgsRecyclingContext of @recall_id
+ * @parent_recycling_context: the parent #AgsRecyclingContext of @recycling_context
+ * @parent: the parent #AgsRecall
+ * @output_soundcard: the output soundcard
+ * @output_soundcard_channel: the output soundcard channel
+ * @input_soundcard: the input soundcard
+ * @input_soundcard_channel: the input soundcard channel
+ * @samplerate: the samplerate
+ * @buffer_size: the buffer size
+ * @format: the format
+ * @pad: the pad
+ * @audio_channel: the audio channel
+ * @line: the line
+ * @audio: the #AgsAudio of #AgsRecallAudio or #AgsRecallAudioRun
+ * @recall_audio: the #AgsRecallAudio
+ * @recall_audio_run: the #AgsRecallAudioRun
+ * @recall_channel: the #AgsRecallChannel
+ * @source: the source #AgsChannel, #AgsRecycling or #AgsAudioSignal
+ * @destination: the destination #AgsChannel, #AgsRecycling or #AgsAudioSignal
+ *
+ * The plain fields of #AgsRecall and its subclasses read by the staging
+ * functions on the audio thread. The fields are updated while holding the
+ * recall's mutex, whenever a property changes or the recall is staged to
+ * check rt data or run init pre. They don't hold a reference, the recall
+ * does.
+ */
+struct _AgsRecallRtView
+{
+  AgsRecallID *recall_id;
+  AgsRecyclingContext *recycling_context;
+  AgsRecyclingContext *parent_recycling_context;
+
+  AgsRecall *parent;
+
+  GObject *output_soundcard;
+  gint output_soundcard_channel;
+  
+  GObject *input_soundcard;
+  gint input_soundcard_channel;
+
+  guint samplerate;
+  guint buffer_size;
+  AgsSoundcardFormat format;
+
+  guint pad;
+  guint audio_channel;
+  guint line;
+
+  GObject *audio;
+
+  AgsRecall *recall_audio;
+  AgsRecall *recall_audio_run;
+  AgsRecall *recall_channel;
+
+  GObject *source;
+  GObject *destination;
+};
+
 struct _AgsRecall
 {
   GObject gobject;
@@ -439,6 +503,10 @@ struct _AgsRecall
 
   GHashTable *jack_metadata_to_value;
   GHashTable *jack_metadata_to_port_specifier;
+
+  AgsRecallRtView rt_view;
+
+  gpointer profiler_entry;
 };
 
 struct _AgsRecallClass
@@ -479,6 +547,8 @@ struct _AgsRecallClass
   void (*midi2_control_change)(AgsRecall *recall);
 
   void (*jack_metadata)(AgsRecall *recall);
+
+  void (*update_rt_view)(AgsRecall *recall);
 };
 
 /**
@@ -622,6 +692,10 @@ void ags_recall_set_buffer_size(AgsRecall *recall, guint buffer_size);
 AgsSoundcardFormat ags_recall_get_format(AgsRecall *recall);
 void ags_recall_set_format(AgsRecall *recall, AgsSoundcardFormat format);
 
+/* rt view */
+AgsRecallRtView* ags_recall_get_rt_view(AgsRecall *recall);
+void ags_recall_update_rt_view(AgsRecall *recall);
+
 /* MIDI version 1.0 control change */
 GHashTable* ags_recall_get_midi1_cc_to_value(AgsRecall *recall);
 GHashTable* ags_recall_get_midi1_cc_to_port_specifier(AgsRecall *recall);
@@ -40,6 +40,8 @@ void ags_recall_audio_get_property(GObject *gobject,
 void ags_recall_audio_dispose(GObject *gobject);
 void ags_recall_audio_finalize(GObject *gobject);
 
+void ags_recall_audio_update_rt_view(AgsRecall *recall);
+
 void ags_recall_audio_automate(AgsRecall *recall);
 AgsRecall* ags_recall_audio_duplicate(AgsRecall *recall,
 				      AgsRecallID *recall_id,
@@ -145,6 +147,8 @@ ags_recall_audio_class_init(AgsRecallAudioClass *recall_audio)
   recall->automate = ags_recall_audio_automate;
 
   recall->duplicate = ags_recall_audio_duplicate;
+
+  recall->update_rt_view = ags_recall_audio_update_rt_view;
 }
 
 void
@@ -208,6 +212,8 @@ ags_recall_audio_set_property(GObject *gobject,
     G_OBJECT_WARN_INVALID_PROPERTY_ID(gobject, prop_id, param_spec);
     break;
   }
+
+  ags_recall_update_rt_view((AgsRecall *) gobject);
 }
 
 void
@@ -241,6 +247,32 @@ ags_recall_audio_get_property(GObject *gobject,
   }
 }
 
+void
+ags_recall_audio_update_rt_view(AgsRecall *recall)
+{
+  AgsRecallAudio *recall_audio;
+  AgsRecallRtView *rt_view;
+
+  GRecMutex *recall_mutex;
+
+  recall_audio = (AgsRecallAudio *) recall;
+
+  /* get recall mutex */
+  recall_mutex = AGS_RECALL_GET_OBJ_MUTEX(recall);
+
+  rt_view = AGS_RECALL_RT_VIEW(recall);
+
+  /* update */
+  g_rec_mutex_lock(recall_mutex);
+
+  rt_view->audio = (GObject *) recall_audio->audio;
+
+  g_rec_mutex_unlock(recall_mutex);
+
+  /* call parent */
+  AGS_RECALL_CLASS(ags_recall_audio_parent_class)->update_rt_view(recall);
+}
+
 void
 ags_recall_audio_dispose(GObject *gobject)
 {
@@ -294,18 +326,13 @@ ags_recall_audio_automate(AgsRecall *recall)
   
   GObject *soundcard;
 
-  GList *automation_start, *automation;
   GList *port_start, *port;
 
   gdouble delay, delay_counter;
   guint64 note_offset;
   
-  guint64 loop_left, loop_right;
-  gboolean do_loop;
-
-  double x, step;
-  guint ret_x;
-  gboolean return_prev_on_failure;
+  double x, x_end, step;
+  guint buffer_size;
 
   GRecMutex *audio_mutex;
 
@@ -351,18 +378,13 @@ ags_recall_audio_automate(AgsRecall *recall)
   delay = (gdouble) frame_clock->absolute_delay;
   delay_counter = (gdouble) frame_clock->delay_counter;
 
-  /* retrieve loop information */
-  do_loop = ags_frame_clock_get_loop(frame_clock,
-				     &loop_left, &loop_right);
-
-  return_prev_on_failure = TRUE;
-
-  if(do_loop &&
-     loop_left <= note_offset){
-    if(note_offset == loop_left){
-      return_prev_on_failure = TRUE;
-    }
-  }
+  buffer_size = AGS_SOUNDCARD_DEFAULT_BUFFER_SIZE;
+  
+  ags_soundcard_get_presets(AGS_SOUNDCARD(soundcard),
+			    NULL,
+			    NULL,
+			    &buffer_size,
+			    NULL);
 
   /* apply automation */
   port = port_start;
@@ -370,6 +392,9 @@ ags_recall_audio_automate(AgsRecall *recall)
   x = ((double) note_offset + (delay_counter / delay)) * ((1.0 / AGS_AUTOMATION_MINIMUM_ACCELERATION_LENGTH) * AGS_NOTATION_MINIMUM_NOTE_LENGTH);
   step = ((1.0 / AGS_AUTOMATION_MINIMUM_ACCELERATION_LENGTH) * AGS_NOTATION_MINIMUM_NOTE_LENGTH);
 
+  /* the block advances by one tic's fraction of a step */
+  x_end = x + (step / delay);
+
   while(port != NULL){
     gchar *specifier;
 
@@ -394,64 +419,10 @@ ags_recall_audio_automate(AgsRecall *recall)
       continue;
     }
 
-    g_object_get(AGS_PORT(port->data),
-		 "automation", &automation_start,
-		 NULL);
-
-    /* find offset */
-    automation = automation_start;
-
-    while(automation != NULL){
-      AgsAutomation *current_automation;
-
-      AgsTimestamp *timestamp;
-      
-      current_automation = automation->data;
-
-      /* get some fields */
-      g_object_get(current_automation,
-		   "timestamp", &timestamp,
-		   NULL);
-      
-      if(ags_timestamp_get_ags_offset(timestamp) + AGS_AUTOMATION_DEFAULT_OFFSET < x){
-	automation = automation->next;
-
-	g_object_unref(timestamp);
-	
-	continue;
-      }
-      
-      if(!ags_automation_test_flags(current_automation, AGS_AUTOMATION_BYPASS)){
-	GValue value = {0,};
-	
-	ret_x = ags_automation_get_value(current_automation,
-					 floor(x), ceil(x + step),
-					 return_prev_on_failure,
-					 &value);
-
-	if(ret_x != G_MAXUINT){
-//	  g_message("automate -> %f", g_value_get_float(&value));
-	  
-	  ags_port_safe_write(port->data,
-			      &value);
-	}
-      }
-
-      if(ags_timestamp_get_ags_offset(timestamp) > ceil(x + step)){
-	g_object_unref(timestamp);
-
-	break;
-      }
-
-      /* unref */
-      g_object_unref(timestamp);
-
-      /* iterate */
-      automation = automation->next;
-    }
-
-    g_list_free_full(automation_start,
-		     g_object_unref);
+    /* advance the port's cursor */
+    ags_port_automate(port->data,
+		      x, x_end,
+		      buffer_size);
     
     /* iterate */
     port = port->next;
@@ -41,6 +41,8 @@ void ags_recall_audio_run_get_property(GObject *gobject,
 void ags_recall_audio_run_dispose(GObject *gobject);
 void ags_recall_audio_run_finalize(GObject *gobject);
 
+void ags_recall_audio_run_update_rt_view(AgsRecall *recall);
+
 void ags_recall_audio_run_notify_recall_container_callback(GObject *gobject,
 							   GParamSpec *pspec,
 							   gpointer user_data);
@@ -164,6 +166,8 @@ ags_recall_audio_run_class_init(AgsRecallAudioRunClass *recall_audio_run)
   recall = (AgsRecallClass *) recall_audio_run;
 
   recall->duplicate = ags_recall_audio_run_duplicate;
+
+  recall->update_rt_view = ags_recall_audio_run_update_rt_view;
 }
 
 void
@@ -256,6 +260,8 @@ ags_recall_audio_run_set_property(GObject *gobject,
     G_OBJECT_WARN_INVALID_PROPERTY_ID(gobject, prop_id, param_spec);
     break;
   };
+
+  ags_recall_update_rt_view((AgsRecall *) gobject);
 }
 
 void
@@ -298,6 +304,33 @@ ags_recall_audio_run_get_property(GObject *gobject,
   };
 }
 
+void
+ags_recall_audio_run_update_rt_view(AgsRecall *recall)
+{
+  AgsRecallAudioRun *recall_audio_run;
+  AgsRecallRtView *rt_view;
+
+  GRecMutex *recall_mutex;
+
+  recall_audio_run = (AgsRecallAudioRun *) recall;
+
+  /* get recall mutex */
+  recall_mutex = AGS_RECALL_GET_OBJ_MUTEX(recall);
+
+  rt_view = AGS_RECALL_RT_VIEW(recall);
+
+  /* update */
+  g_rec_mutex_lock(recall_mutex);
+
+  rt_view->audio = (GObject *) recall_audio_run->audio;
+  rt_view->recall_audio = (AgsRecall *) recall_audio_run->recall_audio;
+
+  g_rec_mutex_unlock(recall_mutex);
+
+  /* call parent */
+  AGS_RECALL_CLASS(ags_recall_audio_run_parent_class)->update_rt_view(recall);
+}
+
 void
 ags_recall_audio_run_dispose(GObject *gobject)
 {
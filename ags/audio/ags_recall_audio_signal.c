@@ -37,6 +37,8 @@ void ags_recall_audio_signal_get_property(GObject *gobject,
 void ags_recall_audio_signal_dispose(GObject *gobject);
 void ags_recall_audio_signal_finalize(GObject *gobject);
 
+void ags_recall_audio_signal_update_rt_view(AgsRecall *recall);
+
 /**
  * SECTION:ags_recall_audio_signal
  * @Short_description: The recall base class of dynamic audio signal context
@@ -147,6 +149,11 @@ ags_recall_audio_signal_class_init(AgsRecallAudioSignalClass *recall_audio_signa
   g_object_class_install_property(gobject,
 				  PROP_SOURCE,
 				  param_spec);
+
+  /* AgsRecallClass */
+  recall = (AgsRecallClass *) recall_audio_signal;
+
+  recall->update_rt_view = ags_recall_audio_signal_update_rt_view;
 }
 
 void
@@ -236,6 +243,8 @@ ags_recall_audio_signal_set_property(GObject *gobject,
     G_OBJECT_WARN_INVALID_PROPERTY_ID(gobject, prop_id, param_spec);
     break;
   }
+
+  ags_recall_update_rt_view((AgsRecall *) gobject);
 }
 
 void
@@ -278,6 +287,33 @@ ags_recall_audio_signal_get_property(GObject *gobject,
   }
 }
 
+void
+ags_recall_audio_signal_update_rt_view(AgsRecall *recall)
+{
+  AgsRecallAudioSignal *recall_audio_signal;
+  AgsRecallRtView *rt_view;
+
+  GRecMutex *recall_mutex;
+
+  recall_audio_signal = (AgsRecallAudioSignal *) recall;
+
+  /* get recall mutex */
+  recall_mutex = AGS_RECALL_GET_OBJ_MUTEX(recall);
+
+  rt_view = AGS_RECALL_RT_VIEW(recall);
+
+  /* update */
+  g_rec_mutex_lock(recall_mutex);
+
+  rt_view->source = (GObject *) recall_audio_signal->source;
+  rt_view->destination = (GObject *) recall_audio_signal->destination;
+
+  g_rec_mutex_unlock(recall_mutex);
+
+  /* call parent */
+  AGS_RECALL_CLASS(ags_recall_audio_signal_parent_class)->update_rt_view(recall);
+}
+
 void
 ags_recall_audio_signal_dispose(GObject *gobject)
 {
@@ -46,6 +46,8 @@ void ags_recall_channel_run_get_property(GObject *gobject,
 void ags_recall_channel_run_dispose(GObject *gobject);
 void ags_recall_channel_run_finalize(GObject *gobject);
 
+void ags_recall_channel_run_update_rt_view(AgsRecall *recall);
+
 void ags_recall_channel_run_notify_recall_container_callback(GObject *gobject,
 							     GParamSpec *pspec,
 							     gpointer user_data);
@@ -245,6 +247,8 @@ ags_recall_channel_run_class_init(AgsRecallChannelRunClass *recall_channel_run)
   recall = (AgsRecallClass *) recall_channel_run;
 
   recall->duplicate = ags_recall_channel_run_duplicate;
+
+  recall->update_rt_view = ags_recall_channel_run_update_rt_view;
 }
 
 void
@@ -445,6 +449,8 @@ ags_recall_channel_run_set_property(GObject *gobject,
     G_OBJECT_WARN_INVALID_PROPERTY_ID(gobject, prop_id, param_spec);
     break;
   };
+
+  ags_recall_update_rt_view((AgsRecall *) gobject);
 }
 
 void
@@ -514,6 +520,36 @@ ags_recall_channel_run_get_property(GObject *gobject,
   };
 }
 
+void
+ags_recall_channel_run_update_rt_view(AgsRecall *recall)
+{
+  AgsRecallChannelRun *recall_channel_run;
+  AgsRecallRtView *rt_view;
+
+  GRecMutex *recall_mutex;
+
+  recall_channel_run = (AgsRecallChannelRun *) recall;
+
+  /* get recall mutex */
+  recall_mutex = AGS_RECALL_GET_OBJ_MUTEX(recall);
+
+  rt_view = AGS_RECALL_RT_VIEW(recall);
+
+  /* update */
+  g_rec_mutex_lock(recall_mutex);
+
+  rt_view->recall_audio = (AgsRecall *) recall_channel_run->recall_audio;
+  rt_view->recall_audio_run = (AgsRecall *) recall_channel_run->recall_audio_run;
+  rt_view->recall_channel = (AgsRecall *) recall_channel_run->recall_channel;
+  rt_view->source = (GObject *) recall_channel_run->source;
+  rt_view->destination = (GObject *) recall_channel_run->destination;
+
+  g_rec_mutex_unlock(recall_mutex);
+
+  /* call parent */
+  AGS_RECALL_CLASS(ags_recall_channel_run_parent_class)->update_rt_view(recall);
+}
+
 void
 ags_recall_channel_run_dispose(GObject *gobject)
 {
@@ -0,0 +1,755 @@
+/* GSequencer - Advanced GTK Sequencer
+ * Copyright (C) 2005-2026 Joël Krähemann
+ *
+ * This file is part of GSequencer.
+ *
+ * GSequencer is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GSequencer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GSequencer.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <ags/audio/ags_recall_profiler.h>
+
+#include <ags/audio/ags_audio.h>
+#include <ags/audio/ags_channel.h>
+#include <ags/audio/ags_output.h>
+#include <ags/audio/ags_recall_audio.h>
+#include <ags/audio/ags_recall_audio_run.h>
+#include <ags/audio/ags_recall_channel.h>
+#include <ags/audio/ags_recall_channel_run.h>
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+void ags_recall_profiler_class_init(AgsRecallProfilerClass *recall_profiler);
+void ags_recall_profiler_init(AgsRecallProfiler *recall_profiler);
+void ags_recall_profiler_finalize(GObject *gobject);
+
+AgsRecallProfilerEntry* ags_recall_profiler_entry_alloc(guint window_size);
+void ags_recall_profiler_entry_free(AgsRecallProfilerEntry *entry);
+
+gint ags_recall_profiler_compare_time(gconstpointer a,
+				      gconstpointer b);
+
+/**
+ * SECTION:ags_recall_profiler
+ * @short_description: DSP load profiler of recalls
+ * @title: AgsRecallProfiler
+ * @section_id:
+ * @include: ags/audio/ags_recall_profiler.h
+ *
+ * The #AgsRecallProfiler measures the time spent by the run-pre, run-inter
+ * and run-post stages of ags_recall_set_staging_flags(), either emitting
+ * the signal or calling the class directly. The samples are
+ * aggregated per #AgsAudio, #AgsChannel and effect and collected per tic
+ * within a rolling window.
+ *
+ * The profiler is disabled by default, see ags_recall_profiler_set_enabled().
+ */
+
+static gpointer ags_recall_profiler_parent_class = NULL;
+
+static AgsRecallProfiler *ags_recall_profiler = NULL;
+
+volatile gboolean ags_recall_profiler_enabled = FALSE;
+
+GType
+ags_recall_profiler_get_type()
+{
+  static gsize g_define_type_id__static = 0;
+
+  if(g_once_init_enter(&g_define_type_id__static)){
+    GType ags_type_recall_profiler = 0;
+
+    static const GTypeInfo ags_recall_profiler_info = {
+      sizeof (AgsRecallProfilerClass),
+      NULL, /* base_init */
+      NULL, /* base_finalize */
+      (GClassInitFunc) ags_recall_profiler_class_init,
+      NULL, /* class_finalize */
+      NULL, /* class_data */
+      sizeof (AgsRecallProfiler),
+      0,    /* n_preallocs */
+      (GInstanceInitFunc) ags_recall_profiler_init,
+    };
+
+    ags_type_recall_profiler = g_type_register_static(G_TYPE_OBJECT,
+						      "AgsRecallProfiler",
+						      &ags_recall_profiler_info,
+						      0);
+
+    g_once_init_leave(&g_define_type_id__static, ags_type_recall_profiler);
+  }
+
+  return(g_define_type_id__static);
+}
+
+void
+ags_recall_profiler_class_init(AgsRecallProfilerClass *recall_profiler)
+{
+  GObjectClass *gobject;
+
+  ags_recall_profiler_parent_class = g_type_class_peek_parent(recall_profiler);
+
+  /* GObjectClass */
+  gobject = (GObjectClass *) recall_profiler;
+
+  gobject->finalize = ags_recall_profiler_finalize;
+}
+
+void
+ags_recall_profiler_init(AgsRecallProfiler *recall_profiler)
+{
+  g_rec_mutex_init(&(recall_profiler->obj_mutex));
+
+  recall_profiler->window_size = AGS_RECALL_PROFILER_DEFAULT_WINDOW_SIZE;
+
+  recall_profiler->deadline = 0;
+  recall_profiler->tic_count = 0;
+  
+  recall_profiler->entry = NULL;
+}
+
+void
+ags_recall_profiler_finalize(GObject *gobject)
+{
+  AgsRecallProfiler *recall_profiler;
+
+  recall_profiler = AGS_RECALL_PROFILER(gobject);
+
+  g_list_free_full(recall_profiler->entry,
+		   (GDestroyNotify) ags_recall_profiler_entry_free);
+
+  if(recall_profiler == ags_recall_profiler){
+    ags_recall_profiler = NULL;
+  }
+  
+  /* call parent */
+  G_OBJECT_CLASS(ags_recall_profiler_parent_class)->finalize(gobject);
+}
+
+AgsRecallProfilerEntry*
+ags_recall_profiler_entry_alloc(guint window_size)
+{
+  AgsRecallProfilerEntry *entry;
+
+  entry = (AgsRecallProfilerEntry *) g_malloc(sizeof(AgsRecallProfilerEntry));
+
+  entry->audio = NULL;
+  entry->channel = NULL;
+
+  entry->effect = NULL;
+  entry->audio_name = NULL;
+
+  entry->line = -1;
+  entry->is_output = FALSE;
+  
+  entry->current = 0;
+
+  entry->window_size = window_size;
+  entry->window = (gint64 *) g_malloc0(window_size * sizeof(gint64));
+
+  entry->window_offset = 0;
+  entry->sample_count = 0;
+
+  entry->max = 0;
+  
+  return(entry);
+}
+
+void
+ags_recall_profiler_entry_free(AgsRecallProfilerEntry *entry)
+{
+  if(entry == NULL){
+    return;
+  }
+
+  g_free(entry->effect);
+  g_free(entry->audio_name);
+
+  g_free(entry->window);
+  
+  g_free(entry);
+}
+
+gint
+ags_recall_profiler_compare_time(gconstpointer a,
+				 gconstpointer b)
+{
+  gint64 time_a, time_b;
+
+  time_a = *((gint64 *) a);
+  time_b = *((gint64 *) b);
+
+  if(time_a < time_b){
+    return(-1);
+  }else if(time_a > time_b){
+    return(1);
+  }
+
+  return(0);
+}
+
+/**
+ * ags_recall_profiler_get_time:
+ *
+ * Get monotonic time in nanoseconds.
+ *
+ * Returns: the current time in nanoseconds
+ *
+ * Since: 9.1.0
+ */
+gint64
+ags_recall_profiler_get_time()
+{
+  struct timespec time_now;
+
+  clock_gettime(CLOCK_MONOTONIC, &time_now);
+
+  return(((gint64) time_now.tv_sec * AGS_NSEC_PER_SEC) + (gint64) time_now.tv_nsec);
+}
+
+/**
+ * ags_recall_profiler_set_enabled:
+ * @enabled: %TRUE to enable, otherwise %FALSE
+ *
+ * Enable or disable profiling of recalls.
+ *
+ * Since: 9.1.0
+ */
+void
+ags_recall_profiler_set_enabled(gboolean enabled)
+{
+  if(enabled){
+    /* instantiate before any recall reads the flag */
+    ags_recall_profiler_get_instance();
+  }
+  
+  ags_atomic_boolean_set(&ags_recall_profiler_enabled,
+			 enabled);
+}
+
+/**
+ * ags_recall_profiler_is_enabled:
+ *
+ * Check if profiling of recalls is enabled.
+ *
+ * Returns: %TRUE if enabled, otherwise %FALSE
+ *
+ * Since: 9.1.0
+ */
+gboolean
+ags_recall_profiler_is_enabled()
+{
+  return(ags_atomic_boolean_get(&ags_recall_profiler_enabled));
+}
+
+/**
+ * ags_recall_profiler_find_entry:
+ * @recall_profiler: the #AgsRecallProfiler
+ * @recall: the #AgsRecall
+ *
+ * Find the entry @recall accounts to, the entry is created if not present
+ * yet. The parent recalls are resolved to the #AgsRecallAudio, #AgsRecallAudioRun,
+ * #AgsRecallChannel or #AgsRecallChannelRun providing audio and channel. The
+ * effect is the recall's effect or its type name.
+ *
+ * Returns: (transfer none): the #AgsRecallProfilerEntry
+ *
+ * Since: 9.1.0
+ */
+AgsRecallProfilerEntry*
+ags_recall_profiler_find_entry(AgsRecallProfiler *recall_profiler,
+			       AgsRecall *recall)
+{
+  AgsRecall *current;
+  AgsAudio *audio;
+  AgsChannel *channel;
+  AgsRecallProfilerEntry *entry;
+  
+  GList *list;
+
+  gchar *effect;
+
+  GRecMutex *recall_profiler_mutex;
+
+  g_return_val_if_fail(AGS_IS_RECALL_PROFILER(recall_profiler), NULL);
+  g_return_val_if_fail(AGS_IS_RECALL(recall), NULL);
+
+  /* resolve audio and channel */
+  audio = NULL;
+  channel = NULL;
+  
+  current = recall;
+
+  while(current != NULL){
+    if(AGS_IS_RECALL_AUDIO(current)){
+      audio = AGS_RECALL_AUDIO(current)->audio;
+
+      break;
+    }else if(AGS_IS_RECALL_AUDIO_RUN(current)){
+      audio = AGS_RECALL_AUDIO_RUN(current)->audio;
+
+      break;
+    }else if(AGS_IS_RECALL_CHANNEL(current)){
+      channel = AGS_RECALL_CHANNEL(current)->source;
+
+      break;
+    }else if(AGS_IS_RECALL_CHANNEL_RUN(current)){
+      channel = AGS_RECALL_CHANNEL_RUN(current)->source;
+
+      break;
+    }
+    
+    current = current->parent;
+  }
+
+  if(current == NULL){
+    current = recall;
+  }
+  
+  if(channel != NULL){
+    audio = (AgsAudio *) channel->audio;
+  }
+
+  effect = (current->effect != NULL) ? current->effect: (gchar *) G_OBJECT_TYPE_NAME(current);
+
+  /* find */
+  recall_profiler_mutex = AGS_RECALL_PROFILER_GET_OBJ_MUTEX(recall_profiler);
+
+  g_rec_mutex_lock(recall_profiler_mutex);
+
+  list = recall_profiler->entry;
+
+  while(list != NULL){
+    entry = AGS_RECALL_PROFILER_ENTRY(list->data);
+    
+    if(entry->audio == (gpointer) audio &&
+       entry->channel == (gpointer) channel &&
+       !g_strcmp0(entry->effect, effect)){
+      g_rec_mutex_unlock(recall_profiler_mutex);
+
+      return(entry);
+    }
+    
+    list = list->next;
+  }
+
+  /* create */
+  entry = ags_recall_profiler_entry_alloc(recall_profiler->window_size);
+
+  entry->audio = audio;
+  entry->channel = channel;
+
+  entry->effect = g_strdup(effect);
+
+  if(audio != NULL){
+    entry->audio_name = ags_audio_get_audio_name(audio);
+  }
+
+  if(channel != NULL){
+    entry->line = (gint) channel->line;
+    entry->is_output = AGS_IS_OUTPUT(channel);
+  }
+  
+  recall_profiler->entry = g_list_append(recall_profiler->entry,
+					 entry);
+  
+  g_rec_mutex_unlock(recall_profiler_mutex);
+
+  return(entry);
+}
+
+/**
+ * ags_recall_profiler_add:
+ * @recall_profiler: the #AgsRecallProfiler
+ * @recall: the #AgsRecall
+ * @duration: the duration in nanoseconds
+ *
+ * Account @duration to the entry of @recall during current tic. The entry
+ * is cached by @recall.
+ *
+ * Since: 9.1.0
+ */
+void
+ags_recall_profiler_add(AgsRecallProfiler *recall_profiler,
+			AgsRecall *recall,
+			gint64 duration)
+{
+  AgsRecallProfilerEntry *entry;
+
+  if(recall_profiler == NULL ||
+     recall == NULL){
+    return;
+  }
+
+  entry = ags_atomic_pointer_get(&(recall->profiler_entry));
+  
+  if(entry == NULL){
+    entry = ags_recall_profiler_find_entry(recall_profiler,
+					   recall);
+
+    ags_atomic_pointer_set(&(recall->profiler_entry),
+			   entry);
+  }
+  
+  ags_atomic_int64_add(&(entry->current),
+		       duration);
+}
+
+/**
+ * ags_recall_profiler_tic:
+ * @recall_profiler: the #AgsRecallProfiler
+ * @deadline: the buffer period in nanoseconds
+ *
+ * Close the current tic and push the time spent per entry to the
+ * rolling window.
+ *
+ * Since: 9.1.0
+ */
+void
+ags_recall_profiler_tic(AgsRecallProfiler *recall_profiler,
+			gint64 deadline)
+{
+  AgsRecallProfilerEntry *entry;
+
+  GList *list;
+
+  gint64 current, evicted;
+  guint i;
+  
+  GRecMutex *recall_profiler_mutex;
+
+  g_return_if_fail(AGS_IS_RECALL_PROFILER(recall_profiler));
+
+  recall_profiler_mutex = AGS_RECALL_PROFILER_GET_OBJ_MUTEX(recall_profiler);
+
+  g_rec_mutex_lock(recall_profiler_mutex);
+
+  recall_profiler->deadline = deadline;
+  recall_profiler->tic_count += 1;
+  
+  list = recall_profiler->entry;
+
+  while(list != NULL){
+    entry = AGS_RECALL_PROFILER_ENTRY(list->data);
+
+    current = ags_atomic_int64_exchange(&(entry->current),
+					0);
+
+    evicted = (entry->sample_count == entry->window_size) ? entry->window[entry->window_offset]: 0;
+    
+    entry->window[entry->window_offset] = current;
+
+    entry->window_offset = (entry->window_offset + 1) % entry->window_size;
+
+    if(entry->sample_count < entry->window_size){
+      entry->sample_count += 1;
+    }
+
+    /* rolling maximum - rescan only if the maximum left the window */
+    if(current >= entry->max){
+      entry->max = current;
+    }else if(evicted >= entry->max){
+      entry->max = 0;
+
+      for(i = 0; i < entry->sample_count; i++){
+	if(entry->window[i] > entry->max){
+	  entry->max = entry->window[i];
+	}
+      }
+    }
+    
+    list = list->next;
+  }
+  
+  g_rec_mutex_unlock(recall_profiler_mutex);
+}
+
+/**
+ * ags_recall_profiler_clear:
+ * @recall_profiler: the #AgsRecallProfiler
+ *
+ * Clear the collected samples. The entries are kept since they are cached
+ * by the recalls.
+ *
+ * Since: 9.1.0
+ */
+void
+ags_recall_profiler_clear(AgsRecallProfiler *recall_profiler)
+{
+  AgsRecallProfilerEntry *entry;
+
+  GList *list;
+  
+  GRecMutex *recall_profiler_mutex;
+
+  g_return_if_fail(AGS_IS_RECALL_PROFILER(recall_profiler));
+
+  recall_profiler_mutex = AGS_RECALL_PROFILER_GET_OBJ_MUTEX(recall_profiler);
+
+  g_rec_mutex_lock(recall_profiler_mutex);
+
+  recall_profiler->tic_count = 0;
+  
+  list = recall_profiler->entry;
+
+  while(list != NULL){
+    entry = AGS_RECALL_PROFILER_ENTRY(list->data);
+
+    ags_atomic_int64_set(&(entry->current),
+			 0);
+
+    memset(entry->window, 0, entry->window_size * sizeof(gint64));
+    
+    entry->window_offset = 0;
+    entry->sample_count = 0;
+
+    entry->max = 0;
+    
+    list = list->next;
+  }
+  
+  g_rec_mutex_unlock(recall_profiler_mutex);
+}
+
+/**
+ * ags_recall_profiler_get_entry:
+ * @recall_profiler: the #AgsRecallProfiler
+ *
+ * Get entries.
+ *
+ * Returns: (element-type AgsAudio.RecallProfilerEntry) (transfer container): the #GList-struct containing #AgsRecallProfilerEntry
+ *
+ * Since: 9.1.0
+ */
+GList*
+ags_recall_profiler_get_entry(AgsRecallProfiler *recall_profiler)
+{
+  GList *entry;
+
+  GRecMutex *recall_profiler_mutex;
+
+  g_return_val_if_fail(AGS_IS_RECALL_PROFILER(recall_profiler), NULL);
+
+  recall_profiler_mutex = AGS_RECALL_PROFILER_GET_OBJ_MUTEX(recall_profiler);
+
+  g_rec_mutex_lock(recall_profiler_mutex);
+
+  entry = g_list_copy(recall_profiler->entry);
+
+  g_rec_mutex_unlock(recall_profiler_mutex);
+
+  return(entry);
+}
+
+/**
+ * ags_recall_profiler_entry_get_stats:
+ * @recall_profiler: the #AgsRecallProfiler
+ * @entry: the #AgsRecallProfilerEntry
+ * @mean: (out) (optional): return location of the rolling mean in nanoseconds
+ * @p99: (out) (optional): return location of the rolling 99th percentile in nanoseconds
+ * @max: (out) (optional): return location of the rolling maximum in nanoseconds
+ * @deadline_ratio: (out) (optional): return location of the mean divided by the buffer period
+ *
+ * Get the statistics of @entry per tic.
+ *
+ * Since: 9.1.0
+ */
+void
+ags_recall_profiler_entry_get_stats(AgsRecallProfiler *recall_profiler,
+				    AgsRecallProfilerEntry *entry,
+				    gdouble *mean, gint64 *p99, gint64 *max,
+				    gdouble *deadline_ratio)
+{
+  gint64 *sorted;
+
+  gdouble current_mean;
+  gint64 sum;
+  guint sample_count;
+  guint i;
+  
+  GRecMutex *recall_profiler_mutex;
+
+  g_return_if_fail(AGS_IS_RECALL_PROFILER(recall_profiler));
+  g_return_if_fail(entry != NULL);
+
+  recall_profiler_mutex = AGS_RECALL_PROFILER_GET_OBJ_MUTEX(recall_profiler);
+
+  g_rec_mutex_lock(recall_profiler_mutex);
+
+  sample_count = entry->sample_count;
+
+  sorted = NULL;
+  sum = 0;
+  
+  if(sample_count > 0){
+    sorted = (gint64 *) g_malloc(sample_count * sizeof(gint64));
+
+    /* the window is filled from offset 0 until it wraps */
+    memcpy(sorted, entry->window, sample_count * sizeof(gint64));
+
+    for(i = 0; i < sample_count; i++){
+      sum += sorted[i];
+    }
+  }
+
+  current_mean = (sample_count > 0) ? ((gdouble) sum / (gdouble) sample_count): 0.0;
+  
+  if(mean != NULL){
+    mean[0] = current_mean;
+  }
+
+  if(max != NULL){
+    max[0] = entry->max;
+  }
+
+  if(deadline_ratio != NULL){
+    deadline_ratio[0] = (recall_profiler->deadline > 0) ? (current_mean / (gdouble) recall_profiler->deadline): 0.0;
+  }
+  
+  g_rec_mutex_unlock(recall_profiler_mutex);
+
+  if(p99 != NULL){
+    p99[0] = 0;
+    
+    if(sample_count > 0){
+      qsort(sorted,
+	    sample_count, sizeof(gint64),
+	    ags_recall_profiler_compare_time);
+
+      p99[0] = sorted[((99 * sample_count) + 99) / 100 - 1];
+    }
+  }
+
+  g_free(sorted);
+}
+
+/**
+ * ags_recall_profiler_dump:
+ * @recall_profiler: the #AgsRecallProfiler
+ *
+ * Dump the statistics of all entries as text, one line per entry. The times
+ * are in microseconds and the deadline ratio in percent of the buffer period.
+ *
+ * Returns: (transfer full): the text dump
+ *
+ * Since: 9.1.0
+ */
+gchar*
+ags_recall_profiler_dump(AgsRecallProfiler *recall_profiler)
+{
+  GString *str;
+
+  GList *start_entry, *entry;
+
+  gdouble mean;
+  gint64 p99, max;
+  gdouble deadline_ratio;
+  
+  g_return_val_if_fail(AGS_IS_RECALL_PROFILER(recall_profiler), NULL);
+
+  str = g_string_new(NULL);
+
+  g_string_append_printf(str,
+			 "# tic count %" G_GUINT64_FORMAT ", deadline %.3f usec\n",
+			 recall_profiler->tic_count,
+			 (gdouble) recall_profiler->deadline / 1000.0);
+
+  g_string_append(str,
+		  "# audio\tchannel\teffect\tmean usec\tp99 usec\tmax usec\tdeadline %\n");
+  
+  entry =
+    start_entry = ags_recall_profiler_get_entry(recall_profiler);
+
+  while(entry != NULL){
+    AgsRecallProfilerEntry *current;
+
+    current = AGS_RECALL_PROFILER_ENTRY(entry->data);
+
+    ags_recall_profiler_entry_get_stats(recall_profiler,
+					current,
+					&mean, &p99, &max,
+					&deadline_ratio);
+
+    if(current->line < 0){
+      g_string_append_printf(str,
+			     "%s\t-\t%s\t%.3f\t%.3f\t%.3f\t%.2f\n",
+			     ((current->audio_name != NULL) ? current->audio_name: "(null)"),
+			     current->effect,
+			     mean / 1000.0, (gdouble) p99 / 1000.0, (gdouble) max / 1000.0,
+			     deadline_ratio * 100.0);
+    }else{
+      g_string_append_printf(str,
+			     "%s\t%s %d\t%s\t%.3f\t%.3f\t%.3f\t%.2f\n",
+			     ((current->audio_name != NULL) ? current->audio_name: "(null)"),
+			     (current->is_output ? "output": "input"),
+			     current->line,
+			     current->effect,
+			     mean / 1000.0, (gdouble) p99 / 1000.0, (gdouble) max / 1000.0,
+			     deadline_ratio * 100.0);
+    }
+    
+    entry = entry->next;
+  }
+
+  g_list_free(start_entry);
+  
+  return(g_string_free(str,
+		       FALSE));
+}
+
+/**
+ * ags_recall_profiler_get_instance:
+ *
+ * Get instance.
+ *
+ * Returns: (transfer none): the #AgsRecallProfiler
+ *
+ * Since: 9.1.0
+ */
+AgsRecallProfiler*
+ags_recall_profiler_get_instance()
+{
+  static GMutex mutex;
+
+  g_mutex_lock(&mutex);
+
+  if(ags_recall_profiler == NULL){
+    ags_recall_profiler = ags_recall_profiler_new();
+  }
+
+  g_mutex_unlock(&mutex);
+
+  return(ags_recall_profiler);
+}
+
+/**
+ * ags_recall_profiler_new:
+ *
+ * Create a new instance of #AgsRecallProfiler
+ *
+ * Returns: the new #AgsRecallProfiler
+ *
+ * Since: 9.1.0
+ */
+AgsRecallProfiler*
+ags_recall_profiler_new()
+{
+  AgsRecallProfiler *recall_profiler;
+
+  recall_profiler = (AgsRecallProfiler *) g_object_new(AGS_TYPE_RECALL_PROFILER,
+						       NULL);
+
+  return(recall_profiler);
+}
@@ -0,0 +1,150 @@
+/* GSequencer - Advanced GTK Sequencer
+ * Copyright (C) 2005-2026 Joël Krähemann
+ *
+ * This file is part of GSequencer.
+ *
+ * GSequencer is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GSequencer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GSequencer.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __AGS_RECALL_PROFILER_H__
+#define __AGS_RECALL_PROFILER_H__
+
+#include <glib.h>
+#include <glib-object.h>
+
+#include <ags/libags.h>
+
+#include <ags/audio/ags_recall.h>
+
+G_BEGIN_DECLS
+
+#define AGS_TYPE_RECALL_PROFILER                (ags_recall_profiler_get_type())
+#define AGS_RECALL_PROFILER(obj)                (G_TYPE_CHECK_INSTANCE_CAST((obj), AGS_TYPE_RECALL_PROFILER, AgsRecallProfiler))
+#define AGS_RECALL_PROFILER_CLASS(class)        (G_TYPE_CHECK_CLASS_CAST((class), AGS_TYPE_RECALL_PROFILER, AgsRecallProfilerClass))
+#define AGS_IS_RECALL_PROFILER(obj)             (G_TYPE_CHECK_INSTANCE_TYPE ((obj), AGS_TYPE_RECALL_PROFILER))
+#define AGS_IS_RECALL_PROFILER_CLASS(class)     (G_TYPE_CHECK_CLASS_TYPE ((class), AGS_TYPE_RECALL_PROFILER))
+#define AGS_RECALL_PROFILER_GET_CLASS(obj)      (G_TYPE_INSTANCE_GET_CLASS ((obj), AGS_TYPE_RECALL_PROFILER, AgsRecallProfilerClass))
+
+#define AGS_RECALL_PROFILER_GET_OBJ_MUTEX(obj) (&(((AgsRecallProfiler *) obj)->obj_mutex))
+
+#define AGS_RECALL_PROFILER_ENTRY(ptr) ((AgsRecallProfilerEntry *)(ptr))
+
+#define AGS_RECALL_PROFILER_DEFAULT_WINDOW_SIZE (256)
+
+/**
+ * AGS_RECALL_PROFILER_IS_ENABLED:
+ *
+ * Check if the recall profiler is enabled. This is the only cost paid by
+ * the recall staging while the profiler is disabled.
+ *
+ * Since: 9.1.0
+ */
+#define AGS_RECALL_PROFILER_IS_ENABLED() (ags_recall_profiler_enabled)
+
+typedef struct _AgsRecallProfiler AgsRecallProfiler;
+typedef struct _AgsRecallProfilerClass AgsRecallProfilerClass;
+typedef struct _AgsRecallProfilerEntry AgsRecallProfilerEntry;
+
+/**
+ * AgsRecallProfilerEntry:
+ * @audio: the #AgsAudio, only used as key
+ * @channel: the #AgsChannel or %NULL for audio scope, only used as key
+ * @effect: the effect name
+ * @audio_name: the audio name
+ * @line: the channel's line or -1 for audio scope
+ * @is_output: %TRUE if @channel is an #AgsOutput
+ * @current: the nanoseconds spent during current tic
+ * @window_size: the window size
+ * @window: (array length=window_size): the nanoseconds spent per tic
+ * @window_offset: the next offset to write within @window
+ * @sample_count: the count of samples within @window
+ * @max: the maximum nanoseconds spent per tic within @window
+ *
+ * The per audio, channel and effect aggregated timing of #AgsRecallProfiler.
+ */
+struct _AgsRecallProfilerEntry
+{
+  gpointer audio;
+  gpointer channel;
+
+  gchar *effect;
+  gchar *audio_name;
+
+  gint line;
+  gboolean is_output;
+  
+  volatile gint64 current;
+
+  guint window_size;
+  gint64 *window;
+  
+  guint window_offset;
+  guint sample_count;
+
+  gint64 max;
+};
+
+struct _AgsRecallProfiler
+{
+  GObject gobject;
+
+  GRecMutex obj_mutex;
+
+  guint window_size;
+
+  gint64 deadline;
+  guint64 tic_count;
+  
+  GList *entry;
+};
+
+struct _AgsRecallProfilerClass
+{
+  GObjectClass gobject;
+};
+
+extern volatile gboolean ags_recall_profiler_enabled;
+
+GType ags_recall_profiler_get_type(void);
+
+gint64 ags_recall_profiler_get_time();
+
+void ags_recall_profiler_set_enabled(gboolean enabled);
+gboolean ags_recall_profiler_is_enabled();
+
+AgsRecallProfilerEntry* ags_recall_profiler_find_entry(AgsRecallProfiler *recall_profiler,
+						       AgsRecall *recall);
+void ags_recall_profiler_add(AgsRecallProfiler *recall_profiler,
+			     AgsRecall *recall,
+			     gint64 duration);
+
+void ags_recall_profiler_tic(AgsRecallProfiler *recall_profiler,
+			     gint64 deadline);
+void ags_recall_profiler_clear(AgsRecallProfiler *recall_profiler);
+
+GList* ags_recall_profiler_get_entry(AgsRecallProfiler *recall_profiler);
+
+void ags_recall_profiler_entry_get_stats(AgsRecallProfiler *recall_profiler,
+					 AgsRecallProfilerEntry *entry,
+					 gdouble *mean, gint64 *p99, gint64 *max,
+					 gdouble *deadline_ratio);
+
+gchar* ags_recall_profiler_dump(AgsRecallProfiler *recall_profiler);
+
+AgsRecallProfiler* ags_recall_profiler_get_instance();
+AgsRecallProfiler* ags_recall_profiler_new();
+
+G_END_DECLS
+
+#endif /*__AGS_RECALL_PROFILER_H__*/
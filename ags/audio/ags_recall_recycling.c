@@ -46,6 +46,8 @@ void ags_recall_recycling_get_property(GObject *gobject,
 void ags_recall_recycling_dispose(GObject *gobject);
 void ags_recall_recycling_finalize(GObject *gobject);
 
+void ags_recall_recycling_update_rt_view(AgsRecall *recall);
+
 void ags_recall_recycling_connect(AgsConnectable *connectable);
 void ags_recall_recycling_disconnect(AgsConnectable *connectable);
 void ags_recall_recycling_connect_connection(AgsConnectable *connectable,
@@ -233,6 +235,8 @@ ags_recall_recycling_class_init(AgsRecallRecyclingClass *recall_recycling)
 
   recall->duplicate = ags_recall_recycling_duplicate;
 
+  recall->update_rt_view = ags_recall_recycling_update_rt_view;
+
   /* AgsRecallRecyclingClass */
 }
 
@@ -411,6 +415,8 @@ ags_recall_recycling_set_property(GObject *gobject,
     G_OBJECT_WARN_INVALID_PROPERTY_ID(gobject, prop_id, param_spec);
     break;
   };
+
+  ags_recall_update_rt_view((AgsRecall *) gobject);
 }
 
 void
@@ -479,6 +485,33 @@ ags_recall_recycling_get_property(GObject *gobject,
   };
 }
 
+void
+ags_recall_recycling_update_rt_view(AgsRecall *recall)
+{
+  AgsRecallRecycling *recall_recycling;
+  AgsRecallRtView *rt_view;
+
+  GRecMutex *recall_mutex;
+
+  recall_recycling = (AgsRecallRecycling *) recall;
+
+  /* get recall mutex */
+  recall_mutex = AGS_RECALL_GET_OBJ_MUTEX(recall);
+
+  rt_view = AGS_RECALL_RT_VIEW(recall);
+
+  /* update */
+  g_rec_mutex_lock(recall_mutex);
+
+  rt_view->source = (GObject *) recall_recycling->source;
+  rt_view->destination = (GObject *) recall_recycling->destination;
+
+  g_rec_mutex_unlock(recall_mutex);
+
+  /* call parent */
+  AGS_RECALL_CLASS(ags_recall_recycling_parent_class)->update_rt_view(recall);
+}
+
 void
 ags_recall_recycling_dispose(GObject *gobject)
 {
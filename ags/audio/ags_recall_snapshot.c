@@ -0,0 +1,713 @@
+/* GSequencer - Advanced GTK Sequencer
+ * Copyright (C) 2005-2026 Joël Krähemann
+ *
+ * This file is part of GSequencer.
+ *
+ * GSequencer is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GSequencer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GSequencer.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <ags/audio/ags_recall_snapshot.h>
+
+#include <ags/audio/ags_recall_id.h>
+#include <ags/audio/ags_recycling_context.h>
+
+#define AGS_RECALL_SNAPSHOT_STAGING_MASK_CACHED (1U << 31)
+
+guint ags_recall_snapshot_get_type_staging_mask(GType recall_type);
+
+/**
+ * SECTION:ags_recall_snapshot
+ * @short_description: Immutable snapshot of recall lists
+ * @title: AgsRecallSnapshot
+ * @section_id:
+ * @include: ags/audio/ags_recall_snapshot.h
+ *
+ * #AgsRecallSnapshot is an immutable array of #AgsRecall published to an
+ * #AgsRecallSnapshotSlot every time the play or recall context of
+ * #AgsAudio or #AgsChannel is modified.
+ *
+ * The audio thread acquires the current snapshot and iterates it without
+ * copying the list, referencing its recalls or locking the list mutex.
+ * Replaced snapshots are retired and reclaimed as soon as they have no
+ * readers left, either by the next writer or by #AgsEpochReclaimer. The
+ * retired list is bounded by the number of concurrent readers.
+ *
+ * The run stages the recalls implement are computed once as the snapshot
+ * is allocated, so the audio thread doesn't need to walk types or children.
+ */
+
+void ags_recall_snapshot_slot_push_retired(AgsRecallSnapshotSlot *slot,
+					   AgsRecallSnapshot *head, AgsRecallSnapshot *tail);
+AgsRecallSnapshot* ags_recall_snapshot_slot_pop_unused(AgsRecallSnapshotSlot *slot);
+
+void ags_recall_snapshot_slot_reclaim_free(AgsRecallSnapshot *snapshot);
+
+GType
+ags_recall_snapshot_get_type(void)
+{
+  static gsize g_define_type_id__static = 0;
+
+  if(g_once_init_enter(&g_define_type_id__static)){
+    GType ags_type_recall_snapshot = 0;
+
+    ags_type_recall_snapshot =
+      g_boxed_type_register_static("AgsRecallSnapshot",
+				   (GBoxedCopyFunc) ags_recall_snapshot_copy,
+				   (GBoxedFreeFunc) ags_recall_snapshot_free);
+
+    g_once_init_leave(&g_define_type_id__static, ags_type_recall_snapshot);
+  }
+
+  return(g_define_type_id__static);
+}
+
+guint
+ags_recall_snapshot_get_type_staging_mask(GType recall_type)
+{
+  AgsRecallClass *recall_class, *base_class;
+
+  static GQuark quark_staging_mask = 0;
+
+  guint staging_mask;
+
+  if(recall_type == G_TYPE_NONE ||
+     recall_type == G_TYPE_INVALID){
+    return(0);
+  }
+  
+  if(quark_staging_mask == 0){
+    quark_staging_mask = g_quark_from_static_string("ags-recall-snapshot-staging-mask");
+  }
+
+  staging_mask = GPOINTER_TO_UINT(g_type_get_qdata(recall_type,
+						   quark_staging_mask));
+
+  if((AGS_RECALL_SNAPSHOT_STAGING_MASK_CACHED & staging_mask) != 0){
+    return(staging_mask & (~AGS_RECALL_SNAPSHOT_STAGING_MASK_CACHED));
+  }
+
+  /* the stages overridden by the class, the base class does nothing */
+  recall_class = g_type_class_ref(recall_type);
+  base_class = g_type_class_peek(AGS_TYPE_RECALL);
+
+  staging_mask = 0;
+
+  if(recall_class->feed_input_queue != base_class->feed_input_queue){
+    staging_mask |= AGS_SOUND_STAGING_FEED_INPUT_QUEUE;
+  }
+
+  if(recall_class->automate != base_class->automate){
+    staging_mask |= AGS_SOUND_STAGING_AUTOMATE;
+  }
+
+  if(recall_class->midi1_control_change != base_class->midi1_control_change){
+    staging_mask |= AGS_SOUND_STAGING_MIDI1_CONTROL_CHANGE;
+  }
+
+  if(recall_class->midi2_control_change != base_class->midi2_control_change){
+    staging_mask |= AGS_SOUND_STAGING_MIDI2_CONTROL_CHANGE;
+  }
+
+  if(recall_class->run_pre != base_class->run_pre){
+    staging_mask |= AGS_SOUND_STAGING_RUN_PRE;
+  }
+
+  if(recall_class->run_inter != base_class->run_inter){
+    staging_mask |= AGS_SOUND_STAGING_RUN_INTER;
+  }
+
+  if(recall_class->run_post != base_class->run_post){
+    staging_mask |= AGS_SOUND_STAGING_RUN_POST;
+  }
+
+  if(recall_class->do_feedback != base_class->do_feedback){
+    staging_mask |= AGS_SOUND_STAGING_DO_FEEDBACK;
+  }
+
+  if(recall_class->feed_output_queue != base_class->feed_output_queue){
+    staging_mask |= AGS_SOUND_STAGING_FEED_OUTPUT_QUEUE;
+  }
+
+  g_type_class_unref(recall_class);
+  
+  g_type_set_qdata(recall_type,
+		   quark_staging_mask,
+		   GUINT_TO_POINTER(AGS_RECALL_SNAPSHOT_STAGING_MASK_CACHED | staging_mask));
+
+  return(staging_mask);
+}
+
+/**
+ * ags_recall_snapshot_get_recall_staging_mask:
+ * @recall: the #AgsRecall
+ *
+ * Get the run stages implemented by @recall, its child type or its
+ * children. Stages not overridden of #AgsRecall do nothing.
+ *
+ * Returns: the #AgsSoundStagingFlags mask
+ *
+ * Since: 9.1.0
+ */
+guint
+ags_recall_snapshot_get_recall_staging_mask(AgsRecall *recall)
+{
+  GList *start_list, *list;
+
+  GType child_type;
+  
+  guint staging_mask;
+  gboolean children_lock_free;
+
+  GRecMutex *recall_mutex;
+
+  staging_mask = ags_recall_snapshot_get_type_staging_mask(G_OBJECT_TYPE(recall));
+
+  children_lock_free = ags_recall_global_get_children_lock_free();
+  
+  /* get recall mutex */
+  recall_mutex = AGS_RECALL_GET_OBJ_MUTEX(recall);
+
+  g_rec_mutex_lock(recall_mutex);
+
+  child_type = recall->child_type;
+  
+  if(recall->children == NULL ||
+     (AGS_RECALL_SNAPSHOT_RUN_STAGING_MASK & (~staging_mask)) == 0){
+    start_list = NULL;
+  }else if(!children_lock_free){
+    start_list = g_list_copy_deep(recall->children,
+				  (GCopyFunc) g_object_ref,
+				  NULL);
+  }else{
+    start_list = recall->children;
+  }
+  
+  g_rec_mutex_unlock(recall_mutex);
+
+  /* the children are staged by their parent */
+  staging_mask |= ags_recall_snapshot_get_type_staging_mask(child_type);
+
+  list = start_list;
+  
+  while(list != NULL &&
+	(AGS_RECALL_SNAPSHOT_RUN_STAGING_MASK & (~staging_mask)) != 0){
+    staging_mask |= ags_recall_snapshot_get_recall_staging_mask(list->data);
+    
+    list = list->next;
+  }
+
+  if(!children_lock_free){
+    g_list_free_full(start_list,
+		     g_object_unref);
+  }
+  
+  return(staging_mask);
+}
+
+/**
+ * ags_recall_snapshot_alloc:
+ * @recall: (element-type AgsAudio.Recall) (transfer none): the #GList-struct containing #AgsRecall
+ * @version: the version
+ *
+ * Allocate #AgsRecallSnapshot-struct of @recall. The recalls are stored in
+ * reversed order of @recall and each of them is referenced.
+ *
+ * Returns: a new #AgsRecallSnapshot-struct
+ *
+ * Since: 9.1.0
+ */
+AgsRecallSnapshot*
+ags_recall_snapshot_alloc(GList *recall,
+			  guint64 version)
+{
+  AgsRecallSnapshot *ptr;
+
+  guint length;
+  guint i;
+
+  ptr = (AgsRecallSnapshot *) g_new(AgsRecallSnapshot,
+				    1);
+
+  length = g_list_length(recall);
+
+  ptr->version = version;
+
+  ptr->length = length;
+  ptr->recall = NULL;
+
+  if(length > 0){
+    ptr->recall = (AgsRecall **) g_new(AgsRecall *,
+				       length);
+  }
+
+  ptr->staging_mask = 0;
+  
+  ptr->readers = 0;
+
+  ptr->next = NULL;
+
+  for(i = 0; recall != NULL; i++){
+    ptr->recall[length - i - 1] = (AgsRecall *) recall->data;
+    g_object_ref(recall->data);
+
+    /* computed once, the audio thread reads the cached mask */
+    ptr->staging_mask |= ags_recall_snapshot_get_recall_staging_mask((AgsRecall *) recall->data);
+    
+    recall = recall->next;
+  }
+
+  return(ptr);
+}
+
+/**
+ * ags_recall_snapshot_copy:
+ * @ptr: the original #AgsRecallSnapshot-struct
+ *
+ * Create a copy of @ptr.
+ *
+ * Returns: a pointer of the new #AgsRecallSnapshot-struct
+ *
+ * Since: 9.1.0
+ */
+gpointer
+ags_recall_snapshot_copy(AgsRecallSnapshot *ptr)
+{
+  AgsRecallSnapshot *new_ptr;
+
+  guint i;
+
+  g_return_val_if_fail(ptr != NULL, NULL);
+
+  new_ptr = (AgsRecallSnapshot *) g_new(AgsRecallSnapshot,
+					1);
+
+  new_ptr->version = ptr->version;
+
+  new_ptr->length = ptr->length;
+  new_ptr->recall = NULL;
+
+  if(ptr->length > 0){
+    new_ptr->recall = (AgsRecall **) g_new(AgsRecall *,
+					   ptr->length);
+  }
+
+  for(i = 0; i < ptr->length; i++){
+    new_ptr->recall[i] = ptr->recall[i];
+    g_object_ref(ptr->recall[i]);
+  }
+
+  new_ptr->staging_mask = ptr->staging_mask;
+  
+  new_ptr->readers = 0;
+
+  new_ptr->next = NULL;
+
+  return(new_ptr);
+}
+
+/**
+ * ags_recall_snapshot_free:
+ * @ptr: the #AgsRecallSnapshot-struct
+ *
+ * Free the memory of @ptr and unref its recalls.
+ *
+ * Since: 9.1.0
+ */
+void
+ags_recall_snapshot_free(AgsRecallSnapshot *ptr)
+{
+  guint i;
+
+  g_return_if_fail(ptr != NULL);
+
+  for(i = 0; i < ptr->length; i++){
+    g_object_unref(ptr->recall[i]);
+  }
+
+  g_free(ptr->recall);
+
+  g_free(ptr);
+}
+
+/**
+ * ags_recall_snapshot_find_recycling_context:
+ * @snapshot: the #AgsRecallSnapshot-struct
+ * @offset: the position to start the search
+ * @recycling_context: the #AgsRecyclingContext
+ *
+ * Find next recall in @snapshot matching @recycling_context, starting at @offset.
+ *
+ * Returns: the position of the matching #AgsRecall or -1 if not found
+ *
+ * Since: 9.1.0
+ */
+gint
+ags_recall_snapshot_find_recycling_context(AgsRecallSnapshot *snapshot,
+					   guint offset,
+					   GObject *recycling_context)
+{
+  AgsRecall *current_recall;
+  AgsRecallID *current_recall_id;
+  AgsRecyclingContext *current_recycling_context;
+
+  guint i;
+
+  GRecMutex *current_recall_mutex;
+  GRecMutex *current_recall_id_mutex;
+
+  if(snapshot == NULL ||
+     !AGS_IS_RECYCLING_CONTEXT(recycling_context)){
+    return(-1);
+  }
+
+  for(i = offset; i < snapshot->length; i++){
+    current_recall = snapshot->recall[i];
+
+    /* get recall mutex */
+    current_recall_mutex = AGS_RECALL_GET_OBJ_MUTEX(current_recall);
+
+    /* get some fields */
+    g_rec_mutex_lock(current_recall_mutex);
+
+    current_recall_id = current_recall->recall_id;
+
+    g_rec_mutex_unlock(current_recall_mutex);
+
+    /* get recycling context */
+    current_recycling_context = NULL;
+
+    if(current_recall_id != NULL){
+      /* get recall id mutex */
+      current_recall_id_mutex = AGS_RECALL_ID_GET_OBJ_MUTEX(current_recall_id);
+
+      /* recycling context */
+      g_rec_mutex_lock(current_recall_id_mutex);
+
+      current_recycling_context = current_recall_id->recycling_context;
+
+      g_rec_mutex_unlock(current_recall_id_mutex);
+    }
+
+    if(current_recycling_context == (AgsRecyclingContext *) recycling_context){
+      return((gint) i);
+    }
+  }
+
+  return(-1);
+}
+
+/**
+ * ags_recall_snapshot_slot_init:
+ * @slot: the #AgsRecallSnapshotSlot-struct
+ * @mutex: the #GRecMutex protecting the recall list
+ *
+ * Initialize @slot with an empty snapshot.
+ *
+ * Since: 9.1.0
+ */
+void
+ags_recall_snapshot_slot_init(AgsRecallSnapshotSlot *slot,
+			      GRecMutex *mutex)
+{
+  g_return_if_fail(slot != NULL);
+
+  slot->readers = 0;
+
+  slot->version = 0;
+
+  slot->current = ags_recall_snapshot_alloc(NULL,
+					    0);
+  slot->retired = NULL;
+
+  slot->mutex = mutex;
+}
+
+/**
+ * ags_recall_snapshot_slot_clear:
+ * @slot: the #AgsRecallSnapshotSlot-struct
+ *
+ * Free the current and retired snapshots of @slot. There must be no
+ * readers left.
+ *
+ * Since: 9.1.0
+ */
+void
+ags_recall_snapshot_slot_clear(AgsRecallSnapshotSlot *slot)
+{
+  AgsRecallSnapshot *snapshot, *snapshot_next;
+
+  g_return_if_fail(slot != NULL);
+
+  snapshot = ags_atomic_pointer_exchange(&(slot->current),
+					 NULL);
+
+  if(snapshot != NULL){
+    ags_recall_snapshot_free(snapshot);
+  }
+
+  snapshot = ags_atomic_pointer_exchange(&(slot->retired),
+					 NULL);
+
+  while(snapshot != NULL){
+    snapshot_next = snapshot->next;
+
+    ags_recall_snapshot_free(snapshot);
+
+    snapshot = snapshot_next;
+  }
+}
+
+/**
+ * ags_recall_snapshot_slot_publish:
+ * @slot: the #AgsRecallSnapshotSlot-struct
+ * @recall: (element-type AgsAudio.Recall) (transfer none): the #GList-struct containing #AgsRecall
+ *
+ * Publish a new snapshot of @recall to @slot and retire the previous one. The
+ * mutex of @slot is locked recursively, so callers modifying the recall list
+ * can publish while still holding it. Retired snapshots without readers are
+ * reclaimed right away.
+ *
+ * Since: 9.1.0
+ */
+void
+ags_recall_snapshot_slot_publish(AgsRecallSnapshotSlot *slot,
+				 GList *recall)
+{
+  AgsRecallSnapshot *snapshot, *old_snapshot;
+
+  g_return_if_fail(slot != NULL);
+
+  g_rec_mutex_lock(slot->mutex);
+
+  slot->version += 1;
+
+  snapshot = ags_recall_snapshot_alloc(recall,
+				       slot->version);
+
+  old_snapshot = ags_atomic_pointer_exchange(&(slot->current),
+					     snapshot);
+
+  if(old_snapshot != NULL){
+    ags_recall_snapshot_slot_push_retired(slot,
+					  old_snapshot, old_snapshot);
+  }
+
+  ags_recall_snapshot_slot_reclaim(slot);
+
+  g_rec_mutex_unlock(slot->mutex);
+}
+
+void
+ags_recall_snapshot_slot_push_retired(AgsRecallSnapshotSlot *slot,
+				      AgsRecallSnapshot *head, AgsRecallSnapshot *tail)
+{
+  AgsRecallSnapshot *retired;
+
+  /* lock-free push, the audio thread might pop concurrently */
+  do{
+    retired = ags_atomic_pointer_get(&(slot->retired));
+
+    tail->next = retired;
+  }while(!ags_atomic_pointer_compare_and_exchange(&(slot->retired),
+						  retired,
+						  head));
+}
+
+AgsRecallSnapshot*
+ags_recall_snapshot_slot_pop_unused(AgsRecallSnapshotSlot *slot)
+{
+  AgsRecallSnapshot *retired, *snapshot, *snapshot_next;
+  AgsRecallSnapshot *unused;
+  AgsRecallSnapshot *used, *used_tail;
+
+  retired = ags_atomic_pointer_exchange(&(slot->retired),
+					NULL);
+
+  if(retired == NULL){
+    return(NULL);
+  }
+
+  /* a reader still between loading and referencing a snapshot */
+  if(ags_atomic_int_get(&(slot->readers)) != 0){
+    snapshot = retired;
+
+    while(snapshot->next != NULL){
+      snapshot = snapshot->next;
+    }
+
+    ags_recall_snapshot_slot_push_retired(slot,
+					  retired, snapshot);
+
+    return(NULL);
+  }
+
+  /* no reader can acquire a retired snapshot anymore, keep the ones in use */
+  unused = NULL;
+
+  used = NULL;
+  used_tail = NULL;
+
+  snapshot = retired;
+
+  while(snapshot != NULL){
+    snapshot_next = snapshot->next;
+
+    if(ags_atomic_int_get(&(snapshot->readers)) == 0){
+      snapshot->next = unused;
+      unused = snapshot;
+    }else{
+      if(used_tail == NULL){
+	used_tail = snapshot;
+      }
+
+      snapshot->next = used;
+      used = snapshot;
+    }
+
+    snapshot = snapshot_next;
+  }
+
+  if(used != NULL){
+    ags_recall_snapshot_slot_push_retired(slot,
+					  used, used_tail);
+  }
+
+  return(unused);
+}
+
+void
+ags_recall_snapshot_slot_reclaim_free(AgsRecallSnapshot *snapshot)
+{
+  AgsRecallSnapshot *snapshot_next;
+
+  while(snapshot != NULL){
+    snapshot_next = snapshot->next;
+
+    ags_recall_snapshot_free(snapshot);
+
+    snapshot = snapshot_next;
+  }
+}
+
+/**
+ * ags_recall_snapshot_slot_reclaim:
+ * @slot: the #AgsRecallSnapshotSlot-struct
+ *
+ * Reclaim the retired snapshots of @slot without readers. The snapshots are
+ * retired to #AgsEpochReclaimer if it is running, otherwise they are freed
+ * by the calling thread. This is the writer side and must not be called by
+ * the audio thread.
+ *
+ * Since: 9.1.0
+ */
+void
+ags_recall_snapshot_slot_reclaim(AgsRecallSnapshotSlot *slot)
+{
+  AgsEpochReclaimer *epoch_reclaimer;
+  AgsRecallSnapshot *unused;
+
+  g_return_if_fail(slot != NULL);
+
+  unused = ags_recall_snapshot_slot_pop_unused(slot);
+
+  if(unused == NULL){
+    return;
+  }
+
+  epoch_reclaimer = ags_epoch_reclaimer_get_instance();
+
+  if(ags_worker_thread_test_status_flags((AgsWorkerThread *) epoch_reclaimer, AGS_WORKER_THREAD_STATUS_RUNNING)){
+    ags_epoch_reclaimer_retire(epoch_reclaimer,
+			       unused, (AgsDestroyFunc) ags_recall_snapshot_slot_reclaim_free);
+  }else{
+    ags_recall_snapshot_slot_reclaim_free(unused);
+  }
+}
+
+/**
+ * ags_recall_snapshot_slot_acquire:
+ * @slot: the #AgsRecallSnapshotSlot-struct
+ *
+ * Acquire the current snapshot of @slot. The snapshot stays valid until
+ * you pass it to ags_recall_snapshot_slot_release().
+ *
+ * Returns: (transfer none): the current #AgsRecallSnapshot-struct
+ *
+ * Since: 9.1.0
+ */
+AgsRecallSnapshot*
+ags_recall_snapshot_slot_acquire(AgsRecallSnapshotSlot *slot)
+{
+  AgsRecallSnapshot *snapshot;
+
+  /* the slot's readers protect loading and referencing the snapshot */
+  ags_atomic_int_increment(&(slot->readers));
+  ags_atomic_memory_barrier();
+
+  snapshot = (AgsRecallSnapshot *) ags_atomic_pointer_get(&(slot->current));
+
+  if(snapshot != NULL){
+    ags_atomic_int_increment(&(snapshot->readers));
+  }
+  
+  ags_atomic_memory_barrier();
+  ags_atomic_int_decrement(&(slot->readers));
+
+  return(snapshot);
+}
+
+/**
+ * ags_recall_snapshot_slot_release:
+ * @slot: the #AgsRecallSnapshotSlot-struct
+ * @snapshot: the #AgsRecallSnapshot-struct returned by ags_recall_snapshot_slot_acquire()
+ *
+ * Release @snapshot acquired by ags_recall_snapshot_slot_acquire(). If
+ * this was the last reader of a retired snapshot, the retired snapshots
+ * without readers are passed to #AgsEpochReclaimer. The calling thread
+ * neither locks nor frees, if the reclaimer isn't running they are left
+ * to the next writer.
+ *
+ * Since: 9.1.0
+ */
+void
+ags_recall_snapshot_slot_release(AgsRecallSnapshotSlot *slot,
+				 AgsRecallSnapshot *snapshot)
+{
+  AgsEpochReclaimer *epoch_reclaimer;
+  AgsRecallSnapshot *unused;
+
+  if(snapshot == NULL){
+    return;
+  }
+  
+  ags_atomic_memory_barrier();
+
+  if(ags_atomic_int_decrement(&(snapshot->readers)) != 1 ||
+     ags_atomic_pointer_get(&(slot->retired)) == NULL){
+    return;
+  }
+
+  epoch_reclaimer = ags_epoch_reclaimer_get_instance();
+
+  if(!ags_worker_thread_test_status_flags((AgsWorkerThread *) epoch_reclaimer, AGS_WORKER_THREAD_STATUS_RUNNING)){
+    return;
+  }
+
+  unused = ags_recall_snapshot_slot_pop_unused(slot);
+
+  if(unused != NULL){
+    ags_epoch_reclaimer_retire(epoch_reclaimer,
+			       unused, (AgsDestroyFunc) ags_recall_snapshot_slot_reclaim_free);
+  }
+}
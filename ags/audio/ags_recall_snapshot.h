@@ -0,0 +1,133 @@
+/* GSequencer - Advanced GTK Sequencer
+ * Copyright (C) 2005-2026 Joël Krähemann
+ *
+ * This file is part of GSequencer.
+ *
+ * GSequencer is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GSequencer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GSequencer.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __AGS_RECALL_SNAPSHOT_H__
+#define __AGS_RECALL_SNAPSHOT_H__
+
+#include <glib.h>
+#include <glib-object.h>
+
+#include <ags/libags.h>
+
+#include <ags/audio/ags_recall.h>
+
+G_BEGIN_DECLS
+
+#define AGS_TYPE_RECALL_SNAPSHOT         (ags_recall_snapshot_get_type())
+#define AGS_RECALL_SNAPSHOT(ptr) ((AgsRecallSnapshot *)(ptr))
+#define AGS_RECALL_SNAPSHOT_SLOT(ptr) ((AgsRecallSnapshotSlot *)(ptr))
+
+/**
+ * AGS_RECALL_SNAPSHOT_RUN_STAGING_MASK:
+ *
+ * The stages staged per run, see #AgsRecallSnapshot:staging_mask.
+ *
+ * Since: 9.1.0
+ */
+#define AGS_RECALL_SNAPSHOT_RUN_STAGING_MASK (AGS_SOUND_STAGING_FEED_INPUT_QUEUE |	\
+					      AGS_SOUND_STAGING_AUTOMATE |		\
+					      AGS_SOUND_STAGING_MIDI1_CONTROL_CHANGE |	\
+					      AGS_SOUND_STAGING_MIDI2_CONTROL_CHANGE |	\
+					      AGS_SOUND_STAGING_RUN_PRE |		\
+					      AGS_SOUND_STAGING_RUN_INTER |		\
+					      AGS_SOUND_STAGING_RUN_POST |		\
+					      AGS_SOUND_STAGING_DO_FEEDBACK |		\
+					      AGS_SOUND_STAGING_FEED_OUTPUT_QUEUE)
+
+typedef struct _AgsRecallSnapshot AgsRecallSnapshot;
+typedef struct _AgsRecallSnapshotSlot AgsRecallSnapshotSlot;
+
+/**
+ * AgsRecallSnapshot:
+ * @version: the version of the snapshot
+ * @length: the number of recalls
+ * @recall: (array length=length): the recalls in staging order, oldest first
+ * @staging_mask: the run stages implemented by the recalls, their child type or children
+ * @readers: the number of readers holding the snapshot
+ * @next: the next retired snapshot
+ *
+ * Immutable array of #AgsRecall taken of a play or recall context. Each
+ * recall is referenced for the lifetime of the snapshot.
+ */
+struct _AgsRecallSnapshot
+{
+  guint64 version;
+
+  guint length;
+  AgsRecall **recall;
+
+  guint staging_mask;
+  
+  volatile gint readers;
+
+  AgsRecallSnapshot *next;
+};
+
+/**
+ * AgsRecallSnapshotSlot:
+ * @readers: the number of readers loading @current
+ * @version: the version published last
+ * @current: the current #AgsRecallSnapshot
+ * @retired: the retired #AgsRecallSnapshot still read or not reclaimed yet
+ * @mutex: the mutex protecting the recall list
+ *
+ * The slot the current #AgsRecallSnapshot is published to.
+ */
+struct _AgsRecallSnapshotSlot
+{
+  volatile gint readers;
+
+  guint64 version;
+
+  AgsRecallSnapshot *current;
+  AgsRecallSnapshot *retired;
+
+  GRecMutex *mutex;
+};
+
+GType ags_recall_snapshot_get_type(void);
+
+AgsRecallSnapshot* ags_recall_snapshot_alloc(GList *recall,
+					     guint64 version);
+
+gpointer ags_recall_snapshot_copy(AgsRecallSnapshot *ptr);
+void ags_recall_snapshot_free(AgsRecallSnapshot *ptr);
+
+guint ags_recall_snapshot_get_recall_staging_mask(AgsRecall *recall);
+
+gint ags_recall_snapshot_find_recycling_context(AgsRecallSnapshot *snapshot,
+						guint offset,
+						GObject *recycling_context);
+
+/* slot */
+void ags_recall_snapshot_slot_init(AgsRecallSnapshotSlot *slot,
+				   GRecMutex *mutex);
+void ags_recall_snapshot_slot_clear(AgsRecallSnapshotSlot *slot);
+
+void ags_recall_snapshot_slot_publish(AgsRecallSnapshotSlot *slot,
+				      GList *recall);
+void ags_recall_snapshot_slot_reclaim(AgsRecallSnapshotSlot *slot);
+
+AgsRecallSnapshot* ags_recall_snapshot_slot_acquire(AgsRecallSnapshotSlot *slot);
+void ags_recall_snapshot_slot_release(AgsRecallSnapshotSlot *slot,
+				      AgsRecallSnapshot *snapshot);
+
+G_END_DECLS
+
+#endif /*__AGS_RECALL_SNAPSHOT_H__*/
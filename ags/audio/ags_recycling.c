@@ -22,6 +22,7 @@
 #include <ags/audio/ags_audio.h>
 #include <ags/audio/ags_channel.h>
 #include <ags/audio/ags_audio_buffer_util.h>
+#include <ags/audio/ags_audio_signal_pool.h>
 
 #include <string.h>
 #include <math.h>
@@ -524,6 +525,8 @@ ags_recycling_init(AgsRecycling *recycling)
   /* audio signal */
   recycling->audio_signal = NULL;
 
+  recycling->audio_signal_pool = NULL;
+
   /* audio signal - default template */
   audio_signal = ags_audio_signal_new(NULL,
 				      (GObject *) recycling,
@@ -531,7 +534,8 @@ ags_recycling_init(AgsRecycling *recycling)
   g_object_ref(audio_signal);
 	
   ags_audio_signal_set_flags(audio_signal,
-			     AGS_AUDIO_SIGNAL_TEMPLATE);
+			     (AGS_AUDIO_SIGNAL_TEMPLATE |
+			      AGS_AUDIO_SIGNAL_STREAM_BLOCK));
 
   ags_recycling_create_audio_signal_with_frame_count(recycling,
 						     audio_signal,
@@ -962,6 +966,17 @@ ags_recycling_dispose(GObject *gobject)
   g_list_free_full(start_list,
 		   g_object_unref);
 
+  /* audio signal pool */
+  g_rec_mutex_lock(recycling_mutex);
+
+  if(recycling->audio_signal_pool != NULL){
+    g_object_unref(recycling->audio_signal_pool);
+
+    recycling->audio_signal_pool = NULL;
+  }
+  
+  g_rec_mutex_unlock(recycling_mutex);
+
   /* call parent */
   G_OBJECT_CLASS(ags_recycling_parent_class)->dispose(gobject);
 }
@@ -1019,6 +1034,11 @@ ags_recycling_finalize(GObject *gobject)
   g_list_free_full(start_list,
 		   g_object_unref);
 
+  /* audio signal pool */
+  if(recycling->audio_signal_pool != NULL){
+    g_object_unref(recycling->audio_signal_pool);
+  }
+
   /* call parent */
   G_OBJECT_CLASS(ags_recycling_parent_class)->finalize(gobject);
 }
@@ -2072,6 +2092,86 @@ ags_recycling_set_audio_signal(AgsRecycling *recycling, GList *audio_signal)
 		   (GDestroyNotify) g_object_unref);
 }
 
+/**
+ * ags_recycling_get_audio_signal_pool:
+ * @recycling: the #AgsRecycling
+ * 
+ * Get audio signal pool of @recycling.
+ * 
+ * Returns: (transfer full): the #AgsAudioSignalPool or %NULL
+ * 
+ * Since: 9.1.0
+ */
+GObject*
+ags_recycling_get_audio_signal_pool(AgsRecycling *recycling)
+{
+  GObject *audio_signal_pool;
+
+  GRecMutex *recycling_mutex;
+
+  if(!AGS_IS_RECYCLING(recycling)){
+    return(NULL);
+  }
+
+  /* get recycling mutex */
+  recycling_mutex = AGS_RECYCLING_GET_OBJ_MUTEX(recycling);
+
+  g_rec_mutex_lock(recycling_mutex);
+
+  audio_signal_pool = recycling->audio_signal_pool;
+
+  if(audio_signal_pool != NULL){
+    g_object_ref(audio_signal_pool);
+  }
+  
+  g_rec_mutex_unlock(recycling_mutex);
+
+  return(audio_signal_pool);
+}
+
+/**
+ * ags_recycling_set_audio_signal_pool:
+ * @recycling: the #AgsRecycling
+ * @audio_signal_pool: the #AgsAudioSignalPool
+ * 
+ * Set audio signal pool of @recycling. The pooled voices are released to
+ * @audio_signal_pool as they are removed of @recycling.
+ * 
+ * Since: 9.1.0
+ */
+void
+ags_recycling_set_audio_signal_pool(AgsRecycling *recycling, GObject *audio_signal_pool)
+{
+  GRecMutex *recycling_mutex;
+
+  if(!AGS_IS_RECYCLING(recycling)){
+    return;
+  }
+
+  /* get recycling mutex */
+  recycling_mutex = AGS_RECYCLING_GET_OBJ_MUTEX(recycling);
+
+  g_rec_mutex_lock(recycling_mutex);
+
+  if(recycling->audio_signal_pool == audio_signal_pool){
+    g_rec_mutex_unlock(recycling_mutex);
+
+    return;
+  }
+
+  if(recycling->audio_signal_pool != NULL){
+    g_object_unref(recycling->audio_signal_pool);
+  }
+
+  if(audio_signal_pool != NULL){
+    g_object_ref(audio_signal_pool);
+  }
+
+  recycling->audio_signal_pool = audio_signal_pool;
+  
+  g_rec_mutex_unlock(recycling_mutex);
+}
+
 void
 ags_recycling_real_add_audio_signal(AgsRecycling *recycling,
 				    AgsAudioSignal *audio_signal)
@@ -2149,7 +2249,8 @@ ags_recycling_real_add_audio_signal(AgsRecycling *recycling,
 	rt_template = ags_audio_signal_new(output_soundcard,
 					   (GObject *) recycling,
 					   (GObject *) current_recall_id);
-	ags_audio_signal_set_flags(rt_template, AGS_AUDIO_SIGNAL_RT_TEMPLATE);
+	ags_audio_signal_set_flags(rt_template, (AGS_AUDIO_SIGNAL_RT_TEMPLATE |
+						 AGS_AUDIO_SIGNAL_STREAM_BLOCK));
 
 	g_hash_table_insert(hash_table,
 			    current_audio_signal, rt_template);
@@ -2259,6 +2360,8 @@ void
 ags_recycling_real_remove_audio_signal(AgsRecycling *recycling,
 				       AgsAudioSignal *audio_signal)
 {
+  AgsEpochReclaimer *epoch_reclaimer;
+
   GRecMutex *recycling_mutex;
   
   /* get recycling mutex */  
@@ -2276,8 +2379,23 @@ ags_recycling_real_remove_audio_signal(AgsRecycling *recycling,
     g_object_set(audio_signal,
 		 "recycling", NULL,
 		 NULL);
-  
-    g_object_unref(audio_signal);
+
+    /* release voice */
+    if(recycling->audio_signal_pool != NULL &&
+       ags_audio_signal_test_flags(audio_signal, AGS_AUDIO_SIGNAL_RECYCLED)){
+      ags_audio_signal_pool_release((AgsAudioSignalPool *) recycling->audio_signal_pool,
+				    audio_signal);
+    }
+
+    /* don't finalize on the audio thread */
+    epoch_reclaimer = ags_epoch_reclaimer_get_instance();
+
+    if(ags_worker_thread_test_status_flags((AgsWorkerThread *) epoch_reclaimer, AGS_WORKER_THREAD_STATUS_RUNNING)){
+      ags_epoch_reclaimer_retire(epoch_reclaimer,
+				 audio_signal, (AgsDestroyFunc) g_object_unref);
+    }else{
+      g_object_unref(audio_signal);
+    }
   }
 
   g_rec_mutex_unlock(recycling_mutex);
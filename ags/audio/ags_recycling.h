@@ -81,6 +81,8 @@ struct _AgsRecycling
   AgsRecycling *prev;
 
   GList *audio_signal;
+
+  GObject *audio_signal_pool;
 };
 
 struct _AgsRecyclingClass
@@ -134,6 +136,9 @@ void ags_recycling_set_format(AgsRecycling *recycling, guint format);
 GList* ags_recycling_get_audio_signal(AgsRecycling *recycling);
 void ags_recycling_set_audio_signal(AgsRecycling *recycling, GList *audio_signal);
 
+GObject* ags_recycling_get_audio_signal_pool(AgsRecycling *recycling);
+void ags_recycling_set_audio_signal_pool(AgsRecycling *recycling, GObject *audio_signal_pool);
+
 void ags_recycling_add_audio_signal(AgsRecycling *recycling,
 				    AgsAudioSignal *audio_signal);
 void ags_recycling_remove_audio_signal(AgsRecycling *recycling,
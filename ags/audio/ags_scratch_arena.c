@@ -0,0 +1,389 @@
+/* GSequencer - Advanced GTK Sequencer
+ * Copyright (C) 2005-2026 Joël Krähemann
+ *
+ * This file is part of GSequencer.
+ *
+ * GSequencer is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GSequencer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GSequencer.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <ags/audio/ags_scratch_arena.h>
+
+#include <string.h>
+
+gsize ags_scratch_arena_vector_size(AgsVector256Types vector_type);
+
+/**
+ * SECTION:ags_scratch_arena
+ * @short_description: Per thread scratch vectors
+ * @title: AgsScratchArena
+ * @section_id:
+ * @include: ags/audio/ags_scratch_arena.h
+ *
+ * The #AgsScratchArena-struct provides cache aligned scratch vectors of
+ * #AgsVector256Types. Every thread gets its own arena by calling
+ * ags_scratch_arena_get_thread_default(), so acquiring a vector neither
+ * locks a mutex nor scans a list as #AgsVector256Manager does.
+ */
+
+static GPrivate ags_scratch_arena_key = G_PRIVATE_INIT((GDestroyNotify) ags_scratch_arena_free);
+
+gsize
+ags_scratch_arena_vector_size(AgsVector256Types vector_type)
+{
+  switch(vector_type){
+  case AGS_VECTOR_256_SIGNED_8_BIT:
+    return(sizeof(AgsVectorMemS8));
+  case AGS_VECTOR_256_SIGNED_16_BIT:
+    return(sizeof(AgsVectorMemS16));
+  case AGS_VECTOR_256_SIGNED_32_BIT:
+    return(sizeof(AgsVectorMemS32));
+  case AGS_VECTOR_256_SIGNED_64_BIT:
+    return(sizeof(AgsVectorMemS64));
+  case AGS_VECTOR_256_FLOAT:
+    return(sizeof(AgsVectorMemFloat));
+  case AGS_VECTOR_256_DOUBLE:
+    return(sizeof(AgsVectorMemDouble));
+  }
+
+  return(0);
+}
+
+/**
+ * ags_scratch_arena_alloc:
+ * @depth: the number of vectors per vector type
+ *
+ * Allocate #AgsScratchArena-struct with @depth prefaulted vectors of
+ * each #AgsVector256Types.
+ *
+ * Returns: (transfer full): the newly allocated #AgsScratchArena-struct
+ *
+ * Since: 9.1.0
+ */
+AgsScratchArena*
+ags_scratch_arena_alloc(guint depth)
+{
+  AgsScratchArena *scratch_arena;
+
+  guint8 *offset;
+  
+  gsize size;
+  guint i, j;
+
+  if(depth == 0){
+    depth = AGS_SCRATCH_ARENA_DEFAULT_DEPTH;
+  }
+
+  if(depth > AGS_SCRATCH_ARENA_MAX_DEPTH){
+    depth = AGS_SCRATCH_ARENA_MAX_DEPTH;
+  }
+  
+  scratch_arena = (AgsScratchArena *) g_malloc(sizeof(AgsScratchArena));
+
+  scratch_arena->depth = depth;
+
+  /* vector memory - every vector starts at a cache line */
+  size = 0;
+  
+  for(i = 0; i < AGS_SCRATCH_ARENA_VECTOR_TYPE_COUNT; i++){
+    size += depth * AGS_SCRATCH_ARENA_CACHE_LINE_SIZE * ((ags_scratch_arena_vector_size(i) + AGS_SCRATCH_ARENA_CACHE_LINE_SIZE - 1) / AGS_SCRATCH_ARENA_CACHE_LINE_SIZE);
+  }
+
+  scratch_arena->allocated_data = g_malloc0(size + AGS_SCRATCH_ARENA_CACHE_LINE_SIZE);
+  scratch_arena->data = (guint8 *) ((((guintptr) scratch_arena->allocated_data) + AGS_SCRATCH_ARENA_CACHE_LINE_SIZE - 1) & ~((guintptr) AGS_SCRATCH_ARENA_CACHE_LINE_SIZE - 1));
+
+  offset = scratch_arena->data;
+  
+  for(i = 0; i < AGS_SCRATCH_ARENA_VECTOR_TYPE_COUNT; i++){
+    scratch_arena->in_use[i] = 0;
+    
+    scratch_arena->vector_arr[i] = (AgsVectorArr *) g_malloc(depth * sizeof(AgsVectorArr));
+
+    for(j = 0; j < depth; j++){
+      AgsVectorArr *vector_arr;
+
+      vector_arr = scratch_arena->vector_arr[i] + j;
+      
+      vector_arr->vector_type = i;
+      vector_arr->locked = FALSE;
+
+      switch(i){
+      case AGS_VECTOR_256_SIGNED_8_BIT:
+	{
+	  vector_arr->vector.vec_s8 = (AgsVectorMemS8 *) offset;
+	}
+	break;
+      case AGS_VECTOR_256_SIGNED_16_BIT:
+	{
+	  vector_arr->vector.vec_s16 = (AgsVectorMemS16 *) offset;
+	}
+	break;
+      case AGS_VECTOR_256_SIGNED_32_BIT:
+	{
+	  vector_arr->vector.vec_s32 = (AgsVectorMemS32 *) offset;
+	}
+	break;
+      case AGS_VECTOR_256_SIGNED_64_BIT:
+	{
+	  vector_arr->vector.vec_s64 = (AgsVectorMemS64 *) offset;
+	}
+	break;
+      case AGS_VECTOR_256_FLOAT:
+	{
+	  vector_arr->vector.vec_float = (AgsVectorMemFloat *) offset;
+	}
+	break;
+      case AGS_VECTOR_256_DOUBLE:
+	{
+	  vector_arr->vector.vec_double = (AgsVectorMemDouble *) offset;
+	}
+	break;
+      }
+
+      offset += AGS_SCRATCH_ARENA_CACHE_LINE_SIZE * ((ags_scratch_arena_vector_size(i) + AGS_SCRATCH_ARENA_CACHE_LINE_SIZE - 1) / AGS_SCRATCH_ARENA_CACHE_LINE_SIZE);
+    }
+  }
+
+  scratch_arena->acquire_count = 0;
+  scratch_arena->exhausted_count = 0;
+  
+  return(scratch_arena);
+}
+
+/**
+ * ags_scratch_arena_free:
+ * @scratch_arena: (transfer full): the #AgsScratchArena-struct
+ *
+ * Free @scratch_arena.
+ *
+ * Since: 9.1.0
+ */
+void
+ags_scratch_arena_free(AgsScratchArena *scratch_arena)
+{
+  guint i;
+  
+  if(scratch_arena == NULL){
+    return;
+  }
+
+  for(i = 0; i < AGS_SCRATCH_ARENA_VECTOR_TYPE_COUNT; i++){
+    g_free(scratch_arena->vector_arr[i]);
+  }
+  
+  g_free(scratch_arena->allocated_data);
+
+  g_free(scratch_arena);
+}
+
+/**
+ * ags_scratch_arena_get_thread_default:
+ *
+ * Get the #AgsScratchArena-struct of the calling thread. The arena is
+ * allocated on first use and freed as the thread exits.
+ *
+ * Returns: (transfer none): the #AgsScratchArena-struct of the calling thread
+ *
+ * Since: 9.1.0
+ */
+AgsScratchArena*
+ags_scratch_arena_get_thread_default()
+{
+  AgsScratchArena *scratch_arena;
+
+  scratch_arena = (AgsScratchArena *) g_private_get(&ags_scratch_arena_key);
+
+  if(scratch_arena == NULL){
+    scratch_arena = ags_scratch_arena_alloc(AGS_SCRATCH_ARENA_DEFAULT_DEPTH);
+
+    g_private_set(&ags_scratch_arena_key,
+		  scratch_arena);
+  }
+
+  return(scratch_arena);
+}
+
+/**
+ * ags_scratch_arena_acquire:
+ * @scratch_arena: the #AgsScratchArena-struct
+ * @vector_type: the vector type
+ *
+ * Acquire vector of @vector_type. Must be called by the thread owning @scratch_arena.
+ *
+ * Returns: (transfer none): the vector array or %NULL if all vectors of @vector_type are in use
+ *
+ * Since: 9.1.0
+ */
+AgsVectorArr*
+ags_scratch_arena_acquire(AgsScratchArena *scratch_arena,
+			  AgsVector256Types vector_type)
+{
+  AgsVectorArr *vector_arr;
+  
+  guint32 mask;
+  guint32 free_mask;
+  gint slot;
+  
+  g_return_val_if_fail(scratch_arena != NULL, NULL);
+  g_return_val_if_fail(vector_type < AGS_SCRATCH_ARENA_VECTOR_TYPE_COUNT, NULL);
+
+  mask = (scratch_arena->depth >= 32) ? G_MAXUINT32: ((((guint32) 1) << scratch_arena->depth) - 1);
+
+  free_mask = (~(scratch_arena->in_use[vector_type])) & mask;
+
+  if(free_mask == 0){
+    scratch_arena->exhausted_count += 1;
+    
+    return(NULL);
+  }
+
+  slot = g_bit_nth_lsf(free_mask, -1);
+
+  scratch_arena->in_use[vector_type] |= (((guint32) 1) << slot);
+
+  vector_arr = scratch_arena->vector_arr[vector_type] + slot;
+  vector_arr->locked = TRUE;
+
+  scratch_arena->acquire_count += 1;
+  
+  return(vector_arr);
+}
+
+/**
+ * ags_scratch_arena_acquire_dual:
+ * @scratch_arena: the #AgsScratchArena-struct
+ * @vector_type_a: the vector type a
+ * @vector_type_b: the vector type b
+ * @vector_arr_a: (out) (transfer none): return location of vector array a
+ * @vector_arr_b: (out) (transfer none): return location of vector array b
+ *
+ * Acquire two vectors at once. Either both are acquired or none.
+ *
+ * Returns: %TRUE if both were acquired, otherwise %FALSE
+ *
+ * Since: 9.1.0
+ */
+gboolean
+ags_scratch_arena_acquire_dual(AgsScratchArena *scratch_arena,
+			       AgsVector256Types vector_type_a, AgsVector256Types vector_type_b,
+			       AgsVectorArr **vector_arr_a, AgsVectorArr **vector_arr_b)
+{
+  AgsVectorArr *a, *b;
+
+  g_return_val_if_fail(scratch_arena != NULL, FALSE);
+  g_return_val_if_fail(vector_arr_a != NULL && vector_arr_b != NULL, FALSE);
+
+  a = ags_scratch_arena_acquire(scratch_arena,
+				vector_type_a);
+
+  if(a == NULL){
+    return(FALSE);
+  }
+  
+  b = ags_scratch_arena_acquire(scratch_arena,
+				vector_type_b);
+
+  if(b == NULL){
+    ags_scratch_arena_release(scratch_arena,
+			      a);
+
+    return(FALSE);
+  }
+
+  vector_arr_a[0] = a;
+  vector_arr_b[0] = b;
+
+  return(TRUE);
+}
+
+/**
+ * ags_scratch_arena_acquire_triple:
+ * @scratch_arena: the #AgsScratchArena-struct
+ * @vector_type_a: the vector type a
+ * @vector_type_b: the vector type b
+ * @vector_type_c: the vector type c
+ * @vector_arr_a: (out) (transfer none): return location of vector array a
+ * @vector_arr_b: (out) (transfer none): return location of vector array b
+ * @vector_arr_c: (out) (transfer none): return location of vector array c
+ *
+ * Acquire three vectors at once. Either all are acquired or none.
+ *
+ * Returns: %TRUE if all were acquired, otherwise %FALSE
+ *
+ * Since: 9.1.0
+ */
+gboolean
+ags_scratch_arena_acquire_triple(AgsScratchArena *scratch_arena,
+				 AgsVector256Types vector_type_a, AgsVector256Types vector_type_b, AgsVector256Types vector_type_c,
+				 AgsVectorArr **vector_arr_a, AgsVectorArr **vector_arr_b, AgsVectorArr **vector_arr_c)
+{
+  AgsVectorArr *c;
+
+  g_return_val_if_fail(scratch_arena != NULL, FALSE);
+  g_return_val_if_fail(vector_arr_a != NULL && vector_arr_b != NULL && vector_arr_c != NULL, FALSE);
+
+  if(!ags_scratch_arena_acquire_dual(scratch_arena,
+				     vector_type_a, vector_type_b,
+				     vector_arr_a, vector_arr_b)){
+    return(FALSE);
+  }
+  
+  c = ags_scratch_arena_acquire(scratch_arena,
+				vector_type_c);
+
+  if(c == NULL){
+    ags_scratch_arena_release(scratch_arena,
+			      vector_arr_a[0]);
+    ags_scratch_arena_release(scratch_arena,
+			      vector_arr_b[0]);
+
+    return(FALSE);
+  }
+
+  vector_arr_c[0] = c;
+
+  return(TRUE);
+}
+
+/**
+ * ags_scratch_arena_release:
+ * @scratch_arena: the #AgsScratchArena-struct
+ * @vector_arr: the #AgsVectorArr-struct
+ *
+ * Release @vector_arr previously acquired of @scratch_arena.
+ *
+ * Since: 9.1.0
+ */
+void
+ags_scratch_arena_release(AgsScratchArena *scratch_arena,
+			  AgsVectorArr *vector_arr)
+{
+  AgsVector256Types vector_type;
+  guint slot;
+  
+  g_return_if_fail(scratch_arena != NULL);
+  g_return_if_fail(vector_arr != NULL);
+
+  vector_type = vector_arr->vector_type;
+
+  g_return_if_fail(vector_type < AGS_SCRATCH_ARENA_VECTOR_TYPE_COUNT);
+  g_return_if_fail(vector_arr >= scratch_arena->vector_arr[vector_type] &&
+		   vector_arr < scratch_arena->vector_arr[vector_type] + scratch_arena->depth);
+
+  slot = vector_arr - scratch_arena->vector_arr[vector_type];
+
+  vector_arr->locked = FALSE;
+  
+  scratch_arena->in_use[vector_type] &= (~(((guint32) 1) << slot));
+}
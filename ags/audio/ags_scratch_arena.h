@@ -0,0 +1,91 @@
+/* GSequencer - Advanced GTK Sequencer
+ * Copyright (C) 2005-2026 Joël Krähemann
+ *
+ * This file is part of GSequencer.
+ *
+ * GSequencer is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GSequencer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GSequencer.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef __AGS_SCRATCH_ARENA_H__
+#define __AGS_SCRATCH_ARENA_H__
+
+#include <glib.h>
+#include <glib-object.h>
+
+#include <ags/libags.h>
+
+#include <ags/audio/ags_vector_256_manager.h>
+
+G_BEGIN_DECLS
+
+#define AGS_SCRATCH_ARENA(ptr) ((AgsScratchArena *)(ptr))
+
+#define AGS_SCRATCH_ARENA_DEFAULT_DEPTH (4)
+#define AGS_SCRATCH_ARENA_MAX_DEPTH (32)
+
+#define AGS_SCRATCH_ARENA_CACHE_LINE_SIZE (64)
+
+#define AGS_SCRATCH_ARENA_VECTOR_TYPE_COUNT (6)
+
+typedef struct _AgsScratchArena AgsScratchArena;
+
+/**
+ * AgsScratchArena:
+ * @depth: the number of vectors per vector type
+ * @in_use: per vector type a bitmask of acquired vectors
+ * @vector_arr: (array length=AGS_SCRATCH_ARENA_VECTOR_TYPE_COUNT): per vector type @depth #AgsVectorArr
+ * @data: the cache aligned vector memory
+ * @allocated_data: the allocated memory containing @data
+ * @acquire_count: the number of acquired vectors
+ * @exhausted_count: the number of failed acquires
+ *
+ * The #AgsScratchArena-struct provides per thread scratch vectors. It is owned
+ * by exactly one thread, so acquire and release don't need any lock.
+ */
+struct _AgsScratchArena
+{
+  guint depth;
+
+  guint32 in_use[AGS_SCRATCH_ARENA_VECTOR_TYPE_COUNT];
+  
+  AgsVectorArr *vector_arr[AGS_SCRATCH_ARENA_VECTOR_TYPE_COUNT];
+  
+  guint8 *data;
+  gpointer allocated_data;
+
+  guint64 acquire_count;
+  guint64 exhausted_count;
+};
+
+AgsScratchArena* ags_scratch_arena_alloc(guint depth);
+void ags_scratch_arena_free(AgsScratchArena *scratch_arena);
+
+AgsScratchArena* ags_scratch_arena_get_thread_default();
+
+AgsVectorArr* ags_scratch_arena_acquire(AgsScratchArena *scratch_arena,
+					AgsVector256Types vector_type);
+gboolean ags_scratch_arena_acquire_dual(AgsScratchArena *scratch_arena,
+					AgsVector256Types vector_type_a, AgsVector256Types vector_type_b,
+					AgsVectorArr **vector_arr_a, AgsVectorArr **vector_arr_b);
+gboolean ags_scratch_arena_acquire_triple(AgsScratchArena *scratch_arena,
+					  AgsVector256Types vector_type_a, AgsVector256Types vector_type_b, AgsVector256Types vector_type_c,
+					  AgsVectorArr **vector_arr_a, AgsVectorArr **vector_arr_b, AgsVectorArr **vector_arr_c);
+
+void ags_scratch_arena_release(AgsScratchArena *scratch_arena,
+			       AgsVectorArr *vector_arr);
+
+G_END_DECLS
+
+#endif /*__AGS_SCRATCH_ARENA_H__*/
@@ -19,6 +19,8 @@
 
 #include <ags/audio/ags_soundcard_util.h>
 
+#include <ags/audio/ags_offline_devout.h>
+
 #include <ags/audio/alsa/ags_alsa_devout.h>
 #include <ags/audio/alsa/ags_alsa_devin.h>
 #include <ags/audio/alsa/ags_alsa_midiin.h>
@@ -135,6 +137,8 @@ ags_soundcard_util_get_obj_mutex(GObject *soundcard)
     obj_mutex = AGS_WASAPI_DEVOUT_GET_OBJ_MUTEX(soundcard);
   }else if(AGS_IS_WASAPI_DEVIN(soundcard)){
     obj_mutex = AGS_WASAPI_DEVIN_GET_OBJ_MUTEX(soundcard);
+  }else if(AGS_IS_OFFLINE_DEVOUT(soundcard)){
+    obj_mutex = AGS_OFFLINE_DEVOUT_GET_OBJ_MUTEX(soundcard);
 #if defined(AGS_WITH_GSTREAMER)
   }else if(AGS_IS_GSTREAMER_DEVOUT(soundcard)){
     obj_mutex = AGS_GSTREAMER_DEVOUT_GET_OBJ_MUTEX(soundcard);
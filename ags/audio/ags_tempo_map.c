@@ -0,0 +1,374 @@
+/* GSequencer - Advanced GTK Sequencer
+ * Copyright (C) 2005-2026 Joël Krähemann
+ *
+ * This file is part of GSequencer.
+ *
+ * GSequencer is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GSequencer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GSequencer.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <ags/audio/ags_tempo_map.h>
+
+#include <ags/audio/ags_marker.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * SECTION:ags_tempo_map
+ * @short_description: Compiled tempo program
+ * @title: AgsTempoMap
+ * @section_id:
+ * @include: ags/audio/ags_tempo_map.h
+ *
+ * #AgsTempoMap is the tempo #AgsProgram flattened to an array of
+ * #AgsTempoMapEntry-struct sorted by x offset. It is compiled again as
+ * soon as ags_program_global_get_modified_stamp() differs of @stamp.
+ *
+ * The audio loop advances the cursor with ags_tempo_map_next(), every
+ * tic costs constant time and does not allocate memory. Moving backward,
+ * e.g. by a loop or seek, relocates the cursor by binary search.
+ */
+
+gint ags_tempo_map_entry_sort_func(gconstpointer a,
+				   gconstpointer b);
+
+GType
+ags_tempo_map_get_type(void)
+{
+  static gsize g_define_type_id__static = 0;
+
+  if(g_once_init_enter(&g_define_type_id__static)){
+    GType ags_type_tempo_map = 0;
+
+    ags_type_tempo_map =
+      g_boxed_type_register_static("AgsTempoMap",
+				   (GBoxedCopyFunc) ags_tempo_map_copy,
+				   (GBoxedFreeFunc) ags_tempo_map_free);
+
+    g_once_init_leave(&g_define_type_id__static, ags_type_tempo_map);
+  }
+
+  return(g_define_type_id__static);
+}
+
+gint
+ags_tempo_map_entry_sort_func(gconstpointer a,
+			      gconstpointer b)
+{
+  guint64 a_x, b_x;
+
+  a_x = AGS_TEMPO_MAP_ENTRY(a)->x;
+  b_x = AGS_TEMPO_MAP_ENTRY(b)->x;
+
+  if(a_x == b_x){
+    return(0);
+  }
+
+  return((a_x < b_x) ? -1: 1);
+}
+
+/**
+ * ags_tempo_map_alloc:
+ *
+ * Allocate #AgsTempoMap-struct. The map is empty and its stamp set to
+ * %G_MAXUINT, so it is compiled on first use.
+ *
+ * Returns: a new #AgsTempoMap-struct
+ *
+ * Since: 9.1.0
+ */
+AgsTempoMap*
+ags_tempo_map_alloc()
+{
+  AgsTempoMap *ptr;
+
+  ptr = (AgsTempoMap *) g_new(AgsTempoMap,
+			      1);
+
+  ptr->stamp = G_MAXUINT;
+
+  ptr->length = 0;
+  ptr->entry = NULL;
+
+  ptr->cursor = 0;
+  ptr->position = 0;
+
+  return(ptr);
+}
+
+/**
+ * ags_tempo_map_copy:
+ * @ptr: the original #AgsTempoMap-struct
+ *
+ * Create a copy of @ptr.
+ *
+ * Returns: a pointer of the new #AgsTempoMap-struct
+ *
+ * Since: 9.1.0
+ */
+gpointer
+ags_tempo_map_copy(AgsTempoMap *ptr)
+{
+  AgsTempoMap *new_ptr;
+
+  g_return_val_if_fail(ptr != NULL, NULL);
+
+  new_ptr = (AgsTempoMap *) g_new(AgsTempoMap,
+				  1);
+
+  new_ptr->stamp = ptr->stamp;
+
+  new_ptr->length = ptr->length;
+  new_ptr->entry = NULL;
+
+  if(ptr->length > 0){
+    new_ptr->entry = (AgsTempoMapEntry *) g_new(AgsTempoMapEntry,
+						ptr->length);
+
+    memcpy(new_ptr->entry, ptr->entry, ptr->length * sizeof(AgsTempoMapEntry));
+  }
+
+  new_ptr->cursor = ptr->cursor;
+  new_ptr->position = ptr->position;
+
+  return(new_ptr);
+}
+
+/**
+ * ags_tempo_map_free:
+ * @ptr: the #AgsTempoMap-struct
+ *
+ * Free the memory of @ptr.
+ *
+ * Since: 9.1.0
+ */
+void
+ags_tempo_map_free(AgsTempoMap *ptr)
+{
+  g_return_if_fail(ptr != NULL);
+
+  g_free(ptr->entry);
+
+  g_free(ptr);
+}
+
+/**
+ * ags_tempo_map_compile:
+ * @tempo_map: the #AgsTempoMap-struct
+ * @program: (element-type AgsAudio.Program) (transfer none): the #GList-struct containing tempo #AgsProgram
+ * @stamp: the modified stamp @program was retrieved at
+ *
+ * Compile @program to @tempo_map. The cursor is relocated to the
+ * current position.
+ *
+ * Since: 9.1.0
+ */
+void
+ags_tempo_map_compile(AgsTempoMap *tempo_map,
+		      GList *program,
+		      guint stamp)
+{
+  GList *list;
+  GList *marker;
+
+  guint length;
+  guint i;
+
+  GRecMutex *program_mutex;
+
+  g_return_if_fail(tempo_map != NULL);
+
+  /* count */
+  length = 0;
+
+  list = program;
+
+  while(list != NULL){
+    program_mutex = AGS_PROGRAM_GET_OBJ_MUTEX(list->data);
+
+    g_rec_mutex_lock(program_mutex);
+
+    length += g_list_length(AGS_PROGRAM(list->data)->marker);
+
+    g_rec_mutex_unlock(program_mutex);
+
+    list = list->next;
+  }
+
+  /* fill */
+  g_free(tempo_map->entry);
+
+  tempo_map->entry = NULL;
+
+  if(length > 0){
+    tempo_map->entry = (AgsTempoMapEntry *) g_new(AgsTempoMapEntry,
+						  length);
+  }
+
+  i = 0;
+
+  list = program;
+
+  while(list != NULL){
+    program_mutex = AGS_PROGRAM_GET_OBJ_MUTEX(list->data);
+
+    g_rec_mutex_lock(program_mutex);
+
+    marker = AGS_PROGRAM(list->data)->marker;
+
+    while(marker != NULL && i < length){
+      GRecMutex *marker_mutex;
+
+      marker_mutex = AGS_MARKER_GET_OBJ_MUTEX(marker->data);
+
+      g_rec_mutex_lock(marker_mutex);
+
+      tempo_map->entry[i].x = AGS_MARKER(marker->data)->x;
+      tempo_map->entry[i].bpm = AGS_MARKER(marker->data)->y;
+
+      g_rec_mutex_unlock(marker_mutex);
+
+      i++;
+
+      marker = marker->next;
+    }
+
+    g_rec_mutex_unlock(program_mutex);
+
+    list = list->next;
+  }
+
+  tempo_map->length = i;
+
+  if(tempo_map->length > 1){
+    qsort(tempo_map->entry,
+	  tempo_map->length, sizeof(AgsTempoMapEntry),
+	  ags_tempo_map_entry_sort_func);
+  }
+
+  tempo_map->stamp = stamp;
+
+  tempo_map->cursor = ags_tempo_map_find(tempo_map,
+					 tempo_map->position);
+}
+
+/**
+ * ags_tempo_map_find:
+ * @tempo_map: the #AgsTempoMap-struct
+ * @x: the x offset
+ *
+ * Find the first entry at or after @x by binary search.
+ *
+ * Returns: the index of the entry or the length of @tempo_map if none
+ *
+ * Since: 9.1.0
+ */
+guint
+ags_tempo_map_find(AgsTempoMap *tempo_map,
+		   guint64 x)
+{
+  guint lower, upper;
+  guint middle;
+
+  g_return_val_if_fail(tempo_map != NULL, 0);
+
+  lower = 0;
+  upper = tempo_map->length;
+
+  while(lower < upper){
+    middle = lower + (upper - lower) / 2;
+
+    if(tempo_map->entry[middle].x < x){
+      lower = middle + 1;
+    }else{
+      upper = middle;
+    }
+  }
+
+  return(lower);
+}
+
+/**
+ * ags_tempo_map_seek:
+ * @tempo_map: the #AgsTempoMap-struct
+ * @x: the x offset
+ *
+ * Relocate the cursor of @tempo_map to the first entry at or after @x.
+ *
+ * Since: 9.1.0
+ */
+void
+ags_tempo_map_seek(AgsTempoMap *tempo_map,
+		   guint64 x)
+{
+  g_return_if_fail(tempo_map != NULL);
+
+  tempo_map->cursor = ags_tempo_map_find(tempo_map,
+					 x);
+  tempo_map->position = x;
+}
+
+/**
+ * ags_tempo_map_next:
+ * @tempo_map: the #AgsTempoMap-struct
+ * @x: the x offset
+ * @x_end: the x end offset, exclusive
+ * @bpm: (out): return location of the BPM
+ *
+ * Advance the cursor of @tempo_map to the next entry within @x and
+ * @x_end. Call it repeatedly until it returns %FALSE to retrieve all
+ * tempo changes of the range. An entry is returned only once unless
+ * the position moves backward.
+ *
+ * Returns: %TRUE if a tempo change was found, otherwise %FALSE
+ *
+ * Since: 9.1.0
+ */
+gboolean
+ags_tempo_map_next(AgsTempoMap *tempo_map,
+		   guint64 x, guint64 x_end,
+		   gdouble *bpm)
+{
+  AgsTempoMapEntry *entry;
+
+  g_return_val_if_fail(tempo_map != NULL, FALSE);
+
+  /* relocate if moved backward or jumped past the next entry */
+  if(x < tempo_map->position ||
+     (tempo_map->cursor < tempo_map->length &&
+      tempo_map->entry[tempo_map->cursor].x < x)){
+    tempo_map->cursor = ags_tempo_map_find(tempo_map,
+					   x);
+  }
+
+  tempo_map->position = x;
+
+  if(tempo_map->cursor >= tempo_map->length){
+    return(FALSE);
+  }
+
+  entry = tempo_map->entry + tempo_map->cursor;
+
+  if(entry->x >= x_end){
+    return(FALSE);
+  }
+
+  if(bpm != NULL){
+    bpm[0] = entry->bpm;
+  }
+
+  tempo_map->cursor += 1;
+
+  return(TRUE);
+}
@@ -0,0 +1,95 @@
+/* GSequencer - Advanced GTK Sequencer
+ * Copyright (C) 2005-2026 Joël Krähemann
+ *
+ * This file is part of GSequencer.
+ *
+ * GSequencer is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GSequencer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GSequencer.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __AGS_TEMPO_MAP_H__
+#define __AGS_TEMPO_MAP_H__
+
+#include <glib.h>
+#include <glib-object.h>
+
+#include <ags/libags.h>
+
+#include <ags/audio/ags_program.h>
+
+G_BEGIN_DECLS
+
+#define AGS_TYPE_TEMPO_MAP         (ags_tempo_map_get_type())
+#define AGS_TEMPO_MAP(ptr) ((AgsTempoMap *)(ptr))
+#define AGS_TEMPO_MAP_ENTRY(ptr) ((AgsTempoMapEntry *)(ptr))
+
+typedef struct _AgsTempoMap AgsTempoMap;
+typedef struct _AgsTempoMapEntry AgsTempoMapEntry;
+
+/**
+ * AgsTempoMapEntry:
+ * @x: the marker's x offset
+ * @bpm: the BPM to apply at @x
+ *
+ * A tempo change of #AgsTempoMap.
+ */
+struct _AgsTempoMapEntry
+{
+  guint64 x;
+  gdouble bpm;
+};
+
+/**
+ * AgsTempoMap:
+ * @stamp: the modified stamp compiled of
+ * @length: the number of entries
+ * @entry: (array length=length): the #AgsTempoMapEntry-struct array sorted by x
+ * @cursor: the index of the next entry to apply
+ * @position: the x offset the cursor was advanced to
+ *
+ * The tempo #AgsProgram compiled to a sorted array of tempo changes.
+ */
+struct _AgsTempoMap
+{
+  guint stamp;
+
+  guint length;
+  AgsTempoMapEntry *entry;
+
+  guint cursor;
+  guint64 position;
+};
+
+GType ags_tempo_map_get_type(void);
+
+AgsTempoMap* ags_tempo_map_alloc();
+
+gpointer ags_tempo_map_copy(AgsTempoMap *ptr);
+void ags_tempo_map_free(AgsTempoMap *ptr);
+
+void ags_tempo_map_compile(AgsTempoMap *tempo_map,
+			   GList *program,
+			   guint stamp);
+
+guint ags_tempo_map_find(AgsTempoMap *tempo_map,
+			 guint64 x);
+void ags_tempo_map_seek(AgsTempoMap *tempo_map,
+			guint64 x);
+
+gboolean ags_tempo_map_next(AgsTempoMap *tempo_map,
+			    guint64 x, guint64 x_end,
+			    gdouble *bpm);
+
+G_END_DECLS
+
+#endif /*__AGS_TEMPO_MAP_H__*/
@@ -0,0 +1,357 @@
+/* GSequencer - Advanced GTK Sequencer
+ * Copyright (C) 2005-2026 Joël Krähemann
+ *
+ * This file is part of GSequencer.
+ *
+ * GSequencer is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GSequencer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GSequencer.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <ags/audio/ags_timestamp_index.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * SECTION:ags_timestamp_index
+ * @short_description: Sorted timestamp index
+ * @title: AgsTimestampIndex
+ * @section_id:
+ * @include: ags/audio/ags_timestamp_index.h
+ *
+ * #AgsTimestampIndex caches the timestamp and line of every object of a
+ * timestamp sorted #GList-struct in an array. Looking up the object near a
+ * timestamp does a binary search instead of bisecting the list with
+ * g_list_nth().
+ *
+ * The owner of the list increments its revision as the list is modified,
+ * the index is rebuilt lazily.
+ */
+
+gint ags_timestamp_index_entry_sort_func(const void *a,
+					 const void *b);
+
+GType
+ags_timestamp_index_get_type(void)
+{
+  static gsize g_define_type_id__static = 0;
+
+  if(g_once_init_enter(&g_define_type_id__static)){
+    GType ags_type_timestamp_index = 0;
+
+    ags_type_timestamp_index =
+      g_boxed_type_register_static("AgsTimestampIndex",
+				   (GBoxedCopyFunc) ags_timestamp_index_copy,
+				   (GBoxedFreeFunc) ags_timestamp_index_free);
+
+    g_once_init_leave(&g_define_type_id__static, ags_type_timestamp_index);
+  }
+
+  return(g_define_type_id__static);
+}
+
+gint
+ags_timestamp_index_entry_sort_func(const void *a,
+				    const void *b)
+{
+  const AgsTimestampIndexEntry *a_entry, *b_entry;
+
+  a_entry = (const AgsTimestampIndexEntry *) a;
+  b_entry = (const AgsTimestampIndexEntry *) b;
+
+  if(a_entry->ags_offset != b_entry->ags_offset){
+    return((a_entry->ags_offset < b_entry->ags_offset) ? -1: 1);
+  }
+
+  if(a_entry->line != b_entry->line){
+    return((a_entry->line < b_entry->line) ? -1: 1);
+  }
+
+  return(0);
+}
+
+/**
+ * ags_timestamp_index_alloc:
+ *
+ * Allocate #AgsTimestampIndex-struct.
+ *
+ * Returns: a new #AgsTimestampIndex-struct
+ *
+ * Since: 9.1.0
+ */
+AgsTimestampIndex*
+ags_timestamp_index_alloc()
+{
+  AgsTimestampIndex *ptr;
+
+  ptr = (AgsTimestampIndex *) g_new(AgsTimestampIndex,
+				    1);
+
+  ptr->revision = 0;
+
+  ptr->length = 0;
+  ptr->allocated_length = 0;
+  ptr->entry = NULL;
+
+  return(ptr);
+}
+
+/**
+ * ags_timestamp_index_copy:
+ * @ptr: the original #AgsTimestampIndex-struct
+ *
+ * Create a copy of @ptr.
+ *
+ * Returns: a pointer of the new #AgsTimestampIndex-struct
+ *
+ * Since: 9.1.0
+ */
+gpointer
+ags_timestamp_index_copy(AgsTimestampIndex *ptr)
+{
+  AgsTimestampIndex *new_ptr;
+
+  g_return_val_if_fail(ptr != NULL, NULL);
+
+  new_ptr = (AgsTimestampIndex *) g_new(AgsTimestampIndex,
+					1);
+
+  memcpy(new_ptr, ptr, sizeof(AgsTimestampIndex));
+
+  new_ptr->allocated_length = ptr->length;
+  new_ptr->entry = NULL;
+
+  if(ptr->length > 0){
+    new_ptr->entry = (AgsTimestampIndexEntry *) g_memdup(ptr->entry,
+							  ptr->length * sizeof(AgsTimestampIndexEntry));
+  }
+
+  return(new_ptr);
+}
+
+/**
+ * ags_timestamp_index_free:
+ * @ptr: the #AgsTimestampIndex-struct
+ *
+ * Free the memory of @ptr.
+ *
+ * Since: 9.1.0
+ */
+void
+ags_timestamp_index_free(AgsTimestampIndex *ptr)
+{
+  g_return_if_fail(ptr != NULL);
+
+  g_free(ptr->entry);
+
+  g_free(ptr);
+}
+
+/**
+ * ags_timestamp_index_is_valid:
+ * @timestamp_index: the #AgsTimestampIndex-struct
+ * @revision: the revision of the list
+ *
+ * Check if @timestamp_index is up to date.
+ *
+ * Returns: %TRUE if valid, otherwise %FALSE
+ *
+ * Since: 9.1.0
+ */
+gboolean
+ags_timestamp_index_is_valid(AgsTimestampIndex *timestamp_index,
+			     guint revision)
+{
+  g_return_val_if_fail(timestamp_index != NULL, FALSE);
+
+  return((timestamp_index->revision == revision) ? TRUE: FALSE);
+}
+
+/**
+ * ags_timestamp_index_rebuild:
+ * @timestamp_index: the #AgsTimestampIndex-struct
+ * @list: (element-type GObject) (transfer none): the #GList-struct to index
+ * @line_property: (nullable): the property name of the line, e.g. "audio-channel", or %NULL
+ * @revision: the revision of @list
+ *
+ * Rebuild @timestamp_index of @list. Every object of @list has to provide
+ * a "timestamp" property. The objects are not referenced, so the owner of
+ * @list has to increment its revision before it releases any of them.
+ *
+ * Since: 9.1.0
+ */
+void
+ags_timestamp_index_rebuild(AgsTimestampIndex *timestamp_index,
+			    GList *list,
+			    gchar *line_property,
+			    guint revision)
+{
+  guint length;
+  guint i;
+  gboolean is_sorted;
+
+  g_return_if_fail(timestamp_index != NULL);
+
+  timestamp_index->revision = revision;
+
+  length = g_list_length(list);
+
+  if(timestamp_index->allocated_length < length){
+    timestamp_index->entry = (AgsTimestampIndexEntry *) g_realloc(timestamp_index->entry,
+								  length * sizeof(AgsTimestampIndexEntry));
+
+    timestamp_index->allocated_length = length;
+  }
+
+  timestamp_index->length = length;
+
+  is_sorted = TRUE;
+  
+  for(i = 0; list != NULL; i++){
+    AgsTimestampIndexEntry *entry;
+    AgsTimestamp *timestamp;
+
+    guint line;
+    
+    entry = &(timestamp_index->entry[i]);
+
+    entry->data = list->data;
+
+    timestamp = NULL;
+    line = 0;
+    
+    g_object_get(list->data,
+		 "timestamp", &timestamp,
+		 NULL);
+
+    if(line_property != NULL){
+      g_object_get(list->data,
+		   line_property, &line,
+		   NULL);
+    }
+
+    entry->ags_offset = 0;
+    entry->unix_time = 0;
+    
+    if(timestamp != NULL){
+      entry->ags_offset = ags_timestamp_get_ags_offset(timestamp);
+      entry->unix_time = (guint64) ags_timestamp_get_unix_time(timestamp);
+
+      g_object_unref(timestamp);
+    }else{
+      g_warning("inconsistent data");
+    }
+
+    entry->line = line;
+
+    if(i > 0 &&
+       ags_timestamp_index_entry_sort_func(&(timestamp_index->entry[i - 1]), entry) > 0){
+      is_sorted = FALSE;
+    }
+    
+    list = list->next;
+  }
+
+  if(!is_sorted){
+    qsort(timestamp_index->entry,
+	  length, sizeof(AgsTimestampIndexEntry),
+	  ags_timestamp_index_entry_sort_func);
+  }
+}
+
+/**
+ * ags_timestamp_index_find_near:
+ * @timestamp_index: the #AgsTimestampIndex-struct
+ * @line: the matching line
+ * @timestamp: the matching timestamp
+ * @offset_length: the AGS offset length covered by an object
+ * @duration: the unix time duration covered by an object
+ * @filter_func: (scope call) (nullable): additional criteria or %NULL
+ * @filter_data: (closure filter_func): the data passed to @filter_func
+ *
+ * Find the object of @line starting within @offset_length after @timestamp,
+ * the same as the bisecting find near timestamp functions of the list do.
+ * As @timestamp uses AGS offset, the first candidate is looked up by binary
+ * search, which costs O(log n). Unix time isn't sorted by, so it does a
+ * linear search.
+ *
+ * Returns: (transfer none): the matching #GObject or %NULL
+ *
+ * Since: 9.1.0
+ */
+GObject*
+ags_timestamp_index_find_near(AgsTimestampIndex *timestamp_index,
+			      guint line,
+			      AgsTimestamp *timestamp,
+			      guint64 offset_length,
+			      guint64 duration,
+			      AgsTimestampIndexFilterFunc filter_func,
+			      gpointer filter_data)
+{
+  AgsTimestampIndexEntry *entry;
+
+  guint64 x;
+  guint lower, upper, middle;
+  guint i;
+  
+  g_return_val_if_fail(timestamp_index != NULL, NULL);
+
+  if(ags_timestamp_test_flags(timestamp,
+			      AGS_TIMESTAMP_OFFSET)){
+    x = ags_timestamp_get_ags_offset(timestamp);
+
+    /* first entry not starting before x */
+    lower = 0;
+    upper = timestamp_index->length;
+
+    while(lower < upper){
+      middle = lower + (upper - lower) / 2;
+
+      if(timestamp_index->entry[middle].ags_offset < x){
+	lower = middle + 1;
+      }else{
+	upper = middle;
+      }
+    }
+
+    for(i = lower; i < timestamp_index->length; i++){
+      entry = &(timestamp_index->entry[i]);
+
+      if(entry->ags_offset >= x + offset_length){
+	break;
+      }
+
+      if(entry->line == line &&
+	 (filter_func == NULL || filter_func(entry->data, filter_data))){
+	return(entry->data);
+      }
+    }
+  }else if(ags_timestamp_test_flags(timestamp,
+				    AGS_TIMESTAMP_UNIX)){
+    x = (guint64) ags_timestamp_get_unix_time(timestamp);
+
+    for(i = 0; i < timestamp_index->length; i++){
+      entry = &(timestamp_index->entry[i]);
+
+      if(entry->unix_time >= x &&
+	 entry->unix_time < x + duration &&
+	 entry->line == line &&
+	 (filter_func == NULL || filter_func(entry->data, filter_data))){
+	return(entry->data);
+      }
+    }
+  }
+
+  return(NULL);
+}
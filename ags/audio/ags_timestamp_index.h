@@ -0,0 +1,116 @@
+/* GSequencer - Advanced GTK Sequencer
+ * Copyright (C) 2005-2026 Joël Krähemann
+ *
+ * This file is part of GSequencer.
+ *
+ * GSequencer is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GSequencer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GSequencer.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef __AGS_TIMESTAMP_INDEX_H__
+#define __AGS_TIMESTAMP_INDEX_H__
+
+#include <glib.h>
+#include <glib-object.h>
+
+#include <ags/libags.h>
+
+G_BEGIN_DECLS
+
+#define AGS_TYPE_TIMESTAMP_INDEX         (ags_timestamp_index_get_type())
+#define AGS_TIMESTAMP_INDEX(ptr) ((AgsTimestampIndex *)(ptr))
+#define AGS_TIMESTAMP_INDEX_ENTRY(ptr) ((AgsTimestampIndexEntry *)(ptr))
+
+typedef struct _AgsTimestampIndex AgsTimestampIndex;
+typedef struct _AgsTimestampIndexEntry AgsTimestampIndexEntry;
+
+/**
+ * AgsTimestampIndexFilterFunc:
+ * @data: the #GObject to filter
+ * @filter_data: the filter data
+ *
+ * Additional match criteria of ags_timestamp_index_find_near().
+ *
+ * Returns: %TRUE if @data matches, otherwise %FALSE
+ *
+ * Since: 9.1.0
+ */
+typedef gboolean (*AgsTimestampIndexFilterFunc)(GObject *data,
+						gpointer filter_data);
+
+/**
+ * AgsTimestampIndexEntry:
+ * @data: the indexed #GObject
+ * @ags_offset: the timestamp's AGS offset
+ * @unix_time: the timestamp's unix time
+ * @line: the line or audio channel
+ *
+ * An entry of #AgsTimestampIndex.
+ */
+struct _AgsTimestampIndexEntry
+{
+  GObject *data;
+
+  guint64 ags_offset;
+  guint64 unix_time;
+  
+  guint line;
+};
+
+/**
+ * AgsTimestampIndex:
+ * @revision: the revision of the indexed list
+ * @length: the number of entries
+ * @allocated_length: the allocated number of entries
+ * @entry: (array length=length): the entries sorted by AGS offset and line
+ *
+ * The #AgsTimestampIndex-struct is a sorted array of the timestamps of a
+ * #GList-struct containing #AgsNotation, #AgsWave, #AgsAutomation or any
+ * other #GObject having a timestamp property. It answers lookups by
+ * binary search.
+ */
+struct _AgsTimestampIndex
+{
+  guint revision;
+
+  guint length;
+  guint allocated_length;
+  AgsTimestampIndexEntry *entry;
+};
+
+GType ags_timestamp_index_get_type(void);
+
+AgsTimestampIndex* ags_timestamp_index_alloc();
+
+gpointer ags_timestamp_index_copy(AgsTimestampIndex *ptr);
+void ags_timestamp_index_free(AgsTimestampIndex *ptr);
+
+gboolean ags_timestamp_index_is_valid(AgsTimestampIndex *timestamp_index,
+				      guint revision);
+void ags_timestamp_index_rebuild(AgsTimestampIndex *timestamp_index,
+				 GList *list,
+				 gchar *line_property,
+				 guint revision);
+
+GObject* ags_timestamp_index_find_near(AgsTimestampIndex *timestamp_index,
+				       guint line,
+				       AgsTimestamp *timestamp,
+				       guint64 offset_length,
+				       guint64 duration,
+				       AgsTimestampIndexFilterFunc filter_func,
+				       gpointer filter_data);
+
+G_END_DECLS
+
+#endif /*__AGS_TIMESTAMP_INDEX_H__*/
@@ -21,6 +21,7 @@
 
 #include <ags/audio/ags_audio_buffer_util.h>
 #include <ags/audio/ags_vector_256_manager.h>
+#include <ags/audio/ags_scratch_arena.h>
 
 #if defined(AGS_OSX_ACCELERATE_BUILTIN_FUNCTIONS)
 #include <ags/audio/ags_vdsp_256_manager.h>
@@ -459,15 +460,15 @@ ags_volume_util_compute_s8(AgsVolumeUtil *volume_util)
   i_stop = volume_util->buffer_length - (volume_util->buffer_length % 8);
 
 #if defined(AGS_VECTOR_256_FUNCTIONS)
-  AgsVector256Manager *vector_256_manager = ags_vector_256_manager_get_instance();
+  AgsScratchArena *scratch_arena = ags_scratch_arena_get_thread_default();
   
   while(i + 256 <= i_stop){
     AgsVectorArr *vector_arr;
 
     guint j;
     
-    while((vector_arr = ags_vector_256_manager_try_acquire(vector_256_manager, AGS_VECTOR_256_DOUBLE)) == NULL){
-      g_thread_yield();
+    if((vector_arr = ags_scratch_arena_acquire(scratch_arena, AGS_VECTOR_256_DOUBLE)) == NULL){
+      break;
     }
 
     ags_audio_buffer_util_fill_v8double_from_s8(NULL,
@@ -484,8 +485,8 @@ ags_volume_util_compute_s8(AgsVolumeUtil *volume_util)
 					       vector_arr->vector.vec_double->mem_double, 1,
 					       256);
 
-    ags_vector_256_manager_release(vector_256_manager,
-				   vector_arr);
+    ags_scratch_arena_release(scratch_arena,
+			      vector_arr);
 
     destination += (256 * destination_stride);
     source += (256 * source_stride);
@@ -691,15 +692,15 @@ ags_volume_util_compute_s16(AgsVolumeUtil *volume_util)
   i_stop = volume_util->buffer_length - (volume_util->buffer_length % 8);
 
 #if defined(AGS_VECTOR_256_FUNCTIONS)
-  AgsVector256Manager *vector_256_manager = ags_vector_256_manager_get_instance();
+  AgsScratchArena *scratch_arena = ags_scratch_arena_get_thread_default();
   
   while(i + 256 <= i_stop){
     AgsVectorArr *vector_arr;
 
     guint j;
     
-    while((vector_arr = ags_vector_256_manager_try_acquire(vector_256_manager, AGS_VECTOR_256_DOUBLE)) == NULL){
-      g_thread_yield();
+    if((vector_arr = ags_scratch_arena_acquire(scratch_arena, AGS_VECTOR_256_DOUBLE)) == NULL){
+      break;
     }
 
     ags_audio_buffer_util_fill_v8double_from_s16(NULL,
@@ -716,8 +717,8 @@ ags_volume_util_compute_s16(AgsVolumeUtil *volume_util)
 						vector_arr->vector.vec_double->mem_double, 1,
 						256);
 
-    ags_vector_256_manager_release(vector_256_manager,
-				   vector_arr);
+    ags_scratch_arena_release(scratch_arena,
+			      vector_arr);
 
     destination += (256 * destination_stride);
     source += (256 * source_stride);
@@ -923,15 +924,15 @@ ags_volume_util_compute_s24(AgsVolumeUtil *volume_util)
   i_stop = volume_util->buffer_length - (volume_util->buffer_length % 8);
 
 #if defined(AGS_VECTOR_256_FUNCTIONS)
-  AgsVector256Manager *vector_256_manager = ags_vector_256_manager_get_instance();
+  AgsScratchArena *scratch_arena = ags_scratch_arena_get_thread_default();
   
   while(i + 256 <= i_stop){
     AgsVectorArr *vector_arr;
 
     guint j;
     
-    while((vector_arr = ags_vector_256_manager_try_acquire(vector_256_manager, AGS_VECTOR_256_DOUBLE)) == NULL){
-      g_thread_yield();
+    if((vector_arr = ags_scratch_arena_acquire(scratch_arena, AGS_VECTOR_256_DOUBLE)) == NULL){
+      break;
     }
 
     ags_audio_buffer_util_fill_v8double_from_s32(NULL,
@@ -948,8 +949,8 @@ ags_volume_util_compute_s24(AgsVolumeUtil *volume_util)
 						vector_arr->vector.vec_double->mem_double, 1,
 						256);
 
-    ags_vector_256_manager_release(vector_256_manager,
-				   vector_arr);
+    ags_scratch_arena_release(scratch_arena,
+			      vector_arr);
 
     destination += (256 * destination_stride);
     source += (256 * source_stride);
@@ -1155,15 +1156,15 @@ ags_volume_util_compute_s32(AgsVolumeUtil *volume_util)
   i_stop = volume_util->buffer_length - (volume_util->buffer_length % 8);
 
 #if defined(AGS_VECTOR_256_FUNCTIONS)
-  AgsVector256Manager *vector_256_manager = ags_vector_256_manager_get_instance();
+  AgsScratchArena *scratch_arena = ags_scratch_arena_get_thread_default();
   
   while(i + 256 <= i_stop){
     AgsVectorArr *vector_arr;
 
     guint j;
     
-    while((vector_arr = ags_vector_256_manager_try_acquire(vector_256_manager, AGS_VECTOR_256_DOUBLE)) == NULL){
-      g_thread_yield();
+    if((vector_arr = ags_scratch_arena_acquire(scratch_arena, AGS_VECTOR_256_DOUBLE)) == NULL){
+      break;
     }
 
     ags_audio_buffer_util_fill_v8double_from_s32(NULL,
@@ -1180,8 +1181,8 @@ ags_volume_util_compute_s32(AgsVolumeUtil *volume_util)
 						vector_arr->vector.vec_double->mem_double, 1,
 						256);
 
-    ags_vector_256_manager_release(vector_256_manager,
-				   vector_arr);
+    ags_scratch_arena_release(scratch_arena,
+			      vector_arr);
 
     destination += (256 * destination_stride);
     source += (256 * source_stride);
@@ -1387,7 +1388,7 @@ ags_volume_util_compute_s64(AgsVolumeUtil *volume_util)
   i_stop = volume_util->buffer_length - (volume_util->buffer_length % 8);
 
 #if defined(AGS_VECTOR_256_FUNCTIONS)
-  AgsVector256Manager *vector_256_manager = ags_vector_256_manager_get_instance();
+  AgsScratchArena *scratch_arena = ags_scratch_arena_get_thread_default();
 
   i_stop = volume_util->buffer_length - (volume_util->buffer_length % 8);
   
@@ -1396,8 +1397,8 @@ ags_volume_util_compute_s64(AgsVolumeUtil *volume_util)
 
     guint j;
     
-    while((vector_arr = ags_vector_256_manager_try_acquire(vector_256_manager, AGS_VECTOR_256_DOUBLE)) == NULL){
-      g_thread_yield();
+    if((vector_arr = ags_scratch_arena_acquire(scratch_arena, AGS_VECTOR_256_DOUBLE)) == NULL){
+      break;
     }
 
     ags_audio_buffer_util_fill_v8double_from_s64(NULL,
@@ -1414,8 +1415,8 @@ ags_volume_util_compute_s64(AgsVolumeUtil *volume_util)
 						vector_arr->vector.vec_double->mem_double, 1,
 						256);
 
-    ags_vector_256_manager_release(vector_256_manager,
-				   vector_arr);
+    ags_scratch_arena_release(scratch_arena,
+			      vector_arr);
 
     destination += (256 * destination_stride);
     source += (256 * source_stride);
@@ -1621,15 +1622,15 @@ ags_volume_util_compute_float(AgsVolumeUtil *volume_util)
   i_stop = volume_util->buffer_length - (volume_util->buffer_length % 8);
 
 #if defined(AGS_VECTOR_256_FUNCTIONS)
-  AgsVector256Manager *vector_256_manager = ags_vector_256_manager_get_instance();
+  AgsScratchArena *scratch_arena = ags_scratch_arena_get_thread_default();
 
   while(i + 256 <= i_stop){
     AgsVectorArr *vector_arr;
 
     guint j;
     
-    while((vector_arr = ags_vector_256_manager_try_acquire(vector_256_manager, AGS_VECTOR_256_DOUBLE)) == NULL){
-      g_thread_yield();
+    if((vector_arr = ags_scratch_arena_acquire(scratch_arena, AGS_VECTOR_256_DOUBLE)) == NULL){
+      break;
     }
 
     ags_audio_buffer_util_fill_v8double_from_float(NULL,
@@ -1646,8 +1647,8 @@ ags_volume_util_compute_float(AgsVolumeUtil *volume_util)
 						  vector_arr->vector.vec_double->mem_double, 1,
 						  256);
 
-    ags_vector_256_manager_release(vector_256_manager,
-				   vector_arr);
+    ags_scratch_arena_release(scratch_arena,
+			      vector_arr);
 
     destination += (256 * destination_stride);
     source += (256 * source_stride);
@@ -1853,15 +1854,15 @@ ags_volume_util_compute_double(AgsVolumeUtil *volume_util)
   i_stop = volume_util->buffer_length - (volume_util->buffer_length % 8);
 
 #if defined(AGS_VECTOR_256_FUNCTIONS)
-  AgsVector256Manager *vector_256_manager = ags_vector_256_manager_get_instance();
+  AgsScratchArena *scratch_arena = ags_scratch_arena_get_thread_default();
   
   while(i + 256 <= i_stop){
     AgsVectorArr *vector_arr;
 
     guint j;
     
-    while((vector_arr = ags_vector_256_manager_try_acquire(vector_256_manager, AGS_VECTOR_256_DOUBLE)) == NULL){
-      g_thread_yield();
+    if((vector_arr = ags_scratch_arena_acquire(scratch_arena, AGS_VECTOR_256_DOUBLE)) == NULL){
+      break;
     }
 
     ags_audio_buffer_util_fill_v8double(NULL,
@@ -1878,8 +1879,8 @@ ags_volume_util_compute_double(AgsVolumeUtil *volume_util)
 					 vector_arr->vector.vec_double->mem_double, 1,
 					 256);
 
-    ags_vector_256_manager_release(vector_256_manager,
-				   vector_arr);
+    ags_scratch_arena_release(scratch_arena,
+			      vector_arr);
 
     destination += (256 * destination_stride);
     source += (256 * source_stride);
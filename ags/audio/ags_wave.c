@@ -42,6 +42,15 @@ void ags_wave_get_property(GObject *gobject,
 void ags_wave_dispose(GObject *gobject);
 void ags_wave_finalize(GObject *gobject);
 
+gboolean ags_wave_attach_buffer_storage(AgsWave *wave,
+					AgsBuffer *buffer);
+void ags_wave_detach_buffer_storage(AgsWave *wave,
+				    AgsBuffer *buffer);
+
+void ags_wave_invalidate_buffer_peak(AgsWave *wave,
+				     AgsBuffer *buffer);
+gpointer ags_wave_refresh_peak_thread(gpointer data);
+
 guint64 ags_wave_get_position_for_offset(guint wave_samplerate,
 					 guint wave_buffer_size,
 					 guint64 x_offset,
@@ -340,6 +349,13 @@ ags_wave_init(AgsWave *wave)
   wave->selection = NULL;
 
   wave->clipboard_type = g_strdup(AGS_WAVE_CLIPBOARD_BASE64_TYPE);
+
+  wave->storage = NULL;
+  wave->buffer_slot = NULL;
+
+  wave->peak = NULL;
+  wave->peak_dirty = 0;
+  wave->peak_refresh = 0;
 }
 
 void
@@ -593,6 +609,24 @@ ags_wave_dispose(GObject *gobject)
     wave->timestamp = NULL;
   }
 
+  /* storage - the buffers keep their data */
+  if(wave->storage != NULL){
+    ags_wave_storage_unref(wave->storage);
+
+    wave->storage = NULL;
+  }
+
+  g_free(wave->buffer_slot);
+
+  wave->buffer_slot = NULL;
+
+  /* peak */
+  if(wave->peak != NULL){
+    ags_wave_peak_unref(wave->peak);
+
+    wave->peak = NULL;
+  }
+  
   /* buffer and selection */
   list = wave->buffer;
 
@@ -631,6 +665,18 @@ ags_wave_finalize(GObject *gobject)
     g_object_unref(wave->timestamp);
   }
     
+  /* storage */
+  if(wave->storage != NULL){
+    ags_wave_storage_unref(wave->storage);
+  }
+
+  g_free(wave->buffer_slot);
+
+  /* peak */
+  if(wave->peak != NULL){
+    ags_wave_peak_unref(wave->peak);
+  }
+  
   /* buffer and selection */
   g_list_free_full(wave->buffer,
 		   g_object_unref);
@@ -1239,6 +1285,7 @@ ags_wave_set_samplerate(AgsWave *wave,
   guint offset;
   guint copy_mode;
   guint i;    
+  gboolean use_storage, use_mmap;
 
   GRecMutex *wave_mutex;
 
@@ -1260,6 +1307,17 @@ ags_wave_set_samplerate(AgsWave *wave,
     return;
   }
 
+  /* the storage spans the buffers of the old samplerate */
+  g_rec_mutex_lock(wave_mutex);
+
+  use_storage = (wave->storage != NULL) ? TRUE: FALSE;
+  use_mmap = ags_wave_storage_test_flags(wave->storage,
+					 AGS_WAVE_STORAGE_MMAP);
+  
+  g_rec_mutex_unlock(wave_mutex);
+
+  ags_wave_disable_storage(wave);
+  
   /* apply samplerate */
   g_rec_mutex_lock(wave_mutex);
 
@@ -1503,6 +1561,15 @@ ags_wave_set_samplerate(AgsWave *wave,
   if(resampled_data != NULL){
     free(resampled_data);
   }
+
+  if(use_storage){
+    ags_wave_enable_storage(wave,
+			    use_mmap);
+  }
+
+  /* the data was converted */
+  ags_wave_invalidate_peak(wave,
+			   0, G_MAXUINT64);
 }
 
 /**
@@ -1558,6 +1625,7 @@ ags_wave_set_buffer_size(AgsWave *wave,
   guint word_size;
   guint copy_mode;
   guint i;
+  gboolean use_storage, use_mmap;
   
   GRecMutex *wave_mutex;
 
@@ -1577,6 +1645,17 @@ ags_wave_set_buffer_size(AgsWave *wave,
   if(buffer_size == old_buffer_size){
     return;
   }
+
+  /* the storage is laid out by buffer size */
+  g_rec_mutex_lock(wave_mutex);
+
+  use_storage = (wave->storage != NULL) ? TRUE: FALSE;
+  use_mmap = ags_wave_storage_test_flags(wave->storage,
+					 AGS_WAVE_STORAGE_MMAP);
+  
+  g_rec_mutex_unlock(wave_mutex);
+
+  ags_wave_disable_storage(wave);
   
   /* apply buffer size */
   g_rec_mutex_lock(wave_mutex);
@@ -1775,6 +1854,15 @@ ags_wave_set_buffer_size(AgsWave *wave,
   if(data != NULL){
     free(data);
   }
+
+  if(use_storage){
+    ags_wave_enable_storage(wave,
+			    use_mmap);
+  }
+
+  /* the data was converted */
+  ags_wave_invalidate_peak(wave,
+			   0, G_MAXUINT64);
 }
 
 /**
@@ -1818,6 +1906,8 @@ ags_wave_set_format(AgsWave *wave,
 {
   GList *list_start, *list;
 
+  gboolean use_storage, use_mmap;
+
   GRecMutex *wave_mutex;
 
   if(!AGS_IS_WAVE(wave)){
@@ -1835,6 +1925,13 @@ ags_wave_set_format(AgsWave *wave,
 
     return;
   }
+
+  /* the storage is laid out by word size */
+  use_storage = (wave->storage != NULL) ? TRUE: FALSE;
+  use_mmap = ags_wave_storage_test_flags(wave->storage,
+					 AGS_WAVE_STORAGE_MMAP);
+
+  ags_wave_disable_storage(wave);
   
   wave->format = format;
 
@@ -1851,6 +1948,15 @@ ags_wave_set_format(AgsWave *wave,
   }
 
   g_list_free(list_start);
+
+  if(use_storage){
+    ags_wave_enable_storage(wave,
+			    use_mmap);
+  }
+
+  /* the data was converted */
+  ags_wave_invalidate_peak(wave,
+			   0, G_MAXUINT64);
 }
 
 /**
@@ -1953,6 +2059,33 @@ ags_wave_set_buffer(AgsWave *wave, GList *buffer)
 
   start_buffer = wave->buffer;
   wave->buffer = buffer;
+
+  /* the whole wave */
+  ags_wave_invalidate_peak(wave,
+			   0, G_MAXUINT64);
+  
+  /* move to storage */
+  if(wave->storage != NULL){
+    GList *list;
+
+    list = start_buffer;
+
+    while(list != NULL){
+      ags_wave_detach_buffer_storage(wave,
+				     list->data);
+
+      list = list->next;
+    }
+
+    list = buffer;
+
+    while(list != NULL){
+      ags_wave_attach_buffer_storage(wave,
+				     list->data);
+
+      list = list->next;
+    }
+  }
   
   g_rec_mutex_unlock(wave_mutex);
 
@@ -2061,6 +2194,12 @@ ags_wave_add_buffer(AgsWave *wave,
       wave->buffer = g_list_insert_sorted(wave->buffer,
 					  buffer,
 					  (GCompareFunc) ags_buffer_sort_func);
+
+      ags_wave_attach_buffer_storage(wave,
+				     buffer);
+
+      ags_wave_invalidate_buffer_peak(wave,
+				      buffer);
     }
   }
   
@@ -2100,6 +2239,13 @@ ags_wave_remove_buffer(AgsWave *wave,
 		   buffer) != NULL){
       wave->buffer = g_list_remove(wave->buffer,
 				   buffer);
+
+      ags_wave_detach_buffer_storage(wave,
+				     buffer);
+
+      ags_wave_invalidate_buffer_peak(wave,
+				      buffer);
+      
       g_object_unref(buffer);
     }
   }else{
@@ -2114,6 +2260,623 @@ ags_wave_remove_buffer(AgsWave *wave,
   g_rec_mutex_unlock(wave_mutex);
 }
 
+gboolean
+ags_wave_attach_buffer_storage(AgsWave *wave,
+			       AgsBuffer *buffer)
+{
+  AgsWaveStorage *storage;
+  
+  guint64 x;
+  gint64 index;
+  guint buffer_size;
+  AgsSoundcardFormat format;
+  
+  GRecMutex *buffer_mutex;
+
+  /* the caller holds the wave mutex, it serializes the chunks of the storage */
+  storage = wave->storage;
+  
+  if(storage == NULL){
+    return(FALSE);
+  }
+
+  /* get buffer mutex */
+  buffer_mutex = AGS_BUFFER_GET_OBJ_MUTEX(buffer);
+
+  g_rec_mutex_lock(buffer_mutex);
+
+  x = buffer->x;
+
+  buffer_size = buffer->buffer_size;
+  format = buffer->format;
+
+  g_rec_mutex_unlock(buffer_mutex);
+
+  if(buffer_size != storage->buffer_size ||
+     format != storage->format){
+    return(FALSE);
+  }
+  
+  index = ags_wave_storage_get_index(storage,
+				     x);
+
+  if(index == -1 ||
+     wave->buffer_slot[index] != NULL){
+    return(FALSE);
+  }
+
+  ags_buffer_set_storage(buffer,
+			 storage,
+			 ags_wave_storage_get_data(storage,
+						   (guint) index));
+
+  if(ags_buffer_get_storage(buffer) != storage){
+    return(FALSE);
+  }
+  
+  wave->buffer_slot[index] = buffer;
+
+  return(TRUE);
+}
+
+void
+ags_wave_detach_buffer_storage(AgsWave *wave,
+			       AgsBuffer *buffer)
+{
+  AgsWaveStorage *storage;
+
+  guint64 x;
+  gint64 index;
+  guint i;
+  
+  storage = wave->storage;
+  
+  if(storage == NULL){
+    return;
+  }
+
+  /* clear the slot even if the buffer detached itself, e.g. as resized */
+  x = ags_buffer_get_x(buffer);
+
+  index = ags_wave_storage_get_index(storage,
+				     x);
+
+  if(index != -1 &&
+     wave->buffer_slot[index] == buffer){
+    wave->buffer_slot[index] = NULL;
+  }else{
+    /* x was modified since attached */
+    for(i = 0; i < storage->buffer_count; i++){
+      if(wave->buffer_slot[i] == buffer){
+	wave->buffer_slot[i] = NULL;
+
+	break;
+      }
+    }
+  }
+
+  /* copy out, the slot might be reused */
+  if(ags_buffer_get_storage(buffer) == storage){
+    ags_buffer_set_storage(buffer,
+			   NULL,
+			   NULL);
+  }
+}
+
+/**
+ * ags_wave_enable_storage:
+ * @wave: the #AgsWave
+ * @use_mmap: if %TRUE the samples are kept in a mapped temporary file
+ *
+ * Move the data of @wave's buffers to a #AgsWaveStorage-struct spanning
+ * the whole wave. The data of buffers added later is moved as long the
+ * buffer size and format match and it is aligned to the buffer size.
+ *
+ * Since: 9.1.0
+ */
+void
+ags_wave_enable_storage(AgsWave *wave,
+			gboolean use_mmap)
+{
+  AgsWaveStorage *storage;
+
+  GList *list;
+
+  guint64 x_offset;
+  guint buffer_count;
+  
+  GRecMutex *wave_mutex;
+
+  if(!AGS_IS_WAVE(wave)){
+    return;
+  }
+
+  /* get wave mutex */
+  wave_mutex = AGS_WAVE_GET_OBJ_MUTEX(wave);
+
+  g_rec_mutex_lock(wave_mutex);
+
+  if(wave->storage != NULL ||
+     wave->buffer_size == 0){
+    g_rec_mutex_unlock(wave_mutex);
+
+    return;
+  }
+
+  x_offset = ags_timestamp_get_ags_offset(wave->timestamp);
+
+  buffer_count = (guint) ceil(AGS_WAVE_DEFAULT_BUFFER_LENGTH * (gdouble) wave->samplerate / (gdouble) wave->buffer_size);
+
+  storage = ags_wave_storage_alloc(wave->format,
+				   wave->buffer_size,
+				   x_offset,
+				   buffer_count,
+				   use_mmap);
+
+  if(storage == NULL){
+    g_rec_mutex_unlock(wave_mutex);
+
+    return;
+  }
+  
+  wave->storage = storage;
+  wave->buffer_slot = (AgsBuffer **) g_new0(AgsBuffer *,
+					    buffer_count);
+
+  /* move data */
+  list = wave->buffer;
+
+  while(list != NULL){
+    ags_wave_attach_buffer_storage(wave,
+				   list->data);
+
+    list = list->next;
+  }
+  
+  g_rec_mutex_unlock(wave_mutex);
+}
+
+/**
+ * ags_wave_disable_storage:
+ * @wave: the #AgsWave
+ *
+ * Move the data of @wave's buffers out of the #AgsWaveStorage-struct.
+ *
+ * Since: 9.1.0
+ */
+void
+ags_wave_disable_storage(AgsWave *wave)
+{
+  GList *list;
+  
+  GRecMutex *wave_mutex;
+
+  if(!AGS_IS_WAVE(wave)){
+    return;
+  }
+
+  /* get wave mutex */
+  wave_mutex = AGS_WAVE_GET_OBJ_MUTEX(wave);
+
+  g_rec_mutex_lock(wave_mutex);
+
+  if(wave->storage == NULL){
+    g_rec_mutex_unlock(wave_mutex);
+
+    return;
+  }
+
+  list = wave->buffer;
+
+  while(list != NULL){
+    ags_wave_detach_buffer_storage(wave,
+				   list->data);
+
+    list = list->next;
+  }
+
+  ags_wave_storage_unref(wave->storage);
+
+  wave->storage = NULL;
+
+  g_free(wave->buffer_slot);
+
+  wave->buffer_slot = NULL;
+  
+  g_rec_mutex_unlock(wave_mutex);
+}
+
+void
+ags_wave_invalidate_buffer_peak(AgsWave *wave,
+				AgsBuffer *buffer)
+{
+  guint64 x;
+  guint buffer_size;
+  
+  GRecMutex *buffer_mutex;
+
+  /* get buffer mutex */
+  buffer_mutex = AGS_BUFFER_GET_OBJ_MUTEX(buffer);
+
+  g_rec_mutex_lock(buffer_mutex);
+
+  x = buffer->x;
+  buffer_size = buffer->buffer_size;
+  
+  g_rec_mutex_unlock(buffer_mutex);
+
+  ags_wave_invalidate_peak(wave,
+			   x,
+			   buffer_size);
+}
+
+gpointer
+ags_wave_refresh_peak_thread(gpointer data)
+{
+  AgsWave *wave;
+
+  wave = (AgsWave *) data;
+
+  ags_wave_refresh_peak(wave);
+
+  ags_atomic_int_set(&(wave->peak_refresh),
+		     0);
+  
+  g_object_unref(wave);
+
+  g_thread_exit(NULL);
+
+  return(NULL);
+}
+
+/**
+ * ags_wave_get_peak:
+ * @wave: the #AgsWave
+ *
+ * Get the #AgsWavePeak-struct of @wave. It is allocated by
+ * ags_wave_refresh_peak() and not modified after, so you might read it
+ * without locking.
+ *
+ * Returns: (transfer full): the #AgsWavePeak-struct or %NULL
+ *
+ * Since: 9.1.0
+ */
+AgsWavePeak*
+ags_wave_get_peak(AgsWave *wave)
+{
+  AgsWavePeak *peak;
+  
+  GRecMutex *wave_mutex;
+
+  if(!AGS_IS_WAVE(wave)){
+    return(NULL);
+  }
+
+  /* get wave mutex */
+  wave_mutex = AGS_WAVE_GET_OBJ_MUTEX(wave);
+
+  g_rec_mutex_lock(wave_mutex);
+
+  peak = wave->peak;
+
+  if(peak != NULL){
+    ags_wave_peak_ref(peak);
+  }
+  
+  g_rec_mutex_unlock(wave_mutex);
+
+  return(peak);
+}
+
+/**
+ * ags_wave_invalidate_peak:
+ * @wave: the #AgsWave
+ * @x: the offset
+ * @frame_count: the frames modified
+ *
+ * Mark @x and @frame_count to be rebuilt by the next
+ * ags_wave_refresh_peak(). Call it as you modify the data of a buffer,
+ * adding and removing buffers invalidates the peak itself.
+ *
+ * The dirty range is extended by atomic operations in units of
+ * %AGS_WAVE_PEAK_DIRTY_BIN_LENGTH frames, so it is safe to call from the
+ * audio thread.
+ *
+ * Since: 9.1.0
+ */
+void
+ags_wave_invalidate_peak(AgsWave *wave,
+			 guint64 x,
+			 guint64 frame_count)
+{
+  guint64 dirty, current_dirty;
+  guint64 bin0, bin1;
+  guint64 dirty_bin0, dirty_bin1;
+  
+  if(!AGS_IS_WAVE(wave) ||
+     frame_count == 0){
+    return;
+  }
+
+  bin0 = x / AGS_WAVE_PEAK_DIRTY_BIN_LENGTH;
+
+  if(bin0 >= G_MAXUINT32){
+    return;
+  }
+
+  if(frame_count > G_MAXUINT64 - x - AGS_WAVE_PEAK_DIRTY_BIN_LENGTH){
+    bin1 = G_MAXUINT32;
+  }else{
+    bin1 = (x + frame_count + AGS_WAVE_PEAK_DIRTY_BIN_LENGTH - 1) / AGS_WAVE_PEAK_DIRTY_BIN_LENGTH;
+  }
+
+  if(bin1 > G_MAXUINT32){
+    bin1 = G_MAXUINT32;
+  }
+  
+  /* extend, the upper 32 bits are the first bin and the lower the last */
+  do{
+    current_dirty = (guint64) ags_atomic_int64_get(&(wave->peak_dirty));
+
+    dirty_bin0 = current_dirty >> 32;
+    dirty_bin1 = current_dirty & G_MAXUINT32;
+
+    if(dirty_bin0 < dirty_bin1){
+      if(dirty_bin0 <= bin0 &&
+	 dirty_bin1 >= bin1){
+	return;
+      }
+      
+      if(dirty_bin0 < bin0){
+	bin0 = dirty_bin0;
+      }
+
+      if(dirty_bin1 > bin1){
+	bin1 = dirty_bin1;
+      }
+    }
+
+    dirty = (bin0 << 32) | bin1;
+  }while(!ags_atomic_int64_compare_and_exchange(&(wave->peak_dirty),
+						(gint64) current_dirty,
+						(gint64) dirty));
+}
+
+/**
+ * ags_wave_refresh_peak:
+ * @wave: the #AgsWave
+ *
+ * Rebuild the dirty range of @wave's #AgsWavePeak-struct of the buffers'
+ * data. A duplicate of the peak is rebuilt without holding the wave
+ * mutex and replaces the peak as done, it is allocated as needed and
+ * reallocated if the timestamp or samplerate was modified.
+ *
+ * It reads all buffers of the dirty range, don't call it from the audio
+ * thread or within drawing, see ags_wave_queue_refresh_peak().
+ *
+ * Since: 9.1.0
+ */
+void
+ags_wave_refresh_peak(AgsWave *wave)
+{
+  AgsWavePeak *current_peak, *peak;
+
+  GList *start_list, *list;
+
+  guint64 x_offset;
+  guint64 frame_count;
+  guint64 dirty;
+  guint64 x0, x1;
+  guint bin_length;
+  
+  GRecMutex *wave_mutex;
+
+  if(!AGS_IS_WAVE(wave)){
+    return;
+  }
+
+  /* get wave mutex */
+  wave_mutex = AGS_WAVE_GET_OBJ_MUTEX(wave);
+
+  /* take the dirty range, modifications from now on are seen by the next refresh */
+  dirty = (guint64) ags_atomic_int64_exchange(&(wave->peak_dirty),
+					      0);
+
+  g_rec_mutex_lock(wave_mutex);
+
+  x_offset = ags_timestamp_get_ags_offset(wave->timestamp);
+
+  frame_count = (guint64) ceil(AGS_WAVE_DEFAULT_BUFFER_LENGTH * (gdouble) wave->samplerate);
+
+  current_peak = wave->peak;
+
+  if(current_peak != NULL){
+    ags_wave_peak_ref(current_peak);
+  }
+
+  start_list = g_list_copy_deep(wave->buffer,
+				(GCopyFunc) g_object_ref,
+				NULL);
+  
+  g_rec_mutex_unlock(wave_mutex);
+
+  if(current_peak != NULL &&
+     current_peak->x_offset == x_offset &&
+     current_peak->frame_count == frame_count){
+    if((dirty >> 32) >= (dirty & G_MAXUINT32)){
+      ags_wave_peak_unref(current_peak);
+
+      g_list_free_full(start_list,
+		       (GDestroyNotify) g_object_unref);
+      
+      return;
+    }
+
+    peak = ags_wave_peak_duplicate(current_peak);
+
+    peak->dirty_x0 = x_offset;
+    peak->dirty_x1 = x_offset;
+    
+    ags_wave_peak_invalidate(peak,
+			     (dirty >> 32) * AGS_WAVE_PEAK_DIRTY_BIN_LENGTH,
+			     ((dirty & G_MAXUINT32) - (dirty >> 32)) * AGS_WAVE_PEAK_DIRTY_BIN_LENGTH);
+  }else{
+    /* the whole range is dirty */
+    peak = ags_wave_peak_alloc(x_offset,
+			       frame_count);
+  }
+
+  if(ags_wave_peak_is_dirty(peak)){
+    /* align to the coarsest bins, they are merged of the finest */
+    bin_length = peak->level[AGS_WAVE_PEAK_LEVEL_COUNT - 1].bin_length;
+  
+    x0 = x_offset + ((peak->dirty_x0 - x_offset) / bin_length) * bin_length;
+    x1 = x_offset + ((peak->dirty_x1 - x_offset + bin_length - 1) / bin_length) * bin_length;
+
+    ags_wave_peak_clear(peak,
+			x0, x1 - x0);
+
+    list = start_list;
+
+    while(list != NULL){
+      AgsBuffer *buffer;
+
+      guint64 x;
+      guint64 start, end;
+      guint buffer_size;
+      AgsSoundcardFormat format;
+    
+      GRecMutex *buffer_mutex;
+
+      buffer = AGS_BUFFER(list->data);
+    
+      /* get buffer mutex */
+      buffer_mutex = AGS_BUFFER_GET_OBJ_MUTEX(buffer);
+
+      g_rec_mutex_lock(buffer_mutex);
+
+      x = buffer->x;
+      buffer_size = buffer->buffer_size;
+      format = buffer->format;
+
+      if(x < x1 &&
+	 x + buffer_size > x0 &&
+	 buffer->data != NULL){
+	start = (x < x0) ? x0 - x: 0;
+	end = (x + buffer_size > x1) ? x1 - x: buffer_size;
+
+	ags_wave_peak_add_data(peak,
+			       x + start,
+			       ((guint8 *) buffer->data) + start * ags_wave_storage_get_word_size(format),
+			       (guint) (end - start),
+			       format);
+      }
+    
+      g_rec_mutex_unlock(buffer_mutex);
+    
+      list = list->next;
+    }
+
+    ags_wave_peak_propagate(peak,
+			    x0, x1 - x0);
+
+    /* clean */
+    peak->dirty_x0 = x_offset;
+    peak->dirty_x1 = x_offset;
+  }
+  
+  g_list_free_full(start_list,
+		   (GDestroyNotify) g_object_unref);
+
+  /* replace - a concurrent refresh won, let the next one rebuild our range */
+  g_rec_mutex_lock(wave_mutex);
+
+  if(wave->peak == current_peak){
+    wave->peak = peak;
+
+    peak = current_peak;
+  }else{
+    ags_wave_invalidate_peak(wave,
+			     (dirty >> 32) * AGS_WAVE_PEAK_DIRTY_BIN_LENGTH,
+			     ((dirty & G_MAXUINT32) - (dirty >> 32)) * AGS_WAVE_PEAK_DIRTY_BIN_LENGTH);
+  }
+  
+  g_rec_mutex_unlock(wave_mutex);
+
+  if(peak != NULL){
+    ags_wave_peak_unref(peak);
+  }
+
+  if(current_peak != NULL){
+    ags_wave_peak_unref(current_peak);
+  }
+}
+
+/**
+ * ags_wave_queue_refresh_peak:
+ * @wave: the #AgsWave
+ *
+ * Run ags_wave_refresh_peak() on a worker thread if @wave has no peak
+ * or a dirty range. At most one refresh per wave is in flight, drawing
+ * continues with the finished peak of ags_wave_get_peak() meanwhile.
+ *
+ * Returns: %TRUE if a refresh is in flight, else %FALSE
+ *
+ * Since: 9.1.0
+ */
+gboolean
+ags_wave_queue_refresh_peak(AgsWave *wave)
+{
+  GThread *thread;
+  
+  guint64 dirty;
+  gboolean do_refresh;
+  
+  GRecMutex *wave_mutex;
+
+  if(!AGS_IS_WAVE(wave)){
+    return(FALSE);
+  }
+
+  if(ags_atomic_int_get(&(wave->peak_refresh)) != 0){
+    return(TRUE);
+  }
+
+  /* get wave mutex */
+  wave_mutex = AGS_WAVE_GET_OBJ_MUTEX(wave);
+
+  dirty = (guint64) ags_atomic_int64_get(&(wave->peak_dirty));
+
+  do_refresh = ((dirty >> 32) < (dirty & G_MAXUINT32)) ? TRUE: FALSE;
+  
+  g_rec_mutex_lock(wave_mutex);
+
+  if(wave->peak == NULL ||
+     wave->peak->x_offset != ags_timestamp_get_ags_offset(wave->timestamp) ||
+     wave->peak->frame_count != (guint64) ceil(AGS_WAVE_DEFAULT_BUFFER_LENGTH * (gdouble) wave->samplerate)){
+    do_refresh = TRUE;
+  }
+  
+  g_rec_mutex_unlock(wave_mutex);
+
+  if(!do_refresh){
+    return(FALSE);
+  }
+  
+  if(!ags_atomic_int_compare_and_exchange(&(wave->peak_refresh),
+					  0,
+					  1)){
+    return(TRUE);
+  }
+
+  thread = g_thread_new("Advanced Gtk+ Sequencer - wave peak",
+			ags_wave_refresh_peak_thread,
+			g_object_ref(wave));
+  g_thread_unref(thread);
+
+  return(TRUE);
+}
+
 /**
  * ags_wave_get_selection:
  * @wave: the #AgsWave
@@ -2253,6 +3016,25 @@ ags_wave_find_point(AgsWave *wave,
   g_rec_mutex_lock(wave_mutex);
 
   buffer_size = wave->buffer_size;
+
+  /* lookup slot of storage */
+  if(!use_selection_list &&
+     wave->storage != NULL &&
+     x >= wave->storage->x_offset){
+    guint64 index;
+
+    index = (x - wave->storage->x_offset) / wave->storage->buffer_size;
+
+    if(index < wave->storage->buffer_count &&
+       wave->buffer_slot[index] != NULL &&
+       ags_buffer_get_x(wave->buffer_slot[index]) == wave->storage->x_offset + index * wave->storage->buffer_size){
+      retval = wave->buffer_slot[index];
+
+      g_rec_mutex_unlock(wave_mutex);
+
+      return(retval);
+    }
+  }
   
   if(use_selection_list){
     buffer = wave->selection;
@@ -3218,6 +4000,13 @@ ags_wave_cut_selection(AgsWave *wave)
   while(selection != NULL){
     wave->buffer = g_list_remove(wave->buffer,
 				 selection->data);
+
+    ags_wave_detach_buffer_storage(wave,
+				   selection->data);
+
+    ags_wave_invalidate_buffer_peak(wave,
+				    selection->data);
+    
     g_object_unref(selection->data);
 
     selection = selection->next;
@@ -3622,6 +4411,13 @@ ags_wave_cut_selection_as_base64(AgsWave *wave)
   while(selection != NULL){
     wave->buffer = g_list_remove(wave->buffer,
 				 selection->data);
+
+    ags_wave_detach_buffer_storage(wave,
+				   selection->data);
+
+    ags_wave_invalidate_buffer_peak(wave,
+				    selection->data);
+    
     g_object_unref(selection->data);
     
     selection = selection->next;
@@ -4902,6 +5698,10 @@ ags_wave_insert_native_level_from_clipboard(AgsWave *wave,
 							       wave_buffer_size,
 							       wave_format,
 							       match_timestamp);
+
+    /* the data of existing buffers might be modified */
+    ags_wave_invalidate_peak(wave,
+			     0, G_MAXUINT64);
   }  
 }
 
@@ -5672,6 +6472,10 @@ ags_wave_insert_base64_from_clipboard_extended(AgsWave *wave,
   }
 
   g_free(tmp_buffer);    
+
+  /* the data of existing buffers might be modified */
+  ags_wave_invalidate_peak(wave,
+			   0, G_MAXUINT64);
 }
 
 /**
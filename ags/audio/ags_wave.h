@@ -28,6 +28,8 @@
 #include <ags/libags.h>
 
 #include <ags/audio/ags_buffer.h>
+#include <ags/audio/ags_wave_storage.h>
+#include <ags/audio/ags_wave_peak.h>
 
 G_BEGIN_DECLS
 
@@ -47,6 +49,8 @@ G_BEGIN_DECLS
 
 #define AGS_WAVE_DEFAULT_BUFFER_LENGTH (64.0)
 
+#define AGS_WAVE_PEAK_DIRTY_BIN_LENGTH (AGS_WAVE_PEAK_DEFAULT_BIN_LENGTH * AGS_WAVE_PEAK_LEVEL_FACTOR * AGS_WAVE_PEAK_LEVEL_FACTOR)
+
 #define AGS_WAVE_DEFAULT_LENGTH ((60 * AGS_SOUNDCARD_DEFAULT_SAMPLERATE / AGS_WAVE_DEFAULT_BPM / 4) * 16 * 16 * 1200 / AGS_WAVE_TICS_PER_BEAT)
 #define AGS_WAVE_DEFAULT_JIFFIE (60.0 / AGS_WAVE_DEFAULT_BPM / AGS_WAVE_TICS_PER_BEAT)
 #define AGS_WAVE_DEFAULT_DURATION (AGS_WAVE_DEFAULT_LENGTH * AGS_WAVE_DEFAULT_JIFFIE * AGS_USEC_PER_SEC)
@@ -98,6 +102,13 @@ struct _AgsWave
   GList *selection;
 
   gchar *clipboard_type;
+
+  AgsWaveStorage *storage;
+  AgsBuffer **buffer_slot;
+
+  AgsWavePeak *peak;
+  guint64 peak_dirty;
+  volatile gint peak_refresh;
 };
 
 struct _AgsWaveClass
@@ -158,6 +169,17 @@ void ags_wave_remove_buffer(AgsWave *wave,
 			    AgsBuffer *buffer,
 			    gboolean use_selection_list);
 
+void ags_wave_enable_storage(AgsWave *wave,
+			     gboolean use_mmap);
+void ags_wave_disable_storage(AgsWave *wave);
+
+AgsWavePeak* ags_wave_get_peak(AgsWave *wave);
+void ags_wave_invalidate_peak(AgsWave *wave,
+			      guint64 x,
+			      guint64 frame_count);
+void ags_wave_refresh_peak(AgsWave *wave);
+gboolean ags_wave_queue_refresh_peak(AgsWave *wave);
+
 GList* ags_wave_get_selection(AgsWave *wave);
 
 gboolean ags_wave_is_buffer_selected(AgsWave *wave, AgsBuffer *buffer);
@@ -0,0 +1,676 @@
+/* GSequencer - Advanced GTK Sequencer
+ * Copyright (C) 2005-2026 Joël Krähemann
+ *
+ * This file is part of GSequencer.
+ *
+ * GSequencer is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GSequencer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GSequencer.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <ags/audio/ags_wave_peak.h>
+
+#include <math.h>
+#include <string.h>
+
+/**
+ * SECTION:ags_wave_peak
+ * @short_description: Multi-resolution waveform peaks
+ * @title: AgsWavePeak
+ * @section_id:
+ * @include: ags/audio/ags_wave_peak.h
+ *
+ * #AgsWavePeak summarizes the samples of an #AgsWave in bins of
+ * %AGS_WAVE_PEAK_DEFAULT_BIN_LENGTH frames, every following level being
+ * %AGS_WAVE_PEAK_LEVEL_FACTOR times coarser. The wave editor queries the
+ * level matching the frames per pixel, so drawing doesn't depend on the
+ * number of samples visible.
+ *
+ * Modified ranges are marked by ags_wave_peak_invalidate() and rebuilt
+ * with ags_wave_peak_clear(), ags_wave_peak_add_data() and
+ * ags_wave_peak_propagate(). #AgsWave never modifies a peak it published,
+ * ags_wave_refresh_peak() rebuilds a duplicate and replaces it.
+ */
+
+gdouble ags_wave_peak_get_sample(gpointer data,
+				 guint i,
+				 AgsSoundcardFormat format);
+
+void ags_wave_peak_merge_bin(AgsWavePeakBin *destination,
+			     AgsWavePeakBin *source);
+
+GType
+ags_wave_peak_get_type(void)
+{
+  static gsize g_define_type_id__static = 0;
+
+  if(g_once_init_enter(&g_define_type_id__static)){
+    GType ags_type_wave_peak = 0;
+
+    ags_type_wave_peak =
+      g_boxed_type_register_static("AgsWavePeak",
+				   (GBoxedCopyFunc) ags_wave_peak_ref,
+				   (GBoxedFreeFunc) ags_wave_peak_unref);
+
+    g_once_init_leave(&g_define_type_id__static, ags_type_wave_peak);
+  }
+
+  return(g_define_type_id__static);
+}
+
+gdouble
+ags_wave_peak_get_sample(gpointer data,
+			 guint i,
+			 AgsSoundcardFormat format)
+{
+  gdouble value;
+
+  value = 0.0;
+  
+  switch(format){
+  case AGS_SOUNDCARD_SIGNED_8_BIT:
+    {
+      value = (gdouble) ((gint8 *) data)[i] / 127.0;
+    }
+    break;
+  case AGS_SOUNDCARD_SIGNED_16_BIT:
+    {
+      value = (gdouble) ((gint16 *) data)[i] / 32767.0;
+    }
+    break;
+  case AGS_SOUNDCARD_SIGNED_24_BIT:
+    {
+      value = (gdouble) ((gint32 *) data)[i] / 8388607.0;
+    }
+    break;
+  case AGS_SOUNDCARD_SIGNED_32_BIT:
+    {
+      value = (gdouble) ((gint32 *) data)[i] / 2147483647.0;
+    }
+    break;
+  case AGS_SOUNDCARD_SIGNED_64_BIT:
+    {
+      value = (gdouble) ((gint64 *) data)[i] / 9223372036854775807.0;
+    }
+    break;
+  case AGS_SOUNDCARD_FLOAT:
+    {
+      value = (gdouble) ((gfloat *) data)[i];
+    }
+    break;
+  case AGS_SOUNDCARD_DOUBLE:
+    {
+      value = ((gdouble *) data)[i];
+    }
+    break;
+  }
+
+  return(value);
+}
+
+void
+ags_wave_peak_merge_bin(AgsWavePeakBin *destination,
+			AgsWavePeakBin *source)
+{
+  if(source->frame_count == 0){
+    return;
+  }
+
+  if(destination->frame_count == 0){
+    destination->min = source->min;
+    destination->max = source->max;
+  }else{
+    if(source->min < destination->min){
+      destination->min = source->min;
+    }
+
+    if(source->max > destination->max){
+      destination->max = source->max;
+    }
+  }
+
+  destination->square_sum += source->square_sum;
+  destination->frame_count += source->frame_count;
+}
+
+/**
+ * ags_wave_peak_alloc:
+ * @x_offset: the offset of the first frame
+ * @frame_count: the frames to cover
+ *
+ * Allocate #AgsWavePeak-struct with a reference count of 1. The whole
+ * range is dirty.
+ *
+ * Returns: a new #AgsWavePeak-struct
+ *
+ * Since: 9.1.0
+ */
+AgsWavePeak*
+ags_wave_peak_alloc(guint64 x_offset,
+		    guint64 frame_count)
+{
+  AgsWavePeak *ptr;
+
+  guint bin_length;
+  guint i;
+  
+  ptr = (AgsWavePeak *) g_new(AgsWavePeak,
+			      1);
+
+  ptr->ref_count = 1;
+
+  ptr->x_offset = x_offset;
+  ptr->frame_count = frame_count;
+
+  bin_length = AGS_WAVE_PEAK_DEFAULT_BIN_LENGTH;
+  
+  for(i = 0; i < AGS_WAVE_PEAK_LEVEL_COUNT; i++){
+    ptr->level[i].bin_length = bin_length;
+
+    ptr->level[i].bin_count = (guint) ((frame_count + bin_length - 1) / bin_length);
+    ptr->level[i].bin = NULL;
+
+    if(ptr->level[i].bin_count > 0){
+      ptr->level[i].bin = (AgsWavePeakBin *) g_new0(AgsWavePeakBin,
+						    ptr->level[i].bin_count);
+    }
+    
+    bin_length *= AGS_WAVE_PEAK_LEVEL_FACTOR;
+  }
+
+  ptr->dirty_x0 = x_offset;
+  ptr->dirty_x1 = x_offset + frame_count;
+  
+  return(ptr);
+}
+
+/**
+ * ags_wave_peak_duplicate:
+ * @wave_peak: the #AgsWavePeak-struct
+ *
+ * Duplicate @wave_peak including its bins and dirty range, the
+ * duplicate has a reference count of 1.
+ *
+ * Returns: a new #AgsWavePeak-struct
+ *
+ * Since: 9.1.0
+ */
+AgsWavePeak*
+ags_wave_peak_duplicate(AgsWavePeak *wave_peak)
+{
+  AgsWavePeak *ptr;
+
+  guint i;
+  
+  g_return_val_if_fail(wave_peak != NULL, NULL);
+
+  ptr = (AgsWavePeak *) g_new(AgsWavePeak,
+			      1);
+
+  ptr->ref_count = 1;
+
+  ptr->x_offset = wave_peak->x_offset;
+  ptr->frame_count = wave_peak->frame_count;
+
+  for(i = 0; i < AGS_WAVE_PEAK_LEVEL_COUNT; i++){
+    ptr->level[i].bin_length = wave_peak->level[i].bin_length;
+    ptr->level[i].bin_count = wave_peak->level[i].bin_count;
+    ptr->level[i].bin = NULL;
+
+    if(wave_peak->level[i].bin_count > 0){
+      ptr->level[i].bin = (AgsWavePeakBin *) g_memdup(wave_peak->level[i].bin,
+						      wave_peak->level[i].bin_count * sizeof(AgsWavePeakBin));
+    }
+  }
+
+  ptr->dirty_x0 = wave_peak->dirty_x0;
+  ptr->dirty_x1 = wave_peak->dirty_x1;
+  
+  return(ptr);
+}
+
+/**
+ * ags_wave_peak_ref:
+ * @wave_peak: the #AgsWavePeak-struct
+ *
+ * Increase reference count of @wave_peak.
+ *
+ * Returns: @wave_peak
+ *
+ * Since: 9.1.0
+ */
+AgsWavePeak*
+ags_wave_peak_ref(AgsWavePeak *wave_peak)
+{
+  g_return_val_if_fail(wave_peak != NULL, NULL);
+
+  ags_atomic_int_increment(&(wave_peak->ref_count));
+
+  return(wave_peak);
+}
+
+/**
+ * ags_wave_peak_unref:
+ * @wave_peak: the #AgsWavePeak-struct
+ *
+ * Decrease reference count of @wave_peak and free it as the last
+ * reference is dropped.
+ *
+ * Since: 9.1.0
+ */
+void
+ags_wave_peak_unref(AgsWavePeak *wave_peak)
+{
+  guint i;
+
+  if(wave_peak == NULL){
+    return;
+  }
+
+  if(ags_atomic_int_decrement(&(wave_peak->ref_count)) != 1){
+    return;
+  }
+
+  for(i = 0; i < AGS_WAVE_PEAK_LEVEL_COUNT; i++){
+    g_free(wave_peak->level[i].bin);
+  }
+  
+  g_free(wave_peak);
+}
+
+/**
+ * ags_wave_peak_invalidate:
+ * @wave_peak: the #AgsWavePeak-struct
+ * @x: the offset
+ * @frame_count: the frames modified
+ *
+ * Extend the dirty range of @wave_peak by @x and @frame_count.
+ *
+ * Since: 9.1.0
+ */
+void
+ags_wave_peak_invalidate(AgsWavePeak *wave_peak,
+			 guint64 x,
+			 guint64 frame_count)
+{
+  guint64 x0, x1;
+  
+  if(wave_peak == NULL ||
+     frame_count == 0){
+    return;
+  }
+
+  /* clip */
+  x0 = x;
+  if(frame_count > G_MAXUINT64 - x){
+    x1 = G_MAXUINT64;
+  }else{
+    x1 = x + frame_count;
+  }
+  
+  if(x0 < wave_peak->x_offset){
+    x0 = wave_peak->x_offset;
+  }
+
+  if(x1 > wave_peak->x_offset + wave_peak->frame_count){
+    x1 = wave_peak->x_offset + wave_peak->frame_count;
+  }
+
+  if(x0 >= x1){
+    return;
+  }
+
+  /* extend */
+  if(wave_peak->dirty_x1 <= wave_peak->dirty_x0){
+    wave_peak->dirty_x0 = x0;
+    wave_peak->dirty_x1 = x1;
+  }else{
+    if(x0 < wave_peak->dirty_x0){
+      wave_peak->dirty_x0 = x0;
+    }
+
+    if(x1 > wave_peak->dirty_x1){
+      wave_peak->dirty_x1 = x1;
+    }
+  }
+}
+
+/**
+ * ags_wave_peak_is_dirty:
+ * @wave_peak: the #AgsWavePeak-struct
+ *
+ * Test if @wave_peak has a dirty range.
+ *
+ * Returns: %TRUE if dirty, else %FALSE
+ *
+ * Since: 9.1.0
+ */
+gboolean
+ags_wave_peak_is_dirty(AgsWavePeak *wave_peak)
+{
+  if(wave_peak == NULL){
+    return(FALSE);
+  }
+
+  return((wave_peak->dirty_x0 < wave_peak->dirty_x1) ? TRUE: FALSE);
+}
+
+/**
+ * ags_wave_peak_clear:
+ * @wave_peak: the #AgsWavePeak-struct
+ * @x: the offset
+ * @frame_count: the frames
+ *
+ * Reset the bins of the first level intersecting @x and @frame_count.
+ *
+ * Since: 9.1.0
+ */
+void
+ags_wave_peak_clear(AgsWavePeak *wave_peak,
+		    guint64 x,
+		    guint64 frame_count)
+{
+  AgsWavePeakLevel *level;
+
+  guint64 x0, x1;
+  guint i0, i1;
+  
+  if(wave_peak == NULL ||
+     frame_count == 0){
+    return;
+  }
+
+  level = &(wave_peak->level[0]);
+
+  x0 = x;
+  if(frame_count > G_MAXUINT64 - x){
+    x1 = G_MAXUINT64;
+  }else{
+    x1 = x + frame_count;
+  }
+  
+  if(x0 < wave_peak->x_offset){
+    x0 = wave_peak->x_offset;
+  }
+
+  if(x1 > wave_peak->x_offset + wave_peak->frame_count){
+    x1 = wave_peak->x_offset + wave_peak->frame_count;
+  }
+
+  if(x0 >= x1){
+    return;
+  }
+
+  i0 = (guint) ((x0 - wave_peak->x_offset) / level->bin_length);
+  i1 = (guint) ((x1 - wave_peak->x_offset + level->bin_length - 1) / level->bin_length);
+  
+  memset(level->bin + i0, 0, (i1 - i0) * sizeof(AgsWavePeakBin));
+}
+
+/**
+ * ags_wave_peak_add_data:
+ * @wave_peak: the #AgsWavePeak-struct
+ * @x: the offset of @data
+ * @data: the samples
+ * @frame_count: the frames of @data
+ * @format: the #AgsSoundcardFormat of @data
+ *
+ * Accumulate the samples of @data to the bins of the first level. Clear
+ * the bins before, ags_wave_peak_propagate() updates the coarser levels.
+ *
+ * Since: 9.1.0
+ */
+void
+ags_wave_peak_add_data(AgsWavePeak *wave_peak,
+		       guint64 x,
+		       gpointer data,
+		       guint frame_count,
+		       AgsSoundcardFormat format)
+{
+  AgsWavePeakLevel *level;
+
+  guint64 start, end;
+  guint64 i;
+  
+  if(wave_peak == NULL ||
+     data == NULL ||
+     frame_count == 0){
+    return;
+  }
+
+  level = &(wave_peak->level[0]);
+
+  /* clip */
+  start = 0;
+  end = frame_count;
+  
+  if(x < wave_peak->x_offset){
+    start = wave_peak->x_offset - x;
+  }
+
+  if(x + end > wave_peak->x_offset + wave_peak->frame_count){
+    if(wave_peak->x_offset + wave_peak->frame_count <= x){
+      return;
+    }
+    
+    end = wave_peak->x_offset + wave_peak->frame_count - x;
+  }
+
+  /* accumulate bin by bin */
+  for(i = start; i < end;){
+    AgsWavePeakBin *bin;
+
+    guint64 bin_index;
+    guint64 bin_end;
+    
+    bin_index = (x + i - wave_peak->x_offset) / level->bin_length;
+
+    bin_end = wave_peak->x_offset + (bin_index + 1) * level->bin_length - x;
+
+    if(bin_end > end){
+      bin_end = end;
+    }
+
+    bin = &(level->bin[bin_index]);
+    
+    for(; i < bin_end; i++){
+      gdouble value;
+
+      value = ags_wave_peak_get_sample(data,
+				       (guint) i,
+				       format);
+
+      if(bin->frame_count == 0){
+	bin->min = (gfloat) value;
+	bin->max = (gfloat) value;
+      }else{
+	if(value < bin->min){
+	  bin->min = (gfloat) value;
+	}
+
+	if(value > bin->max){
+	  bin->max = (gfloat) value;
+	}
+      }
+
+      bin->square_sum += (gfloat) (value * value);
+      bin->frame_count += 1;
+    }
+  }
+}
+
+/**
+ * ags_wave_peak_propagate:
+ * @wave_peak: the #AgsWavePeak-struct
+ * @x: the offset
+ * @frame_count: the frames
+ *
+ * Recompute the bins of the coarser levels intersecting @x and
+ * @frame_count of the first level.
+ *
+ * Since: 9.1.0
+ */
+void
+ags_wave_peak_propagate(AgsWavePeak *wave_peak,
+			guint64 x,
+			guint64 frame_count)
+{
+  guint64 x0, x1;
+  guint i, j, k;
+  
+  if(wave_peak == NULL ||
+     frame_count == 0){
+    return;
+  }
+
+  x0 = x;
+  if(frame_count > G_MAXUINT64 - x){
+    x1 = G_MAXUINT64;
+  }else{
+    x1 = x + frame_count;
+  }
+  
+  if(x0 < wave_peak->x_offset){
+    x0 = wave_peak->x_offset;
+  }
+
+  if(x1 > wave_peak->x_offset + wave_peak->frame_count){
+    x1 = wave_peak->x_offset + wave_peak->frame_count;
+  }
+
+  if(x0 >= x1){
+    return;
+  }
+  
+  for(i = 1; i < AGS_WAVE_PEAK_LEVEL_COUNT; i++){
+    AgsWavePeakLevel *level, *finer_level;
+
+    guint i0, i1;
+
+    level = &(wave_peak->level[i]);
+    finer_level = &(wave_peak->level[i - 1]);
+
+    i0 = (guint) ((x0 - wave_peak->x_offset) / level->bin_length);
+    i1 = (guint) ((x1 - wave_peak->x_offset + level->bin_length - 1) / level->bin_length);
+
+    for(j = i0; j < i1; j++){
+      AgsWavePeakBin *bin;
+
+      bin = &(level->bin[j]);
+
+      memset(bin, 0, sizeof(AgsWavePeakBin));
+      
+      for(k = j * AGS_WAVE_PEAK_LEVEL_FACTOR; k < (j + 1) * AGS_WAVE_PEAK_LEVEL_FACTOR && k < finer_level->bin_count; k++){
+	ags_wave_peak_merge_bin(bin,
+				&(finer_level->bin[k]));
+      }
+    }
+  }
+}
+
+/**
+ * ags_wave_peak_get_range:
+ * @wave_peak: the #AgsWavePeak-struct
+ * @x: the offset
+ * @frame_count: the frames
+ * @min: (out) (optional): return location of the minimum sample
+ * @max: (out) (optional): return location of the maximum sample
+ * @rms: (out) (optional): return location of the RMS
+ *
+ * Summarize @x and @frame_count using the coarsest level whose bins are
+ * not longer than @frame_count. The result is aligned to the bins of this
+ * level.
+ *
+ * Returns: %TRUE if any frame of the range is covered, else %FALSE
+ *
+ * Since: 9.1.0
+ */
+gboolean
+ags_wave_peak_get_range(AgsWavePeak *wave_peak,
+			guint64 x,
+			guint64 frame_count,
+			gdouble *min,
+			gdouble *max,
+			gdouble *rms)
+{
+  AgsWavePeakLevel *level;
+  AgsWavePeakBin range;
+
+  guint64 x0, x1;
+  guint i0, i1;
+  guint i;
+  
+  if(wave_peak == NULL ||
+     frame_count == 0){
+    return(FALSE);
+  }
+
+  x0 = x;
+  if(frame_count > G_MAXUINT64 - x){
+    x1 = G_MAXUINT64;
+  }else{
+    x1 = x + frame_count;
+  }
+  
+  if(x0 < wave_peak->x_offset){
+    x0 = wave_peak->x_offset;
+  }
+
+  if(x1 > wave_peak->x_offset + wave_peak->frame_count){
+    x1 = wave_peak->x_offset + wave_peak->frame_count;
+  }
+
+  if(x0 >= x1){
+    return(FALSE);
+  }
+
+  /* level */
+  level = &(wave_peak->level[0]);
+  
+  for(i = 1; i < AGS_WAVE_PEAK_LEVEL_COUNT; i++){
+    if(wave_peak->level[i].bin_length > frame_count){
+      break;
+    }
+
+    level = &(wave_peak->level[i]);
+  }
+
+  /* merge */
+  memset(&range, 0, sizeof(AgsWavePeakBin));
+  
+  i0 = (guint) ((x0 - wave_peak->x_offset) / level->bin_length);
+  i1 = (guint) ((x1 - wave_peak->x_offset + level->bin_length - 1) / level->bin_length);
+
+  for(i = i0; i < i1; i++){
+    ags_wave_peak_merge_bin(&range,
+			    &(level->bin[i]));
+  }
+
+  if(range.frame_count == 0){
+    return(FALSE);
+  }
+
+  if(min != NULL){
+    min[0] = (gdouble) range.min;
+  }
+
+  if(max != NULL){
+    max[0] = (gdouble) range.max;
+  }
+
+  if(rms != NULL){
+    rms[0] = sqrt((gdouble) range.square_sum / (gdouble) range.frame_count);
+  }
+  
+  return(TRUE);
+}
@@ -0,0 +1,139 @@
+/* GSequencer - Advanced GTK Sequencer
+ * Copyright (C) 2005-2026 Joël Krähemann
+ *
+ * This file is part of GSequencer.
+ *
+ * GSequencer is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GSequencer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GSequencer.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef __AGS_WAVE_PEAK_H__
+#define __AGS_WAVE_PEAK_H__
+
+#include <glib.h>
+#include <glib-object.h>
+
+#include <ags/libags.h>
+
+G_BEGIN_DECLS
+
+#define AGS_TYPE_WAVE_PEAK         (ags_wave_peak_get_type())
+#define AGS_WAVE_PEAK(ptr) ((AgsWavePeak *)(ptr))
+
+#define AGS_WAVE_PEAK_LEVEL_COUNT (3)
+#define AGS_WAVE_PEAK_LEVEL_FACTOR (8)
+#define AGS_WAVE_PEAK_DEFAULT_BIN_LENGTH (64)
+
+typedef struct _AgsWavePeak AgsWavePeak;
+typedef struct _AgsWavePeakLevel AgsWavePeakLevel;
+typedef struct _AgsWavePeakBin AgsWavePeakBin;
+
+/**
+ * AgsWavePeakBin:
+ * @min: the minimum sample
+ * @max: the maximum sample
+ * @square_sum: the sum of the squared samples
+ * @frame_count: the frames accumulated, 0 if no buffer covers the bin
+ *
+ * The #AgsWavePeakBin-struct summarizes the normalized samples of a bin.
+ */
+struct _AgsWavePeakBin
+{
+  gfloat min;
+  gfloat max;
+  gfloat square_sum;
+  guint frame_count;
+};
+
+/**
+ * AgsWavePeakLevel:
+ * @bin_length: the frames per bin
+ * @bin_count: the number of bins
+ * @bin: (array length=bin_count): the bins
+ *
+ * The #AgsWavePeakLevel-struct is a level of #AgsWavePeak-struct.
+ */
+struct _AgsWavePeakLevel
+{
+  guint bin_length;
+  
+  guint bin_count;
+  AgsWavePeakBin *bin;
+};
+
+/**
+ * AgsWavePeak:
+ * @ref_count: the reference count
+ * @x_offset: the offset of the first frame
+ * @frame_count: the frames covered
+ * @level: the levels, each %AGS_WAVE_PEAK_LEVEL_FACTOR times coarser than the previous
+ * @dirty_x0: the start of the range to be refreshed
+ * @dirty_x1: the end of the range to be refreshed, not greater than @dirty_x0 if clean
+ *
+ * The #AgsWavePeak-struct is a pyramid of min, max and RMS values of
+ * the samples of an #AgsWave.
+ */
+struct _AgsWavePeak
+{
+  volatile gint ref_count;
+
+  guint64 x_offset;
+  guint64 frame_count;
+
+  AgsWavePeakLevel level[AGS_WAVE_PEAK_LEVEL_COUNT];
+
+  guint64 dirty_x0;
+  guint64 dirty_x1;
+};
+
+GType ags_wave_peak_get_type(void);
+
+AgsWavePeak* ags_wave_peak_alloc(guint64 x_offset,
+				 guint64 frame_count);
+
+AgsWavePeak* ags_wave_peak_duplicate(AgsWavePeak *wave_peak);
+
+AgsWavePeak* ags_wave_peak_ref(AgsWavePeak *wave_peak);
+void ags_wave_peak_unref(AgsWavePeak *wave_peak);
+
+/* dirty */
+void ags_wave_peak_invalidate(AgsWavePeak *wave_peak,
+			      guint64 x,
+			      guint64 frame_count);
+gboolean ags_wave_peak_is_dirty(AgsWavePeak *wave_peak);
+
+/* build */
+void ags_wave_peak_clear(AgsWavePeak *wave_peak,
+			 guint64 x,
+			 guint64 frame_count);
+void ags_wave_peak_add_data(AgsWavePeak *wave_peak,
+			    guint64 x,
+			    gpointer data,
+			    guint frame_count,
+			    AgsSoundcardFormat format);
+void ags_wave_peak_propagate(AgsWavePeak *wave_peak,
+			     guint64 x,
+			     guint64 frame_count);
+
+/* query */
+gboolean ags_wave_peak_get_range(AgsWavePeak *wave_peak,
+				 guint64 x,
+				 guint64 frame_count,
+				 gdouble *min,
+				 gdouble *max,
+				 gdouble *rms);
+
+G_END_DECLS
+
+#endif /*__AGS_WAVE_PEAK_H__*/
@@ -0,0 +1,464 @@
+/* GSequencer - Advanced GTK Sequencer
+ * Copyright (C) 2005-2026 Joël Krähemann
+ *
+ * This file is part of GSequencer.
+ *
+ * GSequencer is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GSequencer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GSequencer.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <ags/audio/ags_wave_storage.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef AGS_W32API
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#endif
+
+/**
+ * SECTION:ags_wave_storage
+ * @short_description: Contiguous sample storage
+ * @title: AgsWaveStorage
+ * @section_id:
+ * @include: ags/audio/ags_wave_storage.h
+ *
+ * #AgsWaveStorage keeps the samples of the buffers of an #AgsWave in
+ * contiguous memory. The data of buffer @index is located at
+ * @index * @buffer_size frames, so looking up the buffer of an offset
+ * doesn't need to walk any list.
+ *
+ * Large storages are backed by a shared mapping of an unlinked temporary
+ * file, so the kernel may page out samples not played back. The file is
+ * created in the `wave-storage-path` of the `generic` config group, else in
+ * the gsequencer directory of g_get_user_cache_dir() rather than the system's
+ * temporary directory, which might be a size-limited tmpfs. Otherwise the
+ * storage is split into chunks allocated on the heap as the buffers are
+ * attached.
+ */
+
+gboolean ags_wave_storage_mmap(AgsWaveStorage *wave_storage);
+
+GType
+ags_wave_storage_get_type(void)
+{
+  static gsize g_define_type_id__static = 0;
+
+  if(g_once_init_enter(&g_define_type_id__static)){
+    GType ags_type_wave_storage = 0;
+
+    ags_type_wave_storage =
+      g_boxed_type_register_static("AgsWaveStorage",
+				   (GBoxedCopyFunc) ags_wave_storage_ref,
+				   (GBoxedFreeFunc) ags_wave_storage_unref);
+
+    g_once_init_leave(&g_define_type_id__static, ags_type_wave_storage);
+  }
+
+  return(g_define_type_id__static);
+}
+
+gboolean
+ags_wave_storage_mmap(AgsWaveStorage *wave_storage)
+{
+#ifndef AGS_W32API
+  AgsConfig *config;
+  
+  gchar *path;
+  gchar *filename;
+  gpointer mmap_data;
+  
+  gsize mmap_size;
+  gint fd;
+
+  mmap_size = (gsize) wave_storage->buffer_count * wave_storage->buffer_size * wave_storage->word_size;
+
+  if(mmap_size == 0){
+    return(FALSE);
+  }
+
+  config = ags_config_get_instance();
+
+  path = ags_config_get_value(config,
+			      AGS_CONFIG_GENERIC,
+			      "wave-storage-path");
+
+  if(path == NULL){
+    path = g_build_filename(g_get_user_cache_dir(),
+			    "gsequencer",
+			    "wave-storage",
+			    NULL);
+  }
+
+  if(g_mkdir_with_parents(path,
+			  0700) != 0){
+    g_warning("failed to create wave storage directory %s", path);
+    
+    g_free(path);
+
+    return(FALSE);
+  }
+  
+  filename = g_build_filename(path,
+			      "ags-wave-storage-XXXXXX",
+			      NULL);
+
+  g_free(path);
+  
+  fd = g_mkstemp_full(filename,
+		      O_RDWR,
+		      0600);
+
+  if(fd == -1){
+    g_warning("failed to create wave storage file %s", filename);
+
+    g_free(filename);
+
+    return(FALSE);
+  }
+
+  /* keep the descriptor only */
+  unlink(filename);
+
+  g_free(filename);
+
+  /* sparse until written */
+  if(ftruncate(fd, (off_t) mmap_size) != 0){
+    close(fd);
+
+    return(FALSE);
+  }
+
+  mmap_data = mmap(NULL, mmap_size,
+		   PROT_READ | PROT_WRITE, MAP_SHARED,
+		   fd, 0);
+
+  /* the mapping stays valid, don't hold a descriptor per storage */
+  close(fd);
+
+  if(mmap_data == MAP_FAILED){
+    return(FALSE);
+  }
+
+  wave_storage->flags |= AGS_WAVE_STORAGE_MMAP;
+  
+  wave_storage->mmap_data = mmap_data;
+  wave_storage->mmap_size = mmap_size;
+
+  return(TRUE);
+#else
+  return(FALSE);
+#endif
+}
+
+/**
+ * ags_wave_storage_alloc:
+ * @format: the #AgsSoundcardFormat
+ * @buffer_size: the buffer size
+ * @x_offset: the offset of the first buffer
+ * @buffer_count: the number of buffers
+ * @use_mmap: if %TRUE map a temporary file, fall back to the heap if it fails
+ *
+ * Allocate #AgsWaveStorage-struct with a reference count of 1.
+ *
+ * Returns: a new #AgsWaveStorage-struct or %NULL if @format is not supported
+ *
+ * Since: 9.1.0
+ */
+AgsWaveStorage*
+ags_wave_storage_alloc(AgsSoundcardFormat format,
+		       guint buffer_size,
+		       guint64 x_offset,
+		       guint buffer_count,
+		       gboolean use_mmap)
+{
+  AgsWaveStorage *ptr;
+
+  guint word_size;
+
+  word_size = ags_wave_storage_get_word_size(format);
+
+  if(word_size == 0 ||
+     buffer_size == 0){
+    return(NULL);
+  }
+  
+  ptr = (AgsWaveStorage *) g_new(AgsWaveStorage,
+				 1);
+
+  ptr->ref_count = 1;
+  
+  ptr->flags = 0;
+
+  ptr->format = format;
+  ptr->buffer_size = buffer_size;
+  ptr->word_size = word_size;
+
+  ptr->x_offset = x_offset;
+  ptr->buffer_count = buffer_count;
+
+  ptr->chunk_length = AGS_WAVE_STORAGE_DEFAULT_CHUNK_LENGTH;
+  ptr->chunk_count = 0;
+  ptr->chunk = NULL;
+
+  ptr->mmap_data = NULL;
+  ptr->mmap_size = 0;
+
+  if(use_mmap &&
+     ags_wave_storage_mmap(ptr)){
+    return(ptr);
+  }
+
+  ptr->chunk_count = (buffer_count + ptr->chunk_length - 1) / ptr->chunk_length;
+
+  if(ptr->chunk_count > 0){
+    ptr->chunk = (gpointer *) g_new0(gpointer,
+				     ptr->chunk_count);
+  }
+
+  return(ptr);
+}
+
+/**
+ * ags_wave_storage_ref:
+ * @wave_storage: the #AgsWaveStorage-struct
+ *
+ * Increase reference count of @wave_storage.
+ *
+ * Returns: @wave_storage
+ *
+ * Since: 9.1.0
+ */
+AgsWaveStorage*
+ags_wave_storage_ref(AgsWaveStorage *wave_storage)
+{
+  g_return_val_if_fail(wave_storage != NULL, NULL);
+
+  ags_atomic_int_increment(&(wave_storage->ref_count));
+
+  return(wave_storage);
+}
+
+/**
+ * ags_wave_storage_unref:
+ * @wave_storage: the #AgsWaveStorage-struct
+ *
+ * Decrease reference count of @wave_storage and free it as the last
+ * reference is dropped.
+ *
+ * Since: 9.1.0
+ */
+void
+ags_wave_storage_unref(AgsWaveStorage *wave_storage)
+{
+  guint i;
+
+  if(wave_storage == NULL){
+    return;
+  }
+
+  if(ags_atomic_int_decrement(&(wave_storage->ref_count)) != 1){
+    return;
+  }
+  
+#ifndef AGS_W32API
+  if(wave_storage->mmap_data != NULL){
+    munmap(wave_storage->mmap_data,
+	   wave_storage->mmap_size);
+  }
+#endif
+  
+  for(i = 0; i < wave_storage->chunk_count; i++){
+    g_free(wave_storage->chunk[i]);
+  }
+
+  g_free(wave_storage->chunk);
+  
+  g_free(wave_storage);
+}
+
+/**
+ * ags_wave_storage_test_flags:
+ * @wave_storage: the #AgsWaveStorage-struct
+ * @flags: the #AgsWaveStorageFlags
+ *
+ * Test @flags to be set on @wave_storage.
+ *
+ * Returns: %TRUE if flags are set, else %FALSE
+ *
+ * Since: 9.1.0
+ */
+gboolean
+ags_wave_storage_test_flags(AgsWaveStorage *wave_storage,
+			    AgsWaveStorageFlags flags)
+{
+  if(wave_storage == NULL){
+    return(FALSE);
+  }
+
+  return(((flags & (wave_storage->flags)) != 0) ? TRUE: FALSE);
+}
+
+/**
+ * ags_wave_storage_get_word_size:
+ * @format: the #AgsSoundcardFormat
+ *
+ * Get the physical size of a frame of @format.
+ *
+ * Returns: the word size or 0 if @format is not supported
+ *
+ * Since: 9.1.0
+ */
+guint
+ags_wave_storage_get_word_size(AgsSoundcardFormat format)
+{
+  guint word_size;
+
+  word_size = 0;
+  
+  switch(format){
+  case AGS_SOUNDCARD_SIGNED_8_BIT:
+    {
+      word_size = sizeof(gint8);
+    }
+    break;
+  case AGS_SOUNDCARD_SIGNED_16_BIT:
+    {
+      word_size = sizeof(gint16);
+    }
+    break;
+  case AGS_SOUNDCARD_SIGNED_24_BIT:
+    {
+      //NOTE:JK: The 24-bit linear samples use 32-bit physical space
+      word_size = sizeof(gint32);
+    }
+    break;
+  case AGS_SOUNDCARD_SIGNED_32_BIT:
+    {
+      word_size = sizeof(gint32);
+    }
+    break;
+  case AGS_SOUNDCARD_SIGNED_64_BIT:
+    {
+      word_size = sizeof(gint64);
+    }
+    break;
+  case AGS_SOUNDCARD_FLOAT:
+    {
+      word_size = sizeof(gfloat);
+    }
+    break;
+  case AGS_SOUNDCARD_DOUBLE:
+    {
+      word_size = sizeof(gdouble);
+    }
+    break;
+  case AGS_SOUNDCARD_COMPLEX:
+    {
+      word_size = sizeof(AgsComplex);
+    }
+    break;
+  }
+
+  return(word_size);
+}
+
+/**
+ * ags_wave_storage_get_index:
+ * @wave_storage: the #AgsWaveStorage-struct
+ * @x: the offset of a buffer
+ *
+ * Get the index of the buffer starting at @x.
+ *
+ * Returns: the index or -1 if @x is not aligned to the buffer size or out of range
+ *
+ * Since: 9.1.0
+ */
+gint64
+ags_wave_storage_get_index(AgsWaveStorage *wave_storage,
+			   guint64 x)
+{
+  guint64 index;
+
+  if(wave_storage == NULL ||
+     x < wave_storage->x_offset){
+    return(-1);
+  }
+
+  if((x - wave_storage->x_offset) % wave_storage->buffer_size != 0){
+    return(-1);
+  }
+
+  index = (x - wave_storage->x_offset) / wave_storage->buffer_size;
+
+  if(index >= wave_storage->buffer_count){
+    return(-1);
+  }
+  
+  return((gint64) index);
+}
+
+/**
+ * ags_wave_storage_get_data:
+ * @wave_storage: the #AgsWaveStorage-struct
+ * @index: the index of the buffer
+ *
+ * Get the data of buffer @index, heap chunks are allocated as needed and
+ * zeroed. Concurrent callers get the same chunk, the first allocation
+ * published wins.
+ *
+ * Returns: (transfer none): the data or %NULL if @index is out of range
+ *
+ * Since: 9.1.0
+ */
+gpointer
+ags_wave_storage_get_data(AgsWaveStorage *wave_storage,
+			  guint index)
+{
+  gpointer chunk;
+  
+  gsize stride;
+  guint i;
+  
+  if(wave_storage == NULL ||
+     index >= wave_storage->buffer_count){
+    return(NULL);
+  }
+
+  stride = (gsize) wave_storage->buffer_size * wave_storage->word_size;
+  
+  if(wave_storage->mmap_data != NULL){
+    return(((guint8 *) wave_storage->mmap_data) + (gsize) index * stride);
+  }
+
+  i = index / wave_storage->chunk_length;
+
+  chunk = ags_atomic_pointer_get(&(wave_storage->chunk[i]));
+  
+  if(chunk == NULL){
+    chunk = g_malloc0(wave_storage->chunk_length * stride);
+
+    if(!ags_atomic_pointer_compare_and_exchange(&(wave_storage->chunk[i]),
+						NULL, chunk)){
+      /* allocated by a concurrent caller */
+      g_free(chunk);
+      
+      chunk = ags_atomic_pointer_get(&(wave_storage->chunk[i]));
+    }
+  }
+
+  return(((guint8 *) chunk) + (gsize) (index % wave_storage->chunk_length) * stride);
+}
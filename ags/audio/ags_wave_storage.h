@@ -0,0 +1,113 @@
+/* GSequencer - Advanced GTK Sequencer
+ * Copyright (C) 2005-2026 Joël Krähemann
+ *
+ * This file is part of GSequencer.
+ *
+ * GSequencer is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GSequencer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GSequencer.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef __AGS_WAVE_STORAGE_H__
+#define __AGS_WAVE_STORAGE_H__
+
+#include <glib.h>
+#include <glib-object.h>
+
+#include <ags/libags.h>
+
+G_BEGIN_DECLS
+
+#define AGS_TYPE_WAVE_STORAGE         (ags_wave_storage_get_type())
+#define AGS_WAVE_STORAGE(ptr) ((AgsWaveStorage *)(ptr))
+
+#define AGS_WAVE_STORAGE_DEFAULT_CHUNK_LENGTH (64)
+#define AGS_WAVE_STORAGE_DEFAULT_MMAP_THRESHOLD (30 * AGS_SOUNDCARD_DEFAULT_SAMPLERATE)
+
+typedef struct _AgsWaveStorage AgsWaveStorage;
+
+/**
+ * AgsWaveStorageFlags:
+ * @AGS_WAVE_STORAGE_MMAP: the data is a shared mapping of an unlinked temporary file
+ * 
+ * Enum values to indicate internal state of #AgsWaveStorage by
+ * enable/disable as flags.
+ */
+typedef enum{
+  AGS_WAVE_STORAGE_MMAP    = 1,
+}AgsWaveStorageFlags;
+
+/**
+ * AgsWaveStorage:
+ * @ref_count: the reference count
+ * @flags: the #AgsWaveStorageFlags
+ * @format: the #AgsSoundcardFormat
+ * @buffer_size: the frames per buffer
+ * @word_size: the size of a frame
+ * @x_offset: the offset of the first buffer
+ * @buffer_count: the number of buffers
+ * @chunk_length: the buffers per chunk
+ * @chunk_count: the number of chunks
+ * @chunk: (array length=chunk_count): the chunks, allocated as needed
+ * @mmap_data: the mapped data
+ * @mmap_size: the size of @mmap_data
+ *
+ * The #AgsWaveStorage-struct keeps the samples of @buffer_count buffers of
+ * an #AgsWave in contiguous memory. It is either a single mapping of a
+ * temporary file or chunks of @chunk_length buffers on the heap.
+ */
+struct _AgsWaveStorage
+{
+  volatile gint ref_count;
+  
+  AgsWaveStorageFlags flags;
+
+  AgsSoundcardFormat format;
+  guint buffer_size;
+  guint word_size;
+
+  guint64 x_offset;
+  guint buffer_count;
+
+  guint chunk_length;
+  guint chunk_count;
+  gpointer *chunk;
+
+  gpointer mmap_data;
+  gsize mmap_size;
+};
+
+GType ags_wave_storage_get_type(void);
+
+AgsWaveStorage* ags_wave_storage_alloc(AgsSoundcardFormat format,
+				       guint buffer_size,
+				       guint64 x_offset,
+				       guint buffer_count,
+				       gboolean use_mmap);
+
+AgsWaveStorage* ags_wave_storage_ref(AgsWaveStorage *wave_storage);
+void ags_wave_storage_unref(AgsWaveStorage *wave_storage);
+
+gboolean ags_wave_storage_test_flags(AgsWaveStorage *wave_storage,
+				     AgsWaveStorageFlags flags);
+
+guint ags_wave_storage_get_word_size(AgsSoundcardFormat format);
+
+gint64 ags_wave_storage_get_index(AgsWaveStorage *wave_storage,
+				  guint64 x);
+gpointer ags_wave_storage_get_data(AgsWaveStorage *wave_storage,
+				   guint index);
+
+G_END_DECLS
+
+#endif /*__AGS_WAVE_STORAGE_H__*/
@@ -0,0 +1,1003 @@
+/* GSequencer - Advanced GTK Sequencer
+ * Copyright (C) 2005-2026 Joël Krähemann
+ *
+ * This file is part of GSequencer.
+ *
+ * GSequencer is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GSequencer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GSequencer.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <ags/audio/ags_wave_stream.h>
+
+#include <ags/audio/ags_wave_storage.h>
+
+#include <ags/audio/file/ags_sound_resource.h>
+
+#include <math.h>
+#include <string.h>
+
+#include <ags/i18n.h>
+
+void ags_wave_stream_class_init(AgsWaveStreamClass *wave_stream);
+void ags_wave_stream_init(AgsWaveStream *wave_stream);
+void ags_wave_stream_set_property(GObject *gobject,
+				  guint prop_id,
+				  const GValue *value,
+				  GParamSpec *param_spec);
+void ags_wave_stream_get_property(GObject *gobject,
+				  guint prop_id,
+				  GValue *value,
+				  GParamSpec *param_spec);
+void ags_wave_stream_dispose(GObject *gobject);
+void ags_wave_stream_finalize(GObject *gobject);
+
+void ags_wave_stream_alloc_channel(AgsWaveStream *wave_stream);
+
+void* ags_wave_stream_read_ahead_thread(void *ptr);
+
+/**
+ * SECTION:ags_wave_stream
+ * @short_description: stream wave from disk
+ * @title: AgsWaveStream
+ * @section_id:
+ * @include: ags/audio/ags_wave_stream.h
+ *
+ * The #AgsWaveStream plays a sound resource without decoding it to
+ * #AgsBuffer. A read-ahead thread decodes the periods following the
+ * playback position of every audio channel into an #AgsRingBuffer-struct,
+ * so the memory used is proportional to the read-ahead window rather than
+ * the length of the file.
+ *
+ * The consumer of an audio channel calls ags_wave_stream_read() with the
+ * frame offset it is going to play. It doesn't lock nor block, if the offset
+ * doesn't follow the period consumed last the ring is primed from the new
+ * offset by the read-ahead thread.
+ */
+
+enum{
+  PROP_0,
+  PROP_SOUND_RESOURCE,
+  PROP_X_OFFSET,
+  PROP_SAMPLERATE,
+  PROP_BUFFER_SIZE,
+  PROP_FORMAT,
+  PROP_READ_AHEAD,
+};
+
+static gpointer ags_wave_stream_parent_class = NULL;
+
+GType
+ags_wave_stream_get_type()
+{
+  static gsize g_define_type_id__static = 0;
+
+  if(g_once_init_enter(&g_define_type_id__static)){
+    GType ags_type_wave_stream = 0;
+
+    static const GTypeInfo ags_wave_stream_info = {
+      sizeof (AgsWaveStreamClass),
+      NULL, /* base_init */
+      NULL, /* base_finalize */
+      (GClassInitFunc) ags_wave_stream_class_init,
+      NULL, /* class_finalize */
+      NULL, /* class_data */
+      sizeof (AgsWaveStream),
+      0,    /* n_preallocs */
+      (GInstanceInitFunc) ags_wave_stream_init,
+    };
+
+    ags_type_wave_stream = g_type_register_static(G_TYPE_OBJECT,
+						  "AgsWaveStream",
+						  &ags_wave_stream_info,
+						  0);
+
+    g_once_init_leave(&g_define_type_id__static, ags_type_wave_stream);
+  }
+
+  return(g_define_type_id__static);
+}
+
+void
+ags_wave_stream_class_init(AgsWaveStreamClass *wave_stream)
+{
+  GObjectClass *gobject;
+
+  GParamSpec *param_spec;
+
+  ags_wave_stream_parent_class = g_type_class_peek_parent(wave_stream);
+
+  /* GObjectClass */
+  gobject = (GObjectClass *) wave_stream;
+
+  gobject->set_property = ags_wave_stream_set_property;
+  gobject->get_property = ags_wave_stream_get_property;
+
+  gobject->dispose = ags_wave_stream_dispose;
+  gobject->finalize = ags_wave_stream_finalize;
+
+  /* properties */
+  /**
+   * AgsWaveStream:sound-resource:
+   *
+   * The opened sound resource to decode.
+   *
+   * Since: 9.1.0
+   */
+  param_spec = g_param_spec_object("sound-resource",
+				   i18n_pspec("sound resource"),
+				   i18n_pspec("The sound resource"),
+				   G_TYPE_OBJECT,
+				   G_PARAM_READWRITE | G_PARAM_CONSTRUCT_ONLY);
+  g_object_class_install_property(gobject,
+				  PROP_SOUND_RESOURCE,
+				  param_spec);
+
+  /**
+   * AgsWaveStream:x-offset:
+   *
+   * The frame offset the stream starts at.
+   *
+   * Since: 9.1.0
+   */
+  param_spec = g_param_spec_uint64("x-offset",
+				   i18n_pspec("x offset"),
+				   i18n_pspec("The x offset"),
+				   0,
+				   G_MAXUINT64,
+				   0,
+				   G_PARAM_READABLE | G_PARAM_WRITABLE);
+  g_object_class_install_property(gobject,
+				  PROP_X_OFFSET,
+				  param_spec);
+
+  /**
+   * AgsWaveStream:samplerate:
+   *
+   * The samplerate.
+   *
+   * Since: 9.1.0
+   */
+  param_spec = g_param_spec_uint("samplerate",
+				 i18n_pspec("samplerate"),
+				 i18n_pspec("The samplerate"),
+				 0,
+				 G_MAXUINT32,
+				 AGS_SOUNDCARD_DEFAULT_SAMPLERATE,
+				 G_PARAM_READWRITE | G_PARAM_CONSTRUCT_ONLY);
+  g_object_class_install_property(gobject,
+				  PROP_SAMPLERATE,
+				  param_spec);
+
+  /**
+   * AgsWaveStream:buffer-size:
+   *
+   * The frames of a period.
+   *
+   * Since: 9.1.0
+   */
+  param_spec = g_param_spec_uint("buffer-size",
+				 i18n_pspec("buffer size"),
+				 i18n_pspec("The buffer size"),
+				 1,
+				 G_MAXUINT32,
+				 AGS_SOUNDCARD_DEFAULT_BUFFER_SIZE,
+				 G_PARAM_READWRITE | G_PARAM_CONSTRUCT_ONLY);
+  g_object_class_install_property(gobject,
+				  PROP_BUFFER_SIZE,
+				  param_spec);
+
+  /**
+   * AgsWaveStream:format:
+   *
+   * The format the periods are decoded to.
+   *
+   * Since: 9.1.0
+   */
+  param_spec = g_param_spec_uint("format",
+				 i18n_pspec("format"),
+				 i18n_pspec("The format"),
+				 0,
+				 G_MAXUINT32,
+				 AGS_SOUNDCARD_DEFAULT_FORMAT,
+				 G_PARAM_READWRITE | G_PARAM_CONSTRUCT_ONLY);
+  g_object_class_install_property(gobject,
+				  PROP_FORMAT,
+				  param_spec);
+
+  /**
+   * AgsWaveStream:read-ahead:
+   *
+   * The seconds decoded ahead of the playback position.
+   *
+   * Since: 9.1.0
+   */
+  param_spec = g_param_spec_double("read-ahead",
+				   i18n_pspec("read ahead"),
+				   i18n_pspec("The read ahead in seconds"),
+				   0.0,
+				   G_MAXDOUBLE,
+				   AGS_WAVE_STREAM_DEFAULT_READ_AHEAD,
+				   G_PARAM_READWRITE | G_PARAM_CONSTRUCT_ONLY);
+  g_object_class_install_property(gobject,
+				  PROP_READ_AHEAD,
+				  param_spec);
+}
+
+void
+ags_wave_stream_init(AgsWaveStream *wave_stream)
+{
+  wave_stream->flags = 0;
+
+  /* wave stream mutex */
+  g_rec_mutex_init(&(wave_stream->obj_mutex));
+
+  wave_stream->sound_resource = NULL;
+
+  wave_stream->x_offset = 0;
+  wave_stream->frame_count = 0;
+
+  wave_stream->audio_channels = 0;
+
+  wave_stream->samplerate = AGS_SOUNDCARD_DEFAULT_SAMPLERATE;
+  wave_stream->buffer_size = AGS_SOUNDCARD_DEFAULT_BUFFER_SIZE;
+  wave_stream->format = AGS_SOUNDCARD_DEFAULT_FORMAT;
+
+  wave_stream->read_ahead = AGS_WAVE_STREAM_DEFAULT_READ_AHEAD;
+  wave_stream->period_count = 0;
+
+  wave_stream->channel = NULL;
+
+  wave_stream->thread = NULL;
+}
+
+void
+ags_wave_stream_set_property(GObject *gobject,
+			     guint prop_id,
+			     const GValue *value,
+			     GParamSpec *param_spec)
+{
+  AgsWaveStream *wave_stream;
+
+  GRecMutex *wave_stream_mutex;
+
+  wave_stream = AGS_WAVE_STREAM(gobject);
+
+  /* get wave stream mutex */
+  wave_stream_mutex = AGS_WAVE_STREAM_GET_OBJ_MUTEX(wave_stream);
+
+  switch(prop_id){
+  case PROP_SOUND_RESOURCE:
+    {
+      GObject *sound_resource;
+
+      sound_resource = g_value_get_object(value);
+
+      if(sound_resource != NULL){
+	g_object_ref(sound_resource);
+      }
+      
+      wave_stream->sound_resource = sound_resource;
+    }
+    break;
+  case PROP_X_OFFSET:
+    {
+      g_rec_mutex_lock(wave_stream_mutex);
+
+      wave_stream->x_offset = g_value_get_uint64(value);
+
+      g_rec_mutex_unlock(wave_stream_mutex);
+    }
+    break;
+  case PROP_SAMPLERATE:
+    {
+      wave_stream->samplerate = g_value_get_uint(value);
+    }
+    break;
+  case PROP_BUFFER_SIZE:
+    {
+      wave_stream->buffer_size = g_value_get_uint(value);
+    }
+    break;
+  case PROP_FORMAT:
+    {
+      wave_stream->format = g_value_get_uint(value);
+    }
+    break;
+  case PROP_READ_AHEAD:
+    {
+      wave_stream->read_ahead = g_value_get_double(value);
+    }
+    break;
+  default:
+    G_OBJECT_WARN_INVALID_PROPERTY_ID(gobject, prop_id, param_spec);
+    break;
+  }
+}
+
+void
+ags_wave_stream_get_property(GObject *gobject,
+			     guint prop_id,
+			     GValue *value,
+			     GParamSpec *param_spec)
+{
+  AgsWaveStream *wave_stream;
+
+  GRecMutex *wave_stream_mutex;
+
+  wave_stream = AGS_WAVE_STREAM(gobject);
+
+  /* get wave stream mutex */
+  wave_stream_mutex = AGS_WAVE_STREAM_GET_OBJ_MUTEX(wave_stream);
+
+  switch(prop_id){
+  case PROP_SOUND_RESOURCE:
+    {
+      g_value_set_object(value, wave_stream->sound_resource);
+    }
+    break;
+  case PROP_X_OFFSET:
+    {
+      g_rec_mutex_lock(wave_stream_mutex);
+
+      g_value_set_uint64(value, wave_stream->x_offset);
+
+      g_rec_mutex_unlock(wave_stream_mutex);
+    }
+    break;
+  case PROP_SAMPLERATE:
+    {
+      g_value_set_uint(value, wave_stream->samplerate);
+    }
+    break;
+  case PROP_BUFFER_SIZE:
+    {
+      g_value_set_uint(value, wave_stream->buffer_size);
+    }
+    break;
+  case PROP_FORMAT:
+    {
+      g_value_set_uint(value, wave_stream->format);
+    }
+    break;
+  case PROP_READ_AHEAD:
+    {
+      g_value_set_double(value, wave_stream->read_ahead);
+    }
+    break;
+  default:
+    G_OBJECT_WARN_INVALID_PROPERTY_ID(gobject, prop_id, param_spec);
+    break;
+  }
+}
+
+void
+ags_wave_stream_dispose(GObject *gobject)
+{
+  AgsWaveStream *wave_stream;
+
+  wave_stream = AGS_WAVE_STREAM(gobject);
+
+  ags_wave_stream_stop(wave_stream);
+
+  /* call parent */
+  G_OBJECT_CLASS(ags_wave_stream_parent_class)->dispose(gobject);
+}
+
+void
+ags_wave_stream_finalize(GObject *gobject)
+{
+  AgsWaveStream *wave_stream;
+
+  guint i;
+
+  wave_stream = AGS_WAVE_STREAM(gobject);
+
+  ags_wave_stream_stop(wave_stream);
+
+  /* channel */
+  for(i = 0; i < wave_stream->audio_channels; i++){
+    ags_ring_buffer_free(wave_stream->channel[i].ring_buffer);
+
+    g_free(wave_stream->channel[i].last_data);
+  }
+
+  g_free(wave_stream->channel);
+
+  /* sound resource */
+  if(wave_stream->sound_resource != NULL){
+    g_object_unref(wave_stream->sound_resource);
+  }
+
+  /* call parent */
+  G_OBJECT_CLASS(ags_wave_stream_parent_class)->finalize(gobject);
+}
+
+void
+ags_wave_stream_alloc_channel(AgsWaveStream *wave_stream)
+{
+  gsize period_size;
+  guint audio_channels;
+  guint frame_count;
+  guint i;
+
+  audio_channels = 0;
+  frame_count = 0;
+  
+  if(AGS_IS_SOUND_RESOURCE(wave_stream->sound_resource)){
+    ags_sound_resource_get_presets(AGS_SOUND_RESOURCE(wave_stream->sound_resource),
+				   &audio_channels,
+				   NULL,
+				   NULL,
+				   NULL);
+
+    ags_sound_resource_info(AGS_SOUND_RESOURCE(wave_stream->sound_resource),
+			    &frame_count,
+			    NULL, NULL);
+  }
+
+  wave_stream->audio_channels = audio_channels;
+  wave_stream->frame_count = frame_count;
+
+  /* the read-ahead window */
+  wave_stream->period_count = (guint) ceil(wave_stream->read_ahead * (gdouble) wave_stream->samplerate / (gdouble) wave_stream->buffer_size);
+
+  if(wave_stream->period_count < 2){
+    wave_stream->period_count = 2;
+  }
+  
+  period_size = (gsize) wave_stream->buffer_size * ags_wave_storage_get_word_size(wave_stream->format);
+
+  wave_stream->channel = NULL;
+
+  if(audio_channels > 0){
+    wave_stream->channel = g_new0(AgsWaveStreamChannel,
+				  audio_channels);
+  }
+  
+  for(i = 0; i < audio_channels; i++){
+    wave_stream->channel[i].ring_buffer = ags_ring_buffer_alloc(wave_stream->period_count,
+								period_size);
+
+    wave_stream->channel[i].write_offset = 0;
+    wave_stream->channel[i].read_offset = 0;
+
+    wave_stream->channel[i].last_offset = 0;
+    wave_stream->channel[i].last_data = g_malloc0(period_size);
+    wave_stream->channel[i].has_last = FALSE;
+
+    wave_stream->channel[i].seek_offset = 0;
+    wave_stream->channel[i].seek_serial = 0;
+    wave_stream->channel[i].ack_serial = 0;
+  }
+}
+
+/**
+ * ags_wave_stream_get_obj_mutex:
+ * @wave_stream: the #AgsWaveStream
+ * 
+ * Get object mutex.
+ * 
+ * Returns: the #GRecMutex to lock @wave_stream
+ * 
+ * Since: 9.1.0
+ */
+GRecMutex*
+ags_wave_stream_get_obj_mutex(AgsWaveStream *wave_stream)
+{
+  if(!AGS_IS_WAVE_STREAM(wave_stream)){
+    return(NULL);
+  }
+
+  return(AGS_WAVE_STREAM_GET_OBJ_MUTEX(wave_stream));
+}
+
+/**
+ * ags_wave_stream_test_flags:
+ * @wave_stream: the #AgsWaveStream
+ * @flags: the flags
+ *
+ * Test @flags to be set on @wave_stream.
+ *
+ * Returns: %TRUE if flags are set, else %FALSE
+ *
+ * Since: 9.1.0
+ */
+gboolean
+ags_wave_stream_test_flags(AgsWaveStream *wave_stream, AgsWaveStreamFlags flags)
+{
+  gboolean retval;
+
+  if(!AGS_IS_WAVE_STREAM(wave_stream)){
+    return(FALSE);
+  }
+
+  retval = ((flags & (ags_atomic_uint_get(&(wave_stream->flags)))) != 0) ? TRUE: FALSE;
+
+  return(retval);
+}
+
+/**
+ * ags_wave_stream_set_flags:
+ * @wave_stream: the #AgsWaveStream
+ * @flags: the flags
+ *
+ * Set flags.
+ *
+ * Since: 9.1.0
+ */
+void
+ags_wave_stream_set_flags(AgsWaveStream *wave_stream, AgsWaveStreamFlags flags)
+{
+  if(!AGS_IS_WAVE_STREAM(wave_stream)){
+    return;
+  }
+
+  ags_atomic_uint_or(&(wave_stream->flags),
+		     flags);
+}
+
+/**
+ * ags_wave_stream_unset_flags:
+ * @wave_stream: the #AgsWaveStream
+ * @flags: the flags
+ *
+ * Unset flags.
+ *
+ * Since: 9.1.0
+ */
+void
+ags_wave_stream_unset_flags(AgsWaveStream *wave_stream, AgsWaveStreamFlags flags)
+{
+  if(!AGS_IS_WAVE_STREAM(wave_stream)){
+    return;
+  }
+
+  ags_atomic_uint_and(&(wave_stream->flags),
+		      (~flags));
+}
+
+/**
+ * ags_wave_stream_get_sound_resource:
+ * @wave_stream: the #AgsWaveStream
+ *
+ * Get sound resource.
+ *
+ * Returns: (transfer full): the sound resource
+ *
+ * Since: 9.1.0
+ */
+GObject*
+ags_wave_stream_get_sound_resource(AgsWaveStream *wave_stream)
+{
+  GObject *sound_resource;
+
+  if(!AGS_IS_WAVE_STREAM(wave_stream)){
+    return(NULL);
+  }
+
+  g_object_get(wave_stream,
+	       "sound-resource", &sound_resource,
+	       NULL);
+
+  return(sound_resource);
+}
+
+/**
+ * ags_wave_stream_get_x_offset:
+ * @wave_stream: the #AgsWaveStream
+ *
+ * Get x offset.
+ *
+ * Returns: the frame offset the stream starts at
+ *
+ * Since: 9.1.0
+ */
+guint64
+ags_wave_stream_get_x_offset(AgsWaveStream *wave_stream)
+{
+  guint64 x_offset;
+
+  if(!AGS_IS_WAVE_STREAM(wave_stream)){
+    return(0);
+  }
+
+  g_object_get(wave_stream,
+	       "x-offset", &x_offset,
+	       NULL);
+
+  return(x_offset);
+}
+
+/**
+ * ags_wave_stream_set_x_offset:
+ * @wave_stream: the #AgsWaveStream
+ * @x_offset: the frame offset
+ *
+ * Set x offset.
+ *
+ * Since: 9.1.0
+ */
+void
+ags_wave_stream_set_x_offset(AgsWaveStream *wave_stream,
+			     guint64 x_offset)
+{
+  if(!AGS_IS_WAVE_STREAM(wave_stream)){
+    return;
+  }
+
+  g_object_set(wave_stream,
+	       "x-offset", x_offset,
+	       NULL);
+}
+
+/**
+ * ags_wave_stream_get_frame_count:
+ * @wave_stream: the #AgsWaveStream
+ *
+ * Get frame count.
+ *
+ * Returns: the frames of the sound resource
+ *
+ * Since: 9.1.0
+ */
+guint64
+ags_wave_stream_get_frame_count(AgsWaveStream *wave_stream)
+{
+  if(!AGS_IS_WAVE_STREAM(wave_stream)){
+    return(0);
+  }
+
+  return(wave_stream->frame_count);
+}
+
+/**
+ * ags_wave_stream_get_audio_channels:
+ * @wave_stream: the #AgsWaveStream
+ *
+ * Get audio channels.
+ *
+ * Returns: the audio channels of the sound resource
+ *
+ * Since: 9.1.0
+ */
+guint
+ags_wave_stream_get_audio_channels(AgsWaveStream *wave_stream)
+{
+  if(!AGS_IS_WAVE_STREAM(wave_stream)){
+    return(0);
+  }
+
+  return(wave_stream->audio_channels);
+}
+
+/**
+ * ags_wave_stream_fill:
+ * @wave_stream: the #AgsWaveStream
+ *
+ * Prime the rings of seeking audio channels and decode up to
+ * %AGS_WAVE_STREAM_DEFAULT_FILL_COUNT periods per audio channel. Call it
+ * only from the read-ahead thread or as long it isn't running.
+ *
+ * Returns: %TRUE if any period was decoded, else %FALSE
+ *
+ * Since: 9.1.0
+ */
+gboolean
+ags_wave_stream_fill(AgsWaveStream *wave_stream)
+{
+  AgsSoundResource *sound_resource;
+  
+  gsize period_size;
+  guint seek_serial;
+  guint read_count;
+  guint i, j;
+  gboolean success;
+
+  if(!AGS_IS_WAVE_STREAM(wave_stream) ||
+     !AGS_IS_SOUND_RESOURCE(wave_stream->sound_resource)){
+    return(FALSE);
+  }
+
+  sound_resource = AGS_SOUND_RESOURCE(wave_stream->sound_resource);
+  
+  period_size = (gsize) wave_stream->buffer_size * ags_wave_storage_get_word_size(wave_stream->format);
+  
+  success = FALSE;
+  
+  for(i = 0; i < wave_stream->audio_channels; i++){
+    AgsWaveStreamChannel *channel;
+
+    channel = &(wave_stream->channel[i]);
+
+    /* prime from the requested offset - the consumer doesn't read until acknowledged */
+    seek_serial = ags_atomic_uint_get(&(channel->seek_serial));
+    
+    if(seek_serial != ags_atomic_uint_get(&(channel->ack_serial))){
+      ags_ring_buffer_reset(channel->ring_buffer);
+
+      channel->write_offset = (guint64) ags_atomic_int64_get(&(channel->seek_offset));
+
+      ags_atomic_uint_set(&(channel->ack_serial),
+			  seek_serial);
+    }
+
+    /* decode */
+    for(j = 0; j < AGS_WAVE_STREAM_DEFAULT_FILL_COUNT && channel->write_offset < wave_stream->frame_count; j++){
+      gpointer period;
+
+      period = ags_ring_buffer_get_write_period(channel->ring_buffer);
+
+      if(period == NULL){
+	break;
+      }
+
+      ags_sound_resource_seek(sound_resource,
+			      (gint64) channel->write_offset, G_SEEK_SET);
+      
+      read_count = ags_sound_resource_read(sound_resource,
+					   period, 1,
+					   i,
+					   wave_stream->buffer_size, wave_stream->format);
+
+      if(read_count < wave_stream->buffer_size){
+	memset(((guint8 *) period) + (gsize) read_count * ags_wave_storage_get_word_size(wave_stream->format), 0,
+	       period_size - (gsize) read_count * ags_wave_storage_get_word_size(wave_stream->format));
+      }
+      
+      ags_ring_buffer_commit_write(channel->ring_buffer);
+
+      channel->write_offset += wave_stream->buffer_size;
+
+      success = TRUE;
+    }
+  }
+
+  return(success);
+}
+
+void*
+ags_wave_stream_read_ahead_thread(void *ptr)
+{
+  AgsWaveStream *wave_stream;
+
+  GMutex wakeup_mutex;
+  GCond wakeup_cond;
+
+  wave_stream = AGS_WAVE_STREAM(ptr);
+
+  g_mutex_init(&wakeup_mutex);
+  g_cond_init(&wakeup_cond);
+
+  while(ags_wave_stream_test_flags(wave_stream, AGS_WAVE_STREAM_RUNNING)){
+    if(ags_wave_stream_fill(wave_stream)){
+      continue;
+    }
+
+    /* the consumer doesn't signal, poll */
+    g_mutex_lock(&wakeup_mutex);
+
+    g_cond_wait_until(&wakeup_cond,
+		      &wakeup_mutex,
+		      g_get_monotonic_time() + AGS_WAVE_STREAM_DEFAULT_POLL_INTERVAL);
+    
+    g_mutex_unlock(&wakeup_mutex);
+  }
+
+  g_mutex_clear(&wakeup_mutex);
+  g_cond_clear(&wakeup_cond);
+  
+  g_thread_exit(NULL);
+
+  return(NULL);
+}
+
+/**
+ * ags_wave_stream_start:
+ * @wave_stream: the #AgsWaveStream
+ *
+ * Start the read-ahead thread.
+ *
+ * Since: 9.1.0
+ */
+void
+ags_wave_stream_start(AgsWaveStream *wave_stream)
+{
+  if(!AGS_IS_WAVE_STREAM(wave_stream) ||
+     ags_wave_stream_test_flags(wave_stream, AGS_WAVE_STREAM_RUNNING)){
+    return;
+  }
+
+  ags_wave_stream_set_flags(wave_stream,
+			    AGS_WAVE_STREAM_RUNNING);
+
+  wave_stream->thread = g_thread_new("Advanced Gtk+ Sequencer - wave stream read-ahead",
+				     ags_wave_stream_read_ahead_thread,
+				     wave_stream);
+}
+
+/**
+ * ags_wave_stream_stop:
+ * @wave_stream: the #AgsWaveStream
+ *
+ * Stop the read-ahead thread and wait for it to exit.
+ *
+ * Since: 9.1.0
+ */
+void
+ags_wave_stream_stop(AgsWaveStream *wave_stream)
+{
+  if(!AGS_IS_WAVE_STREAM(wave_stream) ||
+     wave_stream->thread == NULL){
+    return;
+  }
+
+  ags_wave_stream_unset_flags(wave_stream,
+			      AGS_WAVE_STREAM_RUNNING);
+
+  g_thread_join(wave_stream->thread);
+
+  wave_stream->thread = NULL;
+}
+
+/**
+ * ags_wave_stream_seek:
+ * @wave_stream: the #AgsWaveStream
+ * @audio_channel: the audio channel
+ * @frame_offset: the frame offset relative to the start of the stream
+ *
+ * Request the ring of @audio_channel to be primed from @frame_offset.
+ * ags_wave_stream_read() fails until the read-ahead thread did so. Call it
+ * only from the consumer of @audio_channel.
+ *
+ * Since: 9.1.0
+ */
+void
+ags_wave_stream_seek(AgsWaveStream *wave_stream,
+		     guint audio_channel,
+		     guint64 frame_offset)
+{
+  AgsWaveStreamChannel *channel;
+  
+  if(!AGS_IS_WAVE_STREAM(wave_stream) ||
+     audio_channel >= wave_stream->audio_channels){
+    return;
+  }
+
+  channel = &(wave_stream->channel[audio_channel]);
+
+  channel->read_offset = frame_offset;
+  channel->has_last = FALSE;
+
+  ags_atomic_int64_set(&(channel->seek_offset),
+		       (gint64) frame_offset);
+  ags_atomic_uint_increment(&(channel->seek_serial));
+}
+
+/**
+ * ags_wave_stream_read:
+ * @wave_stream: the #AgsWaveStream
+ * @audio_channel: the audio channel
+ * @frame_offset: the frame offset relative to the start of the stream, aligned to buffer size
+ * @destination: the destination of buffer size frames
+ *
+ * Copy the period at @frame_offset of @audio_channel to @destination. The
+ * period consumed last might be read again. Any other offset not following
+ * it seeks. It neither locks nor blocks and is meant to be called of the
+ * audio thread consuming @audio_channel.
+ *
+ * Returns: %TRUE if @destination was filled, %FALSE on seek or underrun
+ *
+ * Since: 9.1.0
+ */
+gboolean
+ags_wave_stream_read(AgsWaveStream *wave_stream,
+		     guint audio_channel,
+		     guint64 frame_offset,
+		     gpointer destination)
+{
+  AgsWaveStreamChannel *channel;
+
+  gpointer period;
+
+  gsize period_size;
+  
+  if(!AGS_IS_WAVE_STREAM(wave_stream) ||
+     audio_channel >= wave_stream->audio_channels ||
+     frame_offset >= wave_stream->frame_count ||
+     destination == NULL){
+    return(FALSE);
+  }
+
+  channel = &(wave_stream->channel[audio_channel]);
+
+  period_size = (gsize) wave_stream->buffer_size * ags_wave_storage_get_word_size(wave_stream->format);
+  
+  /* seek pending */
+  if(ags_atomic_uint_get(&(channel->seek_serial)) != ags_atomic_uint_get(&(channel->ack_serial))){
+    return(FALSE);
+  }
+
+  /* read again */
+  if(channel->has_last &&
+     channel->last_offset == frame_offset){
+    memcpy(destination, channel->last_data, period_size);
+
+    return(TRUE);
+  }
+
+  /* not following */
+  if(channel->read_offset != frame_offset){
+    ags_wave_stream_seek(wave_stream,
+			 audio_channel,
+			 frame_offset);
+    
+    return(FALSE);
+  }
+
+  /* underrun */
+  period = ags_ring_buffer_get_read_period(channel->ring_buffer);
+
+  if(period == NULL){
+    return(FALSE);
+  }
+
+  memcpy(destination, period, period_size);
+  memcpy(channel->last_data, period, period_size);
+
+  ags_ring_buffer_commit_read(channel->ring_buffer);
+  
+  channel->last_offset = frame_offset;
+  channel->has_last = TRUE;
+  
+  channel->read_offset += wave_stream->buffer_size;
+
+  return(TRUE);
+}
+
+/**
+ * ags_wave_stream_new:
+ * @sound_resource: the opened #GObject implementing #AgsSoundResource
+ * @samplerate: the samplerate of @sound_resource
+ * @buffer_size: the frames of a period
+ * @format: the format to decode to
+ * @read_ahead: the seconds decoded ahead
+ *
+ * Creates a new instance of #AgsWaveStream. The read-ahead thread is
+ * started by ags_wave_stream_start().
+ *
+ * Returns: the new #AgsWaveStream
+ *
+ * Since: 9.1.0
+ */
+AgsWaveStream*
+ags_wave_stream_new(GObject *sound_resource,
+		    guint samplerate,
+		    guint buffer_size,
+		    AgsSoundcardFormat format,
+		    gdouble read_ahead)
+{
+  AgsWaveStream *wave_stream;
+
+  wave_stream = (AgsWaveStream *) g_object_new(AGS_TYPE_WAVE_STREAM,
+					       "sound-resource", sound_resource,
+					       "samplerate", samplerate,
+					       "buffer-size", buffer_size,
+					       "format", format,
+					       "read-ahead", read_ahead,
+					       NULL);
+
+  ags_wave_stream_alloc_channel(wave_stream);
+  
+  return(wave_stream);
+}
@@ -0,0 +1,165 @@
+/* GSequencer - Advanced GTK Sequencer
+ * Copyright (C) 2005-2026 Joël Krähemann
+ *
+ * This file is part of GSequencer.
+ *
+ * GSequencer is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GSequencer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GSequencer.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef __AGS_WAVE_STREAM_H__
+#define __AGS_WAVE_STREAM_H__
+
+#include <glib.h>
+#include <glib-object.h>
+
+#include <ags/libags.h>
+
+G_BEGIN_DECLS
+
+#define AGS_TYPE_WAVE_STREAM                (ags_wave_stream_get_type())
+#define AGS_WAVE_STREAM(obj)                (G_TYPE_CHECK_INSTANCE_CAST((obj), AGS_TYPE_WAVE_STREAM, AgsWaveStream))
+#define AGS_WAVE_STREAM_CLASS(class)        (G_TYPE_CHECK_CLASS_CAST((class), AGS_TYPE_WAVE_STREAM, AgsWaveStreamClass))
+#define AGS_IS_WAVE_STREAM(obj)             (G_TYPE_CHECK_INSTANCE_TYPE ((obj), AGS_TYPE_WAVE_STREAM))
+#define AGS_IS_WAVE_STREAM_CLASS(class)     (G_TYPE_CHECK_CLASS_TYPE ((class), AGS_TYPE_WAVE_STREAM))
+#define AGS_WAVE_STREAM_GET_CLASS(obj)      (G_TYPE_INSTANCE_GET_CLASS ((obj), AGS_TYPE_WAVE_STREAM, AgsWaveStreamClass))
+
+#define AGS_WAVE_STREAM_GET_OBJ_MUTEX(obj) (&(((AgsWaveStream *) obj)->obj_mutex))
+
+#define AGS_WAVE_STREAM_CHANNEL(ptr) ((AgsWaveStreamChannel *)(ptr))
+
+#define AGS_WAVE_STREAM_DEFAULT_READ_AHEAD (2.0)
+#define AGS_WAVE_STREAM_DEFAULT_FILL_COUNT (8)
+#define AGS_WAVE_STREAM_DEFAULT_POLL_INTERVAL (5 * G_TIME_SPAN_MILLISECOND)
+
+typedef struct _AgsWaveStream AgsWaveStream;
+typedef struct _AgsWaveStreamClass AgsWaveStreamClass;
+typedef struct _AgsWaveStreamChannel AgsWaveStreamChannel;
+
+/**
+ * AgsWaveStreamFlags:
+ * @AGS_WAVE_STREAM_RUNNING: the read-ahead thread is running
+ * 
+ * Enum values to indicate internal state of #AgsWaveStream by
+ * enable/disable as flags.
+ */
+typedef enum{
+  AGS_WAVE_STREAM_RUNNING        = 1,
+}AgsWaveStreamFlags;
+
+/**
+ * AgsWaveStreamChannel:
+ * @ring_buffer: the #AgsRingBuffer-struct of decoded periods
+ * @write_offset: the frame offset of the next period to decode, owned by the read-ahead thread
+ * @read_offset: the frame offset of the next period to consume, owned by the consumer
+ * @last_offset: the frame offset of @last_data, owned by the consumer
+ * @last_data: the period consumed last, owned by the consumer
+ * @has_last: if %TRUE @last_data is valid
+ * @seek_offset: the requested frame offset
+ * @seek_serial: incremented by the consumer as it requests a seek
+ * @ack_serial: set to @seek_serial by the read-ahead thread as the ring was primed
+ *
+ * The #AgsWaveStreamChannel-struct hands the periods of one audio channel
+ * from the read-ahead thread to a single consumer.
+ */
+struct _AgsWaveStreamChannel
+{
+  AgsRingBuffer *ring_buffer;
+
+  guint64 write_offset;
+  guint64 read_offset;
+
+  guint64 last_offset;
+  gpointer last_data;
+  gboolean has_last;
+  
+  volatile gint64 seek_offset;
+  volatile guint seek_serial;
+  volatile guint ack_serial;
+};
+
+struct _AgsWaveStream
+{
+  GObject gobject;
+
+  volatile guint flags;
+
+  GRecMutex obj_mutex;
+
+  GObject *sound_resource;
+
+  guint64 x_offset;
+  guint64 frame_count;
+  
+  guint audio_channels;
+  
+  guint samplerate;
+  guint buffer_size;
+  AgsSoundcardFormat format;
+
+  gdouble read_ahead;
+  guint period_count;
+  
+  AgsWaveStreamChannel *channel;
+
+  GThread *thread;
+};
+
+struct _AgsWaveStreamClass
+{
+  GObjectClass gobject;
+};
+
+GType ags_wave_stream_get_type();
+
+GRecMutex* ags_wave_stream_get_obj_mutex(AgsWaveStream *wave_stream);
+
+gboolean ags_wave_stream_test_flags(AgsWaveStream *wave_stream, AgsWaveStreamFlags flags);
+void ags_wave_stream_set_flags(AgsWaveStream *wave_stream, AgsWaveStreamFlags flags);
+void ags_wave_stream_unset_flags(AgsWaveStream *wave_stream, AgsWaveStreamFlags flags);
+
+GObject* ags_wave_stream_get_sound_resource(AgsWaveStream *wave_stream);
+
+guint64 ags_wave_stream_get_x_offset(AgsWaveStream *wave_stream);
+void ags_wave_stream_set_x_offset(AgsWaveStream *wave_stream,
+				  guint64 x_offset);
+
+guint64 ags_wave_stream_get_frame_count(AgsWaveStream *wave_stream);
+guint ags_wave_stream_get_audio_channels(AgsWaveStream *wave_stream);
+
+/* read-ahead */
+gboolean ags_wave_stream_fill(AgsWaveStream *wave_stream);
+
+void ags_wave_stream_start(AgsWaveStream *wave_stream);
+void ags_wave_stream_stop(AgsWaveStream *wave_stream);
+
+/* consumer */
+void ags_wave_stream_seek(AgsWaveStream *wave_stream,
+			  guint audio_channel,
+			  guint64 frame_offset);
+gboolean ags_wave_stream_read(AgsWaveStream *wave_stream,
+			      guint audio_channel,
+			      guint64 frame_offset,
+			      gpointer destination);
+
+/* instantiate */
+AgsWaveStream* ags_wave_stream_new(GObject *sound_resource,
+				   guint samplerate,
+				   guint buffer_size,
+				   AgsSoundcardFormat format,
+				   gdouble read_ahead);
+
+G_END_DECLS
+
+#endif /*__AGS_WAVE_STREAM_H__*/
@@ -99,6 +99,12 @@ void ags_alsa_devin_device_fill_backend_buffer(void *app_buffer,
 					       guint channels,
 					       guint buffer_size);
 
+void ags_alsa_devin_device_fill_mmap_area(void *app_buffer,
+					   guint word_size,
+					   gpointer areas,
+					   guint offset,
+					   guint channels,
+					   guint frames);
 void ags_alsa_devin_device_record(AgsSoundcard *soundcard,
 				  GError **error);
 void ags_alsa_devin_device_free(AgsSoundcard *soundcard);
@@ -214,6 +220,7 @@ ags_alsa_devin_flags_get_type()
       { AGS_ALSA_DEVIN_SHUTDOWN, "AGS_ALSA_DEVIN_SHUTDOWN", "alsa-devin-shutdown" },
       { AGS_ALSA_DEVIN_NONBLOCKING, "AGS_ALSA_DEVIN_NONBLOCKING", "alsa-devin-nonblocking" },
       { AGS_ALSA_DEVIN_ATTACK_FIRST, "AGS_ALSA_DEVIN_ATTACK_FIRST", "alsa-devin-attack-first" },
+      { AGS_ALSA_DEVIN_MMAP, "AGS_ALSA_DEVIN_MMAP", "alsa-devin-mmap" },
       { 0, NULL, NULL }
     };
 
@@ -497,6 +504,25 @@ ags_alsa_devin_init(AgsAlsaDevin *alsa_devin)
   alsa_devin->samplerate = ags_soundcard_helper_config_get_samplerate(config);
   alsa_devin->buffer_size = ags_soundcard_helper_config_get_buffer_size(config);
   alsa_devin->format = ags_soundcard_helper_config_get_format(config);
+
+  str = ags_config_get_value(config,
+			     AGS_CONFIG_SOUNDCARD,
+			     "alsa-access-mode");
+
+  if(str == NULL){
+    str = ags_config_get_value(config,
+			       AGS_CONFIG_SOUNDCARD_0,
+			       "alsa-access-mode");
+  }
+
+  if(str != NULL &&
+     !g_ascii_strncasecmp(str,
+			  "mmap",
+			  5)){
+    alsa_devin->flags |= AGS_ALSA_DEVIN_MMAP;
+  }
+
+  g_free(str);
   
   /* bpm */
   alsa_devin->bpm = AGS_SOUNDCARD_DEFAULT_BPM;
@@ -1888,8 +1914,24 @@ ags_alsa_devin_device_record_init(AgsSoundcard *soundcard,
      }
   */
   
+  /* set the interleaved mmap access, fall back to read/write */
+  err = -1;
+  
+  if((AGS_ALSA_DEVIN_MMAP & (alsa_devin->flags)) != 0){
+    err = snd_pcm_hw_params_set_access(handle, hwparams, SND_PCM_ACCESS_MMAP_INTERLEAVED);
+
+    if(err < 0){
+      str = snd_strerror(err);
+      g_warning("MMAP access not available for capture, falling back to read/write: %s", str);
+      
+      alsa_devin->flags &= (~AGS_ALSA_DEVIN_MMAP);
+    }
+  }
+
   /* set the interleaved read/write format */
-  err = snd_pcm_hw_params_set_access(handle, hwparams, SND_PCM_ACCESS_RW_INTERLEAVED);
+  if(err < 0){
+    err = snd_pcm_hw_params_set_access(handle, hwparams, SND_PCM_ACCESS_RW_INTERLEAVED);
+  }
 
   if(err < 0){
     alsa_devin->flags |= (~(AGS_ALSA_DEVIN_START_RECORD |
@@ -2282,6 +2324,58 @@ ags_alsa_devin_device_fill_backend_buffer(void *app_buffer,
 #endif
 }
 
+void
+ags_alsa_devin_device_fill_mmap_area(void *app_buffer,
+				     guint word_size,
+				     gpointer areas,
+				     guint offset,
+				     guint channels,
+				     guint frames)
+{
+#ifdef AGS_WITH_ALSA
+  const snd_pcm_channel_area_t *channel_area;
+
+  guchar *source, *destination;
+
+  guint source_step, destination_step;
+  guint i, chn;
+
+  channel_area = (const snd_pcm_channel_area_t *) areas;
+
+  /* the app buffer holds native signed samples of the hardware format */
+  destination_step = channels * word_size;
+  
+  /* packed interleaved area - single copy */
+  if(channel_area[0].first == 0 &&
+     channel_area[0].step == destination_step * 8){
+    source = ((guchar *) channel_area[0].addr) + (offset * destination_step);
+
+    memcpy(app_buffer,
+	   source,
+	   frames * destination_step);
+
+    return;
+  }
+
+  /* strided area */
+  for(chn = 0; chn < channels; chn++){
+    destination = ((guchar *) app_buffer) + (chn * word_size);
+
+    source = ((guchar *) channel_area[chn].addr) + ((channel_area[chn].first + offset * channel_area[chn].step) / 8);
+    source_step = channel_area[chn].step / 8;
+    
+    for(i = 0; i < frames; i++){
+      memcpy(destination,
+	     source,
+	     word_size);
+
+      source += source_step;
+      destination += destination_step;
+    }
+  }
+#endif
+}
+
 void
 ags_alsa_devin_device_record(AgsSoundcard *soundcard,
 			     GError **error)
@@ -2302,6 +2396,7 @@ ags_alsa_devin_device_record(AgsSoundcard *soundcard,
   gchar *str;
   
   guint word_size;
+  gboolean is_mmap;
   
   GRecMutex *alsa_devin_mutex;
   
@@ -2364,34 +2459,147 @@ ags_alsa_devin_device_record(AgsSoundcard *soundcard,
   //				AGS_ALSA_DEVIN_BUFFER2 |
   //				AGS_ALSA_DEVIN_BUFFER3) & (alsa_devin->flags)));
   
+  is_mmap = ((AGS_ALSA_DEVIN_MMAP & (alsa_devin->flags)) != 0) ? TRUE: FALSE;
+  
 #ifdef AGS_WITH_ALSA  
   /* write ring buffer */
 //  g_message("read %d from 0x%x -> 0x%x", alsa_devin->buffer_size, alsa_devin->backend_buffer[alsa_devin->backend_buffer_mode], alsa_devin->app_buffer[alsa_devin->app_buffer_mode]);
 
-  if(alsa_devin->handle != NULL){
-    alsa_devin->rc = snd_pcm_readi(alsa_devin->handle,
-				   alsa_devin->backend_buffer[alsa_devin->backend_buffer_mode],
-				   (snd_pcm_uframes_t) (alsa_devin->buffer_size));
-  }
+  if(alsa_devin->handle != NULL &&
+     is_mmap){
+    const snd_pcm_channel_area_t *areas;
 
-  /* fill buffer */
-  ags_soundcard_lock_buffer(soundcard,
-			    alsa_devin->app_buffer[alsa_devin->app_buffer_mode]);
-  
-  ags_alsa_devin_device_fill_backend_buffer(alsa_devin->app_buffer[alsa_devin->app_buffer_mode],
-					    alsa_devin->format,
-					    alsa_devin->backend_buffer[alsa_devin->backend_buffer_mode],
-					    alsa_devin->pcm_channels,
-					    alsa_devin->buffer_size);
+    snd_pcm_uframes_t offset, frames;
+    snd_pcm_sframes_t avail, committed;
+
+    guint read;
+    int wait_timeout;
+    int err;
+
+    /* read directly from the mmap'ed hardware buffer */
+    if(snd_pcm_state(alsa_devin->handle) == SND_PCM_STATE_PREPARED){
+      snd_pcm_start(alsa_devin->handle);
+    }
 
-  ags_soundcard_unlock_buffer(soundcard,
+    /* wait at most twice the buffer's duration in milliseconds */
+    wait_timeout = (int) (2000 * alsa_devin->buffer_size / alsa_devin->samplerate) + 1;
+    
+    ags_soundcard_lock_buffer(soundcard,
+			      alsa_devin->app_buffer[alsa_devin->app_buffer_mode]);
+
+    read = 0;
+    
+    while(read < alsa_devin->buffer_size){
+      avail = snd_pcm_avail_update(alsa_devin->handle);
+
+      if(avail < 0){
+	if(snd_pcm_recover(alsa_devin->handle, (int) avail, 1) < 0){
+	  break;
+	}
+
+	snd_pcm_start(alsa_devin->handle);
+	
+	continue;
+      }
+
+      if(avail == 0){
+	/* wait for captured frames as the blocking read does */
+	err = snd_pcm_wait(alsa_devin->handle,
+			   wait_timeout);
+
+	if(err < 0){
+	  if(snd_pcm_recover(alsa_devin->handle, err, 1) < 0){
+	    break;
+	  }
+
+	  snd_pcm_start(alsa_devin->handle);
+	}
+
+	continue;
+      }
+      
+      frames = alsa_devin->buffer_size - read;
+      
+      err = snd_pcm_mmap_begin(alsa_devin->handle,
+			       &areas,
+			       &offset,
+			       &frames);
+
+      if(err < 0){
+	if(snd_pcm_recover(alsa_devin->handle, err, 1) < 0){
+	  break;
+	}
+
+	snd_pcm_start(alsa_devin->handle);
+	
+	continue;
+      }
+
+      if(frames == 0){
+	/* nothing mapped, release and query again */
+	snd_pcm_mmap_commit(alsa_devin->handle,
+			    offset,
+			    0);
+	
+	continue;
+      }
+
+      ags_alsa_devin_device_fill_mmap_area(((guchar *) alsa_devin->app_buffer[alsa_devin->app_buffer_mode]) + (read * alsa_devin->pcm_channels * word_size),
+					   word_size,
+					   (gpointer) areas,
+					   offset,
+					   alsa_devin->pcm_channels,
+					   frames);
+
+      committed = snd_pcm_mmap_commit(alsa_devin->handle,
+				      offset,
+				      frames);
+
+      if(committed < 0 ||
+	 (snd_pcm_uframes_t) committed != frames){
+	if(snd_pcm_recover(alsa_devin->handle, (committed >= 0) ? -EPIPE: (int) committed, 1) < 0){
+	  break;
+	}
+
+	snd_pcm_start(alsa_devin->handle);
+      }
+
+      if(committed > 0){
+	read += committed;
+      }
+    }
+
+    ags_soundcard_unlock_buffer(soundcard,
+				alsa_devin->app_buffer[alsa_devin->app_buffer_mode]);
+
+    alsa_devin->rc = read;
+  }else{
+    if(alsa_devin->handle != NULL){
+      alsa_devin->rc = snd_pcm_readi(alsa_devin->handle,
+				     alsa_devin->backend_buffer[alsa_devin->backend_buffer_mode],
+				     (snd_pcm_uframes_t) (alsa_devin->buffer_size));
+    }
+
+    /* fill buffer */
+    ags_soundcard_lock_buffer(soundcard,
 			      alsa_devin->app_buffer[alsa_devin->app_buffer_mode]);
   
+    ags_alsa_devin_device_fill_backend_buffer(alsa_devin->app_buffer[alsa_devin->app_buffer_mode],
+					      alsa_devin->format,
+					      alsa_devin->backend_buffer[alsa_devin->backend_buffer_mode],
+					      alsa_devin->pcm_channels,
+					      alsa_devin->buffer_size);
+
+    ags_soundcard_unlock_buffer(soundcard,
+				alsa_devin->app_buffer[alsa_devin->app_buffer_mode]);
+  }
+  
   ags_atomic_int_set(&(alsa_devin->available),
 		   FALSE);
   
   /* check error flag */
-  if((AGS_ALSA_DEVIN_NONBLOCKING & (alsa_devin->flags)) == 0){
+  if(!is_mmap &&
+     (AGS_ALSA_DEVIN_NONBLOCKING & (alsa_devin->flags)) == 0){
     if(alsa_devin->rc == -EPIPE){
       /* EPIPE means underrun */
       if(alsa_devin->handle != NULL){
@@ -2463,7 +2671,9 @@ ags_alsa_devin_device_record(AgsSoundcard *soundcard,
 				 task);
   
 #ifdef AGS_WITH_ALSA
-  if(alsa_devin->handle != NULL){
+  /* the mmap'ed stream keeps running, read/write access prepares every cycle */
+  if(alsa_devin->handle != NULL &&
+     !is_mmap){
     snd_pcm_prepare(alsa_devin->handle);
   }
 #endif
@@ -59,6 +59,7 @@ typedef struct _AgsAlsaDevinClass AgsAlsaDevinClass;
  * @AGS_ALSA_DEVIN_SHUTDOWN: stop capture
  * @AGS_ALSA_DEVIN_NONBLOCKING: do non-blocking calls
  * @AGS_ALSA_DEVIN_ATTACK_FIRST: use first attack, instead of second one
+ * @AGS_ALSA_DEVIN_MMAP: read directly from the mmap'ed hardware buffer, since 9.1.0
  * 
  * Enum values to control the behavior or indicate internal state of #AgsAlsaDevin by
  * enable/disable as flags.
@@ -74,6 +75,8 @@ typedef enum
   AGS_ALSA_DEVIN_NONBLOCKING        = 1 <<  4,
 
   AGS_ALSA_DEVIN_ATTACK_FIRST       = 1 <<  5,
+
+  AGS_ALSA_DEVIN_MMAP               = 1 <<  6,
 }AgsAlsaDevinFlags;
 
 /**
@@ -110,6 +110,12 @@ void ags_alsa_devout_device_fill_backend_buffer(void *app_buffer,
 						guchar *backend_buffer,
 						guint channels,
 						guint buffer_size);
+void ags_alsa_devout_device_fill_mmap_area(void *app_buffer,
+					    guint word_size,
+					    gpointer areas,
+					    guint offset,
+					    guint channels,
+					    guint frames);
 void ags_alsa_devout_device_play(AgsSoundcard *soundcard,
 				 GError **error);
 void ags_alsa_devout_device_free(AgsSoundcard *soundcard);
@@ -233,6 +239,7 @@ ags_alsa_devout_flags_get_type()
       { AGS_ALSA_DEVOUT_SHUTDOWN, "AGS_ALSA_DEVOUT_SHUTDOWN", "alsa-devout-shutdown" },
       { AGS_ALSA_DEVOUT_NONBLOCKING, "AGS_ALSA_DEVOUT_NONBLOCKING", "alsa-devout-nonblocking" },
       { AGS_ALSA_DEVOUT_ATTACK_FIRST, "AGS_ALSA_DEVOUT_ATTACK_FIRST", "alsa-devout-attack-first" },
+      { AGS_ALSA_DEVOUT_MMAP, "AGS_ALSA_DEVOUT_MMAP", "alsa-devout-mmap" },
       { 0, NULL, NULL }
     };
 
@@ -520,6 +527,25 @@ ags_alsa_devout_init(AgsAlsaDevout *alsa_devout)
   alsa_devout->samplerate = ags_soundcard_helper_config_get_samplerate(config);
   alsa_devout->buffer_size = ags_soundcard_helper_config_get_buffer_size(config);
   alsa_devout->format = ags_soundcard_helper_config_get_format(config);
+
+  str = ags_config_get_value(config,
+			     AGS_CONFIG_SOUNDCARD,
+			     "alsa-access-mode");
+
+  if(str == NULL){
+    str = ags_config_get_value(config,
+			       AGS_CONFIG_SOUNDCARD_0,
+			       "alsa-access-mode");
+  }
+
+  if(str != NULL &&
+     !g_ascii_strncasecmp(str,
+			  "mmap",
+			  5)){
+    alsa_devout->flags |= AGS_ALSA_DEVOUT_MMAP;
+  }
+
+  g_free(str);
   
   /* bpm */
   alsa_devout->bpm = AGS_SOUNDCARD_DEFAULT_BPM;
@@ -580,6 +606,9 @@ ags_alsa_devout_init(AgsAlsaDevout *alsa_devout)
   alsa_devout->io_channel = NULL;
   alsa_devout->tag = NULL;
 
+  alsa_devout->poll_fd = NULL;
+  alsa_devout->poll_fd_count = 0;
+  
   alsa_devout->poll_timeout = -1;
 }
 
@@ -929,6 +958,8 @@ ags_alsa_devout_finalize(GObject *gobject)
     
   g_free(alsa_devout->device);
 
+  g_free(alsa_devout->poll_fd);
+
   /* call parent */
   G_OBJECT_CLASS(ags_alsa_devout_parent_class)->finalize(gobject);
 }
@@ -1696,7 +1727,11 @@ ags_alsa_devout_is_available(AgsSoundcard *soundcard)
 #ifdef AGS_WITH_ALSA
   snd_pcm_t *handle;
 
+  struct pollfd *poll_fd;
   struct pollfd fds;
+
+  unsigned short revents;
+  guint poll_fd_count;
 #endif
 
   gboolean is_available;
@@ -1713,10 +1748,23 @@ ags_alsa_devout_is_available(AgsSoundcard *soundcard)
   g_rec_mutex_lock(alsa_devout_mutex);
 
   handle = alsa_devout->handle;
+
+  poll_fd = alsa_devout->poll_fd;
+  poll_fd_count = alsa_devout->poll_fd_count;
   
   g_rec_mutex_unlock(alsa_devout_mutex);
 
-  if(handle != NULL){
+  if(handle != NULL &&
+     poll_fd != NULL){
+    /* descriptors were set up once by play init */
+    poll(poll_fd, poll_fd_count, 0);
+
+    revents = 0;
+    
+    snd_pcm_poll_descriptors_revents(handle, poll_fd, poll_fd_count, &revents);
+
+    is_available = ((POLLOUT & revents) != 0) ? TRUE: FALSE;
+  }else if(handle != NULL){
     fds.events = POLLOUT;
   
     snd_pcm_poll_descriptors(handle, &fds, 1);
@@ -2027,9 +2075,25 @@ ags_alsa_devout_device_play_init(AgsSoundcard *soundcard,
      }
   */
   
-  /* set the interleaved read/write format */
-  err = snd_pcm_hw_params_set_access(handle, hwparams, SND_PCM_ACCESS_RW_INTERLEAVED);
+  /* set the interleaved mmap access, fall back to read/write */
+  err = -1;
+  
+  if((AGS_ALSA_DEVOUT_MMAP & (alsa_devout->flags)) != 0){
+    err = snd_pcm_hw_params_set_access(handle, hwparams, SND_PCM_ACCESS_MMAP_INTERLEAVED);
+
+    if(err < 0){
+      str = snd_strerror(err);
+      g_warning("MMAP access not available for playback, falling back to read/write: %s", str);
+      
+      alsa_devout->flags &= (~AGS_ALSA_DEVOUT_MMAP);
+    }
+  }
 
+  /* set the interleaved read/write format */
+  if(err < 0){
+    err = snd_pcm_hw_params_set_access(handle, hwparams, SND_PCM_ACCESS_RW_INTERLEAVED);
+  }
+  
   if(err < 0){
     alsa_devout->flags &= (~(AGS_ALSA_DEVOUT_START_PLAY |
 			     AGS_ALSA_DEVOUT_PLAY |
@@ -2293,6 +2357,22 @@ ags_alsa_devout_device_play_init(AgsSoundcard *soundcard,
   /*  */
   alsa_devout->handle = handle;
 
+  /* set up poll descriptors once */
+  g_free(alsa_devout->poll_fd);
+
+  alsa_devout->poll_fd = NULL;
+  alsa_devout->poll_fd_count = 0;
+
+  err = snd_pcm_poll_descriptors_count(handle);
+
+  if(err > 0){
+    alsa_devout->poll_fd = (struct pollfd *) g_malloc(err * sizeof(struct pollfd));
+
+    err = snd_pcm_poll_descriptors(handle, alsa_devout->poll_fd, err);
+
+    alsa_devout->poll_fd_count = (err > 0) ? err: 0;
+  }
+  
 #if 0
   i_stop = snd_pcm_poll_descriptors_count(alsa_devout->handle);
 
@@ -2557,6 +2637,58 @@ ags_alsa_devout_device_fill_backend_buffer(void *app_buffer,
 #endif
 }
 
+void
+ags_alsa_devout_device_fill_mmap_area(void *app_buffer,
+				      guint word_size,
+				      gpointer areas,
+				      guint offset,
+				      guint channels,
+				      guint frames)
+{
+#ifdef AGS_WITH_ALSA
+  const snd_pcm_channel_area_t *channel_area;
+
+  guchar *source, *destination;
+
+  guint source_step, destination_step;
+  guint i, chn;
+
+  channel_area = (const snd_pcm_channel_area_t *) areas;
+
+  /* the app buffer holds native signed samples of the hardware format */
+  source_step = channels * word_size;
+  
+  /* packed interleaved area - single copy */
+  if(channel_area[0].first == 0 &&
+     channel_area[0].step == source_step * 8){
+    destination = ((guchar *) channel_area[0].addr) + (offset * source_step);
+
+    memcpy(destination,
+	   app_buffer,
+	   frames * source_step);
+
+    return;
+  }
+
+  /* strided area */
+  for(chn = 0; chn < channels; chn++){
+    source = ((guchar *) app_buffer) + (chn * word_size);
+
+    destination = ((guchar *) channel_area[chn].addr) + ((channel_area[chn].first + offset * channel_area[chn].step) / 8);
+    destination_step = channel_area[chn].step / 8;
+    
+    for(i = 0; i < frames; i++){
+      memcpy(destination,
+	     source,
+	     word_size);
+
+      source += source_step;
+      destination += destination_step;
+    }
+  }
+#endif
+}
+
 void
 ags_alsa_devout_device_play(AgsSoundcard *soundcard,
 			    GError **error)
@@ -2579,6 +2711,7 @@ ags_alsa_devout_device_play(AgsSoundcard *soundcard,
   gint64 poll_timeout;
   guint word_size;
   gboolean initial_run;
+  gboolean is_mmap;
   
   GRecMutex *alsa_devout_mutex;
   
@@ -2638,17 +2771,21 @@ ags_alsa_devout_device_play(AgsSoundcard *soundcard,
     return;
   }
 
+  is_mmap = ((AGS_ALSA_DEVOUT_MMAP & (alsa_devout->flags)) != 0) ? TRUE: FALSE;
+
 #ifdef AGS_WITH_ALSA
   /* fill ring buffer */
-  ags_soundcard_lock_buffer(soundcard,
-			    alsa_devout->app_buffer[alsa_devout->app_buffer_mode]);
+  if(!is_mmap){
+    ags_soundcard_lock_buffer(soundcard,
+			      alsa_devout->app_buffer[alsa_devout->app_buffer_mode]);
   
-  ags_alsa_devout_device_fill_backend_buffer(alsa_devout->app_buffer[alsa_devout->app_buffer_mode], alsa_devout->format,
-					     alsa_devout->backend_buffer[alsa_devout->backend_buffer_mode],
-					     alsa_devout->pcm_channels, alsa_devout->buffer_size);
+    ags_alsa_devout_device_fill_backend_buffer(alsa_devout->app_buffer[alsa_devout->app_buffer_mode], alsa_devout->format,
+					       alsa_devout->backend_buffer[alsa_devout->backend_buffer_mode],
+					       alsa_devout->pcm_channels, alsa_devout->buffer_size);
 
-  ags_soundcard_unlock_buffer(soundcard,
-			      alsa_devout->app_buffer[alsa_devout->app_buffer_mode]);
+    ags_soundcard_unlock_buffer(soundcard,
+				alsa_devout->app_buffer[alsa_devout->app_buffer_mode]);
+  }
 
   /* wait until available */
   poll_timeout = alsa_devout->poll_timeout;
@@ -2675,14 +2812,118 @@ ags_alsa_devout_device_play(AgsSoundcard *soundcard,
   /* write ring buffer */
 //  g_message("write %d", alsa_devout->buffer_size);
 
-  if(alsa_devout->handle != NULL){
+  if(alsa_devout->handle != NULL &&
+     is_mmap){
+    const snd_pcm_channel_area_t *areas;
+
+    snd_pcm_uframes_t offset, frames;
+    snd_pcm_sframes_t avail, committed;
+
+    guint written;
+    int wait_timeout;
+    int err;
+
+    /* wait at most twice the buffer's duration in milliseconds before checking again */
+    wait_timeout = (int) (2000 * alsa_devout->buffer_size / alsa_devout->samplerate) + 1;
+
+    /* write directly to the mmap'ed hardware buffer */
+    ags_soundcard_lock_buffer(soundcard,
+			      alsa_devout->app_buffer[alsa_devout->app_buffer_mode]);
+
+    written = 0;
+    
+    while(written < alsa_devout->buffer_size){
+      avail = snd_pcm_avail_update(alsa_devout->handle);
+
+      if(avail < 0){
+	if(snd_pcm_recover(alsa_devout->handle, (int) avail, 1) < 0){
+	  break;
+	}
+	
+	continue;
+      }
+
+      if(avail == 0){
+	/* hardware buffer full, wait for room as the blocking write does */
+	if(snd_pcm_state(alsa_devout->handle) == SND_PCM_STATE_PREPARED){
+	  snd_pcm_start(alsa_devout->handle);
+	}
+	
+	err = snd_pcm_wait(alsa_devout->handle,
+			   wait_timeout);
+
+	if(err < 0 &&
+	   snd_pcm_recover(alsa_devout->handle, err, 1) < 0){
+	  break;
+	}
+	
+	continue;
+      }
+      
+      frames = alsa_devout->buffer_size - written;
+      
+      err = snd_pcm_mmap_begin(alsa_devout->handle,
+			       &areas,
+			       &offset,
+			       &frames);
+
+      if(err < 0){
+	if(snd_pcm_recover(alsa_devout->handle, err, 1) < 0){
+	  break;
+	}
+	
+	continue;
+      }
+
+      if(frames == 0){
+	/* nothing mapped, release and query again */
+	snd_pcm_mmap_commit(alsa_devout->handle,
+			    offset,
+			    0);
+	
+	continue;
+      }
+      
+      ags_alsa_devout_device_fill_mmap_area(((guchar *) alsa_devout->app_buffer[alsa_devout->app_buffer_mode]) + (written * alsa_devout->pcm_channels * word_size),
+					    word_size,
+					    (gpointer) areas,
+					    offset,
+					    alsa_devout->pcm_channels,
+					    frames);
+
+      committed = snd_pcm_mmap_commit(alsa_devout->handle,
+				      offset,
+				      frames);
+
+      if(committed < 0 ||
+	 (snd_pcm_uframes_t) committed != frames){
+	if(snd_pcm_recover(alsa_devout->handle, (committed >= 0) ? -EPIPE: (int) committed, 1) < 0){
+	  break;
+	}
+      }
+
+      if(committed > 0){
+	written += committed;
+      }
+    }
+
+    ags_soundcard_unlock_buffer(soundcard,
+				alsa_devout->app_buffer[alsa_devout->app_buffer_mode]);
+
+    alsa_devout->rc = written;
+
+    if(snd_pcm_state(alsa_devout->handle) == SND_PCM_STATE_PREPARED){
+      snd_pcm_start(alsa_devout->handle);
+    }
+  }else if(alsa_devout->handle != NULL){
     alsa_devout->rc = snd_pcm_writei(alsa_devout->handle,
 				     alsa_devout->backend_buffer[alsa_devout->backend_buffer_mode],
 				     (snd_pcm_uframes_t) (alsa_devout->buffer_size));
   }
   
   /* check error flag */
-  if((AGS_ALSA_DEVOUT_NONBLOCKING & (alsa_devout->flags)) == 0){
+  if(!is_mmap &&
+     (AGS_ALSA_DEVOUT_NONBLOCKING & (alsa_devout->flags)) == 0){
     if(alsa_devout->rc == -EPIPE){
       /* EPIPE means underrun */
       if(alsa_devout->handle != NULL){
@@ -2764,7 +3005,9 @@ ags_alsa_devout_device_play(AgsSoundcard *soundcard,
 		   g_object_unref);
   
 #ifdef AGS_WITH_ALSA
-  if(alsa_devout->handle != NULL){
+  /* the mmap'ed stream keeps running, read/write access prepares every cycle */
+  if(alsa_devout->handle != NULL &&
+     !is_mmap){
     snd_pcm_prepare(alsa_devout->handle);
   }
 #endif
@@ -2807,6 +3050,11 @@ ags_alsa_devout_device_free(AgsSoundcard *soundcard)
   }
   
   alsa_devout->handle = NULL;
+
+  g_free(alsa_devout->poll_fd);
+
+  alsa_devout->poll_fd = NULL;
+  alsa_devout->poll_fd_count = 0;
 #endif
 
   /* free backend buffer */
@@ -59,6 +59,7 @@ typedef struct _AgsAlsaDevoutClass AgsAlsaDevoutClass;
  * @AGS_ALSA_DEVOUT_START_PLAY: playback starting
  * @AGS_ALSA_DEVOUT_NONBLOCKING: do non-blocking calls
  * @AGS_ALSA_DEVOUT_ATTACK_FIRST: use first attack, instead of second one
+ * @AGS_ALSA_DEVOUT_MMAP: write directly to the mmap'ed hardware buffer, since 9.1.0
  * 
  * Enum values to control the behavior or indicate internal state of #AgsAlsaDevout by
  * enable/disable as flags.
@@ -74,6 +75,8 @@ typedef enum
   AGS_ALSA_DEVOUT_NONBLOCKING        = 1 <<  4,
 
   AGS_ALSA_DEVOUT_ATTACK_FIRST       = 1 <<  5,
+
+  AGS_ALSA_DEVOUT_MMAP               = 1 <<  6,
 }AgsAlsaDevoutFlags;
 
 /**
@@ -176,11 +179,17 @@ struct _AgsAlsaDevout
   snd_pcm_t *handle;
   snd_async_handler_t *ahandler;
   snd_pcm_hw_params_t *params;
+
+  struct pollfd *poll_fd;
 #else
   gpointer handle;
   gpointer ahandler;
   gpointer params;
+
+  gpointer poll_fd;
 #endif
+
+  guint poll_fd_count;
   
   GList *io_channel;
   GList *tag;
@@ -490,6 +490,8 @@ ags_sound_resource_read_audio_signal(AgsSoundResource *sound_resource,
     audio_signal = ags_audio_signal_new(soundcard,
 					NULL,
 					NULL);
+    ags_audio_signal_set_flags(audio_signal,
+			       AGS_AUDIO_SIGNAL_STREAM_BLOCK);
     g_object_set(audio_signal,
 		 "frame-count", frame_count,
 		 "samplerate", target_samplerate,
@@ -746,6 +748,8 @@ ags_sound_resource_read_audio_signal_at_once(AgsSoundResource *sound_resource,
     audio_signal = ags_audio_signal_new(soundcard,
 					NULL,
 					NULL);
+    ags_audio_signal_set_flags(audio_signal,
+			       AGS_AUDIO_SIGNAL_STREAM_BLOCK);
     g_object_set(audio_signal,
 		 "frame-count", frame_count,
 		 "samplerate", target_samplerate,
@@ -1159,6 +1163,10 @@ ags_sound_resource_read_wave(AgsSoundResource *sound_resource,
 				     (guint64) relative_offset * floor(x_point_offset / relative_offset));
     
 	g_object_unref(timestamp);
+
+	/* keep samples contiguous, long files are mapped */
+	ags_wave_enable_storage(wave,
+				(frame_count >= AGS_WAVE_STORAGE_DEFAULT_MMAP_THRESHOLD) ? TRUE: FALSE);
 	
 	start_list = ags_wave_add(start_list,
 				  wave);
@@ -1190,6 +1198,15 @@ ags_sound_resource_read_wave(AgsSoundResource *sound_resource,
   ags_stream_free(target_data);
 
   g_object_unref(current_timestamp);
+
+  /* build the peaks while loading, the editor draws of them */
+  list = start_list;
+
+  while(list != NULL){
+    ags_wave_refresh_peak(list->data);
+
+    list = list->next;
+  }
   
   g_list_foreach(start_list,
 		 (GFunc) g_object_ref,
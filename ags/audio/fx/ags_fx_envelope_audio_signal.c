@@ -241,30 +241,39 @@ ags_fx_envelope_audio_signal_real_run_inter(AgsRecall *recall)
   buffer_size = AGS_SOUNDCARD_DEFAULT_BUFFER_SIZE;
   format = AGS_SOUNDCARD_DEFAULT_FORMAT;
 
-  g_object_get(recall,
-	       "parent", &fx_envelope_recycling,
-	       "source", &source,
-	       "recall-id", &recall_id,
-	       NULL);
+  /* read rt view, the recall tree holds the references */
+  fx_envelope_recycling = (AgsFxEnvelopeRecycling *) AGS_RECALL_RT_VIEW(recall)->parent;
+  source = (AgsAudioSignal *) AGS_RECALL_RT_VIEW(recall)->source;
 
-  g_object_get(recall_id,
-	       "recycling-context", &recycling_context,
-	       NULL);
+  recall_id = AGS_RECALL_RT_VIEW(recall)->recall_id;
 
-  if(recycling_context != NULL){
-    g_object_get(recycling_context,
-		 "parent", &parent_recycling_context,
-		 NULL);
-  }
+  recycling_context = AGS_RECALL_RT_VIEW(recall)->recycling_context;
+  parent_recycling_context = AGS_RECALL_RT_VIEW(recall)->parent_recycling_context;
   
-  g_object_get(fx_envelope_recycling,
-	       "parent", &fx_envelope_channel_processor,
-	       NULL);
+  if(fx_envelope_recycling != NULL){
+    fx_envelope_channel_processor = (AgsFxEnvelopeChannelProcessor *) AGS_RECALL_RT_VIEW(fx_envelope_recycling)->parent;
+  }
 
-  g_object_get(fx_envelope_channel_processor,
-	       "recall-channel", &fx_envelope_channel,
-	       NULL);
+  if(fx_envelope_channel_processor != NULL){
+    fx_envelope_channel = (AgsFxEnvelopeChannel *) AGS_RECALL_RT_VIEW(fx_envelope_channel_processor)->recall_channel;
+  }
+
+  if(source == NULL){
+    ags_recall_done(recall);
+    
+    /* call parent */
+    AGS_RECALL_CLASS(ags_fx_envelope_audio_signal_parent_class)->run_inter(recall);
 
+    return;
+  }
+
+  if(fx_envelope_channel == NULL){
+    /* call parent */
+    AGS_RECALL_CLASS(ags_fx_envelope_audio_signal_parent_class)->run_inter(recall);
+
+    return;
+  }
+  
   g_object_get(fx_envelope_channel,
 	       "source", &channel,
 	       "fixed-length", &fixed_length,
@@ -824,26 +833,6 @@ ags_fx_envelope_audio_signal_real_run_inter(AgsRecall *recall)
     g_object_unref(template);
   }
 
-  if(source != NULL){
-    g_object_unref(source);
-  }
-
-  if(recall_id != NULL){
-    g_object_unref(recall_id);
-  }
-
-  if(recycling_context != NULL){
-    g_object_unref(recycling_context);
-  }
-
-  if(parent_recycling_context != NULL){
-    g_object_unref(parent_recycling_context);
-  }
-  
-  if(fx_envelope_channel != NULL){
-    g_object_unref(fx_envelope_channel);
-  }
-
   if(fixed_length != NULL){
     g_object_unref(fixed_length);
   }
@@ -868,14 +857,6 @@ ags_fx_envelope_audio_signal_real_run_inter(AgsRecall *recall)
     g_object_unref(ratio);
   }
   
-  if(fx_envelope_channel_processor != NULL){
-    g_object_unref(fx_envelope_channel_processor);
-  }
-
-  if(fx_envelope_recycling != NULL){
-    g_object_unref(fx_envelope_recycling);
-  }
-  
   g_list_free_full(start_note,
 		   (GDestroyNotify) g_object_unref);
   
@@ -179,6 +179,7 @@ ags_fx_lv2_audio_signal_real_run_inter(AgsRecall *recall)
   void (*run)(LV2_Handle instance,
 	      uint32_t sample_count);
 
+  GRecMutex *source_mutex;
   GRecMutex *source_stream_mutex;
   GRecMutex *fx_lv2_audio_mutex;
   GRecMutex *fx_lv2_channel_mutex;
@@ -191,27 +192,31 @@ ags_fx_lv2_audio_signal_real_run_inter(AgsRecall *recall)
   fx_lv2_channel = NULL;
   fx_lv2_channel_processor = NULL;
 
-  fx_lv2_recycling = NULL;
-
-  source = NULL;
-
   buffer_size = AGS_SOUNDCARD_DEFAULT_BUFFER_SIZE;
   format = AGS_SOUNDCARD_DEFAULT_FORMAT;
   
   sound_scope = ags_recall_get_sound_scope(recall);
 
-  g_object_get(recall,
-	       "parent", &fx_lv2_recycling,
-	       NULL);
+  /* read rt view, the recall tree holds the references */
+  fx_lv2_recycling = (AgsFxLv2Recycling *) AGS_RECALL_RT_VIEW(recall)->parent;
 
-  g_object_get(fx_lv2_recycling,
-	       "parent", &fx_lv2_channel_processor,
-	       NULL);
+  if(fx_lv2_recycling != NULL){
+    fx_lv2_channel_processor = (AgsFxLv2ChannelProcessor *) AGS_RECALL_RT_VIEW(fx_lv2_recycling)->parent;
+  }
 
-  g_object_get(fx_lv2_channel_processor,
-	       "recall-audio", &fx_lv2_audio,
-	       NULL);
+  if(fx_lv2_channel_processor != NULL){
+    fx_lv2_audio = (AgsFxLv2Audio *) AGS_RECALL_RT_VIEW(fx_lv2_channel_processor)->recall_audio;
+    fx_lv2_channel = (AgsFxLv2Channel *) AGS_RECALL_RT_VIEW(fx_lv2_channel_processor)->recall_channel;
+  }
 
+  if(fx_lv2_audio == NULL ||
+     fx_lv2_channel == NULL){
+    /* call parent */
+    AGS_RECALL_CLASS(ags_fx_lv2_audio_signal_parent_class)->run_inter(recall);
+
+    return;
+  }
+  
   /* get LV2 plugin */
   fx_lv2_audio_mutex = AGS_RECALL_GET_OBJ_MUTEX(fx_lv2_audio);
 
@@ -223,36 +228,31 @@ ags_fx_lv2_audio_signal_real_run_inter(AgsRecall *recall)
 
   if(lv2_plugin != NULL &&
      ags_base_plugin_test_flags((AgsBasePlugin *) lv2_plugin, AGS_BASE_PLUGIN_IS_INSTRUMENT)){
-    if(fx_lv2_audio != NULL){
-      g_object_unref(fx_lv2_audio);
-    }
-  
-    if(fx_lv2_channel_processor != NULL){
-      g_object_unref(fx_lv2_channel_processor);
-    }
-  
-    if(fx_lv2_recycling != NULL){
-      g_object_unref(fx_lv2_recycling);
-    }  
-    
     /* call parent */
     AGS_RECALL_CLASS(ags_fx_lv2_audio_signal_parent_class)->run_inter(recall);
 
     return;
   }
 
-  g_object_get(recall,
-	       "source", &source,
-	       NULL);
+  source = (AgsAudioSignal *) AGS_RECALL_RT_VIEW(recall)->source;
 
-  g_object_get(fx_lv2_channel_processor,
-	       "recall-channel", &fx_lv2_channel,
-	       NULL);
+  if(source == NULL){
+    ags_recall_done(recall);
+
+    /* call parent */
+    AGS_RECALL_CLASS(ags_fx_lv2_audio_signal_recall_audio_signal_class)->run_inter(recall);
+
+    return;
+  }
   
-  g_object_get(source,
-	       "buffer-size", &buffer_size,
-	       "format", &format,
-	       NULL);
+  source_mutex = AGS_AUDIO_SIGNAL_GET_OBJ_MUTEX(source);
+
+  g_rec_mutex_lock(source_mutex);
+
+  buffer_size = source->buffer_size;
+  format = source->format;
+  
+  g_rec_mutex_unlock(source_mutex);
 
   /* get LV2 plugin */
   fx_lv2_channel_mutex = AGS_RECALL_GET_OBJ_MUTEX(fx_lv2_channel);
@@ -343,27 +343,6 @@ ags_fx_lv2_audio_signal_real_run_inter(AgsRecall *recall)
     ags_recall_done(recall);
   }
   
-  /* unref */
-  if(source != NULL){
-    g_object_unref(source);
-  }
-
-  if(fx_lv2_audio != NULL){
-    g_object_unref(fx_lv2_audio);
-  }
-  
-  if(fx_lv2_channel != NULL){
-    g_object_unref(fx_lv2_channel);
-  }
-  
-  if(fx_lv2_channel_processor != NULL){
-    g_object_unref(fx_lv2_channel_processor);
-  }
-  
-  if(fx_lv2_recycling != NULL){
-    g_object_unref(fx_lv2_recycling);
-  }  
-  
   /* call parent */
   AGS_RECALL_CLASS(ags_fx_lv2_audio_signal_recall_audio_signal_class)->run_inter(recall);
 }
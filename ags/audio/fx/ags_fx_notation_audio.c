@@ -19,6 +19,8 @@
 
 #include <ags/audio/fx/ags_fx_notation_audio.h>
 
+#include <ags/audio/ags_audio_signal_pool.h>
+
 #include <ags/i18n.h>
 
 void ags_fx_notation_audio_class_init(AgsFxNotationAudioClass *fx_notation_audio);
@@ -34,10 +36,19 @@ void ags_fx_notation_audio_get_property(GObject *gobject,
 void ags_fx_notation_audio_dispose(GObject *gobject);
 void ags_fx_notation_audio_finalize(GObject *gobject);
 
+void ags_fx_notation_audio_notify_audio_callback(GObject *gobject,
+						GParamSpec *pspec,
+						gpointer user_data);
 void ags_fx_notation_audio_notify_output_soundcard_callback(GObject *gobject,
 							    GParamSpec *pspec,
 							    gpointer user_data);
 
+void ags_fx_notation_audio_set_audio_channels_callback(AgsAudio *audio,
+						       guint audio_channels, guint audio_channels_old,
+						       AgsFxNotationAudio *fx_notation_audio);
+
+void ags_fx_notation_audio_prepare_audio_signal_pool(AgsFxNotationAudio *fx_notation_audio);
+
 /**
  * SECTION:ags_fx_notation_audio
  * @short_description: fx notation audio
@@ -254,6 +265,9 @@ ags_fx_notation_audio_init(AgsFxNotationAudio *fx_notation_audio)
   gdouble bpm;
   gdouble delay;
 
+  g_signal_connect(fx_notation_audio, "notify::audio",
+		   G_CALLBACK(ags_fx_notation_audio_notify_audio_callback), NULL);
+
   g_signal_connect_after(fx_notation_audio, "notify::output-soundcard",
 			 G_CALLBACK(ags_fx_notation_audio_notify_output_soundcard_callback), NULL);
 
@@ -269,6 +283,10 @@ ags_fx_notation_audio_init(AgsFxNotationAudio *fx_notation_audio)
   
   fx_notation_audio->feed_note = NULL;
 
+  /* voices - allocated per audio channel off the audio thread */
+  fx_notation_audio->audio_channels = 0;
+  fx_notation_audio->audio_signal_pool = NULL;
+
   bpm = AGS_SOUNDCARD_DEFAULT_BPM;
   delay = AGS_SOUNDCARD_DEFAULT_DELAY;
 
@@ -736,6 +754,21 @@ ags_fx_notation_audio_dispose(GObject *gobject)
 
     fx_notation_audio->loop_end = NULL;
   }
+
+  if(fx_notation_audio->audio_signal_pool != NULL){
+    guint i;
+
+    for(i = 0; i < fx_notation_audio->audio_channels; i++){
+      if(fx_notation_audio->audio_signal_pool[i] != NULL){
+	g_object_unref(fx_notation_audio->audio_signal_pool[i]);
+      }
+    }
+
+    g_free(fx_notation_audio->audio_signal_pool);
+
+    fx_notation_audio->audio_channels = 0;
+    fx_notation_audio->audio_signal_pool = NULL;
+  }
   
   /* call parent */
   G_OBJECT_CLASS(ags_fx_notation_audio_parent_class)->dispose(gobject);
@@ -781,6 +814,18 @@ ags_fx_notation_audio_finalize(GObject *gobject)
     g_object_unref(fx_notation_audio->loop_end);
   }
 
+  if(fx_notation_audio->audio_signal_pool != NULL){
+    guint i;
+
+    for(i = 0; i < fx_notation_audio->audio_channels; i++){
+      if(fx_notation_audio->audio_signal_pool[i] != NULL){
+	g_object_unref(fx_notation_audio->audio_signal_pool[i]);
+      }
+    }
+
+    g_free(fx_notation_audio->audio_signal_pool);
+  }
+
   /* call parent */
   G_OBJECT_CLASS(ags_fx_notation_audio_parent_class)->finalize(gobject);
 }
@@ -1171,6 +1216,276 @@ ags_fx_notation_audio_notify_output_soundcard_callback(GObject *gobject,
 
     g_object_unref(port);
   }
+
+  /* voices */
+  ags_fx_notation_audio_prepare_audio_signal_pool(fx_notation_audio);
+}
+
+void
+ags_fx_notation_audio_notify_audio_callback(GObject *gobject,
+					    GParamSpec *pspec,
+					    gpointer user_data)
+{
+  AgsAudio *audio;
+  AgsFxNotationAudio *fx_notation_audio;
+
+  fx_notation_audio = AGS_FX_NOTATION_AUDIO(gobject);
+
+  /* get audio */
+  audio = NULL;
+
+  g_object_get(fx_notation_audio,
+	       "audio", &audio,
+	       NULL);
+
+  if(audio == NULL){
+    return;
+  }
+  
+  g_signal_connect_after((GObject *) audio, "set-audio-channels",
+			 G_CALLBACK(ags_fx_notation_audio_set_audio_channels_callback), fx_notation_audio);
+
+  /* voices */
+  ags_fx_notation_audio_prepare_audio_signal_pool(fx_notation_audio);
+
+  g_object_unref(audio);
+}
+
+void
+ags_fx_notation_audio_set_audio_channels_callback(AgsAudio *audio,
+						  guint audio_channels, guint audio_channels_old,
+						  AgsFxNotationAudio *fx_notation_audio)
+{
+  ags_fx_notation_audio_prepare_audio_signal_pool(fx_notation_audio);
+}
+
+void
+ags_fx_notation_audio_prepare_audio_signal_pool(AgsFxNotationAudio *fx_notation_audio)
+{
+  AgsAudio *audio;
+  
+  AgsConfig *config;
+
+  GObject *output_soundcard;
+  GObject **audio_signal_pool, **current_audio_signal_pool, **old_audio_signal_pool;
+
+  gchar *str;
+  
+  guint max_polyphony;
+  guint steal_policy;
+  guint audio_channels, current_audio_channels, old_audio_channels;
+  guint i;
+
+  GRecMutex *recall_mutex;
+
+  recall_mutex = AGS_RECALL_GET_OBJ_MUTEX(fx_notation_audio);
+
+  config = ags_config_get_instance();
+
+  /* max polyphony and steal policy */
+  max_polyphony = AGS_AUDIO_SIGNAL_POOL_DEFAULT_MAX_POLYPHONY;
+
+  str = ags_config_get_value(config,
+			     AGS_CONFIG_RECALL,
+			     "max-polyphony");
+
+  if(str != NULL){
+    max_polyphony = (guint) g_ascii_strtoull(str,
+					     NULL,
+					     10);
+
+    g_free(str);
+  }
+
+  steal_policy = AGS_AUDIO_SIGNAL_POOL_STEAL_OLDEST;
+
+  str = ags_config_get_value(config,
+			     AGS_CONFIG_RECALL,
+			     "voice-steal-policy");
+
+  if(str != NULL){
+    if(!g_ascii_strncasecmp(str,
+			    "none",
+			    5)){
+      steal_policy = AGS_AUDIO_SIGNAL_POOL_STEAL_NONE;
+    }
+
+    g_free(str);
+  }
+
+  audio = NULL;
+
+  output_soundcard = NULL;
+  
+  g_object_get(fx_notation_audio,
+	       "audio", &audio,
+	       "output-soundcard", &output_soundcard,
+	       NULL);
+
+  audio_channels = 0;
+
+  if(audio != NULL){
+    g_object_get(audio,
+		 "audio-channels", &audio_channels,
+		 NULL);
+  }
+
+  /* one pool per audio channel, 0 max polyphony disables voice pool */
+  audio_signal_pool = NULL;
+
+  if(max_polyphony == 0 ||
+     output_soundcard == NULL){
+    audio_channels = 0;
+  }
+
+  /* reference the current pools */
+  g_rec_mutex_lock(recall_mutex);
+
+  current_audio_channels = fx_notation_audio->audio_channels;
+  current_audio_signal_pool = fx_notation_audio->audio_signal_pool;
+
+  old_audio_channels = current_audio_channels;
+  old_audio_signal_pool = NULL;
+
+  if(old_audio_channels > 0){
+    old_audio_signal_pool = (GObject **) g_malloc0(old_audio_channels * sizeof(GObject *));
+
+    for(i = 0; i < old_audio_channels; i++){
+      old_audio_signal_pool[i] = current_audio_signal_pool[i];
+
+      if(old_audio_signal_pool[i] != NULL){
+	g_object_ref(old_audio_signal_pool[i]);
+      }
+    }
+  }
+  
+  g_rec_mutex_unlock(recall_mutex);
+
+  if(audio_channels > 0){
+    audio_signal_pool = (GObject **) g_malloc0(audio_channels * sizeof(GObject *));
+  }
+  
+  for(i = 0; i < audio_channels; i++){
+    GObject *current_output_soundcard;
+
+    /* reuse pool of matching soundcard */
+    if(i < old_audio_channels &&
+       old_audio_signal_pool[i] != NULL){
+      current_output_soundcard = NULL;
+      
+      g_object_get(old_audio_signal_pool[i],
+		   "output-soundcard", &current_output_soundcard,
+		   NULL);
+
+      if(current_output_soundcard != NULL){
+	g_object_unref(current_output_soundcard);
+      }
+
+      if(current_output_soundcard == output_soundcard){
+	audio_signal_pool[i] = old_audio_signal_pool[i];
+	g_object_ref(audio_signal_pool[i]);
+
+	g_object_set(audio_signal_pool[i],
+		     "max-polyphony", max_polyphony,
+		     "steal-policy", steal_policy,
+		     NULL);
+	
+	continue;
+      }
+    }
+    
+    /* twice max polyphony leaves room for voices waiting to be released */
+    audio_signal_pool[i] = (GObject *) ags_audio_signal_pool_new(output_soundcard);
+    g_object_set(audio_signal_pool[i],
+		 "max-polyphony", max_polyphony,
+		 "steal-policy", steal_policy,
+		 NULL);
+	
+    ags_audio_signal_pool_prealloc((AgsAudioSignalPool *) audio_signal_pool[i],
+				   2 * max_polyphony,
+				   AGS_AUDIO_SIGNAL_POOL_DEFAULT_STREAM_LENGTH);
+  }
+
+  /* publish, unless prepared concurrently */
+  g_rec_mutex_lock(recall_mutex);
+
+  if(fx_notation_audio->audio_signal_pool == current_audio_signal_pool){
+    fx_notation_audio->audio_channels = audio_channels;
+    fx_notation_audio->audio_signal_pool = audio_signal_pool;
+  }else{
+    current_audio_channels = audio_channels;
+    current_audio_signal_pool = audio_signal_pool;
+  }
+  
+  g_rec_mutex_unlock(recall_mutex);
+
+  /* the recyclings keep the pools of playing voices */
+  for(i = 0; i < current_audio_channels; i++){
+    if(current_audio_signal_pool[i] != NULL){
+      g_object_unref(current_audio_signal_pool[i]);
+    }
+  }
+
+  g_free(current_audio_signal_pool);
+
+  for(i = 0; i < old_audio_channels; i++){
+    if(old_audio_signal_pool[i] != NULL){
+      g_object_unref(old_audio_signal_pool[i]);
+    }
+  }
+
+  g_free(old_audio_signal_pool);
+  
+  if(audio != NULL){
+    g_object_unref(audio);
+  }
+
+  if(output_soundcard != NULL){
+    g_object_unref(output_soundcard);
+  }
+}
+
+/**
+ * ags_fx_notation_audio_get_audio_signal_pool:
+ * @fx_notation_audio: the #AgsFxNotationAudio
+ * @audio_channel: the audio channel
+ * 
+ * Get the voice pool shared by all pads of @audio_channel. The voices are
+ * preallocated as the audio, audio channels or output soundcard is set, rather
+ * than on the audio thread.
+ * 
+ * Returns: (transfer full): the #AgsAudioSignalPool or %NULL
+ * 
+ * Since: 9.1.0
+ */
+GObject*
+ags_fx_notation_audio_get_audio_signal_pool(AgsFxNotationAudio *fx_notation_audio,
+					    guint audio_channel)
+{
+  GObject *audio_signal_pool;
+  
+  GRecMutex *recall_mutex;
+
+  if(!AGS_IS_FX_NOTATION_AUDIO(fx_notation_audio)){
+    return(NULL);
+  }
+
+  recall_mutex = AGS_RECALL_GET_OBJ_MUTEX(fx_notation_audio);
+
+  audio_signal_pool = NULL;
+  
+  g_rec_mutex_lock(recall_mutex);
+
+  if(audio_channel < fx_notation_audio->audio_channels &&
+     fx_notation_audio->audio_signal_pool[audio_channel] != NULL){
+    audio_signal_pool = fx_notation_audio->audio_signal_pool[audio_channel];
+
+    g_object_ref(audio_signal_pool);
+  }
+  
+  g_rec_mutex_unlock(recall_mutex);
+
+  return(audio_signal_pool);
 }
 
 /**
@@ -78,6 +78,9 @@ struct _AgsFxNotationAudio
   AgsPort *loop;
   AgsPort *loop_start;
   AgsPort *loop_end;
+
+  guint audio_channels;
+  GObject **audio_signal_pool;
 };
 
 struct _AgsFxNotationAudioClass
@@ -107,6 +110,10 @@ void ags_fx_notation_audio_add_feed_note(AgsFxNotationAudio *fx_notation_audio,
 void ags_fx_notation_audio_remove_feed_note(AgsFxNotationAudio *fx_notation_audio,
 					    AgsNote *note);
 
+/* voices */
+GObject* ags_fx_notation_audio_get_audio_signal_pool(AgsFxNotationAudio *fx_notation_audio,
+						     guint audio_channel);
+
 /* instantiate */
 AgsFxNotationAudio* ags_fx_notation_audio_new(AgsAudio *audio);
 
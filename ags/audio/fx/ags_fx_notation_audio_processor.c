@@ -24,6 +24,7 @@
 #include <ags/audio/ags_channel.h>
 #include <ags/audio/ags_recycling.h>
 #include <ags/audio/ags_audio_signal.h>
+#include <ags/audio/ags_audio_signal_pool.h>
 #include <ags/audio/ags_port.h>
 #include <ags/audio/ags_notation.h>
 #include <ags/audio/ags_note.h>
@@ -55,6 +56,8 @@ gdouble ags_fx_notation_audio_processor_get_tact(AgsTactable *tactable);
 void ags_fx_notation_audio_processor_change_bpm(AgsTactable *tactable, gdouble new_bpm, gdouble old_bpm);
 void ags_fx_notation_audio_processor_change_tact(AgsTactable *tactable, gdouble new_tact, gdouble old_tact);
 
+void ags_fx_notation_audio_processor_attach_audio_signal_pool(AgsFxNotationAudioProcessor *fx_notation_audio_processor);
+
 void ags_fx_notation_audio_processor_run_init_pre(AgsRecall *recall);
 void ags_fx_notation_audio_processor_run_inter(AgsRecall *recall);
 
@@ -596,6 +599,9 @@ ags_fx_notation_audio_processor_run_init_pre(AgsRecall *recall)
     
   ags_frame_clock_start(fx_notation_audio_processor->frame_clock);
 
+  /* voices - attach only, no allocation on the audio thread */
+  ags_fx_notation_audio_processor_attach_audio_signal_pool(fx_notation_audio_processor);
+  
   if(output_soundcard != NULL){
     g_object_unref(output_soundcard);
   }
@@ -604,13 +610,135 @@ ags_fx_notation_audio_processor_run_init_pre(AgsRecall *recall)
   AGS_RECALL_CLASS(ags_fx_notation_audio_processor_parent_class)->run_init_pre(recall);
 }
 
+void
+ags_fx_notation_audio_processor_attach_audio_signal_pool(AgsFxNotationAudioProcessor *fx_notation_audio_processor)
+{
+  AgsAudio *audio;
+  AgsChannel *start_input;
+  AgsChannel *input, *next_input;
+  AgsFxNotationAudio *fx_notation_audio;
+
+  GObject *audio_signal_pool;
+  
+  guint audio_channel;
+
+  audio = NULL;
+  
+  start_input = NULL;
+
+  fx_notation_audio = NULL;
+  
+  g_object_get(fx_notation_audio_processor,
+	       "audio", &audio,
+	       "recall-audio", &fx_notation_audio,
+	       "audio-channel", &audio_channel,
+	       NULL);
+
+  /* the voices of the audio channel are preallocated by the recall audio */
+  audio_signal_pool = ags_fx_notation_audio_get_audio_signal_pool(fx_notation_audio,
+								  audio_channel);
+
+  if(fx_notation_audio != NULL){
+    g_object_unref(fx_notation_audio);
+  }
+  
+  if(audio == NULL ||
+     audio_signal_pool == NULL){
+    if(audio != NULL){
+      g_object_unref(audio);
+    }
+
+    if(audio_signal_pool != NULL){
+      g_object_unref(audio_signal_pool);
+    }
+    
+    return;
+  }
+  
+  g_object_get(audio,
+	       "input", &start_input,
+	       NULL);
+
+  input = ags_channel_nth(start_input,
+			  audio_channel);
+
+  while(input != NULL){
+    AgsRecycling *first_recycling, *last_recycling;
+    AgsRecycling *recycling, *next_recycling;
+    AgsRecycling *end_recycling;
+    
+    first_recycling = NULL;
+    last_recycling = NULL;
+    
+    g_object_get(input,
+		 "first-recycling", &first_recycling,
+		 "last-recycling", &last_recycling,
+		 NULL);
+
+    end_recycling = ags_recycling_next(last_recycling);
+
+    recycling = first_recycling;
+
+    if(recycling != NULL){
+      g_object_ref(recycling);
+    }
+
+    while(recycling != NULL &&
+	  recycling != end_recycling){
+      /* all pads of the audio channel share the pool */
+      ags_recycling_set_audio_signal_pool(recycling,
+					  audio_signal_pool);
+      
+      /* iterate */
+      next_recycling = ags_recycling_next(recycling);
+
+      g_object_unref(recycling);
+
+      recycling = next_recycling;
+    }
+
+    if(recycling != NULL){
+      g_object_unref(recycling);
+    }
+
+    if(first_recycling != NULL){
+      g_object_unref(first_recycling);
+    }
+
+    if(last_recycling != NULL){
+      g_object_unref(last_recycling);
+    }
+
+    if(end_recycling != NULL){
+      g_object_unref(end_recycling);
+    }
+    
+    /* iterate */
+    next_input = ags_channel_next_pad(input);
+
+    g_object_unref(input);
+
+    input = next_input;
+  }
+
+  g_object_unref(audio);
+
+  g_object_unref(audio_signal_pool);
+
+  if(start_input != NULL){
+    g_object_unref(start_input);
+  }
+}
+
 void
 ags_fx_notation_audio_processor_run_inter(AgsRecall *recall)
 {
   AgsFxNotationAudio *fx_notation_audio;
   AgsFxNotationAudioProcessor *fx_notation_audio_processor;
   AgsRecallID *recall_id;
-  AgsRecyclingContext *parent_recycling_context, *recycling_context;
+  AgsRecyclingContext *parent_recycling_context;
+  AgsPort *port;
+  AgsRecallRtView *rt_view;
 
   GObject *output_soundcard;
 
@@ -621,53 +749,33 @@ ags_fx_notation_audio_processor_run_inter(AgsRecall *recall)
 
   GValue value = {0,};
   
-  GRecMutex *fx_notation_audio_processor_mutex;
+  GRecMutex *fx_notation_audio_mutex;
   
   fx_notation_audio_processor = AGS_FX_NOTATION_AUDIO_PROCESSOR(recall);
-  
-  fx_notation_audio_processor_mutex = AGS_RECALL_GET_OBJ_MUTEX(fx_notation_audio_processor);
 
-  recall_id = NULL;
+  /* read rt view, the recall holds the references */
+  rt_view = AGS_RECALL_RT_VIEW(recall);
 
-  sound_scope = ags_recall_get_sound_scope(recall);
+  recall_id = rt_view->recall_id;
 
-  g_object_get(recall,
-	       "recall-id", &recall_id,
-	       NULL);
+  sound_scope = ags_recall_get_sound_scope(recall);
 
 #if AGS_DEBUG
   g_message("run_inter() sound scope: [%d]", sound_scope);
 #endif
   
   if(!ags_recall_id_check_sound_scope(recall_id, sound_scope)){
-    if(recall_id != NULL){
-      g_object_unref(recall_id);
-    }
-
     AGS_RECALL_CLASS(ags_fx_notation_audio_processor_parent_class)->run_inter(recall);
     
     return;
   }
 
-  output_soundcard = NULL;
+  output_soundcard = rt_view->output_soundcard;
 
-  fx_notation_audio = NULL;
+  fx_notation_audio = (AgsFxNotationAudio *) rt_view->recall_audio;
   
-  recycling_context = NULL;
-  parent_recycling_context = NULL;
-
-  g_object_get(recall,
-	       "output-soundcard", &output_soundcard,
-	       "recall-audio", &fx_notation_audio,
-	       NULL);
-
-  g_object_get(recall_id,
-	       "recycling-context", &recycling_context,
-	       NULL);
+  parent_recycling_context = rt_view->parent_recycling_context;
 
-  g_object_get(recycling_context,
-	       "parent", &parent_recycling_context,
-	       NULL);
   /* loop */
   do_loop = FALSE;
   
@@ -675,12 +783,14 @@ ags_fx_notation_audio_processor_run_inter(AgsRecall *recall)
   loop_end = AGS_FX_NOTATION_AUDIO_DEFAULT_LOOP_END;
   
   if(fx_notation_audio != NULL){
-    AgsPort *port;
+    fx_notation_audio_mutex = AGS_RECALL_GET_OBJ_MUTEX(fx_notation_audio);
 
     /* loop */
-    g_object_get(fx_notation_audio,
-		 "loop", &port,
-		 NULL);
+    g_rec_mutex_lock(fx_notation_audio_mutex);
+
+    port = fx_notation_audio->loop;
+    
+    g_rec_mutex_unlock(fx_notation_audio_mutex);
 
     if(port != NULL){
       g_value_init(&value,
@@ -691,14 +801,14 @@ ags_fx_notation_audio_processor_run_inter(AgsRecall *recall)
 
       do_loop = g_value_get_boolean(&value);
       g_value_unset(&value);
-
-      g_object_unref(port);
     }
 
     /* loop-start */
-    g_object_get(fx_notation_audio,
-		 "loop-start", &port,
-		 NULL);
+    g_rec_mutex_lock(fx_notation_audio_mutex);
+
+    port = fx_notation_audio->loop_start;
+    
+    g_rec_mutex_unlock(fx_notation_audio_mutex);
 
     if(port != NULL){
       g_value_init(&value,
@@ -709,14 +819,14 @@ ags_fx_notation_audio_processor_run_inter(AgsRecall *recall)
 
       loop_start = g_value_get_uint64(&value);
       g_value_unset(&value);
-
-      g_object_unref(port);
     }
 
     /* loop-end */
-    g_object_get(fx_notation_audio,
-		 "loop-end", &port,
-		 NULL);
+    g_rec_mutex_lock(fx_notation_audio_mutex);
+
+    port = fx_notation_audio->loop_end;
+    
+    g_rec_mutex_unlock(fx_notation_audio_mutex);
 
     if(port != NULL){
       g_value_init(&value,
@@ -727,8 +837,6 @@ ags_fx_notation_audio_processor_run_inter(AgsRecall *recall)
 
       loop_end = g_value_get_uint64(&value);
       g_value_unset(&value);
-
-      g_object_unref(port);
     }
   }
   
@@ -770,22 +878,6 @@ ags_fx_notation_audio_processor_run_inter(AgsRecall *recall)
   
   /* counter change */
   ags_fx_notation_audio_processor_counter_change(fx_notation_audio_processor);
-
-  if(output_soundcard != NULL){
-    g_object_unref(output_soundcard);
-  }
-
-  if(recall_id != NULL){
-    g_object_unref(recall_id);
-  }
-
-  if(recycling_context != NULL){
-    g_object_unref(recycling_context);
-  }
-
-  if(parent_recycling_context != NULL){
-    g_object_unref(parent_recycling_context);
-  }
   
   /* call parent */
   AGS_RECALL_CLASS(ags_fx_notation_audio_processor_parent_class)->run_inter(recall);
@@ -1039,6 +1131,10 @@ ags_fx_notation_audio_processor_real_key_on(AgsFxNotationAudioProcessor *fx_nota
     while(recycling != end_recycling){
       AgsAudioSignal *template, *audio_signal;
 
+      GObject *audio_signal_pool;
+
+      gboolean dropped;
+      
       GRecMutex *recycling_mutex;
 
       recycling_mutex = AGS_RECYCLING_GET_OBJ_MUTEX(recycling);
@@ -1049,17 +1145,61 @@ ags_fx_notation_audio_processor_real_key_on(AgsFxNotationAudioProcessor *fx_nota
       
       g_rec_mutex_unlock(recycling_mutex);
       
-      /* create audio signal */
-      audio_signal = ags_audio_signal_new((GObject *) output_soundcard,
-					  (GObject *) recycling,
-					  (GObject *) child_recall_id);
-      ags_audio_signal_set_flags(audio_signal, (AGS_AUDIO_SIGNAL_STREAM |
-						AGS_AUDIO_SIGNAL_SLICE_ALLOC));
-
-      ags_audio_signal_set_key_format(audio_signal,
-				      AGS_SOUND_KEY_FORMAT_256TH);
-      ags_audio_signal_set_stream_mode(audio_signal,
-				       AGS_AUDIO_SIGNAL_STREAM_CONTINUES_FEED);
+      /* acquire voice, feeding audio signals are kept by the processor */
+      audio_signal = NULL;
+      
+      dropped = FALSE;
+      
+      audio_signal_pool = NULL;
+
+      if(key_mode != AGS_FX_NOTATION_AUDIO_PROCESSOR_KEY_MODE_FEED){
+	audio_signal_pool = ags_recycling_get_audio_signal_pool(recycling);
+      }
+      
+      if(audio_signal_pool != NULL){
+	audio_signal = ags_audio_signal_pool_acquire((AgsAudioSignalPool *) audio_signal_pool,
+						     &dropped);
+
+	g_object_unref(audio_signal_pool);
+      }
+
+      if(dropped){
+	/* iterate */
+	next_recycling = ags_recycling_next(recycling);
+
+	g_object_unref(recycling);
+
+	recycling = next_recycling;
+
+	continue;
+      }
+      
+      if(audio_signal != NULL){
+	g_object_set(audio_signal,
+		     "recycling", recycling,
+		     "recall-id", child_recall_id,
+		     NULL);
+      }else{
+	/* create audio signal */
+	audio_signal = ags_audio_signal_new((GObject *) output_soundcard,
+					    (GObject *) recycling,
+					    (GObject *) child_recall_id);
+	ags_audio_signal_set_flags(audio_signal, (AGS_AUDIO_SIGNAL_STREAM |
+						  AGS_AUDIO_SIGNAL_SLICE_ALLOC |
+						  AGS_AUDIO_SIGNAL_STREAM_BLOCK));
+
+	ags_audio_signal_set_key_format(audio_signal,
+					AGS_SOUND_KEY_FORMAT_256TH);
+	ags_audio_signal_set_stream_mode(audio_signal,
+					 AGS_AUDIO_SIGNAL_STREAM_CONTINUES_FEED);
+
+	ags_audio_signal_stream_resize(audio_signal,
+				       2);
+      
+	audio_signal->stream_current = audio_signal->stream;
+
+	ags_connectable_connect(AGS_CONNECTABLE(audio_signal));
+      }
       
       g_object_set(audio_signal,
 		   "default-template", template,
@@ -1069,13 +1209,6 @@ ags_fx_notation_audio_processor_real_key_on(AgsFxNotationAudioProcessor *fx_nota
 		   "frame-count", 0,
 		   NULL);
 
-      ags_audio_signal_stream_resize(audio_signal,
-				     2);
-      
-      audio_signal->stream_current = audio_signal->stream;
-
-      ags_connectable_connect(AGS_CONNECTABLE(audio_signal));
-
       ags_recycling_add_audio_signal(recycling,
 				     audio_signal);
       
@@ -1258,7 +1391,8 @@ ags_fx_notation_audio_processor_real_play(AgsFxNotationAudioProcessor *fx_notati
 
   AgsTimestamp *timestamp;
   
-  GList *start_notation, *notation;
+  GObject *notation;
+
   GList *start_note, *note;
 
   guint64 note_256th_offset[16] = {0,};
@@ -1331,29 +1465,23 @@ ags_fx_notation_audio_processor_real_play(AgsFxNotationAudioProcessor *fx_notati
     has_16th_pulse = TRUE;
   }
 
-  start_notation = ags_audio_get_notation(audio);
-
   ags_timestamp_set_ags_offset(timestamp,
 			       (guint64) (AGS_NOTATION_DEFAULT_OFFSET * floor(note_offset / AGS_NOTATION_DEFAULT_OFFSET)));
     
   /* find near timestamp */
-  notation = ags_notation_find_near_timestamp(start_notation, audio_channel,
-					      timestamp);
+  notation = ags_audio_find_notation_near_timestamp(audio, audio_channel,
+						    timestamp);
 
   note = 
     start_note = NULL;
     
+  /* indexed lookup of the notes starting within range */
   if(notation != NULL){
     note = 
-      start_note = ags_notation_get_note(notation->data);
+      start_note = ags_notation_find_note_256th_range((AgsNotation *) notation,
+						      note_256th_offset_lower, note_256th_offset_upper,
+						      FALSE);
   }
-
-#if 1
-  if(start_note != NULL){
-    note = ags_note_find_range_x_256th(start_note,
-				       note_256th_offset_lower, note_256th_offset_upper);
-  }
-#endif
   
   while(note != NULL){
     AgsNote *current;
@@ -1392,8 +1520,9 @@ ags_fx_notation_audio_processor_real_play(AgsFxNotationAudioProcessor *fx_notati
     note = note->next;
   }
 
-  g_list_free_full(start_notation,
-		   (GDestroyNotify) g_object_unref);
+  if(notation != NULL){
+    g_object_unref(notation);
+  }
 
   g_list_free_full(start_note,
 		   (GDestroyNotify) g_object_unref);
@@ -1435,7 +1564,6 @@ ags_fx_notation_audio_processor_real_midi1_record(AgsFxNotationAudioProcessor *f
   GObject *output_soundcard;
   GObject *input_sequencer;
 
-  GList *start_notation, *notation;
   GList *start_note, *note;
   GList *start_recording_note, *recording_note;	
 
@@ -1521,13 +1649,8 @@ ags_fx_notation_audio_processor_real_midi1_record(AgsFxNotationAudioProcessor *f
 
   current_notation = NULL;
   
-  start_notation = NULL;
   start_note = NULL;
 
-  g_object_get(audio,
-	       "notation", &start_notation,
-	       NULL);
-
   /* get delay */
   delay = AGS_SOUNDCARD_DEFAULT_DELAY;
 
@@ -1584,12 +1707,8 @@ ags_fx_notation_audio_processor_real_midi1_record(AgsFxNotationAudioProcessor *f
 						AGS_SOUND_BEHAVIOUR_PATTERN_MODE);
   
   /* find near timestamp */
-  notation = ags_notation_find_near_timestamp(start_notation, audio_channel,
-					      timestamp);
-
-  if(notation != NULL){
-    current_notation = notation->data;
-  }
+  current_notation = (AgsNotation *) ags_audio_find_notation_near_timestamp(audio, audio_channel,
+									     timestamp);
  
   /* retrieve buffer */
   midi_buffer = ags_sequencer_get_buffer(AGS_SEQUENCER(input_sequencer),
@@ -1922,8 +2041,9 @@ ags_fx_notation_audio_processor_real_midi1_record(AgsFxNotationAudioProcessor *f
     g_object_unref(input_sequencer);
   }
   
-  g_list_free_full(start_notation,
-		   (GDestroyNotify) g_object_unref);
+  if(current_notation != NULL){
+    g_object_unref(current_notation);
+  }
 
   g_list_free_full(start_note,
 		   (GDestroyNotify) g_object_unref);
@@ -1957,7 +2077,6 @@ ags_fx_notation_audio_processor_real_midi2_record(AgsFxNotationAudioProcessor *f
   GObject *output_soundcard;
   GObject *input_sequencer;
 
-  GList *start_notation, *notation;
   GList *start_note, *note;
   GList *start_recording_note, *recording_note;	
 
@@ -2046,13 +2165,8 @@ ags_fx_notation_audio_processor_real_midi2_record(AgsFxNotationAudioProcessor *f
 
   current_notation = NULL;
   
-  start_notation = NULL;
   start_note = NULL;
 
-  g_object_get(audio,
-	       "notation", &start_notation,
-	       NULL);
-
   /* get delay */
   delay = AGS_SOUNDCARD_DEFAULT_DELAY;
 
@@ -2109,12 +2223,8 @@ ags_fx_notation_audio_processor_real_midi2_record(AgsFxNotationAudioProcessor *f
 						AGS_SOUND_BEHAVIOUR_PATTERN_MODE);
   
   /* find near timestamp */
-  notation = ags_notation_find_near_timestamp(start_notation, audio_channel,
-					      timestamp);
-
-  if(notation != NULL){
-    current_notation = notation->data;
-  }
+  current_notation = (AgsNotation *) ags_audio_find_notation_near_timestamp(audio, audio_channel,
+									     timestamp);
  
   /* retrieve buffer */
   midi_buffer = ags_sequencer_get_buffer(AGS_SEQUENCER(input_sequencer),
@@ -2841,8 +2951,9 @@ ags_fx_notation_audio_processor_real_midi2_record(AgsFxNotationAudioProcessor *f
     g_object_unref(input_sequencer);
   }
   
-  g_list_free_full(start_notation,
-		   (GDestroyNotify) g_object_unref);
+  if(current_notation != NULL){
+    g_object_unref(current_notation);
+  }
 
   g_list_free_full(start_note,
 		   (GDestroyNotify) g_object_unref);
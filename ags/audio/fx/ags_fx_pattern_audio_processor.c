@@ -895,7 +895,8 @@ ags_fx_pattern_audio_processor_real_key_on(AgsFxPatternAudioProcessor *fx_patter
 					  (GObject *) recycling,
 					  (GObject *) child_recall_id);
       ags_audio_signal_set_flags(audio_signal, (AGS_AUDIO_SIGNAL_STREAM |
-						AGS_AUDIO_SIGNAL_SLICE_ALLOC));
+						AGS_AUDIO_SIGNAL_SLICE_ALLOC |
+						AGS_AUDIO_SIGNAL_STREAM_BLOCK));
       g_object_set(audio_signal,
 		   "default-template", template,
 		   "note", note,
@@ -20,6 +20,7 @@
 #include <ags/audio/fx/ags_fx_playback_audio_processor.h>
 
 #include <ags/audio/ags_wave.h>
+#include <ags/audio/ags_wave_stream.h>
 
 #include <ags/audio/fx/ags_fx_playback_audio.h>
 
@@ -237,6 +238,9 @@ ags_fx_playback_audio_processor_init(AgsFxPlaybackAudioProcessor *fx_playback_au
 
   /* capture */
   fx_playback_audio_processor->capture_audio_signal = NULL;
+
+  /* wave stream */
+  fx_playback_audio_processor->stream_buffer = ags_buffer_new();
 }
 
 void
@@ -301,6 +305,11 @@ ags_fx_playback_audio_processor_finalize(GObject *gobject)
     g_list_free_full(fx_playback_audio_processor->capture_audio_signal,
 		     (GDestroyNotify) g_object_unref);
   }
+
+  /* wave stream */
+  if(fx_playback_audio_processor->stream_buffer != NULL){
+    g_object_unref(fx_playback_audio_processor->stream_buffer);
+  }
   
   /* call parent */
   G_OBJECT_CLASS(ags_fx_playback_audio_processor_parent_class)->finalize(gobject);
@@ -1139,8 +1148,10 @@ ags_fx_playback_audio_processor_real_play(AgsFxPlaybackAudioProcessor *fx_playba
 
   AgsTimestamp *timestamp;
   
-  GList *start_wave, *wave;
+  GObject *wave;
 
+  GList *wave_stream;
+  
   guint audio_channel;
   guint64 relative_offset;
   guint64 x_offset;
@@ -1150,6 +1161,7 @@ ags_fx_playback_audio_processor_real_play(AgsFxPlaybackAudioProcessor *fx_playba
   guint frame_count;
   
   GRecMutex *fx_playback_audio_processor_mutex;
+  GRecMutex *audio_mutex;
 
   fx_playback_audio_processor_mutex = AGS_RECALL_GET_OBJ_MUTEX(fx_playback_audio_processor);
 
@@ -1186,19 +1198,13 @@ ags_fx_playback_audio_processor_real_play(AgsFxPlaybackAudioProcessor *fx_playba
   }
   
   /* find wave - attempt #0 */
-  start_wave = NULL;
-  
-  g_object_get(audio,
-	       "wave", &start_wave,
-	       NULL);
-  
-  wave = ags_wave_find_near_timestamp(start_wave, audio_channel,
-				      timestamp);
+  wave = ags_audio_find_wave_near_timestamp(audio, audio_channel,
+					    timestamp);
 
   if(wave != NULL){
     AgsBuffer *buffer;
 
-    buffer = ags_wave_find_point(wave->data,
+    buffer = ags_wave_find_point((AgsWave *) wave,
 				 x_offset,
 				 FALSE);
 
@@ -1207,6 +1213,8 @@ ags_fx_playback_audio_processor_real_play(AgsFxPlaybackAudioProcessor *fx_playba
 					       buffer,
 					       AGS_FX_PLAYBACK_AUDIO_PROCESSOR_DATA_MODE_PLAY);
     }
+
+    g_object_unref(wave);
   }
 
   /* find wave - attempt #1 */
@@ -1214,13 +1222,13 @@ ags_fx_playback_audio_processor_real_play(AgsFxPlaybackAudioProcessor *fx_playba
     ags_timestamp_set_ags_offset(timestamp,
 				 (guint64) (relative_offset * floor((double) (x_offset + buffer_size) / (double) relative_offset)));
 
-    wave = ags_wave_find_near_timestamp(start_wave, audio_channel,
-					timestamp);
+    wave = ags_audio_find_wave_near_timestamp(audio, audio_channel,
+					      timestamp);
 
     if(wave != NULL){
       AgsBuffer *buffer;
 
-      buffer = ags_wave_find_point(wave->data,
+      buffer = ags_wave_find_point((AgsWave *) wave,
 				   x_offset + buffer_size,
 				   FALSE);
 
@@ -1229,6 +1237,8 @@ ags_fx_playback_audio_processor_real_play(AgsFxPlaybackAudioProcessor *fx_playba
 						 buffer,
 						 AGS_FX_PLAYBACK_AUDIO_PROCESSOR_DATA_MODE_PLAY);
       }
+
+      g_object_unref(wave);
     }
   }
   
@@ -1238,13 +1248,13 @@ ags_fx_playback_audio_processor_real_play(AgsFxPlaybackAudioProcessor *fx_playba
     ags_timestamp_set_ags_offset(timestamp,
 				 (guint64) (relative_offset * floor((double) (x_offset - buffer_size) / (double) relative_offset)));
 
-    wave = ags_wave_find_near_timestamp(start_wave, audio_channel,
-					timestamp);
+    wave = ags_audio_find_wave_near_timestamp(audio, audio_channel,
+					      timestamp);
 
     if(wave != NULL){
       AgsBuffer *buffer;
 
-      buffer = ags_wave_find_point(wave->data,
+      buffer = ags_wave_find_point((AgsWave *) wave,
 				   x_offset - buffer_size,
 				   FALSE);
 
@@ -1253,16 +1263,98 @@ ags_fx_playback_audio_processor_real_play(AgsFxPlaybackAudioProcessor *fx_playba
 						 buffer,
 						 AGS_FX_PLAYBACK_AUDIO_PROCESSOR_DATA_MODE_PLAY);
       }
+
+      g_object_unref(wave);
     }
   }
+
+  /* wave stream - periods overlapping the current buffer, the list is iterated locked
+   * without references, so the stream is never finalized on the audio thread
+   */
+  audio_mutex = NULL;
+  wave_stream = NULL;
+  
+  if(audio != NULL){
+    audio_mutex = AGS_AUDIO_GET_OBJ_MUTEX(audio);
+
+    g_rec_mutex_lock(audio_mutex);
+
+    wave_stream = audio->wave_stream;
+  }
+
+  while(wave_stream != NULL){
+    AgsWaveStream *current_wave_stream;
+    AgsBuffer *stream_buffer;
+
+    guint64 stream_x_offset;
+    guint64 stream_frame_count;
+    guint64 period;
+    guint stream_buffer_size;
+    guint i;
+    
+    current_wave_stream = AGS_WAVE_STREAM(wave_stream->data);
+
+    stream_x_offset = ags_wave_stream_get_x_offset(current_wave_stream);
+    stream_frame_count = ags_wave_stream_get_frame_count(current_wave_stream);
+
+    stream_buffer_size = current_wave_stream->buffer_size;
+    
+    if(audio_channel >= ags_wave_stream_get_audio_channels(current_wave_stream) ||
+       stream_x_offset >= x_offset + buffer_size ||
+       stream_x_offset + stream_frame_count <= x_offset){
+      wave_stream = wave_stream->next;
+
+      continue;
+    }
+
+    stream_buffer = fx_playback_audio_processor->stream_buffer;
+    
+    g_object_set(stream_buffer,
+		 "samplerate", current_wave_stream->samplerate,
+		 "buffer-size", stream_buffer_size,
+		 "format", current_wave_stream->format,
+		 NULL);
+    
+    period = 0;
+
+    if(x_offset > stream_x_offset){
+      period = (x_offset - stream_x_offset) / stream_buffer_size;
+    }
+    
+    for(i = 0; i < 2; i++){
+      guint64 stream_offset;
+
+      stream_offset = (period + i) * stream_buffer_size;
+
+      if(stream_x_offset + stream_offset >= x_offset + buffer_size){
+	break;
+      }
+      
+      if(ags_wave_stream_read(current_wave_stream,
+			      audio_channel,
+			      stream_offset,
+			      stream_buffer->data)){
+	g_object_set(stream_buffer,
+		     "x", stream_x_offset + stream_offset,
+		     NULL);
+	
+	ags_fx_playback_audio_processor_data_put(fx_playback_audio_processor,
+						 stream_buffer,
+						 AGS_FX_PLAYBACK_AUDIO_PROCESSOR_DATA_MODE_PLAY);
+      }
+    }
+    
+    wave_stream = wave_stream->next;
+  }
+
+  if(audio_mutex != NULL){
+    g_rec_mutex_unlock(audio_mutex);
+  }
   
   /* unref */
   if(audio != NULL){
     g_object_unref(audio);
   }
-
-  g_list_free_full(start_wave,
-		   (GDestroyNotify) g_object_unref);
 }
 
 void
@@ -1294,7 +1386,7 @@ ags_fx_playback_audio_processor_real_record(AgsFxPlaybackAudioProcessor *fx_play
   
   GObject *output_soundcard, *input_soundcard;
 
-  GList *start_wave, *wave;
+  GObject *wave;
 
   gpointer data, file_data;
 
@@ -1345,12 +1437,9 @@ ags_fx_playback_audio_processor_real_record(AgsFxPlaybackAudioProcessor *fx_play
   buffer_size = AGS_SOUNDCARD_DEFAULT_BUFFER_SIZE;
   format = AGS_SOUNDCARD_DEFAULT_FORMAT;
   
-  start_wave = NULL;
-
   start_input = NULL;
   
   g_object_get(audio,
-	       "wave", &start_wave,
 	       "input", &start_input,
 	       "samplerate", &target_samplerate,
 	       "buffer-size", &target_buffer_size,
@@ -1575,8 +1664,8 @@ ags_fx_playback_audio_processor_real_record(AgsFxPlaybackAudioProcessor *fx_play
     /* find wave - attempt #0 */
     current_wave = NULL;
   
-    wave = ags_wave_find_near_timestamp(start_wave, audio_channel,
-					timestamp);
+    wave = ags_audio_find_wave_near_timestamp(audio, audio_channel,
+					      timestamp);
 
     buffer = NULL;
 
@@ -1602,7 +1691,7 @@ ags_fx_playback_audio_processor_real_record(AgsFxPlaybackAudioProcessor *fx_play
 
       g_object_unref(current_timestamp);
     }else{
-      current_wave = wave->data;
+      current_wave = (AgsWave *) wave;
     
       buffer = ags_wave_find_point(current_wave,
 				   x_buffer_offset_0,
@@ -1684,12 +1773,17 @@ ags_fx_playback_audio_processor_real_record(AgsFxPlaybackAudioProcessor *fx_play
 
       ags_soundcard_unlock_buffer(AGS_SOUNDCARD(input_soundcard), data);
       g_rec_mutex_unlock(buffer_mutex);
+
+      ags_wave_invalidate_peak(current_wave,
+			       x_buffer_offset_0 + attack, frame_count);
   
       /* data put */
       ags_fx_playback_audio_processor_data_put(fx_playback_audio_processor,
 					       buffer,
 					       AGS_FX_PLAYBACK_AUDIO_PROCESSOR_DATA_MODE_PLAY);
     }
+
+    g_object_unref(current_wave);
     
     /* find wave - attempt #1 */
     if(attack != 0 ||
@@ -1697,8 +1791,8 @@ ags_fx_playback_audio_processor_real_record(AgsFxPlaybackAudioProcessor *fx_play
       ags_timestamp_set_ags_offset(timestamp,
 				   (guint64) (relative_offset * floor((double) (x_offset + frame_count) / (double) relative_offset)));
 
-      wave = ags_wave_find_near_timestamp(start_wave, audio_channel,
-					  timestamp);
+      wave = ags_audio_find_wave_near_timestamp(audio, audio_channel,
+						timestamp);
 
       buffer = NULL;
   
@@ -1724,7 +1818,7 @@ ags_fx_playback_audio_processor_real_record(AgsFxPlaybackAudioProcessor *fx_play
 
 	g_object_unref(current_timestamp);
       }else{
-	current_wave = wave->data;
+	current_wave = (AgsWave *) wave;
     
 	buffer = ags_wave_find_point(current_wave,
 				     x_buffer_offset_1,
@@ -1765,12 +1859,17 @@ ags_fx_playback_audio_processor_real_record(AgsFxPlaybackAudioProcessor *fx_play
 
 	ags_soundcard_unlock_buffer(AGS_SOUNDCARD(input_soundcard), data);
 	g_rec_mutex_unlock(buffer_mutex);
+
+	ags_wave_invalidate_peak(current_wave,
+				 x_buffer_offset_1, attack);
   
 	/* data put */
 	ags_fx_playback_audio_processor_data_put(fx_playback_audio_processor,
 						 buffer,
 						 AGS_FX_PLAYBACK_AUDIO_PROCESSOR_DATA_MODE_PLAY);
       }
+
+      g_object_unref(current_wave);
     }
   }
   
@@ -1795,9 +1894,6 @@ ags_fx_playback_audio_processor_real_record(AgsFxPlaybackAudioProcessor *fx_play
     g_object_unref(input);
   }
   
-  g_list_free_full(start_wave,
-		   (GDestroyNotify) g_object_unref);
-
   if(fx_playback_audio != NULL){
     g_object_unref(fx_playback_audio);
   }
@@ -79,6 +79,8 @@ struct _AgsFxPlaybackAudioProcessor
 
   GList *capture_audio_signal;
 
+  AgsBuffer *stream_buffer;
+  
   AgsAudioBufferUtil audio_buffer_util;
   AgsResampleUtil resample_util;
 };
@@ -141,11 +141,16 @@ ags_fx_volume_audio_signal_real_run_inter(AgsRecall *recall)
   AgsFxVolumeRecycling *fx_volume_recycling;
   AgsFxVolumeAudioSignal *fx_volume_audio_signal;
   
+  gfloat *ramp;
+
   guint buffer_size;
   guint format;
+  guint word_size;
+  guint ramp_length;
   gdouble volume;
   gboolean muted;
 
+  GRecMutex *source_mutex;
   GRecMutex *stream_mutex;
   
   source = NULL;
@@ -160,27 +165,43 @@ ags_fx_volume_audio_signal_real_run_inter(AgsRecall *recall)
   format = AGS_SOUNDCARD_DEFAULT_FORMAT;
   
   volume = 1.0;
+
+  ramp = NULL;
+  ramp_length = 0;
   
   muted = FALSE;
 
-  g_object_get(recall,
-	       "parent", &fx_volume_recycling,
-	       "source", &source,
-	       NULL);
+  /* read rt view, the recall tree holds the references */
+  fx_volume_recycling = (AgsFxVolumeRecycling *) AGS_RECALL_RT_VIEW(recall)->parent;
+  source = (AgsAudioSignal *) AGS_RECALL_RT_VIEW(recall)->source;
+
+  if(fx_volume_recycling != NULL){
+    fx_volume_channel_processor = (AgsFxVolumeChannelProcessor *) AGS_RECALL_RT_VIEW(fx_volume_recycling)->parent;
+  }
+
+  if(fx_volume_channel_processor != NULL){
+    fx_volume_audio = (AgsFxVolumeAudio *) AGS_RECALL_RT_VIEW(fx_volume_channel_processor)->recall_audio;
+    fx_volume_channel = (AgsFxVolumeChannel *) AGS_RECALL_RT_VIEW(fx_volume_channel_processor)->recall_channel;
+  }
+
+  if(source == NULL){
+    ags_recall_done(recall);
+
+    /* call parent */
+    AGS_RECALL_CLASS(ags_fx_volume_audio_signal_parent_class)->run_inter(recall);
 
-  g_object_get(fx_volume_recycling,
-	       "parent", &fx_volume_channel_processor,
-	       NULL);
+    return;
+  }
 
-  g_object_get(fx_volume_channel_processor,
-	       "recall-audio", &fx_volume_audio,
-	       "recall-channel", &fx_volume_channel,
-	       NULL);
+  source_mutex = AGS_AUDIO_SIGNAL_GET_OBJ_MUTEX(source);
 
-  g_object_get(source,
-	       "buffer-size", &buffer_size,
-	       "format", &format,
-	       NULL);
+  g_rec_mutex_lock(source_mutex);
+
+  buffer_size = source->buffer_size;
+  format = source->format;
+  word_size = source->word_size;
+  
+  g_rec_mutex_unlock(source_mutex);
   
   if(fx_volume_audio != NULL){
     AgsPort *port;
@@ -247,7 +268,11 @@ ags_fx_volume_audio_signal_real_run_inter(AgsRecall *recall)
 			   &value);
 
 	volume = g_value_get_float(&value);
-      
+
+	/* automated per frame, valid until next automate */
+	ramp = ags_port_get_automation_ramp(port,
+					    &ramp_length);
+	
 	g_object_unref(port);
       }
 
@@ -273,7 +298,25 @@ ags_fx_volume_audio_signal_real_run_inter(AgsRecall *recall)
     g_rec_mutex_lock(stream_mutex);
 
     if(!muted){
-      ags_volume_util_compute(&(fx_volume_audio_signal->volume_util));
+      if(ramp != NULL &&
+	 ramp_length > 0){
+	guint offset;
+
+	/* sub-block wise to avoid zipper noise */
+	for(offset = 0; offset < buffer_size; offset += AGS_AUTOMATION_CURSOR_DEFAULT_SUB_BLOCK_SIZE){
+	  fx_volume_audio_signal->volume_util.destination = ((guchar *) source->stream_current->data) + (offset * word_size);
+	  fx_volume_audio_signal->volume_util.source = ((guchar *) source->stream_current->data) + (offset * word_size);
+
+	  fx_volume_audio_signal->volume_util.buffer_length = MIN(AGS_AUTOMATION_CURSOR_DEFAULT_SUB_BLOCK_SIZE,
+								  buffer_size - offset);
+
+	  fx_volume_audio_signal->volume_util.volume = ramp[((guint64) offset * ramp_length) / buffer_size];
+
+	  ags_volume_util_compute(&(fx_volume_audio_signal->volume_util));
+	}
+      }else{
+	ags_volume_util_compute(&(fx_volume_audio_signal->volume_util));
+      }
     }else{
       ags_audio_buffer_util_clear_buffer(&(fx_volume_audio_signal->audio_buffer_util),
 					 source->stream_current->data, 1,
@@ -289,27 +332,6 @@ ags_fx_volume_audio_signal_real_run_inter(AgsRecall *recall)
     ags_recall_done(recall);
   }
 
-  /* unref */
-  if(source != NULL){
-    g_object_unref(source);
-  }
-  
-  if(fx_volume_audio != NULL){
-    g_object_unref(fx_volume_audio);
-  }
-  
-  if(fx_volume_channel != NULL){
-    g_object_unref(fx_volume_channel);
-  }
-
-  if(fx_volume_channel_processor != NULL){
-    g_object_unref(fx_volume_channel_processor);
-  }
-
-  if(fx_volume_recycling != NULL){
-    g_object_unref(fx_volume_recycling);
-  }
-  
   /* call parent */
   AGS_RECALL_CLASS(ags_fx_volume_audio_signal_parent_class)->run_inter(recall);
 }
@@ -35,6 +35,8 @@
 #include <jack/types.h>
 #endif
 
+#include <string.h>
+
 #include <ags/i18n.h>
 
 void ags_jack_client_class_init(AgsJackClientClass *jack_client);
@@ -283,6 +285,12 @@ ags_jack_client_init(AgsJackClient *jack_client)
   ags_atomic_int_set(&(jack_client->queued),
 		   0);
 
+  jack_client->xrun_count = 0;
+  jack_client->underrun_count = 0;
+
+  ags_atomic_uint_set(&(jack_client->silence_port_count),
+		      0);
+
   jack_client->audio_buffer_util = ags_audio_buffer_util_alloc();
 }
 
@@ -827,7 +835,7 @@ ags_jack_client_test_flags(AgsJackClient *jack_client, AgsJackClientFlags flags)
   /* test */
   g_rec_mutex_lock(jack_client_mutex);
 
-  retval = (flags & (jack_client->flags)) ? TRUE: FALSE;
+  retval = (flags & (ags_atomic_int_get(&(jack_client->flags)))) ? TRUE: FALSE;
   
   g_rec_mutex_unlock(jack_client_mutex);
 
@@ -860,7 +868,8 @@ ags_jack_client_set_flags(AgsJackClient *jack_client, AgsJackClientFlags flags)
   /* set flags */
   g_rec_mutex_lock(jack_client_mutex);
 
-  jack_client->flags |= flags;
+  ags_atomic_int_or(&(jack_client->flags),
+		    flags);
   
   g_rec_mutex_unlock(jack_client_mutex);
 }
@@ -891,7 +900,8 @@ ags_jack_client_unset_flags(AgsJackClient *jack_client, AgsJackClientFlags flags
   /* unset flags */
   g_rec_mutex_lock(jack_client_mutex);
 
-  jack_client->flags &= (~flags);
+  ags_atomic_int_and(&(jack_client->flags),
+		     (~flags));
   
   g_rec_mutex_unlock(jack_client_mutex);
 }
@@ -1270,6 +1280,47 @@ ags_jack_client_deactivate(AgsJackClient *jack_client)
   ags_jack_client_unset_flags(jack_client, AGS_JACK_CLIENT_ACTIVATED);
 }
 
+/**
+ * ags_jack_client_get_xrun_count:
+ * @jack_client: the #AgsJackClient
+ *
+ * Get the count of xruns reported by the JACK server.
+ *
+ * Returns: the xrun count
+ *
+ * Since: 9.1.0
+ */
+guint
+ags_jack_client_get_xrun_count(AgsJackClient *jack_client)
+{
+  if(!AGS_IS_JACK_CLIENT(jack_client)){
+    return(0);
+  }
+
+  return(ags_atomic_uint_get(&(jack_client->xrun_count)));
+}
+
+/**
+ * ags_jack_client_get_underrun_count:
+ * @jack_client: the #AgsJackClient
+ *
+ * Get the count of process cycles skipped because @jack_client was
+ * locked. The output ports were silenced during these cycles.
+ *
+ * Returns: the underrun count
+ *
+ * Since: 9.1.0
+ */
+guint
+ags_jack_client_get_underrun_count(AgsJackClient *jack_client)
+{
+  if(!AGS_IS_JACK_CLIENT(jack_client)){
+    return(0);
+  }
+
+  return(ags_atomic_uint_get(&(jack_client->underrun_count)));
+}
+
 /**
  * ags_jack_client_add_device:
  * @jack_client: the #AgsJackClient
@@ -1336,6 +1387,10 @@ ags_jack_client_remove_device(AgsJackClient *jack_client,
     jack_client->device = g_list_remove(jack_client->device,
 					jack_device);
     g_object_unref(jack_device);
+
+    /* the process callback collects the output ports again */
+    ags_atomic_uint_set(&(jack_client->silence_port_count),
+			0);
   }
 
   g_rec_mutex_unlock(jack_client_mutex);
@@ -1405,6 +1460,10 @@ ags_jack_client_remove_port(AgsJackClient *jack_client,
     jack_client->port = g_list_remove(jack_client->port,
 				      jack_port);
     g_object_unref(jack_port);
+
+    /* the process callback collects the output ports again */
+    ags_atomic_uint_set(&(jack_client->silence_port_count),
+			0);
   }
   
   g_rec_mutex_unlock(jack_client_mutex);
@@ -1428,7 +1487,8 @@ ags_jack_client_shutdown(void *ptr)
   /* unset flags */
   g_rec_mutex_lock(jack_client_mutex);
   
-  jack_client->flags &= (~AGS_JACK_CLIENT_ACTIVATED);
+  ags_atomic_int_and(&(jack_client->flags),
+		     (~AGS_JACK_CLIENT_ACTIVATED));
 
   port =
     port_start = g_list_copy(jack_client->port);
@@ -1447,41 +1507,32 @@ ags_jack_client_shutdown(void *ptr)
 int
 ags_jack_client_process_callback(jack_nframes_t nframes, void *ptr)
 {
-  AgsJackServer *jack_server;
   AgsJackClient *jack_client;
   AgsJackPort *jack_port;
   AgsJackDevout *jack_devout;
   AgsJackDevin *jack_devin;
   AgsJackMidiin *jack_midiin;
-  
-  AgsAudioLoop *audio_loop;
-
-  AgsTaskLauncher *task_launcher;
 
-  AgsApplicationContext *application_context;
+  AgsRingBuffer *ring_buffer;
   
-  jack_client_t *client;
   jack_default_audio_sample_t *out, *in;
   jack_midi_event_t in_event;
 
-  GList *device_start, *device;
-  GList *port_start, *port;
+  GList *device;
+  GList *port;
 
   void *port_buf;
+  guint8 *midi_period;
+  gfloat *period;
 
   jack_nframes_t event_count;
-  guint time_spent;
-  guint copy_mode;
-  guint word_size;
-  guint event_size;
-  guint i, j;
-  guint nth_buffer;
-  gboolean no_event;
+  guint32 midi_period_length;
+  guint pcm_channels;
+  guint count;
+  guint silence_port_count;
+  guint i, j, k;
   
   GRecMutex *jack_client_mutex;
-  GRecMutex *device_mutex;
-  GMutex *callback_mutex;
-  GMutex *callback_finish_mutex;
   
   if(ptr == NULL){
     return(0);
@@ -1492,545 +1543,195 @@ ags_jack_client_process_callback(jack_nframes_t nframes, void *ptr)
   /* get jack client mutex */
   jack_client_mutex = AGS_JACK_CLIENT_GET_OBJ_MUTEX(jack_client);
 
-  /* get jack server */
-  g_rec_mutex_lock(jack_client_mutex);
-
-  jack_server = (AgsJackServer *) jack_client->jack_server;
-
-  device_start = g_list_copy(jack_client->device);
-
-  g_rec_mutex_unlock(jack_client_mutex);
+  /* never block the process thread - output silence if devices are just modified */
+  if(!g_rec_mutex_trylock(jack_client_mutex)){
+    silence_port_count = ags_atomic_uint_get(&(jack_client->silence_port_count));
 
-  /* get application context */
-  application_context = ags_application_context_get_instance();
+    for(i = 0; i < silence_port_count; i++){
+      out = jack_port_get_buffer(jack_client->silence_port[i],
+				 nframes);
 
-  if(ags_atomic_int_get(&(jack_client->queued)) > 0){
-    g_warning("drop JACK callback");
+      if(out != NULL){
+	memset(out, 0, nframes * sizeof(jack_default_audio_sample_t));
+      }
+    }
     
-    return(0);
-  }else{
-    ags_atomic_int_increment(&(jack_client->queued));
-  }
-
-  /*
-   * process audio
-   */
-  /*  */
-  audio_loop = (AgsAudioLoop *) ags_concurrency_provider_get_main_loop(AGS_CONCURRENCY_PROVIDER(application_context));
-  task_launcher = ags_concurrency_provider_get_task_launcher(AGS_CONCURRENCY_PROVIDER(application_context));
-
-  device = device_start;
-  
-  if(device == NULL){
-    ags_atomic_int_decrement(&(jack_client->queued));
-
-    g_object_unref(audio_loop);
-    g_object_unref(task_launcher);
+    ags_atomic_uint_increment(&(jack_client->underrun_count));
     
     return(0);
   }
 
-  ags_thread_set_flags((AgsThread *) audio_loop, AGS_THREAD_TIME_ACCOUNTING);
+  silence_port_count = 0;
 
   /*
-   * process MIDI and audio input
+   * The devices hand over interleaved float periods by an AgsRingBuffer-struct, so this
+   * callback neither waits for the engine nor allocates. Device fields are stable while
+   * the device is playing or recording.
    */
-  /* get device */
-  device = device_start;  
+  device = jack_client->device;
 
   while(device != NULL){
-    /* get device mutex */
-    if(AGS_IS_JACK_MIDIIN(device->data)){
-      device_mutex = AGS_JACK_MIDIIN_GET_OBJ_MUTEX(device->data);
-    }else{
-      device = device->next;
-
-      continue;
-    }
-    
-    /*  */
-    g_rec_mutex_lock(device_mutex);
-
-    jack_midiin = NULL;
-
+    /* MIDI input */
     if(AGS_IS_JACK_MIDIIN(device->data)){
       jack_midiin = (AgsJackMidiin *) device->data;
 
-      /* wait callback */      
-      no_event = TRUE;
-      
-      if((AGS_JACK_MIDIIN_PASS_THROUGH & (ags_atomic_int_get(&(jack_midiin->sync_flags)))) == 0){
-	callback_mutex = &(jack_midiin->callback_mutex);
-
-	g_rec_mutex_unlock(device_mutex);
-	
-	/* give back computing time until ready */
-	g_mutex_lock(callback_mutex);
-    
-	if((AGS_JACK_MIDIIN_CALLBACK_DONE & (ags_atomic_int_get(&(jack_midiin->sync_flags)))) == 0){
-	  ags_atomic_int_or(&(jack_midiin->sync_flags),
-			  AGS_JACK_MIDIIN_CALLBACK_WAIT);
-    
-	  while((AGS_JACK_MIDIIN_CALLBACK_DONE & (ags_atomic_int_get(&(jack_midiin->sync_flags)))) == 0 &&
-		(AGS_JACK_MIDIIN_CALLBACK_WAIT & (ags_atomic_int_get(&(jack_midiin->sync_flags)))) != 0){
-	    g_cond_wait(&(jack_midiin->callback_cond),
-			callback_mutex);
-	  }
-	}
-    
-	ags_atomic_int_and(&(jack_midiin->sync_flags),
-			 (~(AGS_JACK_MIDIIN_CALLBACK_WAIT |
-			    AGS_JACK_MIDIIN_CALLBACK_DONE)));
-	  
-	g_mutex_unlock(callback_mutex);
+      ring_buffer = (AgsRingBuffer *) ags_atomic_pointer_get(&(jack_midiin->ring_buffer));
 
-	no_event = FALSE;
+      if((AGS_JACK_MIDIIN_PASS_THROUGH & (ags_atomic_int_get(&(jack_midiin->sync_flags)))) == 0 &&
+	 ring_buffer != NULL){
+	midi_period = (guint8 *) ags_ring_buffer_get_write_period(ring_buffer);
+	midi_period_length = 0;
 	
-	g_rec_mutex_lock(device_mutex);
-      }
-      
-      /* MIDI input */
-      if(jack_midiin != NULL){
-	if(!no_event){
-	  port = jack_midiin->jack_port;
+	port = jack_midiin->jack_port;
 
-	  for(i = 0; port != NULL; i++){
-	    jack_port = port->data;
+	while(port != NULL){
+	  jack_port = port->data;
 
-	    port_buf = jack_port_get_buffer(jack_port->port,
-					    4096);
-	    event_count = jack_midi_get_event_count(port_buf);
+	  port_buf = jack_port_get_buffer(jack_port->port,
+					  nframes);
+	  event_count = jack_midi_get_event_count(port_buf);
 		
-	    for(j = 0; j < event_count; j++){
-	      jack_midi_event_get(&in_event, port_buf, j);
+	  for(j = 0; j < event_count; j++){
+	    jack_midi_event_get(&in_event, port_buf, j);
 
-	      if(in_event.size > 0){
-		nth_buffer = 0;
-		
-		if(jack_midiin->app_buffer_mode == AGS_JACK_MIDIIN_APP_BUFFER_0){
-		  nth_buffer = 1;
-		}else if(jack_midiin->app_buffer_mode == AGS_JACK_MIDIIN_APP_BUFFER_1){
-		  nth_buffer = 2;
-		}else if(jack_midiin->app_buffer_mode == AGS_JACK_MIDIIN_APP_BUFFER_2){
-		  nth_buffer = 3;
-		}else if(jack_midiin->app_buffer_mode == AGS_JACK_MIDIIN_APP_BUFFER_3){
-		  nth_buffer = 0;
-		}
-		
-		if(jack_midiin->app_buffer_size[nth_buffer] + in_event.size >= jack_midiin->allocated_app_buffer_size[nth_buffer]){
-		  if(jack_midiin->app_buffer[nth_buffer] == NULL){
-		    jack_midiin->app_buffer[nth_buffer] = (char *) g_malloc(AGS_JACK_MIDIIN_DEFAULT_BUFFER_SIZE * sizeof(char));
-		  }else{
-		    jack_midiin->app_buffer[nth_buffer] = (char *) g_realloc(jack_midiin->app_buffer[nth_buffer],
-									     (jack_midiin->allocated_app_buffer_size[nth_buffer] + AGS_JACK_MIDIIN_DEFAULT_BUFFER_SIZE) * sizeof(char));
-		  }
-		  
-		  memset(jack_midiin->app_buffer[nth_buffer] + jack_midiin->allocated_app_buffer_size[nth_buffer], 0, AGS_JACK_MIDIIN_DEFAULT_BUFFER_SIZE * sizeof(char));
-
-		  jack_midiin->allocated_app_buffer_size[nth_buffer] = 
-		    jack_midiin->allocated_app_buffer_size[nth_buffer] = jack_midiin->allocated_app_buffer_size[nth_buffer] + AGS_JACK_MIDIIN_DEFAULT_BUFFER_SIZE;
-		}
-
-		memcpy(jack_midiin->app_buffer[nth_buffer] + jack_midiin->app_buffer_size[nth_buffer], in_event.buffer, in_event.size);
-		
-		jack_midiin->app_buffer_size[nth_buffer] = jack_midiin->app_buffer_size[nth_buffer] + in_event.size;
-	      }
-	    }	  
+	    if(in_event.size == 0){
+	      continue;
+	    }
+	    
+	    if(midi_period == NULL ||
+	       sizeof(guint32) + midi_period_length + in_event.size > ring_buffer->period_size){
+	      ags_atomic_uint_increment(&(jack_midiin->overrun_count));
 
-	    jack_midi_clear_buffer(port_buf);
-	
-	    port = port->next;
-	  }
+	      continue;
+	    }
 
-	  /* signal finish */
-	  callback_finish_mutex = &(jack_midiin->callback_finish_mutex);
-	
-	  g_mutex_lock(callback_finish_mutex);
+	    memcpy(midi_period + sizeof(guint32) + midi_period_length, in_event.buffer, in_event.size);
 
-	  ags_atomic_int_or(&(jack_midiin->sync_flags),
-			  AGS_JACK_MIDIIN_CALLBACK_FINISH_DONE);
-    
-	  if((AGS_JACK_MIDIIN_CALLBACK_FINISH_WAIT & (ags_atomic_int_get(&(jack_midiin->sync_flags)))) != 0){
-	    g_cond_signal(&(jack_midiin->callback_finish_cond));
-	  }
+	    midi_period_length += in_event.size;
+	  }	  
 
-	  g_mutex_unlock(callback_finish_mutex);
+	  port = port->next;
 	}
-      }
-    }
-        
-    g_rec_mutex_unlock(device_mutex);
 
-    /* iterate */
-    device = device->next;
-  }
+	if(midi_period_length > 0){
+	  memcpy(midi_period, &midi_period_length, sizeof(guint32));
 
-  /*
-   * process audio input
-   */
-  /* get device */
-  device = device_start;  
-
-  while(device != NULL){
-    if(AGS_IS_JACK_DEVIN(device->data)){
-      device_mutex = AGS_JACK_DEVIN_GET_OBJ_MUTEX(device->data);
-    }else{
-      device = device->next;
-
-      continue;
+	  ags_ring_buffer_commit_write(ring_buffer);
+	}
+      }
     }
 
-    /*  */
-    g_rec_mutex_lock(device_mutex);
-
-    jack_devin = NULL;
-    
+    /* audio input */
     if(AGS_IS_JACK_DEVIN(device->data)){
       jack_devin = (AgsJackDevin *) device->data;
 
-      /* wait callback */      
-      no_event = TRUE;
+      ring_buffer = (AgsRingBuffer *) ags_atomic_pointer_get(&(jack_devin->ring_buffer));
 
-      if((AGS_JACK_DEVIN_PASS_THROUGH & (ags_atomic_int_get(&(jack_devin->sync_flags)))) == 0){
-	callback_mutex = &(jack_devin->callback_mutex);
+      if((AGS_JACK_DEVIN_PASS_THROUGH & (ags_atomic_int_get(&(jack_devin->sync_flags)))) == 0 &&
+	 ring_buffer != NULL){
+	period = (gfloat *) ags_ring_buffer_get_write_period(ring_buffer);
 
-	g_rec_mutex_unlock(device_mutex);
-	
-	/* give back computing time until ready */
-	g_mutex_lock(callback_mutex);
-    
-	if((AGS_JACK_DEVIN_CALLBACK_DONE & (ags_atomic_int_get(&(jack_devin->sync_flags)))) == 0){
-	  ags_atomic_int_or(&(jack_devin->sync_flags),
-			  AGS_JACK_DEVIN_CALLBACK_WAIT);
-    
-	  while((AGS_JACK_DEVIN_CALLBACK_DONE & (ags_atomic_int_get(&(jack_devin->sync_flags)))) == 0 &&
-		(AGS_JACK_DEVIN_CALLBACK_WAIT & (ags_atomic_int_get(&(jack_devin->sync_flags)))) != 0){
-	    g_cond_wait(&(jack_devin->callback_cond),
-			callback_mutex);
-	  }
-	}
-    
-	ags_atomic_int_and(&(jack_devin->sync_flags),
-			 (~(AGS_JACK_DEVIN_CALLBACK_WAIT |
-			    AGS_JACK_DEVIN_CALLBACK_DONE)));
-    
-	g_mutex_unlock(callback_mutex);
+	if(period != NULL){
+	  pcm_channels = jack_devin->pcm_channels;
+	  count = MIN(nframes, jack_devin->buffer_size);
 
-	no_event = FALSE;
-
-	g_rec_mutex_lock(device_mutex);
-      }
+	  memset(period, 0, pcm_channels * jack_devin->buffer_size * sizeof(gfloat));
+	  
+	  port = jack_devin->jack_port;
       
-      /* get buffer */
-      if(jack_devin->app_buffer_mode == AGS_JACK_DEVIN_APP_BUFFER_0){
-	nth_buffer = 1;
-      }else if(jack_devin->app_buffer_mode == AGS_JACK_DEVIN_APP_BUFFER_1){
-	nth_buffer = 2;
-      }else if(jack_devin->app_buffer_mode == AGS_JACK_DEVIN_APP_BUFFER_2){
-	nth_buffer = 3;
-      }else if(jack_devin->app_buffer_mode == AGS_JACK_DEVIN_APP_BUFFER_3){
-	nth_buffer = 0;
-      }else{
-	/* iterate */
-	g_rec_mutex_unlock(device_mutex);
-	
-	device = device->next;
-	
-	continue;
-      }
-
-      /* get copy mode */
-      copy_mode = ags_audio_buffer_util_get_copy_mode_from_format(jack_client->audio_buffer_util,
-								  ags_audio_buffer_util_format_from_soundcard(jack_client->audio_buffer_util,
-													      jack_devin->format),
-								  AGS_AUDIO_BUFFER_UTIL_FLOAT);
-
-      /* check buffer flag */
-      switch(jack_devin->format){
-      case AGS_SOUNDCARD_SIGNED_8_BIT:
-	{
-	  word_size = sizeof(gint8);
-	}
-	break;
-      case AGS_SOUNDCARD_SIGNED_16_BIT:
-	{
-	  word_size = sizeof(gint16);
-	}
-	break;
-      case AGS_SOUNDCARD_SIGNED_24_BIT:
-	{
-	  word_size = sizeof(gint32);
-	}
-	break;
-      case AGS_SOUNDCARD_SIGNED_32_BIT:
-	{
-	  word_size = sizeof(gint32);
-	}
-	break;
-      case AGS_SOUNDCARD_SIGNED_64_BIT:
-	{
-	  word_size = sizeof(gint64);
-	}
-	break;
-      default:
-	g_rec_mutex_unlock(device_mutex);
-	
-	/* iterate */
-	device = device->next;
+	  for(i = 0; port != NULL && i < pcm_channels; i++){
+	    jack_port = port->data;
 	
-	continue;
-      }
+	    in = jack_port_get_buffer(jack_port->port,
+				      nframes);
 
-      /* retrieve buffer */
-      port = jack_devin->jack_port;
-      
-      for(i = 0; port != NULL; i++){
-	jack_port = port->data;
-	
-	in = jack_port_get_buffer(jack_port->port,
-				  jack_devin->buffer_size);
-	
-	if(!no_event && in != NULL){
-	  ags_soundcard_lock_buffer(AGS_SOUNDCARD(jack_devin), jack_devin->app_buffer[nth_buffer]);
-	    
-	  ags_audio_buffer_util_copy_buffer_to_buffer(jack_client->audio_buffer_util,
-						      jack_devin->app_buffer[nth_buffer], jack_devin->pcm_channels, i,
-						      in, 1, 0,
-						      jack_devin->buffer_size, copy_mode);
+	    if(in != NULL){
+	      /* interleave */
+	      for(j = 0, k = i; j < count; j++, k += pcm_channels){
+		period[k] = in[j];
+	      }
+	    }
 	    
-	  ags_soundcard_unlock_buffer(AGS_SOUNDCARD(jack_devin), jack_devin->app_buffer[nth_buffer]);	    
-	}
-
-	port = port->next;
-      }
-
-      /* clear buffer */
-      port = jack_devin->jack_port;
-      
-      for(i = 0; port != NULL; i++){
-	jack_port = port->data;
-	
-	out = jack_port_get_buffer(jack_port->port,
-				   jack_devin->buffer_size);
-
-	if(out != NULL){
-	  ags_audio_buffer_util_clear_float(jack_client->audio_buffer_util,
-					    out, 1,
-					    jack_devin->buffer_size);
-	}
-
-	port = port->next;
-      }
-    
-      if(!no_event){
-	/* signal finish */
-	callback_finish_mutex = &(jack_devin->callback_finish_mutex);
-	
-	g_mutex_lock(callback_finish_mutex);
+	    port = port->next;
+	  }
 
-	ags_atomic_int_or(&(jack_devin->sync_flags),
-			AGS_JACK_DEVIN_CALLBACK_FINISH_DONE);
-    
-	if((AGS_JACK_DEVIN_CALLBACK_FINISH_WAIT & (ags_atomic_int_get(&(jack_devin->sync_flags)))) != 0){
-	  g_cond_signal(&(jack_devin->callback_finish_cond));
+	  ags_ring_buffer_commit_write(ring_buffer);
+	}else{
+	  ags_atomic_uint_increment(&(jack_devin->overrun_count));
 	}
-
-	g_mutex_unlock(callback_finish_mutex);
       }
     }
-        
-    g_rec_mutex_unlock(device_mutex);
 
-    /* iterate */
-    device = device->next;
-  }
-  
-  /*
-   * process audio output
-   */
-  /* get device */
-  device = device_start;  
-
-  while(device != NULL){
-    if(AGS_IS_JACK_DEVOUT(device->data)){
-      device_mutex = AGS_JACK_DEVOUT_GET_OBJ_MUTEX(device->data);
-    }else{
-      device = device->next;
-
-      continue;
-    }
-
-    /*  */
-    g_rec_mutex_lock(device_mutex);
-
-    jack_devout = NULL;
-    
+    /* audio output */
     if(AGS_IS_JACK_DEVOUT(device->data)){
       jack_devout = (AgsJackDevout *) device->data;
 
-      /* wait callback */      
-      no_event = TRUE;
-
-      if((AGS_JACK_DEVOUT_PASS_THROUGH & (ags_atomic_int_get(&(jack_devout->sync_flags)))) == 0){
-	callback_mutex = &(jack_devout->callback_mutex);
+      ring_buffer = (AgsRingBuffer *) ags_atomic_pointer_get(&(jack_devout->ring_buffer));
 
-	g_rec_mutex_unlock(device_mutex);
-	
-	/* give back computing time until ready */
-	g_mutex_lock(callback_mutex);
-    
-	if((AGS_JACK_DEVOUT_CALLBACK_DONE & (ags_atomic_int_get(&(jack_devout->sync_flags)))) == 0){
-	  ags_atomic_int_or(&(jack_devout->sync_flags),
-			  AGS_JACK_DEVOUT_CALLBACK_WAIT);
-    
-	  while((AGS_JACK_DEVOUT_CALLBACK_DONE & (ags_atomic_int_get(&(jack_devout->sync_flags)))) == 0 &&
-		(AGS_JACK_DEVOUT_CALLBACK_WAIT & (ags_atomic_int_get(&(jack_devout->sync_flags)))) != 0){
-	    g_cond_wait(&(jack_devout->callback_cond),
-			callback_mutex);
-	  }
+      period = NULL;
+      
+      if((AGS_JACK_DEVOUT_PASS_THROUGH & (ags_atomic_int_get(&(jack_devout->sync_flags)))) == 0 &&
+	 ring_buffer != NULL){
+	period = (gfloat *) ags_ring_buffer_get_read_period(ring_buffer);
+
+	if(period != NULL){
+	  ags_atomic_int_and(&(jack_devout->sync_flags),
+			     (~AGS_JACK_DEVOUT_INITIAL_CALLBACK));
+	}else if((AGS_JACK_DEVOUT_INITIAL_CALLBACK & (ags_atomic_int_get(&(jack_devout->sync_flags)))) == 0){
+	  /* the engine didn't deliver in time, output silence */
+	  ags_atomic_uint_increment(&(jack_devout->underrun_count));
 	}
-    
-	ags_atomic_int_and(&(jack_devout->sync_flags),
-			 (~(AGS_JACK_DEVOUT_CALLBACK_WAIT |
-			    AGS_JACK_DEVOUT_CALLBACK_DONE)));
-    
-	g_mutex_unlock(callback_mutex);
-
-	no_event = FALSE;
-
-	g_rec_mutex_lock(device_mutex);
       }
 
-      /* clear buffer */
+      pcm_channels = jack_devout->pcm_channels;
+      count = MIN(nframes, jack_devout->buffer_size);
+      
       port = jack_devout->jack_port;
       
       for(i = 0; port != NULL; i++){
 	jack_port = port->data;
 	
 	out = jack_port_get_buffer(jack_port->port,
-				   jack_devout->buffer_size);
+				   nframes);
 
 	if(out != NULL){
-	  ags_audio_buffer_util_clear_float(jack_client->audio_buffer_util,
-					    out, 1,
-					    jack_devout->buffer_size);
-	}
-
-	port = port->next;
-      }
-      
-      /* get buffer */
-      if(jack_devout->app_buffer_mode == AGS_JACK_DEVOUT_APP_BUFFER_0){
-	nth_buffer = 3;
-      }else if(jack_devout->app_buffer_mode == AGS_JACK_DEVOUT_APP_BUFFER_1){
-	nth_buffer = 0;
-      }else if(jack_devout->app_buffer_mode == AGS_JACK_DEVOUT_APP_BUFFER_2){
-	nth_buffer = 1;
-      }else if(jack_devout->app_buffer_mode == AGS_JACK_DEVOUT_APP_BUFFER_3){
-	nth_buffer = 2;
-      }else{
-	/* iterate */
-	g_rec_mutex_unlock(device_mutex);
-	
-	device = device->next;
-	
-	continue;
-      }
-
-      /* get copy mode */
-      copy_mode = ags_audio_buffer_util_get_copy_mode_from_format(jack_client->audio_buffer_util,
-								  AGS_AUDIO_BUFFER_UTIL_FLOAT,
-								  ags_audio_buffer_util_format_from_soundcard(jack_client->audio_buffer_util,
-													      jack_devout->format));
-
-      /* check buffer flag */
-      switch(jack_devout->format){
-      case AGS_SOUNDCARD_SIGNED_8_BIT:
-	{
-	  word_size = sizeof(gint8);
-	}
-	break;
-      case AGS_SOUNDCARD_SIGNED_16_BIT:
-	{
-	  word_size = sizeof(gint16);
-	}
-	break;
-      case AGS_SOUNDCARD_SIGNED_24_BIT:
-	{
-	  word_size = sizeof(gint32);
-	}
-	break;
-      case AGS_SOUNDCARD_SIGNED_32_BIT:
-	{
-	  word_size = sizeof(gint32);
-	}
-	break;
-      case AGS_SOUNDCARD_SIGNED_64_BIT:
-	{
-	  word_size = sizeof(gint64);
-	}
-	break;
-      default:
-	g_rec_mutex_unlock(device_mutex);
-	
-	/* iterate */
-	device = device->next;
-	
-	continue;
-      }
-
-      /* fill buffer */
-      port = jack_devout->jack_port;
-      
-      for(i = 0; port != NULL; i++){
-	jack_port = port->data;
-	
-	out = jack_port_get_buffer(jack_port->port,
-				   jack_devout->buffer_size);
-	
-	if(!no_event && out != NULL){
-	  ags_soundcard_lock_buffer(AGS_SOUNDCARD(jack_devout), jack_devout->app_buffer[nth_buffer]);
-	    
-	  ags_audio_buffer_util_copy_buffer_to_buffer(jack_client->audio_buffer_util,
-						      out, 1, 0,
-						      jack_devout->app_buffer[nth_buffer], jack_devout->pcm_channels, i,
-						      jack_devout->buffer_size, copy_mode);
+	  /* remember the port to silence it in a skipped cycle */
+	  if(silence_port_count < AGS_JACK_CLIENT_MAX_SILENCE_PORT_COUNT){
+	    jack_client->silence_port[silence_port_count] = jack_port->port;
+	    silence_port_count++;
+	  }
 	  
-	  ags_soundcard_unlock_buffer(AGS_SOUNDCARD(jack_devout), jack_devout->app_buffer[nth_buffer]);	    
+	  if(period != NULL &&
+	     i < pcm_channels){
+	    /* deinterleave */
+	    for(j = 0, k = i; j < count; j++, k += pcm_channels){
+	      out[j] = period[k];
+	    }
+
+	    if(count < nframes){
+	      memset(out + count, 0, (nframes - count) * sizeof(jack_default_audio_sample_t));
+	    }
+	  }else{
+	    memset(out, 0, nframes * sizeof(jack_default_audio_sample_t));
+	  }
 	}
 
 	port = port->next;
       }
-    
-      if(!no_event){
-	/* signal finish */
-	callback_finish_mutex = &(jack_devout->callback_finish_mutex);
-	
-	g_mutex_lock(callback_finish_mutex);
-
-	ags_atomic_int_or(&(jack_devout->sync_flags),
-			AGS_JACK_DEVOUT_CALLBACK_FINISH_DONE);
-    
-	if((AGS_JACK_DEVOUT_CALLBACK_FINISH_WAIT & (ags_atomic_int_get(&(jack_devout->sync_flags)))) != 0){
-	  g_cond_signal(&(jack_devout->callback_finish_cond));
-	}
 
-	g_mutex_unlock(callback_finish_mutex);
+      if(period != NULL){
+	ags_ring_buffer_commit_read(ring_buffer);
       }
     }
-        
-    g_rec_mutex_unlock(device_mutex);
 
     /* iterate */
     device = device->next;
   }
 
-  g_list_free(device_start);
-  ags_atomic_int_decrement(&(jack_client->queued));
-
-  /* unref */
-  g_object_unref(audio_loop);
-  g_object_unref(task_launcher);
+  ags_atomic_uint_set(&(jack_client->silence_port_count),
+		      silence_port_count);
+  
+  g_rec_mutex_unlock(jack_client_mutex);
 
   return(0);
 }
@@ -2046,7 +1747,7 @@ ags_jack_client_xrun_callback(void *ptr)
 
   jack_client = (AgsJackClient *) ptr;
 
-  //TODO:JK: implement me
+  ags_atomic_uint_increment(&(jack_client->xrun_count));
   
   return(0);
 }
@@ -44,6 +44,8 @@ G_BEGIN_DECLS
 
 #define AGS_JACK_CLIENT_GET_OBJ_MUTEX(obj) (&(((AgsJackClient *) obj)->obj_mutex))
 
+#define AGS_JACK_CLIENT_MAX_SILENCE_PORT_COUNT (256)
+
 typedef struct _AgsJackClient AgsJackClient;
 typedef struct _AgsJackClientClass AgsJackClientClass;
 
@@ -85,6 +87,12 @@ struct _AgsJackClient
   
   _Atomic guint queued;
 
+  volatile guint xrun_count;
+  volatile guint underrun_count;
+
+  gpointer silence_port[AGS_JACK_CLIENT_MAX_SILENCE_PORT_COUNT];
+  _Atomic guint silence_port_count;
+
   AgsAudioBufferUtil *audio_buffer_util;
 };
 
@@ -122,6 +130,9 @@ void ags_jack_client_remove_port(AgsJackClient *jack_client,
 void ags_jack_client_activate(AgsJackClient *jack_client);
 void ags_jack_client_deactivate(AgsJackClient *jack_client);
 
+guint ags_jack_client_get_xrun_count(AgsJackClient *jack_client);
+guint ags_jack_client_get_underrun_count(AgsJackClient *jack_client);
+
 AgsJackClient* ags_jack_client_new(GObject *jack_server);
 
 G_END_DECLS
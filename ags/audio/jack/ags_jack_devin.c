@@ -148,6 +148,8 @@ enum{
   PROP_JACK_CLIENT,
   PROP_JACK_PORT,
   PROP_CHANNEL,
+  PROP_AHEAD_PERIOD_COUNT,
+  PROP_OVERRUN_COUNT,
 };
 
 static gpointer ags_jack_devin_parent_class = NULL;
@@ -415,6 +417,43 @@ ags_jack_devin_class_init(AgsJackDevinClass *jack_devin)
   g_object_class_install_property(gobject,
 				  PROP_JACK_PORT,
 				  param_spec);
+
+  /**
+   * AgsJackDevin:ahead-period-count:
+   *
+   * The count of captured periods the JACK process callback might queue
+   * before the engine records them.
+   * 
+   * Since: 9.1.0
+   */
+  param_spec = g_param_spec_uint("ahead-period-count",
+				 i18n_pspec("ahead period count"),
+				 i18n_pspec("The count of periods queued ahead"),
+				 1,
+				 AGS_JACK_DEVIN_MAX_AHEAD_PERIOD_COUNT,
+				 AGS_JACK_DEVIN_DEFAULT_AHEAD_PERIOD_COUNT,
+				 G_PARAM_READABLE | G_PARAM_WRITABLE);
+  g_object_class_install_property(gobject,
+				  PROP_AHEAD_PERIOD_COUNT,
+				  param_spec);
+
+  /**
+   * AgsJackDevin:overrun-count:
+   *
+   * The count of captured periods dropped by the JACK process callback.
+   * 
+   * Since: 9.1.0
+   */
+  param_spec = g_param_spec_uint("overrun-count",
+				 i18n_pspec("overrun count"),
+				 i18n_pspec("The count of overruns"),
+				 0,
+				 G_MAXUINT,
+				 0,
+				 G_PARAM_READABLE);
+  g_object_class_install_property(gobject,
+				  PROP_OVERRUN_COUNT,
+				  param_spec);
 }
 
 GQuark
@@ -565,6 +604,26 @@ ags_jack_devin_init(AgsJackDevin *jack_devin)
   jack_devin->port_name = NULL;
   jack_devin->jack_port = NULL;
 
+  /* ring buffer - allocated by port init */
+  jack_devin->ahead_period_count = AGS_JACK_DEVIN_DEFAULT_AHEAD_PERIOD_COUNT;
+
+  str = ags_config_get_value(config,
+			     AGS_CONFIG_SOUNDCARD,
+			     "jack-ahead-period-count");
+
+  if(str != NULL){
+    jack_devin->ahead_period_count = CLAMP(g_ascii_strtoull(str,
+							    NULL,
+							    10),
+					   1, AGS_JACK_DEVIN_MAX_AHEAD_PERIOD_COUNT);
+
+    g_free(str);
+  }
+  
+  jack_devin->ring_buffer = NULL;
+
+  jack_devin->overrun_count = 0;
+
   /* callback mutex */
   g_mutex_init(&(jack_devin->callback_mutex));
 
@@ -784,6 +843,20 @@ ags_jack_devin_set_property(GObject *gobject,
       g_rec_mutex_unlock(jack_devin_mutex);
     }
     break;
+  case PROP_AHEAD_PERIOD_COUNT:
+    {
+      guint ahead_period_count;
+
+      ahead_period_count = g_value_get_uint(value);
+
+      g_rec_mutex_lock(jack_devin_mutex);
+
+      /* applied by next port init */
+      jack_devin->ahead_period_count = ahead_period_count;
+
+      g_rec_mutex_unlock(jack_devin_mutex);
+    }
+    break;
   default:
     G_OBJECT_WARN_INVALID_PROPERTY_ID(gobject, prop_id, param_spec);
     break;
@@ -899,6 +972,20 @@ ags_jack_devin_get_property(GObject *gobject,
       g_rec_mutex_unlock(jack_devin_mutex);
     }
     break;
+  case PROP_AHEAD_PERIOD_COUNT:
+    {
+      g_rec_mutex_lock(jack_devin_mutex);
+
+      g_value_set_uint(value, jack_devin->ahead_period_count);
+
+      g_rec_mutex_unlock(jack_devin_mutex);
+    }
+    break;
+  case PROP_OVERRUN_COUNT:
+    {
+      g_value_set_uint(value, ags_atomic_uint_get(&(jack_devin->overrun_count)));
+    }
+    break;
   default:
     G_OBJECT_WARN_INVALID_PROPERTY_ID(gobject, prop_id, param_spec);
     break;
@@ -957,6 +1044,9 @@ ags_jack_devin_finalize(GObject *gobject)
   /* free buffer array */
   g_free(jack_devin->app_buffer);
 
+  /* ring buffer */
+  ags_ring_buffer_free(jack_devin->ring_buffer);
+
   /* jack client */
   if(jack_devin->jack_client != NULL){
     g_object_unref(jack_devin->jack_client);
@@ -1709,6 +1799,21 @@ ags_jack_devin_port_init(AgsSoundcard *soundcard,
   memset(jack_devin->app_buffer[2], 0, jack_devin->pcm_channels * jack_devin->buffer_size * word_size);
   memset(jack_devin->app_buffer[3], 0, jack_devin->pcm_channels * jack_devin->buffer_size * word_size);
 
+  /* ring buffer of interleaved float periods - the process callback doesn't wait for the engine */
+  if(jack_devin->ring_buffer == NULL ||
+     jack_devin->ring_buffer->period_count < jack_devin->ahead_period_count ||
+     jack_devin->ring_buffer->period_size < jack_devin->pcm_channels * jack_devin->buffer_size * sizeof(gfloat)){
+    ags_ring_buffer_free(jack_devin->ring_buffer);
+    
+    jack_devin->ring_buffer = ags_ring_buffer_alloc(jack_devin->ahead_period_count,
+						    jack_devin->pcm_channels * jack_devin->buffer_size * sizeof(gfloat));
+  }else{
+    ags_ring_buffer_reset(jack_devin->ring_buffer);
+  }
+
+  ags_atomic_uint_set(&(jack_devin->overrun_count),
+		      0);
+
   /*  */
   jack_devin->flags |= (AGS_JACK_DEVIN_INITIALIZED |
 			AGS_JACK_DEVIN_START_RECORD |
@@ -1742,15 +1847,21 @@ ags_jack_devin_port_record(AgsSoundcard *soundcard,
 
   AgsApplicationContext *application_context;
 
+  AgsRingBuffer *ring_buffer;
+
   GList *task;
 
+  void *buffer;
+  gfloat *period;
+
+  gint64 period_time, end_time;
+  guint pcm_channels;
+  guint buffer_size;
+  guint copy_mode;
   guint word_size;
   gboolean jack_client_activated;
   
   GRecMutex *jack_devin_mutex;
-  GRecMutex *jack_client_mutex;
-  GMutex *callback_mutex;
-  GMutex *callback_finish_mutex;
   
   jack_devin = AGS_JACK_DEVIN(soundcard);
   
@@ -1764,9 +1875,6 @@ ags_jack_devin_port_record(AgsSoundcard *soundcard,
 
   jack_client = (AgsJackClient *) jack_devin->jack_client;
   
-  callback_mutex = &(jack_devin->callback_mutex);
-  callback_finish_mutex = &(jack_devin->callback_finish_mutex);
-
   g_rec_mutex_unlock(jack_devin_mutex);
 
   /* do capture */
@@ -1815,56 +1923,60 @@ ags_jack_devin_port_record(AgsSoundcard *soundcard,
     return;
   }
 
-  g_rec_mutex_unlock(jack_devin_mutex);
-
-  /* get client mutex */
-  jack_client_mutex = AGS_JACK_CLIENT_GET_OBJ_MUTEX(jack_client);
+  /* the buffer the process callback used to fill at this point */
+  if(jack_devin->app_buffer_mode == AGS_JACK_DEVIN_APP_BUFFER_0){
+    buffer = jack_devin->app_buffer[1];
+  }else if(jack_devin->app_buffer_mode == AGS_JACK_DEVIN_APP_BUFFER_1){
+    buffer = jack_devin->app_buffer[2];
+  }else if(jack_devin->app_buffer_mode == AGS_JACK_DEVIN_APP_BUFFER_2){
+    buffer = jack_devin->app_buffer[3];
+  }else{
+    buffer = jack_devin->app_buffer[0];
+  }
 
-  /* get activated */
-  g_rec_mutex_lock(jack_client_mutex);
+  ring_buffer = jack_devin->ring_buffer;
 
-  jack_client_activated = ((AGS_JACK_CLIENT_ACTIVATED & (jack_client->flags)) != 0) ? TRUE: FALSE;
+  pcm_channels = jack_devin->pcm_channels;
+  buffer_size = jack_devin->buffer_size;
 
-  g_rec_mutex_unlock(jack_client_mutex);
+  period_time = (G_USEC_PER_SEC * (gint64) buffer_size) / (gint64) jack_devin->samplerate;
+  
+  copy_mode = ags_audio_buffer_util_get_copy_mode_from_format(NULL,
+							      ags_audio_buffer_util_format_from_soundcard(NULL,
+													  jack_devin->format),
+							      AGS_AUDIO_BUFFER_UTIL_FLOAT);
+  
+  g_rec_mutex_unlock(jack_devin_mutex);
 
-  if(jack_client_activated){
-    /* signal */
-    if((AGS_JACK_DEVIN_INITIAL_CALLBACK & (ags_atomic_int_get(&(jack_devin->sync_flags)))) == 0){
-      g_mutex_lock(callback_mutex);
+  /* get activated */
+  jack_client_activated = ((AGS_JACK_CLIENT_ACTIVATED & (ags_atomic_int_get(&(jack_client->flags)))) != 0) ? TRUE: FALSE;
 
-      ags_atomic_int_or(&(jack_devin->sync_flags),
-		      AGS_JACK_DEVIN_CALLBACK_DONE);
+  if(jack_client_activated &&
+     ring_buffer != NULL){
+    /* wait for a captured period, the process callback never waits for us */
+    end_time = g_get_monotonic_time() + AGS_JACK_DEVIN_MAX_AHEAD_PERIOD_COUNT * period_time;
     
-      if((AGS_JACK_DEVIN_CALLBACK_WAIT & (ags_atomic_int_get(&(jack_devin->sync_flags)))) != 0){
-	g_cond_signal(&(jack_devin->callback_cond));
+    while((period = (gfloat *) ags_ring_buffer_get_read_period(ring_buffer)) == NULL){
+      if((AGS_JACK_DEVIN_PASS_THROUGH & (ags_atomic_int_get(&(jack_devin->sync_flags)))) != 0 ||
+	 g_get_monotonic_time() > end_time){
+	break;
       }
 
-      g_mutex_unlock(callback_mutex);
+      g_usleep(period_time / 4 + 1);
     }
-    
-    /* wait callback */	
-    if((AGS_JACK_DEVIN_INITIAL_CALLBACK & (ags_atomic_int_get(&(jack_devin->sync_flags)))) == 0){
-      g_mutex_lock(callback_finish_mutex);
-    
-      if((AGS_JACK_DEVIN_CALLBACK_FINISH_DONE & (ags_atomic_int_get(&(jack_devin->sync_flags)))) == 0){
-	ags_atomic_int_or(&(jack_devin->sync_flags),
-			AGS_JACK_DEVIN_CALLBACK_FINISH_WAIT);
-    
-	while((AGS_JACK_DEVIN_CALLBACK_FINISH_DONE & (ags_atomic_int_get(&(jack_devin->sync_flags)))) == 0 &&
-	      (AGS_JACK_DEVIN_CALLBACK_FINISH_WAIT & (ags_atomic_int_get(&(jack_devin->sync_flags)))) != 0){
-	  g_cond_wait(&(jack_devin->callback_finish_cond),
-		      callback_finish_mutex);
-	}
-      }
-    
-      ags_atomic_int_and(&(jack_devin->sync_flags),
-		       (~(AGS_JACK_DEVIN_CALLBACK_FINISH_WAIT |
-			  AGS_JACK_DEVIN_CALLBACK_FINISH_DONE)));
-    
-      g_mutex_unlock(callback_finish_mutex);
-    }else{
-      ags_atomic_int_and(&(jack_devin->sync_flags),
-		       (~AGS_JACK_DEVIN_INITIAL_CALLBACK));
+
+    /* convert from interleaved float period */
+    if(period != NULL){
+      ags_soundcard_lock_buffer(soundcard, buffer);
+
+      ags_audio_buffer_util_copy_buffer_to_buffer(NULL,
+						  buffer, 1, 0,
+						  period, 1, 0,
+						  pcm_channels * buffer_size, copy_mode);
+      
+      ags_soundcard_unlock_buffer(soundcard, buffer);
+
+      ags_ring_buffer_commit_read(ring_buffer);
     }
   }
 
@@ -2537,6 +2649,27 @@ ags_jack_devin_realloc_buffer(AgsJackDevin *jack_devin)
   jack_devin->app_buffer[3] = (void *) g_malloc(jack_devin->pcm_channels * jack_devin->buffer_size * word_size);
 }
 
+/**
+ * ags_jack_devin_get_overrun_count:
+ * @jack_devin: the #AgsJackDevin
+ *
+ * Get the count of captured periods the JACK process callback dropped
+ * since last port init, because the engine didn't record them in time.
+ *
+ * Returns: the overrun count
+ *
+ * Since: 9.1.0
+ */
+guint
+ags_jack_devin_get_overrun_count(AgsJackDevin *jack_devin)
+{
+  if(!AGS_IS_JACK_DEVIN(jack_devin)){
+    return(0);
+  }
+
+  return(ags_atomic_uint_get(&(jack_devin->overrun_count)));
+}
+
 /**
  * ags_jack_devin_new:
  *
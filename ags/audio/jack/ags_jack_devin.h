@@ -36,6 +36,9 @@ G_BEGIN_DECLS
 
 #define AGS_JACK_DEVIN_GET_OBJ_MUTEX(obj) (&(((AgsJackDevin *) obj)->obj_mutex))
 
+#define AGS_JACK_DEVIN_DEFAULT_AHEAD_PERIOD_COUNT (2)
+#define AGS_JACK_DEVIN_MAX_AHEAD_PERIOD_COUNT (16)
+
 typedef struct _AgsJackDevin AgsJackDevin;
 typedef struct _AgsJackDevinClass AgsJackDevinClass;
 
@@ -143,6 +146,11 @@ struct _AgsJackDevin
   gchar **port_name;
   GList *jack_port;
 
+  guint ahead_period_count;
+  AgsRingBuffer *ring_buffer;
+
+  volatile guint overrun_count;
+
   GMutex callback_mutex;
   GCond callback_cond;
 
@@ -168,6 +176,8 @@ void ags_jack_devin_switch_buffer_flag(AgsJackDevin *jack_devin);
 
 void ags_jack_devin_realloc_buffer(AgsJackDevin *jack_devin);
 
+guint ags_jack_devin_get_overrun_count(AgsJackDevin *jack_devin);
+
 AgsJackDevin* ags_jack_devin_new();
 
 G_END_DECLS
@@ -155,6 +155,8 @@ enum{
   PROP_BUFFER,
   PROP_JACK_CLIENT,
   PROP_JACK_PORT,
+  PROP_AHEAD_PERIOD_COUNT,
+  PROP_UNDERRUN_COUNT,
 };
 
 static gpointer ags_jack_devout_parent_class = NULL;
@@ -422,6 +424,42 @@ ags_jack_devout_class_init(AgsJackDevoutClass *jack_devout)
   g_object_class_install_property(gobject,
 				  PROP_JACK_PORT,
 				  param_spec);
+
+  /**
+   * AgsJackDevout:ahead-period-count:
+   *
+   * The count of periods rendered ahead of the JACK process callback.
+   * 
+   * Since: 9.1.0
+   */
+  param_spec = g_param_spec_uint("ahead-period-count",
+				 i18n_pspec("ahead period count"),
+				 i18n_pspec("The count of periods rendered ahead"),
+				 1,
+				 AGS_JACK_DEVOUT_MAX_AHEAD_PERIOD_COUNT,
+				 AGS_JACK_DEVOUT_DEFAULT_AHEAD_PERIOD_COUNT,
+				 G_PARAM_READABLE | G_PARAM_WRITABLE);
+  g_object_class_install_property(gobject,
+				  PROP_AHEAD_PERIOD_COUNT,
+				  param_spec);
+
+  /**
+   * AgsJackDevout:underrun-count:
+   *
+   * The count of periods the JACK process callback didn't find ready.
+   * 
+   * Since: 9.1.0
+   */
+  param_spec = g_param_spec_uint("underrun-count",
+				 i18n_pspec("underrun count"),
+				 i18n_pspec("The count of underruns"),
+				 0,
+				 G_MAXUINT,
+				 0,
+				 G_PARAM_READABLE);
+  g_object_class_install_property(gobject,
+				  PROP_UNDERRUN_COUNT,
+				  param_spec);
 }
 
 GQuark
@@ -588,6 +626,26 @@ ags_jack_devout_init(AgsJackDevout *jack_devout)
   jack_devout->port_name = NULL;
   jack_devout->jack_port = NULL;
 
+  /* ring buffer - allocated by port init */
+  jack_devout->ahead_period_count = AGS_JACK_DEVOUT_DEFAULT_AHEAD_PERIOD_COUNT;
+
+  str = ags_config_get_value(config,
+			     AGS_CONFIG_SOUNDCARD,
+			     "jack-ahead-period-count");
+
+  if(str != NULL){
+    jack_devout->ahead_period_count = CLAMP(g_ascii_strtoull(str,
+							     NULL,
+							     10),
+					    1, AGS_JACK_DEVOUT_MAX_AHEAD_PERIOD_COUNT);
+
+    g_free(str);
+  }
+  
+  jack_devout->ring_buffer = NULL;
+
+  jack_devout->underrun_count = 0;
+
   /* callback mutex */
   g_mutex_init(&(jack_devout->callback_mutex));
 
@@ -827,6 +885,20 @@ ags_jack_devout_set_property(GObject *gobject,
       g_rec_mutex_unlock(jack_devout_mutex);
     }
     break;
+  case PROP_AHEAD_PERIOD_COUNT:
+    {
+      guint ahead_period_count;
+
+      ahead_period_count = g_value_get_uint(value);
+
+      g_rec_mutex_lock(jack_devout_mutex);
+
+      /* applied by next port init */
+      jack_devout->ahead_period_count = ahead_period_count;
+
+      g_rec_mutex_unlock(jack_devout_mutex);
+    }
+    break;
   default:
     G_OBJECT_WARN_INVALID_PROPERTY_ID(gobject, prop_id, param_spec);
     break;
@@ -942,6 +1014,20 @@ ags_jack_devout_get_property(GObject *gobject,
       g_rec_mutex_unlock(jack_devout_mutex);
     }
     break;
+  case PROP_AHEAD_PERIOD_COUNT:
+    {
+      g_rec_mutex_lock(jack_devout_mutex);
+
+      g_value_set_uint(value, jack_devout->ahead_period_count);
+
+      g_rec_mutex_unlock(jack_devout_mutex);
+    }
+    break;
+  case PROP_UNDERRUN_COUNT:
+    {
+      g_value_set_uint(value, ags_atomic_uint_get(&(jack_devout->underrun_count)));
+    }
+    break;
   default:
     G_OBJECT_WARN_INVALID_PROPERTY_ID(gobject, prop_id, param_spec);
     break;
@@ -1015,6 +1101,9 @@ ags_jack_devout_finalize(GObject *gobject)
   /* free buffer array */
   g_free(jack_devout->app_buffer);
 
+  /* ring buffer */
+  ags_ring_buffer_free(jack_devout->ring_buffer);
+
   g_free(jack_devout->card_uri);
   
   /* jack client */
@@ -1762,6 +1851,21 @@ ags_jack_devout_port_init(AgsSoundcard *soundcard,
   memset(jack_devout->app_buffer[2], 0, jack_devout->pcm_channels * jack_devout->buffer_size * word_size);
   memset(jack_devout->app_buffer[3], 0, jack_devout->pcm_channels * jack_devout->buffer_size * word_size);
 
+  /* ring buffer of interleaved float periods - the process callback doesn't wait for the engine */
+  if(jack_devout->ring_buffer == NULL ||
+     jack_devout->ring_buffer->period_count < jack_devout->ahead_period_count ||
+     jack_devout->ring_buffer->period_size < jack_devout->pcm_channels * jack_devout->buffer_size * sizeof(gfloat)){
+    ags_ring_buffer_free(jack_devout->ring_buffer);
+    
+    jack_devout->ring_buffer = ags_ring_buffer_alloc(jack_devout->ahead_period_count,
+						     jack_devout->pcm_channels * jack_devout->buffer_size * sizeof(gfloat));
+  }else{
+    ags_ring_buffer_reset(jack_devout->ring_buffer);
+  }
+
+  ags_atomic_uint_set(&(jack_devout->underrun_count),
+		      0);
+  
   jack_devout->flags |= (AGS_JACK_DEVOUT_INITIALIZED |
 			 AGS_JACK_DEVOUT_START_PLAY |
 			 AGS_JACK_DEVOUT_PLAY);
@@ -1794,16 +1898,23 @@ ags_jack_devout_port_play(AgsSoundcard *soundcard,
   
   AgsApplicationContext *application_context;
 
+  AgsRingBuffer *ring_buffer;
+
   GList *task;
 
+  void *buffer;
+  gfloat *period;
+
+  gint64 period_time, end_time;
   gboolean initial_run;
+  guint pcm_channels;
+  guint buffer_size;
+  guint ahead_period_count;
+  guint copy_mode;
   guint word_size;
   gboolean jack_client_activated;
   
   GRecMutex *jack_devout_mutex;
-  GRecMutex *jack_client_mutex;
-  GMutex *callback_mutex;
-  GMutex *callback_finish_mutex;
   
   jack_devout = AGS_JACK_DEVOUT(soundcard);
   
@@ -1817,9 +1928,6 @@ ags_jack_devout_port_play(AgsSoundcard *soundcard,
 
   jack_client = (AgsJackClient *) jack_devout->jack_client;
   
-  callback_mutex = &(jack_devout->callback_mutex);
-  callback_finish_mutex = &(jack_devout->callback_finish_mutex);
-
   g_rec_mutex_unlock(jack_devout_mutex);
 
   /* do playback */
@@ -1871,56 +1979,72 @@ ags_jack_devout_port_play(AgsSoundcard *soundcard,
     return;
   }
 
-  g_rec_mutex_unlock(jack_devout_mutex);
+  /* the buffer the process callback used to copy at this point */
+  if(jack_devout->app_buffer_mode == AGS_JACK_DEVOUT_APP_BUFFER_0){
+    buffer = jack_devout->app_buffer[3];
+  }else if(jack_devout->app_buffer_mode == AGS_JACK_DEVOUT_APP_BUFFER_1){
+    buffer = jack_devout->app_buffer[0];
+  }else if(jack_devout->app_buffer_mode == AGS_JACK_DEVOUT_APP_BUFFER_2){
+    buffer = jack_devout->app_buffer[1];
+  }else{
+    buffer = jack_devout->app_buffer[2];
+  }
 
-  /* get client mutex */
-  jack_client_mutex = AGS_JACK_CLIENT_GET_OBJ_MUTEX(jack_client);
+  ring_buffer = jack_devout->ring_buffer;
 
-  /* get activated */
-  g_rec_mutex_lock(jack_client_mutex);
+  pcm_channels = jack_devout->pcm_channels;
+  buffer_size = jack_devout->buffer_size;
 
-  jack_client_activated = ((AGS_JACK_CLIENT_ACTIVATED & (jack_client->flags)) != 0) ? TRUE: FALSE;
+  ahead_period_count = jack_devout->ahead_period_count;
 
-  g_rec_mutex_unlock(jack_client_mutex);
+  period_time = (G_USEC_PER_SEC * (gint64) buffer_size) / (gint64) jack_devout->samplerate;
+  
+  copy_mode = ags_audio_buffer_util_get_copy_mode_from_format(NULL,
+							      AGS_AUDIO_BUFFER_UTIL_FLOAT,
+							      ags_audio_buffer_util_format_from_soundcard(NULL,
+													  jack_devout->format));
+  
+  g_rec_mutex_unlock(jack_devout_mutex);
 
-  if(jack_client_activated){
-    /* signal */
-    if((AGS_JACK_DEVOUT_INITIAL_CALLBACK & (ags_atomic_int_get(&(jack_devout->sync_flags)))) == 0){
-      g_mutex_lock(callback_mutex);
+  /* get activated */
+  jack_client_activated = ((AGS_JACK_CLIENT_ACTIVATED & (ags_atomic_int_get(&(jack_client->flags)))) != 0) ? TRUE: FALSE;
 
-      ags_atomic_int_or(&(jack_devout->sync_flags),
-		      AGS_JACK_DEVOUT_CALLBACK_DONE);
+  if(jack_client_activated &&
+     ring_buffer != NULL){
+    /* wait until the process callback consumed a period, it never waits for us */
+    end_time = g_get_monotonic_time() + AGS_JACK_DEVOUT_MAX_AHEAD_PERIOD_COUNT * period_time;
     
-      if((AGS_JACK_DEVOUT_CALLBACK_WAIT & (ags_atomic_int_get(&(jack_devout->sync_flags)))) != 0){
-	g_cond_signal(&(jack_devout->callback_cond));
+    while(ags_ring_buffer_get_readable(ring_buffer) >= ahead_period_count){
+      if((AGS_JACK_DEVOUT_PASS_THROUGH & (ags_atomic_int_get(&(jack_devout->sync_flags)))) != 0 ||
+	 g_get_monotonic_time() > end_time){
+	break;
       }
 
-      g_mutex_unlock(callback_mutex);
+      g_usleep(period_time / 4 + 1);
     }
+
+    /* convert to interleaved float period */
+    period = NULL;
     
-    /* wait callback */	
-    if((AGS_JACK_DEVOUT_INITIAL_CALLBACK & (ags_atomic_int_get(&(jack_devout->sync_flags)))) == 0){
-      g_mutex_lock(callback_finish_mutex);
-    
-      if((AGS_JACK_DEVOUT_CALLBACK_FINISH_DONE & (ags_atomic_int_get(&(jack_devout->sync_flags)))) == 0){
-	ags_atomic_int_or(&(jack_devout->sync_flags),
-			AGS_JACK_DEVOUT_CALLBACK_FINISH_WAIT);
-    
-	while((AGS_JACK_DEVOUT_CALLBACK_FINISH_DONE & (ags_atomic_int_get(&(jack_devout->sync_flags)))) == 0 &&
-	      (AGS_JACK_DEVOUT_CALLBACK_FINISH_WAIT & (ags_atomic_int_get(&(jack_devout->sync_flags)))) != 0){
-	  g_cond_wait(&(jack_devout->callback_finish_cond),
-		      callback_finish_mutex);
-	}
-      }
-    
-      ags_atomic_int_and(&(jack_devout->sync_flags),
-		       (~(AGS_JACK_DEVOUT_CALLBACK_FINISH_WAIT |
-			  AGS_JACK_DEVOUT_CALLBACK_FINISH_DONE)));
-    
-      g_mutex_unlock(callback_finish_mutex);
-    }else{
-      ags_atomic_int_and(&(jack_devout->sync_flags),
-		       (~AGS_JACK_DEVOUT_INITIAL_CALLBACK));
+    if(ags_ring_buffer_get_readable(ring_buffer) < ahead_period_count){
+      period = (gfloat *) ags_ring_buffer_get_write_period(ring_buffer);
+    }
+
+    if(period != NULL){
+      ags_audio_buffer_util_clear_float(NULL,
+					period, 1,
+					pcm_channels * buffer_size);
+      
+      ags_soundcard_lock_buffer(soundcard, buffer);
+
+      ags_audio_buffer_util_copy_buffer_to_buffer(NULL,
+						  period, 1, 0,
+						  buffer, 1, 0,
+						  pcm_channels * buffer_size, copy_mode);
+      
+      ags_soundcard_unlock_buffer(soundcard, buffer);
+
+      ags_ring_buffer_commit_write(ring_buffer);
     }
   }
 
@@ -2715,6 +2839,27 @@ ags_jack_devout_realloc_buffer(AgsJackDevout *jack_devout)
   jack_devout->app_buffer[3] = (void *) g_malloc(jack_devout->pcm_channels * jack_devout->buffer_size * word_size);
 }
 
+/**
+ * ags_jack_devout_get_underrun_count:
+ * @jack_devout: the #AgsJackDevout
+ *
+ * Get the count of periods the JACK process callback didn't find ready
+ * since last port init. The callback outputs silence instead.
+ *
+ * Returns: the underrun count
+ *
+ * Since: 9.1.0
+ */
+guint
+ags_jack_devout_get_underrun_count(AgsJackDevout *jack_devout)
+{
+  if(!AGS_IS_JACK_DEVOUT(jack_devout)){
+    return(0);
+  }
+
+  return(ags_atomic_uint_get(&(jack_devout->underrun_count)));
+}
+
 /**
  * ags_jack_devout_new:
  *
@@ -38,6 +38,9 @@ G_BEGIN_DECLS
 
 #define AGS_JACK_DEVOUT_DEFAULT_APP_BUFFER_SIZE (4)
 
+#define AGS_JACK_DEVOUT_DEFAULT_AHEAD_PERIOD_COUNT (2)
+#define AGS_JACK_DEVOUT_MAX_AHEAD_PERIOD_COUNT (16)
+
 typedef struct _AgsJackDevout AgsJackDevout;
 typedef struct _AgsJackDevoutClass AgsJackDevoutClass;
 /**
@@ -147,6 +150,11 @@ struct _AgsJackDevout
   gchar **port_name;
   GList *jack_port;
 
+  guint ahead_period_count;
+  AgsRingBuffer *ring_buffer;
+
+  volatile guint underrun_count;
+
   GMutex callback_mutex;
   GCond callback_cond;
 
@@ -172,6 +180,8 @@ void ags_jack_devout_switch_buffer_flag(AgsJackDevout *jack_devout);
 
 void ags_jack_devout_realloc_buffer(AgsJackDevout *jack_devout);
 
+guint ags_jack_devout_get_underrun_count(AgsJackDevout *jack_devout);
+
 AgsJackDevout* ags_jack_devout_new();
 
 G_END_DECLS
@@ -123,6 +123,7 @@ enum{
   PROP_BUFFER,
   PROP_JACK_CLIENT,
   PROP_JACK_PORT,
+  PROP_OVERRUN_COUNT,
 };
 
 static gpointer ags_jack_midiin_parent_class = NULL;
@@ -302,6 +303,24 @@ ags_jack_midiin_class_init(AgsJackMidiinClass *jack_midiin)
 				  PROP_JACK_PORT,
 				  param_spec);
 
+  /**
+   * AgsJackMidiin:overrun-count:
+   *
+   * The count of MIDI events dropped by the JACK process callback.
+   * 
+   * Since: 9.1.0
+   */
+  param_spec = g_param_spec_uint("overrun-count",
+				 i18n_pspec("overrun count"),
+				 i18n_pspec("The count of overruns"),
+				 0,
+				 G_MAXUINT,
+				 0,
+				 G_PARAM_READABLE);
+  g_object_class_install_property(gobject,
+				  PROP_OVERRUN_COUNT,
+				  param_spec);
+
   /* AgsJackMidiinClass */
 }
 
@@ -435,6 +454,12 @@ ags_jack_midiin_init(AgsJackMidiin *jack_midiin)
   jack_midiin->port_name = NULL;
   jack_midiin->jack_port = NULL;
 
+  /* ring buffer - the process callback must not allocate */
+  jack_midiin->ring_buffer = ags_ring_buffer_alloc(AGS_JACK_MIDIIN_DEFAULT_RING_PERIOD_COUNT,
+						   sizeof(guint32) + AGS_JACK_MIDIIN_DEFAULT_RING_PERIOD_SIZE);
+
+  jack_midiin->overrun_count = 0;
+
   /* callback mutex */
   g_mutex_init(&(jack_midiin->callback_mutex));
 
@@ -624,6 +649,11 @@ ags_jack_midiin_get_property(GObject *gobject,
       g_rec_mutex_unlock(jack_midiin_mutex);
     }
     break;
+  case PROP_OVERRUN_COUNT:
+    {
+      g_value_set_uint(value, ags_atomic_uint_get(&(jack_midiin->overrun_count)));
+    }
+    break;
   default:
     G_OBJECT_WARN_INVALID_PROPERTY_ID(gobject, prop_id, param_spec);
     break;
@@ -690,6 +720,9 @@ ags_jack_midiin_finalize(GObject *gobject)
   /* free buffer array */
   g_free(jack_midiin->app_buffer);
 
+  /* ring buffer */
+  ags_ring_buffer_free(jack_midiin->ring_buffer);
+
   /* jack client */
   if(jack_midiin->jack_client != NULL){
     g_object_unref(jack_midiin->jack_client);
@@ -1367,7 +1400,10 @@ ags_jack_midiin_port_init(AgsSequencer *sequencer,
 			 AGS_JACK_MIDIIN_NONBLOCKING);
 
   /* port setup */
-  //TODO:JK: implement me
+  ags_ring_buffer_reset(jack_midiin->ring_buffer);
+
+  ags_atomic_uint_set(&(jack_midiin->overrun_count),
+		      0);
   
   /*  */
   jack_midiin->flags |= (AGS_JACK_MIDIIN_INITIALIZED |
@@ -1401,14 +1437,17 @@ ags_jack_midiin_port_record(AgsSequencer *sequencer,
 
   AgsApplicationContext *application_context;
 
+  AgsRingBuffer *ring_buffer;
+
   GList *task;
 
+  guint8 *period;
+
+  guint32 period_length;
+  guint nth_buffer;
   gboolean jack_client_activated;
 
   GRecMutex *jack_midiin_mutex;
-  GRecMutex *jack_client_mutex;
-  GMutex *callback_mutex;
-  GMutex *callback_finish_mutex;
 
   jack_midiin = AGS_JACK_MIDIIN(sequencer);
 
@@ -1421,10 +1460,9 @@ ags_jack_midiin_port_record(AgsSequencer *sequencer,
   g_rec_mutex_lock(jack_midiin_mutex);
 
   jack_client = (AgsJackClient *) jack_midiin->jack_client;
-  
-  callback_mutex = &(jack_midiin->callback_mutex);
-  callback_finish_mutex = &(jack_midiin->callback_finish_mutex);
 
+  ring_buffer = jack_midiin->ring_buffer;
+  
   g_rec_mutex_unlock(jack_midiin_mutex);
 
   /* do record */
@@ -1440,55 +1478,49 @@ ags_jack_midiin_port_record(AgsSequencer *sequencer,
 
   g_rec_mutex_unlock(jack_midiin_mutex);
 
-  /* get jack client mutex */
-  jack_client_mutex = AGS_JACK_CLIENT_GET_OBJ_MUTEX(jack_client);
-
   /* check activated */
-  g_rec_mutex_lock(jack_client_mutex);
+  jack_client_activated = ((AGS_JACK_CLIENT_ACTIVATED & (ags_atomic_int_get(&(jack_client->flags)))) != 0) ? TRUE: FALSE;
 
-  jack_client_activated = ((AGS_JACK_CLIENT_ACTIVATED & (jack_client->flags)) != 0) ? TRUE: FALSE;
+  if(jack_client_activated){
+    /* move the events queued by the process callback to the application buffer */
+    g_rec_mutex_lock(jack_midiin_mutex);
+
+    nth_buffer = 0;
+		
+    if(jack_midiin->app_buffer_mode == AGS_JACK_MIDIIN_APP_BUFFER_0){
+      nth_buffer = 1;
+    }else if(jack_midiin->app_buffer_mode == AGS_JACK_MIDIIN_APP_BUFFER_1){
+      nth_buffer = 2;
+    }else if(jack_midiin->app_buffer_mode == AGS_JACK_MIDIIN_APP_BUFFER_2){
+      nth_buffer = 3;
+    }else if(jack_midiin->app_buffer_mode == AGS_JACK_MIDIIN_APP_BUFFER_3){
+      nth_buffer = 0;
+    }
 
-  g_rec_mutex_unlock(jack_client_mutex);
+    while((period = (guint8 *) ags_ring_buffer_get_read_period(ring_buffer)) != NULL){
+      memcpy(&period_length, period, sizeof(guint32));
+      
+      if(jack_midiin->app_buffer_size[nth_buffer] + period_length >= jack_midiin->allocated_app_buffer_size[nth_buffer]){
+	guint allocated_app_buffer_size;
 
-  if(jack_client_activated){
-    /* signal client */
-    if((AGS_JACK_MIDIIN_INITIAL_CALLBACK & (ags_atomic_int_get(&(jack_midiin->sync_flags)))) == 0){
-      g_mutex_lock(callback_mutex);
+	allocated_app_buffer_size = AGS_JACK_MIDIIN_DEFAULT_BUFFER_SIZE * ((jack_midiin->app_buffer_size[nth_buffer] + period_length) / AGS_JACK_MIDIIN_DEFAULT_BUFFER_SIZE + 1);
+	
+	jack_midiin->app_buffer[nth_buffer] = (char *) g_realloc(jack_midiin->app_buffer[nth_buffer],
+								 allocated_app_buffer_size * sizeof(char));
+		  
+	memset(jack_midiin->app_buffer[nth_buffer] + jack_midiin->allocated_app_buffer_size[nth_buffer], 0, (allocated_app_buffer_size - jack_midiin->allocated_app_buffer_size[nth_buffer]) * sizeof(char));
 
-      ags_atomic_int_or(&(jack_midiin->sync_flags),
-		      AGS_JACK_MIDIIN_CALLBACK_DONE);
-    
-      if((AGS_JACK_MIDIIN_CALLBACK_WAIT & (ags_atomic_int_get(&(jack_midiin->sync_flags)))) != 0){
-	g_cond_signal(&(jack_midiin->callback_cond));
+	jack_midiin->allocated_app_buffer_size[nth_buffer] = allocated_app_buffer_size;
       }
 
-      g_mutex_unlock(callback_mutex);
+      memcpy(jack_midiin->app_buffer[nth_buffer] + jack_midiin->app_buffer_size[nth_buffer], period + sizeof(guint32), period_length);
+		
+      jack_midiin->app_buffer_size[nth_buffer] += period_length;
+
+      ags_ring_buffer_commit_read(ring_buffer);
     }
     
-    /* wait callback */	
-    if((AGS_JACK_MIDIIN_INITIAL_CALLBACK & (ags_atomic_int_get(&(jack_midiin->sync_flags)))) == 0){
-      g_mutex_lock(callback_finish_mutex);
-    
-      if((AGS_JACK_MIDIIN_CALLBACK_FINISH_DONE & (ags_atomic_int_get(&(jack_midiin->sync_flags)))) == 0){
-	ags_atomic_int_or(&(jack_midiin->sync_flags),
-			AGS_JACK_MIDIIN_CALLBACK_FINISH_WAIT);
-    
-	while((AGS_JACK_MIDIIN_CALLBACK_FINISH_DONE & (ags_atomic_int_get(&(jack_midiin->sync_flags)))) == 0 &&
-	      (AGS_JACK_MIDIIN_CALLBACK_FINISH_WAIT & (ags_atomic_int_get(&(jack_midiin->sync_flags)))) != 0){
-	  g_cond_wait(&(jack_midiin->callback_finish_cond),
-		      callback_finish_mutex);
-	}
-      }
-    
-      ags_atomic_int_and(&(jack_midiin->sync_flags),
-		       (~(AGS_JACK_MIDIIN_CALLBACK_FINISH_WAIT |
-			  AGS_JACK_MIDIIN_CALLBACK_FINISH_DONE)));
-    
-      g_mutex_unlock(callback_finish_mutex);
-    }else{
-      ags_atomic_int_and(&(jack_midiin->sync_flags),
-		       (~AGS_JACK_MIDIIN_INITIAL_CALLBACK));
-    }
+    g_rec_mutex_unlock(jack_midiin_mutex);
   }
 
   task_launcher = ags_concurrency_provider_get_task_launcher(AGS_CONCURRENCY_PROVIDER(application_context));
@@ -1891,6 +1923,27 @@ ags_jack_midiin_switch_buffer_flag(AgsJackMidiin *jack_midiin)
   g_rec_mutex_unlock(jack_midiin_mutex);
 }
 
+/**
+ * ags_jack_midiin_get_overrun_count:
+ * @jack_midiin: the #AgsJackMidiin
+ *
+ * Get the count of MIDI events the JACK process callback dropped since
+ * last port init, because the engine didn't record them in time.
+ *
+ * Returns: the overrun count
+ *
+ * Since: 9.1.0
+ */
+guint
+ags_jack_midiin_get_overrun_count(AgsJackMidiin *jack_midiin)
+{
+  if(!AGS_IS_JACK_MIDIIN(jack_midiin)){
+    return(0);
+  }
+
+  return(ags_atomic_uint_get(&(jack_midiin->overrun_count)));
+}
+
 /**
  * ags_jack_midiin_new:
  *
@@ -42,6 +42,9 @@ G_BEGIN_DECLS
 
 #define AGS_JACK_MIDIIN_DEFAULT_BUFFER_SIZE (256)
 
+#define AGS_JACK_MIDIIN_DEFAULT_RING_PERIOD_COUNT (16)
+#define AGS_JACK_MIDIIN_DEFAULT_RING_PERIOD_SIZE (4096)
+
 typedef struct _AgsJackMidiin AgsJackMidiin;
 typedef struct _AgsJackMidiinClass AgsJackMidiinClass;
 
@@ -145,6 +148,10 @@ struct _AgsJackMidiin
   gchar **port_name;
   GList *jack_port;
 
+  AgsRingBuffer *ring_buffer;
+
+  volatile guint overrun_count;
+
   GMutex callback_mutex;
   GCond callback_cond;
 
@@ -170,6 +177,8 @@ void ags_jack_midiin_unset_flags(AgsJackMidiin *jack_midiin, AgsJackMidiinFlags
 
 void ags_jack_midiin_switch_buffer_flag(AgsJackMidiin *jack_midiin);
 
+guint ags_jack_midiin_get_overrun_count(AgsJackMidiin *jack_midiin);
+
 AgsJackMidiin* ags_jack_midiin_new();
 
 G_END_DECLS
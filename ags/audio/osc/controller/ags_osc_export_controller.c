@@ -46,6 +46,10 @@ gpointer ags_osc_export_controller_real_do_export(AgsOscExportController *osc_ex
  * @include: ags/audio/osc/controller/ags_osc_export_controller.h
  *
  * The #AgsOscExportController implements the OSC export controller.
+ *
+ * The export message's type tag is `,ssihT` for a live performance or
+ * `,ssihF` to render offline. Offline export of an #AgsOfflineDevout
+ * renders faster than real-time, see #AgsExportOutput.
  */
 
 enum{
@@ -211,7 +215,7 @@ ags_osc_export_controller_real_do_export(AgsOscExportController *osc_export_cont
 	     !strncmp(type_tag, ",ssihs", 6)) ? TRUE: FALSE;
 
   if(success){
-    success = (!strncmp(type_tag + 6, "T", 2) || strncmp(type_tag + 6, "F", 2)) ? TRUE: FALSE;
+    success = (!strncmp(type_tag + 6, "T", 2) || !strncmp(type_tag + 6, "F", 2)) ? TRUE: FALSE;
   }
   
   if(!success){
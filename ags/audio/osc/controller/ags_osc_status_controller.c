@@ -23,6 +23,8 @@
 #include <ags/audio/osc/ags_osc_server.h>
 #include <ags/audio/osc/ags_osc_buffer_util.h>
 
+#include <ags/audio/ags_recall_profiler.h>
+
 #include <ags/i18n.h>
 
 #include <stdlib.h>
@@ -45,6 +47,10 @@ gpointer ags_osc_status_controller_real_get_status(AgsOscStatusController *statu
 						   AgsOscConnection *osc_connection,
 						   guchar *message, guint message_size);
 
+GList* ags_osc_status_controller_get_dsp_load(AgsOscStatusController *osc_status_controller);
+GList* ags_osc_status_controller_get_dsp_load_dump(AgsOscStatusController *osc_status_controller);
+GList* ags_osc_status_controller_get_trace_dump(AgsOscStatusController *osc_status_controller);
+
 /**
  * SECTION:ags_osc_status_controller
  * @short_description: OSC status controller
@@ -53,6 +59,13 @@ gpointer ags_osc_status_controller_real_get_status(AgsOscStatusController *statu
  * @include: ags/audio/osc/controller/ags_osc_status_controller.h
  *
  * The #AgsOscStatusController implements the OSC status controller.
+ *
+ * The status path accepts the optional string argument "dsp-load" to get
+ * one message per #AgsRecallProfilerEntry with the arguments audio name,
+ * scope, effect, line, mean, p99 and max in microseconds and the deadline
+ * ratio. The argument "dsp-load-dump" returns the text dump of the
+ * #AgsRecallProfiler. The argument "trace-dump" writes the trace events
+ * to ags_trace_get_filename() and returns the filename.
  */
 
 enum{
@@ -257,7 +270,53 @@ ags_osc_status_controller_real_get_status(AgsOscStatusController *osc_status_con
 				 &type_tag, NULL);
 
   success = (type_tag != NULL &&
-	     !strncmp(type_tag, ",", 2)) ? TRUE: FALSE;
+	     (!strncmp(type_tag, ",", 2) ||
+	      !strncmp(type_tag, ",s", 3))) ? TRUE: FALSE;
+
+  /* DSP load */
+  if(success &&
+     !strncmp(type_tag, ",s", 3)){
+    gchar *argument;
+
+    ags_osc_buffer_util_get_string(&osc_buffer_util,
+				   message + 12,
+				   &argument, NULL);
+
+    if(argument != NULL &&
+       !strncmp(argument, "dsp-load", 9)){
+      g_list_free_full(start_response,
+		       g_object_unref);
+      
+      start_response = ags_osc_status_controller_get_dsp_load(osc_status_controller);
+    }else if(argument != NULL &&
+	     !strncmp(argument, "dsp-load-dump", 14)){
+      g_list_free_full(start_response,
+		       g_object_unref);
+      
+      start_response = ags_osc_status_controller_get_dsp_load_dump(osc_status_controller);
+    }else if(argument != NULL &&
+	     !strncmp(argument, "trace-dump", 11)){
+      g_list_free_full(start_response,
+		       g_object_unref);
+      
+      start_response = ags_osc_status_controller_get_trace_dump(osc_status_controller);
+    }else{
+      ags_osc_response_set_flags(osc_response,
+				 AGS_OSC_RESPONSE_ERROR);
+
+      g_object_set(osc_response,
+		   "error-message", AGS_OSC_RESPONSE_ERROR_MESSAGE_MALFORMED_REQUEST,
+		   NULL);
+    }
+
+    if(argument != NULL){
+      free(argument);
+    }
+    
+    free(type_tag);
+    
+    return(start_response);
+  }
 
   if(!success){
     ags_osc_response_set_flags(osc_response,
@@ -335,6 +394,401 @@ ags_osc_status_controller_real_get_status(AgsOscStatusController *osc_status_con
   return(start_response);
 }
 
+GList*
+ags_osc_status_controller_get_dsp_load(AgsOscStatusController *osc_status_controller)
+{
+  AgsOscResponse *osc_response;
+  AgsRecallProfiler *recall_profiler;
+  
+  AgsOscBufferUtil osc_buffer_util;
+
+  GList *start_response;
+  GList *start_entry, *entry;
+
+  guchar *packet;
+
+  guint packet_size;
+
+  osc_buffer_util.major = 1;
+  osc_buffer_util.minor = 0;
+
+  start_response = NULL;
+
+  if(!ags_recall_profiler_is_enabled()){
+    osc_response = ags_osc_response_new();
+    start_response = g_list_prepend(start_response,
+				    osc_response);
+    
+    ags_osc_response_set_flags(osc_response,
+			       AGS_OSC_RESPONSE_ERROR);
+
+    g_object_set(osc_response,
+		 "error-message", "DSP load profiler disabled",
+		 NULL);
+
+    return(start_response);
+  }
+  
+  recall_profiler = ags_recall_profiler_get_instance();
+  
+  entry =
+    start_entry = ags_recall_profiler_get_entry(recall_profiler);
+
+  while(entry != NULL){
+    AgsRecallProfilerEntry *current;
+
+    gchar *audio_name;
+    gchar *scope;
+    
+    gdouble mean;
+    gint64 p99, max;
+    gdouble deadline_ratio;
+    guint audio_name_length, scope_length, effect_length;
+
+    current = AGS_RECALL_PROFILER_ENTRY(entry->data);
+
+    ags_recall_profiler_entry_get_stats(recall_profiler,
+					current,
+					&mean, &p99, &max,
+					&deadline_ratio);
+
+    audio_name = (current->audio_name != NULL) ? current->audio_name: "";
+
+    if(current->line < 0){
+      scope = "audio";
+    }else if(current->is_output){
+      scope = "output";
+    }else{
+      scope = "input";
+    }
+    
+    audio_name_length = strlen(audio_name);
+    scope_length = strlen(scope);
+    effect_length = strlen(current->effect);
+    
+    osc_response = ags_osc_response_new();
+    start_response = g_list_prepend(start_response,
+				    osc_response);
+
+    /* size prefix, path, type tag, dsp-load argument, strings, int and 4 floats */
+    packet_size = 4 + 8 + 12 + 12;
+    packet_size += (4 * (guint) ceil((double) (audio_name_length + 1) / 4.0));
+    packet_size += (4 * (guint) ceil((double) (scope_length + 1) / 4.0));
+    packet_size += (4 * (guint) ceil((double) (effect_length + 1) / 4.0));
+    packet_size += 4 + (4 * 4);
+    
+    packet = (guchar *) malloc(packet_size * sizeof(guchar));
+    memset(packet, 0, packet_size * sizeof(guchar));
+
+    /* message path */
+    packet_size = 4;
+
+    ags_osc_buffer_util_put_string(&osc_buffer_util,
+				   packet + packet_size,
+				   "/status", -1);
+      
+    packet_size += 8;
+
+    ags_osc_buffer_util_put_string(&osc_buffer_util,
+				   packet + packet_size,
+				   ",ssssiffff", -1);
+  
+    packet_size += 12;
+
+    /* arguments */
+    ags_osc_buffer_util_put_string(&osc_buffer_util,
+				   packet + packet_size,
+				   "dsp-load", -1);
+  
+    packet_size += 12;
+
+    ags_osc_buffer_util_put_string(&osc_buffer_util,
+				   packet + packet_size,
+				   audio_name, audio_name_length);
+
+    packet_size += (4 * (guint) ceil((double) (audio_name_length + 1) / 4.0));
+
+    ags_osc_buffer_util_put_string(&osc_buffer_util,
+				   packet + packet_size,
+				   scope, scope_length);
+
+    packet_size += (4 * (guint) ceil((double) (scope_length + 1) / 4.0));
+
+    ags_osc_buffer_util_put_string(&osc_buffer_util,
+				   packet + packet_size,
+				   current->effect, effect_length);
+
+    packet_size += (4 * (guint) ceil((double) (effect_length + 1) / 4.0));
+
+    ags_osc_buffer_util_put_int32(&osc_buffer_util,
+				  packet + packet_size,
+				  current->line);
+
+    packet_size += 4;
+
+    ags_osc_buffer_util_put_float(&osc_buffer_util,
+				  packet + packet_size,
+				  (gfloat) (mean / 1000.0));
+
+    packet_size += 4;
+
+    ags_osc_buffer_util_put_float(&osc_buffer_util,
+				  packet + packet_size,
+				  (gfloat) ((gdouble) p99 / 1000.0));
+
+    packet_size += 4;
+
+    ags_osc_buffer_util_put_float(&osc_buffer_util,
+				  packet + packet_size,
+				  (gfloat) ((gdouble) max / 1000.0));
+
+    packet_size += 4;
+
+    ags_osc_buffer_util_put_float(&osc_buffer_util,
+				  packet + packet_size,
+				  (gfloat) deadline_ratio);
+
+    packet_size += 4;
+
+    /* packet size */
+    ags_osc_buffer_util_put_int32(&osc_buffer_util,
+				  packet,
+				  packet_size);
+
+    g_object_set(osc_response,
+		 "packet", packet,
+		 "packet-size", packet_size,
+		 NULL);
+    
+    entry = entry->next;
+  }
+
+  g_list_free(start_entry);
+
+  /* no entries yet */
+  if(start_response == NULL){
+    osc_response = ags_osc_response_new();
+    start_response = g_list_prepend(start_response,
+				    osc_response);
+
+    packet_size = 4 + 8 + 4 + 12;
+    
+    packet = (guchar *) malloc(packet_size * sizeof(guchar));
+    memset(packet, 0, packet_size * sizeof(guchar));
+
+    packet_size = 4;
+
+    ags_osc_buffer_util_put_string(&osc_buffer_util,
+				   packet + packet_size,
+				   "/status", -1);
+      
+    packet_size += 8;
+
+    ags_osc_buffer_util_put_string(&osc_buffer_util,
+				   packet + packet_size,
+				   ",s", -1);
+  
+    packet_size += 4;
+
+    ags_osc_buffer_util_put_string(&osc_buffer_util,
+				   packet + packet_size,
+				   "dsp-load", -1);
+  
+    packet_size += 12;
+
+    ags_osc_buffer_util_put_int32(&osc_buffer_util,
+				  packet,
+				  packet_size);
+
+    g_object_set(osc_response,
+		 "packet", packet,
+		 "packet-size", packet_size,
+		 NULL);
+  }
+  
+  return(g_list_reverse(start_response));
+}
+
+GList*
+ags_osc_status_controller_get_dsp_load_dump(AgsOscStatusController *osc_status_controller)
+{
+  AgsOscResponse *osc_response;
+  
+  AgsOscBufferUtil osc_buffer_util;
+
+  GList *start_response;
+
+  gchar *dump;
+  guchar *packet;
+
+  guint packet_size;
+  guint length;
+
+  osc_buffer_util.major = 1;
+  osc_buffer_util.minor = 0;
+
+  start_response = NULL;
+
+  osc_response = ags_osc_response_new();
+  start_response = g_list_prepend(start_response,
+				  osc_response);
+  
+  dump = ags_recall_profiler_dump(ags_recall_profiler_get_instance());
+
+  length = strlen(dump);
+
+  /* size prefix, path, type tag, dsp-load-dump argument and dump */
+  packet_size = 4 + 8 + 4 + 16;
+  packet_size += (4 * (guint) ceil((double) (length + 1) / 4.0));
+
+  packet = (guchar *) malloc(packet_size * sizeof(guchar));
+  memset(packet, 0, packet_size * sizeof(guchar));
+
+  /* message path */
+  packet_size = 4;
+
+  ags_osc_buffer_util_put_string(&osc_buffer_util,
+				 packet + packet_size,
+				 "/status", -1);
+      
+  packet_size += 8;
+
+  ags_osc_buffer_util_put_string(&osc_buffer_util,
+				 packet + packet_size,
+				 ",ss", -1);
+  
+  packet_size += 4;
+
+  /* arguments */
+  ags_osc_buffer_util_put_string(&osc_buffer_util,
+				 packet + packet_size,
+				 "dsp-load-dump", -1);
+  
+  packet_size += 16;
+
+  ags_osc_buffer_util_put_string(&osc_buffer_util,
+				 packet + packet_size,
+				 dump, length);
+
+  packet_size += (4 * (guint) ceil((double) (length + 1) / 4.0));
+
+  /* packet size */
+  ags_osc_buffer_util_put_int32(&osc_buffer_util,
+				packet,
+				packet_size);
+
+  g_object_set(osc_response,
+	       "packet", packet,
+	       "packet-size", packet_size,
+	       NULL);
+
+  g_free(dump);
+  
+  return(start_response);
+}
+
+GList*
+ags_osc_status_controller_get_trace_dump(AgsOscStatusController *osc_status_controller)
+{
+  AgsOscResponse *osc_response;
+  
+  AgsOscBufferUtil osc_buffer_util;
+
+  GList *start_response;
+
+  GError *error;
+  
+  gchar *filename;
+  guchar *packet;
+
+  guint packet_size;
+  guint length;
+
+  osc_buffer_util.major = 1;
+  osc_buffer_util.minor = 0;
+
+  start_response = NULL;
+
+  osc_response = ags_osc_response_new();
+  start_response = g_list_prepend(start_response,
+				  osc_response);
+
+  filename = ags_trace_get_filename();
+
+  error = NULL;
+  
+  if(!ags_trace_dump_to_file(filename,
+			     &error)){
+    ags_osc_response_set_flags(osc_response,
+			       AGS_OSC_RESPONSE_ERROR);
+
+    g_object_set(osc_response,
+		 "error-message", AGS_OSC_RESPONSE_ERROR_MESSAGE_SERVER_FAILURE,
+		 NULL);
+
+    if(error != NULL){
+      g_warning("%s", error->message);
+
+      g_error_free(error);
+    }
+    
+    g_free(filename);
+
+    return(start_response);
+  }
+  
+  length = strlen(filename);
+
+  /* size prefix, path, type tag, trace-dump argument and filename */
+  packet_size = 4 + 8 + 4 + 12;
+  packet_size += (4 * (guint) ceil((double) (length + 1) / 4.0));
+
+  packet = (guchar *) malloc(packet_size * sizeof(guchar));
+  memset(packet, 0, packet_size * sizeof(guchar));
+
+  /* message path */
+  packet_size = 4;
+
+  ags_osc_buffer_util_put_string(&osc_buffer_util,
+				 packet + packet_size,
+				 "/status", -1);
+      
+  packet_size += 8;
+
+  ags_osc_buffer_util_put_string(&osc_buffer_util,
+				 packet + packet_size,
+				 ",ss", -1);
+  
+  packet_size += 4;
+
+  /* arguments */
+  ags_osc_buffer_util_put_string(&osc_buffer_util,
+				 packet + packet_size,
+				 "trace-dump", -1);
+  
+  packet_size += 12;
+
+  ags_osc_buffer_util_put_string(&osc_buffer_util,
+				 packet + packet_size,
+				 filename, length);
+
+  packet_size += (4 * (guint) ceil((double) (length + 1) / 4.0));
+
+  /* packet size */
+  ags_osc_buffer_util_put_int32(&osc_buffer_util,
+				packet,
+				packet_size);
+
+  g_object_set(osc_response,
+	       "packet", packet,
+	       "packet-size", packet_size,
+	       NULL);
+
+  g_free(filename);
+  
+  return(start_response);
+}
+
 /**
  * ags_osc_status_controller_get_status:
  * @osc_status_controller: the #AgsOscStatusController
@@ -604,5 +604,8 @@ ags_apply_bpm_new(GObject *scope,
 					   "bpm", bpm,
 					   NULL);
 
+  ags_task_set_coalesce_key((AgsTask *) apply_bpm,
+			    scope, "bpm");
+
   return(apply_bpm);
 }
@@ -480,8 +480,42 @@ ags_apply_sound_config_soundcard_presets(AgsTask *task,
       if(i >= available_soundcard_count){
 	if(soundcard_type == AGS_TYPE_ALSA_DEVOUT){
 	  io_soundcard = (GObject *) ags_alsa_devout_new();
+
+	  str = ags_config_get_value(config,
+				     soundcard_group,
+				     "alsa-access-mode");
+
+	  if(str != NULL &&
+	     !g_ascii_strncasecmp(str,
+				  "mmap",
+				  5)){
+	    ags_alsa_devout_set_flags(AGS_ALSA_DEVOUT(io_soundcard),
+				      AGS_ALSA_DEVOUT_MMAP);
+	  }else{
+	    ags_alsa_devout_unset_flags(AGS_ALSA_DEVOUT(io_soundcard),
+					AGS_ALSA_DEVOUT_MMAP);
+	  }
+
+	  g_free(str);
 	}else if(soundcard_type == AGS_TYPE_ALSA_DEVIN){
 	  io_soundcard = (GObject *) ags_alsa_devin_new();
+
+	  str = ags_config_get_value(config,
+				     soundcard_group,
+				     "alsa-access-mode");
+
+	  if(str != NULL &&
+	     !g_ascii_strncasecmp(str,
+				  "mmap",
+				  5)){
+	    ags_alsa_devin_set_flags(AGS_ALSA_DEVIN(io_soundcard),
+				     AGS_ALSA_DEVIN_MMAP);
+	  }else{
+	    ags_alsa_devin_unset_flags(AGS_ALSA_DEVIN(io_soundcard),
+				       AGS_ALSA_DEVIN_MMAP);
+	  }
+
+	  g_free(str);
 	}else if(soundcard_type == AGS_TYPE_OSS_DEVOUT){
 	  io_soundcard = (GObject *) ags_oss_devout_new();
 	}else if(soundcard_type == AGS_TYPE_OSS_DEVIN){
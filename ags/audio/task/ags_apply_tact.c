@@ -530,6 +530,9 @@ ags_apply_tact_new(GObject *scope,
 					     "scope", scope,
 					     "tact", tact,
 					     NULL);
+
+  ags_task_set_coalesce_key((AgsTask *) apply_tact,
+			    scope, "tact");
   
   return(apply_tact);
 }
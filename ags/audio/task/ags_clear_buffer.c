@@ -19,6 +19,8 @@
 
 #include <ags/audio/task/ags_clear_buffer.h>
 
+#include <ags/audio/ags_offline_devout.h>
+
 #include <ags/audio/alsa/ags_alsa_devout.h>
 #include <ags/audio/alsa/ags_alsa_devin.h>
 #include <ags/audio/alsa/ags_alsa_midiin.h>
@@ -665,6 +667,19 @@ ags_clear_buffer_launch(AgsTask *task)
     memset(core_audio_devin->app_buffer[nth_buffer], 0, (size_t) pcm_channels * buffer_size * word_size);
 
     ags_soundcard_unlock_buffer(AGS_SOUNDCARD(clear_buffer->device), core_audio_devin->app_buffer[nth_buffer]);
+  }else if(AGS_IS_OFFLINE_DEVOUT(clear_buffer->device)){
+    AgsOfflineDevout *offline_devout;
+
+    offline_devout = (AgsOfflineDevout *) clear_buffer->device;
+
+    /* retrieve nth buffer */
+    nth_buffer = offline_devout->app_buffer_mode;
+
+    ags_soundcard_lock_buffer(AGS_SOUNDCARD(clear_buffer->device), offline_devout->app_buffer[nth_buffer]);
+    
+    memset(offline_devout->app_buffer[nth_buffer], 0, (size_t) pcm_channels * buffer_size * word_size);
+
+    ags_soundcard_unlock_buffer(AGS_SOUNDCARD(clear_buffer->device), offline_devout->app_buffer[nth_buffer]);
   }else if(AGS_IS_JACK_MIDIIN(clear_buffer->device)){
     //TODO:JK: implement me
   }else if(AGS_IS_CORE_AUDIO_MIDIIN(clear_buffer->device)){
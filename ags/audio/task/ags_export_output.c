@@ -19,6 +19,8 @@
 
 #include <ags/audio/task/ags_export_output.h>
 
+#include <ags/audio/ags_offline_devout.h>
+
 #include <ags/audio/file/ags_audio_file.h>
 #include <ags/audio/file/ags_sndfile.h>
 
@@ -49,6 +51,10 @@ void ags_export_output_launch(AgsTask *task);
  * @include: ags/audio/task/ags_export_output.h
  *
  * The #AgsExportOutput task exports #GObject to file.
+ *
+ * If not a live performance and the soundcard is an #AgsOfflineDevout,
+ * it is set free running until the export thread stops. Both the export
+ * dialog and #AgsOscExportController launch this task.
  */
 
 static gpointer ags_export_output_parent_class = NULL;
@@ -485,6 +491,13 @@ ags_export_output_launch(AgsTask *task)
   ags_export_thread_set_flags(export_thread,
 			      AGS_EXPORT_THREAD_IS_EXPORTING);
 
+  /* render faster than real-time, if not a live performance */
+  if(!export_output->live_performance &&
+     AGS_IS_OFFLINE_DEVOUT(soundcard)){
+    ags_offline_devout_set_flags((AgsOfflineDevout *) soundcard,
+				 AGS_OFFLINE_DEVOUT_FREE_RUN);
+  }
+
 #ifdef AGS_DEBUG
   g_message("export output");
 #endif
@@ -430,5 +430,8 @@ ags_set_buffer_size_new(GObject *scope,
 						      "buffer-size", buffer_size,
 						      NULL);
 
+  ags_task_set_coalesce_key((AgsTask *) set_buffer_size,
+			    scope, "buffer-size");
+
   return(set_buffer_size);
 }
@@ -302,5 +302,8 @@ ags_set_device_new(GObject *scope, gchar *device)
 					     "device", device,
 					     NULL);
 
+  ags_task_set_coalesce_key((AgsTask *) set_device,
+			    scope, "device");
+
   return(set_device);
 }
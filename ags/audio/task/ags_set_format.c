@@ -364,5 +364,8 @@ ags_set_format_new(GObject *scope,
 					     "format", format,
 					     NULL);
 
+  ags_task_set_coalesce_key((AgsTask *) set_format,
+			    scope, "format");
+
   return(set_format);
 }
@@ -443,6 +443,9 @@ ags_set_muted_new(GObject *scope,
 					   "scope", scope,
 					   "muted", muted,
 					   NULL);
+
+  ags_task_set_coalesce_key((AgsTask *) set_muted,
+			    scope, "muted");
   
   return(set_muted);
 }
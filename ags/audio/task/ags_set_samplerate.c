@@ -430,5 +430,8 @@ ags_set_samplerate_new(GObject *scope,
 						     "samplerate", samplerate,
 						     NULL);
 
+  ags_task_set_coalesce_key((AgsTask *) set_samplerate,
+			    scope, "samplerate");
+
   return(set_samplerate);
 }
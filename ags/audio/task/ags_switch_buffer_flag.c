@@ -19,6 +19,8 @@
 
 #include <ags/audio/task/ags_switch_buffer_flag.h>
 
+#include <ags/audio/ags_offline_devout.h>
+
 #include <ags/audio/alsa/ags_alsa_devout.h>
 #include <ags/audio/alsa/ags_alsa_devin.h>
 #include <ags/audio/alsa/ags_alsa_midiin.h>
@@ -278,6 +280,8 @@ ags_switch_buffer_flag_launch(AgsTask *task)
     ags_core_audio_devout_switch_buffer_flag((AgsCoreAudioDevout *) switch_buffer_flag->device);
   }else if(AGS_IS_CORE_AUDIO_DEVIN(switch_buffer_flag->device)){
     ags_core_audio_devin_switch_buffer_flag((AgsCoreAudioDevin *) switch_buffer_flag->device);
+  }else if(AGS_IS_OFFLINE_DEVOUT(switch_buffer_flag->device)){
+    ags_offline_devout_switch_buffer_flag((AgsOfflineDevout *) switch_buffer_flag->device);
   }else if(AGS_IS_ALSA_MIDIIN(switch_buffer_flag->device)){
     ags_alsa_midiin_switch_buffer_flag((AgsAlsaMidiin *) switch_buffer_flag->device);
   }else if(AGS_IS_OSS_MIDIIN(switch_buffer_flag->device)){
@@ -735,6 +735,12 @@ ags_write_vst3_port_new(AgsFxVst3Audio *fx_vst3_audio,
 						      "sound-scope", sound_scope,
 						      "audio-channel", audio_channel,
 						      NULL);
+
+  /* automation floods port writes, last write wins per scope and audio channel */
+  ags_task_set_coalesce_key((AgsTask *) write_vst3_port,
+			    port, "value");
+  ags_task_set_coalesce_detail((AgsTask *) write_vst3_port,
+			       ((((guint) (sound_scope + 1)) & 0xffff) << 16) | (((guint) (audio_channel + 1)) & 0xffff));
   
   return(write_vst3_port);
 }
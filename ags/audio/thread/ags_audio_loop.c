@@ -25,6 +25,7 @@
 #include <ags/audio/ags_playback.h>
 #include <ags/audio/ags_audio.h>
 #include <ags/audio/ags_channel.h>
+#include <ags/audio/ags_recall_profiler.h>
 
 #include <ags/audio/thread/ags_soundcard_thread.h>
 #include <ags/audio/thread/ags_sequencer_thread.h>
@@ -34,6 +35,12 @@
 
 #include <ags/audio/task/ags_apply_bpm.h>
 
+#include <ags/config.h>
+
+#if !defined(AGS_W32API)
+#include <signal.h>
+#endif
+
 #include <ags/i18n.h>
 
 void ags_audio_loop_class_init(AgsAudioLoopClass *audio_loop);
@@ -75,6 +82,14 @@ void ags_audio_loop_play_audio_super_threaded(AgsAudioLoop *audio_loop,
 					      AgsPlaybackDomain *playback_domain);
 void ags_audio_loop_sync_audio_super_threaded(AgsAudioLoop *audio_loop,
 					      AgsPlaybackDomain *playback_domain);
+void ags_audio_loop_play_audio_work_stealing(AgsAudioLoop *audio_loop,
+					     GList *play_audio);
+
+void ags_audio_loop_work_stealing_run_audio_thread(gpointer data);
+gboolean ags_audio_loop_test_work_stealing_graph_modified(AgsAudioLoop *audio_loop);
+guint ags_audio_loop_collect_work_stealing_audio_thread(AgsAudioLoop *audio_loop,
+							GList *play_audio,
+							AgsThread **audio_thread);
 
 /**
  * SECTION:ags_audio_loop
@@ -236,6 +251,9 @@ ags_audio_loop_init(AgsAudioLoop *audio_loop)
 
   AgsConfig *config;
 
+  gchar *thread_model;
+  gchar *str;
+  
   gdouble frequency;
   guint samplerate;
   guint buffer_size;
@@ -296,6 +314,101 @@ ags_audio_loop_init(AgsAudioLoop *audio_loop)
 
   ags_audio_tree_dispatcher_set_staging_program(audio_loop->audio_tree_dispatcher,
 						audio_loop->staging_program, audio_loop->staging_program_count);
+
+  /* work-stealing */
+  audio_loop->work_stealing_scheduler = NULL;
+
+  audio_loop->work_stealing_count = 0;
+  audio_loop->work_stealing_thread = NULL;
+  audio_loop->work_stealing_stamp = NULL;
+
+  audio_loop->flags |= AGS_AUDIO_LOOP_WORK_STEALING_GRAPH_MODIFIED;
+
+  /* tempo map */
+  audio_loop->tempo_map = ags_tempo_map_alloc();
+
+  thread_model = ags_config_get_value(config,
+				      AGS_CONFIG_THREAD,
+				      "model");
+
+  if(thread_model != NULL &&
+     !g_ascii_strncasecmp(thread_model,
+			  "work-stealing",
+			  14)){
+    guint worker_count;
+    
+    worker_count = 0;
+    
+    str = ags_config_get_value(config,
+			       AGS_CONFIG_THREAD,
+			       "work-stealing-workers");
+
+    if(str != NULL){
+      worker_count = (guint) g_ascii_strtoull(str,
+					      NULL,
+					      10);
+    }
+
+    audio_loop->work_stealing_scheduler = ags_work_stealing_scheduler_new(worker_count);
+
+    g_free(str);
+  }
+
+  g_free(thread_model);
+
+  /* DSP load profiler */
+  str = ags_config_get_value(config,
+			     AGS_CONFIG_THREAD,
+			     "dsp-load-profiler");
+
+  if(str != NULL &&
+     !g_ascii_strncasecmp(str,
+			  "true",
+			  5)){
+    ags_recall_profiler_set_enabled(TRUE);
+  }
+
+  g_free(str);
+
+  /* trace event recorder, dumped by SIGUSR2 or OSC */
+  str = ags_config_get_value(config,
+			     AGS_CONFIG_THREAD,
+			     "trace-buffer-size");
+
+  if(str != NULL){
+    ags_trace_set_buffer_size((guint) g_ascii_strtoull(str,
+						       NULL,
+						       10));
+  }
+
+  g_free(str);
+
+  str = ags_config_get_value(config,
+			     AGS_CONFIG_THREAD,
+			     "trace-filename");
+
+  if(str != NULL){
+    ags_trace_set_filename(str);
+  }
+
+  g_free(str);
+
+  str = ags_config_get_value(config,
+			     AGS_CONFIG_THREAD,
+			     "trace");
+
+  if(str != NULL &&
+     !g_ascii_strncasecmp(str,
+			  "true",
+			  5)){
+#if !defined(AGS_W32API)
+    ags_trace_add_dump_signal(SIGUSR2);
+#endif
+    
+    ags_trace_set_enabled(TRUE);
+  }
+
+  g_free(str);
 }
 
 void
@@ -407,8 +520,21 @@ ags_audio_loop_dispose(GObject *gobject)
 {
   AgsAudioLoop *audio_loop;
 
+  guint i;
+  
   audio_loop = AGS_AUDIO_LOOP(gobject);
 
+  /* work-stealing scheduler */
+  if(audio_loop->work_stealing_scheduler != NULL){
+    ags_work_stealing_scheduler_stop(audio_loop->work_stealing_scheduler);
+  }
+
+  for(i = 0; i < audio_loop->work_stealing_count; i++){
+    g_object_unref(audio_loop->work_stealing_thread[i]);
+  }
+
+  audio_loop->work_stealing_count = 0;
+
   /* unref AgsPlayback lists */
   if(audio_loop->play_channel != NULL){
     g_list_free_full(audio_loop->play_channel,
@@ -442,6 +568,17 @@ ags_audio_loop_finalize(GObject *gobject)
   g_list_free_full(audio_loop->play_audio,
 		   g_object_unref);
 
+  /* work-stealing scheduler */
+  if(audio_loop->work_stealing_scheduler != NULL){
+    g_object_unref(audio_loop->work_stealing_scheduler);
+  }
+
+  g_free(audio_loop->work_stealing_thread);
+  g_free(audio_loop->work_stealing_stamp);
+
+  /* tempo map */
+  ags_tempo_map_free(audio_loop->tempo_map);
+
   /* call parent */
   G_OBJECT_CLASS(ags_audio_loop_parent_class)->finalize(gobject);
 }
@@ -673,21 +810,21 @@ ags_audio_loop_run(AgsThread *thread)
 
   AgsTaskLauncher *task_launcher;
   AgsFrameClock *frame_clock;
-  AgsTimestamp *timestamp;
   
   AgsApplicationContext *application_context;
 
   GObject *soundcard;
 
   GList *start_queue;
-  GList *start_program, *program;
-  GList *start_marker, *marker;
+  GList *start_program;
    
   guint play_audio_ref, play_channel_ref;
 
   gdouble delay, delay_counter;
+  gdouble bpm;
   guint64 note_offset;
   guint64 x, x_end;
+  guint modified_stamp;
   
   GRecMutex *thread_mutex;
 
@@ -779,6 +916,26 @@ ags_audio_loop_run(AgsThread *thread)
     }
   }
 
+  /* recall profiler */
+  if(AGS_RECALL_PROFILER_IS_ENABLED()){
+    guint samplerate;
+    guint buffer_size;
+
+    samplerate = AGS_SOUNDCARD_DEFAULT_SAMPLERATE;
+    buffer_size = AGS_SOUNDCARD_DEFAULT_BUFFER_SIZE;
+    
+    if(soundcard != NULL){
+      ags_soundcard_get_presets(AGS_SOUNDCARD(soundcard),
+				NULL,
+				&samplerate,
+				&buffer_size,
+				NULL);
+    }
+
+    ags_recall_profiler_tic(ags_recall_profiler_get_instance(),
+			    (gint64) AGS_NSEC_PER_SEC * (gint64) buffer_size / (gint64) samplerate);
+  }
+  
   /* check tempo */  
   /* retrieve position */
   note_offset = 0;
@@ -798,55 +955,32 @@ ags_audio_loop_run(AgsThread *thread)
   x = ((double) note_offset + (delay_counter / delay)) * ((1.0 / AGS_PROGRAM_MINIMUM_MARKER_LENGTH) * AGS_NOTATION_MINIMUM_NOTE_LENGTH);
   x_end = ((double) (note_offset + 1)) * ((1.0 / AGS_PROGRAM_MINIMUM_MARKER_LENGTH) * AGS_NOTATION_MINIMUM_NOTE_LENGTH);
 
-  program =
-    start_program = ags_sound_provider_get_tempo(AGS_SOUND_PROVIDER(application_context));
-
-  timestamp = ags_timestamp_new();
+  /* compile tempo map if modified */
+  modified_stamp = ags_program_global_get_modified_stamp();
 
-  timestamp->flags &= (~AGS_TIMESTAMP_UNIX);
-  timestamp->flags |= AGS_TIMESTAMP_OFFSET;
-  
-  timestamp->timer.ags_offset.offset = AGS_PROGRAM_DEFAULT_OFFSET * floor(x / AGS_PROGRAM_DEFAULT_OFFSET);
-  
-  while((program = ags_program_find_near_timestamp(program, timestamp)) != NULL){
-    marker = 
-      start_marker = ags_program_get_marker(program->data);
-
-    while(marker != NULL){
-      if(ags_marker_get_x(marker->data) > x_end){
-	break;
-      }
-
-      if(ags_marker_get_x(marker->data) >= x &&
-	 ags_marker_get_x(marker->data) < x_end){
-	AgsApplyBpm *apply_bpm;
-
-	AgsApplicationContext *application_context;
-  
-	application_context = ags_application_context_get_instance();
-
-	/* get task thread */
-	apply_bpm = ags_apply_bpm_new((GObject *) application_context,
-				      ags_marker_get_y(marker->data));
-
-	ags_task_launcher_add_task(task_launcher,
-				   (AgsTask *) apply_bpm);
-
-      }
-      
-      marker = marker->next;
-    }
+  if(audio_loop->tempo_map->stamp != modified_stamp){
+    start_program = ags_sound_provider_get_tempo(AGS_SOUND_PROVIDER(application_context));
 
-    g_list_free_full(start_marker,
-		     (GDestroyNotify) g_object_unref);
+    ags_tempo_map_compile(audio_loop->tempo_map,
+			  start_program,
+			  modified_stamp);
     
-    program = program->next;
+    g_list_free_full(start_program,
+		     (GDestroyNotify) g_object_unref);
   }
 
-  g_list_free_full(start_program,
-		   (GDestroyNotify) g_object_unref);
+  /* apply tempo changes within current tic */
+  while(ags_tempo_map_next(audio_loop->tempo_map,
+			   x, x_end,
+			   &bpm)){
+    AgsApplyBpm *apply_bpm;
+
+    apply_bpm = ags_apply_bpm_new((GObject *) application_context,
+				  bpm);
 
-  g_object_unref(timestamp);
+    ags_task_launcher_add_task(task_launcher,
+			       (AgsTask *) apply_bpm);
+  }
   
   /* decide if we stop */
   if(play_channel_ref == 0 &&
@@ -1123,7 +1257,8 @@ ags_audio_loop_play_audio(AgsAudioLoop *audio_loop)
   GList *recall_id;
   
   gint sound_scope;
-
+  gboolean has_work_stealing;
+  
   GRecMutex *thread_mutex;
 
   application_context = ags_application_context_get_instance();
@@ -1132,6 +1267,8 @@ ags_audio_loop_play_audio(AgsAudioLoop *audio_loop)
 
   thread_mutex = AGS_THREAD_GET_OBJ_MUTEX(audio_loop);
 
+  has_work_stealing = FALSE;
+  
   /* get play audio */
   g_rec_mutex_lock(thread_mutex);
 
@@ -1193,7 +1330,10 @@ ags_audio_loop_play_audio(AgsAudioLoop *audio_loop)
       }
     }
 
-    if(ags_playback_domain_test_flags(playback_domain, AGS_PLAYBACK_DOMAIN_SUPER_THREADED_AUDIO)){
+    if(ags_playback_domain_test_flags(playback_domain, AGS_PLAYBACK_DOMAIN_WORK_STEALING)){
+      /* work-stealing - run below */
+      has_work_stealing = TRUE;
+    }else if(ags_playback_domain_test_flags(playback_domain, AGS_PLAYBACK_DOMAIN_SUPER_THREADED_AUDIO)){
       /* super threaded */
       ags_audio_loop_play_audio_super_threaded(audio_loop,
 					       playback_domain);
@@ -1212,6 +1352,12 @@ ags_audio_loop_play_audio(AgsAudioLoop *audio_loop)
     /* iterate */
     play_audio = play_audio->next;
   }
+
+  /* work-stealing */
+  if(has_work_stealing){
+    ags_audio_loop_play_audio_work_stealing(audio_loop,
+					    start_play_audio);
+  }
   
   /* sync audio */
   play_audio = start_play_audio;
@@ -1220,7 +1366,8 @@ ags_audio_loop_play_audio(AgsAudioLoop *audio_loop)
     playback_domain = (AgsPlaybackDomain *) play_audio->data;
 
     /* sync */
-    if(ags_playback_domain_test_flags(playback_domain, AGS_PLAYBACK_DOMAIN_SUPER_THREADED_AUDIO)){
+    if(!ags_playback_domain_test_flags(playback_domain, AGS_PLAYBACK_DOMAIN_WORK_STEALING) &&
+       ags_playback_domain_test_flags(playback_domain, AGS_PLAYBACK_DOMAIN_SUPER_THREADED_AUDIO)){
       ags_audio_loop_sync_audio_super_threaded(audio_loop,
 					       playback_domain);
     }
@@ -1374,6 +1521,457 @@ ags_audio_loop_sync_audio_super_threaded(AgsAudioLoop *audio_loop, AgsPlaybackDo
   g_object_unref(audio);
 }
 
+void
+ags_audio_loop_work_stealing_run_audio_thread(gpointer data)
+{
+  AgsAudioThread *audio_thread;
+
+  AgsTaskLauncher *task_launcher;
+
+  audio_thread = (AgsAudioThread *) data;
+
+  task_launcher = ags_audio_thread_get_task_launcher(audio_thread);
+
+  if(task_launcher != NULL){
+    ags_task_launcher_run(task_launcher);
+
+    g_object_unref(task_launcher);
+  }
+
+  if(ags_audio_thread_get_processing(audio_thread)){
+    ags_audio_tree_dispatcher_run(audio_thread->audio_tree_dispatcher);
+  }
+}
+
+gboolean
+ags_audio_loop_test_work_stealing_graph_modified(AgsAudioLoop *audio_loop)
+{
+  guint i;
+  gboolean graph_modified;
+  
+  GRecMutex *thread_mutex;
+
+  thread_mutex = AGS_THREAD_GET_OBJ_MUTEX(audio_loop);
+
+  /* test and clear, modifications after this point are seen next tic */
+  g_rec_mutex_lock(thread_mutex);
+
+  graph_modified = ((AGS_AUDIO_LOOP_WORK_STEALING_GRAPH_MODIFIED & (audio_loop->flags)) != 0) ? TRUE: FALSE;
+
+  audio_loop->flags &= (~AGS_AUDIO_LOOP_WORK_STEALING_GRAPH_MODIFIED);
+  
+  g_rec_mutex_unlock(thread_mutex);
+
+  if(graph_modified){
+    return(TRUE);
+  }
+  
+  /* compare the cached audio threads with their tree list */
+  for(i = 0; i < audio_loop->work_stealing_count; i++){
+    if(ags_audio_tree_dispatcher_get_tree_list_stamp(AGS_AUDIO_THREAD(audio_loop->work_stealing_thread[i])->audio_tree_dispatcher) != audio_loop->work_stealing_stamp[i]){
+      return(TRUE);
+    }
+  }
+
+  return(FALSE);
+}
+
+guint
+ags_audio_loop_collect_work_stealing_audio_thread(AgsAudioLoop *audio_loop,
+						  GList *play_audio,
+						  AgsThread **audio_thread)
+{
+  guint audio_thread_count;
+
+  audio_thread_count = 0;
+
+  while(play_audio != NULL){
+    AgsPlaybackDomain *playback_domain;
+    AgsAudio *audio;
+
+    gint sound_scope;
+
+    playback_domain = (AgsPlaybackDomain *) play_audio->data;
+
+    if(!ags_playback_domain_test_flags(playback_domain, AGS_PLAYBACK_DOMAIN_WORK_STEALING)){
+      play_audio = play_audio->next;
+
+      continue;
+    }
+
+    audio = NULL;
+    g_object_get(playback_domain,
+		 "audio", &audio,
+		 NULL);
+
+    for(sound_scope = 0; sound_scope < AGS_SOUND_SCOPE_LAST; sound_scope++){
+      AgsThread *thread;
+
+      GList *recall_id;
+
+      if(sound_scope == AGS_SOUND_SCOPE_PLAYBACK){
+	continue;
+      }
+
+      if((recall_id = ags_audio_check_scope(audio, sound_scope)) != NULL){
+	thread = ags_playback_domain_get_audio_thread(playback_domain,
+						      sound_scope);
+
+	if(thread != NULL){
+	  if(ags_audio_thread_get_processing((AgsAudioThread *) thread)){
+	    /* collect - keep reference */
+	    audio_thread[audio_thread_count] = thread;
+	    
+	    audio_thread_count++;
+	  }else{
+	    g_object_unref(thread);
+	  }
+	}
+
+	g_list_free_full(recall_id,
+			 g_object_unref);
+      }
+    }
+
+    if(audio != NULL){
+      g_object_unref(audio);
+    }
+
+    /* iterate */
+    play_audio = play_audio->next;
+  }
+
+  return(audio_thread_count);
+}
+
+/**
+ * ags_audio_loop_compile_work_stealing_graph:
+ * @audio_loop: the #AgsAudioLoop
+ * @audio_thread: (array length=audio_thread_count): the #AgsAudioThread to run in play order
+ * @audio_thread_count: the audio thread count
+ *
+ * Compile the dependency graph of the work-stealing scheduler. Every audio thread
+ * becomes a node running its #AgsAudioTreeDispatcher. A node depends on the nodes
+ * of the same sound scope whose #AgsAudio output is linked to one of its inputs,
+ * since the input shares the recycling the source writes to. Nodes are then
+ * ordered topologically, play order breaking ties, and 2 nodes touching the same
+ * #AgsAudio in their tree list are serialized in this order. Unrelated nodes run
+ * in parallel.
+ *
+ * Since: 9.1.0
+ */
+void
+ags_audio_loop_compile_work_stealing_graph(AgsAudioLoop *audio_loop,
+					   AgsThread **audio_thread,
+					   guint audio_thread_count)
+{
+  AgsWorkStealingScheduler *work_stealing_scheduler;
+
+  GHashTable *last_node;
+
+  GObject **node_audio;
+  gint *node_sound_scope;
+  gboolean *depends;
+  guint *order;
+  guint *rank;
+  gboolean *placed;
+
+  guint i, j, k;
+
+  g_return_if_fail(AGS_IS_AUDIO_LOOP(audio_loop));
+
+  work_stealing_scheduler = audio_loop->work_stealing_scheduler;
+
+  if(work_stealing_scheduler == NULL){
+    return;
+  }
+
+  /* replace cached audio threads */
+  for(i = 0; i < audio_loop->work_stealing_count; i++){
+    g_object_unref(audio_loop->work_stealing_thread[i]);
+  }
+
+  audio_loop->work_stealing_thread = (AgsThread **) g_realloc(audio_loop->work_stealing_thread,
+							      audio_thread_count * sizeof(AgsThread *));
+  audio_loop->work_stealing_stamp = (gint64 *) g_realloc(audio_loop->work_stealing_stamp,
+							 audio_thread_count * sizeof(gint64));
+
+  audio_loop->work_stealing_count = audio_thread_count;
+
+  ags_work_stealing_scheduler_clear_graph(work_stealing_scheduler);
+
+  if(audio_thread_count == 0){
+    return;
+  }
+  
+  node_audio = (GObject **) g_malloc(audio_thread_count * sizeof(GObject *));
+  node_sound_scope = (gint *) g_malloc(audio_thread_count * sizeof(gint));
+
+  for(i = 0; i < audio_thread_count; i++){
+    GRecMutex *thread_mutex;
+
+    g_object_ref(audio_thread[i]);
+
+    audio_loop->work_stealing_thread[i] = audio_thread[i];
+    audio_loop->work_stealing_stamp[i] = ags_audio_tree_dispatcher_get_tree_list_stamp(AGS_AUDIO_THREAD(audio_thread[i])->audio_tree_dispatcher);
+
+    ags_work_stealing_scheduler_add_node(work_stealing_scheduler,
+					 ags_audio_loop_work_stealing_run_audio_thread, audio_thread[i]);
+
+    thread_mutex = AGS_THREAD_GET_OBJ_MUTEX(audio_thread[i]);
+
+    node_audio[i] = NULL;
+    
+    g_object_get(audio_thread[i],
+		 "audio", &(node_audio[i]),
+		 NULL);
+
+    g_rec_mutex_lock(thread_mutex);
+
+    node_sound_scope[i] = AGS_AUDIO_THREAD(audio_thread[i])->sound_scope;
+
+    g_rec_mutex_unlock(thread_mutex);
+  }
+
+  /* depend on the nodes whose output is linked to an input */
+  depends = (gboolean *) g_malloc0(audio_thread_count * audio_thread_count * sizeof(gboolean));
+
+  for(i = 0; i < audio_thread_count; i++){
+    AgsChannel *input, *next_input;
+    AgsChannel *link;
+
+    if(node_audio[i] == NULL){
+      continue;
+    }
+    
+    input = ags_audio_get_input((AgsAudio *) node_audio[i]);
+
+    while(input != NULL){
+      link = ags_channel_get_link(input);
+
+      if(link != NULL){
+	GObject *link_audio;
+
+	link_audio = (GObject *) ags_channel_get_audio(link);
+
+	for(j = 0; j < audio_thread_count; j++){
+	  if(j != i &&
+	     link_audio != NULL &&
+	     node_audio[j] == link_audio &&
+	     node_sound_scope[j] == node_sound_scope[i]){
+	    depends[i * audio_thread_count + j] = TRUE;
+	  }
+	}
+
+	if(link_audio != NULL){
+	  g_object_unref(link_audio);
+	}
+	
+	g_object_unref(link);
+      }
+
+      /* iterate */
+      next_input = ags_channel_next(input);
+
+      g_object_unref(input);
+
+      input = next_input;
+    }
+  }
+
+  /* topological order, play order breaking ties */
+  order = (guint *) g_malloc(audio_thread_count * sizeof(guint));
+  rank = (guint *) g_malloc(audio_thread_count * sizeof(guint));
+  placed = (gboolean *) g_malloc0(audio_thread_count * sizeof(gboolean));
+
+  for(k = 0; k < audio_thread_count; k++){
+    guint next;
+    
+    next = audio_thread_count;
+    
+    for(i = 0; i < audio_thread_count && next == audio_thread_count; i++){
+      gboolean ready;
+
+      if(placed[i]){
+	continue;
+      }
+
+      ready = TRUE;
+      
+      for(j = 0; j < audio_thread_count; j++){
+	if(depends[i * audio_thread_count + j] &&
+	   !placed[j]){
+	  ready = FALSE;
+
+	  break;
+	}
+      }
+
+      if(ready){
+	next = i;
+      }
+    }
+
+    /* links are acyclic, fall back to play order anyway */
+    if(next == audio_thread_count){
+      for(i = 0; i < audio_thread_count && placed[i]; i++);
+
+      next = i;
+    }
+
+    order[k] = next;
+    rank[next] = k;
+    placed[next] = TRUE;
+  }
+
+  /* link dependencies - only along the order to keep the graph acyclic */
+  for(i = 0; i < audio_thread_count; i++){
+    for(j = 0; j < audio_thread_count; j++){
+      if(depends[i * audio_thread_count + j] &&
+	 rank[j] < rank[i]){
+	ags_work_stealing_scheduler_add_dependency(work_stealing_scheduler,
+						   i, j);
+      }
+    }
+  }
+  
+  /* depend on the last node touching the same audio */
+  last_node = g_hash_table_new(g_direct_hash,
+			       g_direct_equal);
+
+  for(k = 0; k < audio_thread_count; k++){
+    GList *start_tree_list, *tree_list;
+
+    i = order[k];
+    
+    tree_list =
+      start_tree_list = ags_audio_tree_dispatcher_get_tree_list(AGS_AUDIO_THREAD(audio_thread[i])->audio_tree_dispatcher);
+
+    while(tree_list != NULL){
+      AgsDispatchAudio *dispatch_audio;
+
+      GObject *audio;
+
+      gpointer last;
+
+      dispatch_audio = AGS_DISPATCH_AUDIO(tree_list->data);
+
+      audio = NULL;
+
+      if(dispatch_audio->tree_element_type == AGS_TYPE_AUDIO){
+	audio = (GObject *) dispatch_audio->tree_element.audio;
+      }else if(dispatch_audio->tree_element_type == AGS_TYPE_OUTPUT ||
+	       dispatch_audio->tree_element_type == AGS_TYPE_INPUT){
+	audio = ags_channel_get_audio((dispatch_audio->tree_element_type == AGS_TYPE_OUTPUT) ? (AgsChannel *) dispatch_audio->tree_element.output: (AgsChannel *) dispatch_audio->tree_element.input);
+
+	if(audio != NULL){
+	  g_object_unref(audio);
+	}
+      }
+
+      if(audio != NULL){
+	last = g_hash_table_lookup(last_node,
+				   audio);
+
+	if(last != NULL &&
+	   GPOINTER_TO_UINT(last) - 1 != i){
+	  ags_work_stealing_scheduler_add_dependency(work_stealing_scheduler,
+						     i, GPOINTER_TO_UINT(last) - 1);
+	}
+
+	g_hash_table_insert(last_node,
+			    audio,
+			    GUINT_TO_POINTER(i + 1));
+      }
+
+      tree_list = tree_list->next;
+    }
+
+    g_list_free(start_tree_list);
+  }
+
+  g_hash_table_destroy(last_node);
+
+  for(i = 0; i < audio_thread_count; i++){
+    if(node_audio[i] != NULL){
+      g_object_unref(node_audio[i]);
+    }
+  }
+  
+  g_free(node_audio);
+  g_free(node_sound_scope);
+  g_free(depends);
+  g_free(order);
+  g_free(rank);
+  g_free(placed);
+}
+
+void
+ags_audio_loop_play_audio_work_stealing(AgsAudioLoop *audio_loop,
+					GList *play_audio)
+{
+  AgsWorkStealingScheduler *work_stealing_scheduler;
+
+  AgsApplicationContext *application_context;
+
+  GObject *default_soundcard;
+
+  gboolean is_playing;
+
+  work_stealing_scheduler = audio_loop->work_stealing_scheduler;
+
+  if(work_stealing_scheduler == NULL ||
+     play_audio == NULL){
+    return;
+  }
+
+  application_context = ags_application_context_get_instance();
+
+  default_soundcard = ags_sound_provider_get_default_soundcard(AGS_SOUND_PROVIDER(application_context));
+
+  is_playing = (default_soundcard != NULL &&
+		!ags_soundcard_is_starting(AGS_SOUNDCARD(default_soundcard)) &&
+		ags_soundcard_is_playing(AGS_SOUNDCARD(default_soundcard))) ? TRUE: FALSE;
+
+  if(default_soundcard != NULL){
+    g_object_unref(default_soundcard);
+  }
+
+  /* recompile graph if topology changed, else run the cached audio threads */
+  if(ags_audio_loop_test_work_stealing_graph_modified(audio_loop)){
+    AgsThread **audio_thread;
+
+    guint audio_thread_count;
+    guint i;
+    
+    audio_thread = (AgsThread **) g_malloc(g_list_length(play_audio) * AGS_SOUND_SCOPE_LAST * sizeof(AgsThread *));
+
+    audio_thread_count = ags_audio_loop_collect_work_stealing_audio_thread(audio_loop,
+									   play_audio,
+									   audio_thread);
+
+    ags_audio_loop_compile_work_stealing_graph(audio_loop,
+					       audio_thread, audio_thread_count);
+
+    for(i = 0; i < audio_thread_count; i++){
+      g_object_unref(audio_thread[i]);
+    }
+
+    g_free(audio_thread);
+  }
+
+  /* run */
+  if(!is_playing){
+    return;
+  }
+
+  if(!ags_work_stealing_scheduler_test_flags(work_stealing_scheduler, AGS_WORK_STEALING_SCHEDULER_RUNNING)){
+    ags_work_stealing_scheduler_start(work_stealing_scheduler);
+  }
+
+  ags_work_stealing_scheduler_run(work_stealing_scheduler);
+}
+
 /**
  * ags_audio_loop_test_flags:
  * @audio_loop: the #AgsAudioLoop
@@ -1502,6 +2100,8 @@ ags_audio_loop_add_audio(AgsAudioLoop *audio_loop, GObject *audio)
 					    playback_domain);
 
     audio_loop->play_audio_ref = audio_loop->play_audio_ref + 1;
+
+    audio_loop->flags |= AGS_AUDIO_LOOP_WORK_STEALING_GRAPH_MODIFIED;
   }else{
     if(playback_domain != NULL){
       g_object_unref(playback_domain);
@@ -1545,6 +2145,8 @@ ags_audio_loop_remove_audio(AgsAudioLoop *audio_loop, GObject *audio)
     audio_loop->play_audio = g_list_remove(audio_loop->play_audio,
 					   playback_domain);
     audio_loop->play_audio_ref = audio_loop->play_audio_ref - 1;
+
+    audio_loop->flags |= AGS_AUDIO_LOOP_WORK_STEALING_GRAPH_MODIFIED;
     
     g_object_unref(playback_domain);
   }
@@ -26,6 +26,7 @@
 #include <ags/libags.h>
 
 #include <ags/audio/ags_sound_enums.h>
+#include <ags/audio/ags_tempo_map.h>
 
 #include <ags/audio/thread/ags_audio_tree_dispatcher.h>
 
@@ -53,6 +54,7 @@ typedef struct _AgsAudioLoopClass AgsAudioLoopClass;
  * @AGS_AUDIO_LOOP_PLAY_AUDIO: play audio
  * @AGS_AUDIO_LOOP_PLAYING_AUDIO: playing audio
  * @AGS_AUDIO_LOOP_PLAY_AUDIO_TERMINATING: play audio terminating
+ * @AGS_AUDIO_LOOP_WORK_STEALING_GRAPH_MODIFIED: the processing audio threads changed, recompile the work-stealing graph
  * 
  * Enum values to control the behavior or indicate internal state of #AgsAudioLoop by
  * enable/disable as flags.
@@ -64,6 +66,7 @@ typedef enum{
   AGS_AUDIO_LOOP_PLAY_AUDIO                     = 1 << 3,
   AGS_AUDIO_LOOP_PLAYING_AUDIO                  = 1 << 4,
   AGS_AUDIO_LOOP_PLAY_AUDIO_TERMINATING         = 1 << 5,
+  AGS_AUDIO_LOOP_WORK_STEALING_GRAPH_MODIFIED   = 1 << 6,
 }AgsAudioLoopFlags;
 
 struct _AgsAudioLoop
@@ -93,6 +96,14 @@ struct _AgsAudioLoop
   guint staging_program_count;
 
   AgsAudioTreeDispatcher *audio_tree_dispatcher;
+
+  AgsWorkStealingScheduler *work_stealing_scheduler;
+
+  guint work_stealing_count;
+  AgsThread **work_stealing_thread;
+  gint64 *work_stealing_stamp;
+
+  AgsTempoMap *tempo_map;
 };
 
 struct _AgsAudioLoopClass
@@ -124,6 +135,11 @@ void ags_audio_loop_set_staging_program(AgsAudioLoop *audio_loop,
 					guint *staging_program,
 					guint staging_program_count);
 
+/* work-stealing */
+void ags_audio_loop_compile_work_stealing_graph(AgsAudioLoop *audio_loop,
+						AgsThread **audio_thread,
+						guint audio_thread_count);
+
 /* instantiate */
 AgsAudioLoop* ags_audio_loop_new();
 
@@ -368,15 +368,33 @@ ags_audio_thread_set_property(GObject *gobject,
     break;
   case PROP_PROCESSING:
     {
+      AgsThread *audio_loop;
+      
       gboolean processing;
-
+      gboolean modified;
+      
       processing = g_value_get_boolean(value);
 
       g_rec_mutex_lock(thread_mutex);
 
+      modified = (audio_thread->processing != processing) ? TRUE: FALSE;
+      
       audio_thread->processing = processing;
 
       g_rec_mutex_unlock(thread_mutex);
+
+      /* let the audio loop recompile its work-stealing graph */
+      if(modified){
+	audio_loop = ags_thread_get_toplevel((AgsThread *) audio_thread);
+
+	if(AGS_IS_AUDIO_LOOP(audio_loop)){
+	  ags_audio_loop_set_flags((AgsAudioLoop *) audio_loop, AGS_AUDIO_LOOP_WORK_STEALING_GRAPH_MODIFIED);
+	}
+
+	if(audio_loop != NULL){
+	  g_object_unref(audio_loop);
+	}
+      }
     }
     break;
   default:
@@ -520,10 +538,44 @@ ags_audio_thread_finalize(GObject *gobject)
 void
 ags_audio_thread_start(AgsThread *thread)
 {
+  AgsAudio *audio;
+  AgsPlaybackDomain *playback_domain;
+
+  gboolean work_stealing;
+  
   if(ags_thread_test_status_flags(thread, AGS_THREAD_STATUS_RUNNING)){
     return;
   }
 
+  /* the work-stealing scheduler of audio loop runs the tree dispatcher */
+  audio = NULL;
+
+  playback_domain = NULL;
+  
+  work_stealing = FALSE;
+  
+  g_object_get(thread,
+	       "audio", &audio,
+	       NULL);
+
+  if(audio != NULL){
+    g_object_get(audio,
+		 "playback-domain", &playback_domain,
+		 NULL);
+
+    if(playback_domain != NULL){
+      work_stealing = ags_playback_domain_test_flags(playback_domain, AGS_PLAYBACK_DOMAIN_WORK_STEALING);
+
+      g_object_unref(playback_domain);
+    }
+    
+    g_object_unref(audio);
+  }
+
+  if(work_stealing){
+    return;
+  }
+
 #ifdef AGS_DEBUG
   g_message("audio thread start - 0x%x", thread);
 #endif
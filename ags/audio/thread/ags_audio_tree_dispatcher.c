@@ -1,5 +1,5 @@
 /* GSequencer - Advanced GTK Sequencer
- * Copyright (C) 2005-2025 Joël Krähemann
+ * Copyright (C) 2005-2026 Joël Krähemann
  *
  * This file is part of GSequencer.
  *
@@ -23,19 +23,35 @@
 #include <ags/audio/ags_channel.h>
 #include <ags/audio/ags_output.h>
 #include <ags/audio/ags_input.h>
+#include <ags/audio/ags_recall.h>
 #include <ags/audio/ags_recall_id.h>
 #include <ags/audio/ags_recycling_context.h>
 
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
 
 #include <ags/i18n.h>
 
+#define AGS_AUDIO_TREE_DISPATCHER_LIFECYCLE_STAGING_MASK (AGS_SOUND_STAGING_RUN_INIT_PRE |	\
+							  AGS_SOUND_STAGING_RUN_INIT_INTER |	\
+							  AGS_SOUND_STAGING_RUN_INIT_POST |	\
+							  AGS_SOUND_STAGING_CANCEL |		\
+							  AGS_SOUND_STAGING_REMOVE |		\
+							  AGS_SOUND_STAGING_FINI)
+
+#define AGS_AUDIO_TREE_DISPATCHER_RUN_STAGING_MASK (AGS_RECALL_SNAPSHOT_RUN_STAGING_MASK)
+
 void ags_audio_tree_dispatcher_class_init(AgsAudioTreeDispatcherClass *audio_tree_dispatcher);
 void ags_audio_tree_dispatcher_init(AgsAudioTreeDispatcher *audio_tree_dispatcher);
 void ags_audio_tree_dispatcher_dispose(GObject *gobject);
 void ags_audio_tree_dispatcher_finalize(GObject *gobject);
 
+const gchar* ags_audio_tree_dispatcher_get_staging_name(guint staging_flags);
+
+void ags_audio_tree_dispatcher_free_program(AgsDispatchEntry *program,
+					    guint program_count);
+
 GList* ags_audio_tree_dispatcher_compile_tree_list_audio(AgsAudio *audio,
 							 GObject *dispatch_source,
 							 gint sound_scope,
@@ -131,8 +147,24 @@ ags_audio_tree_dispatcher_init(AgsAudioTreeDispatcher *audio_tree_dispatcher)
   /* audio tree dispatcher mutex */
   g_rec_mutex_init(&(audio_tree_dispatcher->obj_mutex)); 
 
+  /* staging program */
+  audio_tree_dispatcher->staging_program = NULL;
+  audio_tree_dispatcher->staging_program_count = 0;
+
   /* tree list */
   audio_tree_dispatcher->tree_list = NULL;
+  audio_tree_dispatcher->tree_list_stamp = 0;
+
+  /* compiled program */
+  audio_tree_dispatcher->program = NULL;
+  audio_tree_dispatcher->program_count = 0;
+
+  audio_tree_dispatcher->program_staging_flags = NULL;
+  audio_tree_dispatcher->program_staging_mask = NULL;
+  audio_tree_dispatcher->program_staging_count = 0;
+
+  audio_tree_dispatcher->program_stamp = -1;
+  audio_tree_dispatcher->program_omit_event = TRUE;
 }
 
 void
@@ -155,6 +187,15 @@ ags_audio_tree_dispatcher_finalize(GObject *gobject)
 
   g_list_free_full(audio_tree_dispatcher->tree_list,
 		   (GDestroyNotify) ags_dispatch_audio_free);
+
+  g_free(audio_tree_dispatcher->staging_program);
+
+  /* compiled program */
+  ags_audio_tree_dispatcher_free_program(audio_tree_dispatcher->program,
+					 audio_tree_dispatcher->program_count);
+
+  g_free(audio_tree_dispatcher->program_staging_flags);
+  g_free(audio_tree_dispatcher->program_staging_mask);
   
   /* call parent */
   G_OBJECT_CLASS(ags_audio_tree_dispatcher_parent_class)->finalize(gobject);
@@ -1130,6 +1171,8 @@ ags_audio_tree_dispatcher_remove_dispatch_source(AgsAudioTreeDispatcher *audio_t
       audio_tree_dispatcher->tree_list = g_list_remove(audio_tree_dispatcher->tree_list,
 						       dispatch_audio);
       ags_dispatch_audio_free(dispatch_audio);
+
+      audio_tree_dispatcher->tree_list_stamp += 1;
     }
 
     tree_list = next_tree_list;
@@ -1206,12 +1249,21 @@ ags_audio_tree_dispatcher_set_staging_program(AgsAudioTreeDispatcher *audio_tree
   /* set staging program */
   g_rec_mutex_lock(audio_tree_dispatcher_mutex);
 
-  audio_tree_dispatcher->staging_program = g_malloc(staging_program_count * sizeof(guint));
+  g_free(audio_tree_dispatcher->staging_program);
+
+  audio_tree_dispatcher->staging_program = NULL;
+
+  if(staging_program_count > 0){
+    audio_tree_dispatcher->staging_program = g_malloc(staging_program_count * sizeof(guint));
   
-  memcpy(audio_tree_dispatcher->staging_program, staging_program, staging_program_count * sizeof(guint));
+    memcpy(audio_tree_dispatcher->staging_program, staging_program, staging_program_count * sizeof(guint));
+  }
   
   audio_tree_dispatcher->staging_program_count = staging_program_count;
 
+  /* recompile on next run */
+  audio_tree_dispatcher->program_stamp = -1;
+
   g_rec_mutex_unlock(audio_tree_dispatcher_mutex);
 }
 
@@ -1265,6 +1317,8 @@ ags_audio_tree_dispatcher_set_tree_list(AgsAudioTreeDispatcher *audio_tree_dispa
   g_rec_mutex_lock(audio_tree_dispatcher_mutex);
 
   audio_tree_dispatcher->tree_list = tree_list;
+
+  audio_tree_dispatcher->tree_list_stamp += 1;
   
   g_rec_mutex_unlock(audio_tree_dispatcher_mutex);
 }
@@ -1323,69 +1377,347 @@ ags_audio_tree_dispatcher_set_tree_list_stamp(AgsAudioTreeDispatcher *audio_tree
   g_rec_mutex_unlock(audio_tree_dispatcher_mutex);
 }
 
+void
+ags_audio_tree_dispatcher_free_program(AgsDispatchEntry *program,
+				       guint program_count)
+{
+  guint i;
+
+  if(program == NULL){
+    return;
+  }
+  
+  for(i = 0; i < program_count; i++){
+    if(program[i].tree_element != NULL){
+      g_object_unref(program[i].tree_element);
+    }
+
+    if(program[i].recall_id != NULL){
+      g_object_unref(program[i].recall_id);
+    }
+  }
+
+  g_free(program);
+}
+
 /**
- * ags_audio_tree_dispatcher_run:
+ * ags_audio_tree_dispatcher_compile_program:
  * @audio_tree_dispatcher: the #AgsAudioTreeDispatcher
  * 
- * Run the dispatcher.
+ * Compile the tree list and staging program to a flat array of #AgsDispatchEntry-struct.
+ * The play recall function and the recall snapshot slot of every tree element are resolved
+ * in advance. If events are omitted, ags_audio_tree_dispatcher_run() masks the staging flags
+ * of interest per entry and staging step and skips stages without any interested entry.
+ *
+ * The program is compiled by ags_audio_tree_dispatcher_run() on demand, as soon the tree
+ * list stamp, staging program or ags_recall_global_get_omit_event() changed. Call it only
+ * from the thread running the dispatcher, since the previous program is freed.
  * 
- * Since: 8.0.0
+ * Since: 9.1.0
  */
 void
-ags_audio_tree_dispatcher_run(AgsAudioTreeDispatcher *audio_tree_dispatcher)
+ags_audio_tree_dispatcher_compile_program(AgsAudioTreeDispatcher *audio_tree_dispatcher)
 {
-  GList *start_tree_list, *tree_list;
+  AgsDispatchEntry *program, *old_program;
+  
+  GList *tree_list;
 
-  guint *staging_program;
+  guint *staging_flags, *staging_mask;
   
-  guint staging_program_count;
-  guint i;
+  guint program_count, old_program_count;
+  guint staging_count;
+  guint i, j;
+  gboolean omit_event;
   
   GRecMutex *audio_tree_dispatcher_mutex;
 
+  g_return_if_fail(AGS_IS_AUDIO_TREE_DISPATCHER(audio_tree_dispatcher));
+  
   audio_tree_dispatcher_mutex = AGS_AUDIO_TREE_DISPATCHER_GET_OBJ_MUTEX(audio_tree_dispatcher);
 
-  /* tree list */
-  tree_list = 
-    start_tree_list = ags_audio_tree_dispatcher_get_tree_list(audio_tree_dispatcher);
+  omit_event = ags_recall_global_get_omit_event();
+  
+  /* compile */
+  g_rec_mutex_lock(audio_tree_dispatcher_mutex);
+
+  tree_list = audio_tree_dispatcher->tree_list;
 
-  staging_program_count = 0;
+  program = NULL;
+  program_count = 0;
+
+  if(tree_list != NULL){
+    program = g_new0(AgsDispatchEntry,
+		     g_list_length(tree_list));
+  }
   
-  staging_program = ags_audio_tree_dispatcher_get_staging_program(audio_tree_dispatcher,
-								  &staging_program_count);
+  while(tree_list != NULL){
+    AgsDispatchAudio *dispatch_audio;
+    AgsDispatchEntry *entry;
+    AgsRecyclingContext *recycling_context, *parent_recycling_context;
 
-  for(i = 0; i < staging_program_count; i++){
-    guint staging_flags;
+    gboolean is_play;
     
-    tree_list = start_tree_list;
+    dispatch_audio = AGS_DISPATCH_AUDIO(tree_list->data);
+
+    if(dispatch_audio->recall_id == NULL){
+      tree_list = tree_list->next;
 
-    staging_flags = staging_program[i];
+      continue;
+    }
     
-    while(tree_list != NULL){
-      AgsDispatchAudio *dispatch_audio;
+    entry = program + program_count;
+    
+    /* play or recall context */
+    recycling_context = NULL;
+    parent_recycling_context = NULL;
+    
+    g_object_get(dispatch_audio->recall_id,
+		 "recycling-context", &recycling_context,
+		 NULL);
 
-      dispatch_audio = (AgsDispatchAudio *) tree_list->data;
+    if(recycling_context != NULL){
+      g_object_get(recycling_context,
+		   "parent", &parent_recycling_context,
+		   NULL);
+    }
+
+    is_play = (parent_recycling_context == NULL) ? TRUE: FALSE;
     
-      if(dispatch_audio->tree_element_type == AGS_TYPE_AUDIO){
-	ags_audio_play_recall((AgsAudio *) dispatch_audio->tree_element.audio,
-			      (AgsRecallID *) dispatch_audio->recall_id, staging_flags);      
-      }else if(dispatch_audio->tree_element_type == AGS_TYPE_OUTPUT){
-	ags_channel_play_recall((AgsChannel *) dispatch_audio->tree_element.output,
-				(AgsRecallID *) dispatch_audio->recall_id, staging_flags);
-      }else if(dispatch_audio->tree_element_type == AGS_TYPE_INPUT){
-	ags_channel_play_recall((AgsChannel *) dispatch_audio->tree_element.input,
-				(AgsRecallID *) dispatch_audio->recall_id, staging_flags);
+    if(dispatch_audio->tree_element_type == AGS_TYPE_AUDIO){
+      AgsAudio *audio;
+
+      audio = dispatch_audio->tree_element.audio;
+      
+      entry->tree_element = (GObject *) audio;
+
+      if(omit_event){
+	entry->play_recall = (AgsDispatchPlayRecallFunc) AGS_AUDIO_GET_CLASS(audio)->play_recall;
       }else{
-	g_warning("unknown audio dispatch tree element");
+	entry->play_recall = (AgsDispatchPlayRecallFunc) ags_audio_play_recall;
       }
 
-      tree_list = tree_list->next;
+      entry->snapshot_slot = (is_play) ? &(audio->play_snapshot): &(audio->recall_snapshot);
+    }else if(dispatch_audio->tree_element_type == AGS_TYPE_OUTPUT ||
+	     dispatch_audio->tree_element_type == AGS_TYPE_INPUT){
+      AgsChannel *channel;
+
+      channel = (dispatch_audio->tree_element_type == AGS_TYPE_OUTPUT) ? (AgsChannel *) dispatch_audio->tree_element.output: (AgsChannel *) dispatch_audio->tree_element.input;
+      
+      entry->tree_element = (GObject *) channel;
+
+      if(omit_event){
+	entry->play_recall = (AgsDispatchPlayRecallFunc) AGS_CHANNEL_GET_CLASS(channel)->play_recall;
+      }else{
+	entry->play_recall = (AgsDispatchPlayRecallFunc) ags_channel_play_recall;
+      }
+
+      entry->snapshot_slot = (is_play) ? &(channel->play_snapshot): &(channel->recall_snapshot);
+    }else{
+      g_warning("unknown audio dispatch tree element");
+    }
+
+    if(entry->tree_element != NULL &&
+       entry->play_recall != NULL){
+      g_object_ref(entry->tree_element);
+      
+      entry->recall_id = dispatch_audio->recall_id;
+      g_object_ref(entry->recall_id);
+
+      entry->staging_mask = (AGS_AUDIO_TREE_DISPATCHER_LIFECYCLE_STAGING_MASK |
+			     AGS_AUDIO_TREE_DISPATCHER_RUN_STAGING_MASK);
+      entry->active = TRUE;
+
+      program_count++;
+    }else{
+      memset(entry, 0, sizeof(AgsDispatchEntry));
+    }
+    
+    if(recycling_context != NULL){
+      g_object_unref(recycling_context);
+    }
+
+    if(parent_recycling_context != NULL){
+      g_object_unref(parent_recycling_context);
+    }
+    
+    tree_list = tree_list->next;
+  }
+
+  /* mask staging program */
+  staging_count = audio_tree_dispatcher->staging_program_count;
+
+  staging_flags = NULL;
+  staging_mask = NULL;
+  
+  if(staging_count > 0){
+    staging_flags = (guint *) g_malloc(staging_count * sizeof(guint));
+    staging_mask = (guint *) g_malloc(staging_count * sizeof(guint));
+
+    memcpy(staging_flags, audio_tree_dispatcher->staging_program, staging_count * sizeof(guint));
+    
+    for(i = 0; i < staging_count; i++){
+      staging_mask[i] = 0;
+      
+      for(j = 0; j < program_count; j++){
+	staging_mask[i] |= (staging_flags[i] & program[j].staging_mask);
+      }
     }
   }
+  
+  /* replace */
+  old_program = audio_tree_dispatcher->program;
+  old_program_count = audio_tree_dispatcher->program_count;
+  
+  g_free(audio_tree_dispatcher->program_staging_flags);
+  g_free(audio_tree_dispatcher->program_staging_mask);
+
+  audio_tree_dispatcher->program = program;
+  audio_tree_dispatcher->program_count = program_count;
+
+  audio_tree_dispatcher->program_staging_flags = staging_flags;
+  audio_tree_dispatcher->program_staging_mask = staging_mask;
+  audio_tree_dispatcher->program_staging_count = staging_count;
+
+  audio_tree_dispatcher->program_stamp = audio_tree_dispatcher->tree_list_stamp;
+  audio_tree_dispatcher->program_omit_event = omit_event;
+  
+  g_rec_mutex_unlock(audio_tree_dispatcher_mutex);
+
+  ags_audio_tree_dispatcher_free_program(old_program,
+					 old_program_count);
+}
+
+const gchar*
+ags_audio_tree_dispatcher_get_staging_name(guint staging_flags)
+{
+  static GFlagsClass *staging_flags_class = NULL;
+
+  GFlagsValue *flags_value;
+
+  /* the class of a static type is never finalized, so the nick is static */
+  if(g_once_init_enter(&staging_flags_class)){
+    g_once_init_leave(&staging_flags_class,
+		      g_type_class_ref(AGS_TYPE_SOUND_STAGING_FLAGS));
+  }
+
+  flags_value = g_flags_get_first_value(staging_flags_class,
+					staging_flags);
+
+  return((flags_value != NULL) ? flags_value->value_nick: "sound-staging");
+}
+
+/**
+ * ags_audio_tree_dispatcher_run:
+ * @audio_tree_dispatcher: the #AgsAudioTreeDispatcher
+ * 
+ * Run the dispatcher. The compiled program is rebuilt only if the tree list
+ * stamp changed, otherwise the flat program of the previous run is reused.
+ * 
+ * Since: 8.0.0
+ */
+void
+ags_audio_tree_dispatcher_run(AgsAudioTreeDispatcher *audio_tree_dispatcher)
+{
+  AgsDispatchEntry *program;
+
+  guint *staging_flags, *staging_mask;
+  
+  guint program_count;
+  guint staging_count;
+  guint i, j;
+  gboolean omit_event;
+  gboolean any_active;
+  
+  GRecMutex *audio_tree_dispatcher_mutex;
+
+  audio_tree_dispatcher_mutex = AGS_AUDIO_TREE_DISPATCHER_GET_OBJ_MUTEX(audio_tree_dispatcher);
+
+  omit_event = ags_recall_global_get_omit_event();
+  
+  /* compile program if outdated */
+  g_rec_mutex_lock(audio_tree_dispatcher_mutex);
+
+  if(audio_tree_dispatcher->program_stamp != audio_tree_dispatcher->tree_list_stamp ||
+     audio_tree_dispatcher->program_omit_event != omit_event){
+    ags_audio_tree_dispatcher_compile_program(audio_tree_dispatcher);
+  }
+
+  program = audio_tree_dispatcher->program;
+  program_count = audio_tree_dispatcher->program_count;
+
+  staging_flags = audio_tree_dispatcher->program_staging_flags;
+  staging_mask = audio_tree_dispatcher->program_staging_mask;
+  staging_count = audio_tree_dispatcher->program_staging_count;
+  
+  g_rec_mutex_unlock(audio_tree_dispatcher_mutex);
+
+  /* skip entries and stages without any interested recall - only if no event is emitted */
+  if(omit_event){
+    any_active = FALSE;
+  
+    for(j = 0; j < program_count; j++){
+      AgsRecallSnapshot *snapshot;
+
+      snapshot = ags_recall_snapshot_slot_acquire(program[j].snapshot_slot);
+
+      program[j].active = (snapshot != NULL && snapshot->length > 0) ? TRUE: FALSE;
+      program[j].staging_mask = AGS_AUDIO_TREE_DISPATCHER_LIFECYCLE_STAGING_MASK;
+
+      if(program[j].active){
+	/* computed as the snapshot was published */
+	program[j].staging_mask |= snapshot->staging_mask;
+	
+	any_active = TRUE;
+      }
+      
+      ags_recall_snapshot_slot_release(program[j].snapshot_slot,
+				       snapshot);
+    }
+
+    if(!any_active){
+      return;
+    }
 
-  g_free(staging_program);
+    for(i = 0; i < staging_count; i++){
+      staging_mask[i] = 0;
+      
+      for(j = 0; j < program_count; j++){
+	if(program[j].active){
+	  staging_mask[i] |= (staging_flags[i] & program[j].staging_mask);
+	}
+      }
+    }
+  }
   
-  g_list_free(start_tree_list);
+  for(i = 0; i < staging_count; i++){
+    const gchar *staging_name;
+    
+    if(staging_mask[i] == 0){
+      continue;
+    }
+
+    staging_name = NULL;
+    
+    if(AGS_TRACE_IS_ENABLED()){
+      staging_name = ags_audio_tree_dispatcher_get_staging_name(staging_flags[i]);
+      
+      ags_trace_begin("dispatcher", staging_name);
+    }
+    
+    for(j = 0; j < program_count; j++){
+      if(!program[j].active ||
+	 (staging_flags[i] & program[j].staging_mask) == 0){
+	continue;
+      }
+
+      program[j].play_recall(program[j].tree_element,
+			     program[j].recall_id, staging_flags[i]);
+    }
+
+    if(staging_name != NULL){
+      ags_trace_end("dispatcher", staging_name);
+    }
+  }
 }
 
 /**
@@ -25,6 +25,8 @@
 
 #include <ags/libags.h>
 
+#include <ags/audio/ags_recall_snapshot.h>
+
 G_BEGIN_DECLS
 
 #define AGS_TYPE_AUDIO_TREE_DISPATCHER                (ags_audio_tree_dispatcher_get_type())
@@ -35,12 +37,17 @@ G_BEGIN_DECLS
 #define AGS_AUDIO_TREE_DISPATCHER_GET_CLASS(obj)      (G_TYPE_INSTANCE_GET_CLASS((obj), AGS_TYPE_AUDIO_TREE_DISPATCHER, AgsAudioTreeDispatcherClass))
 
 #define AGS_DISPATCH_AUDIO(ptr) ((AgsDispatchAudio*)(ptr))
+#define AGS_DISPATCH_ENTRY(ptr) ((AgsDispatchEntry*)(ptr))
 
 #define AGS_AUDIO_TREE_DISPATCHER_GET_OBJ_MUTEX(obj) (&(((AgsAudioTreeDispatcher *) obj)->obj_mutex))
 
 typedef struct _AgsAudioTreeDispatcher AgsAudioTreeDispatcher;
 typedef struct _AgsAudioTreeDispatcherClass AgsAudioTreeDispatcherClass;
 typedef struct _AgsDispatchAudio AgsDispatchAudio;
+typedef struct _AgsDispatchEntry AgsDispatchEntry;
+
+typedef void (*AgsDispatchPlayRecallFunc)(GObject *tree_element,
+					  GObject *recall_id, guint staging_flags);
 
 struct _AgsAudioTreeDispatcher
 {
@@ -55,6 +62,16 @@ struct _AgsAudioTreeDispatcher
   
   GList *tree_list;
   gint64 tree_list_stamp;
+
+  AgsDispatchEntry *program;
+  guint program_count;
+
+  guint *program_staging_flags;
+  guint *program_staging_mask;
+  guint program_staging_count;
+
+  gint64 program_stamp;
+  gboolean program_omit_event;
 };
 
 struct _AgsAudioTreeDispatcherClass
@@ -80,6 +97,31 @@ struct _AgsDispatchAudio
   GObject *recycling_context;
 };
 
+/**
+ * AgsDispatchEntry:
+ * @play_recall: the resolved play recall function
+ * @tree_element: the #AgsAudio, #AgsOutput or #AgsInput
+ * @recall_id: the #AgsRecallID
+ * @snapshot_slot: the #AgsRecallSnapshotSlot-struct of the context used by @recall_id
+ * @staging_mask: the staging flags handled by the recalls of @snapshot_slot, updated per run
+ * @active: %TRUE if @snapshot_slot contains any recall during the current run
+ *
+ * Pre-resolved entry of the program compiled of the tree list.
+ */
+struct _AgsDispatchEntry
+{
+  AgsDispatchPlayRecallFunc play_recall;
+
+  GObject *tree_element;
+  GObject *recall_id;
+
+  AgsRecallSnapshotSlot *snapshot_slot;
+
+  guint staging_mask;
+
+  gboolean active;
+};
+
 GType ags_audio_tree_dispatcher_get_type(void);
 
 /* tree list */
@@ -109,6 +151,9 @@ gint64 ags_audio_tree_dispatcher_get_tree_list_stamp(AgsAudioTreeDispatcher *aud
 void ags_audio_tree_dispatcher_set_tree_list_stamp(AgsAudioTreeDispatcher *audio_tree_dispatcher,
 						   gint64 tree_list_stamp);
 
+/* program */
+void ags_audio_tree_dispatcher_compile_program(AgsAudioTreeDispatcher *audio_tree_dispatcher);
+
 /* run */
 void ags_audio_tree_dispatcher_run(AgsAudioTreeDispatcher *audio_tree_dispatcher);
 
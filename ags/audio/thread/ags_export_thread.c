@@ -19,6 +19,8 @@
 
 #include <ags/audio/thread/ags_export_thread.h>
 
+#include <ags/audio/ags_offline_devout.h>
+
 #include <ags/audio/alsa/ags_alsa_devout.h>
 
 #include <ags/audio/oss/ags_oss_devout.h>
@@ -484,7 +486,8 @@ ags_export_thread_run(AgsThread *thread)
   
   if(AGS_IS_ALSA_DEVOUT(soundcard) ||
      AGS_IS_OSS_DEVOUT(soundcard) ||
-     AGS_IS_WASAPI_DEVOUT(soundcard)){
+     AGS_IS_WASAPI_DEVOUT(soundcard) ||
+     AGS_IS_OFFLINE_DEVOUT(soundcard)){
     soundcard_buffer = ags_soundcard_get_buffer(soundcard);
   }else if(AGS_IS_JACK_DEVOUT(soundcard) ||
 	   AGS_IS_PULSE_DEVOUT(soundcard)){
@@ -528,6 +531,12 @@ ags_export_thread_stop(AgsThread *thread)
   export_thread->tic = 0;
   export_thread->counter = 0;
 
+  /* pace offline soundcard to wall clock again */
+  if(AGS_IS_OFFLINE_DEVOUT(export_thread->soundcard)){
+    ags_offline_devout_unset_flags((AgsOfflineDevout *) export_thread->soundcard,
+				   AGS_OFFLINE_DEVOUT_FREE_RUN);
+  }
+
   ags_export_thread_unset_flags(export_thread,
 				AGS_EXPORT_THREAD_IS_EXPORTING);
 }
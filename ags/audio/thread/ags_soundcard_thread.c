@@ -19,6 +19,8 @@
 
 #include <ags/audio/thread/ags_soundcard_thread.h>
 
+#include <ags/audio/ags_offline_devout.h>
+
 #include <ags/audio/alsa/ags_alsa_devout.h>
 #include <ags/audio/alsa/ags_alsa_devin.h>
 
@@ -283,6 +285,8 @@ ags_soundcard_thread_set_property(GObject *gobject,
 	  ags_thread_set_flags((AgsThread *) soundcard_thread, AGS_THREAD_INTERMEDIATE_POST_SYNC);
 	}else if(AGS_IS_CORE_AUDIO_DEVOUT(soundcard)){
 	  ags_thread_set_flags((AgsThread *) soundcard_thread, AGS_THREAD_INTERMEDIATE_POST_SYNC);
+	}else if(AGS_IS_OFFLINE_DEVOUT(soundcard)){
+	  ags_thread_set_flags((AgsThread *) soundcard_thread, AGS_THREAD_INTERMEDIATE_POST_SYNC);
 	}
 
 	/* capture */
@@ -489,10 +493,18 @@ ags_soundcard_thread_run(AgsThread *thread)
     is_playing = ags_soundcard_is_playing(AGS_SOUNDCARD(soundcard));
   
     if(is_playing){
+      if(AGS_TRACE_IS_ENABLED()){
+	ags_trace_begin("soundcard", "play");
+      }
+      
       error = NULL;
       ags_soundcard_play(AGS_SOUNDCARD(soundcard),
 			 &error);
 
+      if(AGS_TRACE_IS_ENABLED()){
+	ags_trace_end("soundcard", "play");
+      }
+
       if(error != NULL){
 	//TODO:JK: implement me
 
@@ -21,6 +21,7 @@
 
 #include <ags/audio/ags_input.h>
 #include <ags/audio/ags_wave.h>
+#include <ags/audio/ags_wave_stream.h>
 
 #include <ags/audio/file/ags_sound_resource.h>
 
@@ -56,6 +57,8 @@ enum{
   PROP_AUDIO,
   PROP_FILENAME,
   PROP_AUDIO_FILE,
+  PROP_X_OFFSET,
+  PROP_STREAM_THRESHOLD,
 };
 
 static gpointer ags_wave_loader_parent_class = NULL;
@@ -157,6 +160,42 @@ ags_wave_loader_class_init(AgsWaveLoaderClass *wave_loader)
   g_object_class_install_property(gobject,
 				  PROP_AUDIO_FILE,
 				  param_spec);
+
+  /**
+   * AgsWaveLoader:x-offset:
+   *
+   * The frame offset the loaded audio data starts at.
+   * 
+   * Since: 9.1.0
+   */
+  param_spec = g_param_spec_uint64("x-offset",
+				   i18n_pspec("x offset"),
+				   i18n_pspec("The x offset"),
+				   0,
+				   G_MAXUINT64,
+				   0,
+				   G_PARAM_READABLE | G_PARAM_WRITABLE);
+  g_object_class_install_property(gobject,
+				  PROP_X_OFFSET,
+				  param_spec);
+
+  /**
+   * AgsWaveLoader:stream-threshold:
+   *
+   * The frame count from which on the file is streamed from disk, 0 to disable.
+   * 
+   * Since: 9.1.0
+   */
+  param_spec = g_param_spec_uint64("stream-threshold",
+				   i18n_pspec("stream threshold"),
+				   i18n_pspec("The stream threshold"),
+				   0,
+				   G_MAXUINT64,
+				   0,
+				   G_PARAM_READABLE | G_PARAM_WRITABLE);
+  g_object_class_install_property(gobject,
+				  PROP_STREAM_THRESHOLD,
+				  param_spec);
 }
 
 void
@@ -176,6 +215,10 @@ ags_wave_loader_init(AgsWaveLoader *wave_loader)
   wave_loader->filename = NULL;
 
   wave_loader->audio_file = NULL;
+
+  wave_loader->x_offset = 0;
+
+  wave_loader->stream_threshold = 0;
 }
 
 void
@@ -271,6 +314,24 @@ ags_wave_loader_set_property(GObject *gobject,
     g_rec_mutex_unlock(wave_loader_mutex);
   }
   break;
+  case PROP_X_OFFSET:
+  {
+    g_rec_mutex_lock(wave_loader_mutex);
+
+    wave_loader->x_offset = g_value_get_uint64(value);
+      
+    g_rec_mutex_unlock(wave_loader_mutex);
+  }
+  break;
+  case PROP_STREAM_THRESHOLD:
+  {
+    g_rec_mutex_lock(wave_loader_mutex);
+
+    wave_loader->stream_threshold = g_value_get_uint64(value);
+      
+    g_rec_mutex_unlock(wave_loader_mutex);
+  }
+  break;
   default:
     G_OBJECT_WARN_INVALID_PROPERTY_ID(gobject, prop_id, param_spec);
     break;
@@ -320,6 +381,24 @@ ags_wave_loader_get_property(GObject *gobject,
     g_rec_mutex_unlock(wave_loader_mutex);
   }
   break;
+  case PROP_X_OFFSET:
+  {
+    g_rec_mutex_lock(wave_loader_mutex);
+      
+    g_value_set_uint64(value, wave_loader->x_offset);
+
+    g_rec_mutex_unlock(wave_loader_mutex);
+  }
+  break;
+  case PROP_STREAM_THRESHOLD:
+  {
+    g_rec_mutex_lock(wave_loader_mutex);
+      
+    g_value_set_uint64(value, wave_loader->stream_threshold);
+
+    g_rec_mutex_unlock(wave_loader_mutex);
+  }
+  break;
   default:
     G_OBJECT_WARN_INVALID_PROPERTY_ID(gobject, prop_id, param_spec);
     break;
@@ -475,17 +554,41 @@ ags_wave_loader_run(void *ptr)
 
   guint n_pads, current_pads;
   guint n_audio_channels, current_audio_channels;
+  guint samplerate, current_samplerate;
+  guint buffer_size;
+  AgsSoundcardFormat format;
+  guint64 x_offset;
+  guint64 stream_threshold;
+  guint frame_count;
+  gboolean do_stream;
 
   wave_loader = AGS_WAVE_LOADER(ptr);
 
   g_object_get(wave_loader->audio,
 	       "output-soundcard", &output_soundcard,
 	       NULL);
+
+  x_offset = ags_wave_loader_get_x_offset(wave_loader);
+  stream_threshold = ags_wave_loader_get_stream_threshold(wave_loader);
   
   wave_loader->audio_file = ags_audio_file_new(wave_loader->filename,
 					       output_soundcard,
 					       -1);
   ags_audio_file_open(wave_loader->audio_file);
+
+  /* stream long files instead of reading them into memory */
+  if(stream_threshold > 0){
+    frame_count = 0;
+    
+    ags_sound_resource_info(AGS_SOUND_RESOURCE(wave_loader->audio_file->sound_resource),
+			    &frame_count,
+			    NULL, NULL);
+
+    if((guint64) frame_count >= stream_threshold){
+      ags_wave_loader_set_flags(wave_loader,
+				AGS_WAVE_LOADER_STREAM);
+    }
+  }
   
   if(ags_wave_loader_test_flags(wave_loader, AGS_WAVE_LOADER_DO_REPLACE)){
     g_object_get(wave_loader->audio,
@@ -501,6 +604,21 @@ ags_wave_loader_run(void *ptr)
       wave = wave->next;
     }
 
+    g_list_free_full(start_wave,
+		     g_object_unref);
+
+    /* wave stream */
+    start_wave = ags_audio_get_wave_stream(wave_loader->audio);
+
+    wave = start_wave;
+
+    while(wave != NULL){
+      ags_audio_remove_wave_stream(wave_loader->audio,
+				   wave->data);
+    
+      wave = wave->next;
+    }
+
     g_list_free_full(start_wave,
 		     g_object_unref);
 
@@ -515,19 +633,35 @@ ags_wave_loader_run(void *ptr)
 	       "audio-channels", &n_audio_channels,
 	       NULL);
 
+  current_samplerate = AGS_SOUNDCARD_DEFAULT_SAMPLERATE;
+  
   ags_sound_resource_get_presets(AGS_SOUND_RESOURCE(wave_loader->audio_file->sound_resource),
 				 &current_audio_channels,
-				 NULL,
+				 &current_samplerate,
 				 NULL,
 				 NULL);
+
+  samplerate = AGS_SOUNDCARD_DEFAULT_SAMPLERATE;
+  buffer_size = AGS_SOUNDCARD_DEFAULT_BUFFER_SIZE;
+  format = AGS_SOUNDCARD_DEFAULT_FORMAT;
+
+  if(output_soundcard != NULL){
+    ags_soundcard_get_presets(AGS_SOUNDCARD(output_soundcard),
+			      NULL,
+			      &samplerate,
+			      &buffer_size,
+			      &format);
+  }
+  
+  /* stream from disk if requested - not resampled, so the samplerate must match */
+  do_stream = (ags_wave_loader_test_flags(wave_loader, AGS_WAVE_LOADER_STREAM) &&
+	       current_samplerate == samplerate) ? TRUE: FALSE;
   
   if(current_audio_channels > n_audio_channels){
     n_audio_channels = current_audio_channels;
   }
   
   if(n_audio_channels > 0){
-    GList *start_wave, *wave;
-
     /* resize */
     ags_audio_set_audio_channels(wave_loader->audio,
 				 n_audio_channels, 0);
@@ -537,12 +671,37 @@ ags_wave_loader_run(void *ptr)
 			 AGS_TYPE_INPUT,
 			 1, 0);
     }
-    
+
+    if(do_stream){
+      AgsWaveStream *wave_stream;
+
+      wave_stream = ags_wave_stream_new(wave_loader->audio_file->sound_resource,
+					samplerate,
+					buffer_size,
+					format,
+					AGS_WAVE_STREAM_DEFAULT_READ_AHEAD);
+
+      ags_wave_stream_set_x_offset(wave_stream,
+				   x_offset);
+      
+      ags_audio_add_wave_stream(wave_loader->audio,
+				(GObject *) wave_stream);
+
+      ags_wave_stream_start(wave_stream);
+
+      g_object_unref(wave_stream);
+    }
+  }
+  
+  if(n_audio_channels > 0 &&
+     !do_stream){
+    GList *start_wave, *wave;
+
     wave =
       start_wave = ags_sound_resource_read_wave(AGS_SOUND_RESOURCE(wave_loader->audio_file->sound_resource),
 						output_soundcard,
 						-1,
-						0,
+						x_offset,
 						0.0, 0);
 
     if(ags_wave_loader_test_flags(wave_loader, AGS_WAVE_LOADER_DO_REPLACE)){
@@ -725,6 +884,103 @@ ags_wave_loader_set_audio_file(AgsWaveLoader *wave_loader,
 	       NULL);
 }
 
+/**
+ * ags_wave_loader_get_x_offset:
+ * @wave_loader: the #AgsWaveLoader
+ * 
+ * Get x offset of @wave_loader.
+ * 
+ * Returns: the frame offset
+ * 
+ * Since: 9.1.0
+ */
+guint64
+ags_wave_loader_get_x_offset(AgsWaveLoader *wave_loader)
+{
+  guint64 x_offset;
+  
+  if(!AGS_IS_WAVE_LOADER(wave_loader)){
+    return(0);
+  }
+
+  g_object_get(wave_loader,
+	       "x-offset", &x_offset,
+	       NULL);
+
+  return(x_offset);
+}
+
+/**
+ * ags_wave_loader_set_x_offset:
+ * @wave_loader: the #AgsWaveLoader
+ * @x_offset: the frame offset
+ * 
+ * Set x offset of @wave_loader, the read #AgsWave or #AgsWaveStream start at @x_offset.
+ * 
+ * Since: 9.1.0
+ */
+void
+ags_wave_loader_set_x_offset(AgsWaveLoader *wave_loader,
+			     guint64 x_offset)
+{
+  if(!AGS_IS_WAVE_LOADER(wave_loader)){
+    return;
+  }
+
+  g_object_set(wave_loader,
+	       "x-offset", x_offset,
+	       NULL);
+}
+
+/**
+ * ags_wave_loader_get_stream_threshold:
+ * @wave_loader: the #AgsWaveLoader
+ * 
+ * Get stream threshold of @wave_loader.
+ * 
+ * Returns: the frame count from which on the file is streamed, 0 if disabled
+ * 
+ * Since: 9.1.0
+ */
+guint64
+ags_wave_loader_get_stream_threshold(AgsWaveLoader *wave_loader)
+{
+  guint64 stream_threshold;
+  
+  if(!AGS_IS_WAVE_LOADER(wave_loader)){
+    return(0);
+  }
+
+  g_object_get(wave_loader,
+	       "stream-threshold", &stream_threshold,
+	       NULL);
+
+  return(stream_threshold);
+}
+
+/**
+ * ags_wave_loader_set_stream_threshold:
+ * @wave_loader: the #AgsWaveLoader
+ * @stream_threshold: the frame count
+ * 
+ * Set stream threshold of @wave_loader, files of at least @stream_threshold frames
+ * are loaded as if #AGS_WAVE_LOADER_STREAM was set. Pass 0 to disable.
+ * 
+ * Since: 9.1.0
+ */
+void
+ags_wave_loader_set_stream_threshold(AgsWaveLoader *wave_loader,
+				     guint64 stream_threshold)
+{
+  if(!AGS_IS_WAVE_LOADER(wave_loader)){
+    return;
+  }
+
+  g_object_set(wave_loader,
+	       "stream-threshold", stream_threshold,
+	       NULL);
+}
+
 /**
  * ags_wave_loader_start:
  * @wave_loader: the #AgsWaveLoader
@@ -43,9 +43,20 @@ G_BEGIN_DECLS
 typedef struct _AgsWaveLoader AgsWaveLoader;
 typedef struct _AgsWaveLoaderClass AgsWaveLoaderClass;
 
+/**
+ * AgsWaveLoaderFlags:
+ * @AGS_WAVE_LOADER_DO_REPLACE: replace the waves of the audio
+ * @AGS_WAVE_LOADER_HAS_COMPLETED: the loader has completed
+ * @AGS_WAVE_LOADER_STREAM: stream from disk by #AgsWaveStream instead of reading #AgsWave, no wave is
+ * added to the audio, so the caller has to persist the filename
+ *
+ * Enum values to control the behavior or indicate internal state of #AgsWaveLoader by
+ * enable/disable as flags.
+ */
 typedef enum{
   AGS_WAVE_LOADER_DO_REPLACE      = 1,
   AGS_WAVE_LOADER_HAS_COMPLETED   = 1 <<  1,
+  AGS_WAVE_LOADER_STREAM          = 1 <<  2,
 }AgsWaveLoaderFlags;
 
 struct _AgsWaveLoader
@@ -64,6 +75,10 @@ struct _AgsWaveLoader
   gchar *filename;
   
   AgsAudioFile *audio_file;
+
+  guint64 x_offset;
+
+  guint64 stream_threshold;
 };
 
 struct _AgsWaveLoaderClass
@@ -91,6 +106,14 @@ AgsAudioFile* ags_wave_loader_get_audio_file(AgsWaveLoader *wave_loader);
 void ags_wave_loader_set_audio_file(AgsWaveLoader *wave_loader,
 				    AgsAudioFile *audio_file);
 
+guint64 ags_wave_loader_get_x_offset(AgsWaveLoader *wave_loader);
+void ags_wave_loader_set_x_offset(AgsWaveLoader *wave_loader,
+				  guint64 x_offset);
+
+guint64 ags_wave_loader_get_stream_threshold(AgsWaveLoader *wave_loader);
+void ags_wave_loader_set_stream_threshold(AgsWaveLoader *wave_loader,
+					  guint64 stream_threshold);
+
 /* thread */
 void ags_wave_loader_start(AgsWaveLoader *wave_loader);
 
@@ -71,8 +71,11 @@
 #include <ags/audio/ags_audio.h>
 #include <ags/audio/ags_audio_application_context.h>
 #include <ags/audio/ags_audio_buffer_util.h>
+#include <ags/audio/ags_audio_buffer_kernel.h>
 #include <ags/audio/ags_audio_signal.h>
+#include <ags/audio/ags_audio_signal_pool.h>
 #include <ags/audio/ags_automation.h>
+#include <ags/audio/ags_automation_cursor.h>
 #include <ags/audio/ags_automation_control_name_key_manager.h>
 #include <ags/audio/ags_buffer.h>
 #include <ags/audio/ags_channel.h>
@@ -101,7 +104,9 @@
 #include <ags/audio/ags_midi.h>
 #include <ags/audio/ags_notation.h>
 #include <ags/audio/ags_note.h>
+#include <ags/audio/ags_note_index.h>
 #include <ags/audio/ags_noise_util.h>
+#include <ags/audio/ags_offline_devout.h>
 #include <ags/audio/ags_output.h>
 #include <ags/audio/ags_pattern.h>
 #include <ags/audio/ags_peak_util.h>
@@ -114,6 +119,11 @@
 #include <ags/audio/ags_port.h>
 #include <ags/audio/ags_preset.h>
 #include <ags/audio/ags_program.h>
+#include <ags/audio/ags_tempo_map.h>
+#include <ags/audio/ags_timestamp_index.h>
+#include <ags/audio/ags_wave_storage.h>
+#include <ags/audio/ags_wave_stream.h>
+#include <ags/audio/ags_wave_peak.h>
 #include <ags/audio/ags_fx_factory.h>
 #include <ags/audio/ags_recall_audio.h>
 #include <ags/audio/ags_recall_audio_run.h>
@@ -127,6 +137,8 @@
 #include <ags/audio/ags_recall_id.h>
 #include <ags/audio/ags_generic_recall_recycling.h>
 #include <ags/audio/ags_recall_recycling.h>
+#include <ags/audio/ags_recall_snapshot.h>
+#include <ags/audio/ags_recall_profiler.h>
 #include <ags/audio/ags_recycling_context.h>
 #include <ags/audio/ags_recycling.h>
 #include <ags/audio/ags_resample_util.h>
@@ -147,6 +159,7 @@
 #include <ags/audio/ags_track.h>
 #include <ags/audio/ags_tremolo_util.h>
 #include <ags/audio/ags_vector_256_manager.h>
+#include <ags/audio/ags_scratch_arena.h>
 #include <ags/audio/ags_volume_util.h>
 #include <ags/audio/ags_wah_wah_util.h>
 #include <ags/audio/ags_wave.h>
@@ -82,12 +82,14 @@
 #include <ags/thread/ags_atomic.h>
 #include <ags/thread/ags_concurrency_provider.h>
 #include <ags/thread/ags_destroy_worker.h>
+#include <ags/thread/ags_epoch_reclaimer.h>
 #include <ags/thread/ags_frame_clock.h>
 #include <ags/thread/ags_generic_main_loop.h>
 #include <ags/thread/ags_message_delivery.h>
 #include <ags/thread/ags_message_envelope.h>
 #include <ags/thread/ags_message_queue.h>
 #include <ags/thread/ags_returnable_thread.h>
+#include <ags/thread/ags_ring_buffer.h>
 #include <ags/thread/ags_task_completion.h>
 #include <ags/thread/ags_task.h>
 #include <ags/thread/ags_task_launcher.h>
@@ -95,6 +97,9 @@
 #include <ags/thread/ags_thread_pool.h>
 #include <ags/thread/ags_thread.h>
 #include <ags/thread/ags_timestamp.h>
+#include <ags/thread/ags_trace.h>
+#include <ags/thread/ags_tic_barrier.h>
+#include <ags/thread/ags_work_stealing_scheduler.h>
 #include <ags/thread/ags_worker_thread.h>
 
 /* server */
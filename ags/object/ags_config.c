@@ -431,6 +431,7 @@ ags_config_real_load_defaults(AgsConfig *config)
 
   ags_config_set_value(config, AGS_CONFIG_THREAD, "model", "super-threaded");
   ags_config_set_value(config, AGS_CONFIG_THREAD, "super-threaded-scope", "audio");
+  ags_config_set_value(config, AGS_CONFIG_THREAD, "work-stealing-workers", "0");
   ags_config_set_value(config, AGS_CONFIG_THREAD, "lock-global", "ags-thread");
   ags_config_set_value(config, AGS_CONFIG_THREAD, "lock-parent", "ags-recycling-thread");
   ags_config_set_value(config, AGS_CONFIG_THREAD, "max-precision", "250");
@@ -593,6 +594,8 @@ ags_config_real_load_defaults(AgsConfig *config)
   //ags_config_set_value(config, AGS_CONFIG_SEQUENCER_0, "device", "ags-jack-midiin-0");
 
   ags_config_set_value(config, AGS_CONFIG_RECALL, "auto-sense", "true");
+  ags_config_set_value(config, AGS_CONFIG_RECALL, "max-polyphony", "32");
+  ags_config_set_value(config, AGS_CONFIG_RECALL, "voice-steal-policy", "oldest");
 
   g_rec_mutex_unlock(config_mutex);
 }
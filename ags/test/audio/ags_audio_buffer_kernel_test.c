@@ -0,0 +1,427 @@
+/* GSequencer - Advanced GTK Sequencer
+ * Copyright (C) 2005-2026 Joël Krähemann
+ *
+ * This file is part of GSequencer.
+ *
+ * GSequencer is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GSequencer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GSequencer.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <glib.h>
+#include <glib-object.h>
+
+#include <ags/libags.h>
+#include <ags/libags-audio.h>
+
+#include <CUnit/CUnit.h>
+#include <CUnit/Automated.h>
+#include <CUnit/Basic.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+int ags_audio_buffer_kernel_test_init_suite();
+int ags_audio_buffer_kernel_test_clean_suite();
+
+void ags_audio_buffer_kernel_test_get();
+void ags_audio_buffer_kernel_test_clear();
+void ags_audio_buffer_kernel_test_copy_float_to_float();
+void ags_audio_buffer_kernel_test_copy_float_to_double();
+void ags_audio_buffer_kernel_test_copy_double_to_float();
+void ags_audio_buffer_kernel_test_copy_double_to_double();
+void ags_audio_buffer_kernel_test_audio_buffer_util();
+
+void ags_audio_buffer_kernel_test_fill_float(gfloat *buffer, guint count, gdouble scale);
+void ags_audio_buffer_kernel_test_fill_double(gdouble *buffer, guint count, gdouble scale);
+
+#define AGS_AUDIO_BUFFER_KERNEL_TEST_MAX_COUNT (259)
+
+/* The suite initialization function.
+ * Opens the temporary file used by the tests.
+ * Returns zero on success, non-zero otherwise.
+ */
+int
+ags_audio_buffer_kernel_test_init_suite()
+{
+  srand(1234);
+  
+  return(0);
+}
+
+/* The suite cleanup function.
+ * Closes the temporary file used by the tests.
+ * Returns zero on success, non-zero otherwise.
+ */
+int
+ags_audio_buffer_kernel_test_clean_suite()
+{
+  return(0);
+}
+
+void
+ags_audio_buffer_kernel_test_fill_float(gfloat *buffer, guint count, gdouble scale)
+{
+  guint i;
+
+  for(i = 0; i < count; i++){
+    buffer[i] = (gfloat) (scale * (((gdouble) rand() / (gdouble) RAND_MAX) - 0.5));
+  }
+}
+
+void
+ags_audio_buffer_kernel_test_fill_double(gdouble *buffer, guint count, gdouble scale)
+{
+  guint i;
+
+  for(i = 0; i < count; i++){
+    buffer[i] = scale * (((gdouble) rand() / (gdouble) RAND_MAX) - 0.5);
+  }
+}
+
+void
+ags_audio_buffer_kernel_test_get()
+{
+  AgsAudioBufferKernel *kernel;
+
+  guint i;
+  gboolean success;
+
+  CU_ASSERT(ags_audio_buffer_kernel_isa_is_supported(AGS_AUDIO_BUFFER_KERNEL_SCALAR) == TRUE);
+
+  success = TRUE;
+  
+  for(i = 0; i < AGS_AUDIO_BUFFER_KERNEL_ISA_COUNT; i++){
+    kernel = ags_audio_buffer_kernel_get(i);
+
+    if(ags_audio_buffer_kernel_isa_is_supported(i)){
+      if(kernel == NULL ||
+	 kernel->isa != i ||
+	 kernel->name == NULL ||
+	 kernel->clear_float == NULL ||
+	 kernel->copy_double_to_double == NULL){
+	success = FALSE;
+
+	break;
+      }
+    }else{
+      if(kernel != NULL){
+	success = FALSE;
+
+	break;
+      }
+    }
+  }
+
+  CU_ASSERT(success);
+
+  kernel = ags_audio_buffer_kernel_get_default();
+
+  CU_ASSERT(kernel != NULL);
+  CU_ASSERT(ags_audio_buffer_kernel_isa_is_supported(kernel->isa) == TRUE);
+  CU_ASSERT(ags_audio_buffer_kernel_get_default() == kernel);
+}
+
+void
+ags_audio_buffer_kernel_test_clear()
+{
+  AgsAudioBufferKernel *scalar, *kernel;
+
+  gfloat float_buffer[2][AGS_AUDIO_BUFFER_KERNEL_TEST_MAX_COUNT];
+  gdouble double_buffer[2][AGS_AUDIO_BUFFER_KERNEL_TEST_MAX_COUNT];
+
+  guint isa;
+  guint count;
+  gboolean success;
+
+  scalar = ags_audio_buffer_kernel_get(AGS_AUDIO_BUFFER_KERNEL_SCALAR);
+
+  success = TRUE;
+  
+  for(isa = 1; isa < AGS_AUDIO_BUFFER_KERNEL_ISA_COUNT && success; isa++){
+    if((kernel = ags_audio_buffer_kernel_get(isa)) == NULL){
+      continue;
+    }
+    
+    for(count = 0; count < AGS_AUDIO_BUFFER_KERNEL_TEST_MAX_COUNT; count++){
+      ags_audio_buffer_kernel_test_fill_float(float_buffer[0], AGS_AUDIO_BUFFER_KERNEL_TEST_MAX_COUNT, 2.0);
+      memcpy(float_buffer[1], float_buffer[0], AGS_AUDIO_BUFFER_KERNEL_TEST_MAX_COUNT * sizeof(gfloat));
+
+      ags_audio_buffer_kernel_test_fill_double(double_buffer[0], AGS_AUDIO_BUFFER_KERNEL_TEST_MAX_COUNT, 2.0);
+      memcpy(double_buffer[1], double_buffer[0], AGS_AUDIO_BUFFER_KERNEL_TEST_MAX_COUNT * sizeof(gdouble));
+
+      scalar->clear_float(float_buffer[0], count);
+      kernel->clear_float(float_buffer[1], count);
+
+      scalar->clear_double(double_buffer[0], count);
+      kernel->clear_double(double_buffer[1], count);
+
+      if(memcmp(float_buffer[0], float_buffer[1], AGS_AUDIO_BUFFER_KERNEL_TEST_MAX_COUNT * sizeof(gfloat)) != 0 ||
+	 memcmp(double_buffer[0], double_buffer[1], AGS_AUDIO_BUFFER_KERNEL_TEST_MAX_COUNT * sizeof(gdouble)) != 0){
+	success = FALSE;
+
+	break;
+      }
+    }
+  }
+
+  CU_ASSERT(success);
+}
+
+void
+ags_audio_buffer_kernel_test_copy_float_to_float()
+{
+  AgsAudioBufferKernel *scalar, *kernel;
+
+  gfloat destination[2][AGS_AUDIO_BUFFER_KERNEL_TEST_MAX_COUNT];
+  gfloat source[AGS_AUDIO_BUFFER_KERNEL_TEST_MAX_COUNT];
+
+  guint isa;
+  guint count;
+  gboolean success;
+
+  scalar = ags_audio_buffer_kernel_get(AGS_AUDIO_BUFFER_KERNEL_SCALAR);
+
+  success = TRUE;
+  
+  for(isa = 1; isa < AGS_AUDIO_BUFFER_KERNEL_ISA_COUNT && success; isa++){
+    if((kernel = ags_audio_buffer_kernel_get(isa)) == NULL){
+      continue;
+    }
+    
+    for(count = 0; count < AGS_AUDIO_BUFFER_KERNEL_TEST_MAX_COUNT; count++){
+      ags_audio_buffer_kernel_test_fill_float(destination[0], AGS_AUDIO_BUFFER_KERNEL_TEST_MAX_COUNT, 2.0);
+      memcpy(destination[1], destination[0], AGS_AUDIO_BUFFER_KERNEL_TEST_MAX_COUNT * sizeof(gfloat));
+
+      ags_audio_buffer_kernel_test_fill_float(source, AGS_AUDIO_BUFFER_KERNEL_TEST_MAX_COUNT, 0.001);
+
+      scalar->copy_float_to_float(destination[0], source, count);
+      kernel->copy_float_to_float(destination[1], source, count);
+
+      if(memcmp(destination[0], destination[1], AGS_AUDIO_BUFFER_KERNEL_TEST_MAX_COUNT * sizeof(gfloat)) != 0){
+	success = FALSE;
+
+	break;
+      }
+    }
+  }
+
+  CU_ASSERT(success);
+}
+
+void
+ags_audio_buffer_kernel_test_copy_float_to_double()
+{
+  AgsAudioBufferKernel *scalar, *kernel;
+
+  gdouble destination[2][AGS_AUDIO_BUFFER_KERNEL_TEST_MAX_COUNT];
+  gfloat source[AGS_AUDIO_BUFFER_KERNEL_TEST_MAX_COUNT];
+
+  guint isa;
+  guint count;
+  gboolean success;
+
+  scalar = ags_audio_buffer_kernel_get(AGS_AUDIO_BUFFER_KERNEL_SCALAR);
+
+  success = TRUE;
+  
+  for(isa = 1; isa < AGS_AUDIO_BUFFER_KERNEL_ISA_COUNT && success; isa++){
+    if((kernel = ags_audio_buffer_kernel_get(isa)) == NULL){
+      continue;
+    }
+    
+    for(count = 0; count < AGS_AUDIO_BUFFER_KERNEL_TEST_MAX_COUNT; count++){
+      ags_audio_buffer_kernel_test_fill_double(destination[0], AGS_AUDIO_BUFFER_KERNEL_TEST_MAX_COUNT, 2.0);
+      memcpy(destination[1], destination[0], AGS_AUDIO_BUFFER_KERNEL_TEST_MAX_COUNT * sizeof(gdouble));
+
+      ags_audio_buffer_kernel_test_fill_float(source, AGS_AUDIO_BUFFER_KERNEL_TEST_MAX_COUNT, 0.001);
+
+      scalar->copy_float_to_double(destination[0], source, count);
+      kernel->copy_float_to_double(destination[1], source, count);
+
+      if(memcmp(destination[0], destination[1], AGS_AUDIO_BUFFER_KERNEL_TEST_MAX_COUNT * sizeof(gdouble)) != 0){
+	success = FALSE;
+
+	break;
+      }
+    }
+  }
+
+  CU_ASSERT(success);
+}
+
+void
+ags_audio_buffer_kernel_test_copy_double_to_float()
+{
+  AgsAudioBufferKernel *scalar, *kernel;
+
+  gfloat destination[2][AGS_AUDIO_BUFFER_KERNEL_TEST_MAX_COUNT];
+  gdouble source[AGS_AUDIO_BUFFER_KERNEL_TEST_MAX_COUNT];
+
+  guint isa;
+  guint count;
+  gboolean success;
+
+  scalar = ags_audio_buffer_kernel_get(AGS_AUDIO_BUFFER_KERNEL_SCALAR);
+
+  success = TRUE;
+  
+  for(isa = 1; isa < AGS_AUDIO_BUFFER_KERNEL_ISA_COUNT && success; isa++){
+    if((kernel = ags_audio_buffer_kernel_get(isa)) == NULL){
+      continue;
+    }
+    
+    for(count = 0; count < AGS_AUDIO_BUFFER_KERNEL_TEST_MAX_COUNT; count++){
+      ags_audio_buffer_kernel_test_fill_float(destination[0], AGS_AUDIO_BUFFER_KERNEL_TEST_MAX_COUNT, 2.0);
+      memcpy(destination[1], destination[0], AGS_AUDIO_BUFFER_KERNEL_TEST_MAX_COUNT * sizeof(gfloat));
+
+      ags_audio_buffer_kernel_test_fill_double(source, AGS_AUDIO_BUFFER_KERNEL_TEST_MAX_COUNT, 0.0000001);
+
+      scalar->copy_double_to_float(destination[0], source, count);
+      kernel->copy_double_to_float(destination[1], source, count);
+
+      if(memcmp(destination[0], destination[1], AGS_AUDIO_BUFFER_KERNEL_TEST_MAX_COUNT * sizeof(gfloat)) != 0){
+	success = FALSE;
+
+	break;
+      }
+    }
+  }
+
+  CU_ASSERT(success);
+}
+
+void
+ags_audio_buffer_kernel_test_copy_double_to_double()
+{
+  AgsAudioBufferKernel *scalar, *kernel;
+
+  gdouble destination[2][AGS_AUDIO_BUFFER_KERNEL_TEST_MAX_COUNT];
+  gdouble source[AGS_AUDIO_BUFFER_KERNEL_TEST_MAX_COUNT];
+
+  guint isa;
+  guint count;
+  gboolean success;
+
+  scalar = ags_audio_buffer_kernel_get(AGS_AUDIO_BUFFER_KERNEL_SCALAR);
+
+  success = TRUE;
+  
+  for(isa = 1; isa < AGS_AUDIO_BUFFER_KERNEL_ISA_COUNT && success; isa++){
+    if((kernel = ags_audio_buffer_kernel_get(isa)) == NULL){
+      continue;
+    }
+    
+    for(count = 0; count < AGS_AUDIO_BUFFER_KERNEL_TEST_MAX_COUNT; count++){
+      ags_audio_buffer_kernel_test_fill_double(destination[0], AGS_AUDIO_BUFFER_KERNEL_TEST_MAX_COUNT, 2.0);
+      memcpy(destination[1], destination[0], AGS_AUDIO_BUFFER_KERNEL_TEST_MAX_COUNT * sizeof(gdouble));
+
+      ags_audio_buffer_kernel_test_fill_double(source, AGS_AUDIO_BUFFER_KERNEL_TEST_MAX_COUNT, 0.0000001);
+
+      scalar->copy_double_to_double(destination[0], source, count);
+      kernel->copy_double_to_double(destination[1], source, count);
+
+      if(memcmp(destination[0], destination[1], AGS_AUDIO_BUFFER_KERNEL_TEST_MAX_COUNT * sizeof(gdouble)) != 0){
+	success = FALSE;
+
+	break;
+      }
+    }
+  }
+
+  CU_ASSERT(success);
+}
+
+void
+ags_audio_buffer_kernel_test_audio_buffer_util()
+{
+  gfloat destination[2][AGS_AUDIO_BUFFER_KERNEL_TEST_MAX_COUNT];
+  gfloat interleaved[2 * AGS_AUDIO_BUFFER_KERNEL_TEST_MAX_COUNT];
+  gfloat source[AGS_AUDIO_BUFFER_KERNEL_TEST_MAX_COUNT];
+
+  guint i;
+
+  ags_audio_buffer_kernel_test_fill_float(destination[0], AGS_AUDIO_BUFFER_KERNEL_TEST_MAX_COUNT, 2.0);
+  ags_audio_buffer_kernel_test_fill_float(source, AGS_AUDIO_BUFFER_KERNEL_TEST_MAX_COUNT, 0.001);
+
+  for(i = 0; i < AGS_AUDIO_BUFFER_KERNEL_TEST_MAX_COUNT; i++){
+    interleaved[2 * i] = destination[0][i];
+    interleaved[2 * i + 1] = 0.0;
+  }
+  
+  /* contiguous is dispatched, interleaved takes the strided path */
+  ags_audio_buffer_util_copy_float_to_float(NULL,
+					    destination[0], 1,
+					    source, 1,
+					    AGS_AUDIO_BUFFER_KERNEL_TEST_MAX_COUNT);
+
+  ags_audio_buffer_util_copy_float_to_float(NULL,
+					    interleaved, 2,
+					    source, 1,
+					    AGS_AUDIO_BUFFER_KERNEL_TEST_MAX_COUNT);
+
+  for(i = 0; i < AGS_AUDIO_BUFFER_KERNEL_TEST_MAX_COUNT; i++){
+    destination[1][i] = interleaved[2 * i];
+  }
+
+  CU_ASSERT(memcmp(destination[0], destination[1], AGS_AUDIO_BUFFER_KERNEL_TEST_MAX_COUNT * sizeof(gfloat)) == 0);
+
+  ags_audio_buffer_util_clear_float(NULL,
+				    destination[0], 1,
+				    AGS_AUDIO_BUFFER_KERNEL_TEST_MAX_COUNT);
+
+  memset(destination[1], 0, AGS_AUDIO_BUFFER_KERNEL_TEST_MAX_COUNT * sizeof(gfloat));
+  
+  CU_ASSERT(memcmp(destination[0], destination[1], AGS_AUDIO_BUFFER_KERNEL_TEST_MAX_COUNT * sizeof(gfloat)) == 0);
+}
+
+int
+main(int argc, char **argv)
+{
+  CU_pSuite pSuite = NULL;
+
+  /* initialize the CUnit test registry */
+  if(CUE_SUCCESS != CU_initialize_registry()){
+    return CU_get_error();
+  }
+
+  /* add a suite to the registry */
+  pSuite = CU_add_suite("AgsAudioBufferKernelTest", ags_audio_buffer_kernel_test_init_suite, ags_audio_buffer_kernel_test_clean_suite);
+
+  if(pSuite == NULL){
+    CU_cleanup_registry();
+
+    return CU_get_error();
+  }
+
+  /* add the tests to the suite */
+  if((CU_add_test(pSuite, "test of AgsAudioBufferKernel get", ags_audio_buffer_kernel_test_get) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsAudioBufferKernel clear", ags_audio_buffer_kernel_test_clear) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsAudioBufferKernel copy float to float", ags_audio_buffer_kernel_test_copy_float_to_float) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsAudioBufferKernel copy float to double", ags_audio_buffer_kernel_test_copy_float_to_double) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsAudioBufferKernel copy double to float", ags_audio_buffer_kernel_test_copy_double_to_float) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsAudioBufferKernel copy double to double", ags_audio_buffer_kernel_test_copy_double_to_double) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsAudioBufferKernel audio buffer util", ags_audio_buffer_kernel_test_audio_buffer_util) == NULL)){
+    CU_cleanup_registry();
+
+    return CU_get_error();
+  }
+
+  /* Run all tests using the CUnit Basic interface */
+  CU_basic_set_mode(CU_BRM_VERBOSE);
+  CU_basic_run_tests();
+
+  CU_cleanup_registry();
+
+  return(CU_get_error());
+}
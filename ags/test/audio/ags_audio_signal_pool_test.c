@@ -0,0 +1,370 @@
+/* GSequencer - Advanced GTK Sequencer
+ * Copyright (C) 2005-2026 Joël Krähemann
+ *
+ * This file is part of GSequencer.
+ *
+ * GSequencer is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GSequencer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GSequencer.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <glib.h>
+#include <glib-object.h>
+
+#include <ags/libags.h>
+#include <ags/libags-audio.h>
+
+#include <CUnit/CUnit.h>
+#include <CUnit/Automated.h>
+#include <CUnit/Basic.h>
+
+#include <stdlib.h>
+
+int ags_audio_signal_pool_test_init_suite();
+int ags_audio_signal_pool_test_clean_suite();
+
+void ags_audio_signal_pool_test_prealloc();
+void ags_audio_signal_pool_test_acquire();
+void ags_audio_signal_pool_test_release();
+void ags_audio_signal_pool_test_steal_oldest();
+void ags_audio_signal_pool_test_steal_none();
+
+#define AGS_AUDIO_SIGNAL_POOL_TEST_PREALLOC_VOICE_COUNT (8)
+
+#define AGS_AUDIO_SIGNAL_POOL_TEST_ACQUIRE_VOICE_COUNT (4)
+
+#define AGS_AUDIO_SIGNAL_POOL_TEST_STEAL_MAX_POLYPHONY (2)
+#define AGS_AUDIO_SIGNAL_POOL_TEST_STEAL_VOICE_COUNT (4)
+
+/* The suite initialization function.
+ * Opens the temporary file used by the tests.
+ * Returns zero on success, non-zero otherwise.
+ */
+int
+ags_audio_signal_pool_test_init_suite()
+{
+  return(0);
+}
+
+/* The suite cleanup function.
+ * Closes the temporary file used by the tests.
+ * Returns zero on success, non-zero otherwise.
+ */
+int
+ags_audio_signal_pool_test_clean_suite()
+{
+  return(0);
+}
+
+void
+ags_audio_signal_pool_test_prealloc()
+{
+  AgsAudioSignalPool *audio_signal_pool;
+
+  guint i;
+  gboolean success;
+
+  audio_signal_pool = ags_audio_signal_pool_new(NULL);
+
+  ags_audio_signal_pool_prealloc(audio_signal_pool,
+				 AGS_AUDIO_SIGNAL_POOL_TEST_PREALLOC_VOICE_COUNT,
+				 AGS_AUDIO_SIGNAL_POOL_DEFAULT_STREAM_LENGTH);
+
+  CU_ASSERT(audio_signal_pool->voice_count == AGS_AUDIO_SIGNAL_POOL_TEST_PREALLOC_VOICE_COUNT);
+  CU_ASSERT(audio_signal_pool->voice != NULL);
+
+  success = TRUE;
+
+  for(i = 0; i < AGS_AUDIO_SIGNAL_POOL_TEST_PREALLOC_VOICE_COUNT; i++){
+    AgsAudioSignal *audio_signal;
+
+    audio_signal = audio_signal_pool->voice[i].audio_signal;
+    
+    if(!AGS_IS_AUDIO_SIGNAL(audio_signal) ||
+       !ags_audio_signal_test_flags(audio_signal, AGS_AUDIO_SIGNAL_RECYCLED) ||
+       audio_signal->length != AGS_AUDIO_SIGNAL_POOL_DEFAULT_STREAM_LENGTH ||
+       audio_signal->stream_current != audio_signal->stream ||
+       audio_signal_pool->voice[i].state != AGS_AUDIO_SIGNAL_POOL_VOICE_FREE){
+      success = FALSE;
+
+      break;
+    }
+  }
+
+  CU_ASSERT(success);
+
+  /* allocated only once */
+  ags_audio_signal_pool_prealloc(audio_signal_pool,
+				 2 * AGS_AUDIO_SIGNAL_POOL_TEST_PREALLOC_VOICE_COUNT,
+				 AGS_AUDIO_SIGNAL_POOL_DEFAULT_STREAM_LENGTH);
+
+  CU_ASSERT(audio_signal_pool->voice_count == AGS_AUDIO_SIGNAL_POOL_TEST_PREALLOC_VOICE_COUNT);
+
+  g_object_unref(audio_signal_pool);
+}
+
+void
+ags_audio_signal_pool_test_acquire()
+{
+  AgsAudioSignalPool *audio_signal_pool;
+  AgsAudioSignal *audio_signal[AGS_AUDIO_SIGNAL_POOL_TEST_ACQUIRE_VOICE_COUNT];
+
+  guint hit_count, miss_count, steal_count, drop_count;
+  guint i;
+  gboolean dropped;
+  gboolean success;
+
+  audio_signal_pool = ags_audio_signal_pool_new(NULL);
+  ags_audio_signal_pool_set_max_polyphony(audio_signal_pool,
+					  0);
+  
+  ags_audio_signal_pool_prealloc(audio_signal_pool,
+				 AGS_AUDIO_SIGNAL_POOL_TEST_ACQUIRE_VOICE_COUNT,
+				 AGS_AUDIO_SIGNAL_POOL_DEFAULT_STREAM_LENGTH);
+
+  success = TRUE;
+  
+  for(i = 0; i < AGS_AUDIO_SIGNAL_POOL_TEST_ACQUIRE_VOICE_COUNT; i++){
+    audio_signal[i] = ags_audio_signal_pool_acquire(audio_signal_pool,
+						    &dropped);
+
+    if(audio_signal[i] == NULL ||
+       dropped ||
+       !ags_audio_signal_pool_contains(audio_signal_pool,
+				       audio_signal[i]) ||
+       (i > 0 && audio_signal[i] == audio_signal[i - 1])){
+      success = FALSE;
+
+      break;
+    }
+  }
+
+  CU_ASSERT(success);
+
+  /* exhausted */
+  CU_ASSERT(ags_audio_signal_pool_acquire(audio_signal_pool,
+					  &dropped) == NULL);
+  CU_ASSERT(dropped == FALSE);
+
+  ags_audio_signal_pool_get_statistics(audio_signal_pool,
+				       &hit_count, &miss_count, &steal_count, &drop_count);
+
+  CU_ASSERT(hit_count == AGS_AUDIO_SIGNAL_POOL_TEST_ACQUIRE_VOICE_COUNT);
+  CU_ASSERT(miss_count == 1);
+  CU_ASSERT(steal_count == 0);
+  CU_ASSERT(drop_count == 0);
+  CU_ASSERT(audio_signal_pool->playing_count == AGS_AUDIO_SIGNAL_POOL_TEST_ACQUIRE_VOICE_COUNT);
+
+  /* reset statistics */
+  ags_audio_signal_pool_reset_statistics(audio_signal_pool);
+
+  ags_audio_signal_pool_get_statistics(audio_signal_pool,
+				       &hit_count, &miss_count, NULL, NULL);
+
+  CU_ASSERT(hit_count == 0);
+  CU_ASSERT(miss_count == 0);
+  
+  g_object_unref(audio_signal_pool);
+}
+
+void
+ags_audio_signal_pool_test_release()
+{
+  AgsAudioSignalPool *audio_signal_pool;
+  AgsAudioSignal *audio_signal, *current;
+  AgsRecycling *recycling;
+  AgsNote *note;
+
+  gboolean dropped;
+  
+  audio_signal_pool = ags_audio_signal_pool_new(NULL);
+  
+  ags_audio_signal_pool_prealloc(audio_signal_pool,
+				 1,
+				 AGS_AUDIO_SIGNAL_POOL_DEFAULT_STREAM_LENGTH);
+
+  recycling = ags_recycling_new(NULL);
+  ags_recycling_set_audio_signal_pool(recycling,
+				      (GObject *) audio_signal_pool);
+  
+  audio_signal = ags_audio_signal_pool_acquire(audio_signal_pool,
+					       &dropped);
+
+  CU_ASSERT(audio_signal != NULL);
+
+  /* use voice */
+  note = ags_note_new();
+
+  g_object_set(audio_signal,
+	       "recycling", recycling,
+	       "note", note,
+	       NULL);
+  
+  ags_audio_signal_stream_resize(audio_signal,
+				 8);
+
+  audio_signal->stream_current = audio_signal->stream->next;
+  
+  ags_recycling_add_audio_signal(recycling,
+				 audio_signal);
+
+  /* remove releases the voice */
+  ags_recycling_remove_audio_signal(recycling,
+				    audio_signal);
+
+  CU_ASSERT(audio_signal_pool->voice[0].state == AGS_AUDIO_SIGNAL_POOL_VOICE_FREE);
+  CU_ASSERT(audio_signal_pool->playing_count == 0);
+
+  CU_ASSERT(audio_signal->note == NULL);
+  CU_ASSERT(audio_signal->recycling == NULL);
+  CU_ASSERT(audio_signal->length == AGS_AUDIO_SIGNAL_POOL_DEFAULT_STREAM_LENGTH);
+  CU_ASSERT(audio_signal->stream_current == audio_signal->stream);
+  CU_ASSERT(G_OBJECT(audio_signal)->ref_count == 1);
+
+  /* acquire again */
+  current = ags_audio_signal_pool_acquire(audio_signal_pool,
+					  &dropped);
+
+  CU_ASSERT(current == audio_signal);
+
+  g_object_unref(note);
+}
+
+void
+ags_audio_signal_pool_test_steal_oldest()
+{
+  AgsAudioSignalPool *audio_signal_pool;
+  AgsAudioSignal *audio_signal[AGS_AUDIO_SIGNAL_POOL_TEST_STEAL_MAX_POLYPHONY + 1];
+
+  guint steal_count, drop_count;
+  guint i;
+  gboolean dropped;
+
+  audio_signal_pool = ags_audio_signal_pool_new(NULL);
+  g_object_set(audio_signal_pool,
+	       "max-polyphony", AGS_AUDIO_SIGNAL_POOL_TEST_STEAL_MAX_POLYPHONY,
+	       "steal-policy", AGS_AUDIO_SIGNAL_POOL_STEAL_OLDEST,
+	       NULL);
+  
+  ags_audio_signal_pool_prealloc(audio_signal_pool,
+				 AGS_AUDIO_SIGNAL_POOL_TEST_STEAL_VOICE_COUNT,
+				 AGS_AUDIO_SIGNAL_POOL_DEFAULT_STREAM_LENGTH);
+
+  for(i = 0; i < AGS_AUDIO_SIGNAL_POOL_TEST_STEAL_MAX_POLYPHONY + 1; i++){
+    audio_signal[i] = ags_audio_signal_pool_acquire(audio_signal_pool,
+						    &dropped);
+  }
+
+  /* the first voice was cut */
+  CU_ASSERT(audio_signal[AGS_AUDIO_SIGNAL_POOL_TEST_STEAL_MAX_POLYPHONY] != NULL);
+  CU_ASSERT(dropped == FALSE);
+  
+  CU_ASSERT(audio_signal_pool->voice[0].state == AGS_AUDIO_SIGNAL_POOL_VOICE_STOLEN);
+  CU_ASSERT(audio_signal[0]->stream_current == NULL);
+  CU_ASSERT(audio_signal[1]->stream_current != NULL);
+
+  CU_ASSERT(audio_signal_pool->playing_count == AGS_AUDIO_SIGNAL_POOL_TEST_STEAL_MAX_POLYPHONY);
+  
+  ags_audio_signal_pool_get_statistics(audio_signal_pool,
+				       NULL, NULL, &steal_count, &drop_count);
+
+  CU_ASSERT(steal_count == 1);
+  CU_ASSERT(drop_count == 0);
+
+  /* release stolen */
+  ags_audio_signal_pool_release(audio_signal_pool,
+				audio_signal[0]);
+
+  CU_ASSERT(audio_signal_pool->voice[0].state == AGS_AUDIO_SIGNAL_POOL_VOICE_FREE);
+  CU_ASSERT(audio_signal_pool->playing_count == AGS_AUDIO_SIGNAL_POOL_TEST_STEAL_MAX_POLYPHONY);
+  
+  g_object_unref(audio_signal_pool);
+}
+
+void
+ags_audio_signal_pool_test_steal_none()
+{
+  AgsAudioSignalPool *audio_signal_pool;
+  AgsAudioSignal *audio_signal;
+
+  guint drop_count;
+  guint i;
+  gboolean dropped;
+
+  audio_signal_pool = ags_audio_signal_pool_new(NULL);
+  g_object_set(audio_signal_pool,
+	       "max-polyphony", AGS_AUDIO_SIGNAL_POOL_TEST_STEAL_MAX_POLYPHONY,
+	       "steal-policy", AGS_AUDIO_SIGNAL_POOL_STEAL_NONE,
+	       NULL);
+  
+  ags_audio_signal_pool_prealloc(audio_signal_pool,
+				 AGS_AUDIO_SIGNAL_POOL_TEST_STEAL_VOICE_COUNT,
+				 AGS_AUDIO_SIGNAL_POOL_DEFAULT_STREAM_LENGTH);
+
+  for(i = 0; i < AGS_AUDIO_SIGNAL_POOL_TEST_STEAL_MAX_POLYPHONY; i++){
+    ags_audio_signal_pool_acquire(audio_signal_pool,
+				  &dropped);
+  }
+
+  audio_signal = ags_audio_signal_pool_acquire(audio_signal_pool,
+					       &dropped);
+
+  CU_ASSERT(audio_signal == NULL);
+  CU_ASSERT(dropped == TRUE);
+
+  ags_audio_signal_pool_get_statistics(audio_signal_pool,
+				       NULL, NULL, NULL, &drop_count);
+
+  CU_ASSERT(drop_count == 1);
+  
+  g_object_unref(audio_signal_pool);
+}
+
+int
+main(int argc, char **argv)
+{
+  CU_pSuite pSuite = NULL;
+
+  /* initialize the CUnit test registry */
+  if(CUE_SUCCESS != CU_initialize_registry()){
+    return CU_get_error();
+  }
+
+  /* add a suite to the registry */
+  pSuite = CU_add_suite("AgsAudioSignalPoolTest", ags_audio_signal_pool_test_init_suite, ags_audio_signal_pool_test_clean_suite);
+
+  if(pSuite == NULL){
+    CU_cleanup_registry();
+
+    return CU_get_error();
+  }
+
+  /* add the tests to the suite */
+  if((CU_add_test(pSuite, "test of AgsAudioSignalPool prealloc", ags_audio_signal_pool_test_prealloc) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsAudioSignalPool acquire", ags_audio_signal_pool_test_acquire) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsAudioSignalPool release", ags_audio_signal_pool_test_release) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsAudioSignalPool steal oldest", ags_audio_signal_pool_test_steal_oldest) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsAudioSignalPool steal none", ags_audio_signal_pool_test_steal_none) == NULL)){
+    CU_cleanup_registry();
+
+    return CU_get_error();
+  }
+
+  /* Run all tests using the CUnit Basic interface */
+  CU_basic_set_mode(CU_BRM_VERBOSE);
+  CU_basic_run_tests();
+
+  CU_cleanup_registry();
+
+  return(CU_get_error());
+}
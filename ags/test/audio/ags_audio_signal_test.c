@@ -32,6 +32,7 @@ int ags_audio_signal_test_clean_suite();
 
 void ags_audio_signal_test_add_stream();
 void ags_audio_signal_test_resize_stream();
+void ags_audio_signal_test_stream_block();
 void ags_audio_signal_test_realloc_buffer_size();
 void ags_audio_signal_test_copy_buffer_to_buffer();
 void ags_audio_signal_test_copy_double_buffer_to_buffer();
@@ -45,6 +46,8 @@ void ags_audio_signal_test_scale();
 #define AGS_AUDIO_SIGNAL_TEST_GET_TEMPLATE_N_AUDIO_SIGNAL (3)
 #define AGS_AUDIO_SIGNAL_TEST_GET_STREAM_CURRENT_N_AUDIO_SIGNAL (6)
 
+#define AGS_AUDIO_SIGNAL_TEST_STREAM_BLOCK_LENGTH (24)
+
 AgsAlsaDevout *devout;
 
 /* The suite initialization function.
@@ -109,6 +112,87 @@ ags_audio_signal_test_resize_stream()
   CU_ASSERT(g_list_length(audio_signal->stream) == 5);
 }
 
+void
+ags_audio_signal_test_stream_block()
+{
+  AgsAudioSignal *audio_signal;
+
+  GList *stream;
+
+  guint8 *data;
+  
+  guint buffer_size;
+  gsize slot_size;
+  guint i;
+  gboolean success;
+  
+  /* instantiate audio signal */
+  audio_signal = ags_audio_signal_new(G_OBJECT(devout),
+				      NULL,
+				      NULL);
+  ags_audio_signal_set_flags(audio_signal,
+			     AGS_AUDIO_SIGNAL_STREAM_BLOCK);
+
+  g_object_get(audio_signal,
+	       "buffer-size", &buffer_size,
+	       NULL);
+  
+  slot_size = buffer_size * audio_signal->word_size;
+  
+  /* assert resize stream - adjacent buffers adjacent in memory */
+  ags_audio_signal_stream_resize(audio_signal,
+				 AGS_AUDIO_SIGNAL_STREAM_BLOCK_DEFAULT_CAPACITY);
+
+  CU_ASSERT(g_list_length(audio_signal->stream) == AGS_AUDIO_SIGNAL_STREAM_BLOCK_DEFAULT_CAPACITY);
+  CU_ASSERT(g_list_length(audio_signal->stream_block) == 2);
+
+  stream = audio_signal->stream;
+  data = stream->data;
+  
+  success = TRUE;
+
+  for(i = 0; stream != NULL; i++){
+    if(stream->data != data + (i * slot_size)){
+      success = FALSE;
+
+      break;
+    }
+
+    if(stream->next != NULL &&
+       stream->next != stream + 1){
+      success = FALSE;
+
+      break;
+    }
+    
+    stream = stream->next;
+  }
+
+  CU_ASSERT(success);
+
+  /* assert grow beyond capacity */
+  ags_audio_signal_stream_resize(audio_signal,
+				 AGS_AUDIO_SIGNAL_TEST_STREAM_BLOCK_LENGTH);
+
+  CU_ASSERT(g_list_length(audio_signal->stream) == AGS_AUDIO_SIGNAL_TEST_STREAM_BLOCK_LENGTH);
+  CU_ASSERT(g_list_last(audio_signal->stream) == audio_signal->stream_end);
+  CU_ASSERT(g_list_length(audio_signal->stream_block) == 4);
+
+  /* assert shrink and add stream reuses the slots */
+  ags_audio_signal_stream_resize(audio_signal,
+				 1);
+
+  CU_ASSERT(g_list_length(audio_signal->stream) == 1);
+  CU_ASSERT(g_list_length(audio_signal->stream_block) == 2);
+
+  ags_audio_signal_add_stream(audio_signal);
+
+  CU_ASSERT(g_list_length(audio_signal->stream) == 2);
+  CU_ASSERT(audio_signal->stream->next->data == data + slot_size);
+
+  g_object_unref(audio_signal);
+}
+
 void
 ags_audio_signal_test_realloc_buffer_size()
 {
@@ -187,7 +271,8 @@ main(int argc, char **argv)
 
   /* add the tests to the suite */
   if((CU_add_test(pSuite, "test of AgsAudioSignal add stream", ags_audio_signal_test_add_stream) == NULL) ||
-     (CU_add_test(pSuite, "test of AgsAudioSignal resize stream", ags_audio_signal_test_resize_stream) == NULL)
+     (CU_add_test(pSuite, "test of AgsAudioSignal resize stream", ags_audio_signal_test_resize_stream) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsAudioSignal stream block", ags_audio_signal_test_stream_block) == NULL)
      /* ||
      (CU_add_test(pSuite, "test of AgsAudioSignal realloc buffer size", ags_audio_signal_test_realloc_buffer_size) == NULL) ||
      (CU_add_test(pSuite, "test of AgsAudioSignal copy buffer to buffer", ags_audio_signal_test_copy_buffer_to_buffer) == NULL) ||
@@ -49,6 +49,9 @@ void ags_audio_test_add_notation();
 void ags_audio_test_remove_notation();
 void ags_audio_test_add_automation();
 void ags_audio_test_remove_automation();
+void ags_audio_test_find_notation_near_timestamp();
+void ags_audio_test_find_automation_near_timestamp_extended();
+void ags_audio_test_find_wave_near_timestamp();
 void ags_audio_test_add_recall_id();
 void ags_audio_test_remove_recall_id();
 void ags_audio_test_add_recycling_context();
@@ -85,6 +88,9 @@ void ags_audio_test_init_recall_callback(AgsRecall *recall,
 void ags_audio_test_resolve_recall_callback(AgsRecall *recall,
 					    gpointer data);
 
+#define AGS_AUDIO_TEST_FIND_NEAR_TIMESTAMP_AUDIO_CHANNELS (2)
+#define AGS_AUDIO_TEST_FIND_NEAR_TIMESTAMP_COUNT (64)
+
 #define AGS_AUDIO_TEST_DISPOSE_AUDIO_CHANNELS (2)
 #define AGS_AUDIO_TEST_DISPOSE_INPUT_PADS (12)
 #define AGS_AUDIO_TEST_DISPOSE_OUTPUT_PADS (5)
@@ -728,6 +734,251 @@ ags_audio_test_remove_automation()
   //TODO:JK: implement me
 }
 
+void
+ags_audio_test_find_notation_near_timestamp()
+{
+  AgsAudio *audio;
+  AgsNotation *notation;
+  AgsTimestamp *timestamp;
+
+  GObject *current;
+  
+  GList *list;
+
+  guint i, j;
+  gboolean success;
+
+  audio = ags_audio_new(NULL);
+
+  /* add in reverse order */
+  for(i = 0; i < AGS_AUDIO_TEST_FIND_NEAR_TIMESTAMP_COUNT; i++){
+    for(j = 0; j < AGS_AUDIO_TEST_FIND_NEAR_TIMESTAMP_AUDIO_CHANNELS; j++){
+      if(i % 3 == 2 &&
+	 j == 1){
+	continue;
+      }
+      
+      notation = ags_notation_new((GObject *) audio,
+				  j);
+      ags_timestamp_set_ags_offset(notation->timestamp,
+				   (guint64) ((AGS_AUDIO_TEST_FIND_NEAR_TIMESTAMP_COUNT - i - 1) * AGS_NOTATION_DEFAULT_OFFSET));
+
+      ags_audio_add_notation(audio,
+			     (GObject *) notation);
+    }
+  }
+
+  timestamp = ags_timestamp_new();
+
+  timestamp->flags &= (~AGS_TIMESTAMP_UNIX);
+  timestamp->flags |= AGS_TIMESTAMP_OFFSET;
+
+  /* compare to list */
+  success = TRUE;
+  
+  for(i = 0; i < AGS_AUDIO_TEST_FIND_NEAR_TIMESTAMP_COUNT + 2 && success; i++){
+    for(j = 0; j < AGS_AUDIO_TEST_FIND_NEAR_TIMESTAMP_AUDIO_CHANNELS + 1; j++){
+      ags_timestamp_set_ags_offset(timestamp,
+				   (guint64) (i * AGS_NOTATION_DEFAULT_OFFSET));
+
+      list = ags_notation_find_near_timestamp(audio->notation, j,
+					      timestamp);
+      current = ags_audio_find_notation_near_timestamp(audio, j,
+						       timestamp);
+
+      if(current != ((list != NULL) ? list->data: NULL)){
+	success = FALSE;
+      }
+
+      if(current != NULL){
+	g_object_unref(current);
+      }
+    }
+  }
+
+  CU_ASSERT(success == TRUE);
+
+  /* remove and compare */
+  notation = audio->notation->data;
+  
+  ags_timestamp_set_ags_offset(timestamp,
+			       ags_timestamp_get_ags_offset(notation->timestamp));
+
+  j = notation->audio_channel;
+  
+  ags_audio_remove_notation(audio,
+			    (GObject *) notation);
+
+  current = ags_audio_find_notation_near_timestamp(audio, j,
+						   timestamp);
+  
+  CU_ASSERT(current == NULL);
+
+  g_object_unref(timestamp);
+}
+
+void
+ags_audio_test_find_automation_near_timestamp_extended()
+{
+  AgsAudio *audio;
+  AgsAutomation *automation;
+  AgsTimestamp *timestamp;
+
+  GObject *current;
+  
+  GList *list;
+
+  gchar *control_name[] = {
+    "./volume[0]",
+    "./muted[0]",
+  };
+  
+  guint i, j, k;
+  gboolean success;
+
+  audio = ags_audio_new(NULL);
+
+  for(i = 0; i < AGS_AUDIO_TEST_FIND_NEAR_TIMESTAMP_COUNT; i++){
+    for(j = 0; j < AGS_AUDIO_TEST_FIND_NEAR_TIMESTAMP_AUDIO_CHANNELS; j++){
+      for(k = 0; k < 2; k++){
+	if(i % 2 == 1 &&
+	   k == 1){
+	  continue;
+	}
+	
+	automation = ags_automation_new((GObject *) audio,
+					j,
+					AGS_TYPE_INPUT,
+					control_name[k]);
+	ags_timestamp_set_ags_offset(automation->timestamp,
+				     (guint64) (i * AGS_AUTOMATION_DEFAULT_OFFSET));
+
+	ags_audio_add_automation(audio,
+				 (GObject *) automation);
+      }
+    }
+  }
+
+  timestamp = ags_timestamp_new();
+
+  timestamp->flags &= (~AGS_TIMESTAMP_UNIX);
+  timestamp->flags |= AGS_TIMESTAMP_OFFSET;
+
+  /* compare to list */
+  success = TRUE;
+  
+  for(i = 0; i < AGS_AUDIO_TEST_FIND_NEAR_TIMESTAMP_COUNT + 2 && success; i++){
+    for(j = 0; j < AGS_AUDIO_TEST_FIND_NEAR_TIMESTAMP_AUDIO_CHANNELS + 1; j++){
+      for(k = 0; k < 2; k++){
+	ags_timestamp_set_ags_offset(timestamp,
+				     (guint64) (i * AGS_AUTOMATION_DEFAULT_OFFSET));
+
+	list = ags_automation_find_near_timestamp_extended(audio->automation, j,
+							   AGS_TYPE_INPUT, control_name[k],
+							   timestamp);
+	current = ags_audio_find_automation_near_timestamp_extended(audio, j,
+								    AGS_TYPE_INPUT, control_name[k],
+								    timestamp);
+
+	if(current != ((list != NULL) ? list->data: NULL)){
+	  success = FALSE;
+	}
+
+	if(current != NULL){
+	  g_object_unref(current);
+	}
+      }
+    }
+  }
+
+  CU_ASSERT(success == TRUE);
+
+  /* other channel type */
+  ags_timestamp_set_ags_offset(timestamp,
+			       0);
+
+  current = ags_audio_find_automation_near_timestamp_extended(audio, 0,
+							      AGS_TYPE_OUTPUT, control_name[0],
+							      timestamp);
+  
+  CU_ASSERT(current == NULL);
+
+  g_object_unref(timestamp);
+}
+
+void
+ags_audio_test_find_wave_near_timestamp()
+{
+  AgsAudio *audio;
+  AgsWave *wave;
+  AgsTimestamp *timestamp;
+
+  GObject *current;
+  
+  GList *list;
+
+  guint i, j;
+  gboolean success;
+
+  audio = ags_audio_new(NULL);
+
+  for(i = 0; i < AGS_AUDIO_TEST_FIND_NEAR_TIMESTAMP_COUNT; i++){
+    for(j = 0; j < AGS_AUDIO_TEST_FIND_NEAR_TIMESTAMP_AUDIO_CHANNELS; j++){
+      wave = ags_wave_new((GObject *) audio,
+			  j);
+      ags_timestamp_set_ags_offset(wave->timestamp,
+				   (guint64) (i * AGS_WAVE_DEFAULT_OFFSET));
+
+      ags_audio_add_wave(audio,
+			 (GObject *) wave);
+    }
+  }
+
+  timestamp = ags_timestamp_new();
+
+  timestamp->flags &= (~AGS_TIMESTAMP_UNIX);
+  timestamp->flags |= AGS_TIMESTAMP_OFFSET;
+
+  /* compare to list */
+  success = TRUE;
+  
+  for(i = 0; i < AGS_AUDIO_TEST_FIND_NEAR_TIMESTAMP_COUNT + 2 && success; i++){
+    for(j = 0; j < AGS_AUDIO_TEST_FIND_NEAR_TIMESTAMP_AUDIO_CHANNELS + 1; j++){
+      ags_timestamp_set_ags_offset(timestamp,
+				   (guint64) (i * AGS_WAVE_DEFAULT_OFFSET));
+
+      list = ags_wave_find_near_timestamp(audio->wave, j,
+					  timestamp);
+      current = ags_audio_find_wave_near_timestamp(audio, j,
+						   timestamp);
+
+      if(current != ((list != NULL) ? list->data: NULL)){
+	success = FALSE;
+      }
+
+      if(current != NULL){
+	g_object_unref(current);
+      }
+    }
+  }
+
+  CU_ASSERT(success == TRUE);
+
+  /* set wave invalidates */
+  ags_audio_set_wave(audio,
+		     NULL);
+
+  ags_timestamp_set_ags_offset(timestamp,
+			       0);
+
+  current = ags_audio_find_wave_near_timestamp(audio, 0,
+					       timestamp);
+  
+  CU_ASSERT(current == NULL);
+
+  g_object_unref(timestamp);
+}
+
 void
 ags_audio_test_add_recall_id()
 {
@@ -1696,7 +1947,10 @@ main(int argc, char **argv)
      (CU_add_test(pSuite, "test of AgsAudio recycling context", ags_audio_test_add_recycling_context) == NULL) ||
      (CU_add_test(pSuite, "test of AgsAudio duplicate recall", ags_audio_test_duplicate_recall) == NULL) ||
      (CU_add_test(pSuite, "test of AgsAudio initialize recall", ags_audio_test_init_recall) == NULL) ||
-     (CU_add_test(pSuite, "test of AgsAudio resolve recall", ags_audio_test_resolve_recall) == NULL)){
+     (CU_add_test(pSuite, "test of AgsAudio resolve recall", ags_audio_test_resolve_recall) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsAudio find notation near timestamp", ags_audio_test_find_notation_near_timestamp) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsAudio find automation near timestamp extended", ags_audio_test_find_automation_near_timestamp_extended) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsAudio find wave near timestamp", ags_audio_test_find_wave_near_timestamp) == NULL)){
     CU_cleanup_registry();
     
     return CU_get_error();
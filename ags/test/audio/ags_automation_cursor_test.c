@@ -0,0 +1,381 @@
+/* GSequencer - Advanced GTK Sequencer
+ * Copyright (C) 2005-2026 Joël Krähemann
+ *
+ * This file is part of GSequencer.
+ *
+ * GSequencer is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GSequencer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GSequencer.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <glib.h>
+#include <glib-object.h>
+
+#include <ags/libags.h>
+#include <ags/libags-audio.h>
+
+#include <CUnit/CUnit.h>
+#include <CUnit/Automated.h>
+#include <CUnit/Basic.h>
+
+#include <math.h>
+
+int ags_automation_cursor_test_init_suite();
+int ags_automation_cursor_test_clean_suite();
+
+void ags_automation_cursor_test_update();
+void ags_automation_cursor_test_seek();
+void ags_automation_cursor_test_fill();
+void ags_automation_cursor_test_fill_step();
+
+AgsAutomation* ags_automation_cursor_test_create_automation(guint n_point, guint width);
+
+#define AGS_AUTOMATION_CURSOR_TEST_CONTROL_NAME "./volume[0]"
+
+#define AGS_AUTOMATION_CURSOR_TEST_N_POINT (64)
+#define AGS_AUTOMATION_CURSOR_TEST_WIDTH (100)
+
+#define AGS_AUTOMATION_CURSOR_TEST_BUFFER_LENGTH (8)
+
+/* The suite initialization function.
+ * Opens the temporary file used by the tests.
+ * Returns zero on success, non-zero otherwise.
+ */
+int
+ags_automation_cursor_test_init_suite()
+{
+  return(0);
+}
+
+/* The suite cleanup function.
+ * Closes the temporary file used by the tests.
+ * Returns zero on success, non-zero otherwise.
+ */
+int
+ags_automation_cursor_test_clean_suite()
+{
+  return(0);
+}
+
+AgsAutomation*
+ags_automation_cursor_test_create_automation(guint n_point, guint width)
+{
+  AgsAutomation *automation;
+  AgsAcceleration *acceleration;
+
+  guint i;
+
+  automation = ags_automation_new(NULL,
+				  0,
+				  AGS_TYPE_INPUT,
+				  AGS_AUTOMATION_CURSOR_TEST_CONTROL_NAME);
+
+  /* alternate between 0.0 and 1.0 */
+  for(i = 0; i < n_point; i++){
+    acceleration = ags_acceleration_new();
+    acceleration->x = (i + 1) * width;
+    acceleration->y = (gdouble) (i % 2);
+
+    ags_automation_add_acceleration(automation,
+				    acceleration,
+				    FALSE);
+  }
+
+  return(automation);
+}
+
+void
+ags_automation_cursor_test_update()
+{
+  AgsAutomationCursor *cursor;
+  AgsAutomation *automation;
+
+  GList *list;
+
+  guint i;
+  gboolean success;
+
+  cursor = ags_automation_cursor_alloc();
+
+  automation = ags_automation_cursor_test_create_automation(AGS_AUTOMATION_CURSOR_TEST_N_POINT,
+							    AGS_AUTOMATION_CURSOR_TEST_WIDTH);
+
+  list = g_list_prepend(NULL,
+			automation);
+
+  ags_automation_cursor_update(cursor,
+			       list,
+			       1,
+			       TRUE);
+
+  CU_ASSERT(cursor->revision == 1);
+  CU_ASSERT(cursor->point_count == AGS_AUTOMATION_CURSOR_TEST_N_POINT);
+
+  success = TRUE;
+
+  for(i = 1; i < cursor->point_count; i++){
+    if(cursor->point[i - 1].x > cursor->point[i].x){
+      success = FALSE;
+
+      break;
+    }
+  }
+
+  CU_ASSERT(success);
+
+  /* bypass */
+  ags_automation_set_flags(automation,
+			   AGS_AUTOMATION_BYPASS);
+
+  ags_automation_cursor_update(cursor,
+			       list,
+			       2,
+			       TRUE);
+
+  CU_ASSERT(cursor->point_count == 0);
+  CU_ASSERT(ags_automation_cursor_fill(cursor,
+				       0.0, (gdouble) AGS_AUTOMATION_CURSOR_TEST_WIDTH,
+				       AGS_AUTOMATION_CURSOR_TEST_BUFFER_LENGTH) == FALSE);
+
+  g_list_free(list);
+
+  g_object_unref(automation);
+
+  ags_automation_cursor_free(cursor);
+}
+
+void
+ags_automation_cursor_test_seek()
+{
+  AgsAutomationCursor *cursor;
+  AgsAutomation *automation;
+
+  GList *list;
+
+  guint i;
+  gboolean success;
+
+  cursor = ags_automation_cursor_alloc();
+
+  automation = ags_automation_cursor_test_create_automation(AGS_AUTOMATION_CURSOR_TEST_N_POINT,
+							    AGS_AUTOMATION_CURSOR_TEST_WIDTH);
+
+  list = g_list_prepend(NULL,
+			automation);
+
+  ags_automation_cursor_update(cursor,
+			       list,
+			       1,
+			       TRUE);
+
+  /* forward */
+  success = TRUE;
+
+  for(i = 0; i <= AGS_AUTOMATION_CURSOR_TEST_N_POINT; i++){
+    ags_automation_cursor_seek(cursor,
+			       (gdouble) (i * AGS_AUTOMATION_CURSOR_TEST_WIDTH) + 1.0);
+
+    if(cursor->position != i){
+      success = FALSE;
+
+      break;
+    }
+  }
+
+  CU_ASSERT(success);
+
+  /* backward, e.g. loop */
+  ags_automation_cursor_seek(cursor,
+			     (gdouble) (3 * AGS_AUTOMATION_CURSOR_TEST_WIDTH));
+
+  CU_ASSERT(cursor->position == 3);
+
+  ags_automation_cursor_seek(cursor,
+			     0.0);
+
+  CU_ASSERT(cursor->position == 0);
+
+  g_list_free(list);
+
+  g_object_unref(automation);
+
+  ags_automation_cursor_free(cursor);
+}
+
+void
+ags_automation_cursor_test_fill()
+{
+  AgsAutomationCursor *cursor;
+  AgsAutomation *automation;
+
+  GList *list;
+
+  gfloat *ramp;
+
+  guint ramp_length;
+  guint i;
+  gboolean success;
+
+  cursor = ags_automation_cursor_alloc();
+
+  automation = ags_automation_cursor_test_create_automation(2,
+							    AGS_AUTOMATION_CURSOR_TEST_WIDTH);
+
+  list = g_list_prepend(NULL,
+			automation);
+
+  ags_automation_cursor_update(cursor,
+			       list,
+			       1,
+			       TRUE);
+
+  /* before first point */
+  CU_ASSERT(ags_automation_cursor_fill(cursor,
+				       0.0, (gdouble) AGS_AUTOMATION_CURSOR_TEST_WIDTH / 2.0,
+				       AGS_AUTOMATION_CURSOR_TEST_BUFFER_LENGTH) == FALSE);
+
+  /* slope from 0.0 to 1.0 */
+  CU_ASSERT(ags_automation_cursor_fill(cursor,
+				       (gdouble) AGS_AUTOMATION_CURSOR_TEST_WIDTH, (gdouble) (2 * AGS_AUTOMATION_CURSOR_TEST_WIDTH),
+				       AGS_AUTOMATION_CURSOR_TEST_BUFFER_LENGTH) == TRUE);
+
+  ramp = ags_automation_cursor_get_ramp(cursor,
+					&ramp_length);
+
+  CU_ASSERT(ramp != NULL);
+  CU_ASSERT(ramp_length == AGS_AUTOMATION_CURSOR_TEST_BUFFER_LENGTH);
+  CU_ASSERT(ags_automation_cursor_get_value(cursor) == 0.0);
+
+  success = TRUE;
+
+  for(i = 0; ramp != NULL && i < AGS_AUTOMATION_CURSOR_TEST_BUFFER_LENGTH; i++){
+    if(fabs(ramp[i] - ((gdouble) i / (gdouble) AGS_AUTOMATION_CURSOR_TEST_BUFFER_LENGTH)) > 0.0001){
+      success = FALSE;
+
+      break;
+    }
+  }
+
+  CU_ASSERT(success);
+
+  /* after last point is constant */
+  CU_ASSERT(ags_automation_cursor_fill(cursor,
+				       (gdouble) (3 * AGS_AUTOMATION_CURSOR_TEST_WIDTH), (gdouble) (4 * AGS_AUTOMATION_CURSOR_TEST_WIDTH),
+				       AGS_AUTOMATION_CURSOR_TEST_BUFFER_LENGTH) == TRUE);
+
+  CU_ASSERT(ags_automation_cursor_get_ramp(cursor,
+					   &ramp_length) == NULL);
+  CU_ASSERT(ramp_length == 0);
+  CU_ASSERT(ags_automation_cursor_get_value(cursor) == 1.0);
+
+  g_list_free(list);
+
+  g_object_unref(automation);
+
+  ags_automation_cursor_free(cursor);
+}
+
+void
+ags_automation_cursor_test_fill_step()
+{
+  AgsAutomationCursor *cursor;
+  AgsAutomation *automation;
+
+  GList *list;
+
+  gfloat *ramp;
+
+  guint ramp_length;
+
+  cursor = ags_automation_cursor_alloc();
+
+  automation = ags_automation_cursor_test_create_automation(2,
+							    AGS_AUTOMATION_CURSOR_TEST_WIDTH);
+
+  list = g_list_prepend(NULL,
+			automation);
+
+  ags_automation_cursor_update(cursor,
+			       list,
+			       1,
+			       FALSE);
+
+  /* no slope */
+  CU_ASSERT(ags_automation_cursor_fill(cursor,
+				       (gdouble) AGS_AUTOMATION_CURSOR_TEST_WIDTH + 10.0, (gdouble) AGS_AUTOMATION_CURSOR_TEST_WIDTH + 20.0,
+				       AGS_AUTOMATION_CURSOR_TEST_BUFFER_LENGTH) == TRUE);
+  CU_ASSERT(ags_automation_cursor_get_ramp(cursor,
+					   NULL) == NULL);
+  CU_ASSERT(ags_automation_cursor_get_value(cursor) == 0.0);
+
+  /* step within block */
+  CU_ASSERT(ags_automation_cursor_fill(cursor,
+				       (gdouble) (2 * AGS_AUTOMATION_CURSOR_TEST_WIDTH) - 4.0, (gdouble) (2 * AGS_AUTOMATION_CURSOR_TEST_WIDTH) + 4.0,
+				       AGS_AUTOMATION_CURSOR_TEST_BUFFER_LENGTH) == TRUE);
+
+  ramp = ags_automation_cursor_get_ramp(cursor,
+					&ramp_length);
+
+  CU_ASSERT(ramp != NULL);
+
+  if(ramp != NULL){
+    CU_ASSERT(ramp[0] == 0.0);
+    CU_ASSERT(ramp[3] == 0.0);
+    CU_ASSERT(ramp[4] == 1.0);
+    CU_ASSERT(ramp[AGS_AUTOMATION_CURSOR_TEST_BUFFER_LENGTH - 1] == 1.0);
+  }
+
+  g_list_free(list);
+
+  g_object_unref(automation);
+
+  ags_automation_cursor_free(cursor);
+}
+
+int
+main(int argc, char **argv)
+{
+  CU_pSuite pSuite = NULL;
+
+  /* initialize the CUnit test registry */
+  if(CUE_SUCCESS != CU_initialize_registry()){
+    return CU_get_error();
+  }
+
+  /* add a suite to the registry */
+  pSuite = CU_add_suite("AgsAutomationCursorTest", ags_automation_cursor_test_init_suite, ags_automation_cursor_test_clean_suite);
+
+  if(pSuite == NULL){
+    CU_cleanup_registry();
+
+    return CU_get_error();
+  }
+
+  /* add the tests to the suite */
+  if((CU_add_test(pSuite, "test of AgsAutomationCursor update", ags_automation_cursor_test_update) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsAutomationCursor seek", ags_automation_cursor_test_seek) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsAutomationCursor fill", ags_automation_cursor_test_fill) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsAutomationCursor fill step", ags_automation_cursor_test_fill_step) == NULL)){
+    CU_cleanup_registry();
+
+    return CU_get_error();
+  }
+
+  /* Run all tests using the CUnit Basic interface */
+  CU_basic_set_mode(CU_BRM_VERBOSE);
+  CU_basic_run_tests();
+
+  CU_cleanup_registry();
+
+  return(CU_get_error());
+}
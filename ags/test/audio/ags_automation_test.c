@@ -53,6 +53,7 @@ void ags_automation_test_get_specifier_unique();
 void ags_automation_test_find_specifier();
 void ags_automation_test_find_specifier_with_type_and_line();
 void ags_automation_test_get_value();
+void ags_automation_test_acceleration_revision();
 
 #define AGS_AUTOMATION_TEST_CONTROL_NAME "./ags-test-control"
 
@@ -1188,6 +1189,65 @@ ags_automation_test_get_value()
   //TODO:JK: implement me
 }
 
+void
+ags_automation_test_acceleration_revision()
+{
+  AgsAutomation *automation;
+  AgsAcceleration *acceleration;
+  AgsPort *port;
+
+  guint revision;
+
+  automation = ags_automation_new(audio,
+				  0,
+				  AGS_TYPE_INPUT,
+				  AGS_AUTOMATION_TEST_CONTROL_NAME);
+
+  port = ags_port_new();
+  g_object_set(automation,
+	       "port", port,
+	       NULL);
+
+  acceleration = ags_acceleration_new();
+  acceleration->x = 0;
+  acceleration->y = 0.0;
+  
+  ags_automation_add_acceleration(automation,
+				  acceleration,
+				  FALSE);
+
+  CU_ASSERT(acceleration->automation == (GObject *) automation);
+
+  /* moving an existing point invalidates the port's cursor */
+  revision = ags_atomic_uint_get(&(port->automation_revision));
+
+  ags_acceleration_set_y(acceleration,
+			 1.0);
+
+  CU_ASSERT(ags_atomic_uint_get(&(port->automation_revision)) != revision);
+
+  revision = ags_atomic_uint_get(&(port->automation_revision));
+
+  ags_acceleration_set_x(acceleration,
+			 16);
+
+  CU_ASSERT(ags_atomic_uint_get(&(port->automation_revision)) != revision);
+
+  /* detached points don't */
+  ags_automation_remove_acceleration(automation,
+				     acceleration,
+				     FALSE);
+
+  CU_ASSERT(acceleration->automation == NULL);
+
+  revision = ags_atomic_uint_get(&(port->automation_revision));
+
+  ags_acceleration_set_y(acceleration,
+			 0.0);
+
+  CU_ASSERT(ags_atomic_uint_get(&(port->automation_revision)) == revision);
+}
+
 int
 main(int argc, char **argv)
 {
@@ -1223,7 +1283,8 @@ main(int argc, char **argv)
      (CU_add_test(pSuite, "test of AgsAutomation add point to selection", ags_automation_test_add_point_to_selection) == NULL) ||
      (CU_add_test(pSuite, "test of AgsAutomation remove point from selection", ags_automation_test_remove_point_from_selection) == NULL) ||
      (CU_add_test(pSuite, "test of AgsAutomation get specifier unique", ags_automation_test_get_specifier_unique) == NULL) ||
-     (CU_add_test(pSuite, "test of AgsAutomation find specifier", ags_automation_test_find_specifier) == NULL)){
+     (CU_add_test(pSuite, "test of AgsAutomation find specifier", ags_automation_test_find_specifier) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsAutomation acceleration revision", ags_automation_test_acceleration_revision) == NULL)){
     CU_cleanup_registry();
     
     return CU_get_error();
@@ -0,0 +1,239 @@
+/* GSequencer - Advanced GTK Sequencer
+ * Copyright (C) 2005-2026 Joël Krähemann
+ *
+ * This file is part of GSequencer.
+ *
+ * GSequencer is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GSequencer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GSequencer.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <glib.h>
+#include <glib-object.h>
+
+#include <ags/libags.h>
+#include <ags/libags-audio.h>
+
+#include <CUnit/CUnit.h>
+#include <CUnit/Automated.h>
+#include <CUnit/Basic.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+int ags_functional_audio_buffer_kernel_test_init_suite();
+int ags_functional_audio_buffer_kernel_test_clean_suite();
+
+void ags_functional_audio_buffer_kernel_test_throughput();
+
+void ags_functional_audio_buffer_kernel_test_report(AgsAudioBufferKernel *kernel,
+						    gchar *kernel_name,
+						    gint64 start_time, gint64 end_time,
+						    gsize bytes_per_frame);
+
+#define AGS_FUNCTIONAL_AUDIO_BUFFER_KERNEL_TEST_BUFFER_SIZE (4096)
+#define AGS_FUNCTIONAL_AUDIO_BUFFER_KERNEL_TEST_N_CYCLE (100000)
+
+gfloat *float_destination;
+gfloat *float_source;
+
+gdouble *double_destination;
+gdouble *double_source;
+
+/* The suite initialization function.
+ * Opens the temporary file used by the tests.
+ * Returns zero on success, non-zero otherwise.
+ */
+int
+ags_functional_audio_buffer_kernel_test_init_suite()
+{
+  guint i;
+  
+  float_destination = (gfloat *) g_malloc(AGS_FUNCTIONAL_AUDIO_BUFFER_KERNEL_TEST_BUFFER_SIZE * sizeof(gfloat));
+  float_source = (gfloat *) g_malloc(AGS_FUNCTIONAL_AUDIO_BUFFER_KERNEL_TEST_BUFFER_SIZE * sizeof(gfloat));
+
+  double_destination = (gdouble *) g_malloc(AGS_FUNCTIONAL_AUDIO_BUFFER_KERNEL_TEST_BUFFER_SIZE * sizeof(gdouble));
+  double_source = (gdouble *) g_malloc(AGS_FUNCTIONAL_AUDIO_BUFFER_KERNEL_TEST_BUFFER_SIZE * sizeof(gdouble));
+
+  for(i = 0; i < AGS_FUNCTIONAL_AUDIO_BUFFER_KERNEL_TEST_BUFFER_SIZE; i++){
+    float_destination[i] = 0.0;
+    float_source[i] = (gfloat) (0.000001 * ((gdouble) i / (gdouble) AGS_FUNCTIONAL_AUDIO_BUFFER_KERNEL_TEST_BUFFER_SIZE));
+
+    double_destination[i] = 0.0;
+    double_source[i] = 0.000001 * ((gdouble) i / (gdouble) AGS_FUNCTIONAL_AUDIO_BUFFER_KERNEL_TEST_BUFFER_SIZE);
+  }
+  
+  return(0);
+}
+
+/* The suite cleanup function.
+ * Closes the temporary file used by the tests.
+ * Returns zero on success, non-zero otherwise.
+ */
+int
+ags_functional_audio_buffer_kernel_test_clean_suite()
+{
+  g_free(float_destination);
+  g_free(float_source);
+
+  g_free(double_destination);
+  g_free(double_source);
+  
+  return(0);
+}
+
+void
+ags_functional_audio_buffer_kernel_test_report(AgsAudioBufferKernel *kernel,
+					       gchar *kernel_name,
+					       gint64 start_time, gint64 end_time,
+					       gsize bytes_per_frame)
+{
+  gdouble bytes;
+  gdouble seconds;
+
+  bytes = (gdouble) AGS_FUNCTIONAL_AUDIO_BUFFER_KERNEL_TEST_N_CYCLE * (gdouble) AGS_FUNCTIONAL_AUDIO_BUFFER_KERNEL_TEST_BUFFER_SIZE * (gdouble) bytes_per_frame;
+  seconds = (gdouble) (end_time - start_time) / (gdouble) G_USEC_PER_SEC;
+
+  if(seconds <= 0.0){
+    seconds = 1.0 / (gdouble) G_USEC_PER_SEC;
+  }
+  
+  g_message("%s %s - %.3f GB/s", kernel->name, kernel_name, bytes / seconds / 1000000000.0);
+}
+
+void
+ags_functional_audio_buffer_kernel_test_throughput()
+{
+  AgsAudioBufferKernel *kernel;
+
+  gint64 start_time, end_time;
+  guint isa;
+  guint i;
+
+  for(isa = 0; isa < AGS_AUDIO_BUFFER_KERNEL_ISA_COUNT; isa++){
+    if((kernel = ags_audio_buffer_kernel_get(isa)) == NULL){
+      continue;
+    }
+
+    /* clear - write only */
+    start_time = g_get_monotonic_time();
+    
+    for(i = 0; i < AGS_FUNCTIONAL_AUDIO_BUFFER_KERNEL_TEST_N_CYCLE; i++){
+      kernel->clear_float(float_destination, AGS_FUNCTIONAL_AUDIO_BUFFER_KERNEL_TEST_BUFFER_SIZE);
+    }
+
+    end_time = g_get_monotonic_time();
+
+    ags_functional_audio_buffer_kernel_test_report(kernel, "clear float",
+						   start_time, end_time,
+						   sizeof(gfloat));
+
+    start_time = g_get_monotonic_time();
+    
+    for(i = 0; i < AGS_FUNCTIONAL_AUDIO_BUFFER_KERNEL_TEST_N_CYCLE; i++){
+      kernel->clear_double(double_destination, AGS_FUNCTIONAL_AUDIO_BUFFER_KERNEL_TEST_BUFFER_SIZE);
+    }
+
+    end_time = g_get_monotonic_time();
+
+    ags_functional_audio_buffer_kernel_test_report(kernel, "clear double",
+						   start_time, end_time,
+						   sizeof(gdouble));
+
+    /* copy - read destination and source, write destination */
+    start_time = g_get_monotonic_time();
+    
+    for(i = 0; i < AGS_FUNCTIONAL_AUDIO_BUFFER_KERNEL_TEST_N_CYCLE; i++){
+      kernel->copy_float_to_float(float_destination, float_source, AGS_FUNCTIONAL_AUDIO_BUFFER_KERNEL_TEST_BUFFER_SIZE);
+    }
+
+    end_time = g_get_monotonic_time();
+
+    ags_functional_audio_buffer_kernel_test_report(kernel, "copy float to float",
+						   start_time, end_time,
+						   3 * sizeof(gfloat));
+
+    start_time = g_get_monotonic_time();
+    
+    for(i = 0; i < AGS_FUNCTIONAL_AUDIO_BUFFER_KERNEL_TEST_N_CYCLE; i++){
+      kernel->copy_float_to_double(double_destination, float_source, AGS_FUNCTIONAL_AUDIO_BUFFER_KERNEL_TEST_BUFFER_SIZE);
+    }
+
+    end_time = g_get_monotonic_time();
+
+    ags_functional_audio_buffer_kernel_test_report(kernel, "copy float to double",
+						   start_time, end_time,
+						   2 * sizeof(gdouble) + sizeof(gfloat));
+
+    start_time = g_get_monotonic_time();
+    
+    for(i = 0; i < AGS_FUNCTIONAL_AUDIO_BUFFER_KERNEL_TEST_N_CYCLE; i++){
+      kernel->copy_double_to_float(float_destination, double_source, AGS_FUNCTIONAL_AUDIO_BUFFER_KERNEL_TEST_BUFFER_SIZE);
+    }
+
+    end_time = g_get_monotonic_time();
+
+    ags_functional_audio_buffer_kernel_test_report(kernel, "copy double to float",
+						   start_time, end_time,
+						   2 * sizeof(gfloat) + sizeof(gdouble));
+
+    start_time = g_get_monotonic_time();
+    
+    for(i = 0; i < AGS_FUNCTIONAL_AUDIO_BUFFER_KERNEL_TEST_N_CYCLE; i++){
+      kernel->copy_double_to_double(double_destination, double_source, AGS_FUNCTIONAL_AUDIO_BUFFER_KERNEL_TEST_BUFFER_SIZE);
+    }
+
+    end_time = g_get_monotonic_time();
+
+    ags_functional_audio_buffer_kernel_test_report(kernel, "copy double to double",
+						   start_time, end_time,
+						   3 * sizeof(gdouble));
+  }
+
+  CU_ASSERT(ags_audio_buffer_kernel_get_default() != NULL);
+}
+
+int
+main(int argc, char **argv)
+{
+  CU_pSuite pSuite = NULL;
+
+  /* initialize the CUnit test registry */
+  if(CUE_SUCCESS != CU_initialize_registry()){
+    return CU_get_error();
+  }
+
+  /* add a suite to the registry */
+  pSuite = CU_add_suite("AgsFunctionalAudioBufferKernelTest", ags_functional_audio_buffer_kernel_test_init_suite, ags_functional_audio_buffer_kernel_test_clean_suite);
+
+  if(pSuite == NULL){
+    CU_cleanup_registry();
+
+    return CU_get_error();
+  }
+
+  /* add the tests to the suite */
+  if((CU_add_test(pSuite, "test of AgsAudioBufferKernel throughput", ags_functional_audio_buffer_kernel_test_throughput) == NULL)){
+    CU_cleanup_registry();
+
+    return CU_get_error();
+  }
+
+  /* Run all tests using the CUnit Basic interface */
+  CU_basic_set_mode(CU_BRM_VERBOSE);
+  CU_basic_run_tests();
+
+  CU_cleanup_registry();
+
+  return(CU_get_error());
+}
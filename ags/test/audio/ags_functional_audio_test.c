@@ -455,6 +455,7 @@ ags_functional_audio_test_playback()
 	  
 	  audio[i]->notation = ags_notation_add(audio[i]->notation,
 						notation);
+	  audio[i]->notation_revision += 1;
 	}
 	
 	ags_notation_add_note(notation,
@@ -0,0 +1,247 @@
+/* GSequencer - Advanced GTK Sequencer
+ * Copyright (C) 2005-2026 Joël Krähemann
+ *
+ * This file is part of GSequencer.
+ *
+ * GSequencer is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GSequencer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GSequencer.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <glib.h>
+#include <glib-object.h>
+
+#include <ags/libags.h>
+#include <ags/libags-audio.h>
+
+#include <CUnit/CUnit.h>
+#include <CUnit/Automated.h>
+#include <CUnit/Basic.h>
+
+#include <stdlib.h>
+#include <stdio.h>
+
+int ags_functional_scratch_arena_test_init_suite();
+int ags_functional_scratch_arena_test_clean_suite();
+
+void ags_functional_scratch_arena_test_contention();
+
+gpointer ags_functional_scratch_arena_test_vector_256_manager_thread(gpointer data);
+gpointer ags_functional_scratch_arena_test_scratch_arena_thread(gpointer data);
+
+gint64 ags_functional_scratch_arena_test_measure(GThreadFunc thread_func);
+
+#define AGS_FUNCTIONAL_SCRATCH_ARENA_TEST_N_THREAD (8)
+#define AGS_FUNCTIONAL_SCRATCH_ARENA_TEST_N_CYCLE (200000)
+
+volatile gint start_barrier = 0;
+
+/* The suite initialization function.
+ * Opens the temporary file used by the tests.
+ * Returns zero on success, non-zero otherwise.
+ */
+int
+ags_functional_scratch_arena_test_init_suite()
+{
+  /* prefault */
+  ags_vector_256_manager_get_instance();
+  
+  return(0);
+}
+
+/* The suite cleanup function.
+ * Closes the temporary file used by the tests.
+ * Returns zero on success, non-zero otherwise.
+ */
+int
+ags_functional_scratch_arena_test_clean_suite()
+{
+  return(0);
+}
+
+gpointer
+ags_functional_scratch_arena_test_vector_256_manager_thread(gpointer data)
+{
+  AgsVector256Manager *vector_256_manager;
+  
+  AgsVectorArr *source_arr, *destination_arr;
+
+  guint i, j;
+  
+  vector_256_manager = ags_vector_256_manager_get_instance();
+
+  ags_atomic_int_decrement(&start_barrier);
+
+  while(ags_atomic_int_get(&start_barrier) > 0){
+    g_thread_yield();
+  }
+  
+  /* same pattern as ags_audio_buffer_util_copy_double_to_double() */
+  for(i = 0; i < AGS_FUNCTIONAL_SCRATCH_ARENA_TEST_N_CYCLE; i++){
+    while(!ags_vector_256_manager_try_acquire_dual(vector_256_manager,
+						   AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE,
+						   &source_arr, &destination_arr)){
+      g_thread_yield();
+    }
+
+    for(j = 0; j < 32; j++){
+      destination_arr->vector.vec_double->mem_double[j] += source_arr->vector.vec_double->mem_double[j];
+    }
+    
+    ags_vector_256_manager_release(vector_256_manager,
+				   source_arr);
+    ags_vector_256_manager_release(vector_256_manager,
+				   destination_arr);
+  }
+
+  return(GINT_TO_POINTER(TRUE));
+}
+
+gpointer
+ags_functional_scratch_arena_test_scratch_arena_thread(gpointer data)
+{
+  AgsScratchArena *scratch_arena;
+  
+  AgsVectorArr *source_arr, *destination_arr;
+
+  guint i, j;
+  gboolean success;
+  
+  scratch_arena = ags_scratch_arena_get_thread_default();
+
+  ags_atomic_int_decrement(&start_barrier);
+
+  while(ags_atomic_int_get(&start_barrier) > 0){
+    g_thread_yield();
+  }
+
+  success = TRUE;
+  
+  for(i = 0; i < AGS_FUNCTIONAL_SCRATCH_ARENA_TEST_N_CYCLE; i++){
+    if(!ags_scratch_arena_acquire_dual(scratch_arena,
+				       AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE,
+				       &source_arr, &destination_arr)){
+      success = FALSE;
+      
+      break;
+    }
+
+    for(j = 0; j < 32; j++){
+      destination_arr->vector.vec_double->mem_double[j] += source_arr->vector.vec_double->mem_double[j];
+    }
+    
+    ags_scratch_arena_release(scratch_arena,
+			      source_arr);
+    ags_scratch_arena_release(scratch_arena,
+			      destination_arr);
+  }
+
+  if(scratch_arena->in_use[AGS_VECTOR_256_DOUBLE] != 0){
+    success = FALSE;
+  }
+  
+  return(GINT_TO_POINTER(success));
+}
+
+gint64
+ags_functional_scratch_arena_test_measure(GThreadFunc thread_func)
+{
+  GThread *thread[AGS_FUNCTIONAL_SCRATCH_ARENA_TEST_N_THREAD];
+
+  gint64 start_time, end_time;
+  guint i;
+  gboolean success;
+  
+  ags_atomic_int_set(&start_barrier,
+		     AGS_FUNCTIONAL_SCRATCH_ARENA_TEST_N_THREAD);
+
+  start_time = g_get_monotonic_time();
+  
+  for(i = 0; i < AGS_FUNCTIONAL_SCRATCH_ARENA_TEST_N_THREAD; i++){
+    thread[i] = g_thread_new("scratch arena test",
+			     thread_func,
+			     NULL);
+  }
+
+  success = TRUE;
+  
+  for(i = 0; i < AGS_FUNCTIONAL_SCRATCH_ARENA_TEST_N_THREAD; i++){
+    if(!GPOINTER_TO_INT(g_thread_join(thread[i]))){
+      success = FALSE;
+    }
+  }
+
+  end_time = g_get_monotonic_time();
+
+  CU_ASSERT(success);
+  
+  return(end_time - start_time);
+}
+
+void
+ags_functional_scratch_arena_test_contention()
+{
+  gint64 vector_256_manager_duration, scratch_arena_duration;
+  
+  vector_256_manager_duration = ags_functional_scratch_arena_test_measure(ags_functional_scratch_arena_test_vector_256_manager_thread);
+  scratch_arena_duration = ags_functional_scratch_arena_test_measure(ags_functional_scratch_arena_test_scratch_arena_thread);
+
+  g_message("vector 256 manager: %u threads, %u cycles in %" G_GINT64_FORMAT " usec, %.3f usec/cycle",
+	    AGS_FUNCTIONAL_SCRATCH_ARENA_TEST_N_THREAD,
+	    AGS_FUNCTIONAL_SCRATCH_ARENA_TEST_N_CYCLE,
+	    vector_256_manager_duration,
+	    (gdouble) vector_256_manager_duration / (gdouble) AGS_FUNCTIONAL_SCRATCH_ARENA_TEST_N_CYCLE);
+
+  g_message("scratch arena: %u threads, %u cycles in %" G_GINT64_FORMAT " usec, %.3f usec/cycle, speedup %.2fx (%u processors)",
+	    AGS_FUNCTIONAL_SCRATCH_ARENA_TEST_N_THREAD,
+	    AGS_FUNCTIONAL_SCRATCH_ARENA_TEST_N_CYCLE,
+	    scratch_arena_duration,
+	    (gdouble) scratch_arena_duration / (gdouble) AGS_FUNCTIONAL_SCRATCH_ARENA_TEST_N_CYCLE,
+	    (gdouble) vector_256_manager_duration / (gdouble) MAX(scratch_arena_duration, 1),
+	    g_get_num_processors());
+}
+
+int
+main(int argc, char **argv)
+{
+  CU_pSuite pSuite = NULL;
+
+  /* initialize the CUnit test registry */
+  if(CUE_SUCCESS != CU_initialize_registry()){
+    return CU_get_error();
+  }
+
+  /* add a suite to the registry */
+  pSuite = CU_add_suite("AgsFunctionalScratchArenaTest", ags_functional_scratch_arena_test_init_suite, ags_functional_scratch_arena_test_clean_suite);
+
+  if(pSuite == NULL){
+    CU_cleanup_registry();
+
+    return CU_get_error();
+  }
+
+  /* add the tests to the suite */
+  if((CU_add_test(pSuite, "functional test of AgsScratchArena contention", ags_functional_scratch_arena_test_contention) == NULL)){
+    CU_cleanup_registry();
+
+    return CU_get_error();
+  }
+
+  /* Run all tests using the CUnit Basic interface */
+  CU_basic_set_mode(CU_BRM_VERBOSE);
+  CU_basic_run_tests();
+
+  CU_cleanup_registry();
+
+  return(CU_get_error());
+}
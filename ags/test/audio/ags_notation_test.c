@@ -35,6 +35,7 @@ int ags_notation_test_clean_suite();
 void ags_notation_test_find_near_timestamp();
 void ags_notation_test_find_near_timestamp_4800();
 void ags_notation_test_add_note();
+void ags_notation_test_add_note_all();
 void ags_notation_test_remove_note();
 void ags_notation_test_remove_note_at_position();
 void ags_notation_test_is_note_selected();
@@ -60,6 +61,10 @@ void ags_notation_test_from_raw_midi();
 #define AGS_NOTATION_TEST_ADD_NOTE_HEIGHT (88)
 #define AGS_NOTATION_TEST_ADD_NOTE_COUNT (1024)
 
+#define AGS_NOTATION_TEST_ADD_NOTE_ALL_WIDTH (1024)
+#define AGS_NOTATION_TEST_ADD_NOTE_ALL_HEIGHT (88)
+#define AGS_NOTATION_TEST_ADD_NOTE_ALL_COUNT (1024)
+
 #define AGS_NOTATION_TEST_REMOVE_NOTE_WIDTH (1024)
 #define AGS_NOTATION_TEST_REMOVE_NOTE_HEIGHT (88)
 #define AGS_NOTATION_TEST_REMOVE_NOTE_COUNT (1024)
@@ -267,6 +272,89 @@ ags_notation_test_add_note()
   CU_ASSERT(list == NULL);
 }
 
+void
+ags_notation_test_add_note_all()
+{
+  AgsNotation *notation;
+  AgsNote *note;
+
+  GList *start_note;
+  GList *list;
+  
+  guint x0, y;
+  guint i;
+  gboolean success;
+
+  /* create notation */
+  notation = ags_notation_new(audio,
+			      0);
+
+  /* existing notes */
+  for(i = 0; i < AGS_NOTATION_TEST_ADD_NOTE_ALL_COUNT; i++){
+    x0 = rand() % AGS_NOTATION_TEST_ADD_NOTE_ALL_WIDTH;
+    y = rand() % AGS_NOTATION_TEST_ADD_NOTE_ALL_HEIGHT;
+    
+    note = ags_note_new_with_offset(x0, x0 + 1,
+				    y,
+				    0.0, 0.0);
+
+    ags_notation_add_note(notation,
+			  note,
+			  FALSE);
+  }
+
+  /* add all at once, containing one already present note */
+  start_note = g_list_prepend(NULL,
+			      notation->note->data);
+  
+  for(i = 0; i < AGS_NOTATION_TEST_ADD_NOTE_ALL_COUNT; i++){
+    x0 = rand() % AGS_NOTATION_TEST_ADD_NOTE_ALL_WIDTH;
+    y = rand() % AGS_NOTATION_TEST_ADD_NOTE_ALL_HEIGHT;
+    
+    note = ags_note_new_with_offset(x0, x0 + 1,
+				    y,
+				    0.0, 0.0);
+
+    start_note = g_list_prepend(start_note,
+				note);
+  }
+
+  ags_notation_add_note_all(notation,
+			    start_note,
+			    FALSE);
+
+  CU_ASSERT(g_list_length(notation->note) == 2 * AGS_NOTATION_TEST_ADD_NOTE_ALL_COUNT);
+  
+  /* assert position */
+  list = notation->note;
+  success = TRUE;
+  
+  while(list != NULL){
+    if(list->prev != NULL){
+      if(!(AGS_NOTE(list->prev->data)->x[0] < AGS_NOTE(list->data)->x[0] ||
+	   (AGS_NOTE(list->prev->data)->x[0] == AGS_NOTE(list->data)->x[0] &&
+	    (AGS_NOTE(list->prev->data)->y <= AGS_NOTE(list->data)->y)))){
+	success = FALSE;
+
+	break;
+      }
+    }
+    
+    list = list->next;
+  }
+
+  CU_ASSERT(success == TRUE);
+
+  /* the index follows */
+  note = g_list_last(notation->note)->data;
+  
+  CU_ASSERT(ags_notation_find_point(notation,
+				    note->x[0], note->y,
+				    FALSE) != NULL);
+
+  g_list_free(start_note);
+}
+
 void
 ags_notation_test_remove_note()
 {
@@ -955,6 +1043,7 @@ main(int argc, char **argv)
   if((CU_add_test(pSuite, "test of AgsNotation find near timestamp", ags_notation_test_find_near_timestamp) == NULL) ||
      (CU_add_test(pSuite, "test of AgsNotation find near timestamp 4800", ags_notation_test_find_near_timestamp_4800) == NULL) ||
      (CU_add_test(pSuite, "test of AgsNotation add note", ags_notation_test_add_note) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsNotation add note all", ags_notation_test_add_note_all) == NULL) ||
      (CU_add_test(pSuite, "test of AgsNotation remove note", ags_notation_test_remove_note) == NULL) ||
      (CU_add_test(pSuite, "test of AgsNotation remove note at position", ags_notation_test_remove_note_at_position) == NULL) ||
      (CU_add_test(pSuite, "test of AgsNotation is note selected", ags_notation_test_is_note_selected) == NULL) ||
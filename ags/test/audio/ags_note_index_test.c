@@ -0,0 +1,383 @@
+/* GSequencer - Advanced GTK Sequencer
+ * Copyright (C) 2005-2026 Joël Krähemann
+ *
+ * This file is part of GSequencer.
+ *
+ * GSequencer is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GSequencer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GSequencer.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <glib.h>
+#include <glib-object.h>
+
+#include <ags/libags.h>
+#include <ags/libags-audio.h>
+
+#include <CUnit/CUnit.h>
+#include <CUnit/Automated.h>
+#include <CUnit/Basic.h>
+
+#include <stdlib.h>
+
+int ags_note_index_test_init_suite();
+int ags_note_index_test_clean_suite();
+
+void ags_note_index_test_rebuild();
+void ags_note_index_test_is_valid();
+void ags_note_index_test_notation_revision();
+void ags_note_index_test_lower_bound();
+void ags_note_index_test_find_point();
+
+#define AGS_NOTE_INDEX_TEST_REBUILD_COUNT (1024)
+#define AGS_NOTE_INDEX_TEST_REBUILD_WIDTH (4096)
+#define AGS_NOTE_INDEX_TEST_REBUILD_HEIGHT (88)
+
+#define AGS_NOTE_INDEX_TEST_FIND_POINT_COUNT (1024)
+#define AGS_NOTE_INDEX_TEST_FIND_POINT_WIDTH (4096)
+#define AGS_NOTE_INDEX_TEST_FIND_POINT_HEIGHT (8)
+#define AGS_NOTE_INDEX_TEST_FIND_POINT_MAX_LENGTH (64)
+
+/* The suite initialization function.
+ * Opens the temporary file used by the tests.
+ * Returns zero on success, non-zero otherwise.
+ */
+int
+ags_note_index_test_init_suite()
+{
+  return(0);
+}
+
+/* The suite cleanup function.
+ * Closes the temporary file used by the tests.
+ * Returns zero on success, non-zero otherwise.
+ */
+int
+ags_note_index_test_clean_suite()
+{
+  return(0);
+}
+
+void
+ags_note_index_test_rebuild()
+{
+  AgsNoteIndex *note_index;
+  AgsNote *note;
+
+  GList *list;
+
+  guint x0, y;
+  guint i;
+  gboolean success;
+
+  note_index = ags_note_index_alloc();
+
+  /* unsorted */
+  list = NULL;
+  
+  for(i = 0; i < AGS_NOTE_INDEX_TEST_REBUILD_COUNT; i++){
+    x0 = rand() % AGS_NOTE_INDEX_TEST_REBUILD_WIDTH;
+    y = rand() % AGS_NOTE_INDEX_TEST_REBUILD_HEIGHT;
+    
+    note = ags_note_new_with_offset(x0, x0 + 1,
+				    y,
+				    0.0, 0.0);
+
+    list = g_list_prepend(list,
+			  note);
+  }
+
+  ags_note_index_rebuild(note_index,
+			 list,
+			 1);
+
+  CU_ASSERT(note_index->length == AGS_NOTE_INDEX_TEST_REBUILD_COUNT);
+  CU_ASSERT(note_index->revision == 1);
+
+  /* assert sorted */
+  success = TRUE;
+
+  for(i = 1; i < note_index->length; i++){
+    if(!(note_index->entry[i - 1].x0_256th < note_index->entry[i].x0_256th ||
+	 (note_index->entry[i - 1].x0_256th == note_index->entry[i].x0_256th &&
+	  note_index->entry[i - 1].y <= note_index->entry[i].y))){
+      success = FALSE;
+
+      break;
+    }
+  }
+
+  CU_ASSERT(success == TRUE);
+
+  g_list_free_full(list,
+		   g_object_unref);
+
+  ags_note_index_free(note_index);
+}
+
+void
+ags_note_index_test_is_valid()
+{
+  AgsNoteIndex *note_index;
+  AgsNote *note;
+
+  GList *list;
+
+  note_index = ags_note_index_alloc();
+
+  note = ags_note_new_with_offset(0, 1,
+				  0,
+				  0.0, 0.0);
+
+  list = g_list_prepend(NULL,
+			note);
+
+  ags_note_index_rebuild(note_index,
+			 list,
+			 1);
+
+  CU_ASSERT(ags_note_index_is_valid(note_index, 1) == TRUE);
+  CU_ASSERT(ags_note_index_is_valid(note_index, 2) == FALSE);
+
+  g_list_free_full(list,
+		   g_object_unref);
+
+  ags_note_index_free(note_index);
+}
+
+void
+ags_note_index_test_notation_revision()
+{
+  AgsNotation *notation, *other_notation;
+  AgsNote *note, *other_note;
+
+  guint revision, other_revision;
+
+  notation = ags_notation_new(NULL,
+			      0);
+
+  other_notation = ags_notation_new(NULL,
+				    0);
+
+  note = ags_note_new_with_offset(0, 1,
+				  0,
+				  0.0, 0.0);
+  ags_notation_add_note(notation,
+			note,
+			FALSE);
+
+  other_note = ags_note_new_with_offset(0, 1,
+					0,
+					0.0, 0.0);
+  ags_notation_add_note(other_notation,
+			other_note,
+			FALSE);
+
+  CU_ASSERT(ags_notation_find_point(notation, 0, 0, FALSE) == note);
+  CU_ASSERT(ags_notation_find_point(other_notation, 0, 0, FALSE) == other_note);
+
+  revision = notation->note_revision;
+  other_revision = other_notation->note_revision;
+
+  /* geometry changed, only the owning notation is invalidated */
+  ags_note_set_x1(note,
+		  16);
+
+  CU_ASSERT(notation->note_revision != revision);
+  CU_ASSERT(other_notation->note_revision == other_revision);
+
+  CU_ASSERT(ags_note_index_is_valid(notation->note_index, notation->note_revision) == FALSE);
+  CU_ASSERT(ags_note_index_is_valid(other_notation->note_index, other_notation->note_revision) == TRUE);
+
+  /* the rebuilt index finds the tail */
+  CU_ASSERT(ags_notation_find_point(notation, 8, 0, FALSE) == note);
+  CU_ASSERT(notation->note_index->entry[0].x1 == 16);
+
+  /* a removed note doesn't invalidate anymore */
+  ags_notation_remove_note(other_notation,
+			   other_note,
+			   FALSE);
+
+  CU_ASSERT(other_note->notation == NULL);
+
+  other_revision = other_notation->note_revision;
+
+  ags_note_set_x1(other_note,
+		  16);
+  
+  CU_ASSERT(other_notation->note_revision == other_revision);
+
+  g_object_unref(other_note);
+  
+  g_object_unref(notation);
+  g_object_unref(other_notation);
+
+  g_object_unref(note);
+}
+
+void
+ags_note_index_test_lower_bound()
+{
+  AgsNoteIndex *note_index;
+  AgsNote *note;
+
+  GList *list;
+
+  guint i;
+
+  note_index = ags_note_index_alloc();
+
+  /* x0 = 0, 2, 4, ... */
+  list = NULL;
+  
+  for(i = 0; i < 16; i++){
+    note = ags_note_new_with_offset(2 * i, 2 * i + 1,
+				    0,
+				    0.0, 0.0);
+
+    list = g_list_prepend(list,
+			  note);
+  }
+
+  list = g_list_reverse(list);
+
+  ags_note_index_rebuild(note_index,
+			 list,
+			 1);
+
+  CU_ASSERT(ags_note_index_lower_bound(note_index, 0) == 0);
+  CU_ASSERT(ags_note_index_lower_bound(note_index, 3) == 2);
+  CU_ASSERT(ags_note_index_lower_bound(note_index, 4) == 2);
+  CU_ASSERT(ags_note_index_lower_bound(note_index, 31) == 16);
+
+  CU_ASSERT(ags_note_index_lower_bound_256th(note_index, 16 * 4) == 2);
+  CU_ASSERT(ags_note_index_lower_bound_256th(note_index, 16 * 4 + 1) == 3);
+
+  g_list_free_full(list,
+		   g_object_unref);
+
+  ags_note_index_free(note_index);
+}
+
+void
+ags_note_index_test_find_point()
+{
+  AgsNoteIndex *note_index;
+  AgsNote *note;
+  AgsNote *expected, *current;
+
+  GList *list, *iter;
+
+  guint x0, x1, y;
+  guint x;
+  guint i;
+  gboolean success;
+
+  note_index = ags_note_index_alloc();
+
+  list = NULL;
+  
+  for(i = 0; i < AGS_NOTE_INDEX_TEST_FIND_POINT_COUNT; i++){
+    x0 = rand() % AGS_NOTE_INDEX_TEST_FIND_POINT_WIDTH;
+    x1 = x0 + 1 + (rand() % AGS_NOTE_INDEX_TEST_FIND_POINT_MAX_LENGTH);
+    y = rand() % AGS_NOTE_INDEX_TEST_FIND_POINT_HEIGHT;
+    
+    note = ags_note_new_with_offset(x0, x1,
+				    y,
+				    0.0, 0.0);
+
+    list = g_list_insert_sorted(list,
+				note,
+				(GCompareFunc) ags_note_sort_func);
+  }
+
+  ags_note_index_rebuild(note_index,
+			 list,
+			 1);
+
+  /* compare with linear search */
+  success = TRUE;
+  
+  for(x = 0; x < AGS_NOTE_INDEX_TEST_FIND_POINT_WIDTH && success; x += 7){
+    for(y = 0; y < AGS_NOTE_INDEX_TEST_FIND_POINT_HEIGHT; y++){
+      expected = NULL;
+      
+      for(iter = list; iter != NULL; iter = iter->next){
+	current = iter->data;
+	
+	if(current->x[0] > x){
+	  break;
+	}
+	
+	if(x < current->x[1] &&
+	   current->y == y){
+	  expected = current;
+
+	  break;
+	}
+      }
+
+      if(ags_note_index_find_point(note_index, x, y) != expected){
+	success = FALSE;
+
+	break;
+      }
+    }
+  }
+
+  CU_ASSERT(success == TRUE);
+
+  g_list_free_full(list,
+		   g_object_unref);
+
+  ags_note_index_free(note_index);
+}
+
+int
+main(int argc, char **argv)
+{
+  CU_pSuite pSuite = NULL;
+
+  /* initialize the CUnit test registry */
+  if(CUE_SUCCESS != CU_initialize_registry()){
+    return CU_get_error();
+  }
+
+  /* add a suite to the registry */
+  pSuite = CU_add_suite("AgsNoteIndexTest", ags_note_index_test_init_suite, ags_note_index_test_clean_suite);
+
+  if(pSuite == NULL){
+    CU_cleanup_registry();
+
+    return CU_get_error();
+  }
+
+  /* add the tests to the suite */
+  if((CU_add_test(pSuite, "test of AgsNoteIndex rebuild", ags_note_index_test_rebuild) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsNoteIndex is valid", ags_note_index_test_is_valid) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsNoteIndex notation revision", ags_note_index_test_notation_revision) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsNoteIndex lower bound", ags_note_index_test_lower_bound) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsNoteIndex find point", ags_note_index_test_find_point) == NULL)){
+    CU_cleanup_registry();
+
+    return CU_get_error();
+  }
+
+  /* Run all tests using the CUnit Basic interface */
+  CU_basic_set_mode(CU_BRM_VERBOSE);
+  CU_basic_run_tests();
+
+  CU_cleanup_registry();
+
+  return(CU_get_error());
+}
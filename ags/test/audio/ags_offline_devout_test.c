@@ -0,0 +1,337 @@
+/* GSequencer - Advanced GTK Sequencer
+ * Copyright (C) 2005-2026 Joël Krähemann
+ *
+ * This file is part of GSequencer.
+ *
+ * GSequencer is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GSequencer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GSequencer.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <glib.h>
+#include <glib-object.h>
+
+#include <CUnit/CUnit.h>
+#include <CUnit/Automated.h>
+#include <CUnit/Basic.h>
+
+#include <ags/libags.h>
+#include <ags/libags-audio.h>
+
+#include <string.h>
+
+int ags_offline_devout_test_init_suite();
+int ags_offline_devout_test_clean_suite();
+
+void ags_offline_devout_test_get_device();
+void ags_offline_devout_test_list_cards();
+void ags_offline_devout_test_play_init();
+void ags_offline_devout_test_play();
+void ags_offline_devout_test_play_free_run();
+void ags_offline_devout_test_stop();
+
+#define AGS_OFFLINE_DEVOUT_TEST_PLAY_SAMPLERATE (44100)
+#define AGS_OFFLINE_DEVOUT_TEST_PLAY_BUFFER_SIZE (4410)
+#define AGS_OFFLINE_DEVOUT_TEST_PLAY_N_PERIOD (8)
+
+AgsAudioApplicationContext *audio_application_context;
+
+/* The suite initialization function.
+ * Opens the temporary file used by the tests.
+ * Returns zero on success, non-zero otherwise.
+ */
+int
+ags_offline_devout_test_init_suite()
+{
+  AgsTaskLauncher *task_launcher;
+  
+  audio_application_context = ags_audio_application_context_new();
+  g_object_ref(audio_application_context);
+
+  task_launcher = ags_task_launcher_new();
+  ags_concurrency_provider_set_task_launcher(AGS_CONCURRENCY_PROVIDER(audio_application_context),
+					     task_launcher);
+  
+  return(0);
+}
+
+/* The suite cleanup function.
+ * Closes the temporary file used by the tests.
+ * Returns zero on success, non-zero otherwise.
+ */
+int
+ags_offline_devout_test_clean_suite()
+{
+  g_object_unref(audio_application_context);
+  
+  return(0);
+}
+
+void
+ags_offline_devout_test_get_device()
+{
+  AgsOfflineDevout *offline_devout;
+
+  gchar *device;
+  
+  offline_devout = ags_offline_devout_new();
+
+  device = ags_soundcard_get_device(AGS_SOUNDCARD(offline_devout));
+
+  CU_ASSERT(device != NULL &&
+	    !g_strcmp0(device,
+		       AGS_OFFLINE_DEVOUT_DEFAULT_DEVICE));
+
+  g_free(device);
+
+  g_object_unref(offline_devout);
+}
+
+void
+ags_offline_devout_test_list_cards()
+{
+  AgsOfflineDevout *offline_devout;
+
+  GList *card_id, *card_name;
+  
+  offline_devout = ags_offline_devout_new();
+
+  card_id = NULL;
+  card_name = NULL;
+  
+  ags_soundcard_list_cards(AGS_SOUNDCARD(offline_devout),
+			   &card_id, &card_name);
+
+  CU_ASSERT(g_list_length(card_id) == 1);
+  CU_ASSERT(g_list_length(card_name) == 1);
+  CU_ASSERT(card_id != NULL &&
+	    !g_strcmp0(card_id->data,
+		       AGS_OFFLINE_DEVOUT_DEFAULT_DEVICE));
+
+  g_list_free_full(card_id,
+		   g_free);
+  g_list_free_full(card_name,
+		   g_free);
+
+  g_object_unref(offline_devout);
+}
+
+void
+ags_offline_devout_test_play_init()
+{
+  AgsOfflineDevout *offline_devout;
+
+  GError *error;
+  
+  offline_devout = ags_offline_devout_new();
+
+  error = NULL;
+  ags_soundcard_play_init(AGS_SOUNDCARD(offline_devout),
+			  &error);
+
+  CU_ASSERT(error == NULL);
+  CU_ASSERT(ags_offline_devout_test_flags(offline_devout, AGS_OFFLINE_DEVOUT_INITIALIZED));
+  CU_ASSERT(ags_soundcard_is_starting(AGS_SOUNDCARD(offline_devout)));
+  CU_ASSERT(ags_soundcard_is_playing(AGS_SOUNDCARD(offline_devout)));
+  CU_ASSERT(ags_soundcard_is_available(AGS_SOUNDCARD(offline_devout)));
+
+  ags_soundcard_stop(AGS_SOUNDCARD(offline_devout));
+
+  g_object_unref(offline_devout);
+
+  /* floating point formats */
+  offline_devout = ags_offline_devout_new();
+  g_object_set(offline_devout,
+	       "format", AGS_SOUNDCARD_FLOAT,
+	       NULL);
+
+  error = NULL;
+  ags_soundcard_play_init(AGS_SOUNDCARD(offline_devout),
+			  &error);
+
+  CU_ASSERT(error == NULL);
+  CU_ASSERT(ags_offline_devout_test_flags(offline_devout, AGS_OFFLINE_DEVOUT_INITIALIZED));
+
+  ags_soundcard_stop(AGS_SOUNDCARD(offline_devout));
+
+  g_object_unref(offline_devout);
+
+  offline_devout = ags_offline_devout_new();
+  g_object_set(offline_devout,
+	       "format", AGS_SOUNDCARD_DOUBLE,
+	       NULL);
+
+  error = NULL;
+  ags_soundcard_play_init(AGS_SOUNDCARD(offline_devout),
+			  &error);
+
+  CU_ASSERT(error == NULL);
+  CU_ASSERT(ags_offline_devout_test_flags(offline_devout, AGS_OFFLINE_DEVOUT_INITIALIZED));
+
+  ags_soundcard_stop(AGS_SOUNDCARD(offline_devout));
+
+  g_object_unref(offline_devout);
+}
+
+void
+ags_offline_devout_test_play()
+{
+  AgsOfflineDevout *offline_devout;
+
+  GError *error;
+
+  gint64 start_time, elapsed_time;
+  gint64 period_time;
+  guint i;
+  
+  offline_devout = ags_offline_devout_new();
+
+  ags_soundcard_set_presets(AGS_SOUNDCARD(offline_devout),
+			    2,
+			    AGS_OFFLINE_DEVOUT_TEST_PLAY_SAMPLERATE,
+			    AGS_OFFLINE_DEVOUT_TEST_PLAY_BUFFER_SIZE,
+			    AGS_SOUNDCARD_SIGNED_16_BIT);
+  
+  error = NULL;
+  ags_soundcard_play_init(AGS_SOUNDCARD(offline_devout),
+			  &error);
+
+  /* paced to wall clock */
+  period_time = G_USEC_PER_SEC * AGS_OFFLINE_DEVOUT_TEST_PLAY_BUFFER_SIZE / AGS_OFFLINE_DEVOUT_TEST_PLAY_SAMPLERATE;
+  
+  start_time = g_get_monotonic_time();
+  
+  for(i = 0; i < AGS_OFFLINE_DEVOUT_TEST_PLAY_N_PERIOD + 1; i++){
+    error = NULL;
+    ags_soundcard_play(AGS_SOUNDCARD(offline_devout),
+		       &error);
+  }
+
+  elapsed_time = g_get_monotonic_time() - start_time;
+  
+  CU_ASSERT(!ags_soundcard_is_starting(AGS_SOUNDCARD(offline_devout)));
+  CU_ASSERT(elapsed_time >= AGS_OFFLINE_DEVOUT_TEST_PLAY_N_PERIOD * period_time);
+
+  ags_soundcard_stop(AGS_SOUNDCARD(offline_devout));
+
+  g_object_unref(offline_devout);
+}
+
+void
+ags_offline_devout_test_play_free_run()
+{
+  AgsOfflineDevout *offline_devout;
+
+  GError *error;
+
+  gint64 start_time, elapsed_time;
+  gint64 period_time;
+  guint i;
+  
+  offline_devout = ags_offline_devout_new();
+
+  ags_soundcard_set_presets(AGS_SOUNDCARD(offline_devout),
+			    2,
+			    AGS_OFFLINE_DEVOUT_TEST_PLAY_SAMPLERATE,
+			    AGS_OFFLINE_DEVOUT_TEST_PLAY_BUFFER_SIZE,
+			    AGS_SOUNDCARD_SIGNED_16_BIT);
+
+  ags_offline_devout_set_flags(offline_devout,
+			       AGS_OFFLINE_DEVOUT_FREE_RUN);
+  
+  error = NULL;
+  ags_soundcard_play_init(AGS_SOUNDCARD(offline_devout),
+			  &error);
+
+  /* not paced */
+  period_time = G_USEC_PER_SEC * AGS_OFFLINE_DEVOUT_TEST_PLAY_BUFFER_SIZE / AGS_OFFLINE_DEVOUT_TEST_PLAY_SAMPLERATE;
+  
+  start_time = g_get_monotonic_time();
+  
+  for(i = 0; i < AGS_OFFLINE_DEVOUT_TEST_PLAY_N_PERIOD + 1; i++){
+    error = NULL;
+    ags_soundcard_play(AGS_SOUNDCARD(offline_devout),
+		       &error);
+
+    CU_ASSERT(ags_soundcard_is_available(AGS_SOUNDCARD(offline_devout)));
+  }
+
+  elapsed_time = g_get_monotonic_time() - start_time;
+  
+  CU_ASSERT(elapsed_time < AGS_OFFLINE_DEVOUT_TEST_PLAY_N_PERIOD * period_time);
+
+  ags_soundcard_stop(AGS_SOUNDCARD(offline_devout));
+
+  g_object_unref(offline_devout);
+}
+
+void
+ags_offline_devout_test_stop()
+{
+  AgsOfflineDevout *offline_devout;
+
+  GError *error;
+  
+  offline_devout = ags_offline_devout_new();
+
+  error = NULL;
+  ags_soundcard_play_init(AGS_SOUNDCARD(offline_devout),
+			  &error);
+
+  ags_soundcard_stop(AGS_SOUNDCARD(offline_devout));
+
+  CU_ASSERT(!ags_offline_devout_test_flags(offline_devout, AGS_OFFLINE_DEVOUT_INITIALIZED));
+  CU_ASSERT(!ags_soundcard_is_playing(AGS_SOUNDCARD(offline_devout)));
+  CU_ASSERT(offline_devout->app_buffer_mode == AGS_OFFLINE_DEVOUT_APP_BUFFER_0);
+
+  g_object_unref(offline_devout);
+}
+
+int
+main(int argc, char **argv)
+{
+  CU_pSuite pSuite = NULL;
+
+  /* initialize the CUnit test registry */
+  if(CUE_SUCCESS != CU_initialize_registry()){
+    return CU_get_error();
+  }
+
+  /* add a suite to the registry */
+  pSuite = CU_add_suite("AgsOfflineDevoutTest", ags_offline_devout_test_init_suite, ags_offline_devout_test_clean_suite);
+  
+  if(pSuite == NULL){
+    CU_cleanup_registry();
+    
+    return CU_get_error();
+  }
+
+  /* add the tests to the suite */
+  if((CU_add_test(pSuite, "test of AgsOfflineDevout get device", ags_offline_devout_test_get_device) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsOfflineDevout list cards", ags_offline_devout_test_list_cards) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsOfflineDevout play init", ags_offline_devout_test_play_init) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsOfflineDevout play", ags_offline_devout_test_play) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsOfflineDevout play free run", ags_offline_devout_test_play_free_run) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsOfflineDevout stop", ags_offline_devout_test_stop) == NULL)){
+    CU_cleanup_registry();
+      
+    return CU_get_error();
+  }
+  
+  /* Run all tests using the CUnit Basic interface */
+  CU_basic_set_mode(CU_BRM_VERBOSE);
+  CU_basic_run_tests();
+  
+  CU_cleanup_registry();
+  
+  return(CU_get_error());
+}
@@ -0,0 +1,369 @@
+/* GSequencer - Advanced GTK Sequencer
+ * Copyright (C) 2005-2026 Joël Krähemann
+ *
+ * This file is part of GSequencer.
+ *
+ * GSequencer is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GSequencer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GSequencer.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <glib.h>
+#include <glib-object.h>
+
+#include <ags/libags.h>
+#include <ags/libags-audio.h>
+
+#include <CUnit/CUnit.h>
+#include <CUnit/Automated.h>
+#include <CUnit/Basic.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+int ags_recall_profiler_test_init_suite();
+int ags_recall_profiler_test_clean_suite();
+
+void ags_recall_profiler_test_find_entry();
+void ags_recall_profiler_test_tic();
+void ags_recall_profiler_test_clear();
+void ags_recall_profiler_test_dump();
+void ags_recall_profiler_test_staging_omit_event();
+
+#define AGS_RECALL_PROFILER_TEST_TIC_COUNT (100)
+#define AGS_RECALL_PROFILER_TEST_TIC_DURATION (1000)
+#define AGS_RECALL_PROFILER_TEST_TIC_PEAK_DURATION (100000)
+#define AGS_RECALL_PROFILER_TEST_DEADLINE (10000)
+
+AgsAudio *audio;
+
+/* The suite initialization function.
+ * Opens the temporary file used by the tests.
+ * Returns zero on success, non-zero otherwise.
+ */
+int
+ags_recall_profiler_test_init_suite()
+{
+  audio = ags_audio_new(NULL);
+  g_object_ref(audio);
+
+  ags_audio_set_audio_name(audio,
+			   "test-audio");
+  
+  return(0);
+}
+
+/* The suite cleanup function.
+ * Closes the temporary file used by the tests.
+ * Returns zero on success, non-zero otherwise.
+ */
+int
+ags_recall_profiler_test_clean_suite()
+{
+  g_object_unref(audio);
+  
+  return(0);
+}
+
+void
+ags_recall_profiler_test_find_entry()
+{
+  AgsChannel *output;
+  AgsRecall *recall_audio;
+  AgsRecall *recall_channel;
+  AgsRecall *child;
+  AgsRecallProfiler *recall_profiler;
+  AgsRecallProfilerEntry *entry;
+
+  recall_profiler = ags_recall_profiler_new();
+
+  /* audio scope */
+  recall_audio = (AgsRecall *) ags_recall_audio_new(audio);
+
+  entry = ags_recall_profiler_find_entry(recall_profiler,
+					 recall_audio);
+
+  CU_ASSERT(entry != NULL);
+  CU_ASSERT(entry->audio == (gpointer) audio);
+  CU_ASSERT(entry->channel == NULL);
+  CU_ASSERT(entry->line == -1);
+  CU_ASSERT(!g_strcmp0(entry->audio_name, "test-audio"));
+  CU_ASSERT(!g_strcmp0(entry->effect, "AgsRecallAudio"));
+
+  /* child accounts to its parent */
+  child = ags_recall_new();
+  child->parent = recall_audio;
+  
+  CU_ASSERT(ags_recall_profiler_find_entry(recall_profiler,
+					   child) == entry);
+
+  child->parent = NULL;
+  
+  /* channel scope */
+  output = (AgsChannel *) ags_output_new((GObject *) audio);
+  output->line = 1;
+  
+  recall_channel = (AgsRecall *) ags_recall_channel_new();
+  AGS_RECALL_CHANNEL(recall_channel)->source = output;
+
+  entry = ags_recall_profiler_find_entry(recall_profiler,
+					 recall_channel);
+
+  CU_ASSERT(entry != NULL);
+  CU_ASSERT(entry->audio == (gpointer) audio);
+  CU_ASSERT(entry->channel == (gpointer) output);
+  CU_ASSERT(entry->line == 1);
+  CU_ASSERT(entry->is_output == TRUE);
+  
+  CU_ASSERT(g_list_length(recall_profiler->entry) == 2);
+
+  AGS_RECALL_CHANNEL(recall_channel)->source = NULL;
+  
+  g_object_unref(recall_profiler);
+}
+
+void
+ags_recall_profiler_test_tic()
+{
+  AgsRecall *recall_audio;
+  AgsRecallProfiler *recall_profiler;
+  AgsRecallProfilerEntry *entry;
+
+  gdouble mean;
+  gint64 p99, max;
+  gdouble deadline_ratio;
+  guint i;
+  
+  recall_profiler = ags_recall_profiler_new();
+
+  recall_audio = (AgsRecall *) ags_recall_audio_new(audio);
+
+  for(i = 0; i < AGS_RECALL_PROFILER_TEST_TIC_COUNT; i++){
+    /* run-pre and run-inter of the same tic are summed up */
+    ags_recall_profiler_add(recall_profiler,
+			    recall_audio,
+			    AGS_RECALL_PROFILER_TEST_TIC_DURATION / 2);
+    ags_recall_profiler_add(recall_profiler,
+			    recall_audio,
+			    AGS_RECALL_PROFILER_TEST_TIC_DURATION / 2);
+
+    ags_recall_profiler_tic(recall_profiler,
+			    AGS_RECALL_PROFILER_TEST_DEADLINE);
+  }
+
+  entry = recall_audio->profiler_entry;
+
+  CU_ASSERT(entry != NULL);
+  CU_ASSERT(entry->sample_count == AGS_RECALL_PROFILER_TEST_TIC_COUNT);
+  CU_ASSERT(entry->current == 0);
+  
+  ags_recall_profiler_entry_get_stats(recall_profiler,
+				      entry,
+				      &mean, &p99, &max,
+				      &deadline_ratio);
+
+  CU_ASSERT(mean == (gdouble) AGS_RECALL_PROFILER_TEST_TIC_DURATION);
+  CU_ASSERT(p99 == AGS_RECALL_PROFILER_TEST_TIC_DURATION);
+  CU_ASSERT(max == AGS_RECALL_PROFILER_TEST_TIC_DURATION);
+  CU_ASSERT(deadline_ratio == 0.1);
+
+  /* single peak */
+  ags_recall_profiler_add(recall_profiler,
+			  recall_audio,
+			  AGS_RECALL_PROFILER_TEST_TIC_PEAK_DURATION);
+  
+  ags_recall_profiler_tic(recall_profiler,
+			  AGS_RECALL_PROFILER_TEST_DEADLINE);
+
+  ags_recall_profiler_entry_get_stats(recall_profiler,
+				      entry,
+				      NULL, &p99, &max,
+				      NULL);
+
+  CU_ASSERT(p99 == AGS_RECALL_PROFILER_TEST_TIC_DURATION);
+  CU_ASSERT(max == AGS_RECALL_PROFILER_TEST_TIC_PEAK_DURATION);
+
+  /* the maximum is rolling - the peak leaves the window */
+  for(i = 0; i < entry->window_size; i++){
+    ags_recall_profiler_add(recall_profiler,
+			    recall_audio,
+			    AGS_RECALL_PROFILER_TEST_TIC_DURATION);
+    
+    ags_recall_profiler_tic(recall_profiler,
+			    AGS_RECALL_PROFILER_TEST_DEADLINE);
+  }
+
+  ags_recall_profiler_entry_get_stats(recall_profiler,
+				      entry,
+				      NULL, NULL, &max,
+				      NULL);
+
+  CU_ASSERT(max == AGS_RECALL_PROFILER_TEST_TIC_DURATION);
+  
+  recall_audio->profiler_entry = NULL;
+  
+  g_object_unref(recall_profiler);
+}
+
+void
+ags_recall_profiler_test_clear()
+{
+  AgsRecall *recall_audio;
+  AgsRecallProfiler *recall_profiler;
+  AgsRecallProfilerEntry *entry;
+
+  gdouble mean;
+  gint64 max;
+  
+  recall_profiler = ags_recall_profiler_new();
+
+  recall_audio = (AgsRecall *) ags_recall_audio_new(audio);
+
+  ags_recall_profiler_add(recall_profiler,
+			  recall_audio,
+			  AGS_RECALL_PROFILER_TEST_TIC_DURATION);
+  
+  ags_recall_profiler_tic(recall_profiler,
+			  AGS_RECALL_PROFILER_TEST_DEADLINE);
+
+  ags_recall_profiler_clear(recall_profiler);
+
+  entry = recall_audio->profiler_entry;
+
+  CU_ASSERT(g_list_find(recall_profiler->entry, entry) != NULL);
+  CU_ASSERT(entry->sample_count == 0);
+  
+  ags_recall_profiler_entry_get_stats(recall_profiler,
+				      entry,
+				      &mean, NULL, &max,
+				      NULL);
+
+  CU_ASSERT(mean == 0.0);
+  CU_ASSERT(max == 0);
+
+  recall_audio->profiler_entry = NULL;
+  
+  g_object_unref(recall_profiler);
+}
+
+void
+ags_recall_profiler_test_dump()
+{
+  AgsRecall *recall_audio;
+  AgsRecallProfiler *recall_profiler;
+
+  gchar *dump;
+  
+  recall_profiler = ags_recall_profiler_new();
+
+  recall_audio = (AgsRecall *) ags_recall_audio_new(audio);
+
+  ags_recall_profiler_add(recall_profiler,
+			  recall_audio,
+			  AGS_RECALL_PROFILER_TEST_TIC_DURATION);
+  
+  ags_recall_profiler_tic(recall_profiler,
+			  AGS_RECALL_PROFILER_TEST_DEADLINE);
+
+  dump = ags_recall_profiler_dump(recall_profiler);
+
+  CU_ASSERT(dump != NULL);
+  CU_ASSERT(strstr(dump, "test-audio") != NULL);
+  CU_ASSERT(strstr(dump, "AgsRecallAudio") != NULL);
+
+  g_free(dump);
+  
+  recall_audio->profiler_entry = NULL;
+  
+  g_object_unref(recall_profiler);
+}
+
+void
+ags_recall_profiler_test_staging_omit_event()
+{
+  AgsRecall *recall_audio;
+  AgsRecallProfiler *recall_profiler;
+  AgsRecallProfilerEntry *entry;
+
+  gboolean omit_event;
+  
+  recall_profiler = ags_recall_profiler_get_instance();
+
+  ags_recall_profiler_clear(recall_profiler);
+  
+  omit_event = ags_recall_global_get_omit_event();
+  
+  ags_recall_global_set_omit_event(TRUE);
+  ags_recall_profiler_set_enabled(TRUE);
+
+  /* staging calls the class' run stages directly */
+  recall_audio = (AgsRecall *) ags_recall_audio_new(audio);
+  g_object_ref(recall_audio);
+  
+  ags_recall_set_staging_flags(recall_audio,
+			       (AGS_SOUND_STAGING_RUN_PRE |
+				AGS_SOUND_STAGING_RUN_INTER |
+				AGS_SOUND_STAGING_RUN_POST));
+
+  ags_recall_profiler_tic(recall_profiler,
+			  AGS_RECALL_PROFILER_TEST_DEADLINE);
+
+  entry = recall_audio->profiler_entry;
+  
+  CU_ASSERT(entry != NULL);
+  CU_ASSERT(g_list_find(recall_profiler->entry, entry) != NULL);
+  CU_ASSERT(entry != NULL && entry->sample_count == 1);
+  
+  ags_recall_profiler_set_enabled(FALSE);
+  ags_recall_global_set_omit_event(omit_event);
+
+  g_object_unref(recall_audio);
+}
+
+int
+main(int argc, char **argv)
+{
+  CU_pSuite pSuite = NULL;
+
+  /* initialize the CUnit test registry */
+  if(CUE_SUCCESS != CU_initialize_registry()){
+    return CU_get_error();
+  }
+
+  /* add a suite to the registry */
+  pSuite = CU_add_suite("AgsRecallProfilerTest", ags_recall_profiler_test_init_suite, ags_recall_profiler_test_clean_suite);
+
+  if(pSuite == NULL){
+    CU_cleanup_registry();
+
+    return CU_get_error();
+  }
+
+  /* add the tests to the suite */
+  if((CU_add_test(pSuite, "test of AgsRecallProfiler find entry", ags_recall_profiler_test_find_entry) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsRecallProfiler tic", ags_recall_profiler_test_tic) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsRecallProfiler clear", ags_recall_profiler_test_clear) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsRecallProfiler dump", ags_recall_profiler_test_dump) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsRecallProfiler staging omit event", ags_recall_profiler_test_staging_omit_event) == NULL)){
+    CU_cleanup_registry();
+
+    return CU_get_error();
+  }
+
+  /* Run all tests using the CUnit Basic interface */
+  CU_basic_set_mode(CU_BRM_VERBOSE);
+  CU_basic_run_tests();
+
+  CU_cleanup_registry();
+
+  return(CU_get_error());
+}
@@ -0,0 +1,428 @@
+/* GSequencer - Advanced GTK Sequencer
+ * Copyright (C) 2005-2026 Joël Krähemann
+ *
+ * This file is part of GSequencer.
+ *
+ * GSequencer is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GSequencer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GSequencer.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <glib.h>
+#include <glib-object.h>
+
+#include <ags/libags.h>
+#include <ags/libags-audio.h>
+
+#include <CUnit/CUnit.h>
+#include <CUnit/Automated.h>
+#include <CUnit/Basic.h>
+
+#include <stdlib.h>
+
+int ags_recall_snapshot_test_init_suite();
+int ags_recall_snapshot_test_clean_suite();
+
+void ags_recall_snapshot_test_alloc();
+void ags_recall_snapshot_test_staging_mask();
+void ags_recall_snapshot_test_find_recycling_context();
+void ags_recall_snapshot_test_slot_publish();
+void ags_recall_snapshot_test_slot_release();
+void ags_recall_snapshot_test_slot_retired();
+
+#define AGS_RECALL_SNAPSHOT_TEST_ALLOC_N_RECALL (16)
+
+#define AGS_RECALL_SNAPSHOT_TEST_FIND_RECYCLING_CONTEXT_N_RECALL (16)
+
+#define AGS_RECALL_SNAPSHOT_TEST_SLOT_RETIRED_PUBLISH_COUNT (64)
+
+/* The suite initialization function.
+ * Opens the temporary file used by the tests.
+ * Returns zero on success, non-zero otherwise.
+ */
+int
+ags_recall_snapshot_test_init_suite()
+{
+  return(0);
+}
+
+/* The suite cleanup function.
+ * Closes the temporary file used by the tests.
+ * Returns zero on success, non-zero otherwise.
+ */
+int
+ags_recall_snapshot_test_clean_suite()
+{
+  return(0);
+}
+
+void
+ags_recall_snapshot_test_alloc()
+{
+  AgsRecall *recall[AGS_RECALL_SNAPSHOT_TEST_ALLOC_N_RECALL];
+  AgsRecallSnapshot *snapshot;
+
+  GList *list;
+
+  guint i;
+  gboolean success;
+
+  list = NULL;
+
+  for(i = 0; i < AGS_RECALL_SNAPSHOT_TEST_ALLOC_N_RECALL; i++){
+    recall[i] = ags_recall_new();
+
+    list = g_list_prepend(list,
+			  recall[i]);
+  }
+
+  snapshot = ags_recall_snapshot_alloc(list,
+				       1);
+
+  CU_ASSERT(snapshot != NULL);
+  CU_ASSERT(snapshot->version == 1);
+  CU_ASSERT(snapshot->length == AGS_RECALL_SNAPSHOT_TEST_ALLOC_N_RECALL);
+
+  /* reversed order of list and referenced */
+  success = TRUE;
+
+  for(i = 0; i < AGS_RECALL_SNAPSHOT_TEST_ALLOC_N_RECALL; i++){
+    if(snapshot->recall[i] != recall[i] ||
+       G_OBJECT(recall[i])->ref_count != 2){
+      success = FALSE;
+
+      break;
+    }
+  }
+
+  CU_ASSERT(success);
+
+  ags_recall_snapshot_free(snapshot);
+
+  success = TRUE;
+
+  for(i = 0; i < AGS_RECALL_SNAPSHOT_TEST_ALLOC_N_RECALL; i++){
+    if(G_OBJECT(recall[i])->ref_count != 1){
+      success = FALSE;
+
+      break;
+    }
+  }
+
+  CU_ASSERT(success);
+
+  g_list_free_full(list,
+		   g_object_unref);
+}
+
+void
+ags_recall_snapshot_test_staging_mask()
+{
+  AgsRecall *recall, *fx_recall;
+  AgsRecallSnapshot *snapshot;
+
+  GList *list;
+
+  recall = ags_recall_new();
+  fx_recall = g_object_new(AGS_TYPE_FX_ANALYSE_AUDIO_SIGNAL,
+			   NULL);
+  
+  /* the base class implements no stage */
+  CU_ASSERT(ags_recall_snapshot_get_recall_staging_mask(recall) == 0);
+  CU_ASSERT((AGS_SOUND_STAGING_RUN_INTER & ags_recall_snapshot_get_recall_staging_mask(fx_recall)) != 0);
+
+  list = g_list_prepend(NULL,
+			recall);
+
+  snapshot = ags_recall_snapshot_alloc(list,
+				       1);
+
+  CU_ASSERT(snapshot->staging_mask == 0);
+
+  ags_recall_snapshot_free(snapshot);
+
+  /* computed once as allocated */
+  list = g_list_prepend(list,
+			fx_recall);
+
+  snapshot = ags_recall_snapshot_alloc(list,
+				       2);
+
+  CU_ASSERT((AGS_SOUND_STAGING_RUN_INTER & snapshot->staging_mask) != 0);
+  CU_ASSERT((~AGS_RECALL_SNAPSHOT_RUN_STAGING_MASK & snapshot->staging_mask) == 0);
+
+  ags_recall_snapshot_free(snapshot);
+
+  g_list_free_full(list,
+		   g_object_unref);
+}
+
+void
+ags_recall_snapshot_test_find_recycling_context()
+{
+  AgsRecall *recall[AGS_RECALL_SNAPSHOT_TEST_FIND_RECYCLING_CONTEXT_N_RECALL];
+  AgsRecallID *recall_id[AGS_RECALL_SNAPSHOT_TEST_FIND_RECYCLING_CONTEXT_N_RECALL];
+  AgsRecyclingContext *recycling_context[AGS_RECALL_SNAPSHOT_TEST_FIND_RECYCLING_CONTEXT_N_RECALL];
+  AgsRecallSnapshot *snapshot;
+
+  GList *list;
+
+  guint i;
+  gboolean success;
+
+  list = NULL;
+
+  for(i = 0; i < AGS_RECALL_SNAPSHOT_TEST_FIND_RECYCLING_CONTEXT_N_RECALL; i++){
+    recycling_context[i] = ags_recycling_context_new(0);
+
+    recall_id[i] = ags_recall_id_new();
+    g_object_set(recall_id[i],
+		 "recycling-context", recycling_context[i],
+		 NULL);
+
+    recall[i] = ags_recall_new();
+    g_object_set(recall[i],
+		 "recall-id", recall_id[i],
+		 NULL);
+
+    list = g_list_prepend(list,
+			  recall[i]);
+  }
+
+  snapshot = ags_recall_snapshot_alloc(list,
+				       1);
+
+  /* test */
+  success = TRUE;
+
+  for(i = 0; i < AGS_RECALL_SNAPSHOT_TEST_FIND_RECYCLING_CONTEXT_N_RECALL; i++){
+    if(ags_recall_snapshot_find_recycling_context(snapshot, 0,
+						  (GObject *) recycling_context[i]) != i){
+      success = FALSE;
+
+      break;
+    }
+  }
+
+  CU_ASSERT(success);
+
+  CU_ASSERT(ags_recall_snapshot_find_recycling_context(snapshot, 1,
+						       (GObject *) recycling_context[0]) == -1);
+
+  ags_recall_snapshot_free(snapshot);
+
+  g_list_free_full(list,
+		   g_object_unref);
+}
+
+void
+ags_recall_snapshot_test_slot_publish()
+{
+  AgsRecall *recall;
+  AgsRecallSnapshot *snapshot;
+
+  AgsRecallSnapshotSlot slot;
+
+  GList *list;
+
+  GRecMutex mutex;
+
+  g_rec_mutex_init(&mutex);
+
+  ags_recall_snapshot_slot_init(&slot,
+				&mutex);
+
+  snapshot = ags_recall_snapshot_slot_acquire(&slot);
+
+  CU_ASSERT(snapshot != NULL);
+  CU_ASSERT(snapshot->length == 0);
+
+  ags_recall_snapshot_slot_release(&slot,
+				   snapshot);
+
+  /* publish without readers */
+  recall = ags_recall_new();
+
+  list = g_list_prepend(NULL,
+			recall);
+
+  ags_recall_snapshot_slot_publish(&slot,
+				   list);
+
+  CU_ASSERT(slot.version == 1);
+  CU_ASSERT(slot.retired == NULL);
+
+  snapshot = ags_recall_snapshot_slot_acquire(&slot);
+
+  CU_ASSERT(snapshot->version == 1);
+  CU_ASSERT(snapshot->length == 1);
+  CU_ASSERT(snapshot->recall[0] == recall);
+
+  ags_recall_snapshot_slot_release(&slot,
+				   snapshot);
+
+  ags_recall_snapshot_slot_clear(&slot);
+
+  CU_ASSERT(G_OBJECT(recall)->ref_count == 1);
+
+  g_list_free_full(list,
+		   g_object_unref);
+}
+
+void
+ags_recall_snapshot_test_slot_release()
+{
+  AgsRecall *recall;
+  AgsRecallSnapshot *snapshot;
+
+  AgsRecallSnapshotSlot slot;
+
+  GList *list;
+
+  GRecMutex mutex;
+
+  g_rec_mutex_init(&mutex);
+
+  ags_recall_snapshot_slot_init(&slot,
+				&mutex);
+
+  recall = ags_recall_new();
+
+  list = g_list_prepend(NULL,
+			recall);
+
+  ags_recall_snapshot_slot_publish(&slot,
+				   list);
+
+  /* publish while reading */
+  snapshot = ags_recall_snapshot_slot_acquire(&slot);
+
+  ags_recall_snapshot_slot_publish(&slot,
+				   NULL);
+
+  CU_ASSERT(slot.retired == snapshot);
+  CU_ASSERT(snapshot->recall[0] == recall);
+  CU_ASSERT(G_OBJECT(recall)->ref_count == 2);
+
+  /* the last reader doesn't free without reclaimer, the writer does */
+  ags_recall_snapshot_slot_release(&slot,
+				   snapshot);
+
+  CU_ASSERT(slot.retired == snapshot);
+  CU_ASSERT(snapshot->readers == 0);
+  
+  ags_recall_snapshot_slot_reclaim(&slot);
+
+  CU_ASSERT(slot.retired == NULL);
+  CU_ASSERT(G_OBJECT(recall)->ref_count == 1);
+
+  ags_recall_snapshot_slot_clear(&slot);
+
+  g_list_free_full(list,
+		   g_object_unref);
+}
+
+void
+ags_recall_snapshot_test_slot_retired()
+{
+  AgsRecall *recall;
+  AgsRecallSnapshot *snapshot;
+
+  AgsRecallSnapshotSlot slot;
+
+  GList *list;
+
+  GRecMutex mutex;
+
+  guint i;
+
+  g_rec_mutex_init(&mutex);
+
+  ags_recall_snapshot_slot_init(&slot,
+				&mutex);
+
+  recall = ags_recall_new();
+
+  list = g_list_prepend(NULL,
+			recall);
+
+  ags_recall_snapshot_slot_publish(&slot,
+				   list);
+
+  /* a reader holding a snapshot while the writer keeps publishing */
+  snapshot = ags_recall_snapshot_slot_acquire(&slot);
+
+  for(i = 0; i < AGS_RECALL_SNAPSHOT_TEST_SLOT_RETIRED_PUBLISH_COUNT; i++){
+    ags_recall_snapshot_slot_publish(&slot,
+				     list);
+  }
+
+  /* only the snapshot in use is retained */
+  CU_ASSERT(slot.retired == snapshot);
+  CU_ASSERT(snapshot->next == NULL);
+  CU_ASSERT(G_OBJECT(recall)->ref_count == 3);
+
+  ags_recall_snapshot_slot_release(&slot,
+				   snapshot);
+
+  ags_recall_snapshot_slot_reclaim(&slot);
+
+  CU_ASSERT(slot.retired == NULL);
+  CU_ASSERT(G_OBJECT(recall)->ref_count == 2);
+
+  ags_recall_snapshot_slot_clear(&slot);
+
+  CU_ASSERT(G_OBJECT(recall)->ref_count == 1);
+
+  g_list_free_full(list,
+		   g_object_unref);
+}
+
+int
+main(int argc, char **argv)
+{
+  CU_pSuite pSuite = NULL;
+
+  /* initialize the CUnit test registry */
+  if(CUE_SUCCESS != CU_initialize_registry()){
+    return CU_get_error();
+  }
+
+  /* add a suite to the registry */
+  pSuite = CU_add_suite("AgsRecallSnapshotTest", ags_recall_snapshot_test_init_suite, ags_recall_snapshot_test_clean_suite);
+
+  if(pSuite == NULL){
+    CU_cleanup_registry();
+
+    return CU_get_error();
+  }
+
+  /* add the tests to the suite */
+  if((CU_add_test(pSuite, "test of AgsRecallSnapshot alloc", ags_recall_snapshot_test_alloc) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsRecallSnapshot staging mask", ags_recall_snapshot_test_staging_mask) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsRecallSnapshot find recycling context", ags_recall_snapshot_test_find_recycling_context) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsRecallSnapshot slot publish", ags_recall_snapshot_test_slot_publish) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsRecallSnapshot slot release", ags_recall_snapshot_test_slot_release) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsRecallSnapshot slot retired", ags_recall_snapshot_test_slot_retired) == NULL)){
+    CU_cleanup_registry();
+
+    return CU_get_error();
+  }
+
+  /* Run all tests using the CUnit Basic interface */
+  CU_basic_set_mode(CU_BRM_VERBOSE);
+  CU_basic_run_tests();
+
+  CU_cleanup_registry();
+
+  return(CU_get_error());
+}
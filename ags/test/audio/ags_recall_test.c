@@ -41,6 +41,7 @@ void ags_recall_test_cancel();
 void ags_recall_test_is_done();
 void ags_recall_test_duplicate();
 void ags_recall_test_set_recall_id();
+void ags_recall_test_update_rt_view();
 void ags_recall_test_notify_dependency();
 void ags_recall_test_add_dependency();
 void ags_recall_test_remove_dependency();
@@ -594,6 +595,63 @@ ags_recall_test_set_recall_id()
   CU_ASSERT(success == TRUE);
 }
 
+void
+ags_recall_test_update_rt_view()
+{
+  AgsRecall *recall, *child;
+  AgsRecallID *recall_id;
+  AgsRecyclingContext *recycling_context, *parent_recycling_context;
+  AgsRecallRtView *rt_view;
+
+  recall = g_object_new(AGS_TYPE_RECALL,
+			NULL);
+
+  rt_view = ags_recall_get_rt_view(recall);
+
+  CU_ASSERT(rt_view == AGS_RECALL_RT_VIEW(recall));
+  CU_ASSERT(rt_view->recall_id == NULL);
+  CU_ASSERT(rt_view->output_soundcard == NULL);
+
+  /* assert recall id and recycling context */
+  parent_recycling_context = ags_recycling_context_new(0);
+  
+  recycling_context = ags_recycling_context_new(0);
+  g_object_set(recycling_context,
+	       "parent", parent_recycling_context,
+	       NULL);
+  
+  recall_id = ags_recall_id_new();
+  g_object_set(recall_id,
+	       "recycling-context", recycling_context,
+	       NULL);
+
+  g_object_set(recall,
+	       "recall-id", recall_id,
+	       "samplerate", 48000,
+	       "buffer-size", 512,
+	       NULL);
+
+  CU_ASSERT(rt_view->recall_id == recall_id);
+  CU_ASSERT(rt_view->recycling_context == recycling_context);
+  CU_ASSERT(rt_view->parent_recycling_context == parent_recycling_context);
+  CU_ASSERT(rt_view->samplerate == 48000);
+  CU_ASSERT(rt_view->buffer_size == 512);
+
+  /* assert parent */
+  child = g_object_new(AGS_TYPE_RECALL,
+		       NULL);
+  ags_recall_add_child(recall,
+		       child);
+
+  CU_ASSERT(AGS_RECALL_RT_VIEW(child)->parent == recall);
+  CU_ASSERT(AGS_RECALL_RT_VIEW(child)->recall_id == recall_id);
+
+  ags_recall_remove_child(recall,
+			  child);
+
+  CU_ASSERT(AGS_RECALL_RT_VIEW(child)->parent == NULL);
+}
+
 void
 ags_recall_test_notify_dependency()
 {
@@ -829,6 +887,7 @@ main(int argc, char **argv)
      (CU_add_test(pSuite, "test of AgsRecall is done", ags_recall_test_is_done) == NULL) ||
      (CU_add_test(pSuite, "test of AgsRecall duplicate", ags_recall_test_duplicate) == NULL) ||
      (CU_add_test(pSuite, "test of AgsRecall set recall id", ags_recall_test_set_recall_id) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsRecall update rt view", ags_recall_test_update_rt_view) == NULL) ||
      (CU_add_test(pSuite, "test of AgsRecall notify dependency", ags_recall_test_notify_dependency) == NULL) ||
      (CU_add_test(pSuite, "test of AgsRecall add dependency", ags_recall_test_add_dependency) == NULL) ||
      (CU_add_test(pSuite, "test of AgsRecall remove dependency", ags_recall_test_remove_dependency) == NULL) ||
@@ -0,0 +1,254 @@
+/* GSequencer - Advanced GTK Sequencer
+ * Copyright (C) 2005-2026 Joël Krähemann
+ *
+ * This file is part of GSequencer.
+ *
+ * GSequencer is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GSequencer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GSequencer.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <glib.h>
+#include <glib-object.h>
+
+#include <ags/libags.h>
+#include <ags/libags-audio.h>
+
+#include <CUnit/CUnit.h>
+#include <CUnit/Automated.h>
+#include <CUnit/Basic.h>
+
+#include <stdlib.h>
+
+int ags_scratch_arena_test_init_suite();
+int ags_scratch_arena_test_clean_suite();
+
+void ags_scratch_arena_test_alloc();
+void ags_scratch_arena_test_get_thread_default();
+void ags_scratch_arena_test_acquire();
+void ags_scratch_arena_test_acquire_dual();
+void ags_scratch_arena_test_release();
+
+gpointer ags_scratch_arena_test_get_thread_default_thread(gpointer data);
+
+/* The suite initialization function.
+ * Opens the temporary file used by the tests.
+ * Returns zero on success, non-zero otherwise.
+ */
+int
+ags_scratch_arena_test_init_suite()
+{
+  return(0);
+}
+
+/* The suite cleanup function.
+ * Closes the temporary file used by the tests.
+ * Returns zero on success, non-zero otherwise.
+ */
+int
+ags_scratch_arena_test_clean_suite()
+{
+  return(0);
+}
+
+void
+ags_scratch_arena_test_alloc()
+{
+  AgsScratchArena *scratch_arena;
+
+  guint i, j;
+  gboolean success;
+  
+  scratch_arena = ags_scratch_arena_alloc(AGS_SCRATCH_ARENA_DEFAULT_DEPTH);
+
+  CU_ASSERT(scratch_arena != NULL);
+  CU_ASSERT(scratch_arena->depth == AGS_SCRATCH_ARENA_DEFAULT_DEPTH);
+  
+  /* every vector cache aligned */
+  success = TRUE;
+  
+  for(i = 0; i < AGS_SCRATCH_ARENA_VECTOR_TYPE_COUNT; i++){
+    for(j = 0; j < scratch_arena->depth; j++){
+      if(scratch_arena->in_use[i] != 0 ||
+	 scratch_arena->vector_arr[i][j].vector_type != i ||
+	 (((guintptr) scratch_arena->vector_arr[i][j].vector.vec_s8) % AGS_SCRATCH_ARENA_CACHE_LINE_SIZE) != 0){
+	success = FALSE;
+
+	break;
+      }
+    }
+  }
+
+  CU_ASSERT(success);
+  
+  ags_scratch_arena_free(scratch_arena);
+}
+
+gpointer
+ags_scratch_arena_test_get_thread_default_thread(gpointer data)
+{
+  return(ags_scratch_arena_get_thread_default());
+}
+
+void
+ags_scratch_arena_test_get_thread_default()
+{
+  AgsScratchArena *scratch_arena, *thread_scratch_arena;
+
+  GThread *thread;
+  
+  scratch_arena = ags_scratch_arena_get_thread_default();
+
+  CU_ASSERT(scratch_arena != NULL);
+  CU_ASSERT(ags_scratch_arena_get_thread_default() == scratch_arena);
+
+  /* other thread gets other arena */
+  thread = g_thread_new("scratch arena test",
+			ags_scratch_arena_test_get_thread_default_thread,
+			NULL);
+
+  thread_scratch_arena = g_thread_join(thread);
+
+  CU_ASSERT(thread_scratch_arena != NULL);
+  CU_ASSERT(thread_scratch_arena != scratch_arena);
+}
+
+void
+ags_scratch_arena_test_acquire()
+{
+  AgsScratchArena *scratch_arena;
+  AgsVectorArr *vector_arr[AGS_SCRATCH_ARENA_DEFAULT_DEPTH];
+
+  guint i;
+  gboolean success;
+  
+  scratch_arena = ags_scratch_arena_alloc(AGS_SCRATCH_ARENA_DEFAULT_DEPTH);
+
+  success = TRUE;
+  
+  for(i = 0; i < AGS_SCRATCH_ARENA_DEFAULT_DEPTH; i++){
+    vector_arr[i] = ags_scratch_arena_acquire(scratch_arena,
+					      AGS_VECTOR_256_DOUBLE);
+
+    if(vector_arr[i] == NULL ||
+       vector_arr[i]->vector_type != AGS_VECTOR_256_DOUBLE ||
+       (i > 0 && vector_arr[i] == vector_arr[i - 1])){
+      success = FALSE;
+    }
+  }
+
+  CU_ASSERT(success);
+  CU_ASSERT(scratch_arena->acquire_count == AGS_SCRATCH_ARENA_DEFAULT_DEPTH);
+
+  /* exhausted */
+  CU_ASSERT(ags_scratch_arena_acquire(scratch_arena,
+				      AGS_VECTOR_256_DOUBLE) == NULL);
+  CU_ASSERT(scratch_arena->exhausted_count == 1);
+
+  /* other types not affected */
+  CU_ASSERT(ags_scratch_arena_acquire(scratch_arena,
+				      AGS_VECTOR_256_FLOAT) != NULL);
+  
+  ags_scratch_arena_free(scratch_arena);
+}
+
+void
+ags_scratch_arena_test_acquire_dual()
+{
+  AgsScratchArena *scratch_arena;
+  AgsVectorArr *vector_arr_a, *vector_arr_b;
+  AgsVectorArr *buffer_arr, *sine_arr, *volume_arr;
+
+  scratch_arena = ags_scratch_arena_alloc(2);
+
+  CU_ASSERT(ags_scratch_arena_acquire_dual(scratch_arena,
+					   AGS_VECTOR_256_SIGNED_16_BIT, AGS_VECTOR_256_SIGNED_16_BIT,
+					   &vector_arr_a, &vector_arr_b) == TRUE);
+  CU_ASSERT(vector_arr_a != vector_arr_b);
+  CU_ASSERT(scratch_arena->in_use[AGS_VECTOR_256_SIGNED_16_BIT] == 0x3);
+
+  /* all or nothing */
+  CU_ASSERT(ags_scratch_arena_acquire_triple(scratch_arena,
+					     AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE, AGS_VECTOR_256_DOUBLE,
+					     &buffer_arr, &sine_arr, &volume_arr) == FALSE);
+  CU_ASSERT(scratch_arena->in_use[AGS_VECTOR_256_DOUBLE] == 0);
+  
+  ags_scratch_arena_free(scratch_arena);
+}
+
+void
+ags_scratch_arena_test_release()
+{
+  AgsScratchArena *scratch_arena;
+  AgsVectorArr *vector_arr_a, *vector_arr_b;
+
+  scratch_arena = ags_scratch_arena_alloc(AGS_SCRATCH_ARENA_DEFAULT_DEPTH);
+
+  vector_arr_a = ags_scratch_arena_acquire(scratch_arena,
+					   AGS_VECTOR_256_SIGNED_32_BIT);
+  vector_arr_b = ags_scratch_arena_acquire(scratch_arena,
+					   AGS_VECTOR_256_SIGNED_32_BIT);
+
+  /* release out of order */
+  ags_scratch_arena_release(scratch_arena,
+			    vector_arr_a);
+
+  CU_ASSERT(scratch_arena->in_use[AGS_VECTOR_256_SIGNED_32_BIT] == 0x2);
+  CU_ASSERT(vector_arr_a->locked == FALSE);
+  CU_ASSERT(vector_arr_b->locked == TRUE);
+
+  /* lowest free slot reused */
+  CU_ASSERT(ags_scratch_arena_acquire(scratch_arena,
+				      AGS_VECTOR_256_SIGNED_32_BIT) == vector_arr_a);
+  
+  ags_scratch_arena_free(scratch_arena);
+}
+
+int
+main(int argc, char **argv)
+{
+  CU_pSuite pSuite = NULL;
+
+  /* initialize the CUnit test registry */
+  if(CUE_SUCCESS != CU_initialize_registry()){
+    return CU_get_error();
+  }
+
+  /* add a suite to the registry */
+  pSuite = CU_add_suite("AgsScratchArenaTest", ags_scratch_arena_test_init_suite, ags_scratch_arena_test_clean_suite);
+
+  if(pSuite == NULL){
+    CU_cleanup_registry();
+
+    return CU_get_error();
+  }
+
+  /* add the tests to the suite */
+  if((CU_add_test(pSuite, "test of AgsScratchArena alloc", ags_scratch_arena_test_alloc) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsScratchArena get thread default", ags_scratch_arena_test_get_thread_default) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsScratchArena acquire", ags_scratch_arena_test_acquire) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsScratchArena acquire dual", ags_scratch_arena_test_acquire_dual) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsScratchArena release", ags_scratch_arena_test_release) == NULL)){
+    CU_cleanup_registry();
+
+    return CU_get_error();
+  }
+
+  /* Run all tests using the CUnit Basic interface */
+  CU_basic_set_mode(CU_BRM_VERBOSE);
+  CU_basic_run_tests();
+
+  CU_cleanup_registry();
+
+  return(CU_get_error());
+}
@@ -0,0 +1,273 @@
+/* GSequencer - Advanced GTK Sequencer
+ * Copyright (C) 2005-2026 Joël Krähemann
+ *
+ * This file is part of GSequencer.
+ *
+ * GSequencer is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GSequencer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GSequencer.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <glib.h>
+#include <glib-object.h>
+
+#include <ags/libags.h>
+#include <ags/libags-audio.h>
+
+#include <CUnit/CUnit.h>
+#include <CUnit/Automated.h>
+#include <CUnit/Basic.h>
+
+#include <stdlib.h>
+
+int ags_tempo_map_test_init_suite();
+int ags_tempo_map_test_clean_suite();
+
+void ags_tempo_map_test_compile();
+void ags_tempo_map_test_find();
+void ags_tempo_map_test_next();
+
+GList* ags_tempo_map_test_create_program();
+
+#define AGS_TEMPO_MAP_TEST_N_MARKER (8)
+#define AGS_TEMPO_MAP_TEST_MARKER_DISTANCE (256)
+
+/* The suite initialization function.
+ * Opens the temporary file used by the tests.
+ * Returns zero on success, non-zero otherwise.
+ */
+int
+ags_tempo_map_test_init_suite()
+{
+  return(0);
+}
+
+/* The suite cleanup function.
+ * Closes the temporary file used by the tests.
+ * Returns zero on success, non-zero otherwise.
+ */
+int
+ags_tempo_map_test_clean_suite()
+{
+  return(0);
+}
+
+GList*
+ags_tempo_map_test_create_program()
+{
+  AgsProgram *program;
+  AgsMarker *marker;
+
+  guint i;
+
+  program = ags_program_new("tempo");
+
+  /* add in reversed order, the map must be sorted anyway */
+  for(i = 0; i < AGS_TEMPO_MAP_TEST_N_MARKER; i++){
+    marker = ags_marker_new();
+
+    marker->x = (AGS_TEMPO_MAP_TEST_N_MARKER - i - 1) * AGS_TEMPO_MAP_TEST_MARKER_DISTANCE;
+    marker->y = 60.0 + (gdouble) (AGS_TEMPO_MAP_TEST_N_MARKER - i - 1);
+
+    ags_program_add_marker(program,
+			   marker,
+			   FALSE);
+  }
+
+  return(g_list_prepend(NULL,
+			program));
+}
+
+void
+ags_tempo_map_test_compile()
+{
+  AgsTempoMap *tempo_map;
+
+  GList *program;
+
+  guint stamp;
+  guint i;
+  gboolean success;
+
+  stamp = ags_program_global_get_modified_stamp();
+
+  program = ags_tempo_map_test_create_program();
+
+  /* adding markers modifies stamp */
+  CU_ASSERT(ags_program_global_get_modified_stamp() != stamp);
+
+  stamp = ags_program_global_get_modified_stamp();
+
+  tempo_map = ags_tempo_map_alloc();
+
+  CU_ASSERT(tempo_map->stamp == G_MAXUINT);
+  CU_ASSERT(tempo_map->length == 0);
+
+  ags_tempo_map_compile(tempo_map,
+			program,
+			stamp);
+
+  CU_ASSERT(tempo_map->stamp == stamp);
+  CU_ASSERT(tempo_map->length == AGS_TEMPO_MAP_TEST_N_MARKER);
+  CU_ASSERT(tempo_map->cursor == 0);
+
+  success = TRUE;
+
+  for(i = 0; i < AGS_TEMPO_MAP_TEST_N_MARKER; i++){
+    if(tempo_map->entry[i].x != i * AGS_TEMPO_MAP_TEST_MARKER_DISTANCE ||
+       tempo_map->entry[i].bpm != 60.0 + (gdouble) i){
+      success = FALSE;
+
+      break;
+    }
+  }
+
+  CU_ASSERT(success);
+
+  ags_tempo_map_free(tempo_map);
+
+  g_list_free_full(program,
+		   g_object_unref);
+}
+
+void
+ags_tempo_map_test_find()
+{
+  AgsTempoMap *tempo_map;
+
+  GList *program;
+
+  program = ags_tempo_map_test_create_program();
+
+  tempo_map = ags_tempo_map_alloc();
+
+  ags_tempo_map_compile(tempo_map,
+			program,
+			ags_program_global_get_modified_stamp());
+
+  CU_ASSERT(ags_tempo_map_find(tempo_map, 0) == 0);
+  CU_ASSERT(ags_tempo_map_find(tempo_map, 1) == 1);
+  CU_ASSERT(ags_tempo_map_find(tempo_map, AGS_TEMPO_MAP_TEST_MARKER_DISTANCE) == 1);
+  CU_ASSERT(ags_tempo_map_find(tempo_map, 3 * AGS_TEMPO_MAP_TEST_MARKER_DISTANCE - 1) == 3);
+  CU_ASSERT(ags_tempo_map_find(tempo_map, AGS_TEMPO_MAP_TEST_N_MARKER * AGS_TEMPO_MAP_TEST_MARKER_DISTANCE) == AGS_TEMPO_MAP_TEST_N_MARKER);
+
+  ags_tempo_map_seek(tempo_map,
+		     2 * AGS_TEMPO_MAP_TEST_MARKER_DISTANCE);
+
+  CU_ASSERT(tempo_map->cursor == 2);
+  CU_ASSERT(tempo_map->position == 2 * AGS_TEMPO_MAP_TEST_MARKER_DISTANCE);
+
+  ags_tempo_map_free(tempo_map);
+
+  g_list_free_full(program,
+		   g_object_unref);
+}
+
+void
+ags_tempo_map_test_next()
+{
+  AgsTempoMap *tempo_map;
+
+  GList *program;
+
+  gdouble bpm;
+  guint64 x;
+  guint count;
+  gboolean success;
+
+  program = ags_tempo_map_test_create_program();
+
+  tempo_map = ags_tempo_map_alloc();
+
+  ags_tempo_map_compile(tempo_map,
+			program,
+			ags_program_global_get_modified_stamp());
+
+  /* advance in steps of 16, every marker is returned once and in order */
+  count = 0;
+
+  success = TRUE;
+
+  for(x = 0; x < AGS_TEMPO_MAP_TEST_N_MARKER * AGS_TEMPO_MAP_TEST_MARKER_DISTANCE; x += 16){
+    while(ags_tempo_map_next(tempo_map,
+			     x, x + 16,
+			     &bpm)){
+      if(bpm != 60.0 + (gdouble) count){
+	success = FALSE;
+      }
+
+      count++;
+    }
+  }
+
+  CU_ASSERT(success);
+  CU_ASSERT(count == AGS_TEMPO_MAP_TEST_N_MARKER);
+
+  /* range already passed doesn't return again */
+  CU_ASSERT(!ags_tempo_map_next(tempo_map,
+				AGS_TEMPO_MAP_TEST_N_MARKER * AGS_TEMPO_MAP_TEST_MARKER_DISTANCE, AGS_TEMPO_MAP_TEST_N_MARKER * AGS_TEMPO_MAP_TEST_MARKER_DISTANCE + 16,
+				&bpm));
+
+  /* moving backward relocates */
+  CU_ASSERT(ags_tempo_map_next(tempo_map,
+			       AGS_TEMPO_MAP_TEST_MARKER_DISTANCE, AGS_TEMPO_MAP_TEST_MARKER_DISTANCE + 16,
+			       &bpm));
+  CU_ASSERT(bpm == 61.0);
+
+  /* jumping forward skips passed markers */
+  CU_ASSERT(ags_tempo_map_next(tempo_map,
+			       5 * AGS_TEMPO_MAP_TEST_MARKER_DISTANCE, 5 * AGS_TEMPO_MAP_TEST_MARKER_DISTANCE + 16,
+			       &bpm));
+  CU_ASSERT(bpm == 65.0);
+
+  ags_tempo_map_free(tempo_map);
+
+  g_list_free_full(program,
+		   g_object_unref);
+}
+
+int
+main(int argc, char **argv)
+{
+  CU_pSuite pSuite = NULL;
+
+  /* initialize the CUnit test registry */
+  if(CUE_SUCCESS != CU_initialize_registry()){
+    return CU_get_error();
+  }
+
+  /* add a suite to the registry */
+  pSuite = CU_add_suite("AgsTempoMapTest", ags_tempo_map_test_init_suite, ags_tempo_map_test_clean_suite);
+
+  if(pSuite == NULL){
+    CU_cleanup_registry();
+
+    return CU_get_error();
+  }
+
+  /* add the tests to the suite */
+  if((CU_add_test(pSuite, "test of AgsTempoMap compile", ags_tempo_map_test_compile) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsTempoMap find", ags_tempo_map_test_find) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsTempoMap next", ags_tempo_map_test_next) == NULL)){
+    CU_cleanup_registry();
+
+    return CU_get_error();
+  }
+
+  /* Run all tests using the CUnit Basic interface */
+  CU_basic_set_mode(CU_BRM_VERBOSE);
+  CU_basic_run_tests();
+
+  CU_cleanup_registry();
+
+  return(CU_get_error());
+}
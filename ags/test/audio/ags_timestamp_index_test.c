@@ -0,0 +1,383 @@
+/* GSequencer - Advanced GTK Sequencer
+ * Copyright (C) 2005-2026 Joël Krähemann
+ *
+ * This file is part of GSequencer.
+ *
+ * GSequencer is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GSequencer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GSequencer.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <glib.h>
+#include <glib-object.h>
+
+#include <ags/libags.h>
+#include <ags/libags-audio.h>
+
+#include <CUnit/CUnit.h>
+#include <CUnit/Automated.h>
+#include <CUnit/Basic.h>
+
+
+int ags_timestamp_index_test_init_suite();
+int ags_timestamp_index_test_clean_suite();
+
+void ags_timestamp_index_test_rebuild();
+void ags_timestamp_index_test_is_valid();
+void ags_timestamp_index_test_find_near();
+void ags_timestamp_index_test_find_near_filter();
+
+gboolean ags_timestamp_index_test_find_near_filter_func(GObject *data,
+							gpointer filter_data);
+
+#define AGS_TIMESTAMP_INDEX_TEST_REBUILD_COUNT (256)
+#define AGS_TIMESTAMP_INDEX_TEST_REBUILD_AUDIO_CHANNELS (4)
+
+#define AGS_TIMESTAMP_INDEX_TEST_FIND_NEAR_COUNT (256)
+#define AGS_TIMESTAMP_INDEX_TEST_FIND_NEAR_AUDIO_CHANNELS (3)
+
+/* The suite initialization function.
+ * Opens the temporary file used by the tests.
+ * Returns zero on success, non-zero otherwise.
+ */
+int
+ags_timestamp_index_test_init_suite()
+{
+  return(0);
+}
+
+/* The suite cleanup function.
+ * Closes the temporary file used by the tests.
+ * Returns zero on success, non-zero otherwise.
+ */
+int
+ags_timestamp_index_test_clean_suite()
+{
+  return(0);
+}
+
+void
+ags_timestamp_index_test_rebuild()
+{
+  AgsTimestampIndex *timestamp_index;
+  AgsNotation *notation;
+
+  GList *list;
+
+  guint i;
+  gboolean success;
+
+  list = NULL;
+
+  for(i = 0; i < AGS_TIMESTAMP_INDEX_TEST_REBUILD_COUNT; i++){
+    notation = ags_notation_new(NULL,
+				rand() % AGS_TIMESTAMP_INDEX_TEST_REBUILD_AUDIO_CHANNELS);
+    ags_timestamp_set_ags_offset(notation->timestamp,
+				 (guint64) ((rand() % AGS_TIMESTAMP_INDEX_TEST_REBUILD_COUNT) * AGS_NOTATION_DEFAULT_OFFSET));
+
+    list = g_list_prepend(list,
+			  notation);
+  }
+
+  timestamp_index = ags_timestamp_index_alloc();
+
+  ags_timestamp_index_rebuild(timestamp_index,
+			      list,
+			      "audio-channel",
+			      1);
+
+  CU_ASSERT(timestamp_index->revision == 1);
+  CU_ASSERT(timestamp_index->length == AGS_TIMESTAMP_INDEX_TEST_REBUILD_COUNT);
+
+  /* sorted by offset and audio channel */
+  success = TRUE;
+  
+  for(i = 1; i < timestamp_index->length; i++){
+    if(timestamp_index->entry[i - 1].ags_offset > timestamp_index->entry[i].ags_offset ||
+       (timestamp_index->entry[i - 1].ags_offset == timestamp_index->entry[i].ags_offset &&
+	timestamp_index->entry[i - 1].line > timestamp_index->entry[i].line)){
+      success = FALSE;
+
+      break;
+    }
+  }
+
+  CU_ASSERT(success == TRUE);
+
+  /* entries match their data */
+  success = TRUE;
+  
+  for(i = 0; i < timestamp_index->length; i++){
+    notation = AGS_NOTATION(timestamp_index->entry[i].data);
+    
+    if(g_list_find(list, notation) == NULL ||
+       timestamp_index->entry[i].ags_offset != ags_timestamp_get_ags_offset(notation->timestamp) ||
+       timestamp_index->entry[i].line != notation->audio_channel){
+      success = FALSE;
+
+      break;
+    }
+  }
+
+  CU_ASSERT(success == TRUE);
+
+  /* rebuild empty */
+  ags_timestamp_index_rebuild(timestamp_index,
+			      NULL,
+			      "audio-channel",
+			      2);
+
+  CU_ASSERT(timestamp_index->revision == 2);
+  CU_ASSERT(timestamp_index->length == 0);
+
+  ags_timestamp_index_free(timestamp_index);
+
+  g_list_free_full(list,
+		   g_object_unref);
+}
+
+void
+ags_timestamp_index_test_is_valid()
+{
+  AgsTimestampIndex *timestamp_index;
+
+  timestamp_index = ags_timestamp_index_alloc();
+
+  CU_ASSERT(ags_timestamp_index_is_valid(timestamp_index, 0) == TRUE);
+  CU_ASSERT(ags_timestamp_index_is_valid(timestamp_index, 1) == FALSE);
+
+  ags_timestamp_index_rebuild(timestamp_index,
+			      NULL,
+			      NULL,
+			      1);
+
+  CU_ASSERT(ags_timestamp_index_is_valid(timestamp_index, 0) == FALSE);
+  CU_ASSERT(ags_timestamp_index_is_valid(timestamp_index, 1) == TRUE);
+
+  ags_timestamp_index_free(timestamp_index);
+}
+
+void
+ags_timestamp_index_test_find_near()
+{
+  AgsTimestampIndex *timestamp_index;
+  AgsNotation *notation;
+  AgsTimestamp *timestamp;
+
+  GObject *current;
+  
+  GList *list, *match;
+
+  guint i, j;
+  gboolean success;
+
+  list = NULL;
+
+  for(i = 0; i < AGS_TIMESTAMP_INDEX_TEST_FIND_NEAR_COUNT; i++){
+    for(j = 0; j < AGS_TIMESTAMP_INDEX_TEST_FIND_NEAR_AUDIO_CHANNELS; j++){
+      if(rand() % 4 == 0){
+	continue;
+      }
+      
+      notation = ags_notation_new(NULL,
+				  j);
+      ags_timestamp_set_ags_offset(notation->timestamp,
+				   (guint64) (i * AGS_NOTATION_DEFAULT_OFFSET));
+
+      list = ags_notation_add(list,
+			      notation);
+    }
+  }
+
+  timestamp_index = ags_timestamp_index_alloc();
+
+  ags_timestamp_index_rebuild(timestamp_index,
+			      list,
+			      "audio-channel",
+			      1);
+
+  timestamp = ags_timestamp_new();
+
+  timestamp->flags &= (~AGS_TIMESTAMP_UNIX);
+  timestamp->flags |= AGS_TIMESTAMP_OFFSET;
+
+  /* compare to list */
+  success = TRUE;
+  
+  for(i = 0; i < AGS_TIMESTAMP_INDEX_TEST_FIND_NEAR_COUNT + 2; i++){
+    for(j = 0; j < AGS_TIMESTAMP_INDEX_TEST_FIND_NEAR_AUDIO_CHANNELS + 1; j++){
+      ags_timestamp_set_ags_offset(timestamp,
+				   (guint64) (i * AGS_NOTATION_DEFAULT_OFFSET));
+
+      match = ags_notation_find_near_timestamp(list, j,
+					       timestamp);
+
+      current = ags_timestamp_index_find_near(timestamp_index,
+					      j,
+					      timestamp,
+					      (guint64) AGS_NOTATION_DEFAULT_OFFSET,
+					      (guint64) AGS_NOTATION_DEFAULT_DURATION,
+					      NULL, NULL);
+
+      if(current != ((match != NULL) ? match->data: NULL)){
+	success = FALSE;
+      }
+    }
+  }
+
+  CU_ASSERT(success == TRUE);
+
+  /* no flags */
+  timestamp->flags &= (~AGS_TIMESTAMP_OFFSET);
+
+  CU_ASSERT(ags_timestamp_index_find_near(timestamp_index,
+					  0,
+					  timestamp,
+					  (guint64) AGS_NOTATION_DEFAULT_OFFSET,
+					  (guint64) AGS_NOTATION_DEFAULT_DURATION,
+					  NULL, NULL) == NULL);
+
+  CU_ASSERT(ags_timestamp_index_find_near(timestamp_index,
+					  0,
+					  NULL,
+					  (guint64) AGS_NOTATION_DEFAULT_OFFSET,
+					  (guint64) AGS_NOTATION_DEFAULT_DURATION,
+					  NULL, NULL) == NULL);
+  
+  g_object_unref(timestamp);
+  
+  ags_timestamp_index_free(timestamp_index);
+
+  g_list_free_full(list,
+		   g_object_unref);
+}
+
+gboolean
+ags_timestamp_index_test_find_near_filter_func(GObject *data,
+					       gpointer filter_data)
+{
+  return((!g_strcmp0(AGS_AUTOMATION(data)->control_name, filter_data)) ? TRUE: FALSE);
+}
+
+void
+ags_timestamp_index_test_find_near_filter()
+{
+  AgsTimestampIndex *timestamp_index;
+  AgsAutomation *volume, *muted;
+  AgsTimestamp *timestamp;
+
+  GList *list;
+
+  list = NULL;
+
+  volume = ags_automation_new(NULL,
+			      0,
+			      AGS_TYPE_INPUT,
+			      "./volume[0]");
+  ags_timestamp_set_ags_offset(volume->timestamp,
+			       0);
+
+  list = ags_automation_add(list,
+			    volume);
+
+  muted = ags_automation_new(NULL,
+			     0,
+			     AGS_TYPE_INPUT,
+			     "./muted[0]");
+  ags_timestamp_set_ags_offset(muted->timestamp,
+			       0);
+
+  list = ags_automation_add(list,
+			    muted);
+  
+  timestamp_index = ags_timestamp_index_alloc();
+
+  ags_timestamp_index_rebuild(timestamp_index,
+			      list,
+			      "line",
+			      1);
+
+  timestamp = ags_timestamp_new();
+
+  timestamp->flags &= (~AGS_TIMESTAMP_UNIX);
+  timestamp->flags |= AGS_TIMESTAMP_OFFSET;
+
+  ags_timestamp_set_ags_offset(timestamp,
+			       0);
+
+  CU_ASSERT(ags_timestamp_index_find_near(timestamp_index,
+					  0,
+					  timestamp,
+					  (guint64) AGS_AUTOMATION_DEFAULT_OFFSET,
+					  (guint64) AGS_AUTOMATION_DEFAULT_DURATION,
+					  ags_timestamp_index_test_find_near_filter_func, "./volume[0]") == (GObject *) volume);
+
+  CU_ASSERT(ags_timestamp_index_find_near(timestamp_index,
+					  0,
+					  timestamp,
+					  (guint64) AGS_AUTOMATION_DEFAULT_OFFSET,
+					  (guint64) AGS_AUTOMATION_DEFAULT_DURATION,
+					  ags_timestamp_index_test_find_near_filter_func, "./muted[0]") == (GObject *) muted);
+
+  CU_ASSERT(ags_timestamp_index_find_near(timestamp_index,
+					  0,
+					  timestamp,
+					  (guint64) AGS_AUTOMATION_DEFAULT_OFFSET,
+					  (guint64) AGS_AUTOMATION_DEFAULT_DURATION,
+					  ags_timestamp_index_test_find_near_filter_func, "./gain[0]") == NULL);
+
+  g_object_unref(timestamp);
+  
+  ags_timestamp_index_free(timestamp_index);
+
+  g_list_free_full(list,
+		   g_object_unref);
+}
+
+int
+main(int argc, char **argv)
+{
+  CU_pSuite pSuite = NULL;
+
+  /* initialize the CUnit test registry */
+  if(CUE_SUCCESS != CU_initialize_registry()){
+    return CU_get_error();
+  }
+
+  /* add a suite to the registry */
+  pSuite = CU_add_suite("AgsTimestampIndexTest", ags_timestamp_index_test_init_suite, ags_timestamp_index_test_clean_suite);
+
+  if(pSuite == NULL){
+    CU_cleanup_registry();
+
+    return CU_get_error();
+  }
+
+  /* add the tests to the suite */
+  if((CU_add_test(pSuite, "test of AgsTimestampIndex rebuild", ags_timestamp_index_test_rebuild) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsTimestampIndex is valid", ags_timestamp_index_test_is_valid) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsTimestampIndex find near", ags_timestamp_index_test_find_near) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsTimestampIndex find near filter", ags_timestamp_index_test_find_near_filter) == NULL)){
+    CU_cleanup_registry();
+
+    return CU_get_error();
+  }
+
+  /* Run all tests using the CUnit Basic interface */
+  CU_basic_set_mode(CU_BRM_VERBOSE);
+  CU_basic_run_tests();
+
+  CU_cleanup_registry();
+
+  return(CU_get_error());
+}
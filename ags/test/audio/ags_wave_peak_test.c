@@ -0,0 +1,294 @@
+/* GSequencer - Advanced GTK Sequencer
+ * Copyright (C) 2005-2026 Joël Krähemann
+ *
+ * This file is part of GSequencer.
+ *
+ * GSequencer is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GSequencer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GSequencer.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <glib.h>
+#include <glib-object.h>
+
+#include <ags/libags.h>
+#include <ags/libags-audio.h>
+
+#include <CUnit/CUnit.h>
+#include <CUnit/Automated.h>
+#include <CUnit/Basic.h>
+
+#include <math.h>
+
+int ags_wave_peak_test_init_suite();
+int ags_wave_peak_test_clean_suite();
+
+void ags_wave_peak_test_alloc();
+void ags_wave_peak_test_invalidate();
+void ags_wave_peak_test_add_data();
+void ags_wave_peak_test_propagate();
+void ags_wave_peak_test_clear();
+
+#define AGS_WAVE_PEAK_TEST_X_OFFSET (1000)
+#define AGS_WAVE_PEAK_TEST_FRAME_COUNT (10000)
+
+#define AGS_WAVE_PEAK_TEST_BUFFER_SIZE (512)
+
+void ags_wave_peak_test_fill(gint16 *data);
+
+/* The suite initialization function.
+ * Opens the temporary file used by the tests.
+ * Returns zero on success, non-zero otherwise.
+ */
+int
+ags_wave_peak_test_init_suite()
+{
+  return(0);
+}
+
+/* The suite cleanup function.
+ * Closes the temporary file used by the tests.
+ * Returns zero on success, non-zero otherwise.
+ */
+int
+ags_wave_peak_test_clean_suite()
+{
+  return(0);
+}
+
+void
+ags_wave_peak_test_fill(gint16 *data)
+{
+  guint i;
+
+  for(i = 0; i < AGS_WAVE_PEAK_TEST_BUFFER_SIZE; i++){
+    data[i] = 0;
+  }
+
+  data[100] = G_MAXINT16;
+  data[300] = -1 * G_MAXINT16;
+}
+
+void
+ags_wave_peak_test_alloc()
+{
+  AgsWavePeak *wave_peak;
+
+  wave_peak = ags_wave_peak_alloc(AGS_WAVE_PEAK_TEST_X_OFFSET,
+				  AGS_WAVE_PEAK_TEST_FRAME_COUNT);
+
+  CU_ASSERT(wave_peak != NULL);
+  CU_ASSERT(wave_peak->x_offset == AGS_WAVE_PEAK_TEST_X_OFFSET);
+  CU_ASSERT(wave_peak->frame_count == AGS_WAVE_PEAK_TEST_FRAME_COUNT);
+
+  CU_ASSERT(wave_peak->level[0].bin_length == AGS_WAVE_PEAK_DEFAULT_BIN_LENGTH);
+  CU_ASSERT(wave_peak->level[1].bin_length == AGS_WAVE_PEAK_LEVEL_FACTOR * AGS_WAVE_PEAK_DEFAULT_BIN_LENGTH);
+
+  CU_ASSERT(wave_peak->level[0].bin_count == 157);
+  CU_ASSERT(wave_peak->level[1].bin_count == 20);
+  CU_ASSERT(wave_peak->level[2].bin_count == 3);
+
+  /* initially dirty */
+  CU_ASSERT(ags_wave_peak_is_dirty(wave_peak));
+
+  CU_ASSERT(ags_wave_peak_ref(wave_peak) == wave_peak);
+  CU_ASSERT(wave_peak->ref_count == 2);
+
+  ags_wave_peak_unref(wave_peak);
+  ags_wave_peak_unref(wave_peak);
+}
+
+void
+ags_wave_peak_test_invalidate()
+{
+  AgsWavePeak *wave_peak;
+
+  wave_peak = ags_wave_peak_alloc(AGS_WAVE_PEAK_TEST_X_OFFSET,
+				  AGS_WAVE_PEAK_TEST_FRAME_COUNT);
+
+  wave_peak->dirty_x0 = 0;
+  wave_peak->dirty_x1 = 0;
+
+  CU_ASSERT(!ags_wave_peak_is_dirty(wave_peak));
+
+  /* clamped to extent */
+  ags_wave_peak_invalidate(wave_peak,
+			   0, 1100);
+
+  CU_ASSERT(ags_wave_peak_is_dirty(wave_peak));
+  CU_ASSERT(wave_peak->dirty_x0 == AGS_WAVE_PEAK_TEST_X_OFFSET);
+  CU_ASSERT(wave_peak->dirty_x1 == 1100);
+
+  /* union */
+  ags_wave_peak_invalidate(wave_peak,
+			   5000, G_MAXUINT64);
+
+  CU_ASSERT(wave_peak->dirty_x0 == AGS_WAVE_PEAK_TEST_X_OFFSET);
+  CU_ASSERT(wave_peak->dirty_x1 == AGS_WAVE_PEAK_TEST_X_OFFSET + AGS_WAVE_PEAK_TEST_FRAME_COUNT);
+
+  ags_wave_peak_unref(wave_peak);
+}
+
+void
+ags_wave_peak_test_add_data()
+{
+  AgsWavePeak *wave_peak;
+
+  gint16 data[AGS_WAVE_PEAK_TEST_BUFFER_SIZE];
+
+  gdouble min, max, rms;
+
+  wave_peak = ags_wave_peak_alloc(AGS_WAVE_PEAK_TEST_X_OFFSET,
+				  AGS_WAVE_PEAK_TEST_FRAME_COUNT);
+
+  ags_wave_peak_test_fill(data);
+
+  /* buffer starting before extent is clipped */
+  ags_wave_peak_add_data(wave_peak,
+			 AGS_WAVE_PEAK_TEST_X_OFFSET - 256,
+			 data,
+			 AGS_WAVE_PEAK_TEST_BUFFER_SIZE,
+			 AGS_SOUNDCARD_SIGNED_16_BIT);
+
+  /* silent bin */
+  CU_ASSERT(ags_wave_peak_get_range(wave_peak,
+				    AGS_WAVE_PEAK_TEST_X_OFFSET + 64, 64,
+				    &min, &max, &rms));
+  CU_ASSERT(min == 0.0 && max == 0.0 && rms == 0.0);
+
+  /* negative peak at frame 300 of buffer */
+  CU_ASSERT(ags_wave_peak_get_range(wave_peak,
+				    AGS_WAVE_PEAK_TEST_X_OFFSET + 44, 1,
+				    &min, &max, &rms));
+  CU_ASSERT(min < -0.99);
+
+  /* no frames accumulated */
+  CU_ASSERT(!ags_wave_peak_get_range(wave_peak,
+				     2000, 64,
+				     &min, &max, &rms));
+
+  ags_wave_peak_unref(wave_peak);
+}
+
+void
+ags_wave_peak_test_propagate()
+{
+  AgsWavePeak *wave_peak;
+
+  gint16 data[AGS_WAVE_PEAK_TEST_BUFFER_SIZE];
+
+  gdouble min, max, rms;
+
+  wave_peak = ags_wave_peak_alloc(AGS_WAVE_PEAK_TEST_X_OFFSET,
+				  AGS_WAVE_PEAK_TEST_FRAME_COUNT);
+
+  ags_wave_peak_test_fill(data);
+
+  ags_wave_peak_add_data(wave_peak,
+			 1256,
+			 data,
+			 AGS_WAVE_PEAK_TEST_BUFFER_SIZE,
+			 AGS_SOUNDCARD_SIGNED_16_BIT);
+  ags_wave_peak_add_data(wave_peak,
+			 10900,
+			 data,
+			 AGS_WAVE_PEAK_TEST_BUFFER_SIZE,
+			 AGS_SOUNDCARD_SIGNED_16_BIT);
+
+  ags_wave_peak_propagate(wave_peak,
+			  0, G_MAXUINT64);
+
+  /* coarse query */
+  CU_ASSERT(ags_wave_peak_get_range(wave_peak,
+				    AGS_WAVE_PEAK_TEST_X_OFFSET, AGS_WAVE_PEAK_TEST_FRAME_COUNT,
+				    &min, &max, &rms));
+  CU_ASSERT(fabs(max - 1.0) < 0.000001);
+  CU_ASSERT(fabs(min + 1.0) < 0.000001);
+  CU_ASSERT(rms > 0.0 && rms < 1.0);
+
+  ags_wave_peak_unref(wave_peak);
+}
+
+void
+ags_wave_peak_test_clear()
+{
+  AgsWavePeak *wave_peak;
+
+  gint16 data[AGS_WAVE_PEAK_TEST_BUFFER_SIZE];
+
+  gdouble min, max, rms;
+
+  wave_peak = ags_wave_peak_alloc(AGS_WAVE_PEAK_TEST_X_OFFSET,
+				  AGS_WAVE_PEAK_TEST_FRAME_COUNT);
+
+  ags_wave_peak_test_fill(data);
+
+  ags_wave_peak_add_data(wave_peak,
+			 1256,
+			 data,
+			 AGS_WAVE_PEAK_TEST_BUFFER_SIZE,
+			 AGS_SOUNDCARD_SIGNED_16_BIT);
+
+  ags_wave_peak_propagate(wave_peak,
+			  0, G_MAXUINT64);
+
+  ags_wave_peak_clear(wave_peak,
+		      AGS_WAVE_PEAK_TEST_X_OFFSET, AGS_WAVE_PEAK_TEST_FRAME_COUNT);
+  ags_wave_peak_propagate(wave_peak,
+			  AGS_WAVE_PEAK_TEST_X_OFFSET, AGS_WAVE_PEAK_TEST_FRAME_COUNT);
+
+  CU_ASSERT(!ags_wave_peak_get_range(wave_peak,
+				     AGS_WAVE_PEAK_TEST_X_OFFSET, AGS_WAVE_PEAK_TEST_FRAME_COUNT,
+				     &min, &max, &rms));
+
+  ags_wave_peak_unref(wave_peak);
+}
+
+int
+main(int argc, char **argv)
+{
+  CU_pSuite pSuite = NULL;
+
+  /* initialize the CUnit test registry */
+  if(CUE_SUCCESS != CU_initialize_registry()){
+    return CU_get_error();
+  }
+
+  /* add a suite to the registry */
+  pSuite = CU_add_suite("AgsWavePeakTest", ags_wave_peak_test_init_suite, ags_wave_peak_test_clean_suite);
+
+  if(pSuite == NULL){
+    CU_cleanup_registry();
+
+    return CU_get_error();
+  }
+
+  /* add the tests to the suite */
+  if((CU_add_test(pSuite, "test of AgsWavePeak alloc", ags_wave_peak_test_alloc) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsWavePeak invalidate", ags_wave_peak_test_invalidate) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsWavePeak add data", ags_wave_peak_test_add_data) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsWavePeak propagate", ags_wave_peak_test_propagate) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsWavePeak clear", ags_wave_peak_test_clear) == NULL)){
+    CU_cleanup_registry();
+
+    return CU_get_error();
+  }
+
+  /* Run all tests using the CUnit Basic interface */
+  CU_basic_set_mode(CU_BRM_VERBOSE);
+  CU_basic_run_tests();
+
+  CU_cleanup_registry();
+
+  return(CU_get_error());
+}
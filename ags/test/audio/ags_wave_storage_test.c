@@ -0,0 +1,282 @@
+/* GSequencer - Advanced GTK Sequencer
+ * Copyright (C) 2005-2026 Joël Krähemann
+ *
+ * This file is part of GSequencer.
+ *
+ * GSequencer is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GSequencer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GSequencer.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <glib.h>
+#include <glib-object.h>
+
+#include <ags/libags.h>
+#include <ags/libags-audio.h>
+
+#include <CUnit/CUnit.h>
+#include <CUnit/Automated.h>
+#include <CUnit/Basic.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+int ags_wave_storage_test_init_suite();
+int ags_wave_storage_test_clean_suite();
+
+void ags_wave_storage_test_alloc();
+void ags_wave_storage_test_alloc_mmap();
+void ags_wave_storage_test_ref();
+void ags_wave_storage_test_get_word_size();
+void ags_wave_storage_test_get_index();
+void ags_wave_storage_test_get_data();
+
+#define AGS_WAVE_STORAGE_TEST_BUFFER_SIZE (512)
+#define AGS_WAVE_STORAGE_TEST_X_OFFSET (64 * 44100)
+#define AGS_WAVE_STORAGE_TEST_BUFFER_COUNT (5513)
+
+/* The suite initialization function.
+ * Opens the temporary file used by the tests.
+ * Returns zero on success, non-zero otherwise.
+ */
+int
+ags_wave_storage_test_init_suite()
+{
+  return(0);
+}
+
+/* The suite cleanup function.
+ * Closes the temporary file used by the tests.
+ * Returns zero on success, non-zero otherwise.
+ */
+int
+ags_wave_storage_test_clean_suite()
+{
+  return(0);
+}
+
+void
+ags_wave_storage_test_alloc()
+{
+  AgsWaveStorage *wave_storage;
+
+  wave_storage = ags_wave_storage_alloc(AGS_SOUNDCARD_SIGNED_16_BIT,
+					AGS_WAVE_STORAGE_TEST_BUFFER_SIZE,
+					AGS_WAVE_STORAGE_TEST_X_OFFSET,
+					AGS_WAVE_STORAGE_TEST_BUFFER_COUNT,
+					FALSE);
+
+  CU_ASSERT(wave_storage != NULL);
+  CU_ASSERT(wave_storage->ref_count == 1);
+  CU_ASSERT(!ags_wave_storage_test_flags(wave_storage, AGS_WAVE_STORAGE_MMAP));
+  CU_ASSERT(wave_storage->word_size == sizeof(gint16));
+  CU_ASSERT(wave_storage->mmap_data == NULL);
+  CU_ASSERT(wave_storage->chunk_count == (AGS_WAVE_STORAGE_TEST_BUFFER_COUNT + wave_storage->chunk_length - 1) / wave_storage->chunk_length);
+  CU_ASSERT(wave_storage->chunk[0] == NULL);
+
+  ags_wave_storage_unref(wave_storage);
+
+  /* unsupported */
+  CU_ASSERT(ags_wave_storage_alloc(0,
+				   AGS_WAVE_STORAGE_TEST_BUFFER_SIZE,
+				   0,
+				   AGS_WAVE_STORAGE_TEST_BUFFER_COUNT,
+				   FALSE) == NULL);
+}
+
+void
+ags_wave_storage_test_alloc_mmap()
+{
+  AgsWaveStorage *wave_storage;
+
+  gchar *path;
+
+  wave_storage = ags_wave_storage_alloc(AGS_SOUNDCARD_FLOAT,
+					AGS_WAVE_STORAGE_TEST_BUFFER_SIZE,
+					AGS_WAVE_STORAGE_TEST_X_OFFSET,
+					AGS_WAVE_STORAGE_TEST_BUFFER_COUNT,
+					TRUE);
+
+  CU_ASSERT(wave_storage != NULL);
+
+#ifndef AGS_W32API
+  CU_ASSERT(ags_wave_storage_test_flags(wave_storage, AGS_WAVE_STORAGE_MMAP));
+  CU_ASSERT(wave_storage->mmap_data != NULL);
+  CU_ASSERT(wave_storage->mmap_size == AGS_WAVE_STORAGE_TEST_BUFFER_COUNT * AGS_WAVE_STORAGE_TEST_BUFFER_SIZE * sizeof(gfloat));
+  CU_ASSERT(wave_storage->chunk == NULL);
+
+  /* backed by the user's cache directory, not the system's temporary directory */
+  path = g_build_filename(g_get_user_cache_dir(),
+			  "gsequencer",
+			  "wave-storage",
+			  NULL);
+
+  CU_ASSERT(g_file_test(path, G_FILE_TEST_IS_DIR));
+
+  g_free(path);
+#endif
+
+  /* mapped data is zeroed and writable */
+  CU_ASSERT(((gfloat *) ags_wave_storage_get_data(wave_storage, AGS_WAVE_STORAGE_TEST_BUFFER_COUNT - 1))[AGS_WAVE_STORAGE_TEST_BUFFER_SIZE - 1] == 0.0);
+
+  ((gfloat *) ags_wave_storage_get_data(wave_storage, 1))[0] = 1.0;
+
+  CU_ASSERT(((gfloat *) ags_wave_storage_get_data(wave_storage, 0))[AGS_WAVE_STORAGE_TEST_BUFFER_SIZE] == 1.0);
+  
+  ags_wave_storage_unref(wave_storage);
+}
+
+void
+ags_wave_storage_test_ref()
+{
+  AgsWaveStorage *wave_storage;
+
+  wave_storage = ags_wave_storage_alloc(AGS_SOUNDCARD_SIGNED_16_BIT,
+					AGS_WAVE_STORAGE_TEST_BUFFER_SIZE,
+					0,
+					AGS_WAVE_STORAGE_TEST_BUFFER_COUNT,
+					FALSE);
+
+  CU_ASSERT(ags_wave_storage_ref(wave_storage) == wave_storage);
+  CU_ASSERT(wave_storage->ref_count == 2);
+
+  ags_wave_storage_unref(wave_storage);
+
+  CU_ASSERT(wave_storage->ref_count == 1);
+  
+  ags_wave_storage_unref(wave_storage);
+}
+
+void
+ags_wave_storage_test_get_word_size()
+{
+  CU_ASSERT(ags_wave_storage_get_word_size(AGS_SOUNDCARD_SIGNED_8_BIT) == sizeof(gint8));
+  CU_ASSERT(ags_wave_storage_get_word_size(AGS_SOUNDCARD_SIGNED_16_BIT) == sizeof(gint16));
+  CU_ASSERT(ags_wave_storage_get_word_size(AGS_SOUNDCARD_SIGNED_24_BIT) == sizeof(gint32));
+  CU_ASSERT(ags_wave_storage_get_word_size(AGS_SOUNDCARD_SIGNED_32_BIT) == sizeof(gint32));
+  CU_ASSERT(ags_wave_storage_get_word_size(AGS_SOUNDCARD_SIGNED_64_BIT) == sizeof(gint64));
+  CU_ASSERT(ags_wave_storage_get_word_size(AGS_SOUNDCARD_FLOAT) == sizeof(gfloat));
+  CU_ASSERT(ags_wave_storage_get_word_size(AGS_SOUNDCARD_DOUBLE) == sizeof(gdouble));
+  CU_ASSERT(ags_wave_storage_get_word_size(AGS_SOUNDCARD_COMPLEX) == sizeof(AgsComplex));
+  CU_ASSERT(ags_wave_storage_get_word_size(0) == 0);
+}
+
+void
+ags_wave_storage_test_get_index()
+{
+  AgsWaveStorage *wave_storage;
+
+  wave_storage = ags_wave_storage_alloc(AGS_SOUNDCARD_SIGNED_16_BIT,
+					AGS_WAVE_STORAGE_TEST_BUFFER_SIZE,
+					AGS_WAVE_STORAGE_TEST_X_OFFSET,
+					AGS_WAVE_STORAGE_TEST_BUFFER_COUNT,
+					FALSE);
+
+  CU_ASSERT(ags_wave_storage_get_index(wave_storage, AGS_WAVE_STORAGE_TEST_X_OFFSET) == 0);
+  CU_ASSERT(ags_wave_storage_get_index(wave_storage, AGS_WAVE_STORAGE_TEST_X_OFFSET + 3 * AGS_WAVE_STORAGE_TEST_BUFFER_SIZE) == 3);
+  CU_ASSERT(ags_wave_storage_get_index(wave_storage, AGS_WAVE_STORAGE_TEST_X_OFFSET + (AGS_WAVE_STORAGE_TEST_BUFFER_COUNT - 1) * AGS_WAVE_STORAGE_TEST_BUFFER_SIZE) == AGS_WAVE_STORAGE_TEST_BUFFER_COUNT - 1);
+
+  /* not aligned and out of range */
+  CU_ASSERT(ags_wave_storage_get_index(wave_storage, AGS_WAVE_STORAGE_TEST_X_OFFSET + 1) == -1);
+  CU_ASSERT(ags_wave_storage_get_index(wave_storage, AGS_WAVE_STORAGE_TEST_X_OFFSET - AGS_WAVE_STORAGE_TEST_BUFFER_SIZE) == -1);
+  CU_ASSERT(ags_wave_storage_get_index(wave_storage, AGS_WAVE_STORAGE_TEST_X_OFFSET + AGS_WAVE_STORAGE_TEST_BUFFER_COUNT * AGS_WAVE_STORAGE_TEST_BUFFER_SIZE) == -1);
+
+  ags_wave_storage_unref(wave_storage);
+}
+
+void
+ags_wave_storage_test_get_data()
+{
+  AgsWaveStorage *wave_storage;
+
+  gint16 *data, *next_data;
+  
+  guint i;
+  gboolean success;
+  
+  wave_storage = ags_wave_storage_alloc(AGS_SOUNDCARD_SIGNED_16_BIT,
+					AGS_WAVE_STORAGE_TEST_BUFFER_SIZE,
+					0,
+					AGS_WAVE_STORAGE_TEST_BUFFER_COUNT,
+					FALSE);
+
+  /* contiguous within chunk */
+  success = TRUE;
+  
+  for(i = 0; i + 1 < wave_storage->chunk_length; i++){
+    data = ags_wave_storage_get_data(wave_storage, i);
+    next_data = ags_wave_storage_get_data(wave_storage, i + 1);
+
+    if(data + AGS_WAVE_STORAGE_TEST_BUFFER_SIZE != next_data){
+      success = FALSE;
+
+      break;
+    }
+  }
+
+  CU_ASSERT(success == TRUE);
+
+  CU_ASSERT(wave_storage->chunk[0] != NULL);
+  CU_ASSERT(wave_storage->chunk[1] == NULL);
+
+  /* allocated zeroed as needed */
+  data = ags_wave_storage_get_data(wave_storage, AGS_WAVE_STORAGE_TEST_BUFFER_COUNT - 1);
+
+  CU_ASSERT(data != NULL);
+  CU_ASSERT(data[AGS_WAVE_STORAGE_TEST_BUFFER_SIZE - 1] == 0);
+  CU_ASSERT(wave_storage->chunk[wave_storage->chunk_count - 1] != NULL);
+  
+  CU_ASSERT(ags_wave_storage_get_data(wave_storage, AGS_WAVE_STORAGE_TEST_BUFFER_COUNT) == NULL);
+  
+  ags_wave_storage_unref(wave_storage);
+}
+
+int
+main(int argc, char **argv)
+{
+  CU_pSuite pSuite = NULL;
+
+  /* initialize the CUnit test registry */
+  if(CUE_SUCCESS != CU_initialize_registry()){
+    return CU_get_error();
+  }
+
+  /* add a suite to the registry */
+  pSuite = CU_add_suite("AgsWaveStorageTest", ags_wave_storage_test_init_suite, ags_wave_storage_test_clean_suite);
+
+  if(pSuite == NULL){
+    CU_cleanup_registry();
+
+    return CU_get_error();
+  }
+
+  /* add the tests to the suite */
+  if((CU_add_test(pSuite, "test of AgsWaveStorage alloc", ags_wave_storage_test_alloc) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsWaveStorage alloc mmap", ags_wave_storage_test_alloc_mmap) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsWaveStorage ref", ags_wave_storage_test_ref) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsWaveStorage get word size", ags_wave_storage_test_get_word_size) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsWaveStorage get index", ags_wave_storage_test_get_index) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsWaveStorage get data", ags_wave_storage_test_get_data) == NULL)){
+    CU_cleanup_registry();
+
+    return CU_get_error();
+  }
+
+  /* Run all tests using the CUnit Basic interface */
+  CU_basic_set_mode(CU_BRM_VERBOSE);
+  CU_basic_run_tests();
+
+  CU_cleanup_registry();
+
+  return(CU_get_error());
+}
@@ -0,0 +1,410 @@
+/* GSequencer - Advanced GTK Sequencer
+ * Copyright (C) 2005-2026 Joël Krähemann
+ *
+ * This file is part of GSequencer.
+ *
+ * GSequencer is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GSequencer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GSequencer.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <glib.h>
+#include <glib-object.h>
+
+#include <ags/libags.h>
+#include <ags/libags-audio.h>
+
+#include <CUnit/CUnit.h>
+#include <CUnit/Automated.h>
+#include <CUnit/Basic.h>
+
+#include <glib/gstdio.h>
+
+#include <stdlib.h>
+
+int ags_wave_stream_test_init_suite();
+int ags_wave_stream_test_clean_suite();
+
+gboolean ags_wave_stream_test_check_period(gint16 *data, guint64 frame_offset);
+AgsWaveStream* ags_wave_stream_test_create();
+
+void ags_wave_stream_test_new();
+void ags_wave_stream_test_fill();
+void ags_wave_stream_test_read();
+void ags_wave_stream_test_seek();
+void ags_wave_stream_test_start();
+
+#define AGS_WAVE_STREAM_TEST_SAMPLERATE (44100)
+#define AGS_WAVE_STREAM_TEST_BUFFER_SIZE (256)
+#define AGS_WAVE_STREAM_TEST_FRAME_COUNT (64 * AGS_WAVE_STREAM_TEST_BUFFER_SIZE)
+#define AGS_WAVE_STREAM_TEST_READ_AHEAD (4.0 * AGS_WAVE_STREAM_TEST_BUFFER_SIZE / AGS_WAVE_STREAM_TEST_SAMPLERATE)
+
+#define AGS_WAVE_STREAM_TEST_START_TIMEOUT (5 * G_TIME_SPAN_SECOND)
+
+gchar *filename = NULL;
+
+/* The suite initialization function.
+ * Opens the temporary file used by the tests.
+ * Returns zero on success, non-zero otherwise.
+ */
+int
+ags_wave_stream_test_init_suite()
+{
+  AgsSndfile *sndfile;
+
+  gint16 *buffer;
+
+  guint i, j;
+  
+  filename = g_build_filename(g_get_tmp_dir(),
+			      "ags_wave_stream_test.wav",
+			      NULL);
+
+  /* a mono ramp - the sample value is the frame offset */
+  sndfile = ags_sndfile_new();
+
+  if(!ags_sound_resource_rw_open(AGS_SOUND_RESOURCE(sndfile),
+				 filename,
+				 1, AGS_WAVE_STREAM_TEST_SAMPLERATE,
+				 TRUE)){
+    return(-1);
+  }
+
+  buffer = (gint16 *) ags_stream_alloc(AGS_WAVE_STREAM_TEST_BUFFER_SIZE,
+				       AGS_SOUNDCARD_SIGNED_16_BIT);
+  
+  for(i = 0; i < AGS_WAVE_STREAM_TEST_FRAME_COUNT; i += AGS_WAVE_STREAM_TEST_BUFFER_SIZE){
+    for(j = 0; j < AGS_WAVE_STREAM_TEST_BUFFER_SIZE; j++){
+      buffer[j] = (gint16) ((i + j) % G_MAXINT16);
+    }
+
+    ags_sound_resource_write(AGS_SOUND_RESOURCE(sndfile),
+			     buffer, 1,
+			     0,
+			     AGS_WAVE_STREAM_TEST_BUFFER_SIZE, AGS_SOUNDCARD_SIGNED_16_BIT);
+  }
+
+  ags_sound_resource_flush(AGS_SOUND_RESOURCE(sndfile));
+  ags_sound_resource_close(AGS_SOUND_RESOURCE(sndfile));
+
+  g_object_unref(sndfile);
+  
+  ags_stream_free(buffer);
+  
+  return(0);
+}
+
+/* The suite cleanup function.
+ * Closes the temporary file used by the tests.
+ * Returns zero on success, non-zero otherwise.
+ */
+int
+ags_wave_stream_test_clean_suite()
+{
+  g_unlink(filename);
+  
+  g_free(filename);
+
+  return(0);
+}
+
+gboolean
+ags_wave_stream_test_check_period(gint16 *data, guint64 frame_offset)
+{
+  guint i;
+
+  for(i = 0; i < AGS_WAVE_STREAM_TEST_BUFFER_SIZE; i++){
+    if(data[i] != (gint16) ((frame_offset + i) % G_MAXINT16)){
+      return(FALSE);
+    }
+  }
+
+  return(TRUE);
+}
+
+AgsWaveStream*
+ags_wave_stream_test_create()
+{
+  AgsSndfile *sndfile;
+  AgsWaveStream *wave_stream;
+
+  sndfile = ags_sndfile_new();
+  ags_sound_resource_open(AGS_SOUND_RESOURCE(sndfile),
+			  filename);
+  
+  wave_stream = ags_wave_stream_new((GObject *) sndfile,
+				    AGS_WAVE_STREAM_TEST_SAMPLERATE,
+				    AGS_WAVE_STREAM_TEST_BUFFER_SIZE,
+				    AGS_SOUNDCARD_SIGNED_16_BIT,
+				    AGS_WAVE_STREAM_TEST_READ_AHEAD);
+
+  g_object_unref(sndfile);
+
+  return(wave_stream);
+}
+
+void
+ags_wave_stream_test_new()
+{
+  AgsWaveStream *wave_stream;
+
+  wave_stream = ags_wave_stream_test_create();
+
+  CU_ASSERT(wave_stream != NULL);
+  CU_ASSERT(wave_stream->sound_resource != NULL);
+  CU_ASSERT(ags_wave_stream_get_audio_channels(wave_stream) == 1);
+  CU_ASSERT(ags_wave_stream_get_frame_count(wave_stream) == AGS_WAVE_STREAM_TEST_FRAME_COUNT);
+
+  /* memory proportional to read-ahead */
+  CU_ASSERT(wave_stream->period_count >= 4);
+  CU_ASSERT(wave_stream->channel[0].ring_buffer != NULL);
+  CU_ASSERT(wave_stream->channel[0].ring_buffer->period_count < AGS_WAVE_STREAM_TEST_FRAME_COUNT / AGS_WAVE_STREAM_TEST_BUFFER_SIZE);
+
+  g_object_unref(wave_stream);
+}
+
+void
+ags_wave_stream_test_fill()
+{
+  AgsWaveStream *wave_stream;
+
+  wave_stream = ags_wave_stream_test_create();
+
+  CU_ASSERT(ags_ring_buffer_get_readable(wave_stream->channel[0].ring_buffer) == 0);
+
+  CU_ASSERT(ags_wave_stream_fill(wave_stream) == TRUE);
+
+  CU_ASSERT(ags_ring_buffer_get_readable(wave_stream->channel[0].ring_buffer) > 0);
+  CU_ASSERT(wave_stream->channel[0].write_offset == ags_ring_buffer_get_readable(wave_stream->channel[0].ring_buffer) * AGS_WAVE_STREAM_TEST_BUFFER_SIZE);
+
+  /* ring is full */
+  CU_ASSERT(ags_wave_stream_fill(wave_stream) == FALSE);
+  
+  g_object_unref(wave_stream);
+}
+
+void
+ags_wave_stream_test_read()
+{
+  AgsWaveStream *wave_stream;
+
+  gint16 *data;
+  
+  guint64 frame_offset;
+  gboolean success;
+  
+  wave_stream = ags_wave_stream_test_create();
+
+  data = (gint16 *) ags_stream_alloc(AGS_WAVE_STREAM_TEST_BUFFER_SIZE,
+				     AGS_SOUNDCARD_SIGNED_16_BIT);
+
+  /* underrun */
+  CU_ASSERT(ags_wave_stream_read(wave_stream,
+				 0,
+				 0,
+				 data) == FALSE);
+
+  /* consume the whole stream */
+  success = TRUE;
+  
+  for(frame_offset = 0; frame_offset < AGS_WAVE_STREAM_TEST_FRAME_COUNT; frame_offset += AGS_WAVE_STREAM_TEST_BUFFER_SIZE){
+    if(!ags_wave_stream_read(wave_stream,
+			     0,
+			     frame_offset,
+			     data)){
+      ags_wave_stream_fill(wave_stream);
+      
+      if(!ags_wave_stream_read(wave_stream,
+			       0,
+			       frame_offset,
+			       data)){
+	success = FALSE;
+
+	break;
+      }
+    }
+
+    if(!ags_wave_stream_test_check_period(data, frame_offset)){
+      success = FALSE;
+
+      break;
+    }
+
+    /* read again */
+    if(!ags_wave_stream_read(wave_stream,
+			     0,
+			     frame_offset,
+			     data) ||
+       !ags_wave_stream_test_check_period(data, frame_offset)){
+      success = FALSE;
+
+      break;
+    }
+  }
+
+  CU_ASSERT(success == TRUE);
+
+  /* end of stream */
+  CU_ASSERT(ags_wave_stream_read(wave_stream,
+				 0,
+				 AGS_WAVE_STREAM_TEST_FRAME_COUNT,
+				 data) == FALSE);
+  
+  ags_stream_free(data);
+  
+  g_object_unref(wave_stream);
+}
+
+void
+ags_wave_stream_test_seek()
+{
+  AgsWaveStream *wave_stream;
+
+  gint16 *data;
+
+  guint64 frame_offset;
+  
+  wave_stream = ags_wave_stream_test_create();
+
+  data = (gint16 *) ags_stream_alloc(AGS_WAVE_STREAM_TEST_BUFFER_SIZE,
+				     AGS_SOUNDCARD_SIGNED_16_BIT);
+
+  ags_wave_stream_fill(wave_stream);
+
+  /* not following seeks */
+  frame_offset = 32 * AGS_WAVE_STREAM_TEST_BUFFER_SIZE;
+  
+  CU_ASSERT(ags_wave_stream_read(wave_stream,
+				 0,
+				 frame_offset,
+				 data) == FALSE);
+
+  CU_ASSERT(wave_stream->channel[0].seek_serial != wave_stream->channel[0].ack_serial);
+
+  /* pending */
+  CU_ASSERT(ags_wave_stream_read(wave_stream,
+				 0,
+				 frame_offset,
+				 data) == FALSE);
+
+  /* primed from the new offset */
+  ags_wave_stream_fill(wave_stream);
+
+  CU_ASSERT(wave_stream->channel[0].seek_serial == wave_stream->channel[0].ack_serial);
+  
+  CU_ASSERT(ags_wave_stream_read(wave_stream,
+				 0,
+				 frame_offset,
+				 data) == TRUE);
+  CU_ASSERT(ags_wave_stream_test_check_period(data, frame_offset) == TRUE);
+
+  CU_ASSERT(ags_wave_stream_read(wave_stream,
+				 0,
+				 frame_offset + AGS_WAVE_STREAM_TEST_BUFFER_SIZE,
+				 data) == TRUE);
+  CU_ASSERT(ags_wave_stream_test_check_period(data, frame_offset + AGS_WAVE_STREAM_TEST_BUFFER_SIZE) == TRUE);
+  
+  ags_stream_free(data);
+  
+  g_object_unref(wave_stream);
+}
+
+void
+ags_wave_stream_test_start()
+{
+  AgsWaveStream *wave_stream;
+
+  gint16 *data;
+
+  gint64 end_time;
+  gboolean success;
+  
+  wave_stream = ags_wave_stream_test_create();
+
+  data = (gint16 *) ags_stream_alloc(AGS_WAVE_STREAM_TEST_BUFFER_SIZE,
+				     AGS_SOUNDCARD_SIGNED_16_BIT);
+
+  ags_wave_stream_start(wave_stream);
+
+  CU_ASSERT(ags_wave_stream_test_flags(wave_stream, AGS_WAVE_STREAM_RUNNING) == TRUE);
+  CU_ASSERT(wave_stream->thread != NULL);
+
+  /* the read-ahead thread fills */
+  end_time = g_get_monotonic_time() + AGS_WAVE_STREAM_TEST_START_TIMEOUT;
+  
+  success = FALSE;
+  
+  while(g_get_monotonic_time() < end_time){
+    if(ags_wave_stream_read(wave_stream,
+			    0,
+			    0,
+			    data)){
+      success = TRUE;
+
+      break;
+    }
+
+    g_usleep(G_TIME_SPAN_MILLISECOND);
+  }
+
+  CU_ASSERT(success == TRUE);
+  CU_ASSERT(ags_wave_stream_test_check_period(data, 0) == TRUE);
+  
+  ags_wave_stream_stop(wave_stream);
+
+  CU_ASSERT(ags_wave_stream_test_flags(wave_stream, AGS_WAVE_STREAM_RUNNING) == FALSE);
+  CU_ASSERT(wave_stream->thread == NULL);
+
+  ags_stream_free(data);
+  
+  g_object_unref(wave_stream);
+}
+
+int
+main(int argc, char **argv)
+{
+  CU_pSuite pSuite = NULL;
+
+  /* initialize the CUnit test registry */
+  if(CUE_SUCCESS != CU_initialize_registry()){
+    return CU_get_error();
+  }
+
+  /* add a suite to the registry */
+  pSuite = CU_add_suite("AgsWaveStreamTest", ags_wave_stream_test_init_suite, ags_wave_stream_test_clean_suite);
+
+  if(pSuite == NULL){
+    CU_cleanup_registry();
+
+    return CU_get_error();
+  }
+
+  /* add the tests to the suite */
+  if((CU_add_test(pSuite, "test of AgsWaveStream new", ags_wave_stream_test_new) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsWaveStream fill", ags_wave_stream_test_fill) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsWaveStream read", ags_wave_stream_test_read) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsWaveStream seek", ags_wave_stream_test_seek) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsWaveStream start", ags_wave_stream_test_start) == NULL)){
+    CU_cleanup_registry();
+
+    return CU_get_error();
+  }
+
+  /* Run all tests using the CUnit Basic interface */
+  CU_basic_set_mode(CU_BRM_VERBOSE);
+  CU_basic_run_tests();
+
+  CU_cleanup_registry();
+
+  return(CU_get_error());
+}
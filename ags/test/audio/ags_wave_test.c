@@ -28,6 +28,7 @@
 #include <ags/libags-audio.h>
 
 #include <stdlib.h>
+#include <string.h>
 
 int ags_wave_test_init_suite();
 int ags_wave_test_clean_suite();
@@ -47,6 +48,10 @@ void ags_wave_test_copy_selection();
 void ags_wave_test_cut_selection();
 void ags_wave_test_insert_from_clipboard();
 void ags_wave_test_insert_from_clipboard_extended();
+void ags_wave_test_enable_storage();
+void ags_wave_test_find_point_storage();
+void ags_wave_test_remove_buffer_storage();
+void ags_wave_test_refresh_peak();
 
 #define AGS_WAVE_TEST_FIND_NEAR_TIMESTAMP_N_WAVE (8)
 #define AGS_WAVE_TEST_FIND_NEAR_TIMESTAMP_SAMPLERATE (44100)
@@ -78,6 +83,19 @@ void ags_wave_test_insert_from_clipboard_extended();
 #define AGS_WAVE_TEST_ADD_ALL_TO_SELECTION_BUFFER_SIZE (1024)
 #define AGS_WAVE_TEST_ADD_ALL_TO_SELECTION_COUNT (1024)
 
+#define AGS_WAVE_TEST_ENABLE_STORAGE_BUFFER_SIZE (1024)
+#define AGS_WAVE_TEST_ENABLE_STORAGE_COUNT (256)
+
+#define AGS_WAVE_TEST_FIND_POINT_STORAGE_BUFFER_SIZE (1024)
+#define AGS_WAVE_TEST_FIND_POINT_STORAGE_COUNT (1025)
+#define AGS_WAVE_TEST_FIND_POINT_STORAGE_N_ATTEMPTS (1024)
+
+#define AGS_WAVE_TEST_REMOVE_BUFFER_STORAGE_BUFFER_SIZE (1024)
+#define AGS_WAVE_TEST_REMOVE_BUFFER_STORAGE_COUNT (256)
+
+#define AGS_WAVE_TEST_REFRESH_PEAK_BUFFER_SIZE (1024)
+#define AGS_WAVE_TEST_REFRESH_PEAK_COUNT (16)
+
 AgsAudio *audio;
 
 /* The suite initialization function.
@@ -618,6 +636,346 @@ ags_wave_test_insert_from_clipboard_extended()
   //TODO:JK: implement me
 }
 
+void
+ags_wave_test_enable_storage()
+{
+  AgsWave *wave;
+  AgsBuffer *buffer;
+
+  GList *list;
+
+  guint64 x;
+  guint i;
+  gboolean success;
+
+  /* create wave */
+  wave = ags_wave_new(NULL,
+		      0);
+  g_object_set(wave,
+	       "buffer-size", AGS_WAVE_TEST_ENABLE_STORAGE_BUFFER_SIZE,
+	       NULL);
+  
+  for(i = 0; i < AGS_WAVE_TEST_ENABLE_STORAGE_COUNT; i++){
+    x = i * AGS_WAVE_TEST_ENABLE_STORAGE_BUFFER_SIZE;
+    
+    buffer = ags_buffer_new();
+    g_object_set(buffer,
+		 "buffer-size", AGS_WAVE_TEST_ENABLE_STORAGE_BUFFER_SIZE,
+		 "format", wave->format,
+		 "x", x, 
+		 NULL);
+
+    memset(buffer->data, 0xff, ags_wave_storage_get_word_size(wave->format));
+    
+    ags_wave_add_buffer(wave,
+			buffer,
+			FALSE);
+  }
+
+  /* assert enable storage */
+  ags_wave_enable_storage(wave,
+			  FALSE);
+
+  CU_ASSERT(wave->storage != NULL);
+  CU_ASSERT(wave->buffer_slot != NULL);
+
+  list = wave->buffer;
+
+  success = TRUE;
+
+  for(i = 0; list != NULL; i++){
+    buffer = list->data;
+    
+    if(buffer->storage != wave->storage ||
+       wave->buffer_slot[i] != buffer ||
+       buffer->data != ags_wave_storage_get_data(wave->storage, i) ||
+       ((guint8 *) buffer->data)[0] != 0xff){
+      success = FALSE;
+
+      break;
+    }
+
+    list = list->next;
+  }
+
+  CU_ASSERT(success == TRUE);
+
+  /* assert added buffer attached */
+  buffer = ags_buffer_new();
+  g_object_set(buffer,
+	       "buffer-size", AGS_WAVE_TEST_ENABLE_STORAGE_BUFFER_SIZE,
+	       "format", wave->format,
+	       "x", (guint64) (AGS_WAVE_TEST_ENABLE_STORAGE_COUNT * AGS_WAVE_TEST_ENABLE_STORAGE_BUFFER_SIZE), 
+	       NULL);
+
+  ags_wave_add_buffer(wave,
+		      buffer,
+		      FALSE);
+
+  CU_ASSERT(buffer->storage == wave->storage);
+  CU_ASSERT(wave->buffer_slot[AGS_WAVE_TEST_ENABLE_STORAGE_COUNT] == buffer);
+  
+  /* assert disable storage */
+  ags_wave_disable_storage(wave);
+
+  CU_ASSERT(wave->storage == NULL);
+  CU_ASSERT(wave->buffer_slot == NULL);
+
+  list = wave->buffer;
+
+  success = TRUE;
+
+  while(list != NULL){
+    buffer = list->data;
+
+    if(buffer->storage != NULL ||
+       buffer->data == NULL){
+      success = FALSE;
+
+      break;
+    }
+
+    list = list->next;
+  }
+
+  CU_ASSERT(success == TRUE);
+
+  g_object_unref(wave);
+}
+
+void
+ags_wave_test_find_point_storage()
+{
+  AgsWave *wave;
+  AgsBuffer *buffer;
+
+  GList *current;
+
+  guint64 nth;
+  guint64 x;
+  guint i;
+  gboolean success;
+
+  /* create wave */
+  wave = ags_wave_new(NULL,
+		      0);
+  g_object_set(wave,
+	       "buffer-size", AGS_WAVE_TEST_FIND_POINT_STORAGE_BUFFER_SIZE,
+	       NULL);
+
+  ags_wave_enable_storage(wave,
+			  FALSE);
+  
+  for(i = 0; i < AGS_WAVE_TEST_FIND_POINT_STORAGE_COUNT; i++){
+    x = i * AGS_WAVE_TEST_FIND_POINT_STORAGE_BUFFER_SIZE;
+    
+    buffer = ags_buffer_new();
+    g_object_set(buffer,
+		 "buffer-size", AGS_WAVE_TEST_FIND_POINT_STORAGE_BUFFER_SIZE,
+		 "format", wave->format,
+		 "x", x, 
+		 NULL);
+    
+    ags_wave_add_buffer(wave,
+			buffer,
+			FALSE);
+  }
+
+  /* assert find point - within and not aligned */
+  success = TRUE;
+
+  for(i = 0; i < AGS_WAVE_TEST_FIND_POINT_STORAGE_N_ATTEMPTS; i++){
+    nth = rand() % AGS_WAVE_TEST_FIND_POINT_STORAGE_COUNT;
+    current = g_list_nth(wave->buffer,
+			 nth);
+    
+    buffer = ags_wave_find_point(wave,
+				 AGS_BUFFER(current->data)->x + (rand() % AGS_WAVE_TEST_FIND_POINT_STORAGE_BUFFER_SIZE),
+				 FALSE);
+    
+    if(buffer != current->data){
+      success = FALSE;
+
+      break;
+    }
+  }
+
+  CU_ASSERT(success == TRUE);
+
+  /* assert find point - moved buffer falls back to list */
+  current = g_list_nth(wave->buffer,
+		       1);
+
+  g_object_set(current->data,
+	       "x", (guint64) (AGS_WAVE_TEST_FIND_POINT_STORAGE_COUNT * AGS_WAVE_TEST_FIND_POINT_STORAGE_BUFFER_SIZE),
+	       NULL);
+  
+  CU_ASSERT(ags_wave_find_point(wave,
+				AGS_WAVE_TEST_FIND_POINT_STORAGE_BUFFER_SIZE,
+				FALSE) == NULL);
+
+  g_object_unref(wave);
+}
+
+void
+ags_wave_test_remove_buffer_storage()
+{
+  AgsWave *wave;
+  AgsBuffer *buffer;
+
+  guint64 x;
+  guint i;
+
+  /* create wave */
+  wave = ags_wave_new(NULL,
+		      0);
+  g_object_set(wave,
+	       "buffer-size", AGS_WAVE_TEST_REMOVE_BUFFER_STORAGE_BUFFER_SIZE,
+	       NULL);
+
+  ags_wave_enable_storage(wave,
+			  FALSE);
+  
+  for(i = 0; i < AGS_WAVE_TEST_REMOVE_BUFFER_STORAGE_COUNT; i++){
+    x = i * AGS_WAVE_TEST_REMOVE_BUFFER_STORAGE_BUFFER_SIZE;
+    
+    buffer = ags_buffer_new();
+    g_object_set(buffer,
+		 "buffer-size", AGS_WAVE_TEST_REMOVE_BUFFER_STORAGE_BUFFER_SIZE,
+		 "format", wave->format,
+		 "x", x, 
+		 NULL);
+    
+    ags_wave_add_buffer(wave,
+			buffer,
+			FALSE);
+  }
+
+  /* assert remove detaches */
+  buffer = wave->buffer_slot[0];
+  g_object_ref(buffer);
+
+  memset(buffer->data, 0xff, ags_wave_storage_get_word_size(wave->format));
+  
+  ags_wave_remove_buffer(wave,
+			 buffer,
+			 FALSE);
+
+  CU_ASSERT(wave->buffer_slot[0] == NULL);
+  CU_ASSERT(buffer->storage == NULL);
+  CU_ASSERT(buffer->data != ags_wave_storage_get_data(wave->storage, 0));
+  CU_ASSERT(((guint8 *) buffer->data)[0] == 0xff);
+
+  CU_ASSERT(ags_wave_find_point(wave,
+				0,
+				FALSE) == NULL);
+  
+  /* assert re-added buffer attached */
+  ags_wave_add_buffer(wave,
+		      buffer,
+		      FALSE);
+
+  CU_ASSERT(wave->buffer_slot[0] == buffer);
+  CU_ASSERT(buffer->data == ags_wave_storage_get_data(wave->storage, 0));
+  CU_ASSERT(((guint8 *) buffer->data)[0] == 0xff);
+
+  /* assert remove clears the slot of a buffer detached by resizing */
+  ags_buffer_set_buffer_size(buffer,
+			     2 * AGS_WAVE_TEST_REMOVE_BUFFER_STORAGE_BUFFER_SIZE);
+
+  CU_ASSERT(buffer->storage == NULL);
+  
+  ags_wave_remove_buffer(wave,
+			 buffer,
+			 FALSE);
+
+  CU_ASSERT(wave->buffer_slot[0] == NULL);
+
+  CU_ASSERT(ags_wave_find_point(wave,
+				0,
+				FALSE) == NULL);
+
+  g_object_unref(buffer);
+  
+  g_object_unref(wave);
+}
+
+void
+ags_wave_test_refresh_peak()
+{
+  AgsWave *wave;
+  AgsBuffer *buffer;
+  AgsWavePeak *peak, *current_peak;
+
+  guint64 x;
+  guint i;
+
+  /* create wave */
+  wave = ags_wave_new(NULL,
+		      0);
+  g_object_set(wave,
+	       "buffer-size", AGS_WAVE_TEST_REFRESH_PEAK_BUFFER_SIZE,
+	       NULL);
+  
+  for(i = 0; i < AGS_WAVE_TEST_REFRESH_PEAK_COUNT; i++){
+    x = i * AGS_WAVE_TEST_REFRESH_PEAK_BUFFER_SIZE;
+    
+    buffer = ags_buffer_new();
+    g_object_set(buffer,
+		 "buffer-size", AGS_WAVE_TEST_REFRESH_PEAK_BUFFER_SIZE,
+		 "format", wave->format,
+		 "x", x, 
+		 NULL);
+
+    ags_wave_add_buffer(wave,
+			buffer,
+			FALSE);
+  }
+
+  /* assert built */
+  CU_ASSERT(ags_wave_get_peak(wave) == NULL);
+  
+  ags_wave_refresh_peak(wave);
+
+  peak = ags_wave_get_peak(wave);
+
+  CU_ASSERT(peak != NULL);
+  CU_ASSERT(!ags_wave_peak_is_dirty(peak));
+  CU_ASSERT(wave->peak_dirty == 0);
+
+  /* assert dirty range published in bins */
+  ags_wave_invalidate_peak(wave,
+			   AGS_WAVE_PEAK_DIRTY_BIN_LENGTH + 1, 1);
+
+  CU_ASSERT((wave->peak_dirty >> 32) == 1);
+  CU_ASSERT((wave->peak_dirty & G_MAXUINT32) == 2);
+
+  ags_wave_invalidate_peak(wave,
+			   0, 1);
+
+  CU_ASSERT((wave->peak_dirty >> 32) == 0);
+  CU_ASSERT((wave->peak_dirty & G_MAXUINT32) == 2);
+
+  /* assert replaced, the finished peak unmodified */
+  ags_wave_refresh_peak(wave);
+
+  current_peak = ags_wave_get_peak(wave);
+
+  CU_ASSERT(current_peak != NULL);
+  CU_ASSERT(current_peak != peak);
+  CU_ASSERT(!ags_wave_peak_is_dirty(peak));
+  CU_ASSERT(!ags_wave_peak_is_dirty(current_peak));
+  CU_ASSERT(wave->peak_dirty == 0);
+
+  /* assert clean not queued */
+  CU_ASSERT(ags_wave_queue_refresh_peak(wave) == FALSE);
+  
+  ags_wave_peak_unref(peak);
+  ags_wave_peak_unref(current_peak);
+  
+  g_object_unref(wave);
+}
+
 int
 main(int argc, char **argv)
 {
@@ -655,7 +1013,11 @@ main(int argc, char **argv)
      (CU_add_test(pSuite, "test of AgsWave copy selection", ags_wave_test_copy_selection) == NULL) ||
      (CU_add_test(pSuite, "test of AgsWave cut selection", ags_wave_test_cut_selection) == NULL) ||
      (CU_add_test(pSuite, "test of AgsWave insert from clipboard", ags_wave_test_insert_from_clipboard) == NULL) ||
-     (CU_add_test(pSuite, "test of AgsWave insert from clipboard extended", ags_wave_test_insert_from_clipboard_extended) == NULL)){
+     (CU_add_test(pSuite, "test of AgsWave insert from clipboard extended", ags_wave_test_insert_from_clipboard_extended) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsWave enable storage", ags_wave_test_enable_storage) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsWave find point storage", ags_wave_test_find_point_storage) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsWave remove buffer storage", ags_wave_test_remove_buffer_storage) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsWave refresh peak", ags_wave_test_refresh_peak) == NULL)){
     CU_cleanup_registry();
     
     return CU_get_error();
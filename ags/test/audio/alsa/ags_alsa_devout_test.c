@@ -29,6 +29,11 @@
 
 #include <string.h>
 
+#define AGS_ALSA_DEVOUT_TEST_PLAY_MMAP_DEVICE "hw:Loopback"
+#define AGS_ALSA_DEVOUT_TEST_PLAY_MMAP_FALLBACK_DEVICE "null"
+#define AGS_ALSA_DEVOUT_TEST_PLAY_MMAP_N_PERIODS (64)
+#define AGS_ALSA_DEVOUT_TEST_PLAY_MMAP_UNDERRUN_TIME (G_USEC_PER_SEC / 2)
+
 int ags_alsa_devout_test_init_suite();
 int ags_alsa_devout_test_clean_suite();
 
@@ -46,6 +51,7 @@ void ags_alsa_devout_test_is_recording();
 void ags_alsa_devout_test_get_uptime();
 void ags_alsa_devout_test_play_init();
 void ags_alsa_devout_test_play();
+void ags_alsa_devout_test_play_mmap();
 void ags_alsa_devout_test_record_init();
 void ags_alsa_devout_test_record();
 void ags_alsa_devout_test_stop();
@@ -364,6 +370,104 @@ ags_alsa_devout_test_play()
   ags_soundcard_stop(AGS_SOUNDCARD(alsa_devout));
 }
 
+void
+ags_alsa_devout_test_play_mmap()
+{
+#if defined(AGS_WITH_ALSA)
+  AgsAlsaDevout *alsa_devout;
+
+  snd_pcm_t *handle;
+  
+  snd_pcm_sframes_t avail;
+  snd_pcm_state_t state;
+  
+  GError *error;
+
+  guint i;
+  gboolean success;
+  
+  alsa_devout = ags_alsa_devout_new();
+
+  /* prefer the loopback card, its clock underruns like hardware does */
+  handle = NULL;
+  
+  g_free(alsa_devout->device);
+  
+  if(snd_pcm_open(&handle, AGS_ALSA_DEVOUT_TEST_PLAY_MMAP_DEVICE, SND_PCM_STREAM_PLAYBACK, 0) >= 0){
+    snd_pcm_close(handle);
+    
+    alsa_devout->device = g_strdup(AGS_ALSA_DEVOUT_TEST_PLAY_MMAP_DEVICE);
+  }else{
+    alsa_devout->device = g_strdup(AGS_ALSA_DEVOUT_TEST_PLAY_MMAP_FALLBACK_DEVICE);
+  }
+  
+  ags_alsa_devout_set_flags(alsa_devout,
+			    AGS_ALSA_DEVOUT_MMAP);
+
+  error = NULL;
+  ags_soundcard_play_init(AGS_SOUNDCARD(alsa_devout),
+			  &error);
+
+  CU_ASSERT(error == NULL);
+  CU_ASSERT(alsa_devout->handle != NULL);
+  CU_ASSERT(ags_alsa_devout_test_flags(alsa_devout, AGS_ALSA_DEVOUT_MMAP));
+  
+  if(alsa_devout->handle == NULL){
+    g_object_unref(alsa_devout);
+    
+    return;
+  }
+
+  /* avail and commit - every period is committed in full */
+  success = TRUE;
+  
+  for(i = 0; i < AGS_ALSA_DEVOUT_TEST_PLAY_MMAP_N_PERIODS; i++){
+    error = NULL;
+    ags_soundcard_play(AGS_SOUNDCARD(alsa_devout),
+		       &error);
+
+    if(alsa_devout->rc != alsa_devout->buffer_size){
+      success = FALSE;
+
+      break;
+    }
+
+    avail = snd_pcm_avail_update(alsa_devout->handle);
+
+    if(avail < 0){
+      success = FALSE;
+
+      break;
+    }
+  }
+
+  CU_ASSERT(success == TRUE);
+
+  state = snd_pcm_state(alsa_devout->handle);
+  
+  CU_ASSERT(state == SND_PCM_STATE_RUNNING ||
+	    state == SND_PCM_STATE_PREPARED);
+  
+  /* underrun - starve the stream, the next period recovers */
+  g_usleep(AGS_ALSA_DEVOUT_TEST_PLAY_MMAP_UNDERRUN_TIME);
+
+  error = NULL;
+  ags_soundcard_play(AGS_SOUNDCARD(alsa_devout),
+		     &error);
+
+  CU_ASSERT(alsa_devout->rc == alsa_devout->buffer_size);
+
+  state = snd_pcm_state(alsa_devout->handle);
+  
+  CU_ASSERT(state == SND_PCM_STATE_RUNNING ||
+	    state == SND_PCM_STATE_PREPARED);
+  
+  ags_soundcard_stop(AGS_SOUNDCARD(alsa_devout));
+
+  g_object_unref(alsa_devout);
+#endif
+}
+
 void
 ags_alsa_devout_test_record_init()
 {
@@ -685,6 +789,7 @@ main(int argc, char **argv)
      (CU_add_test(pSuite, "test of AgsAlsaDevout get uptime", ags_alsa_devout_test_get_uptime) == NULL) ||
      (CU_add_test(pSuite, "test of AgsAlsaDevout play init", ags_alsa_devout_test_play_init) == NULL) ||
      (CU_add_test(pSuite, "test of AgsAlsaDevout play", ags_alsa_devout_test_play) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsAlsaDevout play mmap", ags_alsa_devout_test_play_mmap) == NULL) ||
      (CU_add_test(pSuite, "test of AgsAlsaDevout record init", ags_alsa_devout_test_record_init) == NULL) ||
      (CU_add_test(pSuite, "test of AgsAlsaDevout record", ags_alsa_devout_test_record) == NULL) ||
      (CU_add_test(pSuite, "test of AgsAlsaDevout stop", ags_alsa_devout_test_stop) == NULL) ||
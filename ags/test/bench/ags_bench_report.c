@@ -0,0 +1,446 @@
+/* GSequencer - Advanced GTK Sequencer
+ * Copyright (C) 2005-2026 Joël Krähemann
+ *
+ * This file is part of GSequencer.
+ *
+ * GSequencer is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GSequencer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GSequencer.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "ags_bench_report.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/**
+ * SECTION:ags_bench_report
+ * @short_description: benchmark report
+ * @title: AgsBenchReport
+ * @section_id:
+ * @include: ags/test/bench/ags_bench_report.h
+ *
+ * The #AgsBenchReport-struct collects benchmark results as JSON and compares
+ * them to a baseline file written by an earlier run. A result is counted as
+ * regression if its ns per frame exceeds the baseline by more than the
+ * tolerance. A result without baseline can't be compared, so the regression
+ * gate rejects it by ags_bench_report_check_baseline().
+ */
+
+/**
+ * ags_bench_report_get_time:
+ *
+ * Get monotonic time in nanoseconds.
+ *
+ * Returns: the time in nanoseconds
+ *
+ * Since: 9.1.0
+ */
+gint64
+ags_bench_report_get_time()
+{
+  struct timespec time_now;
+
+  clock_gettime(CLOCK_MONOTONIC, &time_now);
+
+  return(((gint64) time_now.tv_sec * 1000000000) + (gint64) time_now.tv_nsec);
+}
+
+/**
+ * ags_bench_report_load_baseline:
+ * @bench_report: the #AgsBenchReport-struct
+ * @filename: the baseline filename
+ * @error: return location of #GError-struct
+ *
+ * Load baseline results of @filename. Results missing ns per frame are
+ * ignored.
+ *
+ * Returns: %TRUE on success, otherwise %FALSE
+ *
+ * Since: 9.1.0
+ */
+gboolean
+ags_bench_report_load_baseline(AgsBenchReport *bench_report,
+			       gchar *filename,
+			       GError **error)
+{
+  JsonParser *parser;
+  JsonNode *root_node;
+  JsonObject *root_object;
+  JsonArray *result_array;
+
+  guint i, i_stop;
+  
+  if(bench_report == NULL ||
+     filename == NULL){
+    return(FALSE);
+  }
+
+  parser = json_parser_new();
+
+  if(!json_parser_load_from_file(parser,
+				 filename,
+				 error)){
+    g_object_unref(parser);
+
+    return(FALSE);
+  }
+
+  root_node = json_parser_get_root(parser);
+
+  if(root_node == NULL ||
+     !JSON_NODE_HOLDS_OBJECT(root_node)){
+    g_object_unref(parser);
+
+    return(FALSE);
+  }
+
+  root_object = json_node_get_object(root_node);
+
+  if(!json_object_has_member(root_object, "results")){
+    g_object_unref(parser);
+
+    return(FALSE);
+  }
+  
+  result_array = json_object_get_array_member(root_object,
+					      "results");
+
+  i_stop = json_array_get_length(result_array);
+  
+  for(i = 0; i < i_stop; i++){
+    JsonObject *result_object;
+
+    gdouble *ns_per_frame;
+    
+    result_object = json_array_get_object_element(result_array,
+						  i);
+
+    if(result_object == NULL ||
+       !json_object_has_member(result_object, "name") ||
+       !json_object_has_member(result_object, "ns-per-frame")){
+      continue;
+    }
+
+    ns_per_frame = (gdouble *) g_malloc(sizeof(gdouble));
+    ns_per_frame[0] = json_object_get_double_member(result_object,
+						    "ns-per-frame");
+    
+    g_hash_table_insert(bench_report->baseline,
+			g_strdup(json_object_get_string_member(result_object,
+							       "name")),
+			ns_per_frame);
+  }
+  
+  g_object_unref(parser);
+
+  return(TRUE);
+}
+
+/**
+ * ags_bench_report_check_baseline:
+ * @bench_report: the #AgsBenchReport-struct
+ *
+ * Check every result was compared to baseline. Fails if no baseline was
+ * loaded, it was empty or a result is missing from it.
+ *
+ * Returns: %TRUE if every result has baseline, otherwise %FALSE
+ *
+ * Since: 9.1.0
+ */
+gboolean
+ags_bench_report_check_baseline(AgsBenchReport *bench_report)
+{
+  if(bench_report == NULL){
+    return(FALSE);
+  }
+
+  if(g_hash_table_size(bench_report->baseline) == 0){
+    g_warning("no baseline, regenerate it with --output");
+    
+    return(FALSE);
+  }
+
+  if(bench_report->missing_baseline_count > 0){
+    g_warning("%u results missing from baseline, regenerate it with --output", bench_report->missing_baseline_count);
+    
+    return(FALSE);
+  }
+
+  return(TRUE);
+}
+
+/**
+ * ags_bench_report_begin_result:
+ * @bench_report: the #AgsBenchReport-struct
+ * @result_name: the result's name
+ *
+ * Begin result @result_name. Additional members might be added to the
+ * returned #JsonBuilder until ags_bench_report_end_result() is called.
+ *
+ * Returns: (transfer none): the #JsonBuilder
+ *
+ * Since: 9.1.0
+ */
+JsonBuilder*
+ags_bench_report_begin_result(AgsBenchReport *bench_report,
+			      gchar *result_name)
+{
+  if(bench_report == NULL){
+    return(NULL);
+  }
+  
+  json_builder_begin_object(bench_report->builder);
+
+  json_builder_set_member_name(bench_report->builder,
+			       "name");
+  json_builder_add_string_value(bench_report->builder,
+				result_name);
+
+  return(bench_report->builder);
+}
+
+/**
+ * ags_bench_report_end_result:
+ * @bench_report: the #AgsBenchReport-struct
+ * @result_name: the result's name
+ * @ns_per_frame: the measured nanoseconds per frame
+ *
+ * End result @result_name and compare @ns_per_frame to baseline.
+ *
+ * Returns: %TRUE if the result is a regression, otherwise %FALSE
+ *
+ * Since: 9.1.0
+ */
+gboolean
+ags_bench_report_end_result(AgsBenchReport *bench_report,
+			    gchar *result_name,
+			    gdouble ns_per_frame)
+{
+  gdouble *baseline_ns_per_frame;
+
+  gdouble frames_per_second;
+  gboolean is_regression;
+  
+  if(bench_report == NULL){
+    return(FALSE);
+  }
+
+  frames_per_second = 0.0;
+
+  if(ns_per_frame > 0.0){
+    frames_per_second = 1000000000.0 / ns_per_frame;
+  }
+  
+  json_builder_set_member_name(bench_report->builder,
+			       "ns-per-frame");
+  json_builder_add_double_value(bench_report->builder,
+				ns_per_frame);
+
+  json_builder_set_member_name(bench_report->builder,
+			       "frames-per-second");
+  json_builder_add_double_value(bench_report->builder,
+				frames_per_second);
+
+  is_regression = FALSE;
+  
+  baseline_ns_per_frame = g_hash_table_lookup(bench_report->baseline,
+					      result_name);
+
+  if(baseline_ns_per_frame != NULL &&
+     baseline_ns_per_frame[0] > 0.0){
+    gdouble ratio;
+
+    ratio = ns_per_frame / baseline_ns_per_frame[0];
+
+    is_regression = (ratio > 1.0 + (bench_report->tolerance / 100.0)) ? TRUE: FALSE;
+    
+    json_builder_set_member_name(bench_report->builder,
+				 "baseline-ns-per-frame");
+    json_builder_add_double_value(bench_report->builder,
+				  baseline_ns_per_frame[0]);
+
+    json_builder_set_member_name(bench_report->builder,
+				 "baseline-ratio");
+    json_builder_add_double_value(bench_report->builder,
+				  ratio);
+
+    json_builder_set_member_name(bench_report->builder,
+				 "regression");
+    json_builder_add_boolean_value(bench_report->builder,
+				   is_regression);
+  }else{
+    bench_report->missing_baseline_count += 1;
+  }
+  
+  json_builder_end_object(bench_report->builder);
+
+  bench_report->result_count += 1;
+
+  if(is_regression){
+    bench_report->regression_count += 1;
+  }
+  
+  return(is_regression);
+}
+
+/**
+ * ags_bench_report_write:
+ * @bench_report: the #AgsBenchReport-struct
+ * @filename: (nullable): the filename or %NULL for standard output
+ * @error: return location of #GError-struct
+ *
+ * Finish @bench_report and write it as JSON to @filename. The output can be
+ * used as baseline of later runs.
+ *
+ * Returns: %TRUE on success, otherwise %FALSE
+ *
+ * Since: 9.1.0
+ */
+gboolean
+ags_bench_report_write(AgsBenchReport *bench_report,
+		       gchar *filename,
+		       GError **error)
+{
+  JsonGenerator *generator;
+  JsonNode *root_node;
+
+  gboolean success;
+  
+  if(bench_report == NULL){
+    return(FALSE);
+  }
+
+  json_builder_end_array(bench_report->builder);
+
+  json_builder_set_member_name(bench_report->builder,
+			       "tolerance");
+  json_builder_add_double_value(bench_report->builder,
+				bench_report->tolerance);
+
+  json_builder_set_member_name(bench_report->builder,
+			       "result-count");
+  json_builder_add_int_value(bench_report->builder,
+			     bench_report->result_count);
+
+  json_builder_set_member_name(bench_report->builder,
+			       "regression-count");
+  json_builder_add_int_value(bench_report->builder,
+			     bench_report->regression_count);
+
+  json_builder_set_member_name(bench_report->builder,
+			       "missing-baseline-count");
+  json_builder_add_int_value(bench_report->builder,
+			     bench_report->missing_baseline_count);
+  
+  json_builder_end_object(bench_report->builder);
+
+  root_node = json_builder_get_root(bench_report->builder);
+  
+  generator = json_generator_new();
+  json_generator_set_pretty(generator,
+			    TRUE);
+  json_generator_set_root(generator,
+			  root_node);
+
+  success = TRUE;
+  
+  if(filename != NULL){
+    success = json_generator_to_file(generator,
+				     filename,
+				     error);
+  }else{
+    gchar *data;
+
+    data = json_generator_to_data(generator,
+				  NULL);
+
+    g_print("%s\n", data);
+
+    g_free(data);
+  }
+
+  json_node_unref(root_node);
+  g_object_unref(generator);
+
+  return(success);
+}
+
+/**
+ * ags_bench_report_alloc:
+ * @name: the benchmark suite's name
+ *
+ * Allocate #AgsBenchReport-struct.
+ *
+ * Returns: the newly allocated #AgsBenchReport-struct
+ *
+ * Since: 9.1.0
+ */
+AgsBenchReport*
+ags_bench_report_alloc(gchar *name)
+{
+  AgsBenchReport *bench_report;
+
+  bench_report = (AgsBenchReport *) g_malloc(sizeof(AgsBenchReport));
+
+  bench_report->name = g_strdup(name);
+
+  bench_report->builder = json_builder_new();
+
+  bench_report->baseline = g_hash_table_new_full(g_str_hash, g_str_equal,
+						 g_free,
+						 g_free);
+  bench_report->tolerance = AGS_BENCH_REPORT_DEFAULT_TOLERANCE;
+
+  bench_report->result_count = 0;
+  bench_report->regression_count = 0;
+  bench_report->missing_baseline_count = 0;
+
+  json_builder_begin_object(bench_report->builder);
+
+  json_builder_set_member_name(bench_report->builder,
+			       "benchmark");
+  json_builder_add_string_value(bench_report->builder,
+				name);
+
+  json_builder_set_member_name(bench_report->builder,
+			       "results");
+  json_builder_begin_array(bench_report->builder);
+  
+  return(bench_report);
+}
+
+/**
+ * ags_bench_report_free:
+ * @bench_report: the #AgsBenchReport-struct
+ *
+ * Free @bench_report.
+ *
+ * Since: 9.1.0
+ */
+void
+ags_bench_report_free(AgsBenchReport *bench_report)
+{
+  if(bench_report == NULL){
+    return;
+  }
+
+  g_free(bench_report->name);
+
+  g_object_unref(bench_report->builder);
+
+  g_hash_table_destroy(bench_report->baseline);
+
+  g_free(bench_report);
+}
@@ -0,0 +1,85 @@
+/* GSequencer - Advanced GTK Sequencer
+ * Copyright (C) 2005-2026 Joël Krähemann
+ *
+ * This file is part of GSequencer.
+ *
+ * GSequencer is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GSequencer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GSequencer.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef __AGS_BENCH_REPORT_H__
+#define __AGS_BENCH_REPORT_H__
+
+#include <glib.h>
+#include <glib-object.h>
+
+#include <json-glib/json-glib.h>
+
+G_BEGIN_DECLS
+
+#define AGS_BENCH_REPORT(ptr) ((AgsBenchReport *)(ptr))
+
+#define AGS_BENCH_REPORT_DEFAULT_TOLERANCE (10.0)
+
+typedef struct _AgsBenchReport AgsBenchReport;
+
+/**
+ * AgsBenchReport:
+ * @name: the benchmark suite's name
+ * @builder: the #JsonBuilder collecting the results
+ * @baseline: the baseline ns per frame by result name
+ * @tolerance: the tolerated slow down in percent
+ * @result_count: the number of results
+ * @regression_count: the number of results slower than baseline
+ * @missing_baseline_count: the number of results without baseline
+ *
+ * Machine-readable report of a benchmark suite.
+ */
+struct _AgsBenchReport
+{
+  gchar *name;
+
+  JsonBuilder *builder;
+
+  GHashTable *baseline;
+  gdouble tolerance;
+
+  guint result_count;
+  guint regression_count;
+  guint missing_baseline_count;
+};
+
+gint64 ags_bench_report_get_time();
+
+gboolean ags_bench_report_load_baseline(AgsBenchReport *bench_report,
+					gchar *filename,
+					GError **error);
+gboolean ags_bench_report_check_baseline(AgsBenchReport *bench_report);
+
+JsonBuilder* ags_bench_report_begin_result(AgsBenchReport *bench_report,
+					   gchar *result_name);
+gboolean ags_bench_report_end_result(AgsBenchReport *bench_report,
+				     gchar *result_name,
+				     gdouble ns_per_frame);
+
+gboolean ags_bench_report_write(AgsBenchReport *bench_report,
+				gchar *filename,
+				GError **error);
+
+AgsBenchReport* ags_bench_report_alloc(gchar *name);
+void ags_bench_report_free(AgsBenchReport *bench_report);
+
+G_END_DECLS
+
+#endif /*__AGS_BENCH_REPORT_H__*/
@@ -0,0 +1,1183 @@
+/* GSequencer - Advanced GTK Sequencer
+ * Copyright (C) 2005-2026 Joël Krähemann
+ *
+ * This file is part of GSequencer.
+ *
+ * GSequencer is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GSequencer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GSequencer.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <glib.h>
+#include <glib-object.h>
+
+#include <ags/libags.h>
+#include <ags/libags-audio.h>
+
+#include "ags_bench_report.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef void (*AgsDspUtilBenchFunc)(gpointer data);
+
+typedef struct _AgsDspUtilBenchFormat AgsDspUtilBenchFormat;
+typedef struct _AgsDspUtilBenchCopy AgsDspUtilBenchCopy;
+typedef struct _AgsDspUtilBenchRecall AgsDspUtilBenchRecall;
+
+struct _AgsDspUtilBenchFormat
+{
+  guint format;
+  gchar *name;
+};
+
+struct _AgsDspUtilBenchCopy
+{
+  AgsAudioBufferUtil *audio_buffer_util;
+
+  gpointer destination;
+  gpointer source;
+
+  guint copy_mode;
+};
+
+struct _AgsDspUtilBenchRecall
+{
+  AgsRecall *recall_audio_signal;
+
+  guint voice_count;
+};
+
+void ags_dsp_util_bench_run(AgsBenchReport *bench_report,
+			    gchar *name,
+			    AgsDspUtilBenchFunc func, gpointer data);
+
+void ags_dsp_util_bench_fill_source(gpointer source,
+				    guint format);
+
+void ags_dsp_util_bench_copy_func(AgsDspUtilBenchCopy *copy);
+
+void ags_dsp_util_bench_recall_g_object_get_func(AgsDspUtilBenchRecall *recall);
+void ags_dsp_util_bench_recall_rt_view_func(AgsDspUtilBenchRecall *recall);
+
+void ags_dsp_util_bench_audio_buffer_util(AgsBenchReport *bench_report);
+void ags_dsp_util_bench_volume_util(AgsBenchReport *bench_report);
+void ags_dsp_util_bench_envelope_util(AgsBenchReport *bench_report);
+void ags_dsp_util_bench_synth_util(AgsBenchReport *bench_report);
+void ags_dsp_util_bench_fm_synth_util(AgsBenchReport *bench_report);
+void ags_dsp_util_bench_sf2_synth_util(AgsBenchReport *bench_report);
+void ags_dsp_util_bench_resample_util(AgsBenchReport *bench_report);
+void ags_dsp_util_bench_hq_pitch_util(AgsBenchReport *bench_report);
+void ags_dsp_util_bench_amplifier10_util(AgsBenchReport *bench_report);
+void ags_dsp_util_bench_fluid_iir_filter_util(AgsBenchReport *bench_report);
+void ags_dsp_util_bench_recall_lookup(AgsBenchReport *bench_report);
+
+#define AGS_DSP_UTIL_BENCH_DEFAULT_BUFFER_SIZE (512)
+#define AGS_DSP_UTIL_BENCH_DEFAULT_SAMPLERATE (48000)
+#define AGS_DSP_UTIL_BENCH_DEFAULT_TARGET_SAMPLERATE (44100)
+#define AGS_DSP_UTIL_BENCH_DEFAULT_MIN_TIME (100)
+
+#define AGS_DSP_UTIL_BENCH_WARMUP_COUNT (16)
+#define AGS_DSP_UTIL_BENCH_BATCH_COUNT (16)
+
+#define AGS_DSP_UTIL_BENCH_FREQUENCY (440.0)
+
+#define AGS_DSP_UTIL_BENCH_FORMAT_COUNT (7)
+
+#define AGS_DSP_UTIL_BENCH_VOICE_COUNT (64)
+
+#define AGS_DSP_UTIL_BENCH_DEFAULT_SF2_FILENAME "/usr/share/sounds/sf2/FluidR3_GM.sf2"
+#define AGS_DSP_UTIL_BENCH_DEFAULT_SF2_PRESET "Yamaha Grand Piano"
+#define AGS_DSP_UTIL_BENCH_DEFAULT_SF2_INSTRUMENT "Yamaha Grand Piano"
+
+AgsDspUtilBenchFormat ags_dsp_util_bench_format[] = {
+  {AGS_SOUNDCARD_SIGNED_8_BIT, "s8"},
+  {AGS_SOUNDCARD_SIGNED_16_BIT, "s16"},
+  {AGS_SOUNDCARD_SIGNED_24_BIT, "s24"},
+  {AGS_SOUNDCARD_SIGNED_32_BIT, "s32"},
+  {AGS_SOUNDCARD_SIGNED_64_BIT, "s64"},
+  {AGS_SOUNDCARD_FLOAT, "float"},
+  {AGS_SOUNDCARD_DOUBLE, "double"},
+};
+
+gchar *filter = NULL;
+
+guint buffer_size = AGS_DSP_UTIL_BENCH_DEFAULT_BUFFER_SIZE;
+guint samplerate = AGS_DSP_UTIL_BENCH_DEFAULT_SAMPLERATE;
+
+gint64 min_time = AGS_DSP_UTIL_BENCH_DEFAULT_MIN_TIME * 1000000;
+
+void
+ags_dsp_util_bench_run(AgsBenchReport *bench_report,
+		       gchar *name,
+		       AgsDspUtilBenchFunc func, gpointer data)
+{
+  JsonBuilder *builder;
+
+  gint64 start_time, duration;
+  guint64 iteration_count;
+  gdouble ns_per_frame;
+  gboolean is_regression;
+  guint i;
+  
+  if(filter != NULL &&
+     strstr(name, filter) == NULL){
+    return;
+  }
+
+  for(i = 0; i < AGS_DSP_UTIL_BENCH_WARMUP_COUNT; i++){
+    func(data);
+  }
+
+  iteration_count = 0;
+  
+  start_time = ags_bench_report_get_time();
+
+  do{
+    for(i = 0; i < AGS_DSP_UTIL_BENCH_BATCH_COUNT; i++){
+      func(data);
+    }
+
+    iteration_count += AGS_DSP_UTIL_BENCH_BATCH_COUNT;
+    
+    duration = ags_bench_report_get_time() - start_time;
+  }while(duration < min_time);
+
+  ns_per_frame = (gdouble) duration / ((gdouble) iteration_count * (gdouble) buffer_size);
+
+  builder = ags_bench_report_begin_result(bench_report,
+					  name);
+
+  json_builder_set_member_name(builder,
+			       "iterations");
+  json_builder_add_int_value(builder,
+			     iteration_count);
+  
+  is_regression = ags_bench_report_end_result(bench_report,
+					      name,
+					      ns_per_frame);
+
+  g_message("%s - %.3f ns/frame, %.0f frames/s%s",
+	    name,
+	    ns_per_frame,
+	    1000000000.0 / ns_per_frame,
+	    (is_regression ? " - regression": ""));
+}
+
+void
+ags_dsp_util_bench_fill_source(gpointer source,
+			       guint format)
+{
+  AgsSynthUtil *synth_util;
+
+  synth_util = ags_synth_util_alloc();
+
+  ags_synth_util_set_source(synth_util,
+			    source);
+  ags_synth_util_set_buffer_length(synth_util,
+				   buffer_size);
+  ags_synth_util_set_format(synth_util,
+			    format);
+  ags_synth_util_set_samplerate(synth_util,
+				samplerate);
+  ags_synth_util_set_frequency(synth_util,
+			       AGS_DSP_UTIL_BENCH_FREQUENCY);
+  ags_synth_util_set_volume(synth_util,
+			    0.8);
+  ags_synth_util_set_frame_count(synth_util,
+				 buffer_size);
+
+  ags_synth_util_compute_sin(synth_util);
+
+  ags_synth_util_free(synth_util);
+}
+
+void
+ags_dsp_util_bench_copy_func(AgsDspUtilBenchCopy *copy)
+{
+  ags_audio_buffer_util_copy_buffer_to_buffer(copy->audio_buffer_util,
+					      copy->destination, 1, 0,
+					      copy->source, 1, 0,
+					      buffer_size, copy->copy_mode);
+}
+
+void
+ags_dsp_util_bench_recall_g_object_get_func(AgsDspUtilBenchRecall *recall)
+{
+  guint i;
+
+  /* per voice staging lookup as done by g_object_get() */
+  for(i = 0; i < recall->voice_count; i++){
+    AgsRecall *recall_recycling, *recall_channel_run;
+    AgsRecall *recall_audio, *recall_channel;
+    AgsAudioSignal *source;
+
+    guint buffer_size;
+    AgsSoundcardFormat format;
+    
+    recall_recycling = NULL;
+    recall_channel_run = NULL;
+
+    recall_audio = NULL;
+    recall_channel = NULL;
+
+    source = NULL;
+    
+    g_object_get(recall->recall_audio_signal,
+		 "parent", &recall_recycling,
+		 "source", &source,
+		 NULL);
+
+    g_object_get(recall_recycling,
+		 "parent", &recall_channel_run,
+		 NULL);
+
+    g_object_get(recall_channel_run,
+		 "recall-audio", &recall_audio,
+		 "recall-channel", &recall_channel,
+		 NULL);
+
+    g_object_get(source,
+		 "buffer-size", &buffer_size,
+		 "format", &format,
+		 NULL);
+
+    g_object_unref(source);
+
+    g_object_unref(recall_audio);
+    g_object_unref(recall_channel);
+
+    g_object_unref(recall_channel_run);
+    g_object_unref(recall_recycling);
+  }
+}
+
+void
+ags_dsp_util_bench_recall_rt_view_func(AgsDspUtilBenchRecall *recall)
+{
+  guint i;
+
+  /* per voice staging lookup as done by AgsRecallRtView */
+  for(i = 0; i < recall->voice_count; i++){
+    AgsRecall *recall_recycling, *recall_channel_run;
+    AgsRecall *recall_audio, *recall_channel;
+    AgsAudioSignal *source;
+
+    volatile guint buffer_size;
+    volatile AgsSoundcardFormat format;
+
+    GRecMutex *source_mutex;
+    
+    recall_recycling = AGS_RECALL_RT_VIEW(recall->recall_audio_signal)->parent;
+    source = (AgsAudioSignal *) AGS_RECALL_RT_VIEW(recall->recall_audio_signal)->source;
+
+    recall_channel_run = AGS_RECALL_RT_VIEW(recall_recycling)->parent;
+
+    recall_audio = AGS_RECALL_RT_VIEW(recall_channel_run)->recall_audio;
+    recall_channel = AGS_RECALL_RT_VIEW(recall_channel_run)->recall_channel;
+
+    if(recall_audio == NULL ||
+       recall_channel == NULL){
+      continue;
+    }
+    
+    source_mutex = AGS_AUDIO_SIGNAL_GET_OBJ_MUTEX(source);
+
+    g_rec_mutex_lock(source_mutex);
+
+    buffer_size = source->buffer_size;
+    format = source->format;
+    
+    g_rec_mutex_unlock(source_mutex);
+  }
+}
+
+void
+ags_dsp_util_bench_audio_buffer_util(AgsBenchReport *bench_report)
+{
+  AgsDspUtilBenchCopy copy;
+
+  guint i, j;
+
+  copy.audio_buffer_util = ags_audio_buffer_util_alloc();
+  
+  for(i = 0; i < AGS_DSP_UTIL_BENCH_FORMAT_COUNT; i++){
+    for(j = 0; j < AGS_DSP_UTIL_BENCH_FORMAT_COUNT; j++){
+      gchar *name;
+
+      copy.destination = ags_stream_alloc(buffer_size,
+					  ags_dsp_util_bench_format[i].format);
+      copy.source = ags_stream_alloc(buffer_size,
+				     ags_dsp_util_bench_format[j].format);
+
+      ags_dsp_util_bench_fill_source(copy.source,
+				     ags_dsp_util_bench_format[j].format);
+
+      copy.copy_mode = ags_audio_buffer_util_get_copy_mode_from_format(copy.audio_buffer_util,
+								       ags_audio_buffer_util_format_from_soundcard(copy.audio_buffer_util,
+														   ags_dsp_util_bench_format[i].format),
+								       ags_audio_buffer_util_format_from_soundcard(copy.audio_buffer_util,
+														   ags_dsp_util_bench_format[j].format));
+
+      name = g_strdup_printf("audio-buffer-util/copy/%s-to-%s",
+			     ags_dsp_util_bench_format[j].name,
+			     ags_dsp_util_bench_format[i].name);
+      
+      ags_dsp_util_bench_run(bench_report,
+			     name,
+			     (AgsDspUtilBenchFunc) ags_dsp_util_bench_copy_func, &copy);
+
+      g_free(name);
+      
+      ags_stream_free(copy.destination);
+      ags_stream_free(copy.source);
+    }
+  }
+
+  ags_audio_buffer_util_free(copy.audio_buffer_util);
+}
+
+void
+ags_dsp_util_bench_volume_util(AgsBenchReport *bench_report)
+{
+  AgsVolumeUtil *volume_util;
+
+  guint i;
+
+  for(i = 0; i < AGS_DSP_UTIL_BENCH_FORMAT_COUNT; i++){
+    gpointer destination, source;
+    gchar *name;
+
+    destination = ags_stream_alloc(buffer_size,
+				   ags_dsp_util_bench_format[i].format);
+    source = ags_stream_alloc(buffer_size,
+			      ags_dsp_util_bench_format[i].format);
+
+    ags_dsp_util_bench_fill_source(source,
+				   ags_dsp_util_bench_format[i].format);
+    
+    volume_util = ags_volume_util_alloc();
+
+    ags_volume_util_set_destination(volume_util,
+				    destination);
+    ags_volume_util_set_source(volume_util,
+			       source);
+    ags_volume_util_set_buffer_length(volume_util,
+				      buffer_size);
+    ags_volume_util_set_format(volume_util,
+			       ags_dsp_util_bench_format[i].format);
+    ags_volume_util_set_volume(volume_util,
+			       0.5);
+
+    name = g_strdup_printf("volume-util/%s",
+			   ags_dsp_util_bench_format[i].name);
+
+    ags_dsp_util_bench_run(bench_report,
+			   name,
+			   (AgsDspUtilBenchFunc) ags_volume_util_compute, volume_util);
+
+    g_free(name);
+
+    ags_volume_util_free(volume_util);
+
+    ags_stream_free(destination);
+    ags_stream_free(source);
+  }
+}
+
+void
+ags_dsp_util_bench_envelope_util(AgsBenchReport *bench_report)
+{
+  AgsEnvelopeUtil *envelope_util;
+
+  guint i;
+
+  for(i = 0; i < AGS_DSP_UTIL_BENCH_FORMAT_COUNT; i++){
+    gpointer destination, source;
+    gchar *name;
+
+    destination = ags_stream_alloc(buffer_size,
+				   ags_dsp_util_bench_format[i].format);
+    source = ags_stream_alloc(buffer_size,
+			      ags_dsp_util_bench_format[i].format);
+
+    ags_dsp_util_bench_fill_source(source,
+				   ags_dsp_util_bench_format[i].format);
+    
+    envelope_util = ags_envelope_util_alloc();
+
+    ags_envelope_util_set_destination(envelope_util,
+				      destination);
+    ags_envelope_util_set_source(envelope_util,
+				 source);
+    ags_envelope_util_set_buffer_length(envelope_util,
+					buffer_size);
+    ags_envelope_util_set_format(envelope_util,
+				 ags_dsp_util_bench_format[i].format);
+    ags_envelope_util_set_volume(envelope_util,
+				 1.0);
+    ags_envelope_util_set_amount(envelope_util,
+				 -0.5 / (gdouble) buffer_size);
+    ags_envelope_util_set_frame_count(envelope_util,
+				      buffer_size);
+
+    name = g_strdup_printf("envelope-util/%s",
+			   ags_dsp_util_bench_format[i].name);
+
+    ags_dsp_util_bench_run(bench_report,
+			   name,
+			   (AgsDspUtilBenchFunc) ags_envelope_util_compute, envelope_util);
+
+    g_free(name);
+
+    ags_envelope_util_free(envelope_util);
+
+    ags_stream_free(destination);
+    ags_stream_free(source);
+  }
+}
+
+void
+ags_dsp_util_bench_synth_util(AgsBenchReport *bench_report)
+{
+  AgsSynthUtil *synth_util;
+
+  gchar *oscillator_name[] = {
+    "sin",
+    "sawtooth",
+    "triangle",
+    "square",
+    "impulse",
+    NULL,
+  };
+
+  AgsDspUtilBenchFunc oscillator_func[] = {
+    (AgsDspUtilBenchFunc) ags_synth_util_compute_sin,
+    (AgsDspUtilBenchFunc) ags_synth_util_compute_sawtooth,
+    (AgsDspUtilBenchFunc) ags_synth_util_compute_triangle,
+    (AgsDspUtilBenchFunc) ags_synth_util_compute_square,
+    (AgsDspUtilBenchFunc) ags_synth_util_compute_impulse,
+  };
+
+  guint i, j;
+
+  for(i = 0; oscillator_name[i] != NULL; i++){
+    for(j = 0; j < AGS_DSP_UTIL_BENCH_FORMAT_COUNT; j++){
+      gpointer source;
+      gchar *name;
+
+      source = ags_stream_alloc(buffer_size,
+				ags_dsp_util_bench_format[j].format);
+
+      synth_util = ags_synth_util_alloc();
+
+      ags_synth_util_set_source(synth_util,
+				source);
+      ags_synth_util_set_buffer_length(synth_util,
+				       buffer_size);
+      ags_synth_util_set_format(synth_util,
+				ags_dsp_util_bench_format[j].format);
+      ags_synth_util_set_samplerate(synth_util,
+				    samplerate);
+      ags_synth_util_set_frequency(synth_util,
+				   AGS_DSP_UTIL_BENCH_FREQUENCY);
+      ags_synth_util_set_volume(synth_util,
+				0.1);
+      ags_synth_util_set_frame_count(synth_util,
+				     buffer_size);
+
+      name = g_strdup_printf("synth-util/%s/%s",
+			     oscillator_name[i],
+			     ags_dsp_util_bench_format[j].name);
+
+      ags_dsp_util_bench_run(bench_report,
+			     name,
+			     oscillator_func[i], synth_util);
+
+      g_free(name);
+
+      ags_synth_util_free(synth_util);
+
+      ags_stream_free(source);
+    }
+  }
+}
+
+void
+ags_dsp_util_bench_fm_synth_util(AgsBenchReport *bench_report)
+{
+  AgsFMSynthUtil *fm_synth_util;
+
+  gchar *oscillator_name[] = {
+    "sin",
+    "sawtooth",
+    "triangle",
+    "square",
+    "impulse",
+    NULL,
+  };
+
+  AgsDspUtilBenchFunc oscillator_func[] = {
+    (AgsDspUtilBenchFunc) ags_fm_synth_util_compute_sin,
+    (AgsDspUtilBenchFunc) ags_fm_synth_util_compute_sawtooth,
+    (AgsDspUtilBenchFunc) ags_fm_synth_util_compute_triangle,
+    (AgsDspUtilBenchFunc) ags_fm_synth_util_compute_square,
+    (AgsDspUtilBenchFunc) ags_fm_synth_util_compute_impulse,
+  };
+
+  guint i, j;
+
+  for(i = 0; oscillator_name[i] != NULL; i++){
+    for(j = 0; j < AGS_DSP_UTIL_BENCH_FORMAT_COUNT; j++){
+      gpointer source;
+      gchar *name;
+
+      source = ags_stream_alloc(buffer_size,
+				ags_dsp_util_bench_format[j].format);
+
+      fm_synth_util = ags_fm_synth_util_alloc();
+
+      ags_fm_synth_util_set_source(fm_synth_util,
+				   source);
+      ags_fm_synth_util_set_buffer_length(fm_synth_util,
+					  buffer_size);
+      ags_fm_synth_util_set_format(fm_synth_util,
+				   ags_dsp_util_bench_format[j].format);
+      ags_fm_synth_util_set_samplerate(fm_synth_util,
+				       samplerate);
+      ags_fm_synth_util_set_frequency(fm_synth_util,
+				      AGS_DSP_UTIL_BENCH_FREQUENCY);
+      ags_fm_synth_util_set_volume(fm_synth_util,
+				   0.1);
+      ags_fm_synth_util_set_lfo_oscillator_mode(fm_synth_util,
+						AGS_SYNTH_OSCILLATOR_SIN);
+      ags_fm_synth_util_set_lfo_frequency(fm_synth_util,
+					  6.0);
+      ags_fm_synth_util_set_lfo_depth(fm_synth_util,
+				      1.0);
+      ags_fm_synth_util_set_tuning(fm_synth_util,
+				   0.0);
+      ags_fm_synth_util_set_frame_count(fm_synth_util,
+					buffer_size);
+
+      name = g_strdup_printf("fm-synth-util/%s/%s",
+			     oscillator_name[i],
+			     ags_dsp_util_bench_format[j].name);
+
+      ags_dsp_util_bench_run(bench_report,
+			     name,
+			     oscillator_func[i], fm_synth_util);
+
+      g_free(name);
+
+      ags_fm_synth_util_free(fm_synth_util);
+
+      ags_stream_free(source);
+    }
+  }
+}
+
+void
+ags_dsp_util_bench_sf2_synth_util(AgsBenchReport *bench_report)
+{
+#if defined(AGS_WITH_LIBINSTPATCH)
+  AgsAudioContainer *audio_container;
+  AgsSF2SynthUtil *sf2_synth_util;
+
+  gchar *filename;
+  gchar *preset;
+  gchar *instrument;
+
+  guint i;
+
+  if((filename = getenv("AGS_BENCH_SF2_FILENAME")) == NULL){
+    filename = AGS_DSP_UTIL_BENCH_DEFAULT_SF2_FILENAME;
+  }
+
+  if((preset = getenv("AGS_BENCH_SF2_PRESET")) == NULL){
+    preset = AGS_DSP_UTIL_BENCH_DEFAULT_SF2_PRESET;
+  }
+
+  if((instrument = getenv("AGS_BENCH_SF2_INSTRUMENT")) == NULL){
+    instrument = AGS_DSP_UTIL_BENCH_DEFAULT_SF2_INSTRUMENT;
+  }
+
+  if(!g_file_test(filename,
+		  G_FILE_TEST_EXISTS)){
+    g_message("sf2-synth-util - skipped, %s not found", filename);
+
+    return;
+  }
+
+  audio_container = ags_audio_container_new(filename,
+					    preset,
+					    instrument,
+					    NULL,
+					    NULL,
+					    -1);
+  ags_audio_container_open(audio_container);
+
+  if(!AGS_IS_IPATCH(audio_container->sound_container)){
+    g_message("sf2-synth-util - skipped, %s not readable", filename);
+
+    g_object_unref(audio_container);
+    
+    return;
+  }
+  
+  for(i = 0; i < AGS_DSP_UTIL_BENCH_FORMAT_COUNT; i++){
+    gpointer source;
+    gchar *name;
+
+    source = ags_stream_alloc(buffer_size,
+			      ags_dsp_util_bench_format[i].format);
+
+    sf2_synth_util = ags_sf2_synth_util_alloc();
+
+    sf2_synth_util->flags |= AGS_SF2_SYNTH_UTIL_COMPUTE_INSTRUMENT;
+    
+    sf2_synth_util->sample_buffer = ags_stream_alloc(buffer_size,
+						     AGS_SOUNDCARD_DOUBLE);
+    sf2_synth_util->im_buffer = ags_stream_alloc(buffer_size,
+						 AGS_SOUNDCARD_DOUBLE);
+
+    ags_sf2_synth_util_set_sf2_file(sf2_synth_util,
+				    audio_container);
+
+    ags_sf2_synth_util_set_source(sf2_synth_util,
+				  source);
+
+    ags_common_pitch_util_set_source(sf2_synth_util->pitch_util,
+				     sf2_synth_util->pitch_type,
+				     sf2_synth_util->sample_buffer);
+    ags_common_pitch_util_set_destination(sf2_synth_util->pitch_util,
+					  sf2_synth_util->pitch_type,
+					  sf2_synth_util->im_buffer);
+    ags_common_pitch_util_set_buffer_length(sf2_synth_util->pitch_util,
+					    sf2_synth_util->pitch_type,
+					    buffer_size);
+    ags_common_pitch_util_set_format(sf2_synth_util->pitch_util,
+				     sf2_synth_util->pitch_type,
+				     AGS_SOUNDCARD_DOUBLE);
+    ags_common_pitch_util_set_samplerate(sf2_synth_util->pitch_util,
+					 sf2_synth_util->pitch_type,
+					 samplerate);
+
+    sf2_synth_util->volume_util->source = sf2_synth_util->im_buffer;
+    sf2_synth_util->volume_util->destination = sf2_synth_util->im_buffer;
+    sf2_synth_util->volume_util->buffer_length = buffer_size;
+    sf2_synth_util->volume_util->format = AGS_SOUNDCARD_DOUBLE;
+    
+    ags_sf2_synth_util_set_buffer_length(sf2_synth_util,
+					 buffer_size);
+    ags_sf2_synth_util_set_format(sf2_synth_util,
+				  ags_dsp_util_bench_format[i].format);
+    ags_sf2_synth_util_set_samplerate(sf2_synth_util,
+				      samplerate);
+    ags_sf2_synth_util_set_note(sf2_synth_util,
+				0.0);
+    ags_sf2_synth_util_set_volume(sf2_synth_util,
+				  1.0);
+    ags_sf2_synth_util_set_frame_count(sf2_synth_util,
+				       buffer_size);
+    ags_sf2_synth_util_set_offset(sf2_synth_util,
+				  0);
+
+    ags_sf2_synth_util_load_instrument(sf2_synth_util,
+				       preset,
+				       instrument);
+
+    name = g_strdup_printf("sf2-synth-util/%s",
+			   ags_dsp_util_bench_format[i].name);
+
+    ags_dsp_util_bench_run(bench_report,
+			   name,
+			   (AgsDspUtilBenchFunc) ags_sf2_synth_util_compute, sf2_synth_util);
+
+    g_free(name);
+
+    ags_sf2_synth_util_set_source(sf2_synth_util,
+				  NULL);
+
+    ags_common_pitch_util_set_source(sf2_synth_util->pitch_util,
+				     sf2_synth_util->pitch_type,
+				     NULL);
+    ags_common_pitch_util_set_destination(sf2_synth_util->pitch_util,
+					  sf2_synth_util->pitch_type,
+					  NULL);
+
+    sf2_synth_util->volume_util->source = NULL;
+    sf2_synth_util->volume_util->destination = NULL;
+    
+    ags_sf2_synth_util_free(sf2_synth_util);
+
+    ags_stream_free(source);
+  }
+
+  g_object_unref(audio_container);
+#else
+  g_message("sf2-synth-util - skipped, built without libinstpatch");
+#endif
+}
+
+void
+ags_dsp_util_bench_resample_util(AgsBenchReport *bench_report)
+{
+  AgsResampleUtil resample_util;
+
+  guint output_frames;
+  guint allocated_buffer_length;
+  guint i;
+
+  output_frames = (guint) ((gdouble) AGS_DSP_UTIL_BENCH_DEFAULT_TARGET_SAMPLERATE * ((gdouble) buffer_size / (gdouble) samplerate));
+  
+  for(i = 0; i < AGS_DSP_UTIL_BENCH_FORMAT_COUNT; i++){
+    gpointer destination, source;
+    gchar *name;
+
+    destination = ags_stream_alloc(buffer_size,
+				   ags_dsp_util_bench_format[i].format);
+    source = ags_stream_alloc(buffer_size,
+			      ags_dsp_util_bench_format[i].format);
+
+    ags_dsp_util_bench_fill_source(source,
+				   ags_dsp_util_bench_format[i].format);
+
+    ags_resample_util_init(&resample_util);
+
+    allocated_buffer_length = MAX(buffer_size, resample_util.b_len);
+    
+    resample_util.src_ratio = (gdouble) samplerate / (gdouble) AGS_DSP_UTIL_BENCH_DEFAULT_TARGET_SAMPLERATE;
+
+    resample_util.input_frames = buffer_size;
+    resample_util.data_in = ags_stream_alloc(allocated_buffer_length,
+					     ags_dsp_util_bench_format[i].format);
+
+    resample_util.output_frames = output_frames;
+    resample_util.data_out = ags_stream_alloc(allocated_buffer_length,
+					      ags_dsp_util_bench_format[i].format);
+
+    resample_util.destination = destination;
+    resample_util.destination_stride = 1;
+
+    resample_util.source = source;
+    resample_util.source_stride = 1;
+
+    resample_util.buffer_length = buffer_size;
+    resample_util.format = ags_dsp_util_bench_format[i].format;
+    resample_util.samplerate = samplerate;
+
+    resample_util.target_samplerate = AGS_DSP_UTIL_BENCH_DEFAULT_TARGET_SAMPLERATE;
+
+    resample_util.buffer = ags_stream_alloc(allocated_buffer_length,
+					    ags_dsp_util_bench_format[i].format);
+    
+    name = g_strdup_printf("resample-util/%s",
+			   ags_dsp_util_bench_format[i].name);
+
+    ags_dsp_util_bench_run(bench_report,
+			   name,
+			   (AgsDspUtilBenchFunc) ags_resample_util_compute, &resample_util);
+
+    g_free(name);
+
+    ags_stream_free(resample_util.data_out);
+    ags_stream_free(resample_util.data_in);
+    ags_stream_free(resample_util.buffer);
+
+    ags_stream_free(destination);
+    ags_stream_free(source);
+  }
+}
+
+void
+ags_dsp_util_bench_hq_pitch_util(AgsBenchReport *bench_report)
+{
+  AgsHQPitchUtil *hq_pitch_util;
+
+  guint i;
+
+  for(i = 0; i < AGS_DSP_UTIL_BENCH_FORMAT_COUNT; i++){
+    gpointer destination, source;
+    gchar *name;
+
+    destination = ags_stream_alloc(buffer_size,
+				   ags_dsp_util_bench_format[i].format);
+    source = ags_stream_alloc(buffer_size,
+			      ags_dsp_util_bench_format[i].format);
+
+    ags_dsp_util_bench_fill_source(source,
+				   ags_dsp_util_bench_format[i].format);
+
+    hq_pitch_util = ags_hq_pitch_util_alloc();
+
+    ags_hq_pitch_util_set_destination(hq_pitch_util,
+				      destination);
+    ags_hq_pitch_util_set_source(hq_pitch_util,
+				 source);
+    ags_hq_pitch_util_set_buffer_length(hq_pitch_util,
+					buffer_size);
+    ags_hq_pitch_util_set_format(hq_pitch_util,
+				 ags_dsp_util_bench_format[i].format);
+    ags_hq_pitch_util_set_samplerate(hq_pitch_util,
+				     samplerate);
+    ags_hq_pitch_util_set_base_key(hq_pitch_util,
+				   0.0);
+    ags_hq_pitch_util_set_tuning(hq_pitch_util,
+				 100.0);
+
+    name = g_strdup_printf("hq-pitch-util/%s",
+			   ags_dsp_util_bench_format[i].name);
+
+    ags_dsp_util_bench_run(bench_report,
+			   name,
+			   (AgsDspUtilBenchFunc) ags_hq_pitch_util_pitch, hq_pitch_util);
+
+    g_free(name);
+
+    ags_hq_pitch_util_set_destination(hq_pitch_util,
+				      NULL);
+    ags_hq_pitch_util_set_source(hq_pitch_util,
+				 NULL);
+    
+    ags_hq_pitch_util_free(hq_pitch_util);
+
+    ags_stream_free(destination);
+    ags_stream_free(source);
+  }
+}
+
+void
+ags_dsp_util_bench_amplifier10_util(AgsBenchReport *bench_report)
+{
+  AgsAmplifier10Util *amplifier10_util;
+
+  guint i;
+
+  for(i = 0; i < AGS_DSP_UTIL_BENCH_FORMAT_COUNT; i++){
+    gpointer destination, source;
+    gchar *name;
+
+    destination = ags_stream_alloc(buffer_size,
+				   ags_dsp_util_bench_format[i].format);
+    source = ags_stream_alloc(buffer_size,
+			      ags_dsp_util_bench_format[i].format);
+
+    ags_dsp_util_bench_fill_source(source,
+				   ags_dsp_util_bench_format[i].format);
+
+    amplifier10_util = ags_amplifier10_util_alloc();
+
+    ags_amplifier10_util_set_destination(amplifier10_util,
+					 destination);
+    ags_amplifier10_util_set_source(amplifier10_util,
+				    source);
+    ags_amplifier10_util_set_buffer_length(amplifier10_util,
+					   buffer_size);
+    ags_amplifier10_util_set_format(amplifier10_util,
+				    ags_dsp_util_bench_format[i].format);
+    ags_amplifier10_util_set_samplerate(amplifier10_util,
+					samplerate);
+
+    /* boost and cut alternating bands */
+    ags_amplifier10_util_set_amp_0_gain(amplifier10_util,
+					2.0);
+    ags_amplifier10_util_set_amp_1_gain(amplifier10_util,
+					0.5);
+    ags_amplifier10_util_set_amp_2_gain(amplifier10_util,
+					2.0);
+    ags_amplifier10_util_set_amp_3_gain(amplifier10_util,
+					0.5);
+    ags_amplifier10_util_set_amp_4_gain(amplifier10_util,
+					2.0);
+    ags_amplifier10_util_set_amp_5_gain(amplifier10_util,
+					0.5);
+    ags_amplifier10_util_set_amp_6_gain(amplifier10_util,
+					2.0);
+    ags_amplifier10_util_set_amp_7_gain(amplifier10_util,
+					0.5);
+    ags_amplifier10_util_set_amp_8_gain(amplifier10_util,
+					2.0);
+    ags_amplifier10_util_set_amp_9_gain(amplifier10_util,
+					0.5);
+
+    name = g_strdup_printf("amplifier10-util/%s",
+			   ags_dsp_util_bench_format[i].name);
+
+    ags_dsp_util_bench_run(bench_report,
+			   name,
+			   (AgsDspUtilBenchFunc) ags_amplifier10_util_process, amplifier10_util);
+
+    g_free(name);
+
+    ags_amplifier10_util_free(amplifier10_util);
+
+    ags_stream_free(destination);
+    ags_stream_free(source);
+  }
+}
+
+void
+ags_dsp_util_bench_fluid_iir_filter_util(AgsBenchReport *bench_report)
+{
+  AgsFluidIIRFilterUtil *fluid_iir_filter_util;
+
+  guint i;
+
+  for(i = 0; i < AGS_DSP_UTIL_BENCH_FORMAT_COUNT; i++){
+    gpointer destination, source;
+    gchar *name;
+
+    destination = ags_stream_alloc(buffer_size,
+				   ags_dsp_util_bench_format[i].format);
+    source = ags_stream_alloc(buffer_size,
+			      ags_dsp_util_bench_format[i].format);
+
+    ags_dsp_util_bench_fill_source(source,
+				   ags_dsp_util_bench_format[i].format);
+
+    fluid_iir_filter_util = ags_fluid_iir_filter_util_alloc();
+
+    ags_fluid_iir_filter_util_set_destination(fluid_iir_filter_util,
+					      destination);
+    ags_fluid_iir_filter_util_set_source(fluid_iir_filter_util,
+					 source);
+    ags_fluid_iir_filter_util_set_buffer_length(fluid_iir_filter_util,
+						buffer_size);
+    ags_fluid_iir_filter_util_set_format(fluid_iir_filter_util,
+					 ags_dsp_util_bench_format[i].format);
+    ags_fluid_iir_filter_util_set_samplerate(fluid_iir_filter_util,
+					     samplerate);
+    ags_fluid_iir_filter_util_set_filter_type(fluid_iir_filter_util,
+					      AGS_FLUID_IIR_LOWPASS);
+    ags_fluid_iir_filter_util_set_q_lin(fluid_iir_filter_util,
+					1.0);
+    ags_fluid_iir_filter_util_set_filter_gain(fluid_iir_filter_util,
+					      1.0);
+
+    name = g_strdup_printf("fluid-iir-filter-util/%s",
+			   ags_dsp_util_bench_format[i].name);
+
+    ags_dsp_util_bench_run(bench_report,
+			   name,
+			   (AgsDspUtilBenchFunc) ags_fluid_iir_filter_util_process, fluid_iir_filter_util);
+
+    g_free(name);
+
+    ags_fluid_iir_filter_util_free(fluid_iir_filter_util);
+
+    ags_stream_free(destination);
+    ags_stream_free(source);
+  }
+}
+
+void
+ags_dsp_util_bench_recall_lookup(AgsBenchReport *bench_report)
+{
+  AgsRecall *recall_audio, *recall_channel;
+  AgsRecall *recall_channel_run, *recall_recycling;
+  AgsAudioSignal *source;
+  
+  AgsDspUtilBenchRecall recall;
+
+  /* recall tree of a single voice */
+  recall_audio = (AgsRecall *) ags_recall_audio_new(NULL);
+  recall_channel = (AgsRecall *) ags_recall_channel_new();
+
+  recall_channel_run = (AgsRecall *) ags_recall_channel_run_new();
+  g_object_set(recall_channel_run,
+	       "recall-audio", recall_audio,
+	       "recall-channel", recall_channel,
+	       NULL);
+
+  recall_recycling = (AgsRecall *) ags_recall_recycling_new();
+  ags_recall_add_child(recall_channel_run,
+		       recall_recycling);
+
+  source = ags_audio_signal_new(NULL,
+				NULL,
+				NULL);
+  g_object_set(source,
+	       "buffer-size", buffer_size,
+	       NULL);
+  
+  recall.recall_audio_signal = (AgsRecall *) ags_recall_audio_signal_new();
+  g_object_set(recall.recall_audio_signal,
+	       "source", source,
+	       NULL);
+
+  ags_recall_add_child(recall_recycling,
+		       recall.recall_audio_signal);
+
+  recall.voice_count = AGS_DSP_UTIL_BENCH_VOICE_COUNT;
+
+  /* ns per frame of all voices, divide by voice count for a single voice */
+  ags_dsp_util_bench_run(bench_report,
+			 "recall/lookup/g-object-get",
+			 (AgsDspUtilBenchFunc) ags_dsp_util_bench_recall_g_object_get_func, &recall);
+
+  ags_dsp_util_bench_run(bench_report,
+			 "recall/lookup/rt-view",
+			 (AgsDspUtilBenchFunc) ags_dsp_util_bench_recall_rt_view_func, &recall);
+
+  /* the recall tree keeps its own references */
+  g_object_unref(source);
+
+  g_object_unref(recall_audio);
+  g_object_unref(recall_channel);
+}
+
+int
+main(int argc, char **argv)
+{
+  AgsBenchReport *bench_report;
+
+  GError *error;
+
+  gchar *baseline_filename;
+  gchar *output_filename;
+
+  gboolean fail_on_regression;
+  gint i;
+
+  baseline_filename = NULL;
+  output_filename = NULL;
+
+  fail_on_regression = FALSE;
+  
+  bench_report = ags_bench_report_alloc("ags-dsp-util-bench");
+
+  for(i = 1; i < argc; i++){
+    if(!strncmp(argv[i], "--help", 7)){
+      printf("ags_dsp_util_bench measures the DSP utilities in ns per frame\n\n");
+
+      printf("Usage:\n\t%s\n\t%s\n\t%s\n\t%s\n\t%s\n\t%s\n\t%s\n\t%s\n\n",
+	     "--baseline file          compare to baseline file",
+	     "--output file            write JSON to file instead of standard output",
+	     "--tolerance percent      tolerated slow down, default 10",
+	     "--fail-on-regression     exit with failure if slower than or missing from baseline",
+	     "--filter substring       run only matching benchmarks",
+	     "--min-time msec          minimum time per benchmark, default 100",
+	     "--buffer-size frames     frames per call, default 512",
+	     "--help                   display this help and exit");
+
+      exit(0);
+    }else if(!strncmp(argv[i], "--baseline", 11)){
+      if(i + 1 < argc){
+	baseline_filename = argv[i + 1];
+
+	i++;
+      }
+    }else if(!strncmp(argv[i], "--output", 9)){
+      if(i + 1 < argc){
+	output_filename = argv[i + 1];
+
+	i++;
+      }
+    }else if(!strncmp(argv[i], "--tolerance", 12)){
+      if(i + 1 < argc){
+	bench_report->tolerance = g_ascii_strtod(argv[i + 1],
+						 NULL);
+
+	i++;
+      }
+    }else if(!strncmp(argv[i], "--fail-on-regression", 21)){
+      fail_on_regression = TRUE;
+    }else if(!strncmp(argv[i], "--filter", 9)){
+      if(i + 1 < argc){
+	filter = argv[i + 1];
+
+	i++;
+      }
+    }else if(!strncmp(argv[i], "--min-time", 11)){
+      if(i + 1 < argc){
+	min_time = (gint64) g_ascii_strtoull(argv[i + 1],
+					     NULL,
+					     10) * 1000000;
+
+	i++;
+      }
+    }else if(!strncmp(argv[i], "--buffer-size", 14)){
+      if(i + 1 < argc){
+	buffer_size = (guint) g_ascii_strtoull(argv[i + 1],
+					       NULL,
+					       10);
+
+	i++;
+      }
+    }
+  }
+
+  if(buffer_size == 0){
+    buffer_size = AGS_DSP_UTIL_BENCH_DEFAULT_BUFFER_SIZE;
+  }
+  
+  if(baseline_filename != NULL){
+    error = NULL;
+    
+    if(!ags_bench_report_load_baseline(bench_report,
+				       baseline_filename,
+				       &error)){
+      g_warning("failed to load baseline %s", baseline_filename);
+
+      if(error != NULL){
+	g_warning("%s", error->message);
+
+	g_error_free(error);
+      }
+    }
+  }
+
+  ags_dsp_util_bench_audio_buffer_util(bench_report);
+  ags_dsp_util_bench_volume_util(bench_report);
+  ags_dsp_util_bench_envelope_util(bench_report);
+  ags_dsp_util_bench_synth_util(bench_report);
+  ags_dsp_util_bench_fm_synth_util(bench_report);
+  ags_dsp_util_bench_sf2_synth_util(bench_report);
+  ags_dsp_util_bench_resample_util(bench_report);
+  ags_dsp_util_bench_hq_pitch_util(bench_report);
+  ags_dsp_util_bench_amplifier10_util(bench_report);
+  ags_dsp_util_bench_fluid_iir_filter_util(bench_report);
+  ags_dsp_util_bench_recall_lookup(bench_report);
+
+  g_message("%u results, %u regressions", bench_report->result_count, bench_report->regression_count);
+  
+  error = NULL;
+  
+  if(!ags_bench_report_write(bench_report,
+			     output_filename,
+			     &error)){
+    if(error != NULL){
+      g_warning("%s", error->message);
+
+      g_error_free(error);
+    }
+
+    ags_bench_report_free(bench_report);
+    
+    return(-1);
+  }
+
+  if(fail_on_regression &&
+     (bench_report->regression_count > 0 ||
+      !ags_bench_report_check_baseline(bench_report))){
+    ags_bench_report_free(bench_report);
+    
+    return(1);
+  }
+
+  ags_bench_report_free(bench_report);
+  
+  return(0);
+}
@@ -0,0 +1,897 @@
+/* GSequencer - Advanced GTK Sequencer
+ * Copyright (C) 2005-2026 Joël Krähemann
+ *
+ * This file is part of GSequencer.
+ *
+ * GSequencer is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GSequencer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GSequencer.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <glib.h>
+#include <glib-object.h>
+#include <glib/gstdio.h>
+
+#include <ags/libags.h>
+#include <ags/libags-audio.h>
+
+#include <ags/config.h>
+
+#include <ags/gsequencer_main.h>
+
+#include <ags/test/app/libgsequencer.h>
+
+#include <ags/test/app/ags_functional_test_util.h>
+
+#include "ags_bench_report.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if !defined(AGS_W32API)
+#include <sys/resource.h>
+#endif
+
+void ags_render_bench_tic_callback(AgsSoundcard *soundcard,
+				   gpointer data);
+
+void ags_render_bench_render();
+
+gboolean ags_render_bench_write_result(gchar *filename,
+				       gint64 wall_time);
+
+GList* ags_render_bench_find_project(gchar *path);
+
+gboolean ags_render_bench_run_project(AgsBenchReport *bench_report,
+				      gchar *program,
+				      gchar *project);
+
+#define AGS_RENDER_BENCH_DEFAULT_DURATION (30)
+#define AGS_RENDER_BENCH_DEFAULT_IDLE_TIME (3.0 * G_USEC_PER_SEC)
+#define AGS_RENDER_BENCH_DEFAULT_EXAMPLES_PATH AGS_SRC_DIR "/" "ags/test/app/examples"
+
+#define AGS_RENDER_BENCH_TIMEOUT_FACTOR (4)
+
+#define AGS_RENDER_BENCH_HISTOGRAM_BUCKET_COUNT (16)
+#define AGS_RENDER_BENCH_HISTOGRAM_FIRST_UPPER_BOUND (16)
+
+#define AGS_RENDER_BENCH_SAMPLERATE (44100)
+#define AGS_RENDER_BENCH_BUFFER_SIZE (512)
+
+#define AGS_RENDER_BENCH_CONFIG "[generic]\n"		\
+  "autosave-thread=false\n"				\
+  "simple-file=true\n"					\
+  "disable-feature=experimental\n"			\
+  "segmentation=4/4\n"					\
+  "\n"							\
+  "[thread]\n"						\
+  "model=super-threaded\n"				\
+  "super-threaded-scope=channel\n"			\
+  "lock-global=ags-thread\n"				\
+  "lock-parent=ags-recycling-thread\n"			\
+  "max-precision=1000\n"				\
+  "\n"							\
+  "[soundcard-0]\n"					\
+  "backend=offline\n"					\
+  "device=offline-0\n"					\
+  "samplerate=44100\n"					\
+  "buffer-size=512\n"					\
+  "pcm-channels=2\n"					\
+  "dsp-channels=2\n"					\
+  "format=16\n"						\
+  "\n"							\
+  "[recall]\n"						\
+  "auto-sense=true\n"					\
+  "\n"
+
+_Atomic gboolean is_available;
+_Atomic gboolean is_terminated;
+
+AgsGSequencerApplicationContext *gsequencer_application_context;
+
+struct timespec ags_render_bench_default_timeout = {
+  300,
+  0,
+};
+
+gchar *result_filename = NULL;
+
+guint duration = AGS_RENDER_BENCH_DEFAULT_DURATION;
+
+/* per tic statistics - written by the soundcard's tic emitter only */
+volatile gint64 tic_count = 0;
+volatile gint64 last_tic_time = -1;
+
+volatile gint64 tic_latency_sum = 0;
+volatile gint64 tic_latency_max = 0;
+volatile gint64 deadline_miss_count = 0;
+
+volatile gint64 tic_latency_histogram[AGS_RENDER_BENCH_HISTOGRAM_BUCKET_COUNT];
+
+/* allocation counter */
+volatile gint64 allocation_count = 0;
+
+gint64 render_allocation_count = 0;
+
+/* interposing malloc is glibc only, elsewhere allocations aren't reported */
+#if defined(__GLIBC__)
+#define AGS_RENDER_BENCH_COUNT_ALLOCATIONS 1
+
+extern void* __libc_malloc(size_t size);
+extern void* __libc_calloc(size_t nmemb, size_t size);
+extern void* __libc_realloc(void *ptr, size_t size);
+
+void*
+malloc(size_t size)
+{
+  ags_atomic_int64_add(&allocation_count,
+		       1);
+  
+  return(__libc_malloc(size));
+}
+
+void*
+calloc(size_t nmemb, size_t size)
+{
+  ags_atomic_int64_add(&allocation_count,
+		       1);
+  
+  return(__libc_calloc(nmemb, size));
+}
+
+void*
+realloc(void *ptr, size_t size)
+{
+  ags_atomic_int64_add(&allocation_count,
+		       1);
+  
+  return(__libc_realloc(ptr, size));
+}
+#endif
+
+void
+ags_render_bench_tic_callback(AgsSoundcard *soundcard,
+			      gpointer data)
+{
+  gint64 current_time, prev_time;
+  gint64 latency;
+  gint64 upper_bound;
+  guint i;
+
+  current_time = g_get_monotonic_time();
+  
+  prev_time = ags_atomic_int64_exchange(&last_tic_time,
+					current_time);
+
+  ags_atomic_int64_add(&tic_count,
+		       1);
+  
+  if(prev_time < 0){
+    return;
+  }
+
+  latency = current_time - prev_time;
+
+  ags_atomic_int64_add(&tic_latency_sum,
+		       latency);
+
+  if(latency > ags_atomic_int64_get(&tic_latency_max)){
+    ags_atomic_int64_set(&tic_latency_max,
+			 latency);
+  }
+
+  /* realtime deadline of one buffer */
+  if(latency > (G_USEC_PER_SEC * AGS_RENDER_BENCH_BUFFER_SIZE / AGS_RENDER_BENCH_SAMPLERATE)){
+    ags_atomic_int64_add(&deadline_miss_count,
+			 1);
+  }
+
+  /* power of two buckets */
+  upper_bound = AGS_RENDER_BENCH_HISTOGRAM_FIRST_UPPER_BOUND;
+  
+  for(i = 0; i + 1 < AGS_RENDER_BENCH_HISTOGRAM_BUCKET_COUNT && latency >= upper_bound; i++){
+    upper_bound *= 2;
+  }
+
+  ags_atomic_int64_add(&(tic_latency_histogram[i]),
+		       1);
+}
+
+void
+ags_render_bench_render()
+{
+  GtkButton *play_button;
+  GtkButton *stop_button;
+
+  GObject *default_soundcard;
+
+  GList *start_soundcard, *soundcard;
+
+  gint64 start_time, current_time;
+  gint64 start_allocation_count;
+  gint64 frame_count, timeout;
+  gboolean success;
+
+  gsequencer_application_context = ags_application_context_get_instance();
+
+  ags_functional_test_util_idle_condition_and_timeout(AGS_FUNCTIONAL_TEST_UTIL_IDLE_CONDITION(ags_functional_test_util_idle_test_widget_realized),
+						      &ags_render_bench_default_timeout,
+						      &(gsequencer_application_context->window));
+
+  ags_functional_test_util_sync();
+
+  while(!ags_ui_provider_get_file_ready(AGS_UI_PROVIDER(gsequencer_application_context))){
+    g_usleep(G_USEC_PER_SEC / 10);
+  }
+
+  ags_functional_test_util_idle(AGS_RENDER_BENCH_DEFAULT_IDLE_TIME);
+  
+  ags_functional_test_util_sync();
+
+  /* render as fast as possible */
+  soundcard =
+    start_soundcard = ags_sound_provider_get_soundcard(AGS_SOUND_PROVIDER(gsequencer_application_context));
+
+  while(soundcard != NULL){
+    if(AGS_IS_OFFLINE_DEVOUT(soundcard->data)){
+      ags_offline_devout_set_flags((AgsOfflineDevout *) soundcard->data,
+				   AGS_OFFLINE_DEVOUT_FREE_RUN);
+    }
+
+    soundcard = soundcard->next;
+  }
+
+  g_list_free_full(start_soundcard,
+		   g_object_unref);
+
+  default_soundcard = ags_sound_provider_get_default_soundcard(AGS_SOUND_PROVIDER(gsequencer_application_context));
+
+  g_signal_connect_after(default_soundcard, "tic",
+			 G_CALLBACK(ags_render_bench_tic_callback), NULL);
+  
+  /* get buttons */
+  play_button = AGS_WINDOW(gsequencer_application_context->window)->navigation->play;
+  stop_button = AGS_WINDOW(gsequencer_application_context->window)->navigation->stop;
+
+  frame_count = (gint64) duration * AGS_RENDER_BENCH_SAMPLERATE;
+  timeout = (gint64) duration * AGS_RENDER_BENCH_TIMEOUT_FACTOR * G_USEC_PER_SEC;
+  
+  start_allocation_count = ags_atomic_int64_get(&allocation_count);
+  
+  start_time = g_get_monotonic_time();
+  
+  g_message("start rendering %u seconds", duration);
+  
+  ags_functional_test_util_button_click(play_button);
+
+  success = TRUE;
+
+  while(ags_atomic_int64_get(&tic_count) * AGS_RENDER_BENCH_BUFFER_SIZE < frame_count){
+    g_usleep(G_USEC_PER_SEC / 1000);
+
+    current_time = g_get_monotonic_time();
+    
+    if(current_time - start_time > timeout){
+      g_warning("render timeout");
+
+      success = FALSE;
+      
+      break;
+    }
+  }
+
+  current_time = ags_atomic_int64_get(&last_tic_time);
+
+  render_allocation_count = ags_atomic_int64_get(&allocation_count) - start_allocation_count;
+
+  g_message("stop rendering");
+
+  ags_functional_test_util_button_click(stop_button);
+
+  if(success &&
+     result_filename != NULL){
+    ags_render_bench_write_result(result_filename,
+				  current_time - start_time);
+  }
+  
+  ags_functional_test_util_quit();
+  
+  while(!ags_atomic_int_get(&is_terminated)){
+    g_usleep(G_USEC_PER_SEC / 60);
+  }
+
+  exit((success) ? 0: 1);
+}
+
+gboolean
+ags_render_bench_write_result(gchar *filename,
+			      gint64 wall_time)
+{
+  JsonBuilder *builder;
+  JsonGenerator *generator;
+  JsonNode *root;
+
+  GError *error;
+
+  gint64 current_tic_count;
+  gint64 frame_count;
+  gint64 peak_rss;
+  gint64 upper_bound;
+  guint i;
+  gboolean success;
+  
+  current_tic_count = ags_atomic_int64_get(&tic_count);
+  frame_count = current_tic_count * AGS_RENDER_BENCH_BUFFER_SIZE;
+
+  peak_rss = 0;
+  
+#if !defined(AGS_W32API)
+  {
+    struct rusage usage;
+
+    if(getrusage(RUSAGE_SELF, &usage) == 0){
+      peak_rss = (gint64) usage.ru_maxrss;
+    }
+  }
+#endif
+  
+  builder = json_builder_new();
+
+  json_builder_begin_object(builder);
+
+  json_builder_set_member_name(builder,
+			       "duration");
+  json_builder_add_int_value(builder,
+			     duration);
+
+  json_builder_set_member_name(builder,
+			       "samplerate");
+  json_builder_add_int_value(builder,
+			     AGS_RENDER_BENCH_SAMPLERATE);
+
+  json_builder_set_member_name(builder,
+			       "buffer-size");
+  json_builder_add_int_value(builder,
+			     AGS_RENDER_BENCH_BUFFER_SIZE);
+
+  json_builder_set_member_name(builder,
+			       "tic-count");
+  json_builder_add_int_value(builder,
+			     current_tic_count);
+
+  json_builder_set_member_name(builder,
+			       "rendered-frames");
+  json_builder_add_int_value(builder,
+			     frame_count);
+
+  json_builder_set_member_name(builder,
+			       "wall-time-ns");
+  json_builder_add_int_value(builder,
+			     wall_time * 1000);
+
+  json_builder_set_member_name(builder,
+			       "realtime-factor");
+  json_builder_add_double_value(builder,
+				((gdouble) frame_count / (gdouble) AGS_RENDER_BENCH_SAMPLERATE) / ((gdouble) wall_time / (gdouble) G_USEC_PER_SEC));
+
+  json_builder_set_member_name(builder,
+			       "tic-latency-mean-us");
+  json_builder_add_double_value(builder,
+				((current_tic_count > 1) ? ((gdouble) ags_atomic_int64_get(&tic_latency_sum) / (gdouble) (current_tic_count - 1)): 0.0));
+
+  json_builder_set_member_name(builder,
+			       "tic-latency-max-us");
+  json_builder_add_int_value(builder,
+			     ags_atomic_int64_get(&tic_latency_max));
+
+  json_builder_set_member_name(builder,
+			       "deadline-miss-count");
+  json_builder_add_int_value(builder,
+			     ags_atomic_int64_get(&deadline_miss_count));
+
+  json_builder_set_member_name(builder,
+			       "tic-latency-histogram");
+  json_builder_begin_array(builder);
+
+  upper_bound = AGS_RENDER_BENCH_HISTOGRAM_FIRST_UPPER_BOUND;
+  
+  for(i = 0; i < AGS_RENDER_BENCH_HISTOGRAM_BUCKET_COUNT; i++){
+    json_builder_begin_object(builder);
+
+    /* the last bucket is unbounded */
+    json_builder_set_member_name(builder,
+				 "upper-bound-us");
+
+    if(i + 1 < AGS_RENDER_BENCH_HISTOGRAM_BUCKET_COUNT){
+      json_builder_add_int_value(builder,
+				 upper_bound);
+    }else{
+      json_builder_add_null_value(builder);
+    }
+    
+    json_builder_set_member_name(builder,
+				 "count");
+    json_builder_add_int_value(builder,
+			       ags_atomic_int64_get(&(tic_latency_histogram[i])));
+    
+    json_builder_end_object(builder);
+
+    upper_bound *= 2;
+  }
+  
+  json_builder_end_array(builder);
+
+#if defined(AGS_RENDER_BENCH_COUNT_ALLOCATIONS)
+  json_builder_set_member_name(builder,
+			       "allocations");
+  json_builder_add_int_value(builder,
+			     render_allocation_count);
+
+  json_builder_set_member_name(builder,
+			       "allocations-per-tic");
+  json_builder_add_double_value(builder,
+				((current_tic_count > 0) ? ((gdouble) render_allocation_count / (gdouble) current_tic_count): 0.0));
+#endif
+
+  json_builder_set_member_name(builder,
+			       "peak-rss-kb");
+  json_builder_add_int_value(builder,
+			     peak_rss);
+  
+  json_builder_end_object(builder);
+
+  root = json_builder_get_root(builder);
+
+  generator = json_generator_new();
+  json_generator_set_root(generator,
+			  root);
+
+  error = NULL;
+  success = json_generator_to_file(generator,
+				   filename,
+				   &error);
+
+  if(error != NULL){
+    g_warning("%s", error->message);
+
+    g_error_free(error);
+  }
+  
+  json_node_unref(root);
+
+  g_object_unref(generator);
+  g_object_unref(builder);
+
+  return(success);
+}
+
+GList*
+ags_render_bench_find_project(gchar *path)
+{
+  GDir *dir;
+
+  GList *project;
+
+  const gchar *filename;
+
+  project = NULL;
+  
+  dir = g_dir_open(path,
+		   0,
+		   NULL);
+
+  if(dir == NULL){
+    g_warning("failed to open %s", path);
+    
+    return(NULL);
+  }
+
+  while((filename = g_dir_read_name(dir)) != NULL){
+    if(g_pattern_match_simple("ags-loop-*.xml",
+			      filename)){
+      project = g_list_insert_sorted(project,
+				     g_build_filename(path,
+						      filename,
+						      NULL),
+				     (GCompareFunc) g_strcmp0);
+    }
+  }
+
+  g_dir_close(dir);
+  
+  return(project);
+}
+
+gboolean
+ags_render_bench_run_project(AgsBenchReport *bench_report,
+			     gchar *program,
+			     gchar *project)
+{
+  JsonBuilder *builder;
+  JsonParser *parser;
+  JsonObject *object;
+  
+  GList *start_member, *member;
+  
+  GError *error;
+
+  gchar *child_argv[8];
+  gchar *filename;
+  gchar *basename;
+  gchar *result_name;
+  gchar *duration_str;
+  
+  gint64 wall_time_ns, frame_count;
+  gint fd;
+  gint wait_status;
+  gdouble ns_per_frame;
+  gboolean is_regression;
+  gboolean success;
+  
+  error = NULL;
+  fd = g_file_open_tmp("ags-render-bench-XXXXXX.json",
+		       &filename,
+		       &error);
+
+  if(fd < 0){
+    if(error != NULL){
+      g_warning("%s", error->message);
+
+      g_error_free(error);
+    }
+    
+    return(FALSE);
+  }
+
+  g_close(fd,
+	  NULL);
+  
+  duration_str = g_strdup_printf("%u", duration);
+  
+  child_argv[0] = program;
+  child_argv[1] = "--project";
+  child_argv[2] = project;
+  child_argv[3] = "--duration";
+  child_argv[4] = duration_str;
+  child_argv[5] = "--result";
+  child_argv[6] = filename;
+  child_argv[7] = NULL;
+
+  g_message("render %s", project);
+
+  /* each project gets a fresh process, peak RSS and allocations aren't shared */
+  error = NULL;
+  success = g_spawn_sync(NULL,
+			 child_argv,
+			 NULL,
+			 G_SPAWN_CHILD_INHERITS_STDIN,
+			 NULL, NULL,
+			 NULL, NULL,
+			 &wait_status,
+			 &error);
+
+  g_free(duration_str);
+
+  if(!success ||
+     wait_status != 0){
+    g_warning("failed to render %s", project);
+
+    if(error != NULL){
+      g_warning("%s", error->message);
+
+      g_error_free(error);
+    }
+    
+    g_unlink(filename);
+    g_free(filename);
+    
+    return(FALSE);
+  }
+
+  parser = json_parser_new();
+
+  error = NULL;
+  success = json_parser_load_from_file(parser,
+				       filename,
+				       &error);
+
+  g_unlink(filename);
+  g_free(filename);
+
+  if(!success ||
+     !JSON_NODE_HOLDS_OBJECT(json_parser_get_root(parser))){
+    g_warning("no result of %s", project);
+
+    if(error != NULL){
+      g_warning("%s", error->message);
+
+      g_error_free(error);
+    }
+
+    g_object_unref(parser);
+    
+    return(FALSE);
+  }
+
+  object = json_node_get_object(json_parser_get_root(parser));
+
+  wall_time_ns = json_object_get_int_member(object,
+					    "wall-time-ns");
+  frame_count = json_object_get_int_member(object,
+					   "rendered-frames");
+
+  if(frame_count <= 0){
+    g_warning("nothing rendered of %s", project);
+
+    g_object_unref(parser);
+    
+    return(FALSE);
+  }
+  
+  ns_per_frame = (gdouble) wall_time_ns / (gdouble) frame_count;
+  
+  basename = g_path_get_basename(project);
+  result_name = g_strdup_printf("render/%s",
+				basename);
+
+  builder = ags_bench_report_begin_result(bench_report,
+					  result_name);
+
+  json_builder_set_member_name(builder,
+			       "project");
+  json_builder_add_string_value(builder,
+				project);
+
+  member =
+    start_member = json_object_get_members(object);
+
+  while(member != NULL){
+    json_builder_set_member_name(builder,
+				 member->data);
+    json_builder_add_value(builder,
+			   json_node_copy(json_object_get_member(object,
+								 member->data)));
+    
+    member = member->next;
+  }
+
+  g_list_free(start_member);
+  
+  is_regression = ags_bench_report_end_result(bench_report,
+					      result_name,
+					      ns_per_frame);
+  
+  if(json_object_has_member(object,
+			     "allocations-per-tic")){
+    g_message("%s - %.2fx realtime, %.3f allocations per tic%s",
+	      result_name,
+	      json_object_get_double_member(object,
+					    "realtime-factor"),
+	      json_object_get_double_member(object,
+					    "allocations-per-tic"),
+	      (is_regression ? " - regression": ""));
+  }else{
+    g_message("%s - %.2fx realtime%s",
+	      result_name,
+	      json_object_get_double_member(object,
+					    "realtime-factor"),
+	      (is_regression ? " - regression": ""));
+  }
+
+  g_free(basename);
+  g_free(result_name);
+  
+  g_object_unref(parser);
+  
+  return(TRUE);
+}
+
+int
+main(int argc, char **argv)
+{
+  AgsBenchReport *bench_report;
+
+  GList *start_project, *project;
+
+  GError *error;
+
+  char **new_argv;
+  gchar *baseline_filename;
+  gchar *output_filename;
+  gchar *project_filename;
+  gchar *str;
+
+  guint failed_count;
+  gboolean fail_on_regression;
+  gint i;
+
+  baseline_filename = NULL;
+  output_filename = NULL;
+
+  project_filename = NULL;
+  
+  start_project = NULL;
+  
+  fail_on_regression = FALSE;
+  
+  bench_report = ags_bench_report_alloc("ags-render-bench");
+
+  for(i = 1; i < argc; i++){
+    if(!strncmp(argv[i], "--help", 7)){
+      printf("ags_render_bench renders projects with an offline soundcard as fast as possible\n\n");
+
+      printf("Usage:\n\t%s\n\t%s\n\t%s\n\t%s\n\t%s\n\t%s\n\t%s\n\n",
+	     "[file.xml ...]            projects to render, default ags-loop-*.xml of the examples",
+	     "--baseline file          compare to baseline file",
+	     "--output file            write JSON to file instead of standard output",
+	     "--tolerance percent      tolerated slow down, default 10",
+	     "--fail-on-regression     exit with failure if slower than or missing from baseline",
+	     "--duration sec           seconds of audio to render per project, default 30",
+	     "--help                   display this help and exit");
+
+      exit(0);
+    }else if(!strncmp(argv[i], "--baseline", 11)){
+      if(i + 1 < argc){
+	baseline_filename = argv[i + 1];
+
+	i++;
+      }
+    }else if(!strncmp(argv[i], "--output", 9)){
+      if(i + 1 < argc){
+	output_filename = argv[i + 1];
+
+	i++;
+      }
+    }else if(!strncmp(argv[i], "--tolerance", 12)){
+      if(i + 1 < argc){
+	bench_report->tolerance = g_ascii_strtod(argv[i + 1],
+						 NULL);
+
+	i++;
+      }
+    }else if(!strncmp(argv[i], "--fail-on-regression", 21)){
+      fail_on_regression = TRUE;
+    }else if(!strncmp(argv[i], "--duration", 11)){
+      if(i + 1 < argc){
+	duration = (guint) g_ascii_strtoull(argv[i + 1],
+					    NULL,
+					    10);
+
+	i++;
+      }
+    }else if(!strncmp(argv[i], "--project", 10)){
+      if(i + 1 < argc){
+	project_filename = argv[i + 1];
+
+	i++;
+      }
+    }else if(!strncmp(argv[i], "--result", 9)){
+      if(i + 1 < argc){
+	result_filename = argv[i + 1];
+
+	i++;
+      }
+    }else{
+      start_project = g_list_append(start_project,
+				    g_strdup(argv[i]));
+    }
+  }
+
+  if(duration == 0){
+    duration = AGS_RENDER_BENCH_DEFAULT_DURATION;
+  }
+  
+  /* render a single project in this process */
+  if(project_filename != NULL){
+    ags_atomic_int_set(&is_available,
+		       FALSE);
+    ags_atomic_int_set(&is_terminated,
+		       FALSE);
+
+    new_argv = (char **) malloc(5 * sizeof(char *));
+    new_argv[0] = argv[0];
+    new_argv[1] = "--filename";
+    new_argv[2] = project_filename;
+    new_argv[3] = "--no-config";
+    new_argv[4] = NULL;
+    argc = 4;
+
+    if((str = getenv("AGS_TEST_CONFIG")) != NULL){
+      ags_functional_test_util_init(&argc, &new_argv,
+				    str);
+    }else{
+      ags_functional_test_util_init(&argc, &new_argv,
+				    AGS_RENDER_BENCH_CONFIG);
+    }
+    
+    ags_functional_test_util_do_run(argc, new_argv,
+				    ags_render_bench_render, &is_available);
+
+    ags_atomic_int_set(&is_terminated,
+		       TRUE);
+
+    g_thread_join(ags_functional_test_util_test_runner_thread());
+  
+    return(-1);
+  }
+
+  /* render every project in a child process */
+  if(start_project == NULL){
+    start_project = ags_render_bench_find_project(AGS_RENDER_BENCH_DEFAULT_EXAMPLES_PATH);
+  }
+  
+  if(baseline_filename != NULL){
+    error = NULL;
+    
+    if(!ags_bench_report_load_baseline(bench_report,
+				       baseline_filename,
+				       &error)){
+      g_warning("failed to load baseline %s", baseline_filename);
+
+      if(error != NULL){
+	g_warning("%s", error->message);
+
+	g_error_free(error);
+      }
+    }
+  }
+
+  failed_count = 0;
+  
+  project = start_project;
+
+  while(project != NULL){
+    if(!ags_render_bench_run_project(bench_report,
+				     argv[0],
+				     project->data)){
+      failed_count++;
+    }
+    
+    project = project->next;
+  }
+
+  g_list_free_full(start_project,
+		   g_free);
+  
+  g_message("%u results, %u regressions, %u failed", bench_report->result_count, bench_report->regression_count, failed_count);
+  
+  error = NULL;
+  
+  if(!ags_bench_report_write(bench_report,
+			     output_filename,
+			     &error)){
+    if(error != NULL){
+      g_warning("%s", error->message);
+
+      g_error_free(error);
+    }
+
+    ags_bench_report_free(bench_report);
+    
+    return(-1);
+  }
+
+  if(failed_count > 0 ||
+     (fail_on_regression &&
+      (bench_report->regression_count > 0 ||
+       !ags_bench_report_check_baseline(bench_report)))){
+    ags_bench_report_free(bench_report);
+    
+    return(1);
+  }
+
+  ags_bench_report_free(bench_report);
+  
+  return(0);
+}
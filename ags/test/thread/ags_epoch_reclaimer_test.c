@@ -0,0 +1,408 @@
+/* GSequencer - Advanced GTK Sequencer
+ * Copyright (C) 2005-2026 Joël Krähemann
+ *
+ * This file is part of GSequencer.
+ *
+ * GSequencer is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GSequencer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GSequencer.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <glib.h>
+#include <glib-object.h>
+
+#include <ags/libags.h>
+
+#include <CUnit/CUnit.h>
+#include <CUnit/Automated.h>
+#include <CUnit/Basic.h>
+
+#include <stdlib.h>
+
+int ags_epoch_reclaimer_test_init_suite();
+int ags_epoch_reclaimer_test_clean_suite();
+
+void ags_epoch_reclaimer_test_enter();
+void ags_epoch_reclaimer_test_retire();
+void ags_epoch_reclaimer_test_get_stats();
+void ags_epoch_reclaimer_test_concurrent();
+void ags_epoch_reclaimer_test_thread_exit();
+
+void ags_epoch_reclaimer_test_destroy(gpointer ptr);
+
+gpointer ags_epoch_reclaimer_test_concurrent_reader(gpointer data);
+gpointer ags_epoch_reclaimer_test_thread_exit_retire(gpointer data);
+
+#define AGS_EPOCH_RECLAIMER_TEST_ALIVE (0xa11fe)
+#define AGS_EPOCH_RECLAIMER_TEST_DEAD (0xdead)
+
+#define AGS_EPOCH_RECLAIMER_TEST_GET_STATS_N_RETIRE (64)
+
+#define AGS_EPOCH_RECLAIMER_TEST_CONCURRENT_N_READER (4)
+#define AGS_EPOCH_RECLAIMER_TEST_CONCURRENT_N_PUBLISH (1024)
+
+volatile gint epoch_reclaimer_test_destroy_count;
+
+gint epoch_reclaimer_test_node[AGS_EPOCH_RECLAIMER_TEST_CONCURRENT_N_PUBLISH + 1];
+
+volatile gpointer epoch_reclaimer_test_current;
+volatile gboolean epoch_reclaimer_test_running;
+volatile gint epoch_reclaimer_test_dead_count;
+
+/* The suite initialization function.
+ * Opens the temporary file used by the tests.
+ * Returns zero on success, non-zero otherwise.
+ */
+int
+ags_epoch_reclaimer_test_init_suite()
+{
+  return(0);
+}
+
+/* The suite cleanup function.
+ * Closes the temporary file used by the tests.
+ * Returns zero on success, non-zero otherwise.
+ */
+int
+ags_epoch_reclaimer_test_clean_suite()
+{
+  return(0);
+}
+
+void
+ags_epoch_reclaimer_test_destroy(gpointer ptr)
+{
+  /* poison instead of free, so readers detect early reclamation */
+  ags_atomic_int_set((gint *) ptr,
+		     AGS_EPOCH_RECLAIMER_TEST_DEAD);
+
+  ags_atomic_int_increment(&epoch_reclaimer_test_destroy_count);
+}
+
+void
+ags_epoch_reclaimer_test_enter()
+{
+  AgsEpochReclaimer *epoch_reclaimer;
+  AgsEpochRecord *epoch_record;
+
+  gint64 global_epoch;
+
+  epoch_reclaimer = ags_epoch_reclaimer_new();
+
+  epoch_record = ags_epoch_reclaimer_get_record(epoch_reclaimer);
+
+  CU_ASSERT(epoch_record != NULL);
+  CU_ASSERT(epoch_record == ags_epoch_reclaimer_get_record(epoch_reclaimer));
+  CU_ASSERT(epoch_record->local_epoch == AGS_EPOCH_RECLAIMER_QUIESCENT);
+
+  global_epoch = ags_epoch_reclaimer_get_global_epoch(epoch_reclaimer);
+
+  /* nested */
+  ags_epoch_reclaimer_enter(epoch_reclaimer);
+  ags_epoch_reclaimer_enter(epoch_reclaimer);
+
+  CU_ASSERT(epoch_record->local_epoch == global_epoch);
+  CU_ASSERT(epoch_record->nesting == 2);
+
+  ags_epoch_reclaimer_leave(epoch_reclaimer);
+
+  CU_ASSERT(epoch_record->local_epoch == global_epoch);
+
+  ags_epoch_reclaimer_leave(epoch_reclaimer);
+
+  CU_ASSERT(epoch_record->local_epoch == AGS_EPOCH_RECLAIMER_QUIESCENT);
+  CU_ASSERT(epoch_record->nesting == 0);
+
+  g_object_unref(epoch_reclaimer);
+}
+
+void
+ags_epoch_reclaimer_test_retire()
+{
+  AgsEpochReclaimer *epoch_reclaimer;
+
+  gint node;
+  
+  epoch_reclaimer = ags_epoch_reclaimer_new();
+
+  ags_atomic_int_set(&epoch_reclaimer_test_destroy_count,
+		     0);
+
+  node = AGS_EPOCH_RECLAIMER_TEST_ALIVE;
+  
+  ags_epoch_reclaimer_enter(epoch_reclaimer);
+
+  CU_ASSERT(ags_epoch_reclaimer_retire(epoch_reclaimer,
+				       &node, ags_epoch_reclaimer_test_destroy) == TRUE);
+
+  /* advances once, then blocked by the critical section */
+  CU_ASSERT(ags_epoch_reclaimer_reclaim(epoch_reclaimer) == 0);
+  CU_ASSERT(ags_epoch_reclaimer_reclaim(epoch_reclaimer) == 0);
+  CU_ASSERT(ags_epoch_reclaimer_reclaim(epoch_reclaimer) == 0);
+
+  CU_ASSERT(node == AGS_EPOCH_RECLAIMER_TEST_ALIVE);
+
+  ags_epoch_reclaimer_leave(epoch_reclaimer);
+
+  CU_ASSERT(ags_epoch_reclaimer_reclaim(epoch_reclaimer) == 1);
+
+  CU_ASSERT(node == AGS_EPOCH_RECLAIMER_TEST_DEAD);
+  CU_ASSERT(ags_atomic_int_get(&epoch_reclaimer_test_destroy_count) == 1);
+
+  g_object_unref(epoch_reclaimer);
+}
+
+void
+ags_epoch_reclaimer_test_get_stats()
+{
+  AgsEpochReclaimer *epoch_reclaimer;
+
+  gint node[AGS_EPOCH_RECLAIMER_TEST_GET_STATS_N_RETIRE];
+
+  gint64 retired_count, reclaimed_count, pending_count, overflow_count;
+  gint64 max_lag;
+  gdouble mean_lag;
+  guint i;
+  
+  epoch_reclaimer = ags_epoch_reclaimer_new();
+
+  for(i = 0; i < AGS_EPOCH_RECLAIMER_TEST_GET_STATS_N_RETIRE; i++){
+    node[i] = AGS_EPOCH_RECLAIMER_TEST_ALIVE;
+    
+    ags_epoch_reclaimer_retire(epoch_reclaimer,
+			       &(node[i]), ags_epoch_reclaimer_test_destroy);
+  }
+
+  ags_epoch_reclaimer_get_stats(epoch_reclaimer,
+				&retired_count,
+				&reclaimed_count,
+				&pending_count,
+				&overflow_count,
+				&mean_lag,
+				&max_lag);
+
+  CU_ASSERT(retired_count == AGS_EPOCH_RECLAIMER_TEST_GET_STATS_N_RETIRE);
+  CU_ASSERT(reclaimed_count == 0);
+  CU_ASSERT(pending_count == AGS_EPOCH_RECLAIMER_TEST_GET_STATS_N_RETIRE);
+  CU_ASSERT(overflow_count == 0);
+  CU_ASSERT(mean_lag == 0.0);
+
+  /* no critical section, so 2 advances suffice */
+  ags_epoch_reclaimer_reclaim(epoch_reclaimer);
+  ags_epoch_reclaimer_reclaim(epoch_reclaimer);
+
+  ags_epoch_reclaimer_get_stats(epoch_reclaimer,
+				&retired_count,
+				&reclaimed_count,
+				&pending_count,
+				NULL,
+				&mean_lag,
+				&max_lag);
+
+  CU_ASSERT(reclaimed_count == AGS_EPOCH_RECLAIMER_TEST_GET_STATS_N_RETIRE);
+  CU_ASSERT(pending_count == 0);
+  CU_ASSERT(mean_lag >= 0.0);
+  CU_ASSERT(max_lag >= (gint64) mean_lag);
+
+  g_object_unref(epoch_reclaimer);
+}
+
+gpointer
+ags_epoch_reclaimer_test_concurrent_reader(gpointer data)
+{
+  AgsEpochReclaimer *epoch_reclaimer;
+
+  gint *node;
+  
+  epoch_reclaimer = (AgsEpochReclaimer *) data;
+
+  ags_epoch_reclaimer_get_record(epoch_reclaimer);
+
+  while(ags_atomic_boolean_get(&epoch_reclaimer_test_running)){
+    ags_epoch_reclaimer_enter(epoch_reclaimer);
+
+    node = ags_atomic_pointer_get(&epoch_reclaimer_test_current);
+
+    if(ags_atomic_int_get(node) != AGS_EPOCH_RECLAIMER_TEST_ALIVE){
+      ags_atomic_int_increment(&epoch_reclaimer_test_dead_count);
+    }
+
+    g_thread_yield();
+
+    if(ags_atomic_int_get(node) != AGS_EPOCH_RECLAIMER_TEST_ALIVE){
+      ags_atomic_int_increment(&epoch_reclaimer_test_dead_count);
+    }
+    
+    ags_epoch_reclaimer_leave(epoch_reclaimer);
+  }
+
+  return(NULL);
+}
+
+void
+ags_epoch_reclaimer_test_concurrent()
+{
+  AgsEpochReclaimer *epoch_reclaimer;
+
+  GThread *thread[AGS_EPOCH_RECLAIMER_TEST_CONCURRENT_N_READER];
+
+  gpointer old_node;
+  
+  guint i;
+  
+  epoch_reclaimer = ags_epoch_reclaimer_new();
+
+  ags_atomic_int_set(&epoch_reclaimer_test_destroy_count,
+		     0);
+  ags_atomic_int_set(&epoch_reclaimer_test_dead_count,
+		     0);
+
+  for(i = 0; i < AGS_EPOCH_RECLAIMER_TEST_CONCURRENT_N_PUBLISH + 1; i++){
+    epoch_reclaimer_test_node[i] = AGS_EPOCH_RECLAIMER_TEST_ALIVE;
+  }
+  
+  ags_atomic_pointer_set(&epoch_reclaimer_test_current,
+			 &(epoch_reclaimer_test_node[0]));
+  ags_atomic_boolean_set(&epoch_reclaimer_test_running,
+			 TRUE);
+
+  for(i = 0; i < AGS_EPOCH_RECLAIMER_TEST_CONCURRENT_N_READER; i++){
+    thread[i] = g_thread_new("epoch reclaimer reader",
+			     ags_epoch_reclaimer_test_concurrent_reader,
+			     epoch_reclaimer);
+  }
+
+  /* publish, retire the unlinked node and reclaim */
+  for(i = 1; i <= AGS_EPOCH_RECLAIMER_TEST_CONCURRENT_N_PUBLISH; i++){
+    old_node = ags_atomic_pointer_exchange(&epoch_reclaimer_test_current,
+					   &(epoch_reclaimer_test_node[i]));
+
+    ags_epoch_reclaimer_retire(epoch_reclaimer,
+			       old_node, ags_epoch_reclaimer_test_destroy);
+
+    ags_epoch_reclaimer_reclaim(epoch_reclaimer);
+  }
+
+  ags_atomic_boolean_set(&epoch_reclaimer_test_running,
+			 FALSE);
+
+  for(i = 0; i < AGS_EPOCH_RECLAIMER_TEST_CONCURRENT_N_READER; i++){
+    g_thread_join(thread[i]);
+  }
+
+  /* all readers left */
+  ags_epoch_reclaimer_reclaim(epoch_reclaimer);
+  ags_epoch_reclaimer_reclaim(epoch_reclaimer);
+
+  CU_ASSERT(ags_atomic_int_get(&epoch_reclaimer_test_dead_count) == 0);
+  CU_ASSERT(ags_atomic_int_get(&epoch_reclaimer_test_destroy_count) == AGS_EPOCH_RECLAIMER_TEST_CONCURRENT_N_PUBLISH);
+
+  g_object_unref(epoch_reclaimer);
+}
+
+gpointer
+ags_epoch_reclaimer_test_thread_exit_retire(gpointer data)
+{
+  AgsEpochReclaimer *epoch_reclaimer;
+
+  static gint node = AGS_EPOCH_RECLAIMER_TEST_ALIVE;
+  
+  epoch_reclaimer = AGS_EPOCH_RECLAIMER(data);
+
+  ags_epoch_reclaimer_retire(epoch_reclaimer,
+			     &node, ags_epoch_reclaimer_test_destroy);
+
+  return(NULL);
+}
+
+void
+ags_epoch_reclaimer_test_thread_exit()
+{
+  AgsEpochReclaimer *epoch_reclaimer;
+  AgsEpochRecord *epoch_record;
+
+  GThread *thread;
+
+  guint i;
+  
+  epoch_reclaimer = ags_epoch_reclaimer_new();
+
+  ags_atomic_int_set(&epoch_reclaimer_test_destroy_count,
+		     0);
+
+  thread = g_thread_new("epoch reclaimer test - thread exit",
+			ags_epoch_reclaimer_test_thread_exit_retire,
+			epoch_reclaimer);
+
+  g_thread_join(thread);
+
+  epoch_record = ags_atomic_pointer_get(&(epoch_reclaimer->record));
+
+  CU_ASSERT(epoch_record != NULL);
+  CU_ASSERT(epoch_record->detached == TRUE);
+
+  /* the retired pointer is destroyed before the record is freed */
+  for(i = 0; i < 3; i++){
+    ags_epoch_reclaimer_reclaim(epoch_reclaimer);
+  }
+
+  CU_ASSERT(ags_atomic_int_get(&epoch_reclaimer_test_destroy_count) == 1);
+
+  /* only the record of the reclaiming thread is left */
+  epoch_record = ags_atomic_pointer_get(&(epoch_reclaimer->record));
+
+  CU_ASSERT(epoch_record != NULL);
+  CU_ASSERT(epoch_record->thread == g_thread_self());
+  CU_ASSERT(epoch_record->next == NULL);
+
+  g_object_unref(epoch_reclaimer);
+}
+
+int
+main(int argc, char **argv)
+{
+  CU_pSuite pSuite = NULL;
+
+  /* initialize the CUnit test registry */
+  if(CUE_SUCCESS != CU_initialize_registry()){
+    return CU_get_error();
+  }
+
+  /* add a suite to the registry */
+  pSuite = CU_add_suite("AgsEpochReclaimerTest", ags_epoch_reclaimer_test_init_suite, ags_epoch_reclaimer_test_clean_suite);
+
+  if(pSuite == NULL){
+    CU_cleanup_registry();
+
+    return CU_get_error();
+  }
+
+  /* add the tests to the suite */
+  if((CU_add_test(pSuite, "test of AgsEpochReclaimer enter", ags_epoch_reclaimer_test_enter) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsEpochReclaimer retire", ags_epoch_reclaimer_test_retire) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsEpochReclaimer get stats", ags_epoch_reclaimer_test_get_stats) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsEpochReclaimer concurrent", ags_epoch_reclaimer_test_concurrent) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsEpochReclaimer thread exit", ags_epoch_reclaimer_test_thread_exit) == NULL)){
+    CU_cleanup_registry();
+
+    return CU_get_error();
+  }
+
+  /* Run all tests using the CUnit Basic interface */
+  CU_basic_set_mode(CU_BRM_VERBOSE);
+  CU_basic_run_tests();
+
+  CU_cleanup_registry();
+
+  return(CU_get_error());
+}
@@ -684,6 +684,7 @@ ags_functional_frame_clock_test_counter_increment()
 	  
 	  audio[i]->notation = ags_notation_add(audio[i]->notation,
 						notation);
+	  audio[i]->notation_revision += 1;
 	}
 	
 	ags_notation_add_note(notation,
@@ -0,0 +1,246 @@
+/* GSequencer - Advanced GTK Sequencer
+ * Copyright (C) 2005-2026 Joël Krähemann
+ *
+ * This file is part of GSequencer.
+ *
+ * GSequencer is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GSequencer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GSequencer.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <glib.h>
+#include <glib-object.h>
+
+#include <ags/libags.h>
+
+#include <CUnit/CUnit.h>
+#include <CUnit/Automated.h>
+#include <CUnit/Basic.h>
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+
+int ags_functional_work_stealing_scheduler_test_init_suite();
+int ags_functional_work_stealing_scheduler_test_clean_suite();
+
+void ags_functional_work_stealing_scheduler_test_scaling();
+
+void ags_functional_work_stealing_scheduler_test_dsp_func(gpointer data);
+
+gint64 ags_functional_work_stealing_scheduler_test_measure(guint worker_count);
+
+#define AGS_FUNCTIONAL_WORK_STEALING_SCHEDULER_TEST_N_AUDIO (64)
+#define AGS_FUNCTIONAL_WORK_STEALING_SCHEDULER_TEST_N_STAGE (4)
+#define AGS_FUNCTIONAL_WORK_STEALING_SCHEDULER_TEST_BUFFER_SIZE (1024)
+#define AGS_FUNCTIONAL_WORK_STEALING_SCHEDULER_TEST_N_CYCLE (500)
+
+typedef struct _AgsFunctionalWorkStealingSchedulerTestNode AgsFunctionalWorkStealingSchedulerTestNode;
+
+struct _AgsFunctionalWorkStealingSchedulerTestNode
+{
+  gfloat *buffer;
+  gfloat phase;
+
+  volatile gint executed;
+};
+
+AgsFunctionalWorkStealingSchedulerTestNode *node = NULL;
+
+/* The suite initialization function.
+ * Opens the temporary file used by the tests.
+ * Returns zero on success, non-zero otherwise.
+ */
+int
+ags_functional_work_stealing_scheduler_test_init_suite()
+{
+  guint i;
+  
+  node = g_new0(AgsFunctionalWorkStealingSchedulerTestNode,
+		AGS_FUNCTIONAL_WORK_STEALING_SCHEDULER_TEST_N_AUDIO * AGS_FUNCTIONAL_WORK_STEALING_SCHEDULER_TEST_N_STAGE);
+
+  for(i = 0; i < AGS_FUNCTIONAL_WORK_STEALING_SCHEDULER_TEST_N_AUDIO * AGS_FUNCTIONAL_WORK_STEALING_SCHEDULER_TEST_N_STAGE; i++){
+    node[i].buffer = g_new0(gfloat,
+			    AGS_FUNCTIONAL_WORK_STEALING_SCHEDULER_TEST_BUFFER_SIZE);
+  }
+  
+  return(0);
+}
+
+/* The suite cleanup function.
+ * Closes the temporary file used by the tests.
+ * Returns zero on success, non-zero otherwise.
+ */
+int
+ags_functional_work_stealing_scheduler_test_clean_suite()
+{
+  guint i;
+  
+  for(i = 0; i < AGS_FUNCTIONAL_WORK_STEALING_SCHEDULER_TEST_N_AUDIO * AGS_FUNCTIONAL_WORK_STEALING_SCHEDULER_TEST_N_STAGE; i++){
+    g_free(node[i].buffer);
+  }
+
+  g_free(node);
+  
+  return(0);
+}
+
+void
+ags_functional_work_stealing_scheduler_test_dsp_func(gpointer data)
+{
+  AgsFunctionalWorkStealingSchedulerTestNode *current;
+
+  guint i;
+
+  current = data;
+
+  /* synthesize and filter a buffer, similar in cost to a simple recall */
+  for(i = 0; i < AGS_FUNCTIONAL_WORK_STEALING_SCHEDULER_TEST_BUFFER_SIZE; i++){
+    current->buffer[i] = 0.5 * current->buffer[i] + 0.5 * sinf(current->phase);
+
+    current->phase += 2.0 * M_PI * 440.0 / 48000.0;
+  }
+
+  current->phase = fmodf(current->phase, 2.0 * M_PI);
+  
+  ags_atomic_int_increment(&(current->executed));
+}
+
+gint64
+ags_functional_work_stealing_scheduler_test_measure(guint worker_count)
+{
+  AgsWorkStealingScheduler *scheduler;
+
+  gint64 start_time, end_time;
+  guint i, j, k;
+
+  scheduler = ags_work_stealing_scheduler_new(worker_count);
+
+  /* one chain per audio, each stage depends on the previous like recycling output to input */
+  for(i = 0; i < AGS_FUNCTIONAL_WORK_STEALING_SCHEDULER_TEST_N_AUDIO; i++){
+    for(j = 0; j < AGS_FUNCTIONAL_WORK_STEALING_SCHEDULER_TEST_N_STAGE; j++){
+      k = i * AGS_FUNCTIONAL_WORK_STEALING_SCHEDULER_TEST_N_STAGE + j;
+
+      ags_work_stealing_scheduler_add_node(scheduler,
+					   ags_functional_work_stealing_scheduler_test_dsp_func, &(node[k]));
+
+      if(j > 0){
+	ags_work_stealing_scheduler_add_dependency(scheduler,
+						   k, k - 1);
+      }
+    }
+  }
+
+  ags_work_stealing_scheduler_start(scheduler);
+
+  /* warm up */
+  ags_work_stealing_scheduler_run(scheduler);
+  
+  start_time = g_get_monotonic_time();
+  
+  for(i = 0; i < AGS_FUNCTIONAL_WORK_STEALING_SCHEDULER_TEST_N_CYCLE; i++){
+    ags_work_stealing_scheduler_run(scheduler);
+  }
+
+  end_time = g_get_monotonic_time();
+
+  ags_work_stealing_scheduler_stop(scheduler);
+
+  g_object_unref(scheduler);
+
+  return(end_time - start_time);
+}
+
+void
+ags_functional_work_stealing_scheduler_test_scaling()
+{
+  guint worker_count[] = {
+    1,
+    4,
+    8,
+    16,
+  };
+  
+  gint64 duration, single_duration;
+  guint i, j;
+  gboolean success;
+
+  single_duration = 0;
+  
+  for(i = 0; i < G_N_ELEMENTS(worker_count); i++){
+    for(j = 0; j < AGS_FUNCTIONAL_WORK_STEALING_SCHEDULER_TEST_N_AUDIO * AGS_FUNCTIONAL_WORK_STEALING_SCHEDULER_TEST_N_STAGE; j++){
+      node[j].executed = 0;
+    }
+    
+    duration = ags_functional_work_stealing_scheduler_test_measure(worker_count[i]);
+
+    if(i == 0){
+      single_duration = duration;
+    }
+
+    g_message("work-stealing: %u workers, %u cycles in %" G_GINT64_FORMAT " usec, %.2f usec/cycle, speedup %.2fx (%u processors)",
+	      worker_count[i],
+	      AGS_FUNCTIONAL_WORK_STEALING_SCHEDULER_TEST_N_CYCLE,
+	      duration,
+	      (gdouble) duration / (gdouble) AGS_FUNCTIONAL_WORK_STEALING_SCHEDULER_TEST_N_CYCLE,
+	      (gdouble) single_duration / (gdouble) MAX(duration, 1),
+	      g_get_num_processors());
+
+    /* every node executed once per cycle including warm up */
+    success = TRUE;
+    
+    for(j = 0; j < AGS_FUNCTIONAL_WORK_STEALING_SCHEDULER_TEST_N_AUDIO * AGS_FUNCTIONAL_WORK_STEALING_SCHEDULER_TEST_N_STAGE; j++){
+      if(node[j].executed != AGS_FUNCTIONAL_WORK_STEALING_SCHEDULER_TEST_N_CYCLE + 1){
+	success = FALSE;
+
+	break;
+      }
+    }
+
+    CU_ASSERT(success);
+  }
+}
+
+int
+main(int argc, char **argv)
+{
+  CU_pSuite pSuite = NULL;
+
+  /* initialize the CUnit test registry */
+  if(CUE_SUCCESS != CU_initialize_registry()){
+    return CU_get_error();
+  }
+
+  /* add a suite to the registry */
+  pSuite = CU_add_suite("AgsFunctionalWorkStealingSchedulerTest", ags_functional_work_stealing_scheduler_test_init_suite, ags_functional_work_stealing_scheduler_test_clean_suite);
+
+  if(pSuite == NULL){
+    CU_cleanup_registry();
+
+    return CU_get_error();
+  }
+
+  /* add the tests to the suite */
+  if((CU_add_test(pSuite, "functional test of AgsWorkStealingScheduler scaling", ags_functional_work_stealing_scheduler_test_scaling) == NULL)){
+    CU_cleanup_registry();
+
+    return CU_get_error();
+  }
+
+  /* Run all tests using the CUnit Basic interface */
+  CU_basic_set_mode(CU_BRM_VERBOSE);
+  CU_basic_run_tests();
+
+  CU_cleanup_registry();
+
+  return(CU_get_error());
+}
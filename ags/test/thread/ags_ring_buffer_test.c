@@ -0,0 +1,323 @@
+/* GSequencer - Advanced GTK Sequencer
+ * Copyright (C) 2005-2026 Joël Krähemann
+ *
+ * This file is part of GSequencer.
+ *
+ * GSequencer is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GSequencer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GSequencer.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <glib.h>
+#include <glib-object.h>
+
+#include <ags/libags.h>
+
+#include <CUnit/CUnit.h>
+#include <CUnit/Automated.h>
+#include <CUnit/Basic.h>
+
+#include <stdlib.h>
+
+int ags_ring_buffer_test_init_suite();
+int ags_ring_buffer_test_clean_suite();
+
+void ags_ring_buffer_test_alloc();
+void ags_ring_buffer_test_write_read();
+void ags_ring_buffer_test_wrap_around();
+void ags_ring_buffer_test_concurrent();
+
+gpointer ags_ring_buffer_test_concurrent_producer(gpointer data);
+
+#define AGS_RING_BUFFER_TEST_PERIOD_COUNT (4)
+#define AGS_RING_BUFFER_TEST_PERIOD_SIZE (256 * sizeof(gfloat))
+
+#define AGS_RING_BUFFER_TEST_CONCURRENT_PERIOD_COUNT (8192)
+
+/* The suite initialization function.
+ * Opens the temporary file used by the tests.
+ * Returns zero on success, non-zero otherwise.
+ */
+int
+ags_ring_buffer_test_init_suite()
+{
+  return(0);
+}
+
+/* The suite cleanup function.
+ * Closes the temporary file used by the tests.
+ * Returns zero on success, non-zero otherwise.
+ */
+int
+ags_ring_buffer_test_clean_suite()
+{
+  return(0);
+}
+
+void
+ags_ring_buffer_test_alloc()
+{
+  AgsRingBuffer *ring_buffer;
+
+  ring_buffer = ags_ring_buffer_alloc(AGS_RING_BUFFER_TEST_PERIOD_COUNT,
+				      AGS_RING_BUFFER_TEST_PERIOD_SIZE);
+
+  CU_ASSERT(ring_buffer != NULL);
+  CU_ASSERT(ring_buffer->period_count == AGS_RING_BUFFER_TEST_PERIOD_COUNT);
+  CU_ASSERT(ring_buffer->period_mask == AGS_RING_BUFFER_TEST_PERIOD_COUNT - 1);
+  CU_ASSERT(ring_buffer->period_size >= AGS_RING_BUFFER_TEST_PERIOD_SIZE);
+  CU_ASSERT((((guintptr) ring_buffer->data) % AGS_RING_BUFFER_CACHE_LINE_SIZE) == 0);
+
+  CU_ASSERT(ags_ring_buffer_get_readable(ring_buffer) == 0);
+  CU_ASSERT(ags_ring_buffer_get_writable(ring_buffer) == AGS_RING_BUFFER_TEST_PERIOD_COUNT);
+  CU_ASSERT(ags_ring_buffer_get_read_period(ring_buffer) == NULL);
+
+  ags_ring_buffer_free(ring_buffer);
+
+  /* rounded up to power of 2 */
+  ring_buffer = ags_ring_buffer_alloc(3,
+				      AGS_RING_BUFFER_TEST_PERIOD_SIZE);
+
+  CU_ASSERT(ring_buffer->period_count == 4);
+
+  ags_ring_buffer_free(ring_buffer);
+}
+
+void
+ags_ring_buffer_test_write_read()
+{
+  AgsRingBuffer *ring_buffer;
+
+  gfloat *period;
+
+  guint i;
+  gboolean success;
+
+  ring_buffer = ags_ring_buffer_alloc(AGS_RING_BUFFER_TEST_PERIOD_COUNT,
+				      AGS_RING_BUFFER_TEST_PERIOD_SIZE);
+
+  /* fill */
+  for(i = 0; i < AGS_RING_BUFFER_TEST_PERIOD_COUNT; i++){
+    period = ags_ring_buffer_get_write_period(ring_buffer);
+
+    CU_ASSERT(period != NULL);
+
+    period[0] = (gfloat) i;
+
+    ags_ring_buffer_commit_write(ring_buffer);
+  }
+
+  CU_ASSERT(ags_ring_buffer_get_readable(ring_buffer) == AGS_RING_BUFFER_TEST_PERIOD_COUNT);
+  CU_ASSERT(ags_ring_buffer_get_writable(ring_buffer) == 0);
+  CU_ASSERT(ags_ring_buffer_get_write_period(ring_buffer) == NULL);
+
+  /* drain */
+  success = TRUE;
+  
+  for(i = 0; i < AGS_RING_BUFFER_TEST_PERIOD_COUNT; i++){
+    period = ags_ring_buffer_get_read_period(ring_buffer);
+
+    if(period == NULL ||
+       period[0] != (gfloat) i){
+      success = FALSE;
+
+      break;
+    }
+
+    ags_ring_buffer_commit_read(ring_buffer);
+  }
+
+  CU_ASSERT(success);
+  CU_ASSERT(ags_ring_buffer_get_read_period(ring_buffer) == NULL);
+
+  /* reset */
+  ags_ring_buffer_get_write_period(ring_buffer);
+  ags_ring_buffer_commit_write(ring_buffer);
+
+  ags_ring_buffer_reset(ring_buffer);
+
+  CU_ASSERT(ags_ring_buffer_get_readable(ring_buffer) == 0);
+  
+  ags_ring_buffer_free(ring_buffer);
+}
+
+void
+ags_ring_buffer_test_wrap_around()
+{
+  AgsRingBuffer *ring_buffer;
+
+  gfloat *period;
+
+  guint i;
+  gboolean success;
+
+  ring_buffer = ags_ring_buffer_alloc(AGS_RING_BUFFER_TEST_PERIOD_COUNT,
+				      AGS_RING_BUFFER_TEST_PERIOD_SIZE);
+
+  /* free running indices overflow */
+  ring_buffer->write_index = G_MAXUINT - 1;
+  ring_buffer->read_index = G_MAXUINT - 1;
+
+  success = TRUE;
+  
+  for(i = 0; i < 4 * AGS_RING_BUFFER_TEST_PERIOD_COUNT; i++){
+    period = ags_ring_buffer_get_write_period(ring_buffer);
+
+    if(period == NULL){
+      success = FALSE;
+
+      break;
+    }
+    
+    period[0] = (gfloat) i;
+
+    ags_ring_buffer_commit_write(ring_buffer);
+
+    if(ags_ring_buffer_get_readable(ring_buffer) != 1){
+      success = FALSE;
+
+      break;
+    }
+
+    period = ags_ring_buffer_get_read_period(ring_buffer);
+
+    if(period == NULL ||
+       period[0] != (gfloat) i){
+      success = FALSE;
+
+      break;
+    }
+
+    ags_ring_buffer_commit_read(ring_buffer);
+  }
+
+  CU_ASSERT(success);
+
+  ags_ring_buffer_free(ring_buffer);
+}
+
+gpointer
+ags_ring_buffer_test_concurrent_producer(gpointer data)
+{
+  AgsRingBuffer *ring_buffer;
+
+  guint *period;
+
+  guint i;
+
+  ring_buffer = (AgsRingBuffer *) data;
+
+  for(i = 0; i < AGS_RING_BUFFER_TEST_CONCURRENT_PERIOD_COUNT;){
+    period = ags_ring_buffer_get_write_period(ring_buffer);
+
+    if(period == NULL){
+      g_thread_yield();
+      
+      continue;
+    }
+
+    period[0] = i;
+    period[1] = ~i;
+    
+    ags_ring_buffer_commit_write(ring_buffer);
+
+    i++;
+  }
+
+  return(NULL);
+}
+
+void
+ags_ring_buffer_test_concurrent()
+{
+  AgsRingBuffer *ring_buffer;
+
+  GThread *thread;
+  
+  guint *period;
+
+  guint i;
+  gboolean success;
+
+  ring_buffer = ags_ring_buffer_alloc(AGS_RING_BUFFER_TEST_PERIOD_COUNT,
+				      AGS_RING_BUFFER_TEST_PERIOD_SIZE);
+
+  thread = g_thread_new("ring buffer producer",
+			ags_ring_buffer_test_concurrent_producer,
+			ring_buffer);
+
+  success = TRUE;
+  
+  for(i = 0; i < AGS_RING_BUFFER_TEST_CONCURRENT_PERIOD_COUNT;){
+    period = ags_ring_buffer_get_read_period(ring_buffer);
+
+    if(period == NULL){
+      g_thread_yield();
+      
+      continue;
+    }
+
+    if(period[0] != i ||
+       period[1] != ~i){
+      success = FALSE;
+    }
+
+    ags_ring_buffer_commit_read(ring_buffer);
+
+    i++;
+  }
+
+  g_thread_join(thread);
+
+  CU_ASSERT(success);
+  CU_ASSERT(ags_ring_buffer_get_readable(ring_buffer) == 0);
+  
+  ags_ring_buffer_free(ring_buffer);
+}
+
+int
+main(int argc, char **argv)
+{
+  CU_pSuite pSuite = NULL;
+
+  /* initialize the CUnit test registry */
+  if(CUE_SUCCESS != CU_initialize_registry()){
+    return CU_get_error();
+  }
+
+  /* add a suite to the registry */
+  pSuite = CU_add_suite("AgsRingBufferTest", ags_ring_buffer_test_init_suite, ags_ring_buffer_test_clean_suite);
+
+  if(pSuite == NULL){
+    CU_cleanup_registry();
+
+    return CU_get_error();
+  }
+
+  /* add the tests to the suite */
+  if((CU_add_test(pSuite, "test of AgsRingBuffer alloc", ags_ring_buffer_test_alloc) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsRingBuffer write read", ags_ring_buffer_test_write_read) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsRingBuffer wrap around", ags_ring_buffer_test_wrap_around) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsRingBuffer concurrent", ags_ring_buffer_test_concurrent) == NULL)){
+    CU_cleanup_registry();
+
+    return CU_get_error();
+  }
+
+  /* Run all tests using the CUnit Basic interface */
+  CU_basic_set_mode(CU_BRM_VERBOSE);
+  CU_basic_run_tests();
+
+  CU_cleanup_registry();
+
+  return(CU_get_error());
+}
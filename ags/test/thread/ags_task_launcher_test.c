@@ -33,6 +33,17 @@ void ags_task_launcher_test_add_task();
 void ags_task_launcher_test_add_task_all();
 void ags_task_launcher_test_add_cyclic_task();
 void ags_task_launcher_test_remove_cyclic_task();
+void ags_task_launcher_test_run();
+void ags_task_launcher_test_coalesce();
+void ags_task_launcher_test_max_task_count();
+
+void ags_task_launcher_test_launch_callback(AgsTask *task,
+					    GList **launched);
+
+#define AGS_TASK_LAUNCHER_TEST_RUN_N_TASK (16)
+
+#define AGS_TASK_LAUNCHER_TEST_MAX_TASK_COUNT_N_TASK (10)
+#define AGS_TASK_LAUNCHER_TEST_MAX_TASK_COUNT (4)
 
 /* The suite initialization function.
  * Opens the temporary file used by the tests.
@@ -59,20 +70,41 @@ ags_task_launcher_test_add_task()
 {
   AgsTaskLauncher *task_launcher;
   AgsTask *task_0, *task_1;
+
+  GList *start_task;
   
   task_launcher = ags_task_launcher_new();
 
-  CU_ASSERT(task_launcher->task == NULL);
+  CU_ASSERT(ags_task_launcher_get_queue_depth(task_launcher) == 0);
   
   task_0 = ags_task_new();
   ags_task_launcher_add_task(task_launcher, task_0);
 
-  CU_ASSERT(g_list_find(task_launcher->task, task_0) != NULL);
+  CU_ASSERT(ags_task_launcher_get_queue_depth(task_launcher) == 1);
+  CU_ASSERT(ags_task_is_queued(task_0) == TRUE);
   
   task_1 = ags_task_new();
   ags_task_launcher_add_task(task_launcher, task_1);
 
-  CU_ASSERT(g_list_find(task_launcher->task, task_1) != NULL);
+  CU_ASSERT(ags_task_launcher_get_queue_depth(task_launcher) == 2);
+
+  /* already queued */
+  ags_task_launcher_add_task(task_launcher, task_1);
+
+  CU_ASSERT(ags_task_launcher_get_queue_depth(task_launcher) == 2);
+
+  start_task = NULL;
+  
+  g_object_get(task_launcher,
+	       "task", &start_task,
+	       NULL);
+
+  CU_ASSERT(g_list_length(start_task) == 2);
+  CU_ASSERT(g_list_nth_data(start_task, 0) == task_0);
+  CU_ASSERT(g_list_nth_data(start_task, 1) == task_1);
+
+  g_list_free_full(start_task,
+		   (GDestroyNotify) g_object_unref);
 }
 
 void
@@ -97,8 +129,21 @@ ags_task_launcher_test_add_task_all()
 
   ags_task_launcher_add_task_all(task_launcher, start_task);
 
-  CU_ASSERT(g_list_find(task_launcher->task, task_0) != NULL);
-  CU_ASSERT(g_list_find(task_launcher->task, task_1) != NULL);
+  g_list_free(start_task);
+
+  CU_ASSERT(ags_task_launcher_get_queue_depth(task_launcher) == 2);
+
+  start_task = NULL;
+  
+  g_object_get(task_launcher,
+	       "task", &start_task,
+	       NULL);
+
+  CU_ASSERT(g_list_find(start_task, task_0) != NULL);
+  CU_ASSERT(g_list_find(start_task, task_1) != NULL);
+
+  g_list_free_full(start_task,
+		   (GDestroyNotify) g_object_unref);
 }
 
 void
@@ -153,6 +198,203 @@ ags_task_launcher_test_remove_cyclic_task()
   CU_ASSERT(g_list_find(task_launcher->cyclic_task, task_1) == NULL);
 }
 
+void
+ags_task_launcher_test_launch_callback(AgsTask *task,
+				       GList **launched)
+{
+  launched[0] = g_list_prepend(launched[0],
+			       task);
+}
+
+void
+ags_task_launcher_test_run()
+{
+  AgsTaskLauncher *task_launcher;
+  AgsTask *task[AGS_TASK_LAUNCHER_TEST_RUN_N_TASK];
+
+  GList *launched, *list;
+
+  guint64 executed_count;
+  guint i;
+  gboolean success;
+  
+  task_launcher = ags_task_launcher_new();
+
+  launched = NULL;
+  
+  for(i = 0; i < AGS_TASK_LAUNCHER_TEST_RUN_N_TASK; i++){
+    task[i] = ags_task_new();
+    g_signal_connect(task[i], "launch",
+		     G_CALLBACK(ags_task_launcher_test_launch_callback), &launched);
+    
+    ags_task_launcher_add_task(task_launcher, task[i]);
+  }
+
+  ags_task_launcher_run(task_launcher);
+
+  CU_ASSERT(ags_task_launcher_get_queue_depth(task_launcher) == 0);
+
+  /* FIFO */
+  launched = g_list_reverse(launched);
+
+  CU_ASSERT(g_list_length(launched) == AGS_TASK_LAUNCHER_TEST_RUN_N_TASK);
+
+  list = launched;
+  success = TRUE;
+  
+  for(i = 0; i < AGS_TASK_LAUNCHER_TEST_RUN_N_TASK && list != NULL; i++){
+    if(list->data != task[i] ||
+       ags_task_is_queued(task[i])){
+      success = FALSE;
+      
+      break;
+    }
+
+    list = list->next;
+  }
+
+  CU_ASSERT(success);
+
+  ags_task_launcher_get_stats(task_launcher,
+			      NULL,
+			      &executed_count,
+			      NULL,
+			      NULL,
+			      NULL);
+
+  CU_ASSERT(executed_count == AGS_TASK_LAUNCHER_TEST_RUN_N_TASK);
+
+  g_list_free(launched);
+}
+
+void
+ags_task_launcher_test_coalesce()
+{
+  AgsTaskLauncher *task_launcher;
+  AgsTask *task_0, *task_1, *task_2, *task_3;
+  GObject *scope;
+  
+  GList *launched;
+
+  guint64 coalesced_count;
+  
+  task_launcher = ags_task_launcher_new();
+
+  scope = g_object_new(G_TYPE_OBJECT,
+		       NULL);
+  
+  launched = NULL;
+
+  task_0 = ags_task_new();
+  ags_task_set_coalesce_key(task_0,
+			    scope, "bpm");
+  g_signal_connect(task_0, "launch",
+		   G_CALLBACK(ags_task_launcher_test_launch_callback), &launched);
+
+  task_1 = ags_task_new();
+  ags_task_set_coalesce_key(task_1,
+			    scope, "tact");
+  g_signal_connect(task_1, "launch",
+		   G_CALLBACK(ags_task_launcher_test_launch_callback), &launched);
+
+  task_2 = ags_task_new();
+  ags_task_set_coalesce_key(task_2,
+			    scope, "bpm");
+  g_signal_connect(task_2, "launch",
+		   G_CALLBACK(ags_task_launcher_test_launch_callback), &launched);
+
+  /* same key but different detail */
+  task_3 = ags_task_new();
+  ags_task_set_coalesce_key(task_3,
+			    scope, "tact");
+  ags_task_set_coalesce_detail(task_3,
+			       1);
+  g_signal_connect(task_3, "launch",
+		   G_CALLBACK(ags_task_launcher_test_launch_callback), &launched);
+
+  ags_task_launcher_add_task(task_launcher, task_0);
+  ags_task_launcher_add_task(task_launcher, task_1);
+  ags_task_launcher_add_task(task_launcher, task_2);
+  ags_task_launcher_add_task(task_launcher, task_3);
+
+  ags_task_launcher_run(task_launcher);
+
+  /* last write wins */
+  launched = g_list_reverse(launched);
+  
+  CU_ASSERT(g_list_length(launched) == 3);
+  CU_ASSERT(g_list_nth_data(launched, 0) == task_1);
+  CU_ASSERT(g_list_nth_data(launched, 1) == task_2);
+  CU_ASSERT(g_list_nth_data(launched, 2) == task_3);
+
+  CU_ASSERT(ags_task_is_queued(task_0) == FALSE);
+  CU_ASSERT(ags_task_launcher_get_queue_depth(task_launcher) == 0);
+
+  ags_task_launcher_get_stats(task_launcher,
+			      NULL,
+			      NULL,
+			      &coalesced_count,
+			      NULL,
+			      NULL);
+
+  CU_ASSERT(coalesced_count == 1);
+
+  g_list_free(launched);
+}
+
+void
+ags_task_launcher_test_max_task_count()
+{
+  AgsTaskLauncher *task_launcher;
+  AgsTask *task[AGS_TASK_LAUNCHER_TEST_MAX_TASK_COUNT_N_TASK];
+
+  GList *launched;
+
+  guint i;
+  
+  task_launcher = ags_task_launcher_new();
+
+  CU_ASSERT(ags_task_launcher_get_max_task_count(task_launcher) == AGS_TASK_LAUNCHER_DEFAULT_MAX_TASK_COUNT);
+  
+  ags_task_launcher_set_max_task_count(task_launcher,
+				       AGS_TASK_LAUNCHER_TEST_MAX_TASK_COUNT);
+
+  CU_ASSERT(ags_task_launcher_get_max_task_count(task_launcher) == AGS_TASK_LAUNCHER_TEST_MAX_TASK_COUNT);
+
+  launched = NULL;
+  
+  for(i = 0; i < AGS_TASK_LAUNCHER_TEST_MAX_TASK_COUNT_N_TASK; i++){
+    task[i] = ags_task_new();
+    g_signal_connect(task[i], "launch",
+		     G_CALLBACK(ags_task_launcher_test_launch_callback), &launched);
+    
+    ags_task_launcher_add_task(task_launcher, task[i]);
+  }
+
+  /* capped runs */
+  ags_task_launcher_run(task_launcher);
+
+  CU_ASSERT(g_list_length(launched) == AGS_TASK_LAUNCHER_TEST_MAX_TASK_COUNT);
+  CU_ASSERT(ags_task_launcher_get_queue_depth(task_launcher) == AGS_TASK_LAUNCHER_TEST_MAX_TASK_COUNT_N_TASK - AGS_TASK_LAUNCHER_TEST_MAX_TASK_COUNT);
+
+  ags_task_launcher_run(task_launcher);
+
+  CU_ASSERT(g_list_length(launched) == 2 * AGS_TASK_LAUNCHER_TEST_MAX_TASK_COUNT);
+
+  ags_task_launcher_run(task_launcher);
+
+  CU_ASSERT(g_list_length(launched) == AGS_TASK_LAUNCHER_TEST_MAX_TASK_COUNT_N_TASK);
+  CU_ASSERT(ags_task_launcher_get_queue_depth(task_launcher) == 0);
+
+  /* order kept across runs */
+  launched = g_list_reverse(launched);
+
+  CU_ASSERT(g_list_nth_data(launched, AGS_TASK_LAUNCHER_TEST_MAX_TASK_COUNT) == task[AGS_TASK_LAUNCHER_TEST_MAX_TASK_COUNT]);
+  CU_ASSERT(g_list_last(launched)->data == task[AGS_TASK_LAUNCHER_TEST_MAX_TASK_COUNT_N_TASK - 1]);
+
+  g_list_free(launched);
+}
+
 int
 main(int argc, char **argv)
 {
@@ -176,7 +418,10 @@ main(int argc, char **argv)
   if((CU_add_test(pSuite, "test of AgsTaskLauncher add task", ags_task_launcher_test_add_task) == NULL) ||
      (CU_add_test(pSuite, "test of AgsTaskLauncher add task all", ags_task_launcher_test_add_task_all) == NULL) ||
      (CU_add_test(pSuite, "test of AgsTaskLauncher add cyclic task", ags_task_launcher_test_add_cyclic_task) == NULL) ||
-     (CU_add_test(pSuite, "test of AgsTaskLauncher remove cyclic task", ags_task_launcher_test_remove_cyclic_task) == NULL)){
+     (CU_add_test(pSuite, "test of AgsTaskLauncher remove cyclic task", ags_task_launcher_test_remove_cyclic_task) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsTaskLauncher run", ags_task_launcher_test_run) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsTaskLauncher coalesce", ags_task_launcher_test_coalesce) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsTaskLauncher max task count", ags_task_launcher_test_max_task_count) == NULL)){
     CU_cleanup_registry();
       
     return CU_get_error();
@@ -26,6 +26,9 @@
 
 #include <ags/libags.h>
 
+#include <math.h>
+#include <time.h>
+
 int ags_thread_test_init_suite();
 int ags_thread_test_clean_suite();
 
@@ -38,9 +41,16 @@ void ags_thread_test_remove_child();
 void ags_thread_test_add_child();
 void ags_thread_test_is_current_ready();
 void ags_thread_test_stop();
+void ags_thread_test_tic_jitter();
 
 void* ags_thread_test_lock_assert_locked(void *ptr);
 
+void ags_thread_test_tic_jitter_run_callback(AgsThread *thread,
+					     gpointer data);
+gpointer ags_thread_test_tic_jitter_poll_thread(gpointer data);
+gpointer ags_thread_test_tic_jitter_barrier_thread(gpointer data);
+gint64 ags_thread_test_tic_jitter_wakeup(GThreadFunc wait_func);
+
 #define AGS_THREAD_TEST_LOCK_N_THREADS (4)
 
 #define AGS_THREAD_TEST_GET_TOPLEVEL_N_LEVELS (7)
@@ -53,10 +63,22 @@ void* ags_thread_test_lock_assert_locked(void *ptr);
 
 #define AGS_THREAD_TEST_ADD_CHILD_N_THREADS (16)
 
+#define AGS_THREAD_TEST_TIC_JITTER_N_TICS (500)
+#define AGS_THREAD_TEST_TIC_JITTER_TIMEOUT (30 * G_USEC_PER_SEC)
+
+#define AGS_THREAD_TEST_TIC_JITTER_N_WAKEUPS (50)
+#define AGS_THREAD_TEST_TIC_JITTER_WAKEUP_DELAY (2000)
+
 AgsApplicationContext *application_context;
 
 AgsThread *main_loop;
 
+gint64 tic_jitter_time[AGS_THREAD_TEST_TIC_JITTER_N_TICS];
+volatile gint tic_jitter_count;
+
+AgsTicBarrier tic_jitter_barrier;
+volatile gint tic_jitter_wakeup;
+
 /* The suite initialization function.
  * Opens the temporary file used by the tests.
  * Returns zero on success, non-zero otherwise.
@@ -391,6 +413,189 @@ ags_thread_test_stop()
   //TODO:JK: implement me
 }
 
+void
+ags_thread_test_tic_jitter_run_callback(AgsThread *thread,
+					gpointer data)
+{
+  gint i;
+
+  i = ags_atomic_int_get(&tic_jitter_count);
+
+  if(i < AGS_THREAD_TEST_TIC_JITTER_N_TICS){
+    tic_jitter_time[i] = g_get_monotonic_time();
+
+    ags_atomic_int_set(&tic_jitter_count,
+		       i + 1);
+  }
+}
+
+gpointer
+ags_thread_test_tic_jitter_poll_thread(gpointer data)
+{
+  struct timespec start_cpu_time, stop_cpu_time;
+
+  gint i;
+
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &start_cpu_time);
+
+  /* sleep-polling as ags_thread_real_clock() did before the tic barrier */
+  for(i = 0; i < AGS_THREAD_TEST_TIC_JITTER_N_WAKEUPS; i++){
+    while(ags_atomic_int_get(&tic_jitter_wakeup) <= i){
+      g_usleep(4);
+    }
+  }
+
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &stop_cpu_time);
+
+  *((gint64 *) data) = (stop_cpu_time.tv_sec - start_cpu_time.tv_sec) * G_USEC_PER_SEC + (stop_cpu_time.tv_nsec - start_cpu_time.tv_nsec) / 1000;
+
+  return(NULL);
+}
+
+gpointer
+ags_thread_test_tic_jitter_barrier_thread(gpointer data)
+{
+  struct timespec start_cpu_time, stop_cpu_time;
+
+  guint generation;
+  gint i;
+
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &start_cpu_time);
+
+  for(i = 0; i < AGS_THREAD_TEST_TIC_JITTER_N_WAKEUPS; i++){
+    generation = ags_tic_barrier_get_generation(&tic_jitter_barrier);
+    
+    while(ags_atomic_int_get(&tic_jitter_wakeup) <= i){
+      ags_tic_barrier_wait(&tic_jitter_barrier,
+			   generation);
+
+      generation = ags_tic_barrier_get_generation(&tic_jitter_barrier);
+    }
+  }
+
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &stop_cpu_time);
+
+  *((gint64 *) data) = (stop_cpu_time.tv_sec - start_cpu_time.tv_sec) * G_USEC_PER_SEC + (stop_cpu_time.tv_nsec - start_cpu_time.tv_nsec) / 1000;
+
+  return(NULL);
+}
+
+gint64
+ags_thread_test_tic_jitter_wakeup(GThreadFunc wait_func)
+{
+  GThread *thread;
+
+  gint64 cpu_time;
+  gint i;
+
+  ags_atomic_int_set(&tic_jitter_wakeup,
+		     0);
+
+  ags_tic_barrier_init(&tic_jitter_barrier);
+
+  cpu_time = 0;
+  
+  thread = g_thread_new("tic jitter wakeup",
+			wait_func,
+			&cpu_time);
+
+  for(i = 0; i < AGS_THREAD_TEST_TIC_JITTER_N_WAKEUPS; i++){
+    g_usleep(AGS_THREAD_TEST_TIC_JITTER_WAKEUP_DELAY);
+
+    ags_atomic_int_set(&tic_jitter_wakeup,
+		       i + 1);
+    ags_tic_barrier_advance(&tic_jitter_barrier);
+  }
+
+  g_thread_join(thread);
+
+  ags_tic_barrier_clear(&tic_jitter_barrier);
+
+  return(cpu_time);
+}
+
+void
+ags_thread_test_tic_jitter()
+{
+  AgsThread *thread;
+
+  gint64 start_time;
+  gdouble interval, deviation;
+  gdouble mean, sum_of_squares, max_deviation;
+  gdouble rms;
+  gint64 poll_cpu_time, barrier_cpu_time;
+  guint i;
+
+  ags_atomic_int_set(&tic_jitter_count,
+		     0);
+
+  /* a child running every tic of main loop */
+  thread = ags_thread_new();
+  
+  g_signal_connect(thread, "run",
+		   G_CALLBACK(ags_thread_test_tic_jitter_run_callback), NULL);
+
+  ags_thread_add_child_extended(main_loop,
+				thread,
+				FALSE, FALSE);
+
+  start_time = g_get_monotonic_time();
+  
+  while(ags_atomic_int_get(&tic_jitter_count) < AGS_THREAD_TEST_TIC_JITTER_N_TICS &&
+	g_get_monotonic_time() - start_time < AGS_THREAD_TEST_TIC_JITTER_TIMEOUT){
+    g_usleep(G_USEC_PER_SEC / 10);
+  }
+
+  ags_thread_stop(thread);
+  ags_thread_remove_child(main_loop,
+			  thread);
+
+  CU_ASSERT(ags_atomic_int_get(&tic_jitter_count) == AGS_THREAD_TEST_TIC_JITTER_N_TICS);
+
+  if(ags_atomic_int_get(&tic_jitter_count) < AGS_THREAD_TEST_TIC_JITTER_N_TICS){
+    return;
+  }
+
+  /* jitter is the deviation of tic interval from its mean */
+  mean = (gdouble) (tic_jitter_time[AGS_THREAD_TEST_TIC_JITTER_N_TICS - 1] - tic_jitter_time[0]) / (gdouble) (AGS_THREAD_TEST_TIC_JITTER_N_TICS - 1);
+
+  sum_of_squares = 0.0;
+  max_deviation = 0.0;
+  
+  for(i = 1; i < AGS_THREAD_TEST_TIC_JITTER_N_TICS; i++){
+    interval = (gdouble) (tic_jitter_time[i] - tic_jitter_time[i - 1]);
+
+    deviation = fabs(interval - mean);
+    
+    sum_of_squares += deviation * deviation;
+
+    if(deviation > max_deviation){
+      max_deviation = deviation;
+    }
+  }
+
+  rms = sqrt(sum_of_squares / (gdouble) (AGS_THREAD_TEST_TIC_JITTER_N_TICS - 1));
+  
+  g_message("tic jitter - mean interval %.1fus, rms %.1fus, max %.1fus",
+	    mean,
+	    rms,
+	    max_deviation);
+
+  /* the tics stay periodic - jitter below one tic interval */
+  CU_ASSERT(mean > 0.0);
+  CU_ASSERT(rms < mean);
+
+  /* before and after - sleep-polling versus tic barrier waiting the same wake-ups */
+  poll_cpu_time = ags_thread_test_tic_jitter_wakeup(ags_thread_test_tic_jitter_poll_thread);
+  barrier_cpu_time = ags_thread_test_tic_jitter_wakeup(ags_thread_test_tic_jitter_barrier_thread);
+
+  g_message("tic wake-up waiter cpu time - sleep-polling %" G_GINT64_FORMAT "us, tic barrier %" G_GINT64_FORMAT "us",
+	    poll_cpu_time,
+	    barrier_cpu_time);
+
+  CU_ASSERT(barrier_cpu_time < poll_cpu_time);
+}
+
 int
 main(int argc, char **argv)
 {
@@ -422,7 +627,8 @@ main(int argc, char **argv)
      (CU_add_test(pSuite, "test of AgsThread remove child", ags_thread_test_remove_child) == NULL) ||
      (CU_add_test(pSuite, "test of AgsThread add child", ags_thread_test_add_child) == NULL) ||
      (CU_add_test(pSuite, "test of AgsThread is current ready", ags_thread_test_is_current_ready) == NULL) ||
-     (CU_add_test(pSuite, "test of AgsThread stop", ags_thread_test_stop) == NULL)){
+     (CU_add_test(pSuite, "test of AgsThread stop", ags_thread_test_stop) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsThread tic jitter", ags_thread_test_tic_jitter) == NULL)){
     CU_cleanup_registry();
       
     return CU_get_error();
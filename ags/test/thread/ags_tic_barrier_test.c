@@ -0,0 +1,221 @@
+/* GSequencer - Advanced GTK Sequencer
+ * Copyright (C) 2005-2026 Joël Krähemann
+ *
+ * This file is part of GSequencer.
+ *
+ * GSequencer is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GSequencer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GSequencer.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <glib.h>
+#include <glib-object.h>
+
+#include <ags/libags.h>
+
+#include <CUnit/CUnit.h>
+#include <CUnit/Automated.h>
+#include <CUnit/Basic.h>
+
+#include <stdlib.h>
+
+int ags_tic_barrier_test_init_suite();
+int ags_tic_barrier_test_clean_suite();
+
+void ags_tic_barrier_test_advance();
+void ags_tic_barrier_test_wait_until();
+void ags_tic_barrier_test_concurrent();
+
+gpointer ags_tic_barrier_test_concurrent_publisher(gpointer data);
+
+#define AGS_TIC_BARRIER_TEST_WAIT_UNTIL_TIMEOUT (20000)
+
+#define AGS_TIC_BARRIER_TEST_CONCURRENT_N_TIC (65536)
+
+volatile gint tic_barrier_test_state;
+
+/* The suite initialization function.
+ * Opens the temporary file used by the tests.
+ * Returns zero on success, non-zero otherwise.
+ */
+int
+ags_tic_barrier_test_init_suite()
+{
+  return(0);
+}
+
+/* The suite cleanup function.
+ * Closes the temporary file used by the tests.
+ * Returns zero on success, non-zero otherwise.
+ */
+int
+ags_tic_barrier_test_clean_suite()
+{
+  return(0);
+}
+
+void
+ags_tic_barrier_test_advance()
+{
+  AgsTicBarrier tic_barrier;
+
+  guint generation;
+
+  ags_tic_barrier_init(&tic_barrier);
+
+  generation = ags_tic_barrier_get_generation(&tic_barrier);
+
+  CU_ASSERT(generation == 0);
+
+  ags_tic_barrier_advance(&tic_barrier);
+
+  CU_ASSERT(ags_tic_barrier_get_generation(&tic_barrier) == generation + 1);
+
+  /* already advanced - returns immediately */
+  ags_tic_barrier_wait(&tic_barrier,
+		       generation);
+
+  CU_ASSERT(tic_barrier.waiter_count == 0);
+
+  ags_tic_barrier_clear(&tic_barrier);
+}
+
+void
+ags_tic_barrier_test_wait_until()
+{
+  AgsTicBarrier tic_barrier;
+
+  gint64 start_time;
+  guint generation;
+
+  ags_tic_barrier_init(&tic_barrier);
+
+  generation = ags_tic_barrier_get_generation(&tic_barrier);
+
+  /* time out */
+  start_time = g_get_monotonic_time();
+  
+  CU_ASSERT(ags_tic_barrier_wait_until(&tic_barrier,
+				       generation,
+				       start_time + AGS_TIC_BARRIER_TEST_WAIT_UNTIL_TIMEOUT) == FALSE);
+  CU_ASSERT(g_get_monotonic_time() - start_time >= AGS_TIC_BARRIER_TEST_WAIT_UNTIL_TIMEOUT);
+
+  /* advanced */
+  ags_tic_barrier_advance(&tic_barrier);
+
+  CU_ASSERT(ags_tic_barrier_wait_until(&tic_barrier,
+				       generation,
+				       g_get_monotonic_time() + AGS_TIC_BARRIER_TEST_WAIT_UNTIL_TIMEOUT) == TRUE);
+
+  ags_tic_barrier_clear(&tic_barrier);
+}
+
+gpointer
+ags_tic_barrier_test_concurrent_publisher(gpointer data)
+{
+  AgsTicBarrier *tic_barrier;
+
+  guint i;
+
+  tic_barrier = (AgsTicBarrier *) data;
+
+  for(i = 1; i <= AGS_TIC_BARRIER_TEST_CONCURRENT_N_TIC; i++){
+    ags_atomic_int_set(&tic_barrier_test_state,
+		       i);
+
+    ags_tic_barrier_advance(tic_barrier);
+  }
+
+  return(NULL);
+}
+
+void
+ags_tic_barrier_test_concurrent()
+{
+  AgsTicBarrier tic_barrier;
+
+  GThread *thread;
+
+  guint generation;
+  gint state, seen;
+  
+  ags_tic_barrier_init(&tic_barrier);
+
+  ags_atomic_int_set(&tic_barrier_test_state,
+		     0);
+  
+  thread = g_thread_new("tic barrier publisher",
+			ags_tic_barrier_test_concurrent_publisher,
+			&tic_barrier);
+
+  /* no advance gets lost, otherwise this hangs */
+  seen = 0;
+  
+  while(seen < AGS_TIC_BARRIER_TEST_CONCURRENT_N_TIC){
+    generation = ags_tic_barrier_get_generation(&tic_barrier);
+
+    state = ags_atomic_int_get(&tic_barrier_test_state);
+
+    if(state > seen){
+      seen = state;
+      
+      continue;
+    }
+
+    ags_tic_barrier_wait(&tic_barrier,
+			 generation);
+  }
+
+  g_thread_join(thread);
+
+  CU_ASSERT(seen == AGS_TIC_BARRIER_TEST_CONCURRENT_N_TIC);
+  CU_ASSERT(ags_tic_barrier_get_generation(&tic_barrier) == AGS_TIC_BARRIER_TEST_CONCURRENT_N_TIC);
+
+  ags_tic_barrier_clear(&tic_barrier);
+}
+
+int
+main(int argc, char **argv)
+{
+  CU_pSuite pSuite = NULL;
+
+  /* initialize the CUnit test registry */
+  if(CUE_SUCCESS != CU_initialize_registry()){
+    return CU_get_error();
+  }
+
+  /* add a suite to the registry */
+  pSuite = CU_add_suite("AgsTicBarrierTest", ags_tic_barrier_test_init_suite, ags_tic_barrier_test_clean_suite);
+
+  if(pSuite == NULL){
+    CU_cleanup_registry();
+
+    return CU_get_error();
+  }
+
+  /* add the tests to the suite */
+  if((CU_add_test(pSuite, "test of AgsTicBarrier advance", ags_tic_barrier_test_advance) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsTicBarrier wait until", ags_tic_barrier_test_wait_until) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsTicBarrier concurrent", ags_tic_barrier_test_concurrent) == NULL)){
+    CU_cleanup_registry();
+
+    return CU_get_error();
+  }
+
+  /* Run all tests using the CUnit Basic interface */
+  CU_basic_set_mode(CU_BRM_VERBOSE);
+  CU_basic_run_tests();
+
+  CU_cleanup_registry();
+
+  return(CU_get_error());
+}
@@ -0,0 +1,282 @@
+/* GSequencer - Advanced GTK Sequencer
+ * Copyright (C) 2005-2026 Joël Krähemann
+ *
+ * This file is part of GSequencer.
+ *
+ * GSequencer is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GSequencer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GSequencer.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <glib.h>
+#include <glib-object.h>
+
+#include <ags/libags.h>
+
+#include <CUnit/CUnit.h>
+#include <CUnit/Automated.h>
+#include <CUnit/Basic.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+int ags_trace_test_init_suite();
+int ags_trace_test_clean_suite();
+
+void ags_trace_test_buffer_alloc();
+void ags_trace_test_set_buffer_size();
+void ags_trace_test_record();
+void ags_trace_test_wrap_around();
+void ags_trace_test_dump();
+
+gpointer ags_trace_test_wrap_around_thread(gpointer data);
+
+#define AGS_TRACE_TEST_BUFFER_ALLOC_EVENT_COUNT (16)
+
+#define AGS_TRACE_TEST_WRAP_AROUND_BUFFER_SIZE (8)
+#define AGS_TRACE_TEST_WRAP_AROUND_EVENT_COUNT (20)
+
+/* The suite initialization function.
+ * Opens the temporary file used by the tests.
+ * Returns zero on success, non-zero otherwise.
+ */
+int
+ags_trace_test_init_suite()
+{
+  return(0);
+}
+
+/* The suite cleanup function.
+ * Closes the temporary file used by the tests.
+ * Returns zero on success, non-zero otherwise.
+ */
+int
+ags_trace_test_clean_suite()
+{
+  ags_trace_set_enabled(FALSE);
+  
+  return(0);
+}
+
+void
+ags_trace_test_buffer_alloc()
+{
+  AgsTraceBuffer *trace_buffer;
+
+  trace_buffer = ags_trace_buffer_alloc(AGS_TRACE_TEST_BUFFER_ALLOC_EVENT_COUNT);
+
+  CU_ASSERT(trace_buffer != NULL);
+  CU_ASSERT(trace_buffer->event_count == AGS_TRACE_TEST_BUFFER_ALLOC_EVENT_COUNT);
+  CU_ASSERT(trace_buffer->event_mask == AGS_TRACE_TEST_BUFFER_ALLOC_EVENT_COUNT - 1);
+  CU_ASSERT(trace_buffer->event != NULL);
+  CU_ASSERT(trace_buffer->write_index == 0);
+
+  ags_trace_buffer_free(trace_buffer);
+}
+
+void
+ags_trace_test_set_buffer_size()
+{
+  guint buffer_size;
+
+  buffer_size = ags_trace_get_buffer_size();
+  
+  ags_trace_set_buffer_size(1000);
+
+  CU_ASSERT(ags_trace_get_buffer_size() == 1024);
+
+  ags_trace_set_buffer_size(buffer_size);
+
+  CU_ASSERT(ags_trace_get_buffer_size() == buffer_size);
+}
+
+void
+ags_trace_test_record()
+{
+  AgsTraceBuffer *trace_buffer;
+
+  gint64 write_index;
+
+  trace_buffer = ags_trace_get_buffer();
+
+  CU_ASSERT(trace_buffer != NULL);
+  CU_ASSERT(trace_buffer == ags_trace_get_buffer());
+
+  write_index = trace_buffer->write_index;
+  
+  /* disabled */
+  ags_trace_set_enabled(FALSE);
+
+  ags_trace_begin("test", "disabled");
+  
+  CU_ASSERT(trace_buffer->write_index == write_index);
+
+  /* enabled */
+  ags_trace_set_enabled(TRUE);
+
+  ags_trace_begin("test", "span");
+  ags_trace_counter("test", "counter",
+		    7);
+  ags_trace_end("test", "span");
+
+  CU_ASSERT(trace_buffer->write_index == write_index + 3);
+
+  CU_ASSERT(trace_buffer->event[write_index & trace_buffer->event_mask].phase == AGS_TRACE_EVENT_BEGIN);
+  CU_ASSERT(!g_strcmp0(trace_buffer->event[write_index & trace_buffer->event_mask].name, "span"));
+
+  CU_ASSERT(trace_buffer->event[(write_index + 1) & trace_buffer->event_mask].phase == AGS_TRACE_EVENT_COUNTER);
+  CU_ASSERT(trace_buffer->event[(write_index + 1) & trace_buffer->event_mask].value == 7);
+
+  CU_ASSERT(trace_buffer->event[(write_index + 2) & trace_buffer->event_mask].phase == AGS_TRACE_EVENT_END);
+  CU_ASSERT(trace_buffer->event[(write_index + 2) & trace_buffer->event_mask].timestamp >= trace_buffer->event[write_index & trace_buffer->event_mask].timestamp);
+}
+
+gpointer
+ags_trace_test_wrap_around_thread(gpointer data)
+{
+  static const gchar *name[] = {
+    "event-0",
+    "event-1",
+  };
+  
+  guint i;
+
+  ags_trace_set_thread_name("wrap-around");
+  
+  /* the first event registers the buffer */
+  for(i = 0; i < AGS_TRACE_TEST_WRAP_AROUND_EVENT_COUNT; i++){
+    ags_trace_instant("test", name[(i < AGS_TRACE_TEST_WRAP_AROUND_EVENT_COUNT - AGS_TRACE_TEST_WRAP_AROUND_BUFFER_SIZE) ? 0: 1]);
+  }
+
+  return(ags_trace_get_buffer());
+}
+
+void
+ags_trace_test_wrap_around()
+{
+  AgsTraceBuffer *trace_buffer;
+
+  GThread *thread;
+
+  gchar *dump;
+
+  guint buffer_size;
+  guint i;
+  gboolean success;
+  
+  buffer_size = ags_trace_get_buffer_size();
+
+  ags_trace_set_enabled(TRUE);
+  ags_trace_set_buffer_size(AGS_TRACE_TEST_WRAP_AROUND_BUFFER_SIZE);
+  
+  thread = g_thread_new("wrap-around",
+			ags_trace_test_wrap_around_thread,
+			NULL);
+
+  trace_buffer = g_thread_join(thread);
+
+  ags_trace_set_buffer_size(buffer_size);
+
+  CU_ASSERT(trace_buffer != NULL);
+  CU_ASSERT(trace_buffer->event_count == AGS_TRACE_TEST_WRAP_AROUND_BUFFER_SIZE);
+  CU_ASSERT(trace_buffer->write_index == AGS_TRACE_TEST_WRAP_AROUND_EVENT_COUNT);
+  CU_ASSERT(!g_strcmp0(trace_buffer->thread_name, "wrap-around"));
+
+  /* only the newest events are kept */
+  success = TRUE;
+
+  for(i = 0; i < AGS_TRACE_TEST_WRAP_AROUND_BUFFER_SIZE; i++){
+    if(g_strcmp0(trace_buffer->event[i].name, "event-1") != 0){
+      success = FALSE;
+
+      break;
+    }
+  }
+
+  CU_ASSERT(success);
+
+  dump = ags_trace_dump();
+
+  CU_ASSERT(strstr(dump, "\"event-1\"") != NULL);
+  CU_ASSERT(strstr(dump, "\"event-0\"") == NULL);
+  CU_ASSERT(strstr(dump, "\"wrap-around\"") != NULL);
+
+  g_free(dump);
+}
+
+void
+ags_trace_test_dump()
+{
+  gchar *dump;
+
+  ags_trace_set_enabled(TRUE);
+
+  ags_trace_clear();
+
+  ags_trace_begin("test", "dump-span");
+  ags_trace_counter("test", "dump-counter",
+		    42);
+  ags_trace_end("test", "dump-span");
+
+  dump = ags_trace_dump();
+
+  CU_ASSERT(dump != NULL);
+  CU_ASSERT(g_str_has_prefix(dump, "{\"displayTimeUnit\":\"ms\",\n\"traceEvents\":["));
+  CU_ASSERT(strstr(dump, "\"name\":\"dump-span\",\"cat\":\"test\",\"ph\":\"B\"") != NULL);
+  CU_ASSERT(strstr(dump, "\"name\":\"dump-span\",\"cat\":\"test\",\"ph\":\"E\"") != NULL);
+  CU_ASSERT(strstr(dump, "\"args\":{\"value\":42}") != NULL);
+
+  /* cleared events are skipped */
+  CU_ASSERT(strstr(dump, "\"name\":\"span\"") == NULL);
+
+  g_free(dump);
+}
+
+int
+main(int argc, char **argv)
+{
+  CU_pSuite pSuite = NULL;
+
+  /* initialize the CUnit test registry */
+  if(CUE_SUCCESS != CU_initialize_registry()){
+    return CU_get_error();
+  }
+
+  /* add a suite to the registry */
+  pSuite = CU_add_suite("AgsTraceTest", ags_trace_test_init_suite, ags_trace_test_clean_suite);
+
+  if(pSuite == NULL){
+    CU_cleanup_registry();
+
+    return CU_get_error();
+  }
+
+  /* add the tests to the suite */
+  if((CU_add_test(pSuite, "test of AgsTrace buffer alloc", ags_trace_test_buffer_alloc) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsTrace set buffer size", ags_trace_test_set_buffer_size) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsTrace record", ags_trace_test_record) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsTrace wrap around", ags_trace_test_wrap_around) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsTrace dump", ags_trace_test_dump) == NULL)){
+    CU_cleanup_registry();
+
+    return CU_get_error();
+  }
+
+  /* Run all tests using the CUnit Basic interface */
+  CU_basic_set_mode(CU_BRM_VERBOSE);
+  CU_basic_run_tests();
+
+  CU_cleanup_registry();
+
+  return(CU_get_error());
+}
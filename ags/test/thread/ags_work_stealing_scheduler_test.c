@@ -0,0 +1,320 @@
+/* GSequencer - Advanced GTK Sequencer
+ * Copyright (C) 2005-2026 Joël Krähemann
+ *
+ * This file is part of GSequencer.
+ *
+ * GSequencer is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GSequencer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GSequencer.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <glib.h>
+#include <glib-object.h>
+
+#include <ags/libags.h>
+
+#include <CUnit/CUnit.h>
+#include <CUnit/Automated.h>
+#include <CUnit/Basic.h>
+
+#include <stdlib.h>
+
+int ags_work_stealing_scheduler_test_init_suite();
+int ags_work_stealing_scheduler_test_clean_suite();
+
+void ags_work_stealing_scheduler_test_add_node();
+void ags_work_stealing_scheduler_test_add_dependency();
+void ags_work_stealing_scheduler_test_clear_graph();
+void ags_work_stealing_scheduler_test_run();
+
+void ags_work_stealing_scheduler_test_stub_func(gpointer data);
+void ags_work_stealing_scheduler_test_order_func(gpointer data);
+
+#define AGS_WORK_STEALING_SCHEDULER_TEST_ADD_NODE_N_NODE (64)
+
+#define AGS_WORK_STEALING_SCHEDULER_TEST_RUN_N_WORKER (4)
+#define AGS_WORK_STEALING_SCHEDULER_TEST_RUN_N_CHAIN (16)
+#define AGS_WORK_STEALING_SCHEDULER_TEST_RUN_CHAIN_LENGTH (8)
+#define AGS_WORK_STEALING_SCHEDULER_TEST_RUN_N_CYCLE (256)
+
+struct AgsWorkStealingSchedulerTestOrder
+{
+  volatile gint *clock;
+  volatile gint stamp;
+  struct AgsWorkStealingSchedulerTestOrder *dependency;
+  volatile gint violation;
+};
+
+/* The suite initialization function.
+ * Opens the temporary file used by the tests.
+ * Returns zero on success, non-zero otherwise.
+ */
+int
+ags_work_stealing_scheduler_test_init_suite()
+{
+  return(0);
+}
+
+/* The suite cleanup function.
+ * Closes the temporary file used by the tests.
+ * Returns zero on success, non-zero otherwise.
+ */
+int
+ags_work_stealing_scheduler_test_clean_suite()
+{
+  return(0);
+}
+
+void
+ags_work_stealing_scheduler_test_stub_func(gpointer data)
+{
+  ags_atomic_int_increment((volatile gint *) data);
+}
+
+void
+ags_work_stealing_scheduler_test_order_func(gpointer data)
+{
+  struct AgsWorkStealingSchedulerTestOrder *order;
+
+  order = data;
+
+  /* the dependency must have completed before */
+  if(order->dependency != NULL &&
+     ags_atomic_int_get(&(order->dependency->stamp)) == 0){
+    ags_atomic_int_set(&(order->violation),
+		       TRUE);
+  }
+  
+  ags_atomic_int_set(&(order->stamp),
+		     ags_atomic_int_increment(order->clock) + 1);
+}
+
+void
+ags_work_stealing_scheduler_test_add_node()
+{
+  AgsWorkStealingScheduler *scheduler;
+
+  guint i;
+  gboolean success;
+
+  volatile gint counter;
+  
+  scheduler = ags_work_stealing_scheduler_new(1);
+
+  counter = 0;
+  
+  success = TRUE;
+  
+  for(i = 0; i < AGS_WORK_STEALING_SCHEDULER_TEST_ADD_NODE_N_NODE; i++){
+    if(ags_work_stealing_scheduler_add_node(scheduler,
+					    ags_work_stealing_scheduler_test_stub_func, (gpointer) &counter) != i){
+      success = FALSE;
+      
+      break;
+    }
+  }
+
+  CU_ASSERT(success);
+  CU_ASSERT(ags_work_stealing_scheduler_get_node_count(scheduler) == AGS_WORK_STEALING_SCHEDULER_TEST_ADD_NODE_N_NODE);
+  CU_ASSERT(ags_work_stealing_scheduler_test_flags(scheduler, AGS_WORK_STEALING_SCHEDULER_GRAPH_MODIFIED));
+
+  /* run without threads - caller only */
+  ags_work_stealing_scheduler_run(scheduler);
+
+  CU_ASSERT(counter == AGS_WORK_STEALING_SCHEDULER_TEST_ADD_NODE_N_NODE);
+
+  g_object_unref(scheduler);
+}
+
+void
+ags_work_stealing_scheduler_test_add_dependency()
+{
+  AgsWorkStealingScheduler *scheduler;
+
+  guint first, second, third;
+
+  volatile gint counter;
+  
+  scheduler = ags_work_stealing_scheduler_new(1);
+
+  counter = 0;
+
+  first = ags_work_stealing_scheduler_add_node(scheduler,
+					       ags_work_stealing_scheduler_test_stub_func, (gpointer) &counter);
+  second = ags_work_stealing_scheduler_add_node(scheduler,
+						ags_work_stealing_scheduler_test_stub_func, (gpointer) &counter);
+  third = ags_work_stealing_scheduler_add_node(scheduler,
+					       ags_work_stealing_scheduler_test_stub_func, (gpointer) &counter);
+
+  ags_work_stealing_scheduler_add_dependency(scheduler,
+					     third, first);
+  ags_work_stealing_scheduler_add_dependency(scheduler,
+					     third, second);
+
+  CU_ASSERT(scheduler->node[first].dependency_count == 0);
+  CU_ASSERT(scheduler->node[first].successor_count == 1);
+  CU_ASSERT(scheduler->node[first].successor[0] == third);
+
+  CU_ASSERT(scheduler->node[second].successor_count == 1);
+  CU_ASSERT(scheduler->node[second].successor[0] == third);
+
+  CU_ASSERT(scheduler->node[third].dependency_count == 2);
+  CU_ASSERT(scheduler->node[third].successor_count == 0);
+
+  g_object_unref(scheduler);
+}
+
+void
+ags_work_stealing_scheduler_test_clear_graph()
+{
+  AgsWorkStealingScheduler *scheduler;
+
+  guint first, second;
+
+  volatile gint counter;
+  
+  scheduler = ags_work_stealing_scheduler_new(1);
+
+  counter = 0;
+
+  first = ags_work_stealing_scheduler_add_node(scheduler,
+					       ags_work_stealing_scheduler_test_stub_func, (gpointer) &counter);
+  second = ags_work_stealing_scheduler_add_node(scheduler,
+						ags_work_stealing_scheduler_test_stub_func, (gpointer) &counter);
+
+  ags_work_stealing_scheduler_add_dependency(scheduler,
+					     second, first);
+
+  ags_work_stealing_scheduler_clear_graph(scheduler);
+
+  CU_ASSERT(ags_work_stealing_scheduler_get_node_count(scheduler) == 0);
+
+  /* nodes are reused from the start */
+  CU_ASSERT(ags_work_stealing_scheduler_add_node(scheduler,
+						 ags_work_stealing_scheduler_test_stub_func, (gpointer) &counter) == 0);
+  CU_ASSERT(scheduler->node[0].dependency_count == 0);
+  CU_ASSERT(scheduler->node[0].successor_count == 0);
+
+  g_object_unref(scheduler);
+}
+
+void
+ags_work_stealing_scheduler_test_run()
+{
+  AgsWorkStealingScheduler *scheduler;
+
+  struct AgsWorkStealingSchedulerTestOrder order[AGS_WORK_STEALING_SCHEDULER_TEST_RUN_N_CHAIN * AGS_WORK_STEALING_SCHEDULER_TEST_RUN_CHAIN_LENGTH];
+
+  guint node[AGS_WORK_STEALING_SCHEDULER_TEST_RUN_N_CHAIN * AGS_WORK_STEALING_SCHEDULER_TEST_RUN_CHAIN_LENGTH];
+  
+  guint i, j, k;
+  gboolean success;
+
+  volatile gint clock;
+
+  scheduler = ags_work_stealing_scheduler_new(AGS_WORK_STEALING_SCHEDULER_TEST_RUN_N_WORKER);
+
+  CU_ASSERT(ags_work_stealing_scheduler_get_worker_count(scheduler) == AGS_WORK_STEALING_SCHEDULER_TEST_RUN_N_WORKER);
+
+  clock = 0;
+  
+  /* independent chains */
+  for(i = 0; i < AGS_WORK_STEALING_SCHEDULER_TEST_RUN_N_CHAIN; i++){
+    for(j = 0; j < AGS_WORK_STEALING_SCHEDULER_TEST_RUN_CHAIN_LENGTH; j++){
+      k = i * AGS_WORK_STEALING_SCHEDULER_TEST_RUN_CHAIN_LENGTH + j;
+
+      order[k].clock = &clock;
+      order[k].stamp = 0;
+      order[k].dependency = ((j > 0) ? &(order[k - 1]): NULL);
+      order[k].violation = FALSE;
+      
+      node[k] = ags_work_stealing_scheduler_add_node(scheduler,
+						     ags_work_stealing_scheduler_test_order_func, &(order[k]));
+
+      if(j > 0){
+	ags_work_stealing_scheduler_add_dependency(scheduler,
+						   node[k], node[k - 1]);
+      }
+    }
+  }
+
+  ags_work_stealing_scheduler_start(scheduler);
+
+  CU_ASSERT(ags_work_stealing_scheduler_test_flags(scheduler, AGS_WORK_STEALING_SCHEDULER_RUNNING));
+
+  success = TRUE;
+  
+  for(i = 0; i < AGS_WORK_STEALING_SCHEDULER_TEST_RUN_N_CYCLE && success; i++){
+    for(k = 0; k < AGS_WORK_STEALING_SCHEDULER_TEST_RUN_N_CHAIN * AGS_WORK_STEALING_SCHEDULER_TEST_RUN_CHAIN_LENGTH; k++){
+      order[k].stamp = 0;
+    }
+    
+    ags_work_stealing_scheduler_run(scheduler);
+
+    for(k = 0; k < AGS_WORK_STEALING_SCHEDULER_TEST_RUN_N_CHAIN * AGS_WORK_STEALING_SCHEDULER_TEST_RUN_CHAIN_LENGTH; k++){
+      if(order[k].stamp == 0 ||
+	 order[k].violation ||
+	 (order[k].dependency != NULL &&
+	  order[k].dependency->stamp >= order[k].stamp)){
+	success = FALSE;
+
+	break;
+      }
+    }
+  }
+
+  CU_ASSERT(success);
+
+  ags_work_stealing_scheduler_stop(scheduler);
+
+  CU_ASSERT(!ags_work_stealing_scheduler_test_flags(scheduler, AGS_WORK_STEALING_SCHEDULER_RUNNING));
+  
+  g_object_unref(scheduler);
+}
+
+int
+main(int argc, char **argv)
+{
+  CU_pSuite pSuite = NULL;
+
+  /* initialize the CUnit test registry */
+  if(CUE_SUCCESS != CU_initialize_registry()){
+    return CU_get_error();
+  }
+
+  /* add a suite to the registry */
+  pSuite = CU_add_suite("AgsWorkStealingSchedulerTest", ags_work_stealing_scheduler_test_init_suite, ags_work_stealing_scheduler_test_clean_suite);
+
+  if(pSuite == NULL){
+    CU_cleanup_registry();
+
+    return CU_get_error();
+  }
+
+  /* add the tests to the suite */
+  if((CU_add_test(pSuite, "test of AgsWorkStealingScheduler add node", ags_work_stealing_scheduler_test_add_node) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsWorkStealingScheduler add dependency", ags_work_stealing_scheduler_test_add_dependency) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsWorkStealingScheduler clear graph", ags_work_stealing_scheduler_test_clear_graph) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsWorkStealingScheduler run", ags_work_stealing_scheduler_test_run) == NULL)){
+    CU_cleanup_registry();
+
+    return CU_get_error();
+  }
+
+  /* Run all tests using the CUnit Basic interface */
+  CU_basic_set_mode(CU_BRM_VERBOSE);
+  CU_basic_run_tests();
+
+  CU_cleanup_registry();
+
+  return(CU_get_error());
+}
@@ -31,11 +31,13 @@ G_BEGIN_DECLS
 #define ags_atomic_uint_get(ptr) ((guint) __atomic_load_n(((guint *) (ptr)), __ATOMIC_SEQ_CST))
 #define ags_atomic_int_get(ptr) ((gint) __atomic_load_n(((gint *) (ptr)), __ATOMIC_SEQ_CST))
 #define ags_atomic_pointer_get(ptr) ((gpointer) __atomic_load_n(((gpointer *) (ptr)), __ATOMIC_SEQ_CST))
+#define ags_atomic_int64_get(ptr) ((gint64) __atomic_load_n(((gint64 *) (ptr)), __ATOMIC_SEQ_CST))
 
 #define ags_atomic_boolean_set(ptr, bval) (__atomic_store_n((gboolean *) (ptr), (bval), __ATOMIC_SEQ_CST))
 #define ags_atomic_uint_set(ptr, uval) (__atomic_store_n((guint *) (ptr), (uval), __ATOMIC_SEQ_CST))
 #define ags_atomic_int_set(ptr, ival) (__atomic_store_n((gint *) (ptr), (ival), __ATOMIC_SEQ_CST))
 #define ags_atomic_pointer_set(ptr, pval) (__atomic_store_n((gpointer *) (ptr), (pval), __ATOMIC_SEQ_CST))
+#define ags_atomic_int64_set(ptr, ival) (__atomic_store_n((gint64 *) (ptr), (ival), __ATOMIC_SEQ_CST))
 
 #define ags_atomic_uint_or(ptr, uval) ((guint) __atomic_fetch_or((guint *) (ptr), (uval), __ATOMIC_RELEASE))
 #define ags_atomic_int_or(ptr, ival) ((gint) __atomic_fetch_or((gint *) (ptr), (ival), __ATOMIC_RELEASE))
@@ -51,10 +53,20 @@ G_BEGIN_DECLS
 
 #define ags_atomic_uint_add(ptr, uval) ((guint) __atomic_fetch_add((guint *) (ptr), (uval), __ATOMIC_RELEASE))
 #define ags_atomic_int_add(ptr, ival) ((gint) __atomic_fetch_add((gint *) (ptr), (ival), __ATOMIC_RELEASE))
+#define ags_atomic_int64_add(ptr, ival) ((gint64) __atomic_fetch_add((gint64 *) (ptr), (ival), __ATOMIC_RELEASE))
 
 #define ags_atomic_uint_sub(ptr, uval) ((guint) __atomic_fetch_sub((guint *) (ptr), (uval), __ATOMIC_RELEASE))
 #define ags_atomic_int_sub(ptr, ival) ((gint) __atomic_fetch_sub((gint *) (ptr), (ival), __ATOMIC_RELEASE))
 
+#define ags_atomic_pointer_exchange(ptr, pval) ((gpointer) __atomic_exchange_n((gpointer *) (ptr), (pval), __ATOMIC_SEQ_CST))
+#define ags_atomic_int64_exchange(ptr, ival) ((gint64) __atomic_exchange_n((gint64 *) (ptr), (ival), __ATOMIC_SEQ_CST))
+#define ags_atomic_pointer_compare_and_exchange(ptr, oldval, newval) ({ gpointer __ags_expected = (oldval); (gboolean) __atomic_compare_exchange_n((gpointer *) (ptr), &__ags_expected, (newval), FALSE, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST); })
+
+#define ags_atomic_int_compare_and_exchange(ptr, oldval, newval) ({ gint __ags_expected = (oldval); (gboolean) __atomic_compare_exchange_n((gint *) (ptr), &__ags_expected, (newval), FALSE, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST); })
+#define ags_atomic_int64_compare_and_exchange(ptr, oldval, newval) ({ gint64 __ags_expected = (oldval); (gboolean) __atomic_compare_exchange_n((gint64 *) (ptr), &__ags_expected, (newval), FALSE, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST); })
+
+#define ags_atomic_memory_barrier() (__atomic_thread_fence(__ATOMIC_SEQ_CST))
+
 G_END_DECLS
 
 #endif /*__AGS_ATOMIC_H__*/
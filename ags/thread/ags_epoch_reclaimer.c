@@ -0,0 +1,816 @@
+/* GSequencer - Advanced GTK Sequencer
+ * Copyright (C) 2005-2026 Joël Krähemann
+ *
+ * This file is part of GSequencer.
+ *
+ * GSequencer is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GSequencer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GSequencer.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <ags/thread/ags_epoch_reclaimer.h>
+
+#include <ags/lib/ags_time.h>
+
+#include <ags/thread/ags_trace.h>
+
+#include <stdlib.h>
+
+void ags_epoch_reclaimer_class_init(AgsEpochReclaimerClass *epoch_reclaimer);
+void ags_epoch_reclaimer_init(AgsEpochReclaimer *epoch_reclaimer);
+void ags_epoch_reclaimer_finalize(GObject *gobject);
+
+void ags_epoch_reclaimer_start(AgsThread *thread);
+void ags_epoch_reclaimer_stop(AgsThread *thread);
+
+void ags_epoch_reclaimer_do_poll(AgsWorkerThread *worker_thread);
+
+AgsEpochRecord* ags_epoch_record_alloc(AgsEpochReclaimer *epoch_reclaimer,
+				       guint retire_size);
+void ags_epoch_record_free(AgsEpochRecord *epoch_record);
+
+typedef struct{
+  guint reclaimer_id;
+  AgsEpochRecord *epoch_record;
+}AgsEpochRecordCache;
+
+void ags_epoch_record_cache_free(AgsEpochRecordCache *cache);
+
+/**
+ * SECTION:ags_epoch_reclaimer
+ * @short_description: epoch based deferred reclamation
+ * @title: AgsEpochReclaimer
+ * @section_id:
+ * @include: ags/thread/ags_epoch_reclaimer.h
+ *
+ * The #AgsEpochReclaimer defers destruction of pointers released by realtime
+ * threads until no thread can observe them anymore. Threads enclose the
+ * code reading shared pointers by ags_epoch_reclaimer_enter() and
+ * ags_epoch_reclaimer_leave(), ags_thread_loop() does so around
+ * ags_thread_run().
+ *
+ * ags_epoch_reclaimer_retire() appends to a preallocated per thread ring
+ * buffer without locking. The worker advances the global epoch as soon as
+ * every thread within a critical section has observed it and destroys the
+ * pointers retired 2 epochs earlier.
+ */
+
+static gpointer ags_epoch_reclaimer_parent_class = NULL;
+
+static volatile guint ags_epoch_reclaimer_count = 0;
+
+/* the reclaimer is identified by id, the cached record might be freed */
+static GPrivate ags_epoch_record_key = G_PRIVATE_INIT((GDestroyNotify) ags_epoch_record_cache_free);
+
+/* live reclaimers, so an exiting thread doesn't detach a freed record */
+static GMutex ags_epoch_reclaimer_registry_mutex;
+static GList *ags_epoch_reclaimer_registry = NULL;
+
+AgsEpochReclaimer *ags_epoch_reclaimer = NULL;
+
+GType
+ags_epoch_reclaimer_get_type()
+{
+  static gsize g_define_type_id__static = 0;
+
+  if(g_once_init_enter(&g_define_type_id__static)){
+    GType ags_type_epoch_reclaimer = 0;
+
+    static const GTypeInfo ags_epoch_reclaimer_info = {
+      sizeof (AgsEpochReclaimerClass),
+      NULL, /* base_init */
+      NULL, /* base_finalize */
+      (GClassInitFunc) ags_epoch_reclaimer_class_init,
+      NULL, /* class_finalize */
+      NULL, /* class_data */
+      sizeof (AgsEpochReclaimer),
+      0,    /* n_preallocs */
+      (GInstanceInitFunc) ags_epoch_reclaimer_init,
+    };
+
+    ags_type_epoch_reclaimer = g_type_register_static(AGS_TYPE_WORKER_THREAD,
+						      "AgsEpochReclaimer",
+						      &ags_epoch_reclaimer_info,
+						      0);    
+
+    g_once_init_leave(&g_define_type_id__static, ags_type_epoch_reclaimer);
+  }
+
+  return(g_define_type_id__static);
+}
+
+void
+ags_epoch_reclaimer_class_init(AgsEpochReclaimerClass *epoch_reclaimer)
+{
+  GObjectClass *gobject;
+  AgsThreadClass *thread;
+  AgsWorkerThreadClass *worker_thread;
+
+  ags_epoch_reclaimer_parent_class = g_type_class_peek_parent(epoch_reclaimer);
+
+  /* GObject */
+  gobject = (GObjectClass *) epoch_reclaimer;
+
+  gobject->finalize = ags_epoch_reclaimer_finalize;
+
+  /* AgsThread */
+  thread = (AgsThreadClass *) epoch_reclaimer;
+
+  thread->start = ags_epoch_reclaimer_start;
+  thread->run = NULL;
+  thread->stop = ags_epoch_reclaimer_stop;
+
+  /* AgsWorkerThread */
+  worker_thread = (AgsWorkerThreadClass *) epoch_reclaimer;
+
+  worker_thread->do_poll = ags_epoch_reclaimer_do_poll;
+}
+
+void
+ags_epoch_reclaimer_init(AgsEpochReclaimer *epoch_reclaimer)
+{
+  epoch_reclaimer->reclaimer_id = ags_atomic_uint_increment(&ags_epoch_reclaimer_count) + 1;
+
+  epoch_reclaimer->reclaim_interval = (struct timespec *) malloc(sizeof(struct timespec));
+
+  epoch_reclaimer->reclaim_interval->tv_sec = 0;
+  epoch_reclaimer->reclaim_interval->tv_nsec = AGS_EPOCH_RECLAIMER_DEFAULT_RECLAIM_INTERVAL;
+
+  g_mutex_init(&(epoch_reclaimer->reclaim_mutex));
+
+  /* epoch 0 is reserved for quiescent */
+  epoch_reclaimer->global_epoch = AGS_EPOCH_RECLAIMER_QUIESCENT + 1;
+
+  epoch_reclaimer->record = NULL;
+
+  epoch_reclaimer->retire_size = AGS_EPOCH_RECLAIMER_DEFAULT_RETIRE_SIZE;
+
+  /* stats */
+  epoch_reclaimer->retired_count = 0;
+  epoch_reclaimer->reclaimed_count = 0;
+  epoch_reclaimer->overflow_count = 0;
+
+  epoch_reclaimer->lag_sum = 0;
+  epoch_reclaimer->max_lag = 0;
+
+  /* register */
+  g_mutex_lock(&ags_epoch_reclaimer_registry_mutex);
+
+  ags_epoch_reclaimer_registry = g_list_prepend(ags_epoch_reclaimer_registry,
+						epoch_reclaimer);
+
+  g_mutex_unlock(&ags_epoch_reclaimer_registry_mutex);
+}
+
+void
+ags_epoch_reclaimer_finalize(GObject *gobject)
+{
+  AgsEpochReclaimer *epoch_reclaimer;
+
+  AgsEpochRecord *epoch_record, *next_record;
+
+  epoch_reclaimer = AGS_EPOCH_RECLAIMER(gobject);
+
+  /* unregister */
+  g_mutex_lock(&ags_epoch_reclaimer_registry_mutex);
+
+  ags_epoch_reclaimer_registry = g_list_remove(ags_epoch_reclaimer_registry,
+					       epoch_reclaimer);
+
+  g_mutex_unlock(&ags_epoch_reclaimer_registry_mutex);
+
+  /* destroy remaining, no thread refers to a finalized reclaimer */
+  ags_atomic_int64_add(&(epoch_reclaimer->global_epoch), 2);
+  
+  ags_epoch_reclaimer_reclaim(epoch_reclaimer);
+  
+  epoch_record = ags_atomic_pointer_get(&(epoch_reclaimer->record));
+
+  while(epoch_record != NULL){
+    next_record = epoch_record->next;
+
+    ags_epoch_record_free(epoch_record);
+
+    epoch_record = next_record;
+  }
+  
+  if(epoch_reclaimer->reclaim_interval != NULL){
+    free(epoch_reclaimer->reclaim_interval);
+  }
+
+  g_mutex_clear(&(epoch_reclaimer->reclaim_mutex));
+
+  ags_atomic_pointer_compare_and_exchange(&ags_epoch_reclaimer,
+					  epoch_reclaimer,
+					  NULL);
+  
+  /* call parent */
+  G_OBJECT_CLASS(ags_epoch_reclaimer_parent_class)->finalize(gobject);
+}
+
+void
+ags_epoch_reclaimer_start(AgsThread *thread)
+{
+  AgsWorkerThread *worker_thread;
+
+  worker_thread = AGS_WORKER_THREAD(thread);
+
+  ags_worker_thread_set_status_flags(worker_thread, AGS_WORKER_THREAD_STATUS_RUNNING);
+
+  worker_thread->worker_thread = g_thread_new("Advanced Gtk+ Sequencer - epoch reclaimer",
+					      ags_woker_thread_do_poll_loop,
+					      worker_thread);
+}
+
+void
+ags_epoch_reclaimer_stop(AgsThread *thread)
+{
+  AgsWorkerThread *worker_thread;
+
+  worker_thread = AGS_WORKER_THREAD(thread);
+
+  ags_worker_thread_unset_status_flags(worker_thread, AGS_WORKER_THREAD_STATUS_RUNNING);
+}
+
+void
+ags_epoch_reclaimer_do_poll(AgsWorkerThread *worker_thread)
+{
+  AgsEpochReclaimer *epoch_reclaimer;
+
+  epoch_reclaimer = AGS_EPOCH_RECLAIMER(worker_thread);
+
+  ags_epoch_reclaimer_reclaim(epoch_reclaimer);
+
+  if(AGS_TRACE_IS_ENABLED()){
+    ags_trace_counter("epoch-reclaimer", "pending",
+		      ags_atomic_int64_get(&(epoch_reclaimer->retired_count)) - ags_atomic_int64_get(&(epoch_reclaimer->reclaimed_count)));
+  }
+  
+  ags_time_nanosleep(epoch_reclaimer->reclaim_interval);
+}
+
+AgsEpochRecord*
+ags_epoch_record_alloc(AgsEpochReclaimer *epoch_reclaimer,
+		       guint retire_size)
+{
+  AgsEpochRecord *epoch_record;
+
+  guint size;
+
+  /* round up to power of 2 */
+  size = 1;
+
+  while(size < retire_size){
+    size <<= 1;
+  }
+  
+  epoch_record = (AgsEpochRecord *) g_malloc(sizeof(AgsEpochRecord));
+
+  epoch_record->reclaimer = epoch_reclaimer;
+
+  epoch_record->thread = g_thread_self();
+
+  epoch_record->local_epoch = AGS_EPOCH_RECLAIMER_QUIESCENT;
+  epoch_record->nesting = 0;
+
+  epoch_record->retire_size = size;
+  epoch_record->retire_mask = size - 1;
+
+  epoch_record->retire = (AgsEpochRetireEntry *) g_malloc0(size * sizeof(AgsEpochRetireEntry));
+
+  epoch_record->write_index = 0;
+  epoch_record->read_index = 0;
+
+  epoch_record->detached = FALSE;
+  
+  epoch_record->next = NULL;
+
+  return(epoch_record);
+}
+
+void
+ags_epoch_record_free(AgsEpochRecord *epoch_record)
+{
+  if(epoch_record == NULL){
+    return;
+  }
+
+  g_free(epoch_record->retire);
+
+  g_free(epoch_record);
+}
+
+void
+ags_epoch_record_cache_free(AgsEpochRecordCache *cache)
+{
+  GList *list;
+  
+  if(cache == NULL){
+    return;
+  }
+
+  /* the owning thread exits - detach the record of a live reclaimer */
+  g_mutex_lock(&ags_epoch_reclaimer_registry_mutex);
+
+  list = ags_epoch_reclaimer_registry;
+
+  while(list != NULL){
+    if(AGS_EPOCH_RECLAIMER(list->data)->reclaimer_id == cache->reclaimer_id){
+      ags_atomic_int64_set(&(cache->epoch_record->local_epoch),
+			   AGS_EPOCH_RECLAIMER_QUIESCENT);
+      
+      ags_atomic_boolean_set(&(cache->epoch_record->detached),
+			     TRUE);
+
+      break;
+    }
+    
+    list = list->next;
+  }
+  
+  g_mutex_unlock(&ags_epoch_reclaimer_registry_mutex);
+
+  g_free(cache);
+}
+
+/**
+ * ags_epoch_reclaimer_get_record:
+ * @epoch_reclaimer: the #AgsEpochReclaimer
+ *
+ * Get the #AgsEpochRecord-struct of the calling thread. The record is
+ * allocated and registered as called first by a thread, so realtime threads
+ * should call it once before entering their loop. It is released after the
+ * thread exited.
+ *
+ * Returns: (transfer none): the #AgsEpochRecord-struct
+ *
+ * Since: 9.1.0
+ */
+AgsEpochRecord*
+ags_epoch_reclaimer_get_record(AgsEpochReclaimer *epoch_reclaimer)
+{
+  AgsEpochRecord *epoch_record;
+
+  AgsEpochRecordCache *cache;
+  GThread *thread;
+
+  if(!AGS_IS_EPOCH_RECLAIMER(epoch_reclaimer)){
+    return(NULL);
+  }
+  
+  cache = (AgsEpochRecordCache *) g_private_get(&ags_epoch_record_key);
+
+  if(cache != NULL &&
+     cache->reclaimer_id == epoch_reclaimer->reclaimer_id){
+    return(cache->epoch_record);
+  }
+
+  if(cache == NULL){
+    cache = (AgsEpochRecordCache *) g_malloc(sizeof(AgsEpochRecordCache));
+
+    g_private_set(&ags_epoch_record_key,
+		  cache);
+  }
+  
+  /* the thread might have used a different reclaimer in between */
+  thread = g_thread_self();
+
+  g_mutex_lock(&(epoch_reclaimer->reclaim_mutex));
+
+  epoch_record = epoch_reclaimer->record;
+
+  while(epoch_record != NULL){
+    if(epoch_record->thread == thread &&
+       !ags_atomic_boolean_get(&(epoch_record->detached))){
+      break;
+    }
+    
+    epoch_record = epoch_record->next;
+  }
+
+  /* register */
+  if(epoch_record == NULL){
+    epoch_record = ags_epoch_record_alloc(epoch_reclaimer,
+					  epoch_reclaimer->retire_size);
+
+    epoch_record->next = epoch_reclaimer->record;
+
+    ags_atomic_pointer_set(&(epoch_reclaimer->record),
+			   epoch_record);
+  }
+
+  g_mutex_unlock(&(epoch_reclaimer->reclaim_mutex));
+
+  cache->reclaimer_id = epoch_reclaimer->reclaimer_id;
+  cache->epoch_record = epoch_record;
+
+  return(epoch_record);
+}
+
+/**
+ * ags_epoch_reclaimer_enter:
+ * @epoch_reclaimer: the #AgsEpochReclaimer
+ *
+ * Enter a critical section, pointers loaded until the matching
+ * ags_epoch_reclaimer_leave() are not destroyed even if retired
+ * meanwhile. Calls might be nested.
+ *
+ * Since: 9.1.0
+ */
+void
+ags_epoch_reclaimer_enter(AgsEpochReclaimer *epoch_reclaimer)
+{
+  AgsEpochRecord *epoch_record;
+
+  epoch_record = ags_epoch_reclaimer_get_record(epoch_reclaimer);
+
+  if(epoch_record == NULL){
+    return;
+  }
+
+  if(epoch_record->nesting == 0){
+    ags_atomic_int64_set(&(epoch_record->local_epoch),
+			 ags_atomic_int64_get(&(epoch_reclaimer->global_epoch)));
+
+    /* publish before loading any shared pointer */
+    ags_atomic_memory_barrier();
+  }
+
+  epoch_record->nesting += 1;
+}
+
+/**
+ * ags_epoch_reclaimer_leave:
+ * @epoch_reclaimer: the #AgsEpochReclaimer
+ *
+ * Leave the critical section entered by ags_epoch_reclaimer_enter().
+ *
+ * Since: 9.1.0
+ */
+void
+ags_epoch_reclaimer_leave(AgsEpochReclaimer *epoch_reclaimer)
+{
+  AgsEpochRecord *epoch_record;
+
+  epoch_record = ags_epoch_reclaimer_get_record(epoch_reclaimer);
+
+  if(epoch_record == NULL ||
+     epoch_record->nesting == 0){
+    return;
+  }
+
+  epoch_record->nesting -= 1;
+
+  if(epoch_record->nesting == 0){
+    ags_atomic_int64_set(&(epoch_record->local_epoch),
+			 AGS_EPOCH_RECLAIMER_QUIESCENT);
+  }
+}
+
+/**
+ * ags_epoch_reclaimer_retire:
+ * @epoch_reclaimer: the #AgsEpochReclaimer
+ * @ptr: the pointer to destroy
+ * @destroy_func: (scope call): the @ptr's destroy function
+ *
+ * Retire @ptr, it must be unreachable for threads entering a critical
+ * section afterwards. @destroy_func is invoked by the reclaimer as soon as
+ * no thread can observe @ptr anymore.
+ *
+ * Retiring is wait-free. If the calling thread's retire ring is full, @ptr
+ * is passed to #AgsDestroyWorker instead and counted as overflow.
+ *
+ * Returns: %TRUE if deferred by epoch, otherwise %FALSE
+ *
+ * Since: 9.1.0
+ */
+gboolean
+ags_epoch_reclaimer_retire(AgsEpochReclaimer *epoch_reclaimer,
+			   gpointer ptr, AgsDestroyFunc destroy_func)
+{
+  AgsEpochRecord *epoch_record;
+  AgsEpochRetireEntry *retire_entry;
+
+  guint write_index;
+
+  if(!AGS_IS_EPOCH_RECLAIMER(epoch_reclaimer) ||
+     ptr == NULL ||
+     destroy_func == NULL){
+    return(FALSE);
+  }
+
+  epoch_record = ags_epoch_reclaimer_get_record(epoch_reclaimer);
+
+  /* only the owning thread writes */
+  write_index = epoch_record->write_index;
+
+  if(write_index - ags_atomic_uint_get(&(epoch_record->read_index)) >= epoch_record->retire_size){
+    ags_atomic_int64_add(&(epoch_reclaimer->overflow_count), 1);
+
+    ags_destroy_worker_add(ags_destroy_worker_get_instance(),
+			   ptr, destroy_func);
+
+    return(FALSE);
+  }
+
+  retire_entry = &(epoch_record->retire[write_index & (epoch_record->retire_mask)]);
+
+  retire_entry->ptr = ptr;
+  retire_entry->destroy_func = destroy_func;
+
+  retire_entry->epoch = ags_atomic_int64_get(&(epoch_reclaimer->global_epoch));
+  retire_entry->retire_time = g_get_monotonic_time();
+
+  ags_atomic_uint_set(&(epoch_record->write_index),
+		      write_index + 1);
+
+  ags_atomic_int64_add(&(epoch_reclaimer->retired_count), 1);
+
+  return(TRUE);
+}
+
+/**
+ * ags_epoch_reclaimer_reclaim:
+ * @epoch_reclaimer: the #AgsEpochReclaimer
+ *
+ * Advance the global epoch if every thread within a critical section
+ * observed it, then destroy the pointers no thread can observe anymore.
+ * The drained records of exited threads are freed. Called periodically by
+ * the worker.
+ *
+ * Returns: the number of destroyed pointers
+ *
+ * Since: 9.1.0
+ */
+guint
+ags_epoch_reclaimer_reclaim(AgsEpochReclaimer *epoch_reclaimer)
+{
+  AgsEpochRecord *epoch_record, *prev_record, *next_record;
+  AgsEpochRetireEntry *retire_entry;
+
+  gint64 global_epoch;
+  gint64 local_epoch;
+  gint64 now, lag;
+  guint read_index, write_index;
+  guint count;
+  gboolean do_advance;
+
+  if(!AGS_IS_EPOCH_RECLAIMER(epoch_reclaimer)){
+    return(0);
+  }
+
+  /* destroy functions might retire, register before locking */
+  ags_epoch_reclaimer_get_record(epoch_reclaimer);
+  
+  g_mutex_lock(&(epoch_reclaimer->reclaim_mutex));
+
+  /* advance */
+  global_epoch = ags_atomic_int64_get(&(epoch_reclaimer->global_epoch));
+
+  do_advance = TRUE;
+  
+  epoch_record = ags_atomic_pointer_get(&(epoch_reclaimer->record));
+
+  while(epoch_record != NULL){
+    local_epoch = ags_atomic_int64_get(&(epoch_record->local_epoch));
+
+    if(local_epoch != AGS_EPOCH_RECLAIMER_QUIESCENT &&
+       local_epoch != global_epoch){
+      do_advance = FALSE;
+
+      break;
+    }
+    
+    epoch_record = epoch_record->next;
+  }
+
+  if(do_advance){
+    global_epoch += 1;
+
+    ags_atomic_int64_set(&(epoch_reclaimer->global_epoch),
+			 global_epoch);
+  }
+  
+  /* destroy retired 2 epochs ago, in order of retirement */
+  count = 0;
+
+  now = g_get_monotonic_time();
+  
+  epoch_record = ags_atomic_pointer_get(&(epoch_reclaimer->record));
+
+  while(epoch_record != NULL){
+    read_index = epoch_record->read_index;
+    write_index = ags_atomic_uint_get(&(epoch_record->write_index));
+
+    while(read_index != write_index){
+      retire_entry = &(epoch_record->retire[read_index & (epoch_record->retire_mask)]);
+
+      if(retire_entry->epoch + 2 > global_epoch){
+	break;
+      }
+
+      retire_entry->destroy_func(retire_entry->ptr);
+
+      /* lag */
+      lag = now - retire_entry->retire_time;
+      
+      ags_atomic_int64_add(&(epoch_reclaimer->lag_sum), lag);
+
+      if(lag > ags_atomic_int64_get(&(epoch_reclaimer->max_lag))){
+	ags_atomic_int64_set(&(epoch_reclaimer->max_lag), lag);
+      }
+
+      retire_entry->ptr = NULL;
+      retire_entry->destroy_func = NULL;
+      
+      read_index++;
+      count++;
+    }
+
+    ags_atomic_uint_set(&(epoch_record->read_index),
+			read_index);
+    
+    epoch_record = epoch_record->next;
+  }
+
+  ags_atomic_int64_add(&(epoch_reclaimer->reclaimed_count), count);
+
+  /* free drained records of exited threads, the list is modified only while locked */
+  prev_record = NULL;
+  epoch_record = epoch_reclaimer->record;
+
+  while(epoch_record != NULL){
+    next_record = epoch_record->next;
+    
+    if(ags_atomic_boolean_get(&(epoch_record->detached)) &&
+       epoch_record->read_index == ags_atomic_uint_get(&(epoch_record->write_index))){
+      if(prev_record != NULL){
+	prev_record->next = next_record;
+      }else{
+	ags_atomic_pointer_set(&(epoch_reclaimer->record),
+			       next_record);
+      }
+
+      ags_epoch_record_free(epoch_record);
+    }else{
+      prev_record = epoch_record;
+    }
+    
+    epoch_record = next_record;
+  }
+
+  g_mutex_unlock(&(epoch_reclaimer->reclaim_mutex));
+
+  return(count);
+}
+
+/**
+ * ags_epoch_reclaimer_get_global_epoch:
+ * @epoch_reclaimer: the #AgsEpochReclaimer
+ *
+ * Get the global epoch.
+ *
+ * Returns: the global epoch
+ *
+ * Since: 9.1.0
+ */
+gint64
+ags_epoch_reclaimer_get_global_epoch(AgsEpochReclaimer *epoch_reclaimer)
+{
+  if(!AGS_IS_EPOCH_RECLAIMER(epoch_reclaimer)){
+    return(AGS_EPOCH_RECLAIMER_QUIESCENT);
+  }
+
+  return(ags_atomic_int64_get(&(epoch_reclaimer->global_epoch)));
+}
+
+/**
+ * ags_epoch_reclaimer_get_stats:
+ * @epoch_reclaimer: the #AgsEpochReclaimer
+ * @retired_count: (out) (optional): return location of the number of retired pointers
+ * @reclaimed_count: (out) (optional): return location of the number of destroyed pointers
+ * @pending_count: (out) (optional): return location of the number of pointers waiting
+ * @overflow_count: (out) (optional): return location of the number of pointers passed to #AgsDestroyWorker
+ * @mean_lag: (out) (optional): return location of the mean time between retire and destroy in microseconds
+ * @max_lag: (out) (optional): return location of the maximum time between retire and destroy in microseconds
+ *
+ * Get the statistics of @epoch_reclaimer to monitor retire volume and
+ * reclaim lag.
+ *
+ * Since: 9.1.0
+ */
+void
+ags_epoch_reclaimer_get_stats(AgsEpochReclaimer *epoch_reclaimer,
+			      gint64 *retired_count,
+			      gint64 *reclaimed_count,
+			      gint64 *pending_count,
+			      gint64 *overflow_count,
+			      gdouble *mean_lag,
+			      gint64 *max_lag)
+{
+  gint64 current_retired_count, current_reclaimed_count;
+  
+  if(!AGS_IS_EPOCH_RECLAIMER(epoch_reclaimer)){
+    return;
+  }
+
+  current_retired_count = ags_atomic_int64_get(&(epoch_reclaimer->retired_count));
+  current_reclaimed_count = ags_atomic_int64_get(&(epoch_reclaimer->reclaimed_count));
+  
+  if(retired_count != NULL){
+    retired_count[0] = current_retired_count;
+  }
+
+  if(reclaimed_count != NULL){
+    reclaimed_count[0] = current_reclaimed_count;
+  }
+
+  if(pending_count != NULL){
+    pending_count[0] = current_retired_count - current_reclaimed_count;
+  }
+
+  if(overflow_count != NULL){
+    overflow_count[0] = ags_atomic_int64_get(&(epoch_reclaimer->overflow_count));
+  }
+
+  if(mean_lag != NULL){
+    mean_lag[0] = 0.0;
+
+    if(current_reclaimed_count > 0){
+      mean_lag[0] = (gdouble) ags_atomic_int64_get(&(epoch_reclaimer->lag_sum)) / (gdouble) current_reclaimed_count;
+    }
+  }
+
+  if(max_lag != NULL){
+    max_lag[0] = ags_atomic_int64_get(&(epoch_reclaimer->max_lag));
+  }
+}
+
+/**
+ * ags_epoch_reclaimer_get_instance:
+ * 
+ * Get your epoch reclaimer instance. The instance is published atomically,
+ * so realtime threads don't lock as the instance exists.
+ *
+ * Returns: (transfer none): the #AgsEpochReclaimer instance
+ *
+ * Since: 9.1.0
+ */
+AgsEpochReclaimer*
+ags_epoch_reclaimer_get_instance()
+{
+  AgsEpochReclaimer *epoch_reclaimer;
+  
+  static GMutex mutex;
+
+  epoch_reclaimer = ags_atomic_pointer_get(&ags_epoch_reclaimer);
+
+  if(epoch_reclaimer != NULL){
+    return(epoch_reclaimer);
+  }
+  
+  g_mutex_lock(&mutex);
+
+  epoch_reclaimer = ags_atomic_pointer_get(&ags_epoch_reclaimer);
+  
+  if(epoch_reclaimer == NULL){
+    epoch_reclaimer = ags_epoch_reclaimer_new();
+
+    ags_atomic_pointer_set(&ags_epoch_reclaimer,
+			   epoch_reclaimer);
+  }
+
+  g_mutex_unlock(&mutex);
+  
+  return(epoch_reclaimer);
+}
+
+/**
+ * ags_epoch_reclaimer_new:
+ *
+ * Create a new #AgsEpochReclaimer.
+ *
+ * Returns: the new #AgsEpochReclaimer
+ *
+ * Since: 9.1.0
+ */
+AgsEpochReclaimer*
+ags_epoch_reclaimer_new()
+{
+  AgsEpochReclaimer *epoch_reclaimer;
+  
+  epoch_reclaimer = (AgsEpochReclaimer *) g_object_new(AGS_TYPE_EPOCH_RECLAIMER,
+						       NULL);
+
+  return(epoch_reclaimer);
+}
@@ -0,0 +1,172 @@
+/* GSequencer - Advanced GTK Sequencer
+ * Copyright (C) 2005-2026 Joël Krähemann
+ *
+ * This file is part of GSequencer.
+ *
+ * GSequencer is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GSequencer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GSequencer.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef __AGS_EPOCH_RECLAIMER_H__
+#define __AGS_EPOCH_RECLAIMER_H__
+
+#include <glib.h>
+#include <glib-object.h>
+
+#include <time.h>
+
+#include <ags/thread/ags_atomic.h>
+#include <ags/thread/ags_worker_thread.h>
+#include <ags/thread/ags_destroy_worker.h>
+
+G_BEGIN_DECLS
+
+#define AGS_TYPE_EPOCH_RECLAIMER                (ags_epoch_reclaimer_get_type())
+#define AGS_EPOCH_RECLAIMER(obj)                (G_TYPE_CHECK_INSTANCE_CAST((obj), AGS_TYPE_EPOCH_RECLAIMER, AgsEpochReclaimer))
+#define AGS_EPOCH_RECLAIMER_CLASS(class)        (G_TYPE_CHECK_CLASS_CAST(class, AGS_TYPE_EPOCH_RECLAIMER, AgsEpochReclaimerClass))
+#define AGS_IS_EPOCH_RECLAIMER(obj)             (G_TYPE_CHECK_INSTANCE_TYPE ((obj), AGS_TYPE_EPOCH_RECLAIMER))
+#define AGS_IS_EPOCH_RECLAIMER_CLASS(class)     (G_TYPE_CHECK_CLASS_TYPE ((class), AGS_TYPE_EPOCH_RECLAIMER))
+#define AGS_EPOCH_RECLAIMER_GET_CLASS(obj)      (G_TYPE_INSTANCE_GET_CLASS(obj, AGS_TYPE_EPOCH_RECLAIMER, AgsEpochReclaimerClass))
+
+#define AGS_EPOCH_RECORD(ptr) ((AgsEpochRecord *)(ptr))
+#define AGS_EPOCH_RETIRE_ENTRY(ptr) ((AgsEpochRetireEntry *)(ptr))
+
+#define AGS_EPOCH_RECLAIMER_DEFAULT_RETIRE_SIZE (1024)
+#define AGS_EPOCH_RECLAIMER_DEFAULT_RECLAIM_INTERVAL (10000000)
+
+#define AGS_EPOCH_RECLAIMER_QUIESCENT (0)
+
+typedef struct _AgsEpochReclaimer AgsEpochReclaimer;
+typedef struct _AgsEpochReclaimerClass AgsEpochReclaimerClass;
+typedef struct _AgsEpochRecord AgsEpochRecord;
+typedef struct _AgsEpochRetireEntry AgsEpochRetireEntry;
+
+/**
+ * AgsEpochRetireEntry:
+ * @ptr: the pointer to destroy
+ * @destroy_func: the destroy function
+ * @epoch: the global epoch as retired
+ * @retire_time: the monotonic time as retired
+ *
+ * The #AgsEpochRetireEntry-struct is a pointer waiting for reclamation.
+ */
+struct _AgsEpochRetireEntry
+{
+  gpointer ptr;
+  AgsDestroyFunc destroy_func;
+
+  gint64 epoch;
+  gint64 retire_time;
+};
+
+/**
+ * AgsEpochRecord:
+ * @reclaimer: the #AgsEpochReclaimer
+ * @thread: the owning #GThread
+ * @local_epoch: the global epoch observed as entered or AGS_EPOCH_RECLAIMER_QUIESCENT
+ * @nesting: the critical section nesting, accessed by the owning thread only
+ * @retire_size: the retire ring's size, a power of 2
+ * @retire_mask: the retire ring's index mask
+ * @retire: the retire ring
+ * @write_index: the retire ring's write index, advanced by the owning thread
+ * @read_index: the retire ring's read index, advanced by the reclaimer
+ * @detached: %TRUE as the owning thread exited
+ * @next: the next record
+ *
+ * The #AgsEpochRecord-struct is the per thread state of #AgsEpochReclaimer.
+ * The owning thread is the only producer of its retire ring and the
+ * reclaimer the only consumer, so retiring neither locks nor allocates.
+ * The record is detached as the owning thread exits and freed by the
+ * reclaimer as soon as its retire ring is drained.
+ */
+struct _AgsEpochRecord
+{
+  AgsEpochReclaimer *reclaimer;
+
+  GThread *thread;
+
+  volatile gint64 local_epoch;
+  guint nesting;
+
+  guint retire_size;
+  guint retire_mask;
+
+  AgsEpochRetireEntry *retire;
+
+  volatile guint write_index;
+  volatile guint read_index;
+
+  volatile gboolean detached;
+  
+  AgsEpochRecord *next;
+};
+
+struct _AgsEpochReclaimer
+{
+  AgsWorkerThread worker_thread;
+
+  guint reclaimer_id;
+
+  struct timespec *reclaim_interval;
+
+  GMutex reclaim_mutex;
+
+  volatile gint64 global_epoch;
+
+  gpointer record;
+
+  guint retire_size;
+
+  volatile gint64 retired_count;
+  volatile gint64 reclaimed_count;
+  volatile gint64 overflow_count;
+
+  volatile gint64 lag_sum;
+  volatile gint64 max_lag;
+};
+
+struct _AgsEpochReclaimerClass
+{
+  AgsWorkerThreadClass worker_thread;
+};
+
+GType ags_epoch_reclaimer_get_type();
+
+AgsEpochRecord* ags_epoch_reclaimer_get_record(AgsEpochReclaimer *epoch_reclaimer);
+
+void ags_epoch_reclaimer_enter(AgsEpochReclaimer *epoch_reclaimer);
+void ags_epoch_reclaimer_leave(AgsEpochReclaimer *epoch_reclaimer);
+
+gboolean ags_epoch_reclaimer_retire(AgsEpochReclaimer *epoch_reclaimer,
+				    gpointer ptr, AgsDestroyFunc destroy_func);
+
+guint ags_epoch_reclaimer_reclaim(AgsEpochReclaimer *epoch_reclaimer);
+
+gint64 ags_epoch_reclaimer_get_global_epoch(AgsEpochReclaimer *epoch_reclaimer);
+
+void ags_epoch_reclaimer_get_stats(AgsEpochReclaimer *epoch_reclaimer,
+				   gint64 *retired_count,
+				   gint64 *reclaimed_count,
+				   gint64 *pending_count,
+				   gint64 *overflow_count,
+				   gdouble *mean_lag,
+				   gint64 *max_lag);
+
+AgsEpochReclaimer* ags_epoch_reclaimer_get_instance();
+
+AgsEpochReclaimer* ags_epoch_reclaimer_new();
+
+G_END_DECLS
+
+#endif /*__AGS_EPOCH_RECLAIMER_H__*/
@@ -0,0 +1,269 @@
+/* GSequencer - Advanced GTK Sequencer
+ * Copyright (C) 2005-2026 Joël Krähemann
+ *
+ * This file is part of GSequencer.
+ *
+ * GSequencer is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GSequencer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GSequencer.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <ags/thread/ags_ring_buffer.h>
+
+#include <string.h>
+
+/**
+ * SECTION:ags_ring_buffer
+ * @short_description: Wait-free single producer single consumer ring
+ * @title: AgsRingBuffer
+ * @section_id:
+ * @include: ags/thread/ags_ring_buffer.h
+ *
+ * The #AgsRingBuffer-struct hands fixed size periods from one producer
+ * thread to one consumer thread. The indices are free running and only
+ * the owning side advances its index, so neither side has to lock or wait.
+ *
+ * The producer fills the period returned by ags_ring_buffer_get_write_period()
+ * and publishes it by ags_ring_buffer_commit_write(). The consumer does the
+ * same by ags_ring_buffer_get_read_period() and ags_ring_buffer_commit_read().
+ */
+
+/**
+ * ags_ring_buffer_alloc:
+ * @period_count: the number of periods
+ * @period_size: the size of one period in bytes
+ *
+ * Allocate #AgsRingBuffer-struct with @period_count zeroed periods of
+ * @period_size bytes each. @period_count is rounded up to a power of 2,
+ * so the free running indices stay valid on overflow.
+ *
+ * Returns: (transfer full): the newly allocated #AgsRingBuffer-struct
+ *
+ * Since: 9.1.0
+ */
+AgsRingBuffer*
+ags_ring_buffer_alloc(guint period_count,
+		      gsize period_size)
+{
+  AgsRingBuffer *ring_buffer;
+
+  gsize size;
+  guint count;
+
+  /* power of 2 */
+  count = 1;
+
+  while(count < period_count){
+    count <<= 1;
+  }
+
+  period_count = count;
+
+  /* every period starts at a cache line */
+  period_size = AGS_RING_BUFFER_CACHE_LINE_SIZE * ((period_size + AGS_RING_BUFFER_CACHE_LINE_SIZE - 1) / AGS_RING_BUFFER_CACHE_LINE_SIZE);
+
+  if(period_size == 0){
+    period_size = AGS_RING_BUFFER_CACHE_LINE_SIZE;
+  }
+  
+  ring_buffer = (AgsRingBuffer *) g_malloc(sizeof(AgsRingBuffer));
+
+  ring_buffer->period_count = period_count;
+  ring_buffer->period_mask = period_count - 1;
+  ring_buffer->period_size = period_size;
+
+  size = period_count * period_size;
+
+  ring_buffer->allocated_data = g_malloc0(size + AGS_RING_BUFFER_CACHE_LINE_SIZE);
+  ring_buffer->data = (guint8 *) ((((guintptr) ring_buffer->allocated_data) + AGS_RING_BUFFER_CACHE_LINE_SIZE - 1) & ~((guintptr) AGS_RING_BUFFER_CACHE_LINE_SIZE - 1));
+
+  ring_buffer->write_index = 0;
+  ring_buffer->read_index = 0;
+
+  return(ring_buffer);
+}
+
+/**
+ * ags_ring_buffer_free:
+ * @ring_buffer: the #AgsRingBuffer-struct
+ *
+ * Free @ring_buffer.
+ *
+ * Since: 9.1.0
+ */
+void
+ags_ring_buffer_free(AgsRingBuffer *ring_buffer)
+{
+  if(ring_buffer == NULL){
+    return;
+  }
+
+  g_free(ring_buffer->allocated_data);
+
+  g_free(ring_buffer);
+}
+
+/**
+ * ags_ring_buffer_reset:
+ * @ring_buffer: the #AgsRingBuffer-struct
+ *
+ * Drop all periods of @ring_buffer and clear its memory. Neither producer
+ * nor consumer may access @ring_buffer concurrently.
+ *
+ * Since: 9.1.0
+ */
+void
+ags_ring_buffer_reset(AgsRingBuffer *ring_buffer)
+{
+  if(ring_buffer == NULL){
+    return;
+  }
+
+  memset(ring_buffer->data, 0, ring_buffer->period_count * ring_buffer->period_size);
+
+  ags_atomic_uint_set(&(ring_buffer->read_index),
+		      0);
+  ags_atomic_uint_set(&(ring_buffer->write_index),
+		      0);
+}
+
+/**
+ * ags_ring_buffer_get_readable:
+ * @ring_buffer: the #AgsRingBuffer-struct
+ *
+ * Get the number of periods committed by the producer but not yet read.
+ *
+ * Returns: the readable period count
+ *
+ * Since: 9.1.0
+ */
+guint
+ags_ring_buffer_get_readable(AgsRingBuffer *ring_buffer)
+{
+  if(ring_buffer == NULL){
+    return(0);
+  }
+
+  return(ags_atomic_uint_get(&(ring_buffer->write_index)) - ags_atomic_uint_get(&(ring_buffer->read_index)));
+}
+
+/**
+ * ags_ring_buffer_get_writable:
+ * @ring_buffer: the #AgsRingBuffer-struct
+ *
+ * Get the number of periods the producer might write without overrun.
+ *
+ * Returns: the writable period count
+ *
+ * Since: 9.1.0
+ */
+guint
+ags_ring_buffer_get_writable(AgsRingBuffer *ring_buffer)
+{
+  if(ring_buffer == NULL){
+    return(0);
+  }
+
+  return(ring_buffer->period_count - ags_ring_buffer_get_readable(ring_buffer));
+}
+
+/**
+ * ags_ring_buffer_get_write_period:
+ * @ring_buffer: the #AgsRingBuffer-struct
+ *
+ * Get the next period to fill, call by the producer only.
+ *
+ * Returns: the period or %NULL if @ring_buffer is full
+ *
+ * Since: 9.1.0
+ */
+gpointer
+ags_ring_buffer_get_write_period(AgsRingBuffer *ring_buffer)
+{
+  guint write_index;
+
+  if(ring_buffer == NULL){
+    return(NULL);
+  }
+
+  write_index = ring_buffer->write_index;
+
+  if(write_index - ags_atomic_uint_get(&(ring_buffer->read_index)) >= ring_buffer->period_count){
+    return(NULL);
+  }
+
+  return(ring_buffer->data + (write_index & ring_buffer->period_mask) * ring_buffer->period_size);
+}
+
+/**
+ * ags_ring_buffer_commit_write:
+ * @ring_buffer: the #AgsRingBuffer-struct
+ *
+ * Publish the period returned by ags_ring_buffer_get_write_period() to the consumer.
+ *
+ * Since: 9.1.0
+ */
+void
+ags_ring_buffer_commit_write(AgsRingBuffer *ring_buffer)
+{
+  if(ring_buffer == NULL){
+    return;
+  }
+
+  ags_atomic_uint_increment(&(ring_buffer->write_index));
+}
+
+/**
+ * ags_ring_buffer_get_read_period:
+ * @ring_buffer: the #AgsRingBuffer-struct
+ *
+ * Get the next period to consume, call by the consumer only.
+ *
+ * Returns: the period or %NULL if @ring_buffer is empty
+ *
+ * Since: 9.1.0
+ */
+gpointer
+ags_ring_buffer_get_read_period(AgsRingBuffer *ring_buffer)
+{
+  guint read_index;
+
+  if(ring_buffer == NULL){
+    return(NULL);
+  }
+
+  read_index = ring_buffer->read_index;
+
+  if(ags_atomic_uint_get(&(ring_buffer->write_index)) == read_index){
+    return(NULL);
+  }
+
+  return(ring_buffer->data + (read_index & ring_buffer->period_mask) * ring_buffer->period_size);
+}
+
+/**
+ * ags_ring_buffer_commit_read:
+ * @ring_buffer: the #AgsRingBuffer-struct
+ *
+ * Release the period returned by ags_ring_buffer_get_read_period() to the producer.
+ *
+ * Since: 9.1.0
+ */
+void
+ags_ring_buffer_commit_read(AgsRingBuffer *ring_buffer)
+{
+  if(ring_buffer == NULL){
+    return;
+  }
+
+  ags_atomic_uint_increment(&(ring_buffer->read_index));
+}
@@ -0,0 +1,80 @@
+/* GSequencer - Advanced GTK Sequencer
+ * Copyright (C) 2005-2026 Joël Krähemann
+ *
+ * This file is part of GSequencer.
+ *
+ * GSequencer is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GSequencer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GSequencer.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __AGS_RING_BUFFER_H__
+#define __AGS_RING_BUFFER_H__
+
+#include <glib.h>
+#include <glib-object.h>
+
+#include <ags/thread/ags_atomic.h>
+
+G_BEGIN_DECLS
+
+#define AGS_RING_BUFFER(ptr) ((AgsRingBuffer *)(ptr))
+
+#define AGS_RING_BUFFER_CACHE_LINE_SIZE (64)
+
+typedef struct _AgsRingBuffer AgsRingBuffer;
+
+/**
+ * AgsRingBuffer:
+ * @period_count: the number of periods, a power of 2
+ * @period_mask: @period_count minus 1
+ * @period_size: the size of one period in bytes
+ * @data: the cache aligned period memory
+ * @allocated_data: the allocated memory containing @data
+ * @write_index: the free running write index, modified by the producer only
+ * @read_index: the free running read index, modified by the consumer only
+ *
+ * The #AgsRingBuffer-struct is a single producer single consumer ring of
+ * fixed size periods. Neither side locks nor allocates, so it is safe to use
+ * from a realtime callback.
+ */
+struct _AgsRingBuffer
+{
+  guint period_count;
+  guint period_mask;
+  gsize period_size;
+
+  guint8 *data;
+  gpointer allocated_data;
+
+  volatile guint write_index;
+  volatile guint read_index;
+};
+
+AgsRingBuffer* ags_ring_buffer_alloc(guint period_count,
+				     gsize period_size);
+void ags_ring_buffer_free(AgsRingBuffer *ring_buffer);
+
+void ags_ring_buffer_reset(AgsRingBuffer *ring_buffer);
+
+guint ags_ring_buffer_get_readable(AgsRingBuffer *ring_buffer);
+guint ags_ring_buffer_get_writable(AgsRingBuffer *ring_buffer);
+
+gpointer ags_ring_buffer_get_write_period(AgsRingBuffer *ring_buffer);
+void ags_ring_buffer_commit_write(AgsRingBuffer *ring_buffer);
+
+gpointer ags_ring_buffer_get_read_period(AgsRingBuffer *ring_buffer);
+void ags_ring_buffer_commit_read(AgsRingBuffer *ring_buffer);
+
+G_END_DECLS
+
+#endif /*__AGS_RING_BUFFER_H__*/
@@ -18,6 +18,7 @@
  */
 
 #include <ags/thread/ags_task.h>
+#include <ags/thread/ags_task_private.h>
 
 #include <ags/thread/ags_task_launcher.h>
 
@@ -68,6 +69,8 @@ enum{
 static gpointer ags_task_parent_class = NULL;
 static guint task_signals[LAST_SIGNAL];
 
+static gint ags_task_private_offset = 0;
+
 GType
 ags_task_get_type()
 {
@@ -93,6 +96,10 @@ ags_task_get_type()
 					   &ags_task_info,
 					   0);
 
+    /* the queue state is kept out of the public instance struct */
+    ags_task_private_offset = g_type_add_instance_private(ags_type_task,
+							  sizeof(AgsTaskPrivate));
+
     g_once_init_leave(&g_define_type_id__static, ags_type_task);
   }
 
@@ -127,6 +134,9 @@ ags_task_class_init(AgsTaskClass *task)
 
   ags_task_parent_class = g_type_class_peek_parent(task);
 
+  g_type_class_adjust_private_offset(task,
+				     &ags_task_private_offset);
+
   /* GObjectClass */
   gobject = (GObjectClass *) task;
 
@@ -198,6 +208,8 @@ ags_task_class_init(AgsTaskClass *task)
 void
 ags_task_init(AgsTask *task)
 {
+  AgsTaskPrivate *task_private;
+  
   int err;
   
   task->flags = 0;
@@ -208,6 +220,19 @@ ags_task_init(AgsTask *task)
   task->task_name = NULL;
 
   task->task_launcher = NULL;
+
+  /* queue */
+  task_private = AGS_TASK_GET_PRIVATE(task);
+
+  task_private->task = task;
+  
+  task_private->queue_node.next = NULL;
+  task_private->is_queued = FALSE;
+  task_private->queue_time = 0;
+
+  task_private->coalesce_object = NULL;
+  task_private->coalesce_property = NULL;
+  task_private->coalesce_detail = 0;
 }
 
 void
@@ -424,6 +449,114 @@ ags_task_unset_flags(AgsTask *task,
   g_rec_mutex_unlock(task_mutex);
 }
 
+/**
+ * ags_task_set_coalesce_key:
+ * @task: the #AgsTask
+ * @coalesce_object: (nullable): the object modified by @task, only used as key
+ * @coalesce_property: (nullable): the property modified by @task
+ *
+ * Set the coalesce key of @task. As queued tasks of #AgsTaskLauncher share
+ * the same type, object, property and coalesce detail, only the last one
+ * added is launched. Pass %NULL to launch @task regardless.
+ *
+ * Since: 9.1.0
+ */
+void
+ags_task_set_coalesce_key(AgsTask *task,
+			  gpointer coalesce_object,
+			  gchar *coalesce_property)
+{
+  AgsTaskPrivate *task_private;
+  
+  GRecMutex *task_mutex;
+
+  if(!AGS_IS_TASK(task)){
+    return;
+  }
+
+  task_private = AGS_TASK_GET_PRIVATE(task);
+  
+  /* get task mutex */
+  task_mutex = AGS_TASK_GET_OBJ_MUTEX(task);
+
+  g_rec_mutex_lock(task_mutex);
+
+  task_private->coalesce_object = coalesce_object;
+  task_private->coalesce_property = (coalesce_property != NULL) ? g_intern_string(coalesce_property): NULL;
+
+  g_rec_mutex_unlock(task_mutex);
+}
+
+/**
+ * ags_task_set_coalesce_detail:
+ * @task: the #AgsTask
+ * @coalesce_detail: the detail
+ *
+ * Set the coalesce detail of @task. It distinguishes tasks of the same type
+ * sharing the coalesce key, e.g. by sound scope or audio channel.
+ *
+ * Since: 9.1.0
+ */
+void
+ags_task_set_coalesce_detail(AgsTask *task,
+			     guint coalesce_detail)
+{
+  AgsTaskPrivate *task_private;
+  
+  GRecMutex *task_mutex;
+
+  if(!AGS_IS_TASK(task)){
+    return;
+  }
+
+  task_private = AGS_TASK_GET_PRIVATE(task);
+  
+  /* get task mutex */
+  task_mutex = AGS_TASK_GET_OBJ_MUTEX(task);
+
+  g_rec_mutex_lock(task_mutex);
+
+  task_private->coalesce_detail = coalesce_detail;
+
+  g_rec_mutex_unlock(task_mutex);
+}
+
+/**
+ * ags_task_is_queued:
+ * @task: the #AgsTask
+ *
+ * Check if @task is queued by an #AgsTaskLauncher and not yet launched.
+ *
+ * Returns: %TRUE if queued, otherwise %FALSE
+ *
+ * Since: 9.1.0
+ */
+gboolean
+ags_task_is_queued(AgsTask *task)
+{
+  if(!AGS_IS_TASK(task)){
+    return(FALSE);
+  }
+
+  return((ags_atomic_int_get(&(AGS_TASK_GET_PRIVATE(task)->is_queued))) ? TRUE: FALSE);
+}
+
+AgsTaskPrivate*
+ags_task_get_instance_private(AgsTask *task)
+{
+  return((AgsTaskPrivate *) G_STRUCT_MEMBER_P(task, ags_task_private_offset));
+}
+
+AgsTask*
+ags_task_queue_node_get_task(AgsTaskQueueNode *queue_node)
+{
+  AgsTaskPrivate *task_private;
+
+  task_private = (AgsTaskPrivate *) ((guint8 *) queue_node - G_STRUCT_OFFSET(AgsTaskPrivate, queue_node));
+
+  return(task_private->task);
+}
+
 /**
  * ags_task_launch:
  * @task: an #AgsTask
@@ -37,6 +37,7 @@ G_BEGIN_DECLS
 
 typedef struct _AgsTask AgsTask;
 typedef struct _AgsTaskClass AgsTaskClass;
+typedef struct _AgsTaskQueueNode AgsTaskQueueNode;
 
 /**
  * AgsTaskFlags:
@@ -51,6 +52,17 @@ typedef enum{
   AGS_TASK_CYCLIC   = 1 <<  1,
 }AgsTaskFlags;
 
+/**
+ * AgsTaskQueueNode:
+ * @next: the next node
+ *
+ * The intrusive node of the #AgsTaskLauncher queue.
+ */
+struct _AgsTaskQueueNode
+{
+  AgsTaskQueueNode *next;
+};
+
 struct _AgsTask
 {
   GObject gobject;
@@ -82,6 +94,14 @@ void ags_task_set_flags(AgsTask *task,
 void ags_task_unset_flags(AgsTask *task,
 			  AgsTaskFlags flags);
 
+void ags_task_set_coalesce_key(AgsTask *task,
+			       gpointer coalesce_object,
+			       gchar *coalesce_property);
+void ags_task_set_coalesce_detail(AgsTask *task,
+				  guint coalesce_detail);
+
+gboolean ags_task_is_queued(AgsTask *task);
+
 void ags_task_launch(AgsTask *task);
 void ags_task_failure(AgsTask *task, GError *error);
 
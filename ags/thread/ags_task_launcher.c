@@ -18,9 +18,12 @@
  */
 
 #include <ags/thread/ags_task_launcher.h>
+#include <ags/thread/ags_task_private.h>
 
 #include <ags/object/ags_connectable.h>
 
+#include <ags/thread/ags_trace.h>
+
 #include <ags/i18n.h>
 
 void ags_task_launcher_class_init(AgsTaskLauncherClass *task_launcher);
@@ -50,6 +53,17 @@ gboolean ags_task_launcher_is_connected(AgsConnectable *connectable);
 void ags_task_launcher_connect(AgsConnectable *connectable);
 void ags_task_launcher_disconnect(AgsConnectable *connectable);
 
+void ags_task_launcher_queue_push(AgsTaskLauncher *task_launcher,
+				  AgsTaskQueueNode *node);
+AgsTaskQueueNode* ags_task_launcher_queue_pop(AgsTaskLauncher *task_launcher);
+
+guint ags_task_launcher_coalesce_hash(gconstpointer key);
+gboolean ags_task_launcher_coalesce_equal(gconstpointer a,
+					  gconstpointer b);
+
+void ags_task_launcher_drain_queue(AgsTaskLauncher *task_launcher);
+void ags_task_launcher_clear_pending(AgsTaskLauncher *task_launcher);
+
 void ags_task_launcher_real_run(AgsTaskLauncher *task_launcher);
 
 gboolean ags_task_launcher_source_func(AgsTaskLauncher *task_launcher);
@@ -70,6 +84,14 @@ gboolean ags_task_launcher_source_func(AgsTaskLauncher *task_launcher);
  * implementation.
  *
  * There are some threads providing injection via dedicated #AgsTaskLauncher.
+ *
+ * One shot tasks are pushed to an intrusive lock-free multi-producer
+ * single-consumer queue, so adding a task never blocks on the launcher's
+ * mutex. AgsTaskLauncher::run() drains the queue in FIFO order, drops
+ * queued tasks superseded by a later task with the same coalesce key,
+ * see ags_task_set_coalesce_key(), and launches at most
+ * #AgsTaskLauncher:max-task-count tasks. The remaining tasks are kept
+ * for the next run.
  */
 
 enum{
@@ -81,6 +103,7 @@ enum{
   PROP_0,
   PROP_TASK,
   PROP_CYCLIC_TASK,
+  PROP_MAX_TASK_COUNT,
 };
 
 static gpointer ags_task_launcher_parent_class = NULL;
@@ -176,6 +199,24 @@ ags_task_launcher_class_init(AgsTaskLauncherClass *task_launcher)
 				  PROP_CYCLIC_TASK,
 				  param_spec);
 
+  /**
+   * AgsTaskLauncher:max-task-count:
+   *
+   * The maximum count of one shot tasks launched per run, 0 means unlimited.
+   * 
+   * Since: 9.1.0
+   */
+  param_spec = g_param_spec_uint("max-task-count",
+				 i18n_pspec("maximum task count"),
+				 i18n_pspec("The maximum task count launched per run"),
+				 0,
+				 G_MAXUINT,
+				 AGS_TASK_LAUNCHER_DEFAULT_MAX_TASK_COUNT,
+				 G_PARAM_READABLE | G_PARAM_WRITABLE);
+  g_object_class_install_property(gobject,
+				  PROP_MAX_TASK_COUNT,
+				  param_spec);
+
   /* AgsTaskLauncher */
   task_launcher->run = ags_task_launcher_real_run;
 
@@ -236,6 +277,38 @@ ags_task_launcher_init(AgsTaskLauncher *task_launcher)
   task_launcher->main_context = NULL;
 
   task_launcher->task = NULL;
+  
+  /* queue */
+  task_launcher->queue_stub.next = NULL;
+
+  task_launcher->queue_head = &(task_launcher->queue_stub);
+  task_launcher->queue_tail = &(task_launcher->queue_stub);
+
+  task_launcher->pending_task = g_ptr_array_new();
+  task_launcher->coalesce_task = g_hash_table_new(ags_task_launcher_coalesce_hash,
+						  ags_task_launcher_coalesce_equal);
+
+  task_launcher->max_task_count = AGS_TASK_LAUNCHER_DEFAULT_MAX_TASK_COUNT;
+
+  /* preallocated batch */
+  task_launcher->batch = (AgsTask **) g_new0(AgsTask *,
+					     AGS_TASK_LAUNCHER_DEFAULT_MAX_TASK_COUNT);
+  task_launcher->batch_size = AGS_TASK_LAUNCHER_DEFAULT_MAX_TASK_COUNT;
+
+  ags_atomic_int_set(&(task_launcher->batch_in_use),
+		     FALSE);
+  
+  /* statistics */
+  ags_atomic_int_set(&(task_launcher->queue_depth),
+		     0);
+  task_launcher->max_queue_depth = 0;
+
+  task_launcher->executed_count = 0;
+  task_launcher->coalesced_count = 0;
+
+  task_launcher->latency_sum = 0;
+  task_launcher->latency_max = 0;
+  
   task_launcher->cyclic_task = NULL;
 
   /* wait */
@@ -284,6 +357,28 @@ ags_task_launcher_set_property(GObject *gobject,
 				      cyclic_task);
   }
   break;
+  case PROP_MAX_TASK_COUNT:
+  {
+    guint max_task_count;
+
+    max_task_count = g_value_get_uint(value);
+
+    g_rec_mutex_lock(task_launcher_mutex);
+
+    task_launcher->max_task_count = max_task_count;
+
+    /* grow the batch unless a run uses it, unlimited grows as needed */
+    if(max_task_count > task_launcher->batch_size &&
+       ags_atomic_int_get(&(task_launcher->batch_in_use)) == FALSE){
+      task_launcher->batch = (AgsTask **) g_renew(AgsTask *,
+						  task_launcher->batch,
+						  max_task_count);
+      task_launcher->batch_size = max_task_count;
+    }
+
+    g_rec_mutex_unlock(task_launcher_mutex);
+  }
+  break;
   default:
     G_OBJECT_WARN_INVALID_PROPERTY_ID(gobject, prop_id, param_spec);
     break;
@@ -308,11 +403,24 @@ ags_task_launcher_get_property(GObject *gobject,
   switch(prop_id){
   case PROP_TASK:
   {
+    GList *start_task;
+
+    guint i;
+    
     g_rec_mutex_lock(task_launcher_mutex);
 
-    g_value_set_pointer(value, g_list_copy_deep(task_launcher->task,
-						(GCopyFunc) g_object_ref,
-						NULL));
+    ags_task_launcher_drain_queue(task_launcher);
+
+    start_task = NULL;
+    
+    for(i = 0; i < task_launcher->pending_task->len; i++){
+      if(g_ptr_array_index(task_launcher->pending_task, i) != NULL){
+	start_task = g_list_prepend(start_task,
+				    g_object_ref(g_ptr_array_index(task_launcher->pending_task, i)));
+      }
+    }
+    
+    g_value_set_pointer(value, g_list_reverse(start_task));
 
     g_rec_mutex_unlock(task_launcher_mutex);
   }
@@ -328,6 +436,15 @@ ags_task_launcher_get_property(GObject *gobject,
     g_rec_mutex_unlock(task_launcher_mutex);
   }
   break;
+  case PROP_MAX_TASK_COUNT:
+  {
+    g_rec_mutex_lock(task_launcher_mutex);
+
+    g_value_set_uint(value, task_launcher->max_task_count);
+
+    g_rec_mutex_unlock(task_launcher_mutex);
+  }
+  break;
   default:
     G_OBJECT_WARN_INVALID_PROPERTY_ID(gobject, prop_id, param_spec);
     break;
@@ -347,12 +464,7 @@ ags_task_launcher_dispose(GObject *gobject)
     task_launcher->main_context = NULL;
   }
   
-  if(task_launcher->task != NULL){
-    g_list_free_full(task_launcher->task,
-		     (GDestroyNotify) g_object_unref);
-    
-    task_launcher->task = NULL;
-  }
+  ags_task_launcher_clear_pending(task_launcher);
   
   if(task_launcher->cyclic_task != NULL){
     g_list_free_full(task_launcher->cyclic_task,
@@ -379,10 +491,13 @@ ags_task_launcher_finalize(GObject *gobject)
     g_main_context_unref(task_launcher->main_context);
   }
 
-  g_list_free_full(task_launcher->task,
-		   g_object_unref);
+  ags_task_launcher_clear_pending(task_launcher);
 
-  task_launcher->task = NULL;
+  g_ptr_array_free(task_launcher->pending_task,
+		   TRUE);
+  g_hash_table_destroy(task_launcher->coalesce_task);
+
+  g_free(task_launcher->batch);
   
   g_list_free_full(task_launcher->cyclic_task,
 		   g_object_unref);
@@ -625,12 +740,188 @@ ags_task_launcher_attach(AgsTaskLauncher *task_launcher,
   g_rec_mutex_unlock(task_launcher_mutex);  
 }
 
+void
+ags_task_launcher_queue_push(AgsTaskLauncher *task_launcher,
+			     AgsTaskQueueNode *node)
+{
+  AgsTaskQueueNode *prev;
+
+  ags_atomic_pointer_set(&(node->next),
+			 NULL);
+  
+  prev = (AgsTaskQueueNode *) ags_atomic_pointer_exchange(&(task_launcher->queue_head),
+							  node);
+
+  /* the consumer waits for this link */
+  ags_atomic_pointer_set(&(prev->next),
+			 node);
+}
+
+AgsTaskQueueNode*
+ags_task_launcher_queue_pop(AgsTaskLauncher *task_launcher)
+{
+  AgsTaskQueueNode *tail, *next, *head;
+
+  tail = task_launcher->queue_tail;
+  next = (AgsTaskQueueNode *) ags_atomic_pointer_get(&(tail->next));
+
+  /* skip stub */
+  if(tail == &(task_launcher->queue_stub)){
+    if(next == NULL){
+      return(NULL);
+    }
+
+    task_launcher->queue_tail = next;
+
+    tail = next;
+    next = (AgsTaskQueueNode *) ags_atomic_pointer_get(&(tail->next));
+  }
+
+  if(next != NULL){
+    task_launcher->queue_tail = next;
+
+    return(tail);
+  }
+
+  /* a producer is about to link its node - retry next run */
+  head = (AgsTaskQueueNode *) ags_atomic_pointer_get(&(task_launcher->queue_head));
+  
+  if(tail != head){
+    return(NULL);
+  }
+
+  /* re-insert stub to pop last node */
+  ags_task_launcher_queue_push(task_launcher,
+			       &(task_launcher->queue_stub));
+
+  next = (AgsTaskQueueNode *) ags_atomic_pointer_get(&(tail->next));
+
+  if(next != NULL){
+    task_launcher->queue_tail = next;
+
+    return(tail);
+  }
+
+  return(NULL);
+}
+
+guint
+ags_task_launcher_coalesce_hash(gconstpointer key)
+{
+  AgsTaskPrivate *task_private;
+
+  task_private = AGS_TASK_GET_PRIVATE(key);
+
+  return(g_direct_hash(task_private->coalesce_object) ^ g_direct_hash(task_private->coalesce_property) ^ task_private->coalesce_detail);
+}
+
+gboolean
+ags_task_launcher_coalesce_equal(gconstpointer a,
+				 gconstpointer b)
+{
+  AgsTaskPrivate *task_private_a, *task_private_b;
+
+  task_private_a = AGS_TASK_GET_PRIVATE(a);
+  task_private_b = AGS_TASK_GET_PRIVATE(b);
+
+  /* property names are interned */
+  return(G_OBJECT_TYPE(a) == G_OBJECT_TYPE(b) &&
+	 task_private_a->coalesce_object == task_private_b->coalesce_object &&
+	 task_private_a->coalesce_property == task_private_b->coalesce_property &&
+	 task_private_a->coalesce_detail == task_private_b->coalesce_detail);
+}
+
+void
+ags_task_launcher_drain_queue(AgsTaskLauncher *task_launcher)
+{
+  AgsTask *task, *prev_task;
+  AgsTaskPrivate *task_private;
+  AgsTaskQueueNode *node;
+
+  gpointer index;
+  guint queue_depth;
+
+  /* called with the task launcher mutex held, it serializes the consumer */
+  queue_depth = (guint) ags_atomic_int_get(&(task_launcher->queue_depth));
+
+  if(queue_depth > task_launcher->max_queue_depth){
+    task_launcher->max_queue_depth = queue_depth;
+  }
+  
+  while((node = ags_task_launcher_queue_pop(task_launcher)) != NULL){
+    task = ags_task_queue_node_get_task(node);
+
+    task_private = AGS_TASK_GET_PRIVATE(task);
+    
+    if(task_private->coalesce_object != NULL ||
+       task_private->coalesce_property != NULL){
+      if(g_hash_table_lookup_extended(task_launcher->coalesce_task,
+				      task,
+				      (gpointer *) &prev_task, &index)){
+	/* last write wins */
+	g_ptr_array_index(task_launcher->pending_task, GPOINTER_TO_UINT(index) - 1) = NULL;
+
+	g_hash_table_remove(task_launcher->coalesce_task,
+			    prev_task);
+
+	ags_atomic_int_set(&(AGS_TASK_GET_PRIVATE(prev_task)->is_queued),
+			   FALSE);
+	g_object_unref(prev_task);
+
+	ags_atomic_int_decrement(&(task_launcher->queue_depth));
+	
+	task_launcher->coalesced_count += 1;
+      }
+
+      g_hash_table_insert(task_launcher->coalesce_task,
+			  task,
+			  GUINT_TO_POINTER(task_launcher->pending_task->len + 1));
+    }
+
+    g_ptr_array_add(task_launcher->pending_task,
+		    task);
+  }
+}
+
+void
+ags_task_launcher_clear_pending(AgsTaskLauncher *task_launcher)
+{
+  AgsTask *task;
+
+  guint i;
+
+  if(task_launcher->pending_task == NULL){
+    return;
+  }
+  
+  ags_task_launcher_drain_queue(task_launcher);
+
+  for(i = 0; i < task_launcher->pending_task->len; i++){
+    task = g_ptr_array_index(task_launcher->pending_task, i);
+
+    if(task != NULL){
+      ags_atomic_int_set(&(AGS_TASK_GET_PRIVATE(task)->is_queued),
+			 FALSE);
+      g_object_unref(task);
+    }
+  }
+
+  g_ptr_array_set_size(task_launcher->pending_task,
+		       0);
+  g_hash_table_remove_all(task_launcher->coalesce_task);
+
+  ags_atomic_int_set(&(task_launcher->queue_depth),
+		     0);
+}
+
 /**
  * ags_task_launcher_add_task:
  * @task_launcher: the #AgsTaskLauncher
  * @task: the #AgsTask
  * 
- * Add @task to @task_launcher.
+ * Add @task to @task_launcher. The task is pushed to a lock-free queue
+ * and launched by the next run in the order added. Adding a task
+ * already queued has no effect.
  * 
  * Since: 3.0.0
  */
@@ -638,23 +929,28 @@ void
 ags_task_launcher_add_task(AgsTaskLauncher *task_launcher,
 			   AgsTask *task)
 {
-  GRecMutex *task_launcher_mutex;
-
+  AgsTaskPrivate *task_private;
+  
   if(!AGS_IS_TASK_LAUNCHER(task_launcher) ||
      !AGS_IS_TASK(task)){
     return;
   }
 
-  /* get task launcher mutex */
-  task_launcher_mutex = AGS_TASK_LAUNCHER_GET_OBJ_MUTEX(task_launcher);
-
-  g_rec_mutex_lock(task_launcher_mutex);
+  task_private = AGS_TASK_GET_PRIVATE(task);
+  
+  if(!ags_atomic_int_compare_and_exchange(&(task_private->is_queued),
+					  FALSE, TRUE)){
+    return;
+  }
 
-  task_launcher->task = g_list_prepend(task_launcher->task,
-				       task);
   g_object_ref(task);
+
+  task_private->queue_time = g_get_monotonic_time();
   
-  g_rec_mutex_unlock(task_launcher_mutex);
+  ags_atomic_int_increment(&(task_launcher->queue_depth));
+
+  ags_task_launcher_queue_push(task_launcher,
+			       &(task_private->queue_node));
 }
 
 /**
@@ -670,30 +966,17 @@ void
 ags_task_launcher_add_task_all(AgsTaskLauncher *task_launcher,
 			       GList *list)
 {
-  GRecMutex *task_launcher_mutex;
-
   if(!AGS_IS_TASK_LAUNCHER(task_launcher) ||
      list == NULL){
     return;
   }
 
-  /* get task launcher mutex */
-  task_launcher_mutex = AGS_TASK_LAUNCHER_GET_OBJ_MUTEX(task_launcher);
-
-  g_rec_mutex_lock(task_launcher_mutex);
+  while(list != NULL){
+    ags_task_launcher_add_task(task_launcher,
+			       list->data);
 
-  if(task_launcher->task != NULL){
-    task_launcher->task = g_list_concat(task_launcher->task,
-					g_list_copy_deep(list,
-							 (GCopyFunc) g_object_ref,
-							 NULL));
-  }else{
-    task_launcher->task = g_list_copy_deep(list,
-					   (GCopyFunc) g_object_ref,
-					   NULL);
+    list = list->next;
   }
-  
-  g_rec_mutex_unlock(task_launcher_mutex);
 }
 
 /**
@@ -761,53 +1044,341 @@ ags_task_launcher_remove_cyclic_task(AgsTaskLauncher *task_launcher,
   g_rec_mutex_unlock(task_launcher_mutex);
 }
 
+/**
+ * ags_task_launcher_set_max_task_count:
+ * @task_launcher: the #AgsTaskLauncher
+ * @max_task_count: the maximum task count per run, 0 means unlimited
+ * 
+ * Set the maximum count of one shot tasks launched per run of @task_launcher.
+ * 
+ * Since: 9.1.0
+ */
+void
+ags_task_launcher_set_max_task_count(AgsTaskLauncher *task_launcher,
+				     guint max_task_count)
+{
+  if(!AGS_IS_TASK_LAUNCHER(task_launcher)){
+    return;
+  }
+
+  g_object_set(task_launcher,
+	       "max-task-count", max_task_count,
+	       NULL);
+}
+
+/**
+ * ags_task_launcher_get_max_task_count:
+ * @task_launcher: the #AgsTaskLauncher
+ * 
+ * Get the maximum count of one shot tasks launched per run of @task_launcher.
+ * 
+ * Returns: the maximum task count, 0 means unlimited
+ * 
+ * Since: 9.1.0
+ */
+guint
+ags_task_launcher_get_max_task_count(AgsTaskLauncher *task_launcher)
+{
+  guint max_task_count;
+  
+  if(!AGS_IS_TASK_LAUNCHER(task_launcher)){
+    return(0);
+  }
+
+  g_object_get(task_launcher,
+	       "max-task-count", &max_task_count,
+	       NULL);
+
+  return(max_task_count);
+}
+
+/**
+ * ags_task_launcher_get_queue_depth:
+ * @task_launcher: the #AgsTaskLauncher
+ * 
+ * Get the count of one shot tasks queued but not yet launched.
+ * 
+ * Returns: the queue depth
+ * 
+ * Since: 9.1.0
+ */
+guint
+ags_task_launcher_get_queue_depth(AgsTaskLauncher *task_launcher)
+{
+  if(!AGS_IS_TASK_LAUNCHER(task_launcher)){
+    return(0);
+  }
+
+  return((guint) ags_atomic_int_get(&(task_launcher->queue_depth)));
+}
+
+/**
+ * ags_task_launcher_get_stats:
+ * @task_launcher: the #AgsTaskLauncher
+ * @max_queue_depth: (out) (optional): return location of the maximum queue depth seen by a run
+ * @executed_count: (out) (optional): return location of the count of launched one shot tasks
+ * @coalesced_count: (out) (optional): return location of the count of dropped superseded tasks
+ * @mean_latency: (out) (optional): return location of the mean latency between add and launch in microseconds
+ * @max_latency: (out) (optional): return location of the maximum latency in microseconds
+ * 
+ * Get the queue statistics of @task_launcher.
+ * 
+ * Since: 9.1.0
+ */
+void
+ags_task_launcher_get_stats(AgsTaskLauncher *task_launcher,
+			    guint *max_queue_depth,
+			    guint64 *executed_count,
+			    guint64 *coalesced_count,
+			    gdouble *mean_latency,
+			    gint64 *max_latency)
+{
+  GRecMutex *task_launcher_mutex;
+
+  if(!AGS_IS_TASK_LAUNCHER(task_launcher)){
+    return;
+  }
+
+  /* get task launcher mutex */
+  task_launcher_mutex = AGS_TASK_LAUNCHER_GET_OBJ_MUTEX(task_launcher);
+
+  g_rec_mutex_lock(task_launcher_mutex);
+
+  if(max_queue_depth != NULL){
+    max_queue_depth[0] = task_launcher->max_queue_depth;
+  }
+
+  if(executed_count != NULL){
+    executed_count[0] = task_launcher->executed_count;
+  }
+
+  if(coalesced_count != NULL){
+    coalesced_count[0] = task_launcher->coalesced_count;
+  }
+
+  if(mean_latency != NULL){
+    mean_latency[0] = 0.0;
+    
+    if(task_launcher->executed_count > 0){
+      mean_latency[0] = (gdouble) task_launcher->latency_sum / (gdouble) task_launcher->executed_count;
+    }
+  }
+
+  if(max_latency != NULL){
+    max_latency[0] = task_launcher->latency_max;
+  }
+  
+  g_rec_mutex_unlock(task_launcher_mutex);
+}
+
+/**
+ * ags_task_launcher_reset_stats:
+ * @task_launcher: the #AgsTaskLauncher
+ * 
+ * Reset the queue statistics of @task_launcher.
+ * 
+ * Since: 9.1.0
+ */
+void
+ags_task_launcher_reset_stats(AgsTaskLauncher *task_launcher)
+{
+  GRecMutex *task_launcher_mutex;
+
+  if(!AGS_IS_TASK_LAUNCHER(task_launcher)){
+    return;
+  }
+
+  /* get task launcher mutex */
+  task_launcher_mutex = AGS_TASK_LAUNCHER_GET_OBJ_MUTEX(task_launcher);
+
+  g_rec_mutex_lock(task_launcher_mutex);
+
+  task_launcher->max_queue_depth = 0;
+
+  task_launcher->executed_count = 0;
+  task_launcher->coalesced_count = 0;
+
+  task_launcher->latency_sum = 0;
+  task_launcher->latency_max = 0;
+  
+  g_rec_mutex_unlock(task_launcher_mutex);
+}
+
 void
 ags_task_launcher_real_run(AgsTaskLauncher *task_launcher)
 {
-  GList *start_task, *task;
+  AgsTask *task;
+  
   GList *start_cyclic_task, *cyclic_task;
 
+  AgsTask **batch;
+  
+  gint64 now, latency;
+  gint64 latency_sum, latency_max;
+  guint batch_count, batch_length;
+  guint max_task_count;
+  guint i, j;
+  gboolean use_preallocated;
+  
   GRecMutex *task_launcher_mutex;
 
   /* get task launcher mutex */
   task_launcher_mutex = AGS_TASK_LAUNCHER_GET_OBJ_MUTEX(task_launcher);
 
-  start_task = NULL;
   start_cyclic_task = NULL;
   
   g_rec_mutex_lock(task_launcher_mutex);
 
-  g_object_get(task_launcher,
-	       "task", &start_task,
-	       "cyclic-task", &start_cyclic_task,
-	       NULL);
+  ags_task_launcher_drain_queue(task_launcher);
 
-  g_list_free_full(task_launcher->task,
-		   (GDestroyNotify) g_object_unref);
+  max_task_count = task_launcher->max_task_count;
+
+  /* take batch in FIFO order */
+  batch = NULL;
+  batch_count = 0;
+
+  batch_length = task_launcher->pending_task->len;
+
+  if(max_task_count != 0 &&
+     batch_length > max_task_count){
+    batch_length = max_task_count;
+  }
+
+  use_preallocated = FALSE;
   
-  task_launcher->task = NULL;
+  if(batch_length > 0){
+    /* a nested or concurrent run allocates its own batch */
+    use_preallocated = ags_atomic_int_compare_and_exchange(&(task_launcher->batch_in_use),
+							   FALSE, TRUE);
+    
+    if(use_preallocated){
+      if(batch_length > task_launcher->batch_size){
+	/* only with unlimited max task count or after growing it during a run */
+	task_launcher->batch = (AgsTask **) g_renew(AgsTask *,
+						    task_launcher->batch,
+						    batch_length);
+	task_launcher->batch_size = batch_length;
+      }
+      
+      batch = task_launcher->batch;
+    }else{
+      batch = (AgsTask **) g_malloc(batch_length * sizeof(AgsTask *));
+    }
+  }
+
+  for(i = 0; i < task_launcher->pending_task->len && (max_task_count == 0 || batch_count < max_task_count); i++){
+    task = g_ptr_array_index(task_launcher->pending_task, i);
+
+    if(task != NULL){
+      batch[batch_count] = task;
+      batch_count++;
+    }
+  }
+
+  /* keep remaining tasks for next run */
+  g_hash_table_remove_all(task_launcher->coalesce_task);
+
+  for(j = 0; i < task_launcher->pending_task->len; i++){
+    task = g_ptr_array_index(task_launcher->pending_task, i);
+
+    if(task != NULL){
+      g_ptr_array_index(task_launcher->pending_task, j) = task;
+
+      if(AGS_TASK_GET_PRIVATE(task)->coalesce_object != NULL ||
+	 AGS_TASK_GET_PRIVATE(task)->coalesce_property != NULL){
+	g_hash_table_insert(task_launcher->coalesce_task,
+			    task,
+			    GUINT_TO_POINTER(j + 1));
+      }
+      
+      j++;
+    }
+  }
+
+  g_ptr_array_set_size(task_launcher->pending_task,
+		       j);
+
+  start_cyclic_task = g_list_copy_deep(task_launcher->cyclic_task,
+				       (GCopyFunc) g_object_ref,
+				       NULL);
   
   g_rec_mutex_unlock(task_launcher_mutex);
   
+  if(AGS_TRACE_IS_ENABLED()){
+    ags_trace_counter("task", "task-count",
+		      batch_count);
+    ags_trace_counter("task", "task-queue-depth",
+		      ags_atomic_int_get(&(task_launcher->queue_depth)));
+  }
+  
   /* one shot task */
-  task = start_task;
+  now = g_get_monotonic_time();
 
-  while(task != NULL){
-    ags_task_launch(task->data);
-      
-    /* iterate */
-    task = task->next;
+  latency_sum = 0;
+  latency_max = 0;
+  
+  for(i = 0; i < batch_count; i++){
+    task = batch[i];
+
+    latency = now - AGS_TASK_GET_PRIVATE(task)->queue_time;
+
+    latency_sum += latency;
+
+    if(latency > latency_max){
+      latency_max = latency;
+    }
+    
+    /* the task might be added again while launched */
+    ags_atomic_int_set(&(AGS_TASK_GET_PRIVATE(task)->is_queued),
+		       FALSE);
+    ags_atomic_int_decrement(&(task_launcher->queue_depth));
+    
+    if(AGS_TRACE_IS_ENABLED()){
+      ags_trace_begin("task", G_OBJECT_TYPE_NAME(task));
+    }
+    
+    ags_task_launch(task);
+
+    if(AGS_TRACE_IS_ENABLED()){
+      ags_trace_end("task", G_OBJECT_TYPE_NAME(task));
+    }
+
+    g_object_unref(task);
   }
 
-  g_list_free_full(start_task,
-		   (GDestroyNotify) g_object_unref);
+  if(use_preallocated){
+    ags_atomic_int_set(&(task_launcher->batch_in_use),
+		       FALSE);
+  }else{
+    g_free(batch);
+  }
+
+  /* statistics */
+  g_rec_mutex_lock(task_launcher_mutex);
+
+  task_launcher->executed_count += batch_count;
+  task_launcher->latency_sum += latency_sum;
+
+  if(latency_max > task_launcher->latency_max){
+    task_launcher->latency_max = latency_max;
+  }
+    
+  g_rec_mutex_unlock(task_launcher_mutex);
 
   /* cyclic task */
   cyclic_task = start_cyclic_task;
 
   while(cyclic_task != NULL){
+    if(AGS_TRACE_IS_ENABLED()){
+      ags_trace_begin("task", G_OBJECT_TYPE_NAME(cyclic_task->data));
+    }
+
     ags_task_launch(cyclic_task->data);
 
+    if(AGS_TRACE_IS_ENABLED()){
+      ags_trace_end("task", G_OBJECT_TYPE_NAME(cyclic_task->data));
+    }
+
     /* iterate */
     cyclic_task = cyclic_task->next;
   }
@@ -40,6 +40,8 @@ G_BEGIN_DECLS
 
 #define AGS_TASK_LAUNCHER_GET_OBJ_MUTEX(obj) (&(((AgsTaskLauncher *) obj)->obj_mutex))
 
+#define AGS_TASK_LAUNCHER_DEFAULT_MAX_TASK_COUNT (256)
+
 typedef struct _AgsTaskLauncher AgsTaskLauncher;
 typedef struct _AgsTaskLauncherClass AgsTaskLauncherClass;
 
@@ -55,8 +57,10 @@ struct _AgsTaskLauncher
   AgsUUID *uuid;
   
   GMainContext *main_context;
-  
+
+  /* deprecated since 9.1.0, always NULL - use AgsTaskLauncher:task */
   GList *task;
+  
   GList *cyclic_task;
 
   _Atomic gboolean is_running;
@@ -64,6 +68,28 @@ struct _AgsTaskLauncher
   
   GMutex wait_mutex;
   GCond wait_cond;
+
+  AgsTaskQueueNode *queue_head;
+  AgsTaskQueueNode *queue_tail;
+  AgsTaskQueueNode queue_stub;
+
+  GPtrArray *pending_task;
+  GHashTable *coalesce_task;
+
+  guint max_task_count;
+
+  AgsTask **batch;
+  guint batch_size;
+  volatile gint batch_in_use;
+  
+  volatile gint queue_depth;
+  guint max_queue_depth;
+
+  guint64 executed_count;
+  guint64 coalesced_count;
+
+  gint64 latency_sum;
+  gint64 latency_max;
 };
 
 struct _AgsTaskLauncherClass
@@ -88,6 +114,20 @@ void ags_task_launcher_add_cyclic_task(AgsTaskLauncher *task_launcher,
 void ags_task_launcher_remove_cyclic_task(AgsTaskLauncher *task_launcher,
 					  AgsTask *cyclic_task);
 
+void ags_task_launcher_set_max_task_count(AgsTaskLauncher *task_launcher,
+					  guint max_task_count);
+guint ags_task_launcher_get_max_task_count(AgsTaskLauncher *task_launcher);
+
+guint ags_task_launcher_get_queue_depth(AgsTaskLauncher *task_launcher);
+
+void ags_task_launcher_get_stats(AgsTaskLauncher *task_launcher,
+				 guint *max_queue_depth,
+				 guint64 *executed_count,
+				 guint64 *coalesced_count,
+				 gdouble *mean_latency,
+				 gint64 *max_latency);
+void ags_task_launcher_reset_stats(AgsTaskLauncher *task_launcher);
+
 void ags_task_launcher_run(AgsTaskLauncher *task_launcher);
 
 void ags_task_launcher_sync_run(AgsTaskLauncher *task_launcher);
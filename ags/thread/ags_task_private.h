@@ -0,0 +1,54 @@
+/* GSequencer - Advanced GTK Sequencer
+ * Copyright (C) 2005-2026 Joël Krähemann
+ *
+ * This file is part of GSequencer.
+ *
+ * GSequencer is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GSequencer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GSequencer.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __AGS_TASK_PRIVATE_H__
+#define __AGS_TASK_PRIVATE_H__
+
+#include <glib.h>
+#include <glib-object.h>
+
+#include <ags/thread/ags_task.h>
+
+G_BEGIN_DECLS
+
+#define AGS_TASK_GET_PRIVATE(obj) (ags_task_get_instance_private((AgsTask *) (obj)))
+
+typedef struct _AgsTaskPrivate AgsTaskPrivate;
+
+/* not installed, the queue state of AgsTask is shared with AgsTaskLauncher only */
+struct _AgsTaskPrivate
+{
+  AgsTask *task;
+
+  AgsTaskQueueNode queue_node;
+  volatile gint is_queued;
+  gint64 queue_time;
+
+  gpointer coalesce_object;
+  const gchar *coalesce_property;
+  guint coalesce_detail;
+};
+
+AgsTaskPrivate* ags_task_get_instance_private(AgsTask *task);
+
+AgsTask* ags_task_queue_node_get_task(AgsTaskQueueNode *queue_node);
+
+G_END_DECLS
+
+#endif /*__AGS_TASK_PRIVATE_H__*/
@@ -27,6 +27,8 @@
 
 #include <ags/thread/ags_concurrency_provider.h>
 #include <ags/thread/ags_task_launcher.h>
+#include <ags/thread/ags_epoch_reclaimer.h>
+#include <ags/thread/ags_trace.h>
 
 #include <stdlib.h>
 #include <stdio.h>
@@ -541,6 +543,9 @@ ags_thread_init(AgsThread *thread)
   g_mutex_init(&(thread->wait_mutex));
 
   g_cond_init(&(thread->wait_cond));
+
+  /* the sync-tic barrier */
+  ags_tic_barrier_init(&(thread->tic_barrier));
   
   /* thread, tic mutex and cond */
   thread->thread = NULL;
@@ -712,6 +717,9 @@ ags_thread_finalize(GObject *gobject)
 
   /* UUID */
   ags_uuid_free(thread->uuid);
+
+  /* tic barrier */
+  ags_tic_barrier_clear(&(thread->tic_barrier));
     
   /* call parent */
   G_OBJECT_CLASS(ags_thread_parent_class)->finalize(gobject);
@@ -2220,7 +2228,7 @@ ags_thread_set_current_sync(AgsThread *current, guint current_sync_tic)
   guint sync_tic_wait, sync_tic_done;
 
   GMutex *wait_mutex;
-  GCond *wait_cond;
+  AgsTicBarrier *tic_barrier;
 
   if(!AGS_IS_THREAD(current)){
     return;
@@ -2240,7 +2248,7 @@ ags_thread_set_current_sync(AgsThread *current, guint current_sync_tic)
   }
   
   wait_mutex = AGS_THREAD_GET_WAIT_MUTEX(current);
-  wait_cond = AGS_THREAD_GET_WAIT_COND(current);
+  tic_barrier = AGS_THREAD_GET_TIC_BARRIER(current);
 
   next_current_sync_tic = G_MAXUINT;
   
@@ -2333,11 +2341,10 @@ ags_thread_set_current_sync(AgsThread *current, guint current_sync_tic)
 
   ags_thread_set_sync_tic_flags(current, sync_tic_done);
 
-  if(ags_thread_test_sync_tic_flags(current, sync_tic_wait)){
-    g_cond_signal(wait_cond);
-  }
-
   g_mutex_unlock(wait_mutex);
+
+  /* wake current, if waiting */
+  ags_tic_barrier_advance(tic_barrier);
 }
 
 void
@@ -2379,6 +2386,7 @@ ags_thread_real_clock(AgsThread *thread)
   guint sync_tic_wait, sync_tic_done;
   guint next_sync_tic_wait, next_sync_tic_done;    
   guint clocked_steps;
+  guint generation;
   gboolean initial_sync;
   
   GRecMutex *thread_mutex;
@@ -2387,7 +2395,8 @@ ags_thread_real_clock(AgsThread *thread)
   GMutex *thread_start_mutex;
   GCond *thread_start_cond;
   GMutex *wait_mutex;
-  GCond *wait_cond;
+  AgsTicBarrier *tic_barrier;
+  AgsTicBarrier *main_loop_tic_barrier;
   
   application_context = ags_application_context_get_instance();
   
@@ -2403,18 +2412,24 @@ ags_thread_real_clock(AgsThread *thread)
   
   /* wait */
   wait_mutex = AGS_THREAD_GET_WAIT_MUTEX(thread);
-  wait_cond = AGS_THREAD_GET_WAIT_COND(thread);
+  tic_barrier = AGS_THREAD_GET_TIC_BARRIER(thread);
 
+  main_loop_tic_barrier = AGS_THREAD_GET_TIC_BARRIER(main_loop);
+  
   /* check initial sync */
   initial_sync = FALSE;
   
   if(ags_thread_test_status_flags(thread, AGS_THREAD_STATUS_INITIAL_SYNC)){
     initial_sync = TRUE;
 
+    /* sleep until main loop left critical region */
+    generation = ags_tic_barrier_get_generation(main_loop_tic_barrier);
+    
     while(ags_main_loop_is_critical_region(AGS_MAIN_LOOP(main_loop))){
-#if !defined(AGS_WITH_RT)
-      g_usleep(4);
-#endif
+      ags_tic_barrier_wait(main_loop_tic_barrier,
+			   generation);
+
+      generation = ags_tic_barrier_get_generation(main_loop_tic_barrier);
     }
     
     /* increment queued critical region */
@@ -2440,24 +2455,36 @@ ags_thread_real_clock(AgsThread *thread)
   g_rec_mutex_lock(tree_mutex);
 
   if(thread == main_loop){
+    /* sleep until queued critical region is done */
+    generation = ags_tic_barrier_get_generation(main_loop_tic_barrier);
+    
     while(ags_main_loop_test_queued_critical_region(AGS_MAIN_LOOP(main_loop)) != 0){
       g_rec_mutex_unlock(tree_mutex);
-    
+
+      ags_tic_barrier_wait(main_loop_tic_barrier,
+			   generation);
+      
       g_rec_mutex_lock(tree_mutex);
+
+      generation = ags_tic_barrier_get_generation(main_loop_tic_barrier);
     }
 
     ags_main_loop_set_critical_region(AGS_MAIN_LOOP(main_loop), TRUE);
   }  
   
   if(ags_thread_test_status_flags(thread, AGS_THREAD_STATUS_IS_CHAOS_TREE)){
+    /* sleep until main loop synced tree */
+    generation = ags_tic_barrier_get_generation(main_loop_tic_barrier);
+
     while(ags_main_loop_is_syncing(AGS_MAIN_LOOP(main_loop))){
       g_rec_mutex_unlock(tree_mutex);
 
-#if !defined(AGS_WITH_RT)
-      g_usleep(4);
-#endif
+      ags_tic_barrier_wait(main_loop_tic_barrier,
+			   generation);
       
       g_rec_mutex_lock(tree_mutex);
+
+      generation = ags_tic_barrier_get_generation(main_loop_tic_barrier);
     }
 
     ags_thread_unset_status_flags(thread, AGS_THREAD_STATUS_IS_CHAOS_TREE);
@@ -2663,6 +2690,8 @@ ags_thread_real_clock(AgsThread *thread)
 
     /* decrement queued critical region */
     ags_main_loop_dec_queued_critical_region(AGS_MAIN_LOOP(main_loop));
+
+    ags_tic_barrier_advance(main_loop_tic_barrier);
   }
 
   /* synchronize */
@@ -2673,24 +2702,22 @@ ags_thread_real_clock(AgsThread *thread)
     gboolean unlock_tree;
 
     unlock_tree = TRUE;
-          
-    g_mutex_lock(wait_mutex);
-      
-    if(ags_thread_test_sync_tic_flags(thread, sync_tic_wait) &&
-       !ags_thread_test_sync_tic_flags(thread, sync_tic_done)){
-      ags_thread_set_sync_tic_flags(thread, sync_tic_wait);
-
-      while(ags_thread_test_sync_tic_flags(thread, sync_tic_wait) &&
-	    !ags_thread_test_sync_tic_flags(thread, sync_tic_done)){
-	if(unlock_tree){
-	  unlock_tree = FALSE;
+
+    /* sleep until ags_thread_set_current_sync() marked sync-tic done */
+    generation = ags_tic_barrier_get_generation(tic_barrier);
+    
+    while(ags_thread_test_sync_tic_flags(thread, sync_tic_wait) &&
+	  !ags_thread_test_sync_tic_flags(thread, sync_tic_done)){
+      if(unlock_tree){
+	unlock_tree = FALSE;
 	  
-	  g_rec_mutex_unlock(tree_mutex);
-	}
-	
-	g_cond_wait(wait_cond,
-		    wait_mutex);
+	g_rec_mutex_unlock(tree_mutex);
       }
+	
+      ags_tic_barrier_wait(tic_barrier,
+			   generation);
+
+      generation = ags_tic_barrier_get_generation(tic_barrier);
     }
 
     ags_thread_unset_status_flags(thread, AGS_THREAD_STATUS_WAITING);
@@ -2701,6 +2728,8 @@ ags_thread_real_clock(AgsThread *thread)
       g_rec_mutex_unlock(tree_mutex);
     }
 
+    g_mutex_lock(wait_mutex);
+
     ags_thread_unset_sync_tic_flags(thread, sync_tic_wait);
     ags_thread_unset_sync_tic_flags(thread, sync_tic_done);
 
@@ -2745,6 +2774,8 @@ ags_thread_real_clock(AgsThread *thread)
     
     ags_main_loop_set_syncing(AGS_MAIN_LOOP(main_loop), FALSE);
 
+    ags_tic_barrier_advance(main_loop_tic_barrier);
+
     ags_thread_unset_sync_tic_flags(thread, sync_tic_wait);
     ags_thread_unset_sync_tic_flags(thread, sync_tic_done);
 
@@ -2803,6 +2834,8 @@ ags_thread_real_clock(AgsThread *thread)
 
   if(thread == main_loop){
     ags_main_loop_set_critical_region(AGS_MAIN_LOOP(main_loop), FALSE);
+
+    ags_tic_barrier_advance(main_loop_tic_barrier);
   }
 
   if(main_loop != NULL){
@@ -2844,6 +2877,7 @@ ags_thread_loop(void *ptr)
   AgsThread *main_loop;
   AgsThread *thread;
   AgsTaskLauncher *task_launcher;
+  AgsEpochReclaimer *epoch_reclaimer;
   
   AgsApplicationContext *application_context;
   
@@ -2865,6 +2899,13 @@ ags_thread_loop(void *ptr)
   g_private_set(&ags_thread_key,
 		thread);
 
+  ags_trace_set_thread_name(G_OBJECT_TYPE_NAME(thread));
+
+  /* register epoch record before running */
+  epoch_reclaimer = ags_epoch_reclaimer_get_instance();
+
+  ags_epoch_reclaimer_get_record(epoch_reclaimer);
+
   if(!AGS_IS_MAIN_LOOP(thread)){
     ags_thread_set_status_flags(thread, AGS_THREAD_STATUS_IS_CHAOS_TREE);
   }
@@ -2967,8 +3008,22 @@ ags_thread_loop(void *ptr)
 		     g_object_unref);
     
     /* run with clock synchronization */
+    if(AGS_TRACE_IS_ENABLED()){
+      ags_trace_begin("thread", "clock");
+    }
+    
     i_stop = ags_thread_clock(thread);
 
+    if(AGS_TRACE_IS_ENABLED()){
+      ags_trace_end("thread", "clock");
+
+      /* counters are process wide, so the main loop's only */
+      if(AGS_IS_MAIN_LOOP(thread)){
+	ags_trace_counter("thread", "sync-tic",
+			  ags_thread_get_current_sync_tic(thread));
+      }
+    }
+
     /* set busy flag */
     if(i_stop > 0){
       ags_thread_set_status_flags(thread, AGS_THREAD_STATUS_BUSY);
@@ -2980,7 +3035,19 @@ ags_thread_loop(void *ptr)
 #endif
       
       /* run */
+      if(AGS_TRACE_IS_ENABLED()){
+	ags_trace_begin("thread", G_OBJECT_TYPE_NAME(thread));
+      }
+      
+      ags_epoch_reclaimer_enter(epoch_reclaimer);
+      
       ags_thread_run(thread);
+
+      ags_epoch_reclaimer_leave(epoch_reclaimer);
+
+      if(AGS_TRACE_IS_ENABLED()){
+	ags_trace_end("thread", G_OBJECT_TYPE_NAME(thread));
+      }
     }    
 
     /* unset busy flag */
@@ -3055,6 +3122,8 @@ ags_thread_loop(void *ptr)
 #endif
 
     ags_main_loop_set_syncing(AGS_MAIN_LOOP(main_loop), FALSE);
+
+    ags_tic_barrier_advance(AGS_THREAD_GET_TIC_BARRIER(main_loop));
       
     g_rec_mutex_unlock(tree_mutex);
   }
@@ -3287,14 +3356,12 @@ void
 ags_thread_real_recover_dead_lock(AgsThread *thread)
 {
   GMutex *wait_mutex;
-  GCond *wait_cond;
 
   gint64 start_time, current_time;
 
   g_critical("recover dead-lock");
   
   wait_mutex = AGS_THREAD_GET_WAIT_MUTEX(thread);
-  wait_cond = AGS_THREAD_GET_WAIT_COND(thread);
   
   /* unset all wait */
   start_time = g_get_monotonic_time();
@@ -3335,7 +3402,7 @@ ags_thread_real_recover_dead_lock(AgsThread *thread)
 				     AGS_THREAD_SYNC_TIC_DONE_7 ||
 				     AGS_THREAD_SYNC_TIC_DONE_8));
       
-      g_cond_signal(wait_cond);
+      ags_tic_barrier_advance(AGS_THREAD_GET_TIC_BARRIER(thread));
     }else{
       ags_thread_unset_sync_tic_flags(thread,
 				      0x3f);
@@ -27,6 +27,7 @@
 #include <ags/lib/ags_time.h>
 
 #include <ags/thread/ags_atomic.h>
+#include <ags/thread/ags_tic_barrier.h>
 
 #include <time.h>
 
@@ -46,6 +47,7 @@ G_BEGIN_DECLS
 
 #define AGS_THREAD_GET_WAIT_MUTEX(obj) (&(((AgsThread *) obj)->wait_mutex))
 #define AGS_THREAD_GET_WAIT_COND(obj) (&(((AgsThread *) obj)->wait_cond))
+#define AGS_THREAD_GET_TIC_BARRIER(obj) (&(((AgsThread *) obj)->tic_barrier))
 #define AGS_THREAD_GET_TIC_MUTEX(obj) (&(((AgsThread *) obj)->tic_mutex))
 #define AGS_THREAD_GET_TIC_COND(obj) (&(((AgsThread *) obj)->tic_cond))
 #define AGS_THREAD_GET_START_MUTEX(obj) (&(((AgsThread *) obj)->start_mutex))
@@ -199,6 +201,8 @@ struct _AgsThread
 
   GMutex wait_mutex;
   GCond wait_cond;
+
+  AgsTicBarrier tic_barrier;
   
   GMutex tic_mutex;
   GCond tic_cond;
@@ -0,0 +1,258 @@
+/* GSequencer - Advanced GTK Sequencer
+ * Copyright (C) 2005-2026 Joël Krähemann
+ *
+ * This file is part of GSequencer.
+ *
+ * GSequencer is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GSequencer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GSequencer.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <ags/thread/ags_tic_barrier.h>
+
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <time.h>
+
+#define AGS_TIC_BARRIER_USE_FUTEX (1)
+#endif
+
+/**
+ * SECTION:ags_tic_barrier
+ * @short_description: Generation counting barrier
+ * @title: AgsTicBarrier
+ * @section_id:
+ * @include: ags/thread/ags_tic_barrier.h
+ *
+ * The #AgsTicBarrier-struct lets a thread sleep until an other thread
+ * published a state change. The waiter reads the generation by
+ * ags_tic_barrier_get_generation() before testing its condition, then
+ * passes it to ags_tic_barrier_wait(). The publisher modifies the state
+ * and calls ags_tic_barrier_advance(), which wakes all waiters.
+ *
+ * On Linux the barrier waits on a futex and advancing it doesn't enter
+ * the kernel as long as nobody waits. Elsewhere #GCond is used.
+ */
+
+/**
+ * ags_tic_barrier_init:
+ * @tic_barrier: the #AgsTicBarrier-struct
+ *
+ * Initialize @tic_barrier.
+ *
+ * Since: 9.1.0
+ */
+void
+ags_tic_barrier_init(AgsTicBarrier *tic_barrier)
+{
+  if(tic_barrier == NULL){
+    return;
+  }
+
+  ags_atomic_int_set(&(tic_barrier->generation),
+		     0);
+  ags_atomic_int_set(&(tic_barrier->waiter_count),
+		     0);
+
+  g_mutex_init(&(tic_barrier->mutex));
+  g_cond_init(&(tic_barrier->cond));
+}
+
+/**
+ * ags_tic_barrier_clear:
+ * @tic_barrier: the #AgsTicBarrier-struct
+ *
+ * Clear @tic_barrier, no thread may wait on it.
+ *
+ * Since: 9.1.0
+ */
+void
+ags_tic_barrier_clear(AgsTicBarrier *tic_barrier)
+{
+  if(tic_barrier == NULL){
+    return;
+  }
+
+  g_mutex_clear(&(tic_barrier->mutex));
+  g_cond_clear(&(tic_barrier->cond));
+}
+
+/**
+ * ags_tic_barrier_get_generation:
+ * @tic_barrier: the #AgsTicBarrier-struct
+ *
+ * Get the current generation of @tic_barrier. Read it before testing
+ * the awaited condition, so no advance gets lost.
+ *
+ * Returns: the generation
+ *
+ * Since: 9.1.0
+ */
+guint
+ags_tic_barrier_get_generation(AgsTicBarrier *tic_barrier)
+{
+  if(tic_barrier == NULL){
+    return(0);
+  }
+
+  return((guint) ags_atomic_int_get(&(tic_barrier->generation)));
+}
+
+/**
+ * ags_tic_barrier_wait:
+ * @tic_barrier: the #AgsTicBarrier-struct
+ * @generation: the generation read before testing the condition
+ *
+ * Wait until @tic_barrier advanced beyond @generation. Returns
+ * immediately if it already did.
+ *
+ * Since: 9.1.0
+ */
+void
+ags_tic_barrier_wait(AgsTicBarrier *tic_barrier,
+		     guint generation)
+{
+  if(tic_barrier == NULL){
+    return;
+  }
+
+  ags_atomic_int_increment(&(tic_barrier->waiter_count));
+  ags_atomic_memory_barrier();
+
+#if defined(AGS_TIC_BARRIER_USE_FUTEX)
+  while((guint) ags_atomic_int_get(&(tic_barrier->generation)) == generation){
+    syscall(SYS_futex,
+	    &(tic_barrier->generation), FUTEX_WAIT_PRIVATE, (gint) generation,
+	    NULL, NULL, 0);
+  }
+#else
+  g_mutex_lock(&(tic_barrier->mutex));
+
+  while((guint) ags_atomic_int_get(&(tic_barrier->generation)) == generation){
+    g_cond_wait(&(tic_barrier->cond),
+		&(tic_barrier->mutex));
+  }
+
+  g_mutex_unlock(&(tic_barrier->mutex));
+#endif
+
+  ags_atomic_int_decrement(&(tic_barrier->waiter_count));
+}
+
+/**
+ * ags_tic_barrier_wait_until:
+ * @tic_barrier: the #AgsTicBarrier-struct
+ * @generation: the generation read before testing the condition
+ * @end_time: the monotonic time in microseconds to give up
+ *
+ * Wait until @tic_barrier advanced beyond @generation or @end_time
+ * passed.
+ *
+ * Returns: %TRUE if advanced, otherwise %FALSE on timeout
+ *
+ * Since: 9.1.0
+ */
+gboolean
+ags_tic_barrier_wait_until(AgsTicBarrier *tic_barrier,
+			   guint generation,
+			   gint64 end_time)
+{
+  gboolean success;
+
+  if(tic_barrier == NULL){
+    return(FALSE);
+  }
+
+  success = TRUE;
+  
+  ags_atomic_int_increment(&(tic_barrier->waiter_count));
+  ags_atomic_memory_barrier();
+
+#if defined(AGS_TIC_BARRIER_USE_FUTEX)
+  while((guint) ags_atomic_int_get(&(tic_barrier->generation)) == generation){
+    struct timespec timeout;
+
+    gint64 remaining;
+
+    remaining = end_time - g_get_monotonic_time();
+
+    if(remaining <= 0){
+      success = FALSE;
+      
+      break;
+    }
+
+    timeout.tv_sec = remaining / G_USEC_PER_SEC;
+    timeout.tv_nsec = (remaining % G_USEC_PER_SEC) * 1000;
+    
+    syscall(SYS_futex,
+	    &(tic_barrier->generation), FUTEX_WAIT_PRIVATE, (gint) generation,
+	    &timeout, NULL, 0);
+  }
+#else
+  g_mutex_lock(&(tic_barrier->mutex));
+
+  while((guint) ags_atomic_int_get(&(tic_barrier->generation)) == generation){
+    if(!g_cond_wait_until(&(tic_barrier->cond),
+			  &(tic_barrier->mutex),
+			  end_time)){
+      success = ((guint) ags_atomic_int_get(&(tic_barrier->generation)) != generation) ? TRUE: FALSE;
+
+      break;
+    }
+  }
+
+  g_mutex_unlock(&(tic_barrier->mutex));
+#endif
+
+  ags_atomic_int_decrement(&(tic_barrier->waiter_count));
+
+  return(success);
+}
+
+/**
+ * ags_tic_barrier_advance:
+ * @tic_barrier: the #AgsTicBarrier-struct
+ *
+ * Advance the generation of @tic_barrier and wake all waiting threads.
+ * Call it after the awaited state was modified.
+ *
+ * Since: 9.1.0
+ */
+void
+ags_tic_barrier_advance(AgsTicBarrier *tic_barrier)
+{
+  if(tic_barrier == NULL){
+    return;
+  }
+
+#if defined(AGS_TIC_BARRIER_USE_FUTEX)
+  ags_atomic_int_increment(&(tic_barrier->generation));
+  ags_atomic_memory_barrier();
+
+  if(ags_atomic_int_get(&(tic_barrier->waiter_count)) > 0){
+    syscall(SYS_futex,
+	    &(tic_barrier->generation), FUTEX_WAKE_PRIVATE, G_MAXINT,
+	    NULL, NULL, 0);
+  }
+#else
+  g_mutex_lock(&(tic_barrier->mutex));
+
+  ags_atomic_int_increment(&(tic_barrier->generation));
+
+  g_cond_broadcast(&(tic_barrier->cond));
+
+  g_mutex_unlock(&(tic_barrier->mutex));
+#endif
+}
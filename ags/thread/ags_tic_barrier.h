@@ -0,0 +1,69 @@
+/* GSequencer - Advanced GTK Sequencer
+ * Copyright (C) 2005-2026 Joël Krähemann
+ *
+ * This file is part of GSequencer.
+ *
+ * GSequencer is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GSequencer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GSequencer.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __AGS_TIC_BARRIER_H__
+#define __AGS_TIC_BARRIER_H__
+
+#include <glib.h>
+#include <glib-object.h>
+
+#include <ags/thread/ags_atomic.h>
+
+G_BEGIN_DECLS
+
+#define AGS_TIC_BARRIER(ptr) ((AgsTicBarrier *)(ptr))
+
+typedef struct _AgsTicBarrier AgsTicBarrier;
+
+/**
+ * AgsTicBarrier:
+ * @generation: the generation, incremented by every advance
+ * @waiter_count: the number of threads waiting
+ * @mutex: the mutex used where futex is not available
+ * @cond: the condition used where futex is not available
+ *
+ * The #AgsTicBarrier-struct is a generation counting barrier. A waiter
+ * sleeps until the generation it read changes, so it is woken exactly
+ * as the awaited state was published.
+ */
+struct _AgsTicBarrier
+{
+  volatile gint generation;
+  volatile gint waiter_count;
+
+  GMutex mutex;
+  GCond cond;
+};
+
+void ags_tic_barrier_init(AgsTicBarrier *tic_barrier);
+void ags_tic_barrier_clear(AgsTicBarrier *tic_barrier);
+
+guint ags_tic_barrier_get_generation(AgsTicBarrier *tic_barrier);
+
+void ags_tic_barrier_wait(AgsTicBarrier *tic_barrier,
+			  guint generation);
+gboolean ags_tic_barrier_wait_until(AgsTicBarrier *tic_barrier,
+				    guint generation,
+				    gint64 end_time);
+
+void ags_tic_barrier_advance(AgsTicBarrier *tic_barrier);
+
+G_END_DECLS
+
+#endif /*__AGS_TIC_BARRIER_H__*/
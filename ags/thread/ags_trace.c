@@ -0,0 +1,748 @@
+/* GSequencer - Advanced GTK Sequencer
+ * Copyright (C) 2005-2026 Joël Krähemann
+ *
+ * This file is part of GSequencer.
+ *
+ * GSequencer is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GSequencer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GSequencer.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <ags/thread/ags_trace.h>
+
+#include <ags/lib/ags_time.h>
+
+#include <ags/config.h>
+
+#if !defined(AGS_W32API)
+#include <glib-unix.h>
+#endif
+
+#include <string.h>
+#include <time.h>
+
+void ags_trace_append_string(GString *str,
+			     const gchar *value);
+void ags_trace_append_event(GString *str,
+			    AgsTraceBuffer *trace_buffer,
+			    AgsTraceEvent *trace_event,
+			    gint64 start_time);
+
+gboolean ags_trace_dump_signal_callback(gpointer data);
+
+/**
+ * SECTION:ags_trace
+ * @short_description: Trace event recorder
+ * @title: AgsTrace
+ * @section_id:
+ * @include: ags/thread/ags_trace.h
+ *
+ * The tracer records begin/end spans, counters and instant events to a
+ * per thread #AgsTraceBuffer-struct. The buffers are registered lock-free
+ * as a thread records its first event and they are never released, so a
+ * dump may read them any time.
+ *
+ * ags_trace_dump() formats the recorded events as Chrome trace event JSON,
+ * which can be opened by Perfetto or chrome://tracing.
+ *
+ * Tracing is disabled by default, see ags_trace_set_enabled().
+ */
+
+volatile gboolean ags_trace_enabled = FALSE;
+
+static volatile guint ags_trace_buffer_size = AGS_TRACE_DEFAULT_BUFFER_SIZE;
+
+static gpointer ags_trace_buffer_list = NULL;
+static volatile guint ags_trace_thread_count = 0;
+
+static volatile gint64 ags_trace_clear_time = 0;
+
+static GMutex ags_trace_filename_mutex;
+static gchar *ags_trace_filename = NULL;
+
+static GPrivate ags_trace_buffer_key;
+static GPrivate ags_trace_thread_name_key = G_PRIVATE_INIT(g_free);
+
+/**
+ * ags_trace_get_time:
+ *
+ * Get monotonic time in nanoseconds.
+ *
+ * Returns: the current time in nanoseconds
+ *
+ * Since: 9.1.0
+ */
+gint64
+ags_trace_get_time()
+{
+  struct timespec time_now;
+
+  clock_gettime(CLOCK_MONOTONIC, &time_now);
+
+  return(((gint64) time_now.tv_sec * AGS_NSEC_PER_SEC) + (gint64) time_now.tv_nsec);
+}
+
+/**
+ * ags_trace_set_enabled:
+ * @enabled: %TRUE to enable, otherwise %FALSE
+ *
+ * Enable or disable tracing.
+ *
+ * Since: 9.1.0
+ */
+void
+ags_trace_set_enabled(gboolean enabled)
+{
+  ags_atomic_boolean_set(&ags_trace_enabled,
+			 enabled);
+}
+
+/**
+ * ags_trace_is_enabled:
+ *
+ * Check if tracing is enabled.
+ *
+ * Returns: %TRUE if enabled, otherwise %FALSE
+ *
+ * Since: 9.1.0
+ */
+gboolean
+ags_trace_is_enabled()
+{
+  return(ags_atomic_boolean_get(&ags_trace_enabled));
+}
+
+/**
+ * ags_trace_set_buffer_size:
+ * @buffer_size: the number of events per thread
+ *
+ * Set the number of events per thread, rounded up to a power of 2. It
+ * applies to buffers of threads not traced so far.
+ *
+ * Since: 9.1.0
+ */
+void
+ags_trace_set_buffer_size(guint buffer_size)
+{
+  guint event_count;
+
+  event_count = 1;
+
+  while(event_count < buffer_size){
+    event_count <<= 1;
+  }
+  
+  ags_atomic_uint_set(&ags_trace_buffer_size,
+		      event_count);
+}
+
+/**
+ * ags_trace_get_buffer_size:
+ *
+ * Get the number of events per thread.
+ *
+ * Returns: the buffer size
+ *
+ * Since: 9.1.0
+ */
+guint
+ags_trace_get_buffer_size()
+{
+  return(ags_atomic_uint_get(&ags_trace_buffer_size));
+}
+
+/**
+ * ags_trace_set_filename:
+ * @filename: the filename or %NULL for default
+ *
+ * Set the filename used by ags_trace_dump_to_file().
+ *
+ * Since: 9.1.0
+ */
+void
+ags_trace_set_filename(gchar *filename)
+{
+  g_mutex_lock(&ags_trace_filename_mutex);
+
+  g_free(ags_trace_filename);
+  
+  ags_trace_filename = g_strdup(filename);
+
+  g_mutex_unlock(&ags_trace_filename_mutex);
+}
+
+/**
+ * ags_trace_get_filename:
+ *
+ * Get the filename used by ags_trace_dump_to_file(). Defaults to
+ * AGS_TRACE_DEFAULT_FILENAME within the temporary directory.
+ *
+ * Returns: (transfer full): the filename
+ *
+ * Since: 9.1.0
+ */
+gchar*
+ags_trace_get_filename()
+{
+  gchar *filename;
+  
+  g_mutex_lock(&ags_trace_filename_mutex);
+
+  if(ags_trace_filename != NULL){
+    filename = g_strdup(ags_trace_filename);
+  }else{
+    filename = g_build_filename(g_get_tmp_dir(),
+				AGS_TRACE_DEFAULT_FILENAME,
+				NULL);
+  }
+  
+  g_mutex_unlock(&ags_trace_filename_mutex);
+
+  return(filename);
+}
+
+/**
+ * ags_trace_set_thread_name:
+ * @thread_name: the thread name
+ *
+ * Set the name of the calling thread shown by the trace viewer.
+ *
+ * Since: 9.1.0
+ */
+void
+ags_trace_set_thread_name(gchar *thread_name)
+{
+  AgsTraceBuffer *trace_buffer;
+
+  g_private_replace(&ags_trace_thread_name_key,
+		    g_strdup(thread_name));
+
+  /* name a buffer registered before */
+  trace_buffer = (AgsTraceBuffer *) g_private_get(&ags_trace_buffer_key);
+
+  if(trace_buffer != NULL &&
+     ags_atomic_pointer_get(&(trace_buffer->thread_name)) == NULL){
+    ags_atomic_pointer_set(&(trace_buffer->thread_name),
+			   g_strdup(thread_name));
+  }
+}
+
+/**
+ * ags_trace_buffer_alloc:
+ * @event_count: the number of events, a power of 2
+ *
+ * Allocate #AgsTraceBuffer-struct.
+ *
+ * Returns: (transfer full): the new #AgsTraceBuffer-struct
+ *
+ * Since: 9.1.0
+ */
+AgsTraceBuffer*
+ags_trace_buffer_alloc(guint event_count)
+{
+  AgsTraceBuffer *trace_buffer;
+
+  g_return_val_if_fail(event_count > 0 && (event_count & (event_count - 1)) == 0, NULL);
+
+  trace_buffer = (AgsTraceBuffer *) g_malloc(sizeof(AgsTraceBuffer));
+
+  trace_buffer->thread_id = 0;
+  trace_buffer->thread_name = NULL;
+
+  trace_buffer->event_count = event_count;
+  trace_buffer->event_mask = event_count - 1;
+
+  trace_buffer->event = (AgsTraceEvent *) g_malloc0(event_count * sizeof(AgsTraceEvent));
+
+  trace_buffer->write_index = 0;
+
+  trace_buffer->next = NULL;
+  
+  return(trace_buffer);
+}
+
+/**
+ * ags_trace_buffer_free:
+ * @trace_buffer: the #AgsTraceBuffer-struct
+ *
+ * Free @trace_buffer, it must not be registered.
+ *
+ * Since: 9.1.0
+ */
+void
+ags_trace_buffer_free(AgsTraceBuffer *trace_buffer)
+{
+  if(trace_buffer == NULL){
+    return;
+  }
+
+  g_free(trace_buffer->thread_name);
+  g_free(trace_buffer->event);
+  
+  g_free(trace_buffer);
+}
+
+/**
+ * ags_trace_get_buffer:
+ *
+ * Get the #AgsTraceBuffer-struct of the calling thread. The buffer is
+ * allocated and registered as called first by a thread.
+ *
+ * Returns: (transfer none): the #AgsTraceBuffer-struct
+ *
+ * Since: 9.1.0
+ */
+AgsTraceBuffer*
+ags_trace_get_buffer()
+{
+  AgsTraceBuffer *trace_buffer;
+  gpointer head;
+
+  trace_buffer = (AgsTraceBuffer *) g_private_get(&ags_trace_buffer_key);
+
+  if(trace_buffer != NULL){
+    return(trace_buffer);
+  }
+
+  trace_buffer = ags_trace_buffer_alloc(ags_trace_get_buffer_size());
+
+  trace_buffer->thread_id = ags_atomic_uint_increment(&ags_trace_thread_count) + 1;
+  trace_buffer->thread_name = g_strdup(g_private_get(&ags_trace_thread_name_key));
+
+  g_private_set(&ags_trace_buffer_key,
+		trace_buffer);
+
+  /* register */
+  do{
+    head = ags_atomic_pointer_get(&ags_trace_buffer_list);
+
+    trace_buffer->next = head;
+  }while(!ags_atomic_pointer_compare_and_exchange(&ags_trace_buffer_list,
+						  head,
+						  trace_buffer));
+  
+  return(trace_buffer);
+}
+
+static inline void
+ags_trace_record(const gchar *category,
+		 const gchar *name,
+		 gint64 value,
+		 guint phase)
+{
+  AgsTraceBuffer *trace_buffer;
+  AgsTraceEvent *trace_event;
+
+  gint64 write_index;
+
+  if(!ags_atomic_boolean_get(&ags_trace_enabled)){
+    return;
+  }
+  
+  trace_buffer = ags_trace_get_buffer();
+
+  /* only the owning thread writes */
+  write_index = trace_buffer->write_index;
+  
+  trace_event = &(trace_buffer->event[write_index & (trace_buffer->event_mask)]);
+
+  trace_event->timestamp = ags_trace_get_time();
+
+  trace_event->category = category;
+  trace_event->name = name;
+
+  trace_event->value = value;
+  
+  trace_event->phase = phase;
+
+  /* publish */
+  ags_atomic_int64_set(&(trace_buffer->write_index),
+		       write_index + 1);
+}
+
+/**
+ * ags_trace_begin:
+ * @category: the static category string
+ * @name: the static name string
+ *
+ * Record the begin of a span of the calling thread.
+ *
+ * Since: 9.1.0
+ */
+void
+ags_trace_begin(const gchar *category,
+		const gchar *name)
+{
+  ags_trace_record(category,
+		   name,
+		   0,
+		   AGS_TRACE_EVENT_BEGIN);
+}
+
+/**
+ * ags_trace_end:
+ * @category: the static category string
+ * @name: the static name string
+ *
+ * Record the end of a span of the calling thread.
+ *
+ * Since: 9.1.0
+ */
+void
+ags_trace_end(const gchar *category,
+	      const gchar *name)
+{
+  ags_trace_record(category,
+		   name,
+		   0,
+		   AGS_TRACE_EVENT_END);
+}
+
+/**
+ * ags_trace_counter:
+ * @category: the static category string
+ * @name: the static name string
+ * @value: the counter value
+ *
+ * Record a counter value.
+ *
+ * Since: 9.1.0
+ */
+void
+ags_trace_counter(const gchar *category,
+		  const gchar *name,
+		  gint64 value)
+{
+  ags_trace_record(category,
+		   name,
+		   value,
+		   AGS_TRACE_EVENT_COUNTER);
+}
+
+/**
+ * ags_trace_instant:
+ * @category: the static category string
+ * @name: the static name string
+ *
+ * Record an instant event of the calling thread.
+ *
+ * Since: 9.1.0
+ */
+void
+ags_trace_instant(const gchar *category,
+		  const gchar *name)
+{
+  ags_trace_record(category,
+		   name,
+		   0,
+		   AGS_TRACE_EVENT_INSTANT);
+}
+
+/**
+ * ags_trace_clear:
+ *
+ * Discard the events recorded so far from subsequent dumps.
+ *
+ * Since: 9.1.0
+ */
+void
+ags_trace_clear()
+{
+  ags_atomic_int64_set(&ags_trace_clear_time,
+		       ags_trace_get_time());
+}
+
+void
+ags_trace_append_string(GString *str,
+			const gchar *value)
+{
+  const gchar *iter;
+
+  g_string_append_c(str,
+		    '"');
+
+  for(iter = value; iter != NULL && iter[0] != '\0'; iter++){
+    if(iter[0] == '"' ||
+       iter[0] == '\\'){
+      g_string_append_c(str,
+			'\\');
+      g_string_append_c(str,
+			iter[0]);
+    }else if((guchar) iter[0] < 0x20){
+      g_string_append_printf(str,
+			     "\\u%04x",
+			     (guint) iter[0]);
+    }else{
+      g_string_append_c(str,
+			iter[0]);
+    }
+  }
+
+  g_string_append_c(str,
+		    '"');
+}
+
+void
+ags_trace_append_event(GString *str,
+		       AgsTraceBuffer *trace_buffer,
+		       AgsTraceEvent *trace_event,
+		       gint64 start_time)
+{
+  gint64 timestamp;
+  
+  timestamp = trace_event->timestamp - start_time;
+  
+  g_string_append(str,
+		  ",\n{\"name\":");
+  ags_trace_append_string(str,
+			  trace_event->name);
+
+  g_string_append(str,
+		  ",\"cat\":");
+  ags_trace_append_string(str,
+			  trace_event->category);
+
+  /* microseconds with nanosecond fraction */
+  g_string_append_printf(str,
+			 ",\"ph\":\"%c\",\"ts\":%" G_GINT64_FORMAT ".%03u,\"pid\":1,\"tid\":%u",
+			 (gchar) trace_event->phase,
+			 timestamp / 1000,
+			 (guint) (timestamp % 1000),
+			 trace_buffer->thread_id);
+
+  if(trace_event->phase == AGS_TRACE_EVENT_COUNTER){
+    g_string_append_printf(str,
+			   ",\"args\":{\"value\":%" G_GINT64_FORMAT "}",
+			   trace_event->value);
+  }else if(trace_event->phase == AGS_TRACE_EVENT_INSTANT){
+    g_string_append(str,
+		    ",\"s\":\"t\"");
+  }
+
+  g_string_append_c(str,
+		    '}');
+}
+
+/**
+ * ags_trace_dump:
+ *
+ * Dump the recorded events of all threads as Chrome trace event JSON. The
+ * threads keep recording while dumped, events overwritten meanwhile are
+ * skipped.
+ *
+ * Returns: (transfer full): the JSON string
+ *
+ * Since: 9.1.0
+ */
+gchar*
+ags_trace_dump()
+{
+  AgsTraceBuffer *trace_buffer;
+  AgsTraceEvent *trace_event;
+  
+  GString *str;
+
+  gchar *thread_name;
+  
+  gint64 clear_time, start_time;
+  gint64 start_index, end_index, valid_index;
+  gint64 i;
+  guint event_count;
+
+  clear_time = ags_atomic_int64_get(&ags_trace_clear_time);
+
+  /* timestamps relative to the oldest event */
+  start_time = G_MAXINT64;
+  
+  trace_buffer = ags_atomic_pointer_get(&ags_trace_buffer_list);
+
+  while(trace_buffer != NULL){
+    end_index = ags_atomic_int64_get(&(trace_buffer->write_index));
+    start_index = (end_index > trace_buffer->event_count) ? (end_index - trace_buffer->event_count): 0;
+
+    if(start_index < end_index){
+      trace_event = &(trace_buffer->event[start_index & (trace_buffer->event_mask)]);
+      
+      if(trace_event->timestamp < start_time){
+	start_time = trace_event->timestamp;
+      }
+    }
+    
+    trace_buffer = trace_buffer->next;
+  }
+
+  if(start_time == G_MAXINT64 ||
+     start_time < clear_time){
+    start_time = clear_time;
+  }
+  
+  str = g_string_sized_new(4096);
+
+  g_string_append(str,
+		  "{\"displayTimeUnit\":\"ms\",\n\"traceEvents\":[\n");
+
+  g_string_append(str,
+		  "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":");
+  ags_trace_append_string(str,
+			  ((g_get_prgname() != NULL) ? g_get_prgname(): "gsequencer"));
+  g_string_append(str,
+		  "}}");
+  
+  trace_buffer = ags_atomic_pointer_get(&ags_trace_buffer_list);
+
+  while(trace_buffer != NULL){
+    AgsTraceEvent *copy;
+    
+    /* thread name */
+    thread_name = ags_atomic_pointer_get(&(trace_buffer->thread_name));
+
+    if(thread_name != NULL){
+      g_string_append_printf(str,
+			     ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":",
+			     trace_buffer->thread_id);
+      ags_trace_append_string(str,
+			      thread_name);
+      g_string_append(str,
+		      "}}");
+    }
+
+    /* copy the events not overwritten */
+    end_index = ags_atomic_int64_get(&(trace_buffer->write_index));
+    start_index = (end_index > trace_buffer->event_count) ? (end_index - trace_buffer->event_count): 0;
+
+    event_count = (guint) (end_index - start_index);
+
+    copy = NULL;
+
+    if(event_count > 0){
+      copy = (AgsTraceEvent *) g_malloc(event_count * sizeof(AgsTraceEvent));
+
+      for(i = start_index; i < end_index; i++){
+	copy[i - start_index] = trace_buffer->event[i & (trace_buffer->event_mask)];
+      }
+    }
+
+    ags_atomic_memory_barrier();
+
+    valid_index = ags_atomic_int64_get(&(trace_buffer->write_index));
+    valid_index = (valid_index > trace_buffer->event_count) ? (valid_index - trace_buffer->event_count): 0;
+
+    for(i = MAX(start_index, valid_index); i < end_index; i++){
+      trace_event = &(copy[i - start_index]);
+
+      if(trace_event->timestamp < clear_time ||
+	 trace_event->name == NULL){
+	continue;
+      }
+      
+      ags_trace_append_event(str,
+			     trace_buffer,
+			     trace_event,
+			     start_time);
+    }
+
+    g_free(copy);
+    
+    trace_buffer = trace_buffer->next;
+  }
+
+  g_string_append(str,
+		  "\n]}\n");
+  
+  return(g_string_free(str,
+		       FALSE));
+}
+
+/**
+ * ags_trace_dump_to_file:
+ * @filename: (nullable): the filename or %NULL to use ags_trace_get_filename()
+ * @error: the #GError-struct
+ *
+ * Dump the recorded events as Chrome trace event JSON to @filename.
+ *
+ * Returns: %TRUE on success, otherwise %FALSE
+ *
+ * Since: 9.1.0
+ */
+gboolean
+ags_trace_dump_to_file(gchar *filename,
+		       GError **error)
+{
+  gchar *dump;
+  gchar *trace_filename;
+  
+  gboolean success;
+
+  if(filename != NULL){
+    trace_filename = g_strdup(filename);
+  }else{
+    trace_filename = ags_trace_get_filename();
+  }
+  
+  dump = ags_trace_dump();
+
+  success = g_file_set_contents(trace_filename,
+				dump,
+				-1,
+				error);
+
+  g_free(dump);
+  g_free(trace_filename);
+  
+  return(success);
+}
+
+gboolean
+ags_trace_dump_signal_callback(gpointer data)
+{
+  GError *error;
+
+  gchar *filename;
+
+  filename = ags_trace_get_filename();
+  
+  error = NULL;
+  
+  if(ags_trace_dump_to_file(filename,
+			    &error)){
+    g_message("trace dumped to %s", filename);
+  }else if(error != NULL){
+    g_warning("%s", error->message);
+
+    g_error_free(error);
+  }
+
+  g_free(filename);
+  
+  return(G_SOURCE_CONTINUE);
+}
+
+/**
+ * ags_trace_add_dump_signal:
+ * @signum: the signal number, e.g. SIGUSR2
+ *
+ * Dump to ags_trace_get_filename() as the process receives @signum. The
+ * dump is done by the default main context, not by the signal handler.
+ * Does nothing on platforms without UNIX signals.
+ *
+ * Since: 9.1.0
+ */
+void
+ags_trace_add_dump_signal(gint signum)
+{
+#if !defined(AGS_W32API)
+  g_unix_signal_add(signum,
+		    ags_trace_dump_signal_callback,
+		    NULL);
+#endif
+}
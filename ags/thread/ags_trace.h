@@ -0,0 +1,159 @@
+/* GSequencer - Advanced GTK Sequencer
+ * Copyright (C) 2005-2026 Joël Krähemann
+ *
+ * This file is part of GSequencer.
+ *
+ * GSequencer is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GSequencer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GSequencer.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef __AGS_TRACE_H__
+#define __AGS_TRACE_H__
+
+#include <glib.h>
+#include <glib-object.h>
+
+#include <ags/thread/ags_atomic.h>
+
+G_BEGIN_DECLS
+
+#define AGS_TRACE_BUFFER(ptr) ((AgsTraceBuffer *)(ptr))
+
+#define AGS_TRACE_DEFAULT_BUFFER_SIZE (65536)
+#define AGS_TRACE_DEFAULT_FILENAME "gsequencer-trace.json"
+
+/**
+ * AGS_TRACE_IS_ENABLED:
+ *
+ * Check if tracing is enabled. Call sites check this before computing
+ * event names, so tracing costs a branch only while disabled.
+ *
+ * Since: 9.1.0
+ */
+#define AGS_TRACE_IS_ENABLED() (ags_trace_enabled)
+
+typedef struct _AgsTraceEvent AgsTraceEvent;
+typedef struct _AgsTraceBuffer AgsTraceBuffer;
+
+/**
+ * AgsTraceEventPhase:
+ * @AGS_TRACE_EVENT_BEGIN: begin of span
+ * @AGS_TRACE_EVENT_END: end of span
+ * @AGS_TRACE_EVENT_COUNTER: counter value
+ * @AGS_TRACE_EVENT_INSTANT: instant event
+ *
+ * Enum values of the trace event phase, the values match the "ph" field
+ * of the Chrome trace event format.
+ */
+typedef enum{
+  AGS_TRACE_EVENT_BEGIN     = 'B',
+  AGS_TRACE_EVENT_END       = 'E',
+  AGS_TRACE_EVENT_COUNTER   = 'C',
+  AGS_TRACE_EVENT_INSTANT   = 'i',
+}AgsTraceEventPhase;
+
+/**
+ * AgsTraceEvent:
+ * @timestamp: the monotonic time in nanoseconds
+ * @category: the static category string
+ * @name: the static name string
+ * @value: the counter value
+ * @phase: the #AgsTraceEventPhase
+ *
+ * The #AgsTraceEvent-struct is a single trace record. Category and name are
+ * not copied, they must stay valid until dumped, e.g. string literals or
+ * type names.
+ */
+struct _AgsTraceEvent
+{
+  gint64 timestamp;
+  
+  const gchar *category;
+  const gchar *name;
+
+  gint64 value;
+  
+  guint phase;
+};
+
+/**
+ * AgsTraceBuffer:
+ * @thread_id: the trace's thread id
+ * @thread_name: the thread name
+ * @event_count: the number of events, a power of 2
+ * @event_mask: @event_count minus 1
+ * @event: (array length=event_count): the event ring
+ * @write_index: the free running write index, modified by the owning thread only
+ * @next: the next registered #AgsTraceBuffer-struct
+ *
+ * The #AgsTraceBuffer-struct is the per thread event ring of the tracer. Only
+ * the owning thread writes, so recording neither locks nor allocates. The
+ * oldest events are overwritten as the ring is full.
+ */
+struct _AgsTraceBuffer
+{
+  guint thread_id;
+  gchar *thread_name;
+
+  guint event_count;
+  guint event_mask;
+
+  AgsTraceEvent *event;
+
+  volatile gint64 write_index;
+
+  AgsTraceBuffer *next;
+};
+
+extern volatile gboolean ags_trace_enabled;
+
+gint64 ags_trace_get_time();
+
+void ags_trace_set_enabled(gboolean enabled);
+gboolean ags_trace_is_enabled();
+
+void ags_trace_set_buffer_size(guint buffer_size);
+guint ags_trace_get_buffer_size();
+
+void ags_trace_set_filename(gchar *filename);
+gchar* ags_trace_get_filename();
+
+void ags_trace_set_thread_name(gchar *thread_name);
+
+AgsTraceBuffer* ags_trace_buffer_alloc(guint event_count);
+void ags_trace_buffer_free(AgsTraceBuffer *trace_buffer);
+
+AgsTraceBuffer* ags_trace_get_buffer();
+
+void ags_trace_begin(const gchar *category,
+		     const gchar *name);
+void ags_trace_end(const gchar *category,
+		   const gchar *name);
+void ags_trace_counter(const gchar *category,
+		       const gchar *name,
+		       gint64 value);
+void ags_trace_instant(const gchar *category,
+		       const gchar *name);
+
+void ags_trace_clear();
+
+gchar* ags_trace_dump();
+gboolean ags_trace_dump_to_file(gchar *filename,
+				GError **error);
+
+void ags_trace_add_dump_signal(gint signum);
+
+G_END_DECLS
+
+#endif /*__AGS_TRACE_H__*/
@@ -0,0 +1,988 @@
+/* GSequencer - Advanced GTK Sequencer
+ * Copyright (C) 2005-2026 Joël Krähemann
+ *
+ * This file is part of GSequencer.
+ *
+ * GSequencer is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GSequencer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GSequencer.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <ags/thread/ags_work_stealing_scheduler.h>
+
+#include <ags/object/ags_priority.h>
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#ifdef AGS_WITH_RT
+#include <sched.h>
+#endif
+
+#include <ags/i18n.h>
+
+void ags_work_stealing_scheduler_class_init(AgsWorkStealingSchedulerClass *scheduler);
+void ags_work_stealing_scheduler_init(AgsWorkStealingScheduler *scheduler);
+void ags_work_stealing_scheduler_set_property(GObject *gobject,
+					      guint prop_id,
+					      const GValue *value,
+					      GParamSpec *param_spec);
+void ags_work_stealing_scheduler_get_property(GObject *gobject,
+					      guint prop_id,
+					      GValue *value,
+					      GParamSpec *param_spec);
+void ags_work_stealing_scheduler_dispose(GObject *gobject);
+void ags_work_stealing_scheduler_finalize(GObject *gobject);
+
+void ags_work_stealing_scheduler_alloc_worker(AgsWorkStealingScheduler *scheduler,
+					      guint worker_count);
+
+void ags_work_stealing_worker_push(AgsWorkStealingWorker *worker,
+				   AgsWorkStealingNode *node);
+AgsWorkStealingNode* ags_work_stealing_worker_pop(AgsWorkStealingWorker *worker);
+AgsWorkStealingNode* ags_work_stealing_worker_steal(AgsWorkStealingWorker *worker,
+						    AgsWorkStealingWorker *victim);
+
+void ags_work_stealing_scheduler_execute(AgsWorkStealingScheduler *scheduler,
+					 AgsWorkStealingWorker *worker,
+					 AgsWorkStealingNode *node);
+void ags_work_stealing_scheduler_work(AgsWorkStealingScheduler *scheduler,
+				      AgsWorkStealingWorker *worker);
+
+void* ags_work_stealing_scheduler_worker_thread(void *ptr);
+
+/**
+ * SECTION:ags_work_stealing_scheduler
+ * @short_description: work-stealing DAG scheduler
+ * @title: AgsWorkStealingScheduler
+ * @section_id:
+ * @include: ags/thread/ags_work_stealing_scheduler.h
+ *
+ * The #AgsWorkStealingScheduler executes a directed acyclic graph of
+ * nodes on a fixed pool of worker threads. Every worker owns a deque,
+ * nodes becoming ready are pushed to the deque of the worker completing
+ * their last dependency and idle workers steal of other workers' deques.
+ *
+ * The thread calling ags_work_stealing_scheduler_run() participates as
+ * worker 0 and returns as soon all nodes of the graph were executed.
+ */
+
+enum{
+  PROP_0,
+  PROP_WORKER_COUNT,
+};
+
+static gpointer ags_work_stealing_scheduler_parent_class = NULL;
+
+GType
+ags_work_stealing_scheduler_get_type()
+{
+  static gsize g_define_type_id__static = 0;
+
+  if(g_once_init_enter(&g_define_type_id__static)){
+    GType ags_type_work_stealing_scheduler = 0;
+
+    static const GTypeInfo ags_work_stealing_scheduler_info = {
+      sizeof (AgsWorkStealingSchedulerClass),
+      NULL, /* base_init */
+      NULL, /* base_finalize */
+      (GClassInitFunc) ags_work_stealing_scheduler_class_init,
+      NULL, /* class_finalize */
+      NULL, /* class_data */
+      sizeof (AgsWorkStealingScheduler),
+      0,    /* n_preallocs */
+      (GInstanceInitFunc) ags_work_stealing_scheduler_init,
+    };
+
+    ags_type_work_stealing_scheduler = g_type_register_static(G_TYPE_OBJECT,
+							      "AgsWorkStealingScheduler",
+							      &ags_work_stealing_scheduler_info,
+							      0);
+
+    g_once_init_leave(&g_define_type_id__static, ags_type_work_stealing_scheduler);
+  }
+
+  return(g_define_type_id__static);
+}
+
+GType
+ags_work_stealing_scheduler_flags_get_type()
+{
+  static gsize g_flags_type_id__static;
+
+  if(g_once_init_enter(&g_flags_type_id__static)){
+    static const GFlagsValue values[] = {
+      { AGS_WORK_STEALING_SCHEDULER_RUNNING, "AGS_WORK_STEALING_SCHEDULER_RUNNING", "work-stealing-scheduler-running" },
+      { AGS_WORK_STEALING_SCHEDULER_RT, "AGS_WORK_STEALING_SCHEDULER_RT", "work-stealing-scheduler-rt" },
+      { AGS_WORK_STEALING_SCHEDULER_GRAPH_MODIFIED, "AGS_WORK_STEALING_SCHEDULER_GRAPH_MODIFIED", "work-stealing-scheduler-graph-modified" },
+      { 0, NULL, NULL }
+    };
+
+    GType g_flags_type_id = g_flags_register_static(g_intern_static_string("AgsWorkStealingSchedulerFlags"), values);
+
+    g_once_init_leave(&g_flags_type_id__static, g_flags_type_id);
+  }
+
+  return(g_flags_type_id__static);
+}
+
+void
+ags_work_stealing_scheduler_class_init(AgsWorkStealingSchedulerClass *scheduler)
+{
+  GObjectClass *gobject;
+
+  GParamSpec *param_spec;
+
+  ags_work_stealing_scheduler_parent_class = g_type_class_peek_parent(scheduler);
+
+  /* GObjectClass */
+  gobject = (GObjectClass *) scheduler;
+
+  gobject->set_property = ags_work_stealing_scheduler_set_property;
+  gobject->get_property = ags_work_stealing_scheduler_get_property;
+
+  gobject->dispose = ags_work_stealing_scheduler_dispose;
+  gobject->finalize = ags_work_stealing_scheduler_finalize;
+
+  /* properties */
+  /**
+   * AgsWorkStealingScheduler:worker-count:
+   *
+   * The number of workers including the thread calling run.
+   *
+   * Since: 9.1.0
+   */
+  param_spec = g_param_spec_uint("worker-count",
+				 i18n_pspec("worker count"),
+				 i18n_pspec("The number of workers"),
+				 1,
+				 G_MAXUINT,
+				 1,
+				 G_PARAM_READWRITE | G_PARAM_CONSTRUCT_ONLY);
+  g_object_class_install_property(gobject,
+				  PROP_WORKER_COUNT,
+				  param_spec);
+}
+
+void
+ags_work_stealing_scheduler_init(AgsWorkStealingScheduler *scheduler)
+{
+  scheduler->flags = AGS_WORK_STEALING_SCHEDULER_RT;
+
+  /* work stealing scheduler mutex */
+  g_rec_mutex_init(&(scheduler->obj_mutex));
+
+  /* worker */
+  scheduler->worker_count = 0;
+  scheduler->worker = NULL;
+
+  scheduler->deque_mask = 0;
+
+  /* graph */
+  scheduler->node_count = 0;
+  scheduler->allocated_node_count = 0;
+  scheduler->node = NULL;
+
+  scheduler->remaining = 0;
+  scheduler->active_workers = 0;
+  scheduler->generation = 0;
+
+  g_mutex_init(&(scheduler->wakeup_mutex));
+  g_cond_init(&(scheduler->wakeup_cond));
+}
+
+void
+ags_work_stealing_scheduler_set_property(GObject *gobject,
+					 guint prop_id,
+					 const GValue *value,
+					 GParamSpec *param_spec)
+{
+  AgsWorkStealingScheduler *scheduler;
+
+  scheduler = AGS_WORK_STEALING_SCHEDULER(gobject);
+
+  switch(prop_id){
+  case PROP_WORKER_COUNT:
+    {
+      ags_work_stealing_scheduler_alloc_worker(scheduler,
+					       g_value_get_uint(value));
+    }
+    break;
+  default:
+    G_OBJECT_WARN_INVALID_PROPERTY_ID(gobject, prop_id, param_spec);
+    break;
+  }
+}
+
+void
+ags_work_stealing_scheduler_get_property(GObject *gobject,
+					 guint prop_id,
+					 GValue *value,
+					 GParamSpec *param_spec)
+{
+  AgsWorkStealingScheduler *scheduler;
+
+  scheduler = AGS_WORK_STEALING_SCHEDULER(gobject);
+
+  switch(prop_id){
+  case PROP_WORKER_COUNT:
+    {
+      g_value_set_uint(value, scheduler->worker_count);
+    }
+    break;
+  default:
+    G_OBJECT_WARN_INVALID_PROPERTY_ID(gobject, prop_id, param_spec);
+    break;
+  }
+}
+
+void
+ags_work_stealing_scheduler_dispose(GObject *gobject)
+{
+  AgsWorkStealingScheduler *scheduler;
+
+  scheduler = AGS_WORK_STEALING_SCHEDULER(gobject);
+
+  ags_work_stealing_scheduler_stop(scheduler);
+
+  /* call parent */
+  G_OBJECT_CLASS(ags_work_stealing_scheduler_parent_class)->dispose(gobject);
+}
+
+void
+ags_work_stealing_scheduler_finalize(GObject *gobject)
+{
+  AgsWorkStealingScheduler *scheduler;
+
+  guint i;
+
+  scheduler = AGS_WORK_STEALING_SCHEDULER(gobject);
+
+  ags_work_stealing_scheduler_stop(scheduler);
+
+  /* worker */
+  for(i = 0; i < scheduler->worker_count; i++){
+    g_free(scheduler->worker[i].deque);
+  }
+
+  g_free(scheduler->worker);
+
+  /* graph */
+  for(i = 0; i < scheduler->node_count; i++){
+    g_free(scheduler->node[i].successor);
+  }
+
+  g_free(scheduler->node);
+
+  g_mutex_clear(&(scheduler->wakeup_mutex));
+  g_cond_clear(&(scheduler->wakeup_cond));
+
+  /* call parent */
+  G_OBJECT_CLASS(ags_work_stealing_scheduler_parent_class)->finalize(gobject);
+}
+
+void
+ags_work_stealing_scheduler_alloc_worker(AgsWorkStealingScheduler *scheduler,
+					 guint worker_count)
+{
+  guint i;
+
+  if(worker_count == 0){
+    worker_count = 1;
+  }
+
+  scheduler->worker_count = worker_count;
+  scheduler->worker = g_new0(AgsWorkStealingWorker,
+			     worker_count);
+
+  for(i = 0; i < worker_count; i++){
+    scheduler->worker[i].scheduler = scheduler;
+
+    scheduler->worker[i].index = i;
+
+    scheduler->worker[i].thread = NULL;
+
+    scheduler->worker[i].top = 0;
+    scheduler->worker[i].bottom = 0;
+
+    scheduler->worker[i].deque = NULL;
+
+    scheduler->worker[i].random_state = 2166136261u ^ (i + 1);
+  }
+}
+
+/**
+ * ags_work_stealing_scheduler_test_flags:
+ * @scheduler: the #AgsWorkStealingScheduler
+ * @flags: the flags
+ *
+ * Test @flags to be set on @scheduler.
+ *
+ * Returns: %TRUE if flags are set, else %FALSE
+ *
+ * Since: 9.1.0
+ */
+gboolean
+ags_work_stealing_scheduler_test_flags(AgsWorkStealingScheduler *scheduler, guint flags)
+{
+  gboolean retval;
+
+  if(!AGS_IS_WORK_STEALING_SCHEDULER(scheduler)){
+    return(FALSE);
+  }
+
+  retval = ((flags & (ags_atomic_uint_get(&(scheduler->flags)))) != 0) ? TRUE: FALSE;
+
+  return(retval);
+}
+
+/**
+ * ags_work_stealing_scheduler_set_flags:
+ * @scheduler: the #AgsWorkStealingScheduler
+ * @flags: the flags
+ *
+ * Set flags.
+ *
+ * Since: 9.1.0
+ */
+void
+ags_work_stealing_scheduler_set_flags(AgsWorkStealingScheduler *scheduler, guint flags)
+{
+  if(!AGS_IS_WORK_STEALING_SCHEDULER(scheduler)){
+    return;
+  }
+
+  ags_atomic_uint_or(&(scheduler->flags),
+		     flags);
+}
+
+/**
+ * ags_work_stealing_scheduler_unset_flags:
+ * @scheduler: the #AgsWorkStealingScheduler
+ * @flags: the flags
+ *
+ * Unset flags.
+ *
+ * Since: 9.1.0
+ */
+void
+ags_work_stealing_scheduler_unset_flags(AgsWorkStealingScheduler *scheduler, guint flags)
+{
+  if(!AGS_IS_WORK_STEALING_SCHEDULER(scheduler)){
+    return;
+  }
+
+  ags_atomic_uint_and(&(scheduler->flags),
+		      (~flags));
+}
+
+/**
+ * ags_work_stealing_scheduler_get_worker_count:
+ * @scheduler: the #AgsWorkStealingScheduler
+ *
+ * Get worker count.
+ *
+ * Returns: the number of workers, including the thread calling ags_work_stealing_scheduler_run()
+ *
+ * Since: 9.1.0
+ */
+guint
+ags_work_stealing_scheduler_get_worker_count(AgsWorkStealingScheduler *scheduler)
+{
+  if(!AGS_IS_WORK_STEALING_SCHEDULER(scheduler)){
+    return(0);
+  }
+
+  return(scheduler->worker_count);
+}
+
+/**
+ * ags_work_stealing_scheduler_clear_graph:
+ * @scheduler: the #AgsWorkStealingScheduler
+ *
+ * Remove all nodes of the graph. Call it only from the thread calling
+ * ags_work_stealing_scheduler_run().
+ *
+ * Since: 9.1.0
+ */
+void
+ags_work_stealing_scheduler_clear_graph(AgsWorkStealingScheduler *scheduler)
+{
+  guint i;
+
+  g_return_if_fail(AGS_IS_WORK_STEALING_SCHEDULER(scheduler));
+
+  for(i = 0; i < scheduler->node_count; i++){
+    g_free(scheduler->node[i].successor);
+
+    scheduler->node[i].successor = NULL;
+    scheduler->node[i].successor_count = 0;
+  }
+
+  scheduler->node_count = 0;
+
+  ags_work_stealing_scheduler_set_flags(scheduler, AGS_WORK_STEALING_SCHEDULER_GRAPH_MODIFIED);
+}
+
+/**
+ * ags_work_stealing_scheduler_add_node:
+ * @scheduler: the #AgsWorkStealingScheduler
+ * @func: (scope notified): the #AgsWorkStealingFunc
+ * @data: the data passed to @func
+ *
+ * Add a node to the graph. Call it only from the thread calling
+ * ags_work_stealing_scheduler_run().
+ *
+ * Returns: the index of the node
+ *
+ * Since: 9.1.0
+ */
+guint
+ags_work_stealing_scheduler_add_node(AgsWorkStealingScheduler *scheduler,
+				     AgsWorkStealingFunc func, gpointer data)
+{
+  AgsWorkStealingNode *node;
+
+  guint index;
+
+  g_return_val_if_fail(AGS_IS_WORK_STEALING_SCHEDULER(scheduler), G_MAXUINT);
+  g_return_val_if_fail(func != NULL, G_MAXUINT);
+
+  if(scheduler->node_count == scheduler->allocated_node_count){
+    scheduler->allocated_node_count = (scheduler->allocated_node_count == 0) ? 16: 2 * scheduler->allocated_node_count;
+
+    scheduler->node = g_renew(AgsWorkStealingNode,
+			      scheduler->node,
+			      scheduler->allocated_node_count);
+  }
+
+  index = scheduler->node_count;
+
+  node = scheduler->node + index;
+
+  node->func = func;
+  node->data = data;
+
+  node->dependency_count = 0;
+  node->pending = 0;
+
+  node->successor_count = 0;
+  node->successor = NULL;
+
+  scheduler->node_count += 1;
+
+  ags_work_stealing_scheduler_set_flags(scheduler, AGS_WORK_STEALING_SCHEDULER_GRAPH_MODIFIED);
+
+  return(index);
+}
+
+/**
+ * ags_work_stealing_scheduler_add_dependency:
+ * @scheduler: the #AgsWorkStealingScheduler
+ * @node: the node index
+ * @dependency: the node index @node depends on
+ *
+ * Let @node be executed after @dependency completed. Duplicated
+ * dependencies are ignored, the graph is required to be acyclic.
+ *
+ * Since: 9.1.0
+ */
+void
+ags_work_stealing_scheduler_add_dependency(AgsWorkStealingScheduler *scheduler,
+					   guint node, guint dependency)
+{
+  AgsWorkStealingNode *dependency_node;
+
+  guint i;
+
+  g_return_if_fail(AGS_IS_WORK_STEALING_SCHEDULER(scheduler));
+  g_return_if_fail(node < scheduler->node_count);
+  g_return_if_fail(dependency < scheduler->node_count);
+  g_return_if_fail(node != dependency);
+
+  dependency_node = scheduler->node + dependency;
+
+  for(i = 0; i < dependency_node->successor_count; i++){
+    if(dependency_node->successor[i] == node){
+      return;
+    }
+  }
+
+  dependency_node->successor = g_renew(guint,
+				       dependency_node->successor,
+				       dependency_node->successor_count + 1);
+  dependency_node->successor[dependency_node->successor_count] = node;
+
+  dependency_node->successor_count += 1;
+
+  scheduler->node[node].dependency_count += 1;
+
+  ags_work_stealing_scheduler_set_flags(scheduler, AGS_WORK_STEALING_SCHEDULER_GRAPH_MODIFIED);
+}
+
+/**
+ * ags_work_stealing_scheduler_get_node_count:
+ * @scheduler: the #AgsWorkStealingScheduler
+ *
+ * Get node count.
+ *
+ * Returns: the number of nodes of the graph
+ *
+ * Since: 9.1.0
+ */
+guint
+ags_work_stealing_scheduler_get_node_count(AgsWorkStealingScheduler *scheduler)
+{
+  if(!AGS_IS_WORK_STEALING_SCHEDULER(scheduler)){
+    return(0);
+  }
+
+  return(scheduler->node_count);
+}
+
+void
+ags_work_stealing_worker_push(AgsWorkStealingWorker *worker,
+			      AgsWorkStealingNode *node)
+{
+  gint64 bottom;
+
+  bottom = ags_atomic_int64_get(&(worker->bottom));
+
+  ags_atomic_pointer_set(&(worker->deque[bottom & worker->scheduler->deque_mask]),
+			 node);
+
+  ags_atomic_int64_set(&(worker->bottom),
+		       bottom + 1);
+}
+
+AgsWorkStealingNode*
+ags_work_stealing_worker_pop(AgsWorkStealingWorker *worker)
+{
+  AgsWorkStealingNode *node;
+
+  gint64 top, bottom;
+
+  bottom = ags_atomic_int64_get(&(worker->bottom)) - 1;
+
+  ags_atomic_int64_set(&(worker->bottom),
+		       bottom);
+
+  ags_atomic_memory_barrier();
+
+  top = ags_atomic_int64_get(&(worker->top));
+
+  if(top > bottom){
+    /* empty */
+    ags_atomic_int64_set(&(worker->bottom),
+			 bottom + 1);
+
+    return(NULL);
+  }
+
+  node = ags_atomic_pointer_get(&(worker->deque[bottom & worker->scheduler->deque_mask]));
+
+  if(top == bottom){
+    /* last node - race against thieves */
+    if(!ags_atomic_int64_compare_and_exchange(&(worker->top),
+					      top, top + 1)){
+      node = NULL;
+    }
+
+    ags_atomic_int64_set(&(worker->bottom),
+			 bottom + 1);
+  }
+
+  return(node);
+}
+
+AgsWorkStealingNode*
+ags_work_stealing_worker_steal(AgsWorkStealingWorker *worker,
+			       AgsWorkStealingWorker *victim)
+{
+  AgsWorkStealingNode *node;
+
+  gint64 top, bottom;
+
+  top = ags_atomic_int64_get(&(victim->top));
+
+  ags_atomic_memory_barrier();
+
+  bottom = ags_atomic_int64_get(&(victim->bottom));
+
+  if(top >= bottom){
+    return(NULL);
+  }
+
+  node = ags_atomic_pointer_get(&(victim->deque[top & worker->scheduler->deque_mask]));
+
+  /* the indices grow monotonic, so a stale top fails here */
+  if(!ags_atomic_int64_compare_and_exchange(&(victim->top),
+					    top, top + 1)){
+    return(NULL);
+  }
+
+  worker->steal_count += 1;
+
+  return(node);
+}
+
+void
+ags_work_stealing_scheduler_execute(AgsWorkStealingScheduler *scheduler,
+				    AgsWorkStealingWorker *worker,
+				    AgsWorkStealingNode *node)
+{
+  guint i;
+
+  node->func(node->data);
+
+  worker->executed_count += 1;
+
+  /* release successors */
+  for(i = 0; i < node->successor_count; i++){
+    AgsWorkStealingNode *successor;
+
+    successor = scheduler->node + node->successor[i];
+
+    if(ags_atomic_int_decrement(&(successor->pending)) == 1){
+      /* acquire the writes of the other dependencies */
+      ags_atomic_memory_barrier();
+
+      ags_work_stealing_worker_push(worker,
+				    successor);
+    }
+  }
+
+  ags_atomic_int_decrement(&(scheduler->remaining));
+}
+
+void
+ags_work_stealing_scheduler_work(AgsWorkStealingScheduler *scheduler,
+				 AgsWorkStealingWorker *worker)
+{
+  AgsWorkStealingNode *node;
+
+  guint worker_count;
+  guint victim;
+  guint fail_count;
+
+  worker_count = scheduler->worker_count;
+
+  fail_count = 0;
+
+  while(ags_atomic_int_get(&(scheduler->remaining)) > 0){
+    node = ags_work_stealing_worker_pop(worker);
+
+    if(node == NULL &&
+       worker_count > 1){
+      /* xorshift victim selection */
+      worker->random_state ^= (worker->random_state << 13);
+      worker->random_state ^= (worker->random_state >> 17);
+      worker->random_state ^= (worker->random_state << 5);
+
+      victim = worker->random_state % worker_count;
+
+      if(victim == worker->index){
+	victim = (victim + 1) % worker_count;
+      }
+
+      node = ags_work_stealing_worker_steal(worker,
+					    scheduler->worker + victim);
+    }
+
+    if(node == NULL){
+      fail_count++;
+
+      if(fail_count >= AGS_WORK_STEALING_SCHEDULER_DEFAULT_SPIN_COUNT){
+	g_thread_yield();
+
+	fail_count = 0;
+      }
+
+      continue;
+    }
+
+    fail_count = 0;
+
+    ags_work_stealing_scheduler_execute(scheduler,
+					worker,
+					node);
+  }
+}
+
+void*
+ags_work_stealing_scheduler_worker_thread(void *ptr)
+{
+  AgsWorkStealingScheduler *scheduler;
+  AgsWorkStealingWorker *worker;
+
+  guint generation;
+  guint i;
+
+  worker = AGS_WORK_STEALING_WORKER(ptr);
+
+  scheduler = worker->scheduler;
+
+  /* real-time setup */
+#ifdef AGS_WITH_RT
+  if(ags_work_stealing_scheduler_test_flags(scheduler, AGS_WORK_STEALING_SCHEDULER_RT)){
+    AgsPriority *priority;
+
+    struct sched_param param;
+
+    gchar *str;
+
+    priority = ags_priority_get_instance();
+
+    /* Declare ourself as a real time task */
+    param.sched_priority = 45;
+
+    str = ags_priority_get_value(priority,
+				 AGS_PRIORITY_RT_THREAD,
+				 AGS_PRIORITY_KEY_AUDIO);
+
+    if(str != NULL){
+      param.sched_priority = (int) g_ascii_strtoull(str,
+						    NULL,
+						    10);
+    }
+
+    if(str == NULL ||
+       ((!g_ascii_strncasecmp(str,
+			      "0",
+			      2)) != TRUE)){
+      if(sched_setscheduler(0, SCHED_FIFO, &param) == -1) {
+	perror("sched_setscheduler failed");
+      }
+    }
+
+    g_free(str);
+  }
+#endif
+
+  generation = ags_atomic_uint_get(&(scheduler->generation));
+
+  while(ags_work_stealing_scheduler_test_flags(scheduler, AGS_WORK_STEALING_SCHEDULER_RUNNING)){
+    /* spin a little for the next run, then wait */
+    for(i = 0; i < AGS_WORK_STEALING_SCHEDULER_DEFAULT_SPIN_COUNT && generation == ags_atomic_uint_get(&(scheduler->generation)); i++);
+
+    if(generation == ags_atomic_uint_get(&(scheduler->generation))){
+      g_mutex_lock(&(scheduler->wakeup_mutex));
+
+      while(generation == ags_atomic_uint_get(&(scheduler->generation)) &&
+	    ags_work_stealing_scheduler_test_flags(scheduler, AGS_WORK_STEALING_SCHEDULER_RUNNING)){
+	g_cond_wait(&(scheduler->wakeup_cond),
+		    &(scheduler->wakeup_mutex));
+      }
+
+      g_mutex_unlock(&(scheduler->wakeup_mutex));
+    }
+
+    if(!ags_work_stealing_scheduler_test_flags(scheduler, AGS_WORK_STEALING_SCHEDULER_RUNNING)){
+      break;
+    }
+
+    generation = ags_atomic_uint_get(&(scheduler->generation));
+
+    ags_atomic_int_increment(&(scheduler->active_workers));
+
+    ags_work_stealing_scheduler_work(scheduler,
+				     worker);
+
+    ags_atomic_int_decrement(&(scheduler->active_workers));
+  }
+
+  return(NULL);
+}
+
+/**
+ * ags_work_stealing_scheduler_start:
+ * @scheduler: the #AgsWorkStealingScheduler
+ *
+ * Start the worker threads. The thread calling ags_work_stealing_scheduler_run()
+ * is worker 0, so worker count - 1 threads are spawned.
+ *
+ * Since: 9.1.0
+ */
+void
+ags_work_stealing_scheduler_start(AgsWorkStealingScheduler *scheduler)
+{
+  guint i;
+
+  g_return_if_fail(AGS_IS_WORK_STEALING_SCHEDULER(scheduler));
+
+  if(ags_work_stealing_scheduler_test_flags(scheduler, AGS_WORK_STEALING_SCHEDULER_RUNNING)){
+    return;
+  }
+
+  ags_work_stealing_scheduler_set_flags(scheduler, AGS_WORK_STEALING_SCHEDULER_RUNNING);
+
+  for(i = 1; i < scheduler->worker_count; i++){
+    scheduler->worker[i].thread = g_thread_new("ags-work-stealing",
+					       ags_work_stealing_scheduler_worker_thread,
+					       scheduler->worker + i);
+  }
+}
+
+/**
+ * ags_work_stealing_scheduler_stop:
+ * @scheduler: the #AgsWorkStealingScheduler
+ *
+ * Stop and join the worker threads.
+ *
+ * Since: 9.1.0
+ */
+void
+ags_work_stealing_scheduler_stop(AgsWorkStealingScheduler *scheduler)
+{
+  guint i;
+
+  g_return_if_fail(AGS_IS_WORK_STEALING_SCHEDULER(scheduler));
+
+  if(!ags_work_stealing_scheduler_test_flags(scheduler, AGS_WORK_STEALING_SCHEDULER_RUNNING)){
+    return;
+  }
+
+  g_mutex_lock(&(scheduler->wakeup_mutex));
+
+  ags_work_stealing_scheduler_unset_flags(scheduler, AGS_WORK_STEALING_SCHEDULER_RUNNING);
+
+  g_cond_broadcast(&(scheduler->wakeup_cond));
+
+  g_mutex_unlock(&(scheduler->wakeup_mutex));
+
+  for(i = 1; i < scheduler->worker_count; i++){
+    if(scheduler->worker[i].thread != NULL){
+      g_thread_join(scheduler->worker[i].thread);
+
+      scheduler->worker[i].thread = NULL;
+    }
+  }
+}
+
+/**
+ * ags_work_stealing_scheduler_run:
+ * @scheduler: the #AgsWorkStealingScheduler
+ *
+ * Execute all nodes of the graph once, respecting the dependencies.
+ * The calling thread participates as worker 0 and returns after the
+ * last node completed. If the scheduler is not started, the calling
+ * thread executes the whole graph.
+ *
+ * Since: 9.1.0
+ */
+void
+ags_work_stealing_scheduler_run(AgsWorkStealingScheduler *scheduler)
+{
+  AgsWorkStealingWorker *worker;
+
+  guint i;
+
+  g_return_if_fail(AGS_IS_WORK_STEALING_SCHEDULER(scheduler));
+
+  if(scheduler->node_count == 0){
+    return;
+  }
+
+  worker = scheduler->worker;
+
+  /* resize deques, no worker is accessing them anymore */
+  if(ags_work_stealing_scheduler_test_flags(scheduler, AGS_WORK_STEALING_SCHEDULER_GRAPH_MODIFIED)){
+    guint deque_size;
+
+    while(ags_atomic_int_get(&(scheduler->active_workers)) > 0){
+      g_thread_yield();
+    }
+
+    deque_size = 16;
+
+    while(deque_size < scheduler->node_count){
+      deque_size *= 2;
+    }
+
+    if(deque_size != scheduler->deque_mask + 1 ||
+       worker[0].deque == NULL){
+      for(i = 0; i < scheduler->worker_count; i++){
+	g_free(worker[i].deque);
+
+	worker[i].deque = g_new0(AgsWorkStealingNode *,
+				 deque_size);
+
+	ags_atomic_int64_set(&(worker[i].top),
+			     0);
+	ags_atomic_int64_set(&(worker[i].bottom),
+			     0);
+      }
+
+      scheduler->deque_mask = deque_size - 1;
+    }
+
+    ags_work_stealing_scheduler_unset_flags(scheduler, AGS_WORK_STEALING_SCHEDULER_GRAPH_MODIFIED);
+  }
+
+  /* reset */
+  for(i = 0; i < scheduler->node_count; i++){
+    ags_atomic_int_set(&(scheduler->node[i].pending),
+		       scheduler->node[i].dependency_count);
+  }
+
+  ags_atomic_int_set(&(scheduler->remaining),
+		     scheduler->node_count);
+
+  /* push roots */
+  for(i = 0; i < scheduler->node_count; i++){
+    if(scheduler->node[i].dependency_count == 0){
+      ags_work_stealing_worker_push(worker,
+				    scheduler->node + i);
+    }
+  }
+
+  /* wake up workers */
+  if(ags_work_stealing_scheduler_test_flags(scheduler, AGS_WORK_STEALING_SCHEDULER_RUNNING) &&
+     scheduler->worker_count > 1){
+    g_mutex_lock(&(scheduler->wakeup_mutex));
+
+    ags_atomic_uint_increment(&(scheduler->generation));
+
+    g_cond_broadcast(&(scheduler->wakeup_cond));
+
+    g_mutex_unlock(&(scheduler->wakeup_mutex));
+  }
+
+  ags_work_stealing_scheduler_work(scheduler,
+				   worker);
+}
+
+/**
+ * ags_work_stealing_scheduler_new:
+ * @worker_count: the number of workers or 0 for one per processor
+ *
+ * Create a new instance of #AgsWorkStealingScheduler.
+ *
+ * Returns: the new #AgsWorkStealingScheduler
+ *
+ * Since: 9.1.0
+ */
+AgsWorkStealingScheduler*
+ags_work_stealing_scheduler_new(guint worker_count)
+{
+  AgsWorkStealingScheduler *scheduler;
+
+  if(worker_count == 0){
+    worker_count = g_get_num_processors();
+  }
+
+  scheduler = (AgsWorkStealingScheduler *) g_object_new(AGS_TYPE_WORK_STEALING_SCHEDULER,
+							"worker-count", worker_count,
+							NULL);
+
+  return(scheduler);
+}
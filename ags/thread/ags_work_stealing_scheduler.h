@@ -0,0 +1,183 @@
+/* GSequencer - Advanced GTK Sequencer
+ * Copyright (C) 2005-2026 Joël Krähemann
+ *
+ * This file is part of GSequencer.
+ *
+ * GSequencer is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GSequencer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GSequencer.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __AGS_WORK_STEALING_SCHEDULER_H__
+#define __AGS_WORK_STEALING_SCHEDULER_H__
+
+#include <glib.h>
+#include <glib-object.h>
+
+#include <ags/thread/ags_atomic.h>
+
+G_BEGIN_DECLS
+
+#define AGS_TYPE_WORK_STEALING_SCHEDULER                (ags_work_stealing_scheduler_get_type())
+#define AGS_TYPE_WORK_STEALING_SCHEDULER_FLAGS          (ags_work_stealing_scheduler_flags_get_type())
+#define AGS_WORK_STEALING_SCHEDULER(obj)                (G_TYPE_CHECK_INSTANCE_CAST((obj), AGS_TYPE_WORK_STEALING_SCHEDULER, AgsWorkStealingScheduler))
+#define AGS_WORK_STEALING_SCHEDULER_CLASS(class)        (G_TYPE_CHECK_CLASS_CAST(class, AGS_TYPE_WORK_STEALING_SCHEDULER, AgsWorkStealingSchedulerClass))
+#define AGS_IS_WORK_STEALING_SCHEDULER(obj)             (G_TYPE_CHECK_INSTANCE_TYPE ((obj), AGS_TYPE_WORK_STEALING_SCHEDULER))
+#define AGS_IS_WORK_STEALING_SCHEDULER_CLASS(class)     (G_TYPE_CHECK_CLASS_TYPE ((class), AGS_TYPE_WORK_STEALING_SCHEDULER))
+#define AGS_WORK_STEALING_SCHEDULER_GET_CLASS(obj)      (G_TYPE_INSTANCE_GET_CLASS(obj, AGS_TYPE_WORK_STEALING_SCHEDULER, AgsWorkStealingSchedulerClass))
+
+#define AGS_WORK_STEALING_SCHEDULER_GET_OBJ_MUTEX(obj) (&(((AgsWorkStealingScheduler *) obj)->obj_mutex))
+
+#define AGS_WORK_STEALING_NODE(ptr) ((AgsWorkStealingNode *)(ptr))
+#define AGS_WORK_STEALING_WORKER(ptr) ((AgsWorkStealingWorker *)(ptr))
+
+#define AGS_WORK_STEALING_SCHEDULER_DEFAULT_SPIN_COUNT (1024)
+
+typedef struct _AgsWorkStealingScheduler AgsWorkStealingScheduler;
+typedef struct _AgsWorkStealingSchedulerClass AgsWorkStealingSchedulerClass;
+typedef struct _AgsWorkStealingNode AgsWorkStealingNode;
+typedef struct _AgsWorkStealingWorker AgsWorkStealingWorker;
+
+typedef void (*AgsWorkStealingFunc)(gpointer data);
+
+/**
+ * AgsWorkStealingSchedulerFlags:
+ * @AGS_WORK_STEALING_SCHEDULER_RUNNING: the worker threads are running
+ * @AGS_WORK_STEALING_SCHEDULER_RT: the worker threads request realtime scheduling
+ * @AGS_WORK_STEALING_SCHEDULER_GRAPH_MODIFIED: the graph was modified since last run
+ *
+ * Enum values to control the behavior or indicate internal state of #AgsWorkStealingScheduler by
+ * enable/disable as flags.
+ */
+typedef enum{
+  AGS_WORK_STEALING_SCHEDULER_RUNNING           = 1,
+  AGS_WORK_STEALING_SCHEDULER_RT                = 1 <<  1,
+  AGS_WORK_STEALING_SCHEDULER_GRAPH_MODIFIED    = 1 <<  2,
+}AgsWorkStealingSchedulerFlags;
+
+/**
+ * AgsWorkStealingNode:
+ * @func: the function to invoke
+ * @data: the data passed to @func
+ * @dependency_count: the number of nodes this node depends on
+ * @pending: the number of dependencies not completed during current run
+ * @successor_count: the number of successors
+ * @successor: (array length=successor_count): the node indices depending on this node
+ *
+ * A node of the directed acyclic graph executed by #AgsWorkStealingScheduler.
+ */
+struct _AgsWorkStealingNode
+{
+  AgsWorkStealingFunc func;
+  gpointer data;
+
+  guint dependency_count;
+  volatile gint pending;
+
+  guint successor_count;
+  guint *successor;
+};
+
+/**
+ * AgsWorkStealingWorker:
+ * @scheduler: the #AgsWorkStealingScheduler
+ * @index: the worker index, 0 is the thread calling ags_work_stealing_scheduler_run()
+ * @thread: the #GThread or %NULL for index 0
+ * @top: the deque's top, stolen by other workers
+ * @bottom: the deque's bottom, owned by this worker
+ * @deque: the deque's ring buffer
+ * @random_state: the victim selection state
+ * @executed_count: the number of nodes executed
+ * @steal_count: the number of nodes stolen of other workers
+ *
+ * A worker of #AgsWorkStealingScheduler owning a Chase-Lev deque.
+ */
+struct _AgsWorkStealingWorker
+{
+  AgsWorkStealingScheduler *scheduler;
+
+  guint index;
+
+  GThread *thread;
+
+  volatile gint64 top;
+  volatile gint64 bottom;
+
+  AgsWorkStealingNode **deque;
+
+  guint random_state;
+
+  guint64 executed_count;
+  guint64 steal_count;
+};
+
+struct _AgsWorkStealingScheduler
+{
+  GObject gobject;
+
+  volatile guint flags;
+
+  GRecMutex obj_mutex;
+
+  guint worker_count;
+  AgsWorkStealingWorker *worker;
+
+  guint deque_mask;
+
+  guint node_count;
+  guint allocated_node_count;
+  AgsWorkStealingNode *node;
+
+  volatile gint remaining;
+  volatile gint active_workers;
+  volatile guint generation;
+
+  GMutex wakeup_mutex;
+  GCond wakeup_cond;
+};
+
+struct _AgsWorkStealingSchedulerClass
+{
+  GObjectClass gobject;
+};
+
+GType ags_work_stealing_scheduler_get_type();
+GType ags_work_stealing_scheduler_flags_get_type();
+
+gboolean ags_work_stealing_scheduler_test_flags(AgsWorkStealingScheduler *scheduler, guint flags);
+void ags_work_stealing_scheduler_set_flags(AgsWorkStealingScheduler *scheduler, guint flags);
+void ags_work_stealing_scheduler_unset_flags(AgsWorkStealingScheduler *scheduler, guint flags);
+
+guint ags_work_stealing_scheduler_get_worker_count(AgsWorkStealingScheduler *scheduler);
+
+/* graph */
+void ags_work_stealing_scheduler_clear_graph(AgsWorkStealingScheduler *scheduler);
+
+guint ags_work_stealing_scheduler_add_node(AgsWorkStealingScheduler *scheduler,
+					   AgsWorkStealingFunc func, gpointer data);
+void ags_work_stealing_scheduler_add_dependency(AgsWorkStealingScheduler *scheduler,
+						guint node, guint dependency);
+
+guint ags_work_stealing_scheduler_get_node_count(AgsWorkStealingScheduler *scheduler);
+
+/* run */
+void ags_work_stealing_scheduler_start(AgsWorkStealingScheduler *scheduler);
+void ags_work_stealing_scheduler_stop(AgsWorkStealingScheduler *scheduler);
+
+void ags_work_stealing_scheduler_run(AgsWorkStealingScheduler *scheduler);
+
+/* instantiate */
+AgsWorkStealingScheduler* ags_work_stealing_scheduler_new(guint worker_count);
+
+G_END_DECLS
+
+#endif /*__AGS_WORK_STEALING_SCHEDULER_H__*/
@@ -0,0 +1,42 @@
+# Copyright (C) 2005-2026 Joel Kraehemann
+# 
+# Copying and distribution of this file, with or without modification,
+# are permitted in any medium without royalty provided the copyright
+# notice and this notice are preserved.  This file is offered as-is,
+# without any warranty.
+
+# benchmarks - built and run by `make bench`
+EXTRA_PROGRAMS = \
+	ags_dsp_util_bench
+
+# DSP utility benchmark
+ags_dsp_util_bench_SOURCES = ags/test/bench/ags_dsp_util_bench.c ags/test/bench/ags_bench_report.c ags/test/bench/ags_bench_report.h
+ags_dsp_util_bench_CFLAGS = $(CFLAGS) $(UNIT_TEST_CFLAGS) $(LIBAO_CFLAGS) $(LIBASOUND2_CFLAGS) $(LIBDSSIALSACOMPAT_CFLAGS) $(LIBXML2_CFLAGS) $(SNDFILE_CFLAGS) $(LIBINSTPATCH_CFLAGS) $(JSON_GLIB_CFLAGS) $(GOBJECT_CFLAGS) $(LIBSOUP_CFLAGS) $(JACK_CFLAGS) $(GSTREAMER_CFLAGS)
+ags_dsp_util_bench_LDFLAGS = -pthread $(LDFLAGS)
+ags_dsp_util_bench_LDADD = libags_audio.la libags_server.la libags_thread.la libags.la libags_thread.la -lm $(LIBAO_LIBS) $(LIBASOUND2_LIBS) $(LIBXML2_LIBS) $(SNDFILE_LIBS) $(LIBINSTPATCH_LIBS) $(JSON_GLIB_LIBS) $(GOBJECT_LIBS) $(LIBSOUP_LIBS) $(JACK_LIBS) $(GSTREAMER_LIBS)
+
+# render benchmark - needs the functional test harness
+if RUN_FUNCTIONAL_TESTS
+EXTRA_PROGRAMS += \
+	ags_render_bench
+
+ags_render_bench_SOURCES = ags/test/bench/ags_render_bench.c ags/test/bench/ags_bench_report.c ags/test/bench/ags_bench_report.h
+ags_render_bench_CFLAGS = $(CFLAGS) $(FUNCTIONAL_TEST_CFLAGS) $(FUNCTIONAL_UI_TEST_CFLAGS)
+ags_render_bench_CPPFLAGS = -DAGS_SRC_DIR=\"$(srcdir)\" -DAGS_DATA_DIR=\"gsequencer.share\"
+ags_render_bench_LDFLAGS = -pthread $(LDFLAGS)
+ags_render_bench_LDADD = $(gsequencer_functional_test_LDADD)
+
+RENDER_BENCH = ags_render_bench$(EXEEXT)
+else
+RENDER_BENCH =
+endif
+
+bench: $(EXTRA_PROGRAMS)
+	./ags_dsp_util_bench$(EXEEXT) --baseline $(top_srcdir)/ags/test/bench/ags_dsp_util_bench_baseline.json
+	test -z "$(RENDER_BENCH)" || ./$(RENDER_BENCH) --baseline $(top_srcdir)/ags/test/bench/ags_render_bench_baseline.json
+
+bench-baseline: $(EXTRA_PROGRAMS)
+	./ags_dsp_util_bench$(EXEEXT) --output $(top_srcdir)/ags/test/bench/ags_dsp_util_bench_baseline.json
+	test -z "$(RENDER_BENCH)" || ./$(RENDER_BENCH) --output $(top_srcdir)/ags/test/bench/ags_render_bench_baseline.json
+
+.PHONY: bench bench-baseline
@@ -21,10 +21,13 @@ check_LTLIBRARIES = libgsequencer_test.la
 check_PROGRAMS += \
 	ags_functional_server_test \
 	ags_functional_frame_clock_test \
+	ags_functional_work_stealing_scheduler_test \
 	ags_functional_audio_test \
 	ags_functional_pitch_test \
 	ags_functional_fast_pitch_test \
 	ags_functional_fourier_transform_test \
+	ags_functional_scratch_arena_test \
+	ags_functional_audio_buffer_kernel_test \
 	ags_functional_osc_server_test \
 	ags_functional_osc_xmlrpc_server_test \
 	ags_functional_machine_add_and_destroy_test \
@@ -94,6 +97,12 @@ ags_functional_frame_clock_test_CFLAGS = $(CFLAGS) $(FUNCTIONAL_TEST_CFLAGS) $(F
 ags_functional_frame_clock_test_LDFLAGS = -pthread $(LDFLAGS)
 ags_functional_frame_clock_test_LDADD = $(gsequencer_functional_test_LDADD)
 
+# functional work stealing scheduler test
+ags_functional_work_stealing_scheduler_test_SOURCES = ags/test/thread/ags_functional_work_stealing_scheduler_test.c
+ags_functional_work_stealing_scheduler_test_CFLAGS = $(CFLAGS) $(FUNCTIONAL_TEST_CFLAGS) $(LIBXML2_CFLAGS) $(GOBJECT_CFLAGS) $(LIBSOUP_CFLAGS)
+ags_functional_work_stealing_scheduler_test_LDFLAGS = -pthread $(LDFLAGS)
+ags_functional_work_stealing_scheduler_test_LDADD = libags_server.la libags_thread.la libags.la libags_thread.la -lcunit  -lm $(LIBXML2_LIBS) $(GOBJECT_LIBS) $(LIBSOUP_LIBS)
+
 # functional audio test
 ags_functional_audio_test_SOURCES = ags/test/audio/ags_functional_audio_test.c
 ags_functional_audio_test_CFLAGS = $(CFLAGS) $(FUNCTIONAL_TEST_CFLAGS) $(FUNCTIONAL_AUDIO_TEST_CFLAGS)
@@ -118,6 +127,18 @@ ags_functional_fourier_transform_test_CFLAGS = $(CFLAGS) $(FUNCTIONAL_TEST_CFLAG
 ags_functional_fourier_transform_test_LDFLAGS = -pthread $(LDFLAGS)
 ags_functional_fourier_transform_test_LDADD = $(gsequencer_functional_test_LDADD)
 
+# functional scratch arena test
+ags_functional_scratch_arena_test_SOURCES = ags/test/audio/ags_functional_scratch_arena_test.c
+ags_functional_scratch_arena_test_CFLAGS = $(CFLAGS) $(FUNCTIONAL_TEST_CFLAGS) $(LIBAO_CFLAGS) $(LIBASOUND2_CFLAGS) $(LIBDSSIALSACOMPAT_CFLAGS) $(LIBXML2_CFLAGS) $(SNDFILE_CFLAGS) $(LIBINSTPATCH_CFLAGS) $(JSON_GLIB_CFLAGS) $(GOBJECT_CFLAGS) $(LIBSOUP_CFLAGS) $(JACK_CFLAGS) $(GSTREAMER_CFLAGS)
+ags_functional_scratch_arena_test_LDFLAGS = -pthread $(LDFLAGS)
+ags_functional_scratch_arena_test_LDADD = libags_audio.la libags_server.la libags_thread.la libags.la libags_thread.la -lcunit  -lm $(LIBAO_LIBS) $(LIBASOUND2_LIBS) $(LIBXML2_LIBS) $(SNDFILE_LIBS) $(LIBINSTPATCH_LIBS) $(JSON_GLIB_LIBS) $(GOBJECT_LIBS) $(LIBSOUP_LIBS) $(JACK_LIBS) $(GSTREAMER_LIBS)
+
+# functional audio buffer kernel test
+ags_functional_audio_buffer_kernel_test_SOURCES = ags/test/audio/ags_functional_audio_buffer_kernel_test.c
+ags_functional_audio_buffer_kernel_test_CFLAGS = $(CFLAGS) $(FUNCTIONAL_TEST_CFLAGS) $(LIBAO_CFLAGS) $(LIBASOUND2_CFLAGS) $(LIBDSSIALSACOMPAT_CFLAGS) $(LIBXML2_CFLAGS) $(SNDFILE_CFLAGS) $(LIBINSTPATCH_CFLAGS) $(JSON_GLIB_CFLAGS) $(GOBJECT_CFLAGS) $(LIBSOUP_CFLAGS) $(JACK_CFLAGS) $(GSTREAMER_CFLAGS)
+ags_functional_audio_buffer_kernel_test_LDFLAGS = -pthread $(LDFLAGS)
+ags_functional_audio_buffer_kernel_test_LDADD = libags_audio.la libags_server.la libags_thread.la libags.la libags_thread.la -lcunit  -lm $(LIBAO_LIBS) $(LIBASOUND2_LIBS) $(LIBXML2_LIBS) $(SNDFILE_LIBS) $(LIBINSTPATCH_LIBS) $(JSON_GLIB_LIBS) $(GOBJECT_LIBS) $(LIBSOUP_LIBS) $(JACK_LIBS) $(GSTREAMER_LIBS)
+
 # functional osc server test
 ags_functional_osc_server_test_SOURCES = ags/test/audio/osc/ags_functional_osc_server_test.c
 ags_functional_osc_server_test_CFLAGS = $(CFLAGS) $(FUNCTIONAL_TEST_CFLAGS) $(FUNCTIONAL_AUDIO_TEST_CFLAGS)
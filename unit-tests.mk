@@ -34,6 +34,11 @@ check_PROGRAMS += \
 	ags_tactable_test \
 	ags_concurrency_provider_test \
 	ags_destroy_worker_test \
+	ags_work_stealing_scheduler_test \
+	ags_ring_buffer_test \
+	ags_trace_test \
+	ags_tic_barrier_test \
+	ags_epoch_reclaimer_test \
 	ags_frame_clock_test \
 	ags_generic_main_loop_test \
 	ags_message_delivery_test \
@@ -100,6 +105,10 @@ check_PROGRAMS += \
 	ags_output_test \
 	ags_recycling_test \
 	ags_audio_signal_test \
+	ags_audio_signal_pool_test \
+	ags_scratch_arena_test \
+	ags_audio_buffer_kernel_test \
+	ags_offline_devout_test \
 	ags_audio_buffer_util_test \
 	ags_char_buffer_util_test \
 	ags_envelope_util_test \
@@ -118,13 +127,22 @@ check_PROGRAMS += \
 	ags_recall_dependency_test \
 	ags_recall_id_test \
 	ags_recall_recycling_test \
+	ags_recall_snapshot_test \
+	ags_recall_profiler_test \
+	ags_tempo_map_test \
+	ags_timestamp_index_test \
+	ags_wave_storage_test \
+	ags_wave_stream_test \
+	ags_wave_peak_test \
 	ags_recycling_context_test \
 	ags_synth_generator_test \
 	ags_port_test \
 	ags_pattern_test \
 	ags_notation_test \
 	ags_note_test \
+	ags_note_index_test \
 	ags_automation_test \
+	ags_automation_cursor_test \
 	ags_acceleration_test \
 	ags_wave_test \
 	ags_buffer_test \
@@ -458,6 +476,36 @@ ags_destroy_worker_test_CFLAGS = $(CFLAGS) $(UNIT_TEST_CFLAGS) $(LIBXML2_CFLAGS)
 ags_destroy_worker_test_LDFLAGS = -pthread $(LDFLAGS)
 ags_destroy_worker_test_LDADD = libags_server.la libags_thread.la libags.la libags_thread.la -lcunit  -lm $(LIBXML2_LIBS) $(GOBJECT_LIBS) $(LIBSOUP_LIBS)
 
+# work stealing scheduler unit test
+ags_work_stealing_scheduler_test_SOURCES = ags/test/thread/ags_work_stealing_scheduler_test.c
+ags_work_stealing_scheduler_test_CFLAGS = $(CFLAGS) $(UNIT_TEST_CFLAGS) $(LIBXML2_CFLAGS) $(GOBJECT_CFLAGS) $(LIBSOUP_CFLAGS)
+ags_work_stealing_scheduler_test_LDFLAGS = -pthread $(LDFLAGS)
+ags_work_stealing_scheduler_test_LDADD = libags_server.la libags_thread.la libags.la libags_thread.la -lcunit  -lm $(LIBXML2_LIBS) $(GOBJECT_LIBS) $(LIBSOUP_LIBS)
+
+# ring buffer unit test
+ags_ring_buffer_test_SOURCES = ags/test/thread/ags_ring_buffer_test.c
+ags_ring_buffer_test_CFLAGS = $(CFLAGS) $(UNIT_TEST_CFLAGS) $(LIBXML2_CFLAGS) $(GOBJECT_CFLAGS) $(LIBSOUP_CFLAGS)
+ags_ring_buffer_test_LDFLAGS = -pthread $(LDFLAGS)
+ags_ring_buffer_test_LDADD = libags_server.la libags_thread.la libags.la libags_thread.la -lcunit  -lm $(LIBXML2_LIBS) $(GOBJECT_LIBS) $(LIBSOUP_LIBS)
+
+# trace unit test
+ags_trace_test_SOURCES = ags/test/thread/ags_trace_test.c
+ags_trace_test_CFLAGS = $(CFLAGS) $(UNIT_TEST_CFLAGS) $(LIBXML2_CFLAGS) $(GOBJECT_CFLAGS) $(LIBSOUP_CFLAGS)
+ags_trace_test_LDFLAGS = -pthread $(LDFLAGS)
+ags_trace_test_LDADD = libags_server.la libags_thread.la libags.la libags_thread.la -lcunit  -lm $(LIBXML2_LIBS) $(GOBJECT_LIBS) $(LIBSOUP_LIBS)
+
+# tic barrier unit test
+ags_tic_barrier_test_SOURCES = ags/test/thread/ags_tic_barrier_test.c
+ags_tic_barrier_test_CFLAGS = $(CFLAGS) $(UNIT_TEST_CFLAGS) $(LIBXML2_CFLAGS) $(GOBJECT_CFLAGS) $(LIBSOUP_CFLAGS)
+ags_tic_barrier_test_LDFLAGS = -pthread $(LDFLAGS)
+ags_tic_barrier_test_LDADD = libags_server.la libags_thread.la libags.la libags_thread.la -lcunit  -lm $(LIBXML2_LIBS) $(GOBJECT_LIBS) $(LIBSOUP_LIBS)
+
+# epoch reclaimer unit test
+ags_epoch_reclaimer_test_SOURCES = ags/test/thread/ags_epoch_reclaimer_test.c
+ags_epoch_reclaimer_test_CFLAGS = $(CFLAGS) $(UNIT_TEST_CFLAGS) $(LIBXML2_CFLAGS) $(GOBJECT_CFLAGS) $(LIBSOUP_CFLAGS)
+ags_epoch_reclaimer_test_LDFLAGS = -pthread $(LDFLAGS)
+ags_epoch_reclaimer_test_LDADD = libags_server.la libags_thread.la libags.la libags_thread.la -lcunit  -lm $(LIBXML2_LIBS) $(GOBJECT_LIBS) $(LIBSOUP_LIBS)
+
 # frame clock unit test
 ags_frame_clock_test_SOURCES = ags/test/thread/ags_frame_clock_test.c
 ags_frame_clock_test_CFLAGS = $(CFLAGS) $(UNIT_TEST_CFLAGS) $(LIBXML2_CFLAGS) $(GOBJECT_CFLAGS) $(LIBSOUP_CFLAGS)
@@ -824,6 +872,30 @@ ags_audio_signal_test_CFLAGS = $(CFLAGS) $(UNIT_TEST_CFLAGS) $(LIBAO_CFLAGS) $(L
 ags_audio_signal_test_LDFLAGS = -pthread $(LDFLAGS)
 ags_audio_signal_test_LDADD = libags_audio.la libags_server.la libags_thread.la libags.la libags_thread.la -lcunit  -lm $(LIBAO_LIBS) $(LIBASOUND2_LIBS) $(LIBXML2_LIBS) $(SNDFILE_LIBS) $(LIBINSTPATCH_LIBS) $(JSON_GLIB_LIBS) $(GOBJECT_LIBS) $(LIBSOUP_LIBS) $(JACK_LIBS) $(GSTREAMER_LIBS)
 
+# audio signal pool unit test
+ags_audio_signal_pool_test_SOURCES = ags/test/audio/ags_audio_signal_pool_test.c
+ags_audio_signal_pool_test_CFLAGS = $(CFLAGS) $(UNIT_TEST_CFLAGS) $(LIBAO_CFLAGS) $(LIBASOUND2_CFLAGS) $(LIBDSSIALSACOMPAT_CFLAGS) $(LIBXML2_CFLAGS) $(SNDFILE_CFLAGS) $(LIBINSTPATCH_CFLAGS) $(JSON_GLIB_CFLAGS) $(GOBJECT_CFLAGS) $(LIBSOUP_CFLAGS) $(JACK_CFLAGS) $(GSTREAMER_CFLAGS)
+ags_audio_signal_pool_test_LDFLAGS = -pthread $(LDFLAGS)
+ags_audio_signal_pool_test_LDADD = libags_audio.la libags_server.la libags_thread.la libags.la libags_thread.la -lcunit  -lm $(LIBAO_LIBS) $(LIBASOUND2_LIBS) $(LIBXML2_LIBS) $(SNDFILE_LIBS) $(LIBINSTPATCH_LIBS) $(JSON_GLIB_LIBS) $(GOBJECT_LIBS) $(LIBSOUP_LIBS) $(JACK_LIBS) $(GSTREAMER_LIBS)
+
+# scratch arena unit test
+ags_scratch_arena_test_SOURCES = ags/test/audio/ags_scratch_arena_test.c
+ags_scratch_arena_test_CFLAGS = $(CFLAGS) $(UNIT_TEST_CFLAGS) $(LIBAO_CFLAGS) $(LIBASOUND2_CFLAGS) $(LIBDSSIALSACOMPAT_CFLAGS) $(LIBXML2_CFLAGS) $(SNDFILE_CFLAGS) $(LIBINSTPATCH_CFLAGS) $(JSON_GLIB_CFLAGS) $(GOBJECT_CFLAGS) $(LIBSOUP_CFLAGS) $(JACK_CFLAGS) $(GSTREAMER_CFLAGS)
+ags_scratch_arena_test_LDFLAGS = -pthread $(LDFLAGS)
+ags_scratch_arena_test_LDADD = libags_audio.la libags_server.la libags_thread.la libags.la libags_thread.la -lcunit  -lm $(LIBAO_LIBS) $(LIBASOUND2_LIBS) $(LIBXML2_LIBS) $(SNDFILE_LIBS) $(LIBINSTPATCH_LIBS) $(JSON_GLIB_LIBS) $(GOBJECT_LIBS) $(LIBSOUP_LIBS) $(JACK_LIBS) $(GSTREAMER_LIBS)
+
+# audio buffer kernel unit test
+ags_audio_buffer_kernel_test_SOURCES = ags/test/audio/ags_audio_buffer_kernel_test.c
+ags_audio_buffer_kernel_test_CFLAGS = $(CFLAGS) $(UNIT_TEST_CFLAGS) $(LIBAO_CFLAGS) $(LIBASOUND2_CFLAGS) $(LIBDSSIALSACOMPAT_CFLAGS) $(LIBXML2_CFLAGS) $(SNDFILE_CFLAGS) $(LIBINSTPATCH_CFLAGS) $(JSON_GLIB_CFLAGS) $(GOBJECT_CFLAGS) $(LIBSOUP_CFLAGS) $(JACK_CFLAGS) $(GSTREAMER_CFLAGS)
+ags_audio_buffer_kernel_test_LDFLAGS = -pthread $(LDFLAGS)
+ags_audio_buffer_kernel_test_LDADD = libags_audio.la libags_server.la libags_thread.la libags.la libags_thread.la -lcunit  -lm $(LIBAO_LIBS) $(LIBASOUND2_LIBS) $(LIBXML2_LIBS) $(SNDFILE_LIBS) $(LIBINSTPATCH_LIBS) $(JSON_GLIB_LIBS) $(GOBJECT_LIBS) $(LIBSOUP_LIBS) $(JACK_LIBS) $(GSTREAMER_LIBS)
+
+# offline devout unit test
+ags_offline_devout_test_SOURCES = ags/test/audio/ags_offline_devout_test.c
+ags_offline_devout_test_CFLAGS = $(CFLAGS) $(UNIT_TEST_CFLAGS) $(LIBAO_CFLAGS) $(LIBASOUND2_CFLAGS) $(LIBDSSIALSACOMPAT_CFLAGS) $(LIBXML2_CFLAGS) $(SNDFILE_CFLAGS) $(LIBINSTPATCH_CFLAGS) $(JSON_GLIB_CFLAGS) $(GOBJECT_CFLAGS) $(LIBSOUP_CFLAGS) $(JACK_CFLAGS) $(GSTREAMER_CFLAGS)
+ags_offline_devout_test_LDFLAGS = -pthread $(LDFLAGS)
+ags_offline_devout_test_LDADD = libags_audio.la libags_server.la libags_thread.la libags.la libags_thread.la -lcunit  -lm $(LIBAO_LIBS) $(LIBASOUND2_LIBS) $(LIBXML2_LIBS) $(SNDFILE_LIBS) $(LIBINSTPATCH_LIBS) $(JSON_GLIB_LIBS) $(GOBJECT_LIBS) $(LIBSOUP_LIBS) $(JACK_LIBS) $(GSTREAMER_LIBS)
+
 # audio buffer util unit test
 ags_audio_buffer_util_test_SOURCES = ags/test/audio/ags_audio_buffer_util_test.c
 ags_audio_buffer_util_test_CFLAGS = $(CFLAGS) $(UNIT_TEST_CFLAGS) $(LIBAO_CFLAGS) $(LIBASOUND2_CFLAGS) $(LIBDSSIALSACOMPAT_CFLAGS) $(LIBXML2_CFLAGS) $(SNDFILE_CFLAGS) $(LIBINSTPATCH_CFLAGS) $(JSON_GLIB_CFLAGS) $(GOBJECT_CFLAGS) $(LIBSOUP_CFLAGS) $(JACK_CFLAGS) $(GSTREAMER_CFLAGS)
@@ -932,6 +1004,48 @@ ags_recall_recycling_test_CFLAGS = $(CFLAGS) $(UNIT_TEST_CFLAGS) $(LIBAO_CFLAGS)
 ags_recall_recycling_test_LDFLAGS = -pthread $(LDFLAGS)
 ags_recall_recycling_test_LDADD = libags_audio.la libags_server.la libags_thread.la libags.la libags_thread.la -lcunit  -lm $(LIBAO_LIBS) $(LIBASOUND2_LIBS) $(LIBXML2_LIBS) $(SNDFILE_LIBS) $(LIBINSTPATCH_LIBS) $(JSON_GLIB_LIBS) $(GOBJECT_LIBS) $(LIBSOUP_LIBS) $(JACK_LIBS) $(GSTREAMER_LIBS)
 
+# recall snapshot unit test
+ags_recall_snapshot_test_SOURCES = ags/test/audio/ags_recall_snapshot_test.c
+ags_recall_snapshot_test_CFLAGS = $(CFLAGS) $(UNIT_TEST_CFLAGS) $(LIBAO_CFLAGS) $(LIBASOUND2_CFLAGS) $(LIBDSSIALSACOMPAT_CFLAGS) $(LIBXML2_CFLAGS) $(SNDFILE_CFLAGS) $(LIBINSTPATCH_CFLAGS) $(JSON_GLIB_CFLAGS) $(GOBJECT_CFLAGS) $(LIBSOUP_CFLAGS) $(JACK_CFLAGS) $(GSTREAMER_CFLAGS)
+ags_recall_snapshot_test_LDFLAGS = -pthread $(LDFLAGS)
+ags_recall_snapshot_test_LDADD = libags_audio.la libags_server.la libags_thread.la libags.la libags_thread.la -lcunit  -lm $(LIBAO_LIBS) $(LIBASOUND2_LIBS) $(LIBXML2_LIBS) $(SNDFILE_LIBS) $(LIBINSTPATCH_LIBS) $(JSON_GLIB_LIBS) $(GOBJECT_LIBS) $(LIBSOUP_LIBS) $(JACK_LIBS) $(GSTREAMER_LIBS)
+
+# recall profiler unit test
+ags_recall_profiler_test_SOURCES = ags/test/audio/ags_recall_profiler_test.c
+ags_recall_profiler_test_CFLAGS = $(CFLAGS) $(UNIT_TEST_CFLAGS) $(LIBAO_CFLAGS) $(LIBASOUND2_CFLAGS) $(LIBDSSIALSACOMPAT_CFLAGS) $(LIBXML2_CFLAGS) $(SNDFILE_CFLAGS) $(LIBINSTPATCH_CFLAGS) $(JSON_GLIB_CFLAGS) $(GOBJECT_CFLAGS) $(LIBSOUP_CFLAGS) $(JACK_CFLAGS) $(GSTREAMER_CFLAGS)
+ags_recall_profiler_test_LDFLAGS = -pthread $(LDFLAGS)
+ags_recall_profiler_test_LDADD = libags_audio.la libags_server.la libags_thread.la libags.la libags_thread.la -lcunit  -lm $(LIBAO_LIBS) $(LIBASOUND2_LIBS) $(LIBXML2_LIBS) $(SNDFILE_LIBS) $(LIBINSTPATCH_LIBS) $(JSON_GLIB_LIBS) $(GOBJECT_LIBS) $(LIBSOUP_LIBS) $(JACK_LIBS) $(GSTREAMER_LIBS)
+
+# tempo map unit test
+ags_tempo_map_test_SOURCES = ags/test/audio/ags_tempo_map_test.c
+ags_tempo_map_test_CFLAGS = $(CFLAGS) $(UNIT_TEST_CFLAGS) $(LIBAO_CFLAGS) $(LIBASOUND2_CFLAGS) $(LIBDSSIALSACOMPAT_CFLAGS) $(LIBXML2_CFLAGS) $(SNDFILE_CFLAGS) $(LIBINSTPATCH_CFLAGS) $(JSON_GLIB_CFLAGS) $(GOBJECT_CFLAGS) $(LIBSOUP_CFLAGS) $(JACK_CFLAGS) $(GSTREAMER_CFLAGS)
+ags_tempo_map_test_LDFLAGS = -pthread $(LDFLAGS)
+ags_tempo_map_test_LDADD = libags_audio.la libags_server.la libags_thread.la libags.la libags_thread.la -lcunit  -lm $(LIBAO_LIBS) $(LIBASOUND2_LIBS) $(LIBXML2_LIBS) $(SNDFILE_LIBS) $(LIBINSTPATCH_LIBS) $(JSON_GLIB_LIBS) $(GOBJECT_LIBS) $(LIBSOUP_LIBS) $(JACK_LIBS) $(GSTREAMER_LIBS)
+
+# timestamp index unit test
+ags_timestamp_index_test_SOURCES = ags/test/audio/ags_timestamp_index_test.c
+ags_timestamp_index_test_CFLAGS = $(CFLAGS) $(UNIT_TEST_CFLAGS) $(LIBAO_CFLAGS) $(LIBASOUND2_CFLAGS) $(LIBDSSIALSACOMPAT_CFLAGS) $(LIBXML2_CFLAGS) $(SNDFILE_CFLAGS) $(LIBINSTPATCH_CFLAGS) $(JSON_GLIB_CFLAGS) $(GOBJECT_CFLAGS) $(LIBSOUP_CFLAGS) $(JACK_CFLAGS) $(GSTREAMER_CFLAGS)
+ags_timestamp_index_test_LDFLAGS = -pthread $(LDFLAGS)
+ags_timestamp_index_test_LDADD = libags_audio.la libags_server.la libags_thread.la libags.la libags_thread.la -lcunit  -lm $(LIBAO_LIBS) $(LIBASOUND2_LIBS) $(LIBXML2_LIBS) $(SNDFILE_LIBS) $(LIBINSTPATCH_LIBS) $(JSON_GLIB_LIBS) $(GOBJECT_LIBS) $(LIBSOUP_LIBS) $(JACK_LIBS) $(GSTREAMER_LIBS)
+
+# wave storage unit test
+ags_wave_storage_test_SOURCES = ags/test/audio/ags_wave_storage_test.c
+ags_wave_storage_test_CFLAGS = $(CFLAGS) $(UNIT_TEST_CFLAGS) $(LIBAO_CFLAGS) $(LIBASOUND2_CFLAGS) $(LIBDSSIALSACOMPAT_CFLAGS) $(LIBXML2_CFLAGS) $(SNDFILE_CFLAGS) $(LIBINSTPATCH_CFLAGS) $(JSON_GLIB_CFLAGS) $(GOBJECT_CFLAGS) $(LIBSOUP_CFLAGS) $(JACK_CFLAGS) $(GSTREAMER_CFLAGS)
+ags_wave_storage_test_LDFLAGS = -pthread $(LDFLAGS)
+ags_wave_storage_test_LDADD = libags_audio.la libags_server.la libags_thread.la libags.la libags_thread.la -lcunit  -lm $(LIBAO_LIBS) $(LIBASOUND2_LIBS) $(LIBXML2_LIBS) $(SNDFILE_LIBS) $(LIBINSTPATCH_LIBS) $(JSON_GLIB_LIBS) $(GOBJECT_LIBS) $(LIBSOUP_LIBS) $(JACK_LIBS) $(GSTREAMER_LIBS)
+
+# wave stream unit test
+ags_wave_stream_test_SOURCES = ags/test/audio/ags_wave_stream_test.c
+ags_wave_stream_test_CFLAGS = $(CFLAGS) $(UNIT_TEST_CFLAGS) $(LIBAO_CFLAGS) $(LIBASOUND2_CFLAGS) $(LIBDSSIALSACOMPAT_CFLAGS) $(LIBXML2_CFLAGS) $(SNDFILE_CFLAGS) $(LIBINSTPATCH_CFLAGS) $(JSON_GLIB_CFLAGS) $(GOBJECT_CFLAGS) $(LIBSOUP_CFLAGS) $(JACK_CFLAGS) $(GSTREAMER_CFLAGS)
+ags_wave_stream_test_LDFLAGS = -pthread $(LDFLAGS)
+ags_wave_stream_test_LDADD = libags_audio.la libags_server.la libags_thread.la libags.la libags_thread.la -lcunit  -lm $(LIBAO_LIBS) $(LIBASOUND2_LIBS) $(LIBXML2_LIBS) $(SNDFILE_LIBS) $(LIBINSTPATCH_LIBS) $(JSON_GLIB_LIBS) $(GOBJECT_LIBS) $(LIBSOUP_LIBS) $(JACK_LIBS) $(GSTREAMER_LIBS)
+
+# wave peak unit test
+ags_wave_peak_test_SOURCES = ags/test/audio/ags_wave_peak_test.c
+ags_wave_peak_test_CFLAGS = $(CFLAGS) $(UNIT_TEST_CFLAGS) $(LIBAO_CFLAGS) $(LIBASOUND2_CFLAGS) $(LIBDSSIALSACOMPAT_CFLAGS) $(LIBXML2_CFLAGS) $(SNDFILE_CFLAGS) $(LIBINSTPATCH_CFLAGS) $(JSON_GLIB_CFLAGS) $(GOBJECT_CFLAGS) $(LIBSOUP_CFLAGS) $(JACK_CFLAGS) $(GSTREAMER_CFLAGS)
+ags_wave_peak_test_LDFLAGS = -pthread $(LDFLAGS)
+ags_wave_peak_test_LDADD = libags_audio.la libags_server.la libags_thread.la libags.la libags_thread.la -lcunit  -lm $(LIBAO_LIBS) $(LIBASOUND2_LIBS) $(LIBXML2_LIBS) $(SNDFILE_LIBS) $(LIBINSTPATCH_LIBS) $(JSON_GLIB_LIBS) $(GOBJECT_LIBS) $(LIBSOUP_LIBS) $(JACK_LIBS) $(GSTREAMER_LIBS)
+
 # recycling context unit test
 ags_recycling_context_test_SOURCES = ags/test/audio/ags_recycling_context_test.c
 ags_recycling_context_test_CFLAGS = $(CFLAGS) $(UNIT_TEST_CFLAGS) $(LIBAO_CFLAGS) $(LIBASOUND2_CFLAGS) $(LIBDSSIALSACOMPAT_CFLAGS) $(LIBXML2_CFLAGS) $(SNDFILE_CFLAGS) $(LIBINSTPATCH_CFLAGS) $(JSON_GLIB_CFLAGS) $(GOBJECT_CFLAGS) $(LIBSOUP_CFLAGS) $(JACK_CFLAGS) $(GSTREAMER_CFLAGS)
@@ -968,12 +1082,24 @@ ags_note_test_CFLAGS = $(CFLAGS) $(UNIT_TEST_CFLAGS) $(LIBAO_CFLAGS) $(LIBASOUND
 ags_note_test_LDFLAGS = -pthread $(LDFLAGS)
 ags_note_test_LDADD = libags_audio.la libags_server.la libags_thread.la libags.la libags_thread.la -lcunit  -lm $(LIBAO_LIBS) $(LIBASOUND2_LIBS) $(LIBXML2_LIBS) $(SNDFILE_LIBS) $(LIBINSTPATCH_LIBS) $(JSON_GLIB_LIBS) $(GOBJECT_LIBS) $(LIBSOUP_LIBS) $(JACK_LIBS) $(GSTREAMER_LIBS)
 
+# note index unit test
+ags_note_index_test_SOURCES = ags/test/audio/ags_note_index_test.c
+ags_note_index_test_CFLAGS = $(CFLAGS) $(UNIT_TEST_CFLAGS) $(LIBAO_CFLAGS) $(LIBASOUND2_CFLAGS) $(LIBDSSIALSACOMPAT_CFLAGS) $(LIBXML2_CFLAGS) $(SNDFILE_CFLAGS) $(LIBINSTPATCH_CFLAGS) $(JSON_GLIB_CFLAGS) $(GOBJECT_CFLAGS) $(LIBSOUP_CFLAGS) $(JACK_CFLAGS) $(GSTREAMER_CFLAGS)
+ags_note_index_test_LDFLAGS = -pthread $(LDFLAGS)
+ags_note_index_test_LDADD = libags_audio.la libags_server.la libags_thread.la libags.la libags_thread.la -lcunit  -lm $(LIBAO_LIBS) $(LIBASOUND2_LIBS) $(LIBXML2_LIBS) $(SNDFILE_LIBS) $(LIBINSTPATCH_LIBS) $(JSON_GLIB_LIBS) $(GOBJECT_LIBS) $(LIBSOUP_LIBS) $(JACK_LIBS) $(GSTREAMER_LIBS)
+
 # automation unit test
 ags_automation_test_SOURCES = ags/test/audio/ags_automation_test.c
 ags_automation_test_CFLAGS = $(CFLAGS) $(UNIT_TEST_CFLAGS) $(LIBAO_CFLAGS) $(LIBASOUND2_CFLAGS) $(LIBDSSIALSACOMPAT_CFLAGS) $(LIBXML2_CFLAGS) $(SNDFILE_CFLAGS) $(LIBINSTPATCH_CFLAGS) $(JSON_GLIB_CFLAGS) $(GOBJECT_CFLAGS) $(LIBSOUP_CFLAGS) $(JACK_CFLAGS) $(GSTREAMER_CFLAGS)
 ags_automation_test_LDFLAGS = -pthread $(LDFLAGS)
 ags_automation_test_LDADD = libags_audio.la libags_server.la libags_thread.la libags.la libags_thread.la -lcunit -lm  $(LIBAO_LIBS) $(LIBASOUND2_LIBS) $(LIBXML2_LIBS) $(SNDFILE_LIBS) $(LIBINSTPATCH_LIBS) $(JSON_GLIB_LIBS) $(GOBJECT_LIBS) $(LIBSOUP_LIBS) $(JACK_LIBS) $(GSTREAMER_LIBS)
 
+# automation cursor unit test
+ags_automation_cursor_test_SOURCES = ags/test/audio/ags_automation_cursor_test.c
+ags_automation_cursor_test_CFLAGS = $(CFLAGS) $(UNIT_TEST_CFLAGS) $(LIBAO_CFLAGS) $(LIBASOUND2_CFLAGS) $(LIBDSSIALSACOMPAT_CFLAGS) $(LIBXML2_CFLAGS) $(SNDFILE_CFLAGS) $(LIBINSTPATCH_CFLAGS) $(JSON_GLIB_CFLAGS) $(GOBJECT_CFLAGS) $(LIBSOUP_CFLAGS) $(JACK_CFLAGS) $(GSTREAMER_CFLAGS)
+ags_automation_cursor_test_LDFLAGS = -pthread $(LDFLAGS)
+ags_automation_cursor_test_LDADD = libags_audio.la libags_server.la libags_thread.la libags.la libags_thread.la -lcunit -lm  $(LIBAO_LIBS) $(LIBASOUND2_LIBS) $(LIBXML2_LIBS) $(SNDFILE_LIBS) $(LIBINSTPATCH_LIBS) $(JSON_GLIB_LIBS) $(GOBJECT_LIBS) $(LIBSOUP_LIBS) $(JACK_LIBS) $(GSTREAMER_LIBS)
+
 # acceleration unit test
 ags_acceleration_test_SOURCES = ags/test/audio/ags_acceleration_test.c
 ags_acceleration_test_CFLAGS = $(CFLAGS) $(UNIT_TEST_CFLAGS) $(LIBAO_CFLAGS) $(LIBASOUND2_CFLAGS) $(LIBDSSIALSACOMPAT_CFLAGS) $(LIBXML2_CFLAGS) $(SNDFILE_CFLAGS) $(LIBINSTPATCH_CFLAGS) $(JSON_GLIB_CFLAGS) $(GOBJECT_CFLAGS) $(LIBSOUP_CFLAGS) $(JACK_CFLAGS) $(GSTREAMER_CFLAGS)